@@ -0,0 +1,364 @@
+/*
+ * KaitoTokyo Async Library Benchmarks
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <exception>
+#include <latch>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <KaitoTokyo/Async/Channel.hpp>
+#include <KaitoTokyo/Async/FrameAllocator.hpp>
+#include <KaitoTokyo/Async/Join.hpp>
+#include <KaitoTokyo/Async/MpscChannel.hpp>
+#include <KaitoTokyo/Async/Task.hpp>
+#include <KaitoTokyo/Async/ThreadPoolExecutor.hpp>
+#include <KaitoTokyo/Async/WorkStealingExecutor.hpp>
+
+#include "../BenchmarkRunner.hpp"
+
+using namespace KaitoTokyo;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Resumes posted coroutines in order, standing in for the executors the plugin hops onto.
+class WorkerThread {
+public:
+	WorkerThread() : thread_([this]() { run(); }) {}
+
+	~WorkerThread()
+	{
+		{
+			std::scoped_lock lock(mutex_);
+			stopping_ = true;
+		}
+		condition_.notify_one();
+		thread_.join();
+	}
+
+	auto schedule()
+	{
+		struct ScheduleAwaiter {
+			WorkerThread &worker;
+
+			bool await_ready() const noexcept { return false; }
+
+			void await_suspend(std::coroutine_handle<> handle)
+			{
+				{
+					std::scoped_lock lock(worker.mutex_);
+					worker.handles_.push_back(handle);
+				}
+				worker.condition_.notify_one();
+			}
+
+			void await_resume() const noexcept {}
+		};
+		return ScheduleAwaiter{*this};
+	}
+
+private:
+	void run()
+	{
+		for (;;) {
+			std::coroutine_handle<> handle;
+			{
+				std::unique_lock lock(mutex_);
+				condition_.wait(lock, [this]() { return stopping_ || !handles_.empty(); });
+				if (handles_.empty()) {
+					return;
+				}
+				handle = handles_.front();
+				handles_.pop_front();
+			}
+			handle.resume();
+		}
+	}
+
+	std::mutex mutex_;
+	std::condition_variable condition_;
+	std::deque<std::coroutine_handle<>> handles_;
+	bool stopping_ = false;
+	std::thread thread_;
+};
+
+template<template<typename> typename ChannelT>
+Async::Task<void> countMessages(ChannelT<std::int64_t> &channel, std::int64_t &received)
+{
+	while (std::optional<std::int64_t> value = co_await channel.receive()) {
+		++received;
+	}
+}
+
+// The consumer is resumed inline by whichever producer finds it waiting, as in the plugin's main loop.
+template<template<typename> typename ChannelT>
+void benchmarkSendThroughput(Benchmarks::BenchmarkRunner &runner, const std::string &channelName, int producerCount)
+{
+	constexpr std::int64_t kMessagesPerProducer = 200000;
+	const std::string name = channelName + "/Send/Producers:" + std::to_string(producerCount);
+	if (!runner.isSelected(name)) {
+		return;
+	}
+
+	ChannelT<std::int64_t> channel;
+	std::int64_t received = 0;
+	Async::Task<void> consumer = countMessages(channel, received);
+	consumer.start();
+
+	const Clock::time_point start = Clock::now();
+	std::vector<std::thread> producers;
+	for (int p = 0; p < producerCount; ++p) {
+		producers.emplace_back([&channel]() {
+			for (std::int64_t i = 0; i < kMessagesPerProducer; ++i) {
+				channel.send(i);
+			}
+		});
+	}
+	for (std::thread &producer : producers) {
+		producer.join();
+	}
+	channel.close();
+	const Clock::time_point end = Clock::now();
+
+	if (received != kMessagesPerProducer * producerCount) {
+		std::fprintf(stderr, "%s: received %lld messages\n", name.c_str(), static_cast<long long>(received));
+	}
+	runner.record(name, kMessagesPerProducer * producerCount, end - start);
+}
+
+template<template<typename> typename ChannelT>
+Async::Task<void> measureWakeups(ChannelT<Clock::time_point> &channel, std::chrono::nanoseconds &total,
+				 std::int64_t &count)
+{
+	while (std::optional<Clock::time_point> sentAt = co_await channel.receive()) {
+		total += Clock::now() - *sentAt;
+		++count;
+	}
+}
+
+// Time from send() on another thread until the suspended receiver runs again.
+template<template<typename> typename ChannelT>
+void benchmarkReceiveWakeup(Benchmarks::BenchmarkRunner &runner, const std::string &channelName)
+{
+	constexpr std::int64_t kRounds = 20000;
+	const std::string name = channelName + "/ReceiveWakeup";
+	if (!runner.isSelected(name)) {
+		return;
+	}
+
+	ChannelT<Clock::time_point> channel;
+	std::chrono::nanoseconds total{0};
+	std::int64_t count = 0;
+	Async::Task<void> receiver = measureWakeups(channel, total, count);
+	receiver.start();
+
+	std::thread sender([&channel]() {
+		for (std::int64_t i = 0; i < kRounds; ++i) {
+			// Let the receiver suspend again so that every send wakes it.
+			while (channel.size() != 0) {
+				std::this_thread::yield();
+			}
+			channel.send(Clock::now());
+		}
+		channel.close();
+	});
+	sender.join();
+
+	runner.record(name, count, total);
+}
+
+Async::Task<int> leaf(int value)
+{
+	co_return value + 1;
+}
+
+Async::Task<int> chain(int depth)
+{
+	if (depth == 0) {
+		co_return 0;
+	}
+	co_return co_await chain(depth - 1) + 1;
+}
+
+Async::Task<void> awaitLeaves(std::int64_t count, std::int64_t &sum)
+{
+	for (std::int64_t i = 0; i < count; ++i) {
+		sum += co_await leaf(static_cast<int>(i & 0xff));
+	}
+}
+
+Async::Task<void> awaitChain(int depth, int &result)
+{
+	result = co_await chain(depth);
+}
+
+Async::Task<void> ready()
+{
+	co_return;
+}
+
+Async::Task<void> hopTo(WorkerThread &worker)
+{
+	co_await worker.schedule();
+}
+
+// A coroutine resumed through an executor's post(), which frees itself when it returns.
+struct Posted {
+	struct promise_type {
+		Posted get_return_object() { return Posted{std::coroutine_handle<promise_type>::from_promise(*this)}; }
+		std::suspend_always initial_suspend() noexcept { return {}; }
+		std::suspend_never final_suspend() noexcept { return {}; }
+		void return_void() noexcept {}
+		void unhandled_exception() noexcept { std::terminate(); }
+	};
+
+	std::coroutine_handle<> handle;
+};
+
+// Stands in for a continuation that wakes the next one from a worker, as a channel send or a finished
+// request does.
+template<typename Executor> Posted relay(Executor &executor, std::int64_t remaining, std::latch &done)
+{
+	if (remaining > 0) {
+		executor.post(relay(executor, remaining - 1, done).handle);
+	} else {
+		done.count_down();
+	}
+	co_return;
+}
+
+template<typename Executor> Posted leafOnWorker(std::latch &done)
+{
+	done.count_down();
+	co_return;
+}
+
+template<typename Executor> Posted fanOut(Executor &executor, std::int64_t count, std::latch &done)
+{
+	for (std::int64_t i = 0; i < count; ++i) {
+		executor.post(leafOnWorker<Executor>(done).handle);
+	}
+	co_return;
+}
+
+// Several chains of continuations woken from workers, and one worker spawning many short ones.
+template<typename Executor, typename Options>
+void benchmarkExecutor(Benchmarks::BenchmarkRunner &runner, const std::string &executorName)
+{
+	constexpr std::size_t kThreadCount = 4;
+	constexpr std::int64_t kChains = 8;
+	constexpr std::int64_t kHopsPerChain = 20000;
+	constexpr std::int64_t kFanOut = 100000;
+
+	const std::string relayName = "Executor/" + executorName + "/WakeFromWorker";
+	if (runner.isSelected(relayName)) {
+		Executor executor(Options{.name = executorName, .threadCount = kThreadCount});
+		std::latch done(kChains);
+		const Clock::time_point start = Clock::now();
+		for (std::int64_t i = 0; i < kChains; ++i) {
+			executor.post(relay(executor, kHopsPerChain, done).handle);
+		}
+		done.wait();
+		runner.record(relayName, kChains * kHopsPerChain, Clock::now() - start);
+	}
+
+	const std::string fanOutName = "Executor/" + executorName + "/FanOutFromWorker";
+	if (runner.isSelected(fanOutName)) {
+		Executor executor(Options{.name = executorName, .threadCount = kThreadCount});
+		std::latch done(kFanOut);
+		const Clock::time_point start = Clock::now();
+		executor.post(fanOut(executor, kFanOut, done).handle);
+		done.wait();
+		runner.record(fanOutName, kFanOut, Clock::now() - start);
+	}
+}
+
+} // anonymous namespace
+
+// Usage: Async_benchmark [--filter=SUBSTRING] [--json=PATH]
+int main(int argc, char **argv)
+{
+	std::optional<Benchmarks::BenchmarkOptions> options = Benchmarks::parseBenchmarkOptions(argc, argv);
+	if (!options) {
+		return 2;
+	}
+	Benchmarks::BenchmarkRunner runner("Async_benchmark", std::move(*options));
+
+	benchmarkSendThroughput<Async::Channel>(runner, "Channel", 1);
+	benchmarkSendThroughput<Async::Channel>(runner, "Channel", 4);
+	benchmarkReceiveWakeup<Async::Channel>(runner, "Channel");
+
+	benchmarkSendThroughput<Async::MpscChannel>(runner, "MpscChannel", 1);
+	benchmarkSendThroughput<Async::MpscChannel>(runner, "MpscChannel", 4);
+	benchmarkReceiveWakeup<Async::MpscChannel>(runner, "MpscChannel");
+
+	// One frame allocation, start, co_return and destruction per iteration, with and without recycling.
+	constexpr std::int64_t kLeafCount = 1000000;
+	for (const bool recycling : {true, false}) {
+		const std::string name = recycling ? "Task/CreateAndAwait" : "Task/CreateAndAwait/NoRecycling";
+		if (!runner.isSelected(name)) {
+			continue;
+		}
+		Async::FrameAllocator::setRecyclingEnabled(recycling);
+		std::int64_t sum = 0;
+		const Clock::time_point start = Clock::now();
+		Async::Task<void> task = awaitLeaves(kLeafCount, sum);
+		task.start();
+		runner.record(name, kLeafCount, Clock::now() - start);
+	}
+	Async::FrameAllocator::setRecyclingEnabled(true);
+
+	// Whole chains; divide by the depth for the cost of one level resumed through TaskSymmetricTransfer.
+	for (const int depth : {16, 1024, 65536}) {
+		const std::string name = "Task/AwaitChain/Depth:" + std::to_string(depth);
+		runner.run(name, 1000000 / depth, [depth]() {
+			int result = 0;
+			Async::Task<void> task = awaitChain(depth, result);
+			task.start();
+		});
+	}
+
+	runner.run("Join/Ready", 100000, []() { Async::join(ready()); });
+
+	{
+		WorkerThread worker;
+		runner.run("Join/AcrossThreads", 20000, [&worker]() { Async::join(hopTo(worker)); });
+	}
+
+	// ThreadPoolExecutor has the single shared FIFO that QThreadPool gave the plugin before.
+	benchmarkExecutor<Async::ThreadPoolExecutor, Async::ThreadPoolExecutorOptions>(runner, "ThreadPool");
+	benchmarkExecutor<Async::WorkStealingExecutor, Async::WorkStealingExecutorOptions>(runner, "WorkStealing");
+
+	return runner.finish();
+}
@@ -0,0 +1,176 @@
+/*
+ * Live Stream Segmenter - Benchmarks
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+namespace KaitoTokyo::Benchmarks {
+
+struct BenchmarkOptions {
+	std::string filter;
+	std::filesystem::path jsonPath;
+};
+
+/**
+ * Parses [--filter=SUBSTRING] [--json=PATH]. Other arguments go to parseArgument, which returns false
+ * for ones it does not know either; extraUsage then extends the usage line. Returns nullopt after
+ * reporting an unknown argument.
+ */
+inline std::optional<BenchmarkOptions>
+parseBenchmarkOptions(int argc, char **argv, const std::function<bool(std::string_view)> &parseArgument = {},
+		      std::string_view extraUsage = {})
+{
+	BenchmarkOptions options;
+	for (int i = 1; i < argc; ++i) {
+		const std::string_view arg(argv[i]);
+		if (arg.starts_with("--filter=")) {
+			options.filter = arg.substr(std::string_view("--filter=").size());
+		} else if (arg.starts_with("--json=")) {
+			options.jsonPath = arg.substr(std::string_view("--json=").size());
+		} else if (!parseArgument || !parseArgument(arg)) {
+			std::fprintf(stderr,
+				     "Unknown argument: %s\nUsage: %s [--filter=SUBSTRING] [--json=PATH] %.*s\n",
+				     argv[i], argv[0], static_cast<int>(extraUsage.size()), extraUsage.data());
+			return std::nullopt;
+		}
+	}
+	return options;
+}
+
+/**
+ * Times benchmark bodies, prints one line per benchmark and collects the results for JSON output.
+ */
+class BenchmarkRunner {
+public:
+	BenchmarkRunner(std::string executable, BenchmarkOptions options)
+		: executable_(std::move(executable)),
+		  options_(std::move(options))
+	{
+	}
+
+	bool isSelected(const std::string &name) const
+	{
+		return options_.filter.empty() || name.find(options_.filter) != std::string::npos;
+	}
+
+	/**
+	 * Calls body once to warm up, then iterations times, and records the mean time per call.
+	 */
+	template<typename F> void run(const std::string &name, std::int64_t iterations, F body)
+	{
+		if (!isSelected(name)) {
+			return;
+		}
+
+		body();
+
+		const auto start = std::chrono::steady_clock::now();
+		for (std::int64_t i = 0; i < iterations; ++i) {
+			body();
+		}
+		record(name, iterations, std::chrono::steady_clock::now() - start);
+	}
+
+	/**
+	 * Records a benchmark that measured itself, for throughput and latency runs that need their own setup.
+	 */
+	void record(const std::string &name, std::int64_t iterations, std::chrono::nanoseconds elapsed)
+	{
+		const double microsecondsPerIteration =
+			std::chrono::duration<double, std::micro>(elapsed).count() / static_cast<double>(iterations);
+		results_.push_back(Result{name, iterations, microsecondsPerIteration});
+		std::printf("%-48s %10lld iterations %14.3f us\n", name.c_str(), static_cast<long long>(iterations),
+			    microsecondsPerIteration);
+	}
+
+	/**
+	 * Writes the results when --json was given; in the shape of Google Benchmark's JSON output, so
+	 * existing trackers can read it. Returns the process exit code.
+	 */
+	int finish() const
+	{
+		if (options_.jsonPath.empty()) {
+			return 0;
+		}
+
+		std::ofstream ofs(options_.jsonPath);
+		ofs << toJson().dump(2) << '\n';
+		if (!ofs) {
+			std::fprintf(stderr, "Failed to write %s\n", options_.jsonPath.string().c_str());
+			return 1;
+		}
+		return 0;
+	}
+
+	nlohmann::json toJson() const
+	{
+		nlohmann::json benchmarks = nlohmann::json::array();
+		for (const Result &result : results_) {
+			benchmarks.push_back({
+				{"name", result.name},
+				{"run_name", result.name},
+				{"run_type", "iteration"},
+				{"iterations", result.iterations},
+				{"real_time", result.microsecondsPerIteration},
+				{"cpu_time", result.microsecondsPerIteration},
+				{"time_unit", "us"},
+			});
+		}
+
+		char date[32] = {};
+		const std::time_t now = std::time(nullptr);
+		std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+		return {
+			{"context", {{"date", date}, {"executable", executable_}}},
+			{"benchmarks", std::move(benchmarks)},
+		};
+	}
+
+private:
+	struct Result {
+		std::string name;
+		std::int64_t iterations;
+		double microsecondsPerIteration;
+	};
+
+	const std::string executable_;
+	const BenchmarkOptions options_;
+	std::vector<Result> results_;
+};
+
+} // namespace KaitoTokyo::Benchmarks
@@ -0,0 +1,446 @@
+/*
+ * Live Stream Segmenter - Controller Module Benchmarks
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Drives a continuous session end to end against the mock YouTube client and an OBS stub:
+ * start, then segments back to back, then stop. The mock answers with the latencies and failures
+ * of --profile, and the stub makes an ingest visible to YouTube only after --ingest-delay.
+ *
+ * The cutover gap of a segment is the wall-clock time from stopping the outgoing stream to the
+ * incoming broadcast going live, which is what viewers see as dead air. It is zero when the
+ * outgoing stream is only stopped after that, as with --make-before-break.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <source_location>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <QApplication>
+#include <QElapsedTimer>
+#include <QEventLoop>
+#include <QTimer>
+#include <QWidget>
+
+#include <nlohmann/json.hpp>
+
+#include <KaitoTokyo/CurlHelper/CurlConnectionPool.hpp>
+#include <KaitoTokyo/GoogleAuth/GoogleTokenState.hpp>
+#include <KaitoTokyo/Logger/ILogger.hpp>
+#include <KaitoTokyo/Logger/PrintLogger.hpp>
+#include <KaitoTokyo/YouTubeApi/YouTubeMockProfile.hpp>
+
+#include <AuthStore.hpp>
+#include <EventHandlerStore.hpp>
+#include <GoogleAccessTokenProvider.hpp>
+#include <ScriptingExecutor.hpp>
+#include <ScriptingRuntime.hpp>
+#include <YouTubeStore.hpp>
+#include <YouTubeStreamSegmenterMainLoop.hpp>
+
+#include "../BenchmarkRunner.hpp"
+#include "ObsFrontendStub.hpp"
+
+using namespace KaitoTokyo;
+using namespace KaitoTokyo::LiveStreamSegmenter;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct CutoverOptions {
+	int segments = 5;
+	bool prepare = false;
+	bool makeBeforeBreak = false;
+	std::chrono::milliseconds ingestDelay{1000};
+	std::chrono::milliseconds stopDelay{200};
+	std::filesystem::path profilePath;
+	bool verbose = false;
+};
+
+constexpr std::string_view kCutoverUsage = "[--segments=N] [--prepare] [--make-before-break] "
+					   "[--ingest-delay=MS] [--stop-delay=MS] [--profile=PATH] [--verbose]";
+
+constexpr std::chrono::seconds kStepTimeout{300};
+
+bool parseCutoverArgument(std::string_view arg, CutoverOptions &options)
+{
+	const auto valueOf = [arg](std::string_view prefix) -> std::optional<std::string> {
+		if (!arg.starts_with(prefix)) {
+			return std::nullopt;
+		}
+		return std::string(arg.substr(prefix.size()));
+	};
+
+	if (std::optional<std::string> value = valueOf("--segments=")) {
+		options.segments = std::max(1, std::atoi(value->c_str()));
+	} else if (arg == "--prepare") {
+		options.prepare = true;
+	} else if (arg == "--make-before-break") {
+		options.makeBeforeBreak = true;
+	} else if (std::optional<std::string> value = valueOf("--ingest-delay=")) {
+		options.ingestDelay = std::chrono::milliseconds(std::atoll(value->c_str()));
+	} else if (std::optional<std::string> value = valueOf("--stop-delay=")) {
+		options.stopDelay = std::chrono::milliseconds(std::atoll(value->c_str()));
+	} else if (std::optional<std::string> value = valueOf("--profile=")) {
+		options.profilePath = *value;
+	} else if (arg == "--verbose") {
+		options.verbose = true;
+	} else {
+		return false;
+	}
+	return true;
+}
+
+/**
+ * Remembers when each event was logged, and passes warnings and errors on to stdout.
+ */
+class RecordingLogger : public Logger::ILogger {
+public:
+	struct Event {
+		std::string name;
+		Clock::time_point time;
+	};
+
+	explicit RecordingLogger(bool verbose) : verbose_(verbose) {}
+
+	void log(Logger::LogLevel level, std::string_view name, std::source_location loc,
+		 std::span<const Logger::LogField> context) const noexcept override
+	{
+		try {
+			std::scoped_lock lock(mutex_);
+			events_.push_back(Event{std::string(name), Clock::now()});
+		} catch (...) {
+		}
+
+		if (verbose_ || level >= Logger::LogLevel::Warn) {
+			Logger::PrintLogger::instance()->log(level, name, loc, context);
+		}
+	}
+
+	std::vector<Event> getEvents() const
+	{
+		std::scoped_lock lock(mutex_);
+		return events_;
+	}
+
+	std::size_t count(std::string_view name) const
+	{
+		std::scoped_lock lock(mutex_);
+		return static_cast<std::size_t>(std::count_if(events_.begin(), events_.end(),
+							      [name](const Event &e) { return e.name == name; }));
+	}
+
+private:
+	const bool verbose_;
+	mutable std::mutex mutex_;
+	mutable std::vector<Event> events_;
+};
+
+std::string makeEventHandlerScript(const CutoverOptions &options, const std::filesystem::path &thumbnailPath)
+{
+	// Segments are triggered by the harness, so the timers are pushed out of the way.
+	const nlohmann::json config{
+		{"segmentIntervalMilliseconds", 24 * 60 * 60 * 1000},
+		{"prepareAheadMilliseconds", 0},
+		{"makeBeforeBreak", options.makeBeforeBreak},
+	};
+	const std::string thumbnailFile = nlohmann::json(thumbnailPath.string()).dump();
+
+	return R"(import { LiveBroadcastBuilder } from "builtin:youtube";
+
+function createLiveBroadcast(title) {
+  return { YouTubeLiveBroadcast: new LiveBroadcastBuilder(title, new Date(), 'private').build() };
+}
+
+function setThumbnail({ LiveBroadcast: { id: videoId } }) {
+  return { videoId, thumbnailFile: )" +
+	       thumbnailFile + R"( };
+}
+
+let index = 0;
+
+export function onInitYouTubeStreamSegmenter() {
+  return )" + config.dump() +
+	       R"(;
+}
+
+export function onCreateYouTubeLiveBroadcastInitial() { return createLiveBroadcast(`Cutover ${++index}`); }
+export function onCreateYouTubeLiveBroadcastInitialNext() { return createLiveBroadcast(`Cutover ${++index}`); }
+export function onCreateYouTubeLiveBroadcastNext() { return createLiveBroadcast(`Cutover ${++index}`); }
+export function onSetYouTubeThumbnailInitial(event) { return setThumbnail(event); }
+export function onSetYouTubeThumbnailInitialNext(event) { return setThumbnail(event); }
+export function onSetYouTubeThumbnailNext(event) { return setThumbnail(event); }
+)";
+}
+
+// Runs the Qt event loop until the main loop has logged doneEvent count times, or fails on its first error.
+bool waitForEvent(const RecordingLogger &logger, std::string_view doneEvent, std::size_t count)
+{
+	QElapsedTimer elapsed;
+	elapsed.start();
+	while (logger.count(doneEvent) < count) {
+		if (logger.count("MainLoopError") > 0 || logger.count("MainLoopUnknownError") > 0) {
+			std::fprintf(stderr, "The main loop failed while waiting for %.*s\n",
+				     static_cast<int>(doneEvent.size()), doneEvent.data());
+			return false;
+		}
+		if (elapsed.hasExpired(std::chrono::milliseconds(kStepTimeout).count())) {
+			std::fprintf(stderr, "Timed out waiting for %.*s\n", static_cast<int>(doneEvent.size()),
+				     doneEvent.data());
+			return false;
+		}
+
+		QEventLoop loop;
+		QTimer::singleShot(5, &loop, &QEventLoop::quit);
+		loop.exec();
+	}
+	return true;
+}
+
+struct Interval {
+	std::size_t begin;
+	std::size_t end;
+};
+
+// Pairs each beginName event with the next endName event.
+std::vector<Interval> findIntervals(const std::vector<RecordingLogger::Event> &events, std::string_view beginName,
+				    std::string_view endName)
+{
+	std::vector<Interval> intervals;
+	std::optional<std::size_t> begin;
+	for (std::size_t i = 0; i < events.size(); ++i) {
+		if (events[i].name == beginName) {
+			begin = i;
+		} else if (events[i].name == endName && begin) {
+			intervals.push_back(Interval{*begin, i});
+			begin.reset();
+		}
+	}
+	return intervals;
+}
+
+std::optional<std::size_t> findFirst(const std::vector<RecordingLogger::Event> &events, const Interval &interval,
+				     std::initializer_list<std::string_view> names)
+{
+	for (std::size_t i = interval.begin; i <= interval.end; ++i) {
+		if (std::find(names.begin(), names.end(), events[i].name) != names.end()) {
+			return i;
+		}
+	}
+	return std::nullopt;
+}
+
+std::chrono::nanoseconds between(const std::vector<RecordingLogger::Event> &events, std::size_t from, std::size_t to)
+{
+	return std::max(std::chrono::nanoseconds::zero(), events[to].time - events[from].time);
+}
+
+double toMilliseconds(std::chrono::nanoseconds duration)
+{
+	return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+} // anonymous namespace
+
+int main(int argc, char **argv)
+{
+	CutoverOptions cutoverOptions;
+	std::optional<Benchmarks::BenchmarkOptions> options = Benchmarks::parseBenchmarkOptions(
+		argc, argv, [&](std::string_view arg) { return parseCutoverArgument(arg, cutoverOptions); },
+		kCutoverUsage);
+	if (!options) {
+		return 2;
+	}
+
+	if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+		qputenv("QT_QPA_PLATFORM", "offscreen");
+	}
+	QApplication app(argc, argv);
+	QWidget parent;
+
+	const std::filesystem::path profileDirectory =
+		std::filesystem::temp_directory_path() / "live-stream-segmenter-ContinuousSessionCutover_benchmark";
+	std::filesystem::remove_all(profileDirectory);
+	std::filesystem::create_directories(profileDirectory);
+	const std::filesystem::path thumbnailPath = profileDirectory / "thumbnail.jpg";
+	std::ofstream(thumbnailPath, std::ios::binary) << "\xff\xd8\xff\xd9";
+
+	Benchmarks::configureObsFrontendStub({
+		.ingestDelay = cutoverOptions.ingestDelay,
+		.stopDelay = cutoverOptions.stopDelay,
+		.profilePath = profileDirectory,
+	});
+
+	auto mockProfile = std::make_shared<YouTubeApi::YouTubeMockProfile>();
+	if (!cutoverOptions.profilePath.empty()) {
+		std::ifstream ifs(cutoverOptions.profilePath);
+		if (!ifs) {
+			std::fprintf(stderr, "Failed to read %s\n", cutoverOptions.profilePath.string().c_str());
+			return 2;
+		}
+		try {
+			nlohmann::json::parse(ifs).get_to(*mockProfile);
+		} catch (const std::exception &e) {
+			std::fprintf(stderr, "Invalid profile %s: %s\n", cutoverOptions.profilePath.string().c_str(),
+				     e.what());
+			return 2;
+		}
+	}
+	// The mock names the stream key after the live stream id.
+	mockProfile->isLiveStreamActive = [](const std::string &liveStreamId) {
+		return Benchmarks::isObsFrontendStubIngesting(liveStreamId + "-key");
+	};
+	YouTubeApi::setYouTubeMockProfile(mockProfile);
+
+	const auto logger = std::make_shared<RecordingLogger>(cutoverOptions.verbose);
+
+	const auto runtime = std::make_shared<Scripting::ScriptingRuntime>();
+	runtime->setLogger(logger);
+	runtime->setExecutor(std::make_shared<Scripting::ScriptingExecutor>());
+
+	const auto curlPool = std::make_shared<CurlHelper::CurlConnectionPool>();
+
+	const auto authStore = std::make_shared<Store::AuthStore>();
+	authStore->setLogger(logger);
+	GoogleAuth::GoogleTokenState tokenState;
+	tokenState.access_token = "mock-access-token";
+	tokenState.refresh_token = "mock-refresh-token";
+	tokenState.expires_at = std::chrono::duration_cast<std::chrono::seconds>(
+					(std::chrono::system_clock::now() + std::chrono::hours(24)).time_since_epoch())
+					.count();
+	authStore->setGoogleTokenState(tokenState);
+	const auto tokenProvider = std::make_shared<Store::GoogleAccessTokenProvider>(authStore, curlPool, logger);
+
+	const auto eventHandlerStore = std::make_shared<Store::EventHandlerStore>();
+	eventHandlerStore->setLogger(logger);
+	eventHandlerStore->setEventHandlerScript(makeEventHandlerScript(cutoverOptions, thumbnailPath));
+
+	const auto youtubeStore = std::make_shared<Store::YouTubeStore>();
+	youtubeStore->setLogger(logger);
+	youtubeStore->setLiveStreamId(0, "mock-stream-0");
+	youtubeStore->setLiveStreamId(1, "mock-stream-1");
+
+	Benchmarks::BenchmarkRunner runner("ContinuousSessionCutover_benchmark", std::move(*options));
+
+	{
+		Controller::YouTubeStreamSegmenterMainLoop mainLoop(runtime, curlPool, tokenProvider, eventHandlerStore,
+								    youtubeStore, logger, &parent);
+		mainLoop.startMainLoop();
+
+		// Every message the main loop finishes without an error ends with its quota statistics.
+		constexpr std::string_view kDoneEvent = "YouTubeQuotaStatistics";
+		std::size_t done = 0;
+
+		mainLoop.onStartContinuousSession();
+		if (!waitForEvent(*logger, kDoneEvent, ++done)) {
+			return 1;
+		}
+
+		for (int i = 0; i < cutoverOptions.segments; ++i) {
+			if (cutoverOptions.prepare) {
+				mainLoop.onPrepareContinuousSessionSegment();
+				if (!waitForEvent(*logger, kDoneEvent, ++done)) {
+					return 1;
+				}
+			}
+			mainLoop.onSegmentContinuousSession();
+			if (!waitForEvent(*logger, kDoneEvent, ++done)) {
+				return 1;
+			}
+		}
+
+		mainLoop.onStopContinuousSession();
+		if (!waitForEvent(*logger, kDoneEvent, ++done)) {
+			return 1;
+		}
+	}
+
+	const std::vector<RecordingLogger::Event> events = logger->getEvents();
+
+	const auto recordIntervals = [&](const std::string &name, std::string_view beginName,
+					 std::string_view endName) {
+		const std::vector<Interval> intervals = findIntervals(events, beginName, endName);
+		if (intervals.empty() || !runner.isSelected(name)) {
+			return;
+		}
+		std::chrono::nanoseconds total{0};
+		for (const Interval &interval : intervals) {
+			total += between(events, interval.begin, interval.end);
+		}
+		runner.record(name, static_cast<std::int64_t>(intervals.size()), total);
+	};
+
+	recordIntervals("Session/Start", "ContinuousYouTubeSessionStarting", "ContinuousYouTubeSessionStarted");
+	recordIntervals("Session/Prepare", "ContinuousYouTubeSessionSegmentPreparing",
+			"ContinuousYouTubeSessionSegmentPrepared");
+	recordIntervals("Session/Segment", "ContinuousYouTubeSessionSegmenting", "ContinuousYouTubeSessionSegmented");
+	recordIntervals("Session/Stop", "ContinuousYouTubeSessionStopping", "ContinuousYouTubeSessionStopped");
+
+	std::vector<std::chrono::nanoseconds> gaps;
+	const std::vector<Interval> segments =
+		findIntervals(events, "ContinuousYouTubeSessionSegmenting", "ContinuousYouTubeSessionSegmented");
+	for (std::size_t i = 0; i < segments.size(); ++i) {
+		const std::optional<std::size_t> stop =
+			findFirst(events, segments[i], {"OBSStreamingStopping", "OBSStreamingOverlapOutputStopping"});
+		const std::optional<std::size_t> live =
+			findFirst(events, segments[i], {"YouTubeLiveBroadcastTransitionedToLive"});
+		if (!live) {
+			std::printf("segment %zu: the incoming broadcast never went live\n", i + 1);
+			continue;
+		}
+
+		const std::chrono::nanoseconds gap =
+			(stop && *stop < *live) ? between(events, *stop, *live) : std::chrono::nanoseconds::zero();
+		gaps.push_back(gap);
+		std::printf("segment %zu: cutover %.1f ms, gap %.1f ms\n", i + 1,
+			    toMilliseconds(between(events, segments[i].begin, segments[i].end)), toMilliseconds(gap));
+	}
+
+	if (!gaps.empty()) {
+		std::chrono::nanoseconds total{0};
+		for (const std::chrono::nanoseconds gap : gaps) {
+			total += gap;
+		}
+		std::sort(gaps.begin(), gaps.end());
+
+		if (runner.isSelected("Session/CutoverGap")) {
+			runner.record("Session/CutoverGap", static_cast<std::int64_t>(gaps.size()), total);
+		}
+		if (runner.isSelected("Session/CutoverGap/Median")) {
+			runner.record("Session/CutoverGap/Median", 1, gaps[gaps.size() / 2]);
+		}
+		if (runner.isSelected("Session/CutoverGap/Max")) {
+			runner.record("Session/CutoverGap/Max", 1, gaps.back());
+		}
+	}
+
+	std::filesystem::remove_all(profileDirectory);
+	return runner.finish();
+}
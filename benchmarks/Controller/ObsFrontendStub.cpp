@@ -0,0 +1,283 @@
+/*
+ * Live Stream Segmenter - Controller Module Benchmarks
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ObsFrontendStub.hpp"
+
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <QCoreApplication>
+#include <QTimer>
+
+#include <obs-frontend-api.h>
+#include <obs.h>
+#include <util/bmem.h>
+
+struct obs_service {
+	std::string streamKey;
+	int refs = 1;
+};
+
+struct obs_output {
+	obs_service_t *service = nullptr;
+	bool active = false;
+	int refs = 1;
+};
+
+struct obs_encoder {};
+
+namespace KaitoTokyo::Benchmarks {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct StubState {
+	std::mutex mutex;
+	ObsFrontendStubOptions options;
+	std::vector<std::pair<obs_frontend_event_cb, void *>> callbacks;
+	// Never destroyed; obs_frontend_get_streaming_output() hands out references to it.
+	obs_output frontendOutput;
+	obs_service_t *frontendService = nullptr;
+	std::map<std::string, Clock::time_point> ingestStartedAt;
+	obs_encoder encoder;
+};
+
+StubState &state()
+{
+	static StubState instance;
+	return instance;
+}
+
+void releaseService(obs_service_t *service)
+{
+	if (service && --service->refs == 0) {
+		delete service;
+	}
+}
+
+// Caller must hold the state mutex.
+void startIngest(StubState &s, obs_output_t *output)
+{
+	output->active = true;
+	if (output->service) {
+		s.ingestStartedAt[output->service->streamKey] = Clock::now();
+	}
+}
+
+// Caller must hold the state mutex.
+void stopIngest(StubState &s, obs_output_t *output)
+{
+	output->active = false;
+	if (output->service) {
+		s.ingestStartedAt.erase(output->service->streamKey);
+	}
+}
+
+} // anonymous namespace
+
+void configureObsFrontendStub(ObsFrontendStubOptions options)
+{
+	StubState &s = state();
+	std::scoped_lock lock(s.mutex);
+	s.options = std::move(options);
+}
+
+bool isObsFrontendStubIngesting(const std::string &streamKey)
+{
+	StubState &s = state();
+	std::scoped_lock lock(s.mutex);
+	const auto it = s.ingestStartedAt.find(streamKey);
+	return it != s.ingestStartedAt.end() && Clock::now() - it->second >= s.options.ingestDelay;
+}
+
+} // namespace KaitoTokyo::Benchmarks
+
+using KaitoTokyo::Benchmarks::releaseService;
+using KaitoTokyo::Benchmarks::startIngest;
+using KaitoTokyo::Benchmarks::state;
+using KaitoTokyo::Benchmarks::StubState;
+using KaitoTokyo::Benchmarks::stopIngest;
+
+extern "C" {
+
+bool obs_frontend_streaming_active(void)
+{
+	StubState &s = state();
+	std::scoped_lock lock(s.mutex);
+	return s.frontendOutput.active;
+}
+
+void obs_frontend_streaming_start(void)
+{
+	StubState &s = state();
+	std::scoped_lock lock(s.mutex);
+	s.frontendOutput.service = s.frontendService;
+	startIngest(s, &s.frontendOutput);
+}
+
+void obs_frontend_streaming_stop(void)
+{
+	StubState &s = state();
+	std::chrono::milliseconds stopDelay;
+	{
+		std::scoped_lock lock(s.mutex);
+		if (!s.frontendOutput.active) {
+			return;
+		}
+		stopIngest(s, &s.frontendOutput);
+		stopDelay = s.options.stopDelay;
+	}
+
+	QTimer::singleShot(stopDelay, qApp, []() {
+		StubState &s = state();
+		std::vector<std::pair<obs_frontend_event_cb, void *>> callbacks;
+		{
+			std::scoped_lock lock(s.mutex);
+			callbacks = s.callbacks;
+		}
+		// Callbacks may remove themselves, so they are called from a copy.
+		for (const auto &[callback, data] : callbacks) {
+			callback(OBS_FRONTEND_EVENT_STREAMING_STOPPED, data);
+		}
+	});
+}
+
+void obs_frontend_add_event_callback(obs_frontend_event_cb callback, void *private_data)
+{
+	StubState &s = state();
+	std::scoped_lock lock(s.mutex);
+	s.callbacks.emplace_back(callback, private_data);
+}
+
+void obs_frontend_remove_event_callback(obs_frontend_event_cb callback, void *private_data)
+{
+	StubState &s = state();
+	std::scoped_lock lock(s.mutex);
+	std::erase(s.callbacks, std::pair{callback, private_data});
+}
+
+void obs_frontend_set_streaming_service(obs_service_t *service)
+{
+	StubState &s = state();
+	std::scoped_lock lock(s.mutex);
+	if (service) {
+		++service->refs;
+	}
+	releaseService(s.frontendService);
+	s.frontendService = service;
+}
+
+obs_output_t *obs_frontend_get_streaming_output(void)
+{
+	StubState &s = state();
+	std::scoped_lock lock(s.mutex);
+	++s.frontendOutput.refs;
+	return &s.frontendOutput;
+}
+
+char *obs_frontend_get_current_profile_path(void)
+{
+	StubState &s = state();
+	std::scoped_lock lock(s.mutex);
+	return bstrdup(s.options.profilePath.string().c_str());
+}
+
+obs_service_t *obs_service_create(const char *, const char *, obs_data_t *settings, obs_data_t *)
+{
+	const char *streamKey = obs_data_get_string(settings, "key");
+	return new obs_service{streamKey ? streamKey : ""};
+}
+
+void obs_service_release(obs_service_t *service)
+{
+	StubState &s = state();
+	std::scoped_lock lock(s.mutex);
+	releaseService(service);
+}
+
+const char *obs_service_get_preferred_output_type(const obs_service_t *)
+{
+	return "rtmp_output";
+}
+
+obs_output_t *obs_output_create(const char *, const char *, obs_data_t *, obs_data_t *)
+{
+	return new obs_output;
+}
+
+void obs_output_release(obs_output_t *output)
+{
+	StubState &s = state();
+	std::scoped_lock lock(s.mutex);
+	if (output && --output->refs == 0 && output != &s.frontendOutput) {
+		delete output;
+	}
+}
+
+bool obs_output_start(obs_output_t *output)
+{
+	StubState &s = state();
+	std::scoped_lock lock(s.mutex);
+	startIngest(s, output);
+	return true;
+}
+
+void obs_output_stop(obs_output_t *output)
+{
+	StubState &s = state();
+	std::scoped_lock lock(s.mutex);
+	stopIngest(s, output);
+}
+
+bool obs_output_active(const obs_output_t *output)
+{
+	StubState &s = state();
+	std::scoped_lock lock(s.mutex);
+	return output->active;
+}
+
+void obs_output_set_service(obs_output_t *output, obs_service_t *service)
+{
+	StubState &s = state();
+	std::scoped_lock lock(s.mutex);
+	output->service = service;
+}
+
+obs_encoder_t *obs_output_get_video_encoder(const obs_output_t *)
+{
+	return &state().encoder;
+}
+
+obs_encoder_t *obs_output_get_audio_encoder(const obs_output_t *, size_t)
+{
+	return &state().encoder;
+}
+
+void obs_output_set_video_encoder(obs_output_t *, obs_encoder_t *) {}
+
+void obs_output_set_audio_encoder(obs_output_t *, obs_encoder_t *, size_t) {}
+
+const char *obs_output_get_last_error(obs_output_t *)
+{
+	return nullptr;
+}
+
+} // extern "C"
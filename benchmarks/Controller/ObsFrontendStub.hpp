@@ -0,0 +1,54 @@
+/*
+ * Live Stream Segmenter - Controller Module Benchmarks
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <string>
+
+namespace KaitoTokyo::Benchmarks {
+
+/**
+ * Stands in for the OBS frontend and the outputs the controller drives, so sessions can run headless.
+ *
+ * The stub defines the obs_frontend_* and obs_output_* / obs_service_* functions the controller calls,
+ * which take precedence over the ones in the OBS libraries when linked into the executable. Outputs
+ * never touch encoders; a started output only records when its stream key began ingesting.
+ */
+struct ObsFrontendStubOptions {
+	// How long an ingest takes to show up as active on the YouTube side after its output started.
+	std::chrono::milliseconds ingestDelay{0};
+	// How long the frontend takes to report OBS_FRONTEND_EVENT_STREAMING_STOPPED.
+	std::chrono::milliseconds stopDelay{0};
+	// Returned from obs_frontend_get_current_profile_path().
+	std::filesystem::path profilePath;
+};
+
+/**
+ * Must be called on the Qt main thread before the first OBS call, with a QApplication alive.
+ */
+void configureObsFrontendStub(ObsFrontendStubOptions options);
+
+/**
+ * True when an output carrying streamKey has been running for at least the configured ingest delay.
+ * Thread-safe.
+ */
+bool isObsFrontendStubIngesting(const std::string &streamKey);
+
+} // namespace KaitoTokyo::Benchmarks
@@ -0,0 +1,107 @@
+/*
+ * KaitoTokyo FrameConversion Library Benchmarks
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <KaitoTokyo/FrameConversion/FrameScaler.hpp>
+
+#include "../BenchmarkRunner.hpp"
+
+using namespace KaitoTokyo;
+using FrameConversion::CpuFeatureLevel;
+
+namespace {
+
+struct Frame {
+	std::vector<std::uint8_t> pixels;
+	FrameConversion::FrameView view;
+};
+
+// A gradient rather than a solid color, so no kernel can take a shortcut on uniform rows.
+Frame makeFrame(std::uint32_t width, std::uint32_t height)
+{
+	Frame frame;
+	const std::size_t linesize = 4 * static_cast<std::size_t>(width);
+	frame.pixels.resize(linesize * height);
+	for (std::uint32_t y = 0; y < height; ++y) {
+		for (std::uint32_t x = 0; x < width; ++x) {
+			std::uint8_t *pixel = frame.pixels.data() + y * linesize + 4 * static_cast<std::size_t>(x);
+			pixel[0] = static_cast<std::uint8_t>(x);
+			pixel[1] = static_cast<std::uint8_t>(y);
+			pixel[2] = static_cast<std::uint8_t>(x + y);
+			pixel[3] = 255;
+		}
+	}
+	frame.view = FrameConversion::FrameView{frame.pixels.data(), width, height, linesize,
+						FrameConversion::PixelOrder::BGRA};
+	return frame;
+}
+
+} // anonymous namespace
+
+// Usage: FrameScaler_benchmark [--filter=SUBSTRING] [--json=PATH]
+int main(int argc, char **argv)
+{
+	std::optional<Benchmarks::BenchmarkOptions> options = Benchmarks::parseBenchmarkOptions(argc, argv);
+	if (!options) {
+		return 2;
+	}
+	Benchmarks::BenchmarkRunner runner("FrameScaler_benchmark", std::move(*options));
+
+	constexpr std::uint32_t kTargetWidth = 1280;
+	constexpr std::uint32_t kTargetHeight = 720;
+	constexpr std::size_t kRgbLinesize = 3 * static_cast<std::size_t>(kTargetWidth);
+	std::vector<std::uint8_t> rgb(kRgbLinesize * kTargetHeight);
+	std::vector<std::uint8_t> y(static_cast<std::size_t>(kTargetWidth) * kTargetHeight);
+	std::vector<std::uint8_t> u(y.size() / 4);
+	std::vector<std::uint8_t> v(y.size() / 4);
+	const FrameConversion::I420View i420{y.data(), kTargetWidth, u.data(), kTargetWidth / 2,
+					     v.data(), kTargetWidth / 2};
+
+	const Frame uhd = makeFrame(3840, 2160);
+	const Frame fhd = makeFrame(1920, 1080);
+
+	for (const CpuFeatureLevel level :
+	     {CpuFeatureLevel::Scalar, CpuFeatureLevel::SSE41, CpuFeatureLevel::AVX2, CpuFeatureLevel::NEON}) {
+		FrameConversion::FrameScaler scaler(level);
+		if (scaler.getCpuFeatureLevel() != level) {
+			continue;
+		}
+
+		const std::string suffix = "/" + std::string(FrameConversion::cpuFeatureLevelName(level));
+		// 2160p takes one halving and a 1.5x bilinear pass; 1080p only the bilinear pass.
+		for (const auto &[label, frame] : {std::pair{"2160p", &uhd}, std::pair{"1080p", &fhd}}) {
+			runner.run(std::string("ScaleToRgb/") + label + suffix, 50, [&]() {
+				scaler.scaleToRgb(frame->view, rgb.data(), kTargetWidth, kTargetHeight, kRgbLinesize);
+			});
+		}
+		runner.run("ScaleToI420/2160p" + suffix, 50,
+			   [&]() { scaler.scaleToI420(uhd.view, i420, kTargetWidth, kTargetHeight); });
+	}
+
+	return runner.finish();
+}
@@ -0,0 +1,113 @@
+/*
+ * Live Stream Segmenter - Scripting Module Benchmarks
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include <KaitoTokyo/Logger/NullLogger.hpp>
+
+#include <EventScriptingContext.hpp>
+
+extern "C" const std::uint32_t qjsc_dayjs_bundle_size;
+extern "C" const std::uint8_t qjsc_dayjs_bundle[];
+extern "C" const std::uint32_t qjsc_ini_bundle_size;
+extern "C" const std::uint8_t qjsc_ini_bundle[];
+extern "C" const std::uint32_t qjsc_youtube_bundle_size;
+extern "C" const std::uint8_t qjsc_youtube_bundle[];
+
+using namespace KaitoTokyo;
+using namespace KaitoTokyo::LiveStreamSegmenter;
+
+namespace {
+
+constexpr int kRounds = 200;
+
+constexpr const char *kPlainHandler = R"(export default "ready";)";
+
+constexpr const char *kDayjsHandler = R"(
+	import { dayjs } from "builtin:dayjs";
+	export default dayjs("2025-01-01").format("YYYY-MM-DD");
+)";
+
+// What setupContext did before: read and evaluate every bundle in each new context.
+void evaluateBundle(JSContext *ctx, std::uint32_t size, const std::uint8_t *buf)
+{
+	Scripting::ScopedJSValue moduleObj(ctx, JS_ReadObject(ctx, buf, size, JS_READ_OBJ_BYTECODE));
+	Scripting::ScopedJSValue res(ctx, JS_EvalFunction(ctx, JS_DupValue(ctx, moduleObj.get())));
+	if (std::optional<std::string> exception = res.asExceptionString()) {
+		std::fprintf(stderr, "Bundle evaluation failed: %s\n", exception->c_str());
+	}
+}
+
+template<typename F> double measureMicroseconds(F buildContext)
+{
+	const auto start = std::chrono::steady_clock::now();
+	for (int round = 0; round < kRounds; ++round) {
+		buildContext();
+	}
+	const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+	return elapsed.count() / kRounds;
+}
+
+} // anonymous namespace
+
+int main()
+{
+	const auto logger = std::make_shared<Logger::NullLogger>();
+	const auto runtime = std::make_shared<Scripting::ScriptingRuntime>();
+	runtime->setLogger(logger);
+
+	auto buildContext = [&](bool eagerBundles, const char *handler) {
+		std::shared_ptr<JSContext> ctx = runtime->createContextRaw();
+		Scripting::EventScriptingContext context(runtime, ctx, logger);
+		context.setupContext();
+		if (eagerBundles) {
+			evaluateBundle(ctx.get(), qjsc_dayjs_bundle_size, qjsc_dayjs_bundle);
+			evaluateBundle(ctx.get(), qjsc_ini_bundle_size, qjsc_ini_bundle);
+			evaluateBundle(ctx.get(), qjsc_youtube_bundle_size, qjsc_youtube_bundle);
+		}
+		context.loadEventHandler(handler);
+		if (!context.getModuleProperty("default").asString()) {
+			std::fprintf(stderr, "Event handler did not load\n");
+		}
+	};
+
+	// Warm up the allocator and the runtime's atom table before measuring.
+	buildContext(true, kDayjsHandler);
+	buildContext(false, kDayjsHandler);
+
+	const double eagerPlain = measureMicroseconds([&]() { buildContext(true, kPlainHandler); });
+	const double lazyPlain = measureMicroseconds([&]() { buildContext(false, kPlainHandler); });
+	const double eagerDayjs = measureMicroseconds([&]() { buildContext(true, kDayjsHandler); });
+	const double lazyDayjs = measureMicroseconds([&]() { buildContext(false, kDayjsHandler); });
+
+	std::printf("Handler without imports:  eager bundles %9.1f us, module loader %9.1f us per context\n",
+		    eagerPlain, lazyPlain);
+	std::printf("Handler importing dayjs:  eager bundles %9.1f us, module loader %9.1f us per context\n",
+		    eagerDayjs, lazyDayjs);
+	return 0;
+}
@@ -0,0 +1,162 @@
+/*
+ * Live Stream Segmenter - Scripting Module Benchmarks
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include <nlohmann/json.hpp>
+
+#include <KaitoTokyo/Logger/NullLogger.hpp>
+
+#include <EventScriptingContext.hpp>
+#include <ScriptingDatabase.hpp>
+
+#include "../BenchmarkRunner.hpp"
+
+using namespace KaitoTokyo;
+using namespace KaitoTokyo::LiveStreamSegmenter;
+
+namespace {
+
+constexpr const char *kSmallHandler = R"(export function onEvent(event) { return event; })";
+
+constexpr const char *kBenchmarkHandler = R"(
+	export function setup() {
+		db.execute("CREATE TABLE IF NOT EXISTS bench (name TEXT, value INTEGER);");
+	}
+
+	export function sync(event) {
+		return { value: event.value + 1 };
+	}
+
+	export async function promise(event) {
+		await null;
+		return { value: event.value + 1 };
+	}
+
+	export function execute(event) {
+		return db.transaction(() => {
+			db.execute("DELETE FROM bench;");
+			for (let i = 0; i < event.rows; i++) {
+				db.execute("INSERT INTO bench (name, value) VALUES (?, ?);", "row" + i, i);
+			}
+			return event.rows;
+		});
+	}
+
+	export function query(event) {
+		return db.query("SELECT name, value FROM bench LIMIT ?;", event.rows).length;
+	}
+
+	export function localStorageRoundTrip(event) {
+		localStorage.setItem("benchmark", String(event.value));
+		return localStorage.getItem("benchmark");
+	}
+)";
+
+// Many small exported functions, roughly the size of a large user event handler.
+std::string makeLargeHandler(int functionCount)
+{
+	std::string script;
+	for (int i = 0; i < functionCount; ++i) {
+		const std::string n = std::to_string(i);
+		script += "export function handler" + n + "(event) {\n"
+			  "\tconst title = `Broadcast ${event.index ?? " + n + "}`;\n"
+			  "\treturn { title, tags: [\"a\", \"b\", title.toLowerCase()], index: " + n + " };\n"
+			  "}\n";
+	}
+	return script;
+}
+
+} // anonymous namespace
+
+// Usage: ScriptingEngine_benchmark [--filter=SUBSTRING] [--json=PATH]
+int main(int argc, char **argv)
+{
+	std::optional<Benchmarks::BenchmarkOptions> options = Benchmarks::parseBenchmarkOptions(argc, argv);
+	if (!options) {
+		return 2;
+	}
+
+	const auto logger = std::make_shared<Logger::NullLogger>();
+	const auto runtime = std::make_shared<Scripting::ScriptingRuntime>();
+	runtime->setLogger(logger);
+
+	const std::filesystem::path databasePath =
+		std::filesystem::temp_directory_path() / "live-stream-segmenter-ScriptingEngine_benchmark.sqlite3";
+	std::filesystem::remove(databasePath);
+
+	Benchmarks::BenchmarkRunner runner("ScriptingEngine_benchmark", std::move(*options));
+
+	runner.run("ContextCreate", 200, [&]() {
+		std::shared_ptr<JSContext> ctx = runtime->createContextRaw();
+		Scripting::EventScriptingContext context(runtime, ctx, logger);
+		context.setupContext();
+	});
+
+	// Includes the context creation measured above.
+	const auto loadEventHandler = [&](const char *handler) {
+		std::shared_ptr<JSContext> ctx = runtime->createContextRaw();
+		Scripting::EventScriptingContext context(runtime, ctx, logger);
+		context.setupContext();
+		context.loadEventHandler(handler);
+	};
+	const std::string largeHandler = makeLargeHandler(2000);
+	runner.run("LoadEventHandler/Small", 200, [&]() { loadEventHandler(kSmallHandler); });
+	runner.run("LoadEventHandler/Large", 20, [&]() { loadEventHandler(largeHandler.c_str()); });
+
+	{
+		std::shared_ptr<JSContext> ctx = runtime->createContextRaw();
+		Scripting::EventScriptingContext context(runtime, ctx, logger);
+		Scripting::ScriptingDatabase database(runtime, ctx, logger, databasePath, true);
+		context.setupContext();
+		database.setupContext();
+		context.setupLocalStorage(database);
+		context.loadEventHandler(kBenchmarkHandler);
+
+		const nlohmann::json valueEvent{{"value", 1}};
+		runner.run("ExecuteFunction/Sync", 10000, [&]() { context.executeFunction("sync", valueEvent); });
+		runner.run("ExecuteFunction/Promise", 10000, [&]() { context.executeFunction("promise", valueEvent); });
+
+		context.executeFunction("setup", nlohmann::json::object());
+		for (const int rows : {1, 100, 1000}) {
+			const nlohmann::json rowsEvent{{"rows", rows}};
+			const std::int64_t iterations = 100000 / (rows + 100);
+			runner.run("DbExecute/" + std::to_string(rows), iterations,
+				   [&]() { context.executeFunction("execute", rowsEvent); });
+			runner.run("DbQuery/" + std::to_string(rows), iterations,
+				   [&]() { context.executeFunction("query", rowsEvent); });
+		}
+
+		runner.run("LocalStorage/SetGet", 10000,
+			   [&]() { context.executeFunction("localStorageRoundTrip", valueEvent); });
+	}
+
+	std::filesystem::remove(databasePath);
+
+	return runner.finish();
+}
@@ -0,0 +1,227 @@
+/*
+ * KaitoTokyo YouTubeApi Library Benchmarks
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include <KaitoTokyo/YouTubeApi/YouTubeListPageDecoder.hpp>
+#include <KaitoTokyo/YouTubeApi/YouTubeTypes.hpp>
+
+using namespace KaitoTokyo;
+
+namespace {
+
+constexpr std::size_t kPageCount = 20;
+constexpr std::size_t kItemsPerPage = 50;
+constexpr int kRounds = 20;
+
+// Shaped like a liveBroadcasts.list page of archived broadcasts with the default parts.
+std::string makePage(std::size_t pageIndex)
+{
+	nlohmann::json items = nlohmann::json::array();
+	for (std::size_t i = 0; i < kItemsPerPage; ++i) {
+		const std::string id = "broadcast-" + std::to_string(pageIndex * kItemsPerPage + i);
+		nlohmann::json thumbnails;
+		for (const char *size : {"default", "medium", "high", "standard", "maxres"}) {
+			thumbnails[size] = {{"url", "https://i.ytimg.com/vi/" + id + "/" + size + ".jpg"},
+					    {"width", 1280},
+					    {"height", 720}};
+		}
+		items.push_back({
+			{"kind", "youtube#liveBroadcast"},
+			{"etag", "etag-" + id},
+			{"id", id},
+			{"snippet",
+			 {{"publishedAt", "2025-01-01T00:00:00Z"},
+			  {"channelId", "UCxxxxxxxxxxxxxxxxxxxxxx"},
+			  {"title", "Archived segment " + id},
+			  {"description", std::string(400, 'd')},
+			  {"thumbnails", thumbnails},
+			  {"scheduledStartTime", "2025-01-01T00:00:00Z"},
+			  {"actualStartTime", "2025-01-01T00:00:05Z"},
+			  {"actualEndTime", "2025-01-01T01:00:05Z"},
+			  {"isDefaultBroadcast", false},
+			  {"liveChatId", "chat-" + id}}},
+			{"status",
+			 {{"lifeCycleStatus", "complete"},
+			  {"privacyStatus", "unlisted"},
+			  {"recordingStatus", "recorded"},
+			  {"madeForKids", false},
+			  {"selfDeclaredMadeForKids", false}}},
+			{"contentDetails",
+			 {{"boundStreamId", "stream-1"},
+			  {"boundStreamLastUpdateTimeMs", "2025-01-01T00:00:00Z"},
+			  {"monitorStream",
+			   {{"enableMonitorStream", true},
+			    {"broadcastStreamDelayMs", 0},
+			    {"embedHtml", std::string(200, 'e')}}},
+			  {"enableEmbed", true},
+			  {"enableDvr", true},
+			  {"recordFromStart", true},
+			  {"enableClosedCaptions", false},
+			  {"closedCaptionsType", "closedCaptionsDisabled"},
+			  {"projection", "rectangular"},
+			  {"enableLowLatency", false},
+			  {"latencyPreference", "normal"},
+			  {"enableAutoStart", false},
+			  {"enableAutoStop", false}}},
+		});
+	}
+
+	nlohmann::json page = {
+		{"kind", "youtube#liveBroadcastListResponse"},
+		{"etag", "page-etag-" + std::to_string(pageIndex)},
+		{"pageInfo", {{"totalResults", kPageCount * kItemsPerPage}, {"resultsPerPage", kItemsPerPage}}},
+		{"items", items},
+	};
+	if (pageIndex + 1 < kPageCount) {
+		page["nextPageToken"] = "page-" + std::to_string(pageIndex + 1);
+	}
+	return page.dump();
+}
+
+// The decoding performList did before: a DOM per page, a vector of JSON items, then from_json.
+std::vector<YouTubeApi::YouTubeLiveBroadcast> decodeWithDom(const std::vector<std::string> &pages)
+{
+	std::vector<nlohmann::json> items;
+	for (const std::string &body : pages) {
+		nlohmann::json j = nlohmann::json::parse(body);
+		nlohmann::json jItems = std::move(j["items"]);
+		for (auto &x : jItems) {
+			items.push_back(std::move(x));
+		}
+	}
+
+	std::vector<YouTubeApi::YouTubeLiveBroadcast> broadcasts;
+	for (const nlohmann::json &item : items) {
+		broadcasts.push_back(item.get<YouTubeApi::YouTubeLiveBroadcast>());
+	}
+	return broadcasts;
+}
+
+// The single-pass decoding before the field tables: one JSON value per item, then from_json.
+std::vector<YouTubeApi::YouTubeLiveBroadcast> decodeWithSaxItemDom(const std::vector<std::string> &pages)
+{
+	std::vector<YouTubeApi::YouTubeLiveBroadcast> broadcasts;
+	std::vector<nlohmann::json> items;
+	for (const std::string &body : pages) {
+		items.clear();
+		YouTubeApi::decodeYouTubeListPage(std::string_view(body), items);
+		for (const nlohmann::json &item : items) {
+			broadcasts.push_back(item.get<YouTubeApi::YouTubeLiveBroadcast>());
+		}
+	}
+	return broadcasts;
+}
+
+// YouTubeLiveBroadcast has a field table, so its items are decoded straight from the parser.
+std::vector<YouTubeApi::YouTubeLiveBroadcast> decodeWithSax(const std::vector<std::string> &pages)
+{
+	std::vector<YouTubeApi::YouTubeLiveBroadcast> broadcasts;
+	for (const std::string &body : pages) {
+		YouTubeApi::decodeYouTubeListPage(std::string_view(body), broadcasts);
+	}
+	return broadcasts;
+}
+
+// The liveBroadcasts.list pages of a tape recorded with CurlTransferTape, so the decoders can be compared
+// on production-shaped responses.
+std::vector<std::string> readRecordedPages(const char *path)
+{
+	std::vector<std::string> pages;
+	std::ifstream ifs(path, std::ios::binary);
+	std::string line;
+	while (std::getline(ifs, line)) {
+		const nlohmann::json record = nlohmann::json::parse(line, nullptr, false);
+		if (record.is_object() && record.value("method", "") == "GET" &&
+		    record.value("responseCode", 0) == 200 &&
+		    record.value("url", "").find("/liveBroadcasts?") != std::string::npos) {
+			pages.push_back(record.value("responseBody", ""));
+		}
+	}
+	return pages;
+}
+
+template<typename F> double measureMilliseconds(const std::vector<std::string> &pages, F decode)
+{
+	const std::size_t expectedItemCount = kRounds * decodeWithSax(pages).size();
+
+	std::size_t itemCount = 0;
+	const auto start = std::chrono::steady_clock::now();
+	for (int round = 0; round < kRounds; ++round) {
+		itemCount += decode(pages).size();
+	}
+	const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+	if (itemCount != expectedItemCount) {
+		std::fprintf(stderr, "Unexpected item count: %zu\n", itemCount);
+	}
+	return elapsed.count() / kRounds;
+}
+
+} // anonymous namespace
+
+// Usage: YouTubeListPageDecoder_benchmark [TAPE]. Without a tape, synthetic pages are decoded.
+int main(int argc, char **argv)
+{
+	std::vector<std::string> pages;
+	if (argc > 1) {
+		pages = readRecordedPages(argv[1]);
+		if (pages.empty()) {
+			std::fprintf(stderr, "No liveBroadcasts.list responses in %s\n", argv[1]);
+			return 1;
+		}
+	} else {
+		for (std::size_t i = 0; i < kPageCount; ++i) {
+			pages.push_back(makePage(i));
+		}
+	}
+
+	std::size_t totalBytes = 0;
+	for (const std::string &page : pages) {
+		totalBytes += page.size();
+	}
+	std::printf("%zu pages, %zu broadcasts, %zu KiB\n", pages.size(), decodeWithSax(pages).size(),
+		    totalBytes / 1024);
+
+	// Warm up allocators and caches before measuring any path.
+	decodeWithDom(pages);
+	decodeWithSaxItemDom(pages);
+	decodeWithSax(pages);
+
+	const double domMilliseconds = measureMilliseconds(pages, decodeWithDom);
+	const double saxItemDomMilliseconds = measureMilliseconds(pages, decodeWithSaxItemDom);
+	const double saxMilliseconds = measureMilliseconds(pages, decodeWithSax);
+
+	std::printf("DOM then from_json:    %8.3f ms per listing\n", domMilliseconds);
+	std::printf("SAX, JSON per item:    %8.3f ms per listing\n", saxItemDomMilliseconds);
+	std::printf("SAX into field tables: %8.3f ms per listing\n", saxMilliseconds);
+	return 0;
+}
@@ -0,0 +1,222 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * KaitoTokyo Async Library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+/**
+ * =============================================================================
+ * KAITOTOKYO ASYNC LIBRARY - COOPERATIVE CANCELLATION
+ * =============================================================================
+ *
+ * @brief Lets the owner of an operation ask the tasks doing it to stop early.
+ *
+ * A `CancellationSource` requests cancellation; the `CancellationToken`s it
+ * hands out are passed down to tasks, which poll the token at convenient
+ * points or register a `CancellationCallback` to wake a pending wait.
+ * Nothing is cancelled preemptively: a task stops only where it checks.
+ *
+ * This mirrors `std::stop_source`/`std::stop_token`, which are not yet
+ * available on every standard library this project targets.
+ *
+ * @section EXAMPLE Usage
+ *
+ * @code
+ * Task<void> example(CancellationToken token) {
+ *         for (;;) {
+ *                 token.throwIfCancellationRequested();
+ *                 co_await doStep();
+ *         }
+ * }
+ * @endcode
+ * =============================================================================
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+namespace KaitoTokyo::Async {
+
+/**
+ * @brief Thrown by tasks that stop because their cancellation token was triggered.
+ */
+class OperationCancelledError : public std::runtime_error {
+public:
+	OperationCancelledError() : std::runtime_error("OperationCancelledError") {}
+};
+
+namespace CancellationDetail {
+
+struct CancellationState {
+	std::atomic<bool> cancelled = false;
+
+	std::mutex mutex;
+	std::uint64_t nextCallbackId = 0;
+	std::map<std::uint64_t, std::function<void()>> callbacks;
+};
+
+} // namespace CancellationDetail
+
+/**
+ * @brief Read-only view of a `CancellationSource`.
+ *
+ * Cheap to copy. A default-constructed token can never be cancelled.
+ */
+class CancellationToken {
+public:
+	CancellationToken() noexcept = default;
+
+	[[nodiscard]] bool canBeCancelled() const noexcept { return state_ != nullptr; }
+
+	[[nodiscard]] bool isCancellationRequested() const noexcept
+	{
+		return state_ && state_->cancelled.load(std::memory_order_acquire);
+	}
+
+	/**
+	 * @throws OperationCancelledError if cancellation has been requested.
+	 */
+	void throwIfCancellationRequested() const
+	{
+		if (isCancellationRequested()) {
+			throw OperationCancelledError();
+		}
+	}
+
+	// Tokens are equal when they observe the same source.
+	bool operator==(const CancellationToken &) const noexcept = default;
+
+private:
+	friend class CancellationSource;
+	friend class CancellationCallback;
+
+	explicit CancellationToken(std::shared_ptr<CancellationDetail::CancellationState> state) noexcept
+		: state_(std::move(state))
+	{
+	}
+
+	std::shared_ptr<CancellationDetail::CancellationState> state_;
+};
+
+/**
+ * @brief Owns the right to request cancellation.
+ *
+ * Copies share the same state, so any copy can cancel.
+ */
+class CancellationSource {
+public:
+	CancellationSource() : state_(std::make_shared<CancellationDetail::CancellationState>()) {}
+
+	[[nodiscard]] CancellationToken token() const noexcept { return CancellationToken(state_); }
+
+	[[nodiscard]] bool isCancellationRequested() const noexcept
+	{
+		return state_->cancelled.load(std::memory_order_acquire);
+	}
+
+	/**
+	 * @brief Requests cancellation and runs the registered callbacks on the calling thread.
+	 *
+	 * Callbacks run with the internal lock held, so they must be short and must not
+	 * register or destroy a `CancellationCallback` of the same source.
+	 *
+	 * @return `true` if this call requested cancellation, `false` if it was already requested.
+	 */
+	bool cancel() noexcept
+	{
+		std::scoped_lock lock(state_->mutex);
+
+		if (state_->cancelled.exchange(true, std::memory_order_acq_rel)) {
+			return false;
+		}
+
+		for (auto &[id, callback] : state_->callbacks) {
+			try {
+				callback();
+			} catch (...) {
+				// A throwing callback must not keep the others from running.
+			}
+		}
+		state_->callbacks.clear();
+
+		return true;
+	}
+
+private:
+	std::shared_ptr<CancellationDetail::CancellationState> state_;
+};
+
+/**
+ * @brief Runs a callback once when the token is cancelled, for as long as this object lives.
+ *
+ * If the token is already cancelled, the callback runs immediately in the constructor.
+ * Destroying the object unregisters the callback; if `cancel()` is running the callback
+ * concurrently, the destructor waits for it to finish.
+ */
+class CancellationCallback {
+public:
+	CancellationCallback(const CancellationToken &token, std::function<void()> callback) : state_(token.state_)
+	{
+		if (!state_) {
+			return;
+		}
+
+		std::unique_lock lock(state_->mutex);
+		if (state_->cancelled.load(std::memory_order_acquire)) {
+			lock.unlock();
+			callback();
+			return;
+		}
+
+		id_ = state_->nextCallbackId++;
+		state_->callbacks.emplace(id_, std::move(callback));
+	}
+
+	~CancellationCallback() noexcept
+	{
+		if (!state_) {
+			return;
+		}
+
+		std::scoped_lock lock(state_->mutex);
+		state_->callbacks.erase(id_);
+	}
+
+	CancellationCallback(const CancellationCallback &) = delete;
+	CancellationCallback &operator=(const CancellationCallback &) = delete;
+	CancellationCallback(CancellationCallback &&) = delete;
+	CancellationCallback &operator=(CancellationCallback &&) = delete;
+
+private:
+	const std::shared_ptr<CancellationDetail::CancellationState> state_;
+	std::uint64_t id_ = 0;
+};
+
+} // namespace KaitoTokyo::Async
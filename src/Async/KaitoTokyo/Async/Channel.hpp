@@ -25,11 +25,16 @@
 
 #pragma once
 
+#include <algorithm>
+#include <concepts>
 #include <coroutine>
+#include <cstddef>
+#include <cstdint>
 #include <deque>
 #include <mutex>
 #include <optional>
 #include <utility>
+#include <vector>
 
 namespace KaitoTokyo::Async {
 
@@ -44,6 +49,32 @@ namespace KaitoTokyo::Async {
 template<typename T>
 concept ChannelMessage = std::movable<T> && std::is_nothrow_move_constructible_v<T>;
 
+/**
+ * @brief Per-message delivery options for `Channel::send()`.
+ */
+struct ChannelSendOptions {
+	/**
+	 * Messages with a higher priority are received before queued messages with a lower one.
+	 * Messages of equal priority keep their FIFO order.
+	 */
+	int priority = 0;
+
+	/**
+	 * If an equal message is already queued, the new one is dropped instead of queued.
+	 * The queued message keeps its position.
+	 */
+	bool coalesce = false;
+};
+
+/**
+ * @brief Outcome of `Channel::trySend()`.
+ */
+enum class ChannelTrySendResult {
+	Sent,
+	Full,
+	Closed,
+};
+
 /**
  * @brief A high-performance, thread-safe asynchronous MPSC Channel.
  *
@@ -60,6 +91,12 @@ concept ChannelMessage = std::movable<T> && std::is_nothrow_move_constructible_v
  * - **Graceful Shutdown**: Supports a `close()` operation that allows the consumer
  * to drain remaining items before terminating.
  * - **Exception Safety**: Enforces `noexcept` move semantics via `ChannelMessage`.
+ * - **Priority and Coalescing**: `send()` optionally takes `ChannelSendOptions` to
+ * jump ahead of lower-priority messages or to collapse duplicates of a pending message.
+ * - **Backpressure**: a channel constructed with a capacity makes `sendAsync()` suspend
+ * and `trySend()` fail while that many items are queued. `send()` still never blocks, so
+ * control messages such as a shutdown request always get through.
+ * - **Batching**: `receiveMany()` drains several items per wake-up.
  *
  * @tparam T The type of message to transport. Must satisfy `ChannelMessage`.
  */
@@ -67,11 +104,20 @@ template<ChannelMessage T> class Channel {
 public:
 	Channel() = default;
 
+	/**
+	 * @brief Creates a bounded channel.
+	 *
+	 * @param capacity Number of queued items at which `sendAsync()` suspends and `trySend()` fails.
+	 * 0 means unbounded.
+	 */
+	explicit Channel(std::size_t capacity) : capacity_(capacity) {}
+
 	~Channel() noexcept
 	{
 		std::unique_lock lock(mutex_, std::defer_lock);
 
 		std::coroutine_handle<> h = nullptr;
+		std::deque<BlockedSend> blockedSenders;
 
 		try {
 			lock.lock();
@@ -83,6 +129,7 @@ public:
 					receiver_ = nullptr;
 				}
 			}
+			blockedSenders.swap(blockedSenders_);
 		} catch (...) {
 			return;
 		}
@@ -90,6 +137,9 @@ public:
 		if (h) {
 			h.destroy();
 		}
+		for (const BlockedSend &blocked : blockedSenders) {
+			blocked.handle.destroy();
+		}
 	}
 
 	// Non-copyable and Non-movable to ensure unique ownership and stable address for the mutex.
@@ -105,12 +155,14 @@ public:
 	 * remain accessible to the receiver.
 	 *
 	 * - If a receiver is waiting (suspended), it is resumed immediately.
+	 * - Senders suspended in `sendAsync()` are resumed with `false`; their items are not queued.
 	 * - Subsequent calls to `receive()` will continue to yield items until the queue is empty.
 	 * - Once empty, `receive()` will return `std::nullopt`.
 	 */
 	void close()
 	{
 		std::coroutine_handle<> h = nullptr;
+		std::deque<BlockedSend> blockedSenders;
 		{
 			std::scoped_lock lock(mutex_);
 
@@ -124,11 +176,15 @@ public:
 				h = receiver_;
 				receiver_ = nullptr;
 			}
+			blockedSenders.swap(blockedSenders_);
 		}
 
 		if (h) {
 			h.resume();
 		}
+		for (const BlockedSend &blocked : blockedSenders) {
+			blocked.handle.resume();
+		}
 	}
 
 	/**
@@ -148,7 +204,7 @@ public:
 			if (closed_)
 				return false; // Cannot send to a closed channel.
 
-			queue_.push_back(std::move(value));
+			enqueue(std::move(value), 0);
 
 			// If there is a waiting receiver, wake it up.
 			if (receiver_) {
@@ -165,6 +221,162 @@ public:
 		return true;
 	}
 
+	/**
+	 * @brief Sends a value to the channel with priority and coalescing options.
+	 *
+	 * This method is thread-safe and can be called concurrently by multiple producers.
+	 *
+	 * @param value The item to send. It will be moved into the internal queue.
+	 * @param options See `ChannelSendOptions`.
+	 * @return `true` if the item was queued or coalesced into an equal pending item.
+	 * @return `false` if the channel is already closed.
+	 */
+	bool send(T value, ChannelSendOptions options)
+		requires std::equality_comparable<T>
+	{
+		std::coroutine_handle<> h = nullptr;
+		{
+			std::scoped_lock lock(mutex_);
+			if (closed_)
+				return false; // Cannot send to a closed channel.
+
+			if (options.coalesce && std::ranges::any_of(queue_, [&value](const Entry &entry) {
+				    return entry.value == value;
+			    })) {
+				++coalescedCount_;
+				return true; // The pending item already covers this one, so nobody needs waking.
+			}
+
+			enqueue(std::move(value), options.priority);
+
+			if (receiver_) {
+				h = receiver_;
+				receiver_ = nullptr;
+			}
+		}
+
+		if (h) {
+			h.resume();
+		}
+
+		return true;
+	}
+
+	/**
+	 * @brief Sends a value only if the channel has room for it.
+	 *
+	 * This method is thread-safe and never blocks.
+	 *
+	 * @param value The item to send. It is moved from only when the result is `Sent`.
+	 * @return `Sent`, `Full` if the channel is at capacity, or `Closed`.
+	 */
+	ChannelTrySendResult trySend(T &&value)
+	{
+		std::coroutine_handle<> h = nullptr;
+		{
+			std::scoped_lock lock(mutex_);
+			if (closed_)
+				return ChannelTrySendResult::Closed;
+			// Blocked senders were first in line for the free slots.
+			if (!hasRoom() || !blockedSenders_.empty())
+				return ChannelTrySendResult::Full;
+
+			enqueue(std::move(value), 0);
+
+			if (receiver_) {
+				h = receiver_;
+				receiver_ = nullptr;
+			}
+		}
+
+		if (h) {
+			h.resume();
+		}
+
+		return ChannelTrySendResult::Sent;
+	}
+
+	/**
+	 * @brief Sends a value, waiting for room if the channel is at capacity.
+	 *
+	 * This method is thread-safe. Suspended senders are admitted in FIFO order as the receiver
+	 * takes items, and are resumed inline on the receiver's thread.
+	 *
+	 * @param value The item to send.
+	 * @return An awaitable object that yields `true` once the item is queued, or `false` if the
+	 * channel is or becomes closed first.
+	 */
+	[[nodiscard("You must co_await the send.")]]
+	auto sendAsync(T value)
+	{
+		struct SendAwaiter {
+			Channel &ch;
+			T value;
+			bool sent = false;
+
+			bool await_ready() const noexcept { return false; }
+
+			bool await_suspend(std::coroutine_handle<> h)
+			{
+				std::coroutine_handle<> receiver = nullptr;
+				{
+					std::scoped_lock lock(ch.mutex_);
+
+					if (ch.closed_) {
+						return false;
+					}
+
+					if (!ch.hasRoom() || !ch.blockedSenders_.empty()) {
+						// The receiver moves the value out of this awaiter once a slot frees.
+						ch.blockedSenders_.push_back(BlockedSend{&value, &sent, h});
+						return true;
+					}
+
+					ch.enqueue(std::move(value), 0);
+					sent = true;
+					receiver = std::exchange(ch.receiver_, nullptr);
+				}
+
+				if (receiver) {
+					receiver.resume();
+				}
+				return false;
+			}
+
+			bool await_resume() const noexcept { return sent; }
+		};
+		return SendAwaiter{*this, std::move(value)};
+	}
+
+	/**
+	 * @brief Returns the capacity given at construction, or 0 if the channel is unbounded.
+	 */
+	[[nodiscard]]
+	std::size_t capacity() const noexcept
+	{
+		return capacity_;
+	}
+
+	/**
+	 * @brief Returns the number of items waiting to be received.
+	 */
+	[[nodiscard]]
+	std::size_t size() const
+	{
+		std::scoped_lock lock(mutex_);
+		return queue_.size();
+	}
+
+	/**
+	 * @brief Returns how many sends have been dropped by coalescing so far.
+	 */
+	[[nodiscard]]
+	std::uint64_t coalescedCount() const
+	{
+		std::scoped_lock lock(mutex_);
+		return coalescedCount_;
+	}
+
 	/**
 	 * @brief Asynchronously receives a value from the channel.
 	 *
@@ -202,13 +414,20 @@ public:
 
 			std::optional<T> await_resume()
 			{
-				std::scoped_lock lock(ch.mutex_);
+				std::unique_lock lock(ch.mutex_);
 
 				// Priority 1: Drain the queue.
 				// Even if closed, we return existing data first (Graceful Shutdown).
 				if (!ch.queue_.empty()) {
-					T val = std::move(ch.queue_.front());
+					T val = std::move(ch.queue_.front().value);
 					ch.queue_.pop_front();
+
+					// The freed slot goes to the oldest blocked sender, if any.
+					std::coroutine_handle<> sender = ch.admitBlockedSender();
+					lock.unlock();
+					if (sender) {
+						sender.resume();
+					}
 					return val;
 				}
 
@@ -226,11 +445,113 @@ public:
 		return ReceiveAwaiter{*this};
 	}
 
+	/**
+	 * @brief Asynchronously receives up to maxItems values with a single wake-up.
+	 *
+	 * Waits like `receive()` until at least one item is available, then takes every queued item up to
+	 * maxItems in receive order. The same **Single Consumer** contract applies.
+	 *
+	 * @param maxItems Largest batch to return; 0 is treated as 1.
+	 * @return An awaitable object that yields `std::vector<T>`, empty once the channel is closed and
+	 * drained.
+	 */
+	[[nodiscard("You must co_await the received values.")]]
+	auto receiveMany(std::size_t maxItems)
+	{
+		struct ReceiveManyAwaiter {
+			Channel &ch;
+			std::size_t maxItems;
+
+			bool await_ready() const noexcept { return false; }
+
+			bool await_suspend(std::coroutine_handle<> h)
+			{
+				std::scoped_lock lock(ch.mutex_);
+
+				if (!ch.queue_.empty() || ch.closed_) {
+					return false;
+				}
+
+				ch.receiver_ = h;
+				return true;
+			}
+
+			std::vector<T> await_resume()
+			{
+				std::vector<T> items;
+				std::vector<std::coroutine_handle<>> senders;
+				{
+					std::scoped_lock lock(ch.mutex_);
+
+					const std::size_t limit = std::max<std::size_t>(maxItems, 1);
+					items.reserve(std::min(limit, ch.queue_.size()));
+					while (!ch.queue_.empty() && items.size() < limit) {
+						items.push_back(std::move(ch.queue_.front().value));
+						ch.queue_.pop_front();
+					}
+
+					// Items of blocked senders fill the freed slots for the next batch.
+					while (std::coroutine_handle<> sender = ch.admitBlockedSender()) {
+						senders.push_back(sender);
+					}
+				}
+
+				for (std::coroutine_handle<> sender : senders) {
+					sender.resume();
+				}
+				return items;
+			}
+		};
+		return ReceiveManyAwaiter{*this, maxItems};
+	}
+
 private:
+	struct Entry {
+		int priority;
+		T value;
+	};
+
+	// A sender suspended in sendAsync(); both pointers refer into its awaiter.
+	struct BlockedSend {
+		T *value;
+		bool *sent;
+		std::coroutine_handle<> handle;
+	};
+
+	// Must be called with mutex_ held
+	bool hasRoom() const noexcept { return capacity_ == 0 || queue_.size() < capacity_; }
+
+	// Must be called with mutex_ held. Queues the oldest blocked sender's item if there is room now
+	// and returns the sender to resume outside the lock.
+	std::coroutine_handle<> admitBlockedSender()
+	{
+		if (blockedSenders_.empty() || !hasRoom()) {
+			return nullptr;
+		}
+
+		BlockedSend blocked = blockedSenders_.front();
+		blockedSenders_.pop_front();
+		enqueue(std::move(*blocked.value), 0);
+		*blocked.sent = true;
+		return blocked.handle;
+	}
+
+	// Must be called with mutex_ held
+	void enqueue(T value, int priority)
+	{
+		// Insert after every entry of the same or higher priority to keep FIFO order within a priority.
+		auto it = std::find_if(queue_.begin(), queue_.end(),
+				       [priority](const Entry &entry) { return entry.priority < priority; });
+		queue_.insert(it, Entry{priority, std::move(value)});
+	}
+
+	const std::size_t capacity_ = 0;
 	mutable std::mutex mutex_;
-	std::deque<T> queue_;
+	std::deque<Entry> queue_;
+	std::deque<BlockedSend> blockedSenders_;
 	std::coroutine_handle<> receiver_ = nullptr;
 	bool closed_ = false;
+	std::uint64_t coalescedCount_ = 0;
 };
 
 } // namespace KaitoTokyo::Async
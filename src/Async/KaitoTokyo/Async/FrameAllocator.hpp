@@ -0,0 +1,261 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * KaitoTokyo Async Library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+namespace KaitoTokyo::Async {
+
+/**
+ * @brief Process-wide counters of `FrameAllocator`.
+ *
+ * Threads publish their counts in batches, so another thread's recent activity may be missing by up
+ * to a few hundred frames; the calling thread's own counts are always included.
+ */
+struct FrameAllocatorStats {
+	// Frames that had to come from the global allocator.
+	std::uint64_t allocated = 0;
+	// Frames served from a thread-local free list instead.
+	std::uint64_t recycled = 0;
+	// Blocks given back to the global allocator because a free list was full, disabled or gone.
+	std::uint64_t released = 0;
+};
+
+namespace FrameAllocatorDetail {
+
+// Frames are rounded up to a multiple of kGranularity, the usual malloc alignment, so that frames of
+// similar size share a list without padding them beyond what the global allocator would.
+inline constexpr std::size_t kGranularity = 16;
+// Frames larger than kGranularity * kSizeClassCount (1 KiB) always use the global allocator.
+inline constexpr std::size_t kSizeClassCount = 64;
+// Upper bound of blocks kept per size class and thread, so a burst does not pin memory forever.
+inline constexpr std::size_t kMaxCachedPerClass = 64;
+// Thread-local counts are added to the process-wide ones after this many events.
+inline constexpr std::uint64_t kCounterFlushInterval = 256;
+
+struct FreeBlock {
+	FreeBlock *next;
+};
+
+// Trivially destructible, so it stays usable while other thread_locals are destroyed after it.
+struct ThreadCache {
+	std::array<FreeBlock *, kSizeClassCount> heads{};
+	std::array<std::size_t, kSizeClassCount> counts{};
+	// Not yet added to the process-wide counters.
+	std::uint64_t allocated = 0;
+	std::uint64_t recycled = 0;
+	std::uint64_t released = 0;
+	std::uint64_t pendingEvents = 0;
+	bool reaperArmed = false;
+	bool closed = false;
+};
+
+inline ThreadCache &threadCache() noexcept
+{
+	thread_local constinit ThreadCache cache;
+	return cache;
+}
+
+struct Counters {
+	std::atomic<std::uint64_t> allocated = 0;
+	std::atomic<std::uint64_t> recycled = 0;
+	std::atomic<std::uint64_t> released = 0;
+	std::atomic<bool> recyclingEnabled = true;
+};
+
+inline Counters &counters() noexcept
+{
+	static Counters instance;
+	return instance;
+}
+
+inline std::size_t sizeClassOf(std::size_t size) noexcept
+{
+	return size == 0 ? 0 : (size - 1) / kGranularity;
+}
+
+inline std::size_t blockSizeOf(std::size_t sizeClass) noexcept
+{
+	return (sizeClass + 1) * kGranularity;
+}
+
+inline void flushCounters(ThreadCache &cache) noexcept
+{
+	Counters &global = counters();
+	global.allocated.fetch_add(std::exchange(cache.allocated, 0), std::memory_order_relaxed);
+	global.recycled.fetch_add(std::exchange(cache.recycled, 0), std::memory_order_relaxed);
+	global.released.fetch_add(std::exchange(cache.released, 0), std::memory_order_relaxed);
+	cache.pendingEvents = 0;
+}
+
+// Returns the cached blocks of the exiting thread to the global allocator and publishes its counts.
+struct ThreadCacheReaper {
+	~ThreadCacheReaper()
+	{
+		ThreadCache &cache = threadCache();
+		cache.closed = true;
+		for (std::size_t sizeClass = 0; sizeClass < kSizeClassCount; ++sizeClass) {
+			while (FreeBlock *block = cache.heads[sizeClass]) {
+				cache.heads[sizeClass] = block->next;
+				::operator delete(block, blockSizeOf(sizeClass));
+				++cache.released;
+			}
+			cache.counts[sizeClass] = 0;
+		}
+		flushCounters(cache);
+	}
+};
+
+inline void armReaper(ThreadCache &cache) noexcept
+{
+	// Passing the declaration registers the reaper's destructor for this thread.
+	thread_local ThreadCacheReaper reaper;
+	static_cast<void>(reaper);
+	cache.reaperArmed = true;
+}
+
+// Counts one event of the calling thread, publishing the batch when it is full.
+inline void countEvent(ThreadCache &cache, std::uint64_t ThreadCache::*counter) noexcept
+{
+	++(cache.*counter);
+	if (cache.closed) {
+		flushCounters(cache);
+		return;
+	}
+	if (!cache.reaperArmed) {
+		armReaper(cache);
+	}
+	if (++cache.pendingEvents >= kCounterFlushInterval) {
+		flushCounters(cache);
+	}
+}
+
+} // namespace FrameAllocatorDetail
+
+/**
+ * @brief Recycling allocator for coroutine frames.
+ *
+ * @details
+ * `Task`'s promise allocates its frame here. Frames up to 1 KiB are rounded to 16-byte size classes
+ * and, when destroyed, kept on a free list of the destroying thread (up to 64 per class) instead of
+ * going back to the global allocator. The next frame of the same class on that thread reuses the
+ * block, so steady coroutine churn, like the controller's per-cutover tasks, stops hitting `malloc`.
+ *
+ * A frame may be destroyed on another thread than the one that allocated it; the block simply moves
+ * to that thread's list. Lists are emptied when their thread exits.
+ *
+ * Recycling can be turned off process-wide with `setRecyclingEnabled(false)`, after which frames go
+ * straight to the global allocator. Blocks from either mode can be freed in the other.
+ */
+class FrameAllocator {
+public:
+	/**
+	 * @brief Allocates a coroutine frame of the given size.
+	 * @throws std::bad_alloc If the global allocator fails.
+	 */
+	static void *allocate(std::size_t size)
+	{
+		using namespace FrameAllocatorDetail;
+
+		ThreadCache &cache = threadCache();
+		const std::size_t sizeClass = sizeClassOf(size);
+		if (sizeClass >= kSizeClassCount) {
+			void *frame = ::operator new(size);
+			countEvent(cache, &ThreadCache::allocated);
+			return frame;
+		}
+
+		if (FreeBlock *block = cache.heads[sizeClass]) {
+			cache.heads[sizeClass] = block->next;
+			--cache.counts[sizeClass];
+			countEvent(cache, &ThreadCache::recycled);
+			return block;
+		}
+
+		void *frame = ::operator new(blockSizeOf(sizeClass));
+		countEvent(cache, &ThreadCache::allocated);
+		return frame;
+	}
+
+	/**
+	 * @brief Frees a frame returned by `allocate()` with the same size.
+	 */
+	static void deallocate(void *pointer, std::size_t size) noexcept
+	{
+		using namespace FrameAllocatorDetail;
+
+		ThreadCache &cache = threadCache();
+		const std::size_t sizeClass = sizeClassOf(size);
+		if (sizeClass >= kSizeClassCount) {
+			::operator delete(pointer, size);
+			countEvent(cache, &ThreadCache::released);
+			return;
+		}
+
+		if (!cache.closed && cache.counts[sizeClass] < kMaxCachedPerClass &&
+		    counters().recyclingEnabled.load(std::memory_order_relaxed)) {
+			if (!cache.reaperArmed) {
+				armReaper(cache);
+			}
+			cache.heads[sizeClass] = new (pointer) FreeBlock{cache.heads[sizeClass]};
+			++cache.counts[sizeClass];
+			return;
+		}
+
+		::operator delete(pointer, blockSizeOf(sizeClass));
+		countEvent(cache, &ThreadCache::released);
+	}
+
+	/**
+	 * @brief Turns recycling on or off for all threads. Enabled by default.
+	 *
+	 * Blocks already cached stay usable until their thread exits.
+	 */
+	static void setRecyclingEnabled(bool enabled) noexcept
+	{
+		FrameAllocatorDetail::counters().recyclingEnabled.store(enabled, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief Returns the process-wide counters.
+	 */
+	[[nodiscard]]
+	static FrameAllocatorStats stats() noexcept
+	{
+		const auto &counters = FrameAllocatorDetail::counters();
+		const auto &cache = FrameAllocatorDetail::threadCache();
+		return FrameAllocatorStats{counters.allocated.load(std::memory_order_relaxed) + cache.allocated,
+					   counters.recycled.load(std::memory_order_relaxed) + cache.recycled,
+					   counters.released.load(std::memory_order_relaxed) + cache.released};
+	}
+};
+
+} // namespace KaitoTokyo::Async
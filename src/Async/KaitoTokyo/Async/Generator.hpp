@@ -0,0 +1,200 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * KaitoTokyo Async Library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+namespace KaitoTokyo::Async {
+
+/**
+ * @brief A lazy asynchronous sequence whose body may `co_await` between `co_yield`s.
+ *
+ * @details
+ * The body does not run until the first `next()` and runs only up to the following
+ * `co_yield`, so a consumer that stops early never pays for the values it did not ask
+ * for. It is resumed on whatever thread the body's own awaits resume on.
+ *
+ * Like `Task`, the generator owns its coroutine frame. Destroying it while suspended
+ * abandons the remaining sequence; destroying it while the body is running is a
+ * use-after-free. At most one `next()` may be outstanding at a time.
+ *
+ * @code
+ * Generator<int> countTo(int n) {
+ *         for (int i = 1; i <= n; ++i) {
+ *                 co_await somethingAsync();
+ *                 co_yield i;
+ *         }
+ * }
+ *
+ * Task<void> consume() {
+ *         Generator<int> numbers = countTo(10);
+ *         while (std::optional<int> number = co_await numbers.next()) {
+ *                 if (*number == 3)
+ *                         break;
+ *         }
+ * }
+ * @endcode
+ */
+template<typename T>
+class [[nodiscard("Generator objects own the coroutine. Do not discard without iterating.")]] Generator {
+public:
+	struct promise_type {
+		std::optional<T> current;
+		std::exception_ptr exception;
+		std::coroutine_handle<> consumer = nullptr;
+
+		struct TransferToConsumer {
+			bool await_ready() noexcept { return false; }
+
+			std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> h) noexcept
+			{
+				std::coroutine_handle<> consumer = h.promise().consumer;
+				return consumer ? consumer : std::noop_coroutine();
+			}
+
+			void await_resume() noexcept {}
+		};
+
+		Generator get_return_object()
+		{
+			return Generator{std::coroutine_handle<promise_type>::from_promise(*this)};
+		}
+
+		std::suspend_always initial_suspend() noexcept { return {}; }
+		TransferToConsumer final_suspend() noexcept { return {}; }
+
+		TransferToConsumer yield_value(T value)
+		{
+			current.emplace(std::move(value));
+			return {};
+		}
+
+		void return_void() noexcept {}
+		void unhandled_exception() noexcept { exception = std::current_exception(); }
+	};
+
+	Generator() noexcept = default;
+
+	explicit Generator(std::coroutine_handle<promise_type> h) noexcept : handle_(h) {}
+
+	~Generator() noexcept
+	{
+		if (handle_)
+			handle_.destroy();
+	}
+
+	Generator(const Generator &) = delete;
+	Generator &operator=(const Generator &) = delete;
+
+	Generator(Generator &&other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+	Generator &operator=(Generator &&other) noexcept
+	{
+		if (this != &other) {
+			if (handle_)
+				handle_.destroy();
+			handle_ = std::exchange(other.handle_, nullptr);
+		}
+		return *this;
+	}
+
+	explicit operator bool() const noexcept { return handle_ != nullptr; }
+
+	/**
+	 * @brief Awaitable that runs the body to its next `co_yield`.
+	 *
+	 * Yields the produced value, or `std::nullopt` once the body has returned. An
+	 * exception escaping the body is rethrown here, after which the sequence is over.
+	 */
+	struct NextAwaiter {
+		std::coroutine_handle<promise_type> handle;
+
+		// A value yielded after nextInline() gave up on the body is handed out without resuming it.
+		bool await_ready() const noexcept { return !handle || handle.done() || handle.promise().current; }
+
+		std::coroutine_handle<> await_suspend(std::coroutine_handle<> consumer) noexcept
+		{
+			handle.promise().consumer = consumer;
+			return handle;
+		}
+
+		std::optional<T> await_resume()
+		{
+			if (!handle) {
+				return std::nullopt;
+			}
+			promise_type &promise = handle.promise();
+			if (promise.exception) {
+				std::rethrow_exception(std::exchange(promise.exception, nullptr));
+			}
+			return std::exchange(promise.current, std::nullopt);
+		}
+	};
+
+	[[nodiscard]]
+	NextAwaiter next() noexcept
+	{
+		return NextAwaiter{handle_};
+	}
+
+	/**
+	 * @brief Runs the body to its next `co_yield` on the calling thread.
+	 *
+	 * Only for bodies whose awaits all complete inline, such as transfers performed
+	 * without an executor. Throws std::logic_error if the body suspended on anything
+	 * other than `co_yield`; the generator must then be kept alive until the body
+	 * reaches its next `co_yield`, where it stops without resuming anyone.
+	 */
+	std::optional<T> nextInline()
+	{
+		if (!handle_ || handle_.done()) {
+			return std::nullopt;
+		}
+
+		promise_type &promise = handle_.promise();
+		if (promise.current) {
+			return std::exchange(promise.current, std::nullopt);
+		}
+		promise.consumer = nullptr;
+		handle_.resume();
+
+		if (!handle_.done() && !promise.current) {
+			throw std::logic_error("Generator suspended outside co_yield. Use co_await next() instead.");
+		}
+		if (promise.exception) {
+			std::rethrow_exception(std::exchange(promise.exception, nullptr));
+		}
+		return std::exchange(promise.current, std::nullopt);
+	}
+
+private:
+	std::coroutine_handle<promise_type> handle_ = nullptr;
+};
+
+} // namespace KaitoTokyo::Async
@@ -0,0 +1,277 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * KaitoTokyo Async Library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+#include "Channel.hpp"
+
+namespace KaitoTokyo::Async {
+
+/**
+ * @brief A lock-free asynchronous MPSC Channel for high-rate traffic.
+ *
+ * @details
+ * Drop-in for `Channel` where messages are frequent, such as log batches, metrics and frame-ready
+ * notifications. `send()` never takes a lock: it links a node into an intrusive Vyukov MPSC queue
+ * with one atomic exchange and hands the suspended receiver, if any, over through an atomic waiter
+ * slot. `receive()` takes no lock either; it only touches the waiter slot when it has to suspend.
+ *
+ * Semantics match `Channel`:
+ * - **MPSC Design**: `send()` and `close()` may be called from any thread; `receive()` must have at
+ * most one awaiter at a time.
+ * - **Graceful Shutdown**: after `close()`, `send()` returns `false` and the receiver drains every
+ * message that was accepted before `receive()` returns `std::nullopt`.
+ *
+ * Unlike `Channel`, messages are strictly FIFO; there is no priority or coalescing, which would
+ * need the whole queue under a lock.
+ *
+ * @tparam T The type of message to transport. Must satisfy `ChannelMessage`.
+ */
+template<ChannelMessage T> class MpscChannel {
+public:
+	MpscChannel() : head_(&stub_), tail_(&stub_) {}
+
+	~MpscChannel() noexcept
+	{
+		void *waiter = waiter_.exchange(nullptr, std::memory_order_acq_rel);
+		if (waiter) {
+			std::coroutine_handle<>::from_address(waiter).destroy();
+		}
+
+		while (tryPop()) {
+		}
+		if (tail_ != &stub_) {
+			delete tail_;
+		}
+	}
+
+	// Non-copyable and Non-movable: producers and the suspended receiver hold its address.
+	MpscChannel(const MpscChannel &) = delete;
+	MpscChannel &operator=(const MpscChannel &) = delete;
+	MpscChannel(MpscChannel &&) = delete;
+	MpscChannel &operator=(MpscChannel &&) = delete;
+
+	/**
+	 * @brief Closes the channel for new submissions.
+	 *
+	 * Messages already accepted stay receivable. The receiver is woken once no `send()` is still in
+	 * progress, so it never sees the end of the channel before the last accepted message.
+	 */
+	void close()
+	{
+		const std::uint64_t previous = state_.fetch_or(kClosedBit, std::memory_order_seq_cst);
+		if (previous == 0) {
+			// Otherwise the channel was closed already, or the last send() in progress wakes the receiver.
+			wakeReceiver();
+		}
+	}
+
+	/**
+	 * @brief Sends a value to the channel.
+	 *
+	 * This method is lock-free and can be called concurrently by multiple producers. If the receiver is
+	 * suspended, it is resumed inline on the calling thread, as with `Channel`.
+	 *
+	 * @param value The item to send. It will be moved into a new queue node.
+	 * @return `true` if the item was queued.
+	 * @return `false` if the channel is already closed.
+	 */
+	bool send(T value)
+	{
+		if (state_.fetch_add(kSenderUnit, std::memory_order_acq_rel) & kClosedBit) {
+			leaveSend();
+			return false;
+		}
+
+		Node *node = new Node;
+		node->value.emplace(std::move(value));
+		Node *previous = head_.exchange(node, std::memory_order_acq_rel);
+		previous->next.store(node, std::memory_order_release);
+		linked_.fetch_add(1, std::memory_order_seq_cst);
+
+		wakeReceiver();
+		leaveSend();
+		return true;
+	}
+
+	/**
+	 * @brief Returns the number of items waiting to be received. Approximate while senders are active.
+	 */
+	[[nodiscard]]
+	std::size_t size() const noexcept
+	{
+		return static_cast<std::size_t>(linked_.load(std::memory_order_relaxed) -
+						popped_.load(std::memory_order_relaxed));
+	}
+
+	/**
+	 * @brief Asynchronously receives a value from the channel.
+	 *
+	 * @warning This method follows the **Single Consumer** contract. It must NOT be
+	 * awaited concurrently by multiple coroutines. Doing so results in undefined behavior.
+	 *
+	 * @return An awaitable object that yields `std::optional<T>`.
+	 * - Returns `T` (wrapped in optional) if data is available.
+	 * - Returns `std::nullopt` if the channel is closed and drained.
+	 */
+	[[nodiscard("You must co_await the received value.")]]
+	auto receive()
+	{
+		struct ReceiveAwaiter {
+			MpscChannel &ch;
+			std::optional<T> value;
+
+			bool await_ready()
+			{
+				value = ch.tryPop();
+				return value.has_value() || ch.isDrained();
+			}
+
+			bool await_suspend(std::coroutine_handle<> h)
+			{
+				// Once the handle is published a producer may resume the coroutine on its own thread,
+				// so from here on only locals and atomics are touched; the queue itself is not.
+				MpscChannel &channel = ch;
+				const std::uint64_t popped = channel.popped_.load(std::memory_order_relaxed);
+				channel.waiter_.store(h.address(), std::memory_order_seq_cst);
+
+				if (channel.linked_.load(std::memory_order_seq_cst) != popped ||
+				    channel.state_.load(std::memory_order_seq_cst) == kClosedBit) {
+					// A sender or close() may have missed the handle. Claim it like they would;
+					// if it is still there, this resumes the coroutine inline before returning.
+					channel.wakeReceiver();
+				}
+				return true;
+			}
+
+			std::optional<T> await_resume()
+			{
+				if (value) {
+					return std::move(value);
+				}
+				// Whoever resumed us checked that a message is linked or the channel is drained.
+				return ch.tryPop();
+			}
+		};
+		return ReceiveAwaiter{*this, std::nullopt};
+	}
+
+private:
+	struct Node {
+		std::atomic<Node *> next = nullptr;
+		std::optional<T> value;
+	};
+
+	static constexpr std::uint64_t kClosedBit = 1;
+	static constexpr std::uint64_t kSenderUnit = 2;
+
+	// Consumer only. Pops the oldest linked node; the popped node becomes the new stub.
+	std::optional<T> tryPop()
+	{
+		Node *tail = tail_;
+		Node *next = tail->next.load(std::memory_order_acquire);
+		if (!next) {
+			return std::nullopt;
+		}
+
+		std::optional<T> value = std::move(next->value);
+		next->value.reset();
+		tail_ = next;
+		if (tail != &stub_) {
+			delete tail;
+		}
+		popped_.store(popped_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+		return value;
+	}
+
+	// Consumer only, or a waker holding the receiver's handle.
+	bool hasPending() const noexcept { return tail_->next.load(std::memory_order_acquire) != nullptr; }
+
+	// Consumer only, or a waker holding the receiver's handle. True once closed with no send in progress
+	// and nothing left to pop.
+	bool isDrained() const noexcept
+	{
+		return state_.load(std::memory_order_seq_cst) == kClosedBit && !hasPending();
+	}
+
+	void leaveSend() noexcept
+	{
+		const std::uint64_t previous = state_.fetch_sub(kSenderUnit, std::memory_order_seq_cst);
+		if (previous == (kSenderUnit | kClosedBit)) {
+			// The last sender after close() lets the receiver see the end of the channel.
+			wakeReceiver();
+		}
+	}
+
+	// Resumes the receiver only if it has something to receive. A receiver that registered after
+	// taking this sender's message is put back, so await_resume() never wakes up empty-handed.
+	void wakeReceiver()
+	{
+		std::uint64_t epoch = wakeEpoch_.fetch_add(1, std::memory_order_seq_cst) + 1;
+		for (;;) {
+			// Holding the handle means the receiver is suspended, so its side of the queue can be read.
+			void *waiter = waiter_.exchange(nullptr, std::memory_order_seq_cst);
+			if (!waiter) {
+				return;
+			}
+			if (hasPending() || isDrained()) {
+				std::coroutine_handle<>::from_address(waiter).resume();
+				return;
+			}
+
+			waiter_.store(waiter, std::memory_order_seq_cst);
+			// A waker that found the slot empty while we held it left its work to us.
+			const std::uint64_t current = wakeEpoch_.load(std::memory_order_seq_cst);
+			if (current == epoch) {
+				return;
+			}
+			epoch = current;
+		}
+	}
+
+	// Producer side.
+	alignas(64) std::atomic<Node *> head_;
+	// Closed bit plus kSenderUnit per send() in progress.
+	std::atomic<std::uint64_t> state_ = 0;
+	// Messages fully linked into the queue.
+	std::atomic<std::uint64_t> linked_ = 0;
+
+	// Consumer side.
+	alignas(64) Node *tail_;
+	// Written by the consumer only; atomic so that size() can read it.
+	std::atomic<std::uint64_t> popped_ = 0;
+	std::atomic<void *> waiter_ = nullptr;
+	std::atomic<std::uint64_t> wakeEpoch_ = 0;
+	Node stub_;
+};
+
+} // namespace KaitoTokyo::Async
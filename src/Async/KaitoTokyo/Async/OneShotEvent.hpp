@@ -0,0 +1,129 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * KaitoTokyo Async Library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <coroutine>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace KaitoTokyo::Async {
+
+/**
+ * @brief An event that is set once and then stays set, for coroutines to wait on.
+ *
+ * @details
+ * Typical use is a "ready" signal for state that is loaded asynchronously, such as credentials read
+ * from the system keychain at startup. `co_await wait()` completes immediately once the event is set;
+ * before that it suspends, and `set()` resumes every waiter inline on the calling thread, as
+ * `Channel::send()` does. Waiters that need a particular thread should hop there afterwards.
+ *
+ * `set()`, `isSet()` and `wait()` may be called from any thread, and any number of coroutines may wait.
+ */
+class OneShotEvent {
+public:
+	OneShotEvent() = default;
+
+	~OneShotEvent() noexcept
+	{
+		std::vector<std::coroutine_handle<>> waiters;
+		try {
+			std::scoped_lock lock(mutex_);
+			waiters.swap(waiters_);
+		} catch (...) {
+			return;
+		}
+		// Never set, so these would never resume; destroy them like Channel does with its receiver.
+		for (std::coroutine_handle<> h : waiters) {
+			h.destroy();
+		}
+	}
+
+	// Non-copyable and Non-movable: suspended waiters hold its address.
+	OneShotEvent(const OneShotEvent &) = delete;
+	OneShotEvent &operator=(const OneShotEvent &) = delete;
+	OneShotEvent(OneShotEvent &&) = delete;
+	OneShotEvent &operator=(OneShotEvent &&) = delete;
+
+	/**
+	 * @brief Sets the event and resumes every waiter on the calling thread. Later calls do nothing.
+	 */
+	void set()
+	{
+		std::vector<std::coroutine_handle<>> waiters;
+		{
+			std::scoped_lock lock(mutex_);
+			if (set_.load(std::memory_order_relaxed)) {
+				return;
+			}
+			set_.store(true, std::memory_order_release);
+			waiters.swap(waiters_);
+		}
+		for (std::coroutine_handle<> h : waiters) {
+			h.resume();
+		}
+	}
+
+	[[nodiscard]]
+	bool isSet() const noexcept
+	{
+		return set_.load(std::memory_order_acquire);
+	}
+
+	/**
+	 * @brief Returns an awaitable that completes once the event is set.
+	 */
+	[[nodiscard("You must co_await the event.")]]
+	auto wait() noexcept
+	{
+		struct WaitAwaiter {
+			OneShotEvent &event;
+
+			bool await_ready() const noexcept { return event.isSet(); }
+
+			bool await_suspend(std::coroutine_handle<> h)
+			{
+				std::scoped_lock lock(event.mutex_);
+				if (event.set_.load(std::memory_order_relaxed)) {
+					return false;
+				}
+				event.waiters_.push_back(h);
+				return true;
+			}
+
+			void await_resume() const noexcept {}
+		};
+		return WaitAwaiter{*this};
+	}
+
+private:
+	std::mutex mutex_;
+	std::atomic<bool> set_ = false;
+	std::vector<std::coroutine_handle<>> waiters_;
+};
+
+} // namespace KaitoTokyo::Async
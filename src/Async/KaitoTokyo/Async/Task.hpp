@@ -41,9 +41,10 @@
  * 1. **Optimized Execution**: Beyond the initial memory allocation, the execution
  * model is zero-overhead. It utilizes **Symmetric Transfer** to switch contexts,
  * preventing stack overflows during deep recursion and minimizing CPU cycles.
- * 2. **Standard Allocation**: This implementation uses standard heap allocation
- * (`operator new`) for the coroutine frame. This ensures compatibility with
- * standard C++ memory models.
+ * 2. **Recycled Allocation**: Coroutine frames come from `FrameAllocator`, which
+ * keeps freed frames on thread-local size-class free lists. Steady task churn
+ * reuses them instead of calling the global allocator; see `FrameAllocator` for
+ * the counters and the opt-out.
  *
  * @section LIFECYCLE Ownership & Destruction
  *
@@ -79,12 +80,16 @@
  */
 
 #include <coroutine>
+#include <cstddef>
 #include <exception>
 #include <memory>
 #include <stdexcept>
 #include <utility>
 #include <variant>
 
+#include "FrameAllocator.hpp"
+#include "Tracing.hpp"
+
 namespace KaitoTokyo::Async {
 
 // -----------------------------------------------------------------------------
@@ -99,6 +104,7 @@ template<typename PromiseType> struct TaskSymmetricTransfer {
 	std::coroutine_handle<> await_suspend(std::coroutine_handle<PromiseType> h) noexcept
 	{
 		auto &promise = h.promise();
+		promise.trace.onFinish();
 		if (promise.continuation) {
 			return promise.continuation;
 		}
@@ -160,19 +166,26 @@ template<> struct TaskPromiseBase<void> {
  * This task is lazy (does not start until awaited or explicitly started) and
  * strictly manages the lifecycle of the coroutine frame via RAII.
  *
- * It is optimized for runtime performance using symmetric transfer mechanics,
- * making it suitable for high-frequency async operations where standard
- * allocation overhead is acceptable.
+ * It is optimized for runtime performance using symmetric transfer mechanics
+ * and recycled frame allocation, making it suitable for high-frequency async
+ * operations.
  */
 template<typename T>
 struct [[nodiscard("Task objects own the running coroutine. Do not discard without awaiting or storing.")]] Task {
 	struct promise_type : TaskPromiseBase<T> {
 		std::coroutine_handle<> continuation = nullptr;
+		[[no_unique_address]] TaskTrace trace;
 
 		Task get_return_object() { return Task{std::coroutine_handle<promise_type>::from_promise(*this)}; }
 
 		std::suspend_always initial_suspend() { return {}; }
 		auto final_suspend() noexcept { return TaskSymmetricTransfer<promise_type>{}; }
+
+		static void *operator new(std::size_t size) { return FrameAllocator::allocate(size); }
+		static void operator delete(void *pointer, std::size_t size) noexcept
+		{
+			FrameAllocator::deallocate(pointer, size);
+		}
 	};
 
 	// Default constructor creates an empty task.
@@ -215,6 +228,7 @@ struct [[nodiscard("Task objects own the running coroutine. Do not discard witho
 	std::coroutine_handle<> await_suspend(std::coroutine_handle<> caller)
 	{
 		handle.promise().continuation = caller;
+		handle.promise().trace.onStart();
 		return handle;
 	}
 
@@ -230,8 +244,21 @@ struct [[nodiscard("Task objects own the running coroutine. Do not discard witho
 	 */
 	void start()
 	{
-		if (handle && !handle.done())
+		if (handle && !handle.done()) {
+			handle.promise().trace.onStart();
 			handle.resume();
+		}
+	}
+
+	/**
+	 * @brief Names the task in coroutine traces. Does nothing unless tracing is compiled in.
+	 * @param name A string literal or other string that outlives the trace.
+	 */
+	Task named(const char *name) && noexcept
+	{
+		if (handle)
+			handle.promise().trace.setName(name);
+		return std::move(*this);
 	}
 
 private:
@@ -0,0 +1,337 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * KaitoTokyo Async Library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+/**
+ * =============================================================================
+ * KAITOTOKYO ASYNC LIBRARY - TASK SCOPE
+ * =============================================================================
+ *
+ * @brief Owns a group of child tasks and waits for all of them to finish.
+ *
+ * `spawn` starts a child on the calling thread right away; the scope keeps
+ * its frame alive until it finishes, wherever that happens. Every child is
+ * handed the scope's `CancellationToken` by convention, and the first child
+ * that throws cancels it so the others stop at their next check. The first
+ * exception is rethrown by `join`.
+ *
+ * The scope can be awaited with `co_await scope.joinAsync()` or joined from
+ * plain code with `join()`, which blocks on a condition variable without
+ * spinning. `joinFor` and `joinUntil` give up at a deadline, cancel the
+ * children and leave them to finish on their own, so a shutdown path can
+ * bound how long it waits.
+ *
+ * @section EXAMPLE Usage
+ *
+ * @code
+ * TaskScope scope;
+ * scope.spawn(upload(scope.token()));
+ * scope.spawn(poll(scope.token()));
+ * co_await scope.joinAsync();
+ * @endcode
+ * =============================================================================
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+#include "Cancellation.hpp"
+#include "Task.hpp"
+
+namespace KaitoTokyo::Async {
+
+namespace TaskScopeDetail {
+
+struct TaskScopeState {
+	CancellationSource source;
+
+	std::mutex mutex;
+	std::condition_variable cv;
+	std::size_t pending = 0;
+	std::exception_ptr error = nullptr;
+	std::coroutine_handle<> waiter = nullptr;
+
+	void fail(std::exception_ptr e) noexcept
+	{
+		{
+			std::scoped_lock lock(mutex);
+			if (error) {
+				return;
+			}
+			try {
+				std::rethrow_exception(e);
+			} catch (const OperationCancelledError &) {
+				// Children stopping because the scope was cancelled is expected, not a failure.
+				if (source.isCancellationRequested()) {
+					return;
+				}
+			} catch (...) {
+			}
+			error = std::move(e);
+		}
+		source.cancel();
+	}
+
+	// Returns the coroutine to resume when the last child has finished.
+	std::coroutine_handle<> arrive() noexcept
+	{
+		std::coroutine_handle<> next = nullptr;
+		{
+			std::scoped_lock lock(mutex);
+			if (--pending == 0) {
+				next = std::exchange(waiter, nullptr);
+				cv.notify_all();
+			}
+		}
+		return next ? next : std::noop_coroutine();
+	}
+};
+
+/**
+ * @brief Eagerly started wrapper that owns one child and destroys itself when the child finishes.
+ */
+struct TaskScopeChild {
+	struct promise_type {
+		std::shared_ptr<TaskScopeState> state;
+
+		promise_type(Task<void> &, const std::shared_ptr<TaskScopeState> &s) noexcept : state(s) {}
+
+		TaskScopeChild get_return_object()
+		{
+			return TaskScopeChild{std::coroutine_handle<promise_type>::from_promise(*this)};
+		}
+
+		std::suspend_always initial_suspend() noexcept { return {}; }
+
+		auto final_suspend() noexcept
+		{
+			struct FinalAwaiter {
+				bool await_ready() noexcept { return false; }
+
+				std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> h) noexcept
+				{
+					// The frame goes first, so a joiner that wakes up can free everything at once.
+					const std::shared_ptr<TaskScopeState> state = std::move(h.promise().state);
+					h.destroy();
+					return state->arrive();
+				}
+
+				void await_resume() noexcept {}
+			};
+			return FinalAwaiter{};
+		}
+
+		void return_void() noexcept {}
+		[[noreturn]] void unhandled_exception() noexcept { std::terminate(); }
+	};
+
+	std::coroutine_handle<promise_type> handle;
+};
+
+inline TaskScopeChild runTaskScopeChild(Task<void> task, std::shared_ptr<TaskScopeState> state)
+{
+	try {
+		co_await task;
+	} catch (...) {
+		state->fail(std::current_exception());
+	}
+}
+
+} // namespace TaskScopeDetail
+
+/**
+ * @brief A nursery for child tasks with first-error propagation and cooperative cancellation.
+ *
+ * @details
+ * `spawn`, `cancel` and the join methods may be called from any thread; at most one coroutine may
+ * await `joinAsync()` at a time. A scope destroyed with children still running cancels them and lets
+ * them finish on their own, so anything they reference must outlive them; join first when it does not.
+ */
+class TaskScope {
+public:
+	using Clock = std::chrono::steady_clock;
+
+	TaskScope() : state_(std::make_shared<TaskScopeDetail::TaskScopeState>()) {}
+
+	/**
+	 * @brief Creates a scope that is also cancelled when the parent token is.
+	 */
+	explicit TaskScope(const CancellationToken &parent) : TaskScope()
+	{
+		parentCallback_.emplace(parent, [source = state_->source]() mutable { source.cancel(); });
+	}
+
+	~TaskScope() noexcept
+	{
+		parentCallback_.reset();
+		bool running;
+		{
+			std::scoped_lock lock(state_->mutex);
+			running = state_->pending != 0;
+		}
+		// Outside the lock: cancellation callbacks may finish a child, which takes it again.
+		if (running) {
+			state_->source.cancel();
+		}
+	}
+
+	TaskScope(const TaskScope &) = delete;
+	TaskScope &operator=(const TaskScope &) = delete;
+	TaskScope(TaskScope &&) = delete;
+	TaskScope &operator=(TaskScope &&) = delete;
+
+	/**
+	 * @brief The token children should observe. Cancelled by `cancel()`, the first failure or a missed deadline.
+	 */
+	[[nodiscard]] CancellationToken token() const noexcept { return state_->source.token(); }
+
+	/**
+	 * @brief Requests cancellation of every child.
+	 */
+	void cancel() noexcept { state_->source.cancel(); }
+
+	/**
+	 * @brief Starts a child on the calling thread. It runs until its first suspension before this returns.
+	 * @note Spawning an empty task is a no-op.
+	 */
+	void spawn(Task<void> task)
+	{
+		if (!task) {
+			return;
+		}
+
+		TaskScopeDetail::TaskScopeChild child = TaskScopeDetail::runTaskScopeChild(std::move(task), state_);
+		{
+			std::scoped_lock lock(state_->mutex);
+			++state_->pending;
+		}
+		child.handle.resume();
+	}
+
+	/**
+	 * @brief Returns the number of children that have not finished yet.
+	 */
+	[[nodiscard]] std::size_t size() const
+	{
+		std::scoped_lock lock(state_->mutex);
+		return state_->pending;
+	}
+
+	/**
+	 * @brief Awaits every child. Resumes on the thread that finished the last one.
+	 *
+	 * @return An awaitable that rethrows the first exception thrown by a child.
+	 */
+	[[nodiscard("You must co_await the scope.")]]
+	auto joinAsync() const noexcept
+	{
+		struct JoinAwaiter {
+			std::shared_ptr<TaskScopeDetail::TaskScopeState> state;
+
+			bool await_ready() const noexcept { return false; }
+
+			bool await_suspend(std::coroutine_handle<> h)
+			{
+				std::scoped_lock lock(state->mutex);
+				if (state->pending == 0) {
+					return false;
+				}
+				state->waiter = h;
+				return true;
+			}
+
+			void await_resume() const { rethrowError(*state); }
+		};
+		return JoinAwaiter{state_};
+	}
+
+	/**
+	 * @brief Blocks until every child has finished.
+	 *
+	 * @warning Do not call from a thread that a child needs in order to make progress.
+	 * @throws The first exception thrown by a child.
+	 */
+	void join()
+	{
+		{
+			std::unique_lock lock(state_->mutex);
+			state_->cv.wait(lock, [this] { return state_->pending == 0; });
+		}
+		rethrowError(*state_);
+	}
+
+	/**
+	 * @brief Blocks until every child has finished or the deadline passes.
+	 *
+	 * On timeout the children are cancelled and left running; the scope may be destroyed safely.
+	 *
+	 * @return `true` if every child finished, `false` on timeout.
+	 * @throws The first exception thrown by a child, if every child finished.
+	 */
+	bool joinUntil(const Clock::time_point deadline)
+	{
+		{
+			std::unique_lock lock(state_->mutex);
+			if (!state_->cv.wait_until(lock, deadline, [this] { return state_->pending == 0; })) {
+				lock.unlock();
+				state_->source.cancel();
+				return false;
+			}
+		}
+		rethrowError(*state_);
+		return true;
+	}
+
+	/**
+	 * @brief Like `joinUntil`, with a deadline relative to now.
+	 */
+	bool joinFor(const Clock::duration timeout) { return joinUntil(Clock::now() + timeout); }
+
+private:
+	static void rethrowError(TaskScopeDetail::TaskScopeState &state)
+	{
+		std::exception_ptr error;
+		{
+			std::scoped_lock lock(state.mutex);
+			error = state.error;
+		}
+		if (error) {
+			std::rethrow_exception(error);
+		}
+	}
+
+	std::shared_ptr<TaskScopeDetail::TaskScopeState> state_;
+	std::optional<CancellationCallback> parentCallback_;
+};
+
+} // namespace KaitoTokyo::Async
@@ -0,0 +1,316 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * KaitoTokyo Async Library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+/**
+ * =============================================================================
+ * KAITOTOKYO ASYNC LIBRARY - THREAD POOL EXECUTOR
+ * =============================================================================
+ *
+ * @brief A named pool of worker threads that coroutines can hop onto.
+ *
+ * Each `ThreadPoolExecutor` owns a fixed number of threads and a FIFO queue,
+ * so work given to one pool cannot starve another, nor a process-wide pool
+ * shared with the host application. `co_await ResumeOn{executor}` moves the
+ * coroutine onto the pool; it does not suspend at all when the coroutine is
+ * already running there.
+ *
+ * Per-thread resources are set up and torn down by the `onThreadStart` and
+ * `onThreadStop` hooks, which run on the worker thread itself. `getStats()`
+ * reports the queue depth and the time the workers spent busy.
+ *
+ * @section EXAMPLE Usage
+ *
+ * @code
+ * ThreadPoolExecutor network({.name = "network", .threadCount = 4});
+ *
+ * Task<void> example() {
+ *         co_await ResumeOn{network};
+ *         // Blocking network calls run here.
+ * }
+ * @endcode
+ * =============================================================================
+ */
+
+#include <chrono>
+#include <concepts>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Tracing.hpp"
+
+namespace KaitoTokyo::Async {
+
+/**
+ * @brief Configuration of a ThreadPoolExecutor.
+ */
+struct ThreadPoolExecutorOptions {
+	// Reported in logs and metrics.
+	std::string name;
+	// Number of worker threads, which is also the concurrency limit.
+	std::size_t threadCount = 1;
+	// Runs on each worker before it takes any work, with the worker's index.
+	std::function<void(std::size_t)> onThreadStart;
+	// Runs on each worker after it has taken its last work.
+	std::function<void(std::size_t)> onThreadStop;
+};
+
+/**
+ * @brief Counters of a ThreadPoolExecutor, taken at one point in time.
+ */
+struct ThreadPoolExecutorStats {
+	// Work waiting for a free worker.
+	std::size_t queueDepth = 0;
+	// Highest queueDepth seen so far.
+	std::size_t maxQueueDepth = 0;
+	// Work items accepted by post().
+	std::uint64_t submitted = 0;
+	// Work items that have finished running.
+	std::uint64_t completed = 0;
+	// Total time workers spent running work.
+	std::chrono::nanoseconds busyTime{0};
+};
+
+/**
+ * @brief A fixed-size pool of named worker threads.
+ *
+ * `post()` may be called from any thread. The destructor stops accepting work, lets the workers
+ * finish everything already queued and joins them, so a coroutine that hopped onto the pool is never
+ * dropped. Destroying the executor from one of its own workers is allowed; that worker is detached
+ * and exits once its current work returns.
+ */
+class ThreadPoolExecutor {
+public:
+	using Clock = std::chrono::steady_clock;
+
+	/**
+	 * @throws std::invalid_argument If threadCount is zero.
+	 */
+	explicit ThreadPoolExecutor(ThreadPoolExecutorOptions options)
+		: state_(std::make_shared<State>(std::move(options)))
+	{
+		if (state_->options.threadCount == 0) {
+			throw std::invalid_argument("InvalidThreadCountError(ThreadPoolExecutor)");
+		}
+
+		threads_.reserve(state_->options.threadCount);
+		try {
+			for (std::size_t i = 0; i < state_->options.threadCount; ++i) {
+				threads_.emplace_back([this, state = state_, i]() { run(this, state, i); });
+			}
+		} catch (...) {
+			stop();
+			throw;
+		}
+	}
+
+	~ThreadPoolExecutor() noexcept { stop(); }
+
+	ThreadPoolExecutor(const ThreadPoolExecutor &) = delete;
+	ThreadPoolExecutor &operator=(const ThreadPoolExecutor &) = delete;
+	ThreadPoolExecutor(ThreadPoolExecutor &&) = delete;
+	ThreadPoolExecutor &operator=(ThreadPoolExecutor &&) = delete;
+
+	/**
+	 * @brief Queues work to run on one of the workers.
+	 * @throws std::logic_error If the executor is being destroyed.
+	 */
+	void post(std::function<void()> work)
+	{
+		{
+			std::scoped_lock lock(state_->mutex);
+			if (state_->stopping) {
+				throw std::logic_error("ExecutorStoppedError(ThreadPoolExecutor::post)");
+			}
+			state_->queue.push_back(std::move(work));
+			state_->stats.submitted++;
+			if (state_->queue.size() > state_->stats.maxQueueDepth) {
+				state_->stats.maxQueueDepth = state_->queue.size();
+			}
+		}
+		state_->cv.notify_one();
+	}
+
+	[[nodiscard]] const std::string &getName() const noexcept { return state_->options.name; }
+
+	[[nodiscard]] std::size_t getThreadCount() const noexcept { return state_->options.threadCount; }
+
+	/**
+	 * @brief Returns the current counters.
+	 */
+	[[nodiscard]] ThreadPoolExecutorStats getStats() const
+	{
+		std::scoped_lock lock(state_->mutex);
+		ThreadPoolExecutorStats stats = state_->stats;
+		stats.queueDepth = state_->queue.size();
+		return stats;
+	}
+
+	/**
+	 * @brief Returns the executor whose worker is calling, or nullptr on any other thread.
+	 */
+	[[nodiscard]] static ThreadPoolExecutor *current() noexcept { return currentWorker().executor; }
+
+	/**
+	 * @brief Returns the index of the calling worker within its executor. Only meaningful on a worker.
+	 */
+	[[nodiscard]] static std::size_t currentThreadIndex() noexcept { return currentWorker().index; }
+
+private:
+	// Shared with the workers, so one that outlives a destructor running on it still has its queue.
+	struct State {
+		explicit State(ThreadPoolExecutorOptions opts) : options(std::move(opts)) {}
+
+		const ThreadPoolExecutorOptions options;
+
+		std::mutex mutex;
+		std::condition_variable cv;
+		std::deque<std::function<void()>> queue;
+		ThreadPoolExecutorStats stats;
+		bool stopping = false;
+	};
+
+	struct Worker {
+		ThreadPoolExecutor *executor = nullptr;
+		std::size_t index = 0;
+	};
+
+	static Worker &currentWorker() noexcept
+	{
+		thread_local Worker worker;
+		return worker;
+	}
+
+	void stop() noexcept
+	{
+		{
+			std::scoped_lock lock(state_->mutex);
+			state_->stopping = true;
+		}
+		state_->cv.notify_all();
+		for (std::thread &thread : threads_) {
+			if (thread.get_id() == std::this_thread::get_id()) {
+				currentWorker().executor = nullptr;
+				thread.detach();
+			} else {
+				thread.join();
+			}
+		}
+		threads_.clear();
+	}
+
+	static void run(ThreadPoolExecutor *executor, const std::shared_ptr<State> state, std::size_t index)
+	{
+		currentWorker() = Worker{executor, index};
+		if (state->options.onThreadStart) {
+			state->options.onThreadStart(index);
+		}
+
+		std::unique_lock lock(state->mutex);
+		for (;;) {
+			state->cv.wait(lock, [&state]() { return state->stopping || !state->queue.empty(); });
+			if (state->queue.empty()) {
+				break;
+			}
+
+			std::function<void()> work = std::move(state->queue.front());
+			state->queue.pop_front();
+			lock.unlock();
+
+			const Clock::time_point start = Clock::now();
+			try {
+				work();
+			} catch (...) {
+				// Work handles its own errors; one that escapes must not take the worker down.
+			}
+			// Destroyed before the clock stops and outside the lock, as it may own a coroutine frame.
+			work = nullptr;
+			const Clock::duration busy = Clock::now() - start;
+
+			lock.lock();
+			state->stats.completed++;
+			state->stats.busyTime += std::chrono::duration_cast<std::chrono::nanoseconds>(busy);
+		}
+		lock.unlock();
+
+		if (state->options.onThreadStop) {
+			state->options.onThreadStop(index);
+		}
+		currentWorker() = Worker{};
+	}
+
+	const std::shared_ptr<State> state_;
+	std::vector<std::thread> threads_;
+};
+
+/**
+ * @brief An executor that `ResumeOn` can hop onto.
+ *
+ * `current()` names the executor of the calling worker, and `post()` accepts a coroutine handle,
+ * which is callable and resumes the coroutine.
+ */
+template<typename Executor>
+concept ResumableExecutor = requires(Executor &executor, std::coroutine_handle<> h) {
+	{ Executor::current() } -> std::convertible_to<Executor *>;
+	executor.post(h);
+};
+
+/**
+ * @brief Awaiter that resumes the coroutine on a worker of the given executor.
+ *
+ * Does not suspend if the coroutine already runs on that executor.
+ */
+template<ResumableExecutor Executor> class ResumeOn {
+public:
+	explicit ResumeOn(Executor &executor) noexcept : executor_(executor) {}
+
+	bool await_ready() const noexcept { return Executor::current() == &executor_; }
+
+	void await_suspend(std::coroutine_handle<> h)
+	{
+		trace_.onSuspend();
+		executor_.post(h);
+	}
+
+	void await_resume() noexcept { trace_.onResume("ResumeOn"); }
+
+private:
+	Executor &executor_;
+	[[no_unique_address]] HopTrace trace_;
+};
+
+} // namespace KaitoTokyo::Async
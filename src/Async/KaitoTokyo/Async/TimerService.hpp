@@ -0,0 +1,421 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * KaitoTokyo Async Library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+/**
+ * =============================================================================
+ * KAITOTOKYO ASYNC LIBRARY - TIMER SERVICE
+ * =============================================================================
+ *
+ * @brief Coroutine sleeps that do not need an event loop.
+ *
+ * `co_await sleepFor(d)` and `co_await sleepUntil(t)` suspend the coroutine on
+ * a `TimerService`, one background thread driving a hashed timer wheel. Any
+ * thread may sleep; the coroutine resumes on the timer thread, so it should
+ * hop to its own executor (e.g. `AsyncQt::ResumeOnQThreadPool`) before doing
+ * real work there.
+ *
+ * Timers live in 1 ms buckets. The thread wakes up once per bucket that has
+ * something due, however many timers share it, and not at all while nothing
+ * is pending. Scheduling and cancelling are O(1).
+ *
+ * Passing a `CancellationToken` makes the sleep end early: the coroutine then
+ * resumes on the timer thread and `co_await` throws `OperationCancelledError`.
+ *
+ * @section EXAMPLE Usage
+ *
+ * @code
+ * Task<void> example(CancellationToken token) {
+ *         co_await sleepFor(std::chrono::seconds(1), token);
+ * }
+ * @endcode
+ * =============================================================================
+ */
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+
+#include "Cancellation.hpp"
+
+namespace KaitoTokyo::Async {
+
+/**
+ * @brief Runs the coroutine sleeps of a process on one thread.
+ *
+ * @warning The service must outlive every coroutine sleeping on it; sleepers still pending when it is
+ * destroyed are never resumed. `global()` lives until static destruction.
+ */
+class TimerService {
+public:
+	using Clock = std::chrono::steady_clock;
+
+	static constexpr Clock::duration kTickDuration = std::chrono::milliseconds(1);
+
+	/**
+	 * @brief The awaiter of a sleep. It is the timer's node, so scheduling never allocates.
+	 */
+	class [[nodiscard("You must co_await the sleep.")]] SleepAwaiter {
+	public:
+		SleepAwaiter(TimerService &service, Clock::time_point deadline, CancellationToken token) noexcept
+			: service_(service),
+			  deadline_(deadline),
+			  token_(std::move(token))
+		{
+		}
+
+		~SleepAwaiter() noexcept
+		{
+			// Only a coroutine destroyed while it sleeps still has its node in the service.
+			const State state = state_.load(std::memory_order_relaxed);
+			if (state == State::Wheel || state == State::Ready) {
+				service_.forget(*this);
+			}
+		}
+
+		SleepAwaiter(const SleepAwaiter &) = delete;
+		SleepAwaiter &operator=(const SleepAwaiter &) = delete;
+		SleepAwaiter(SleepAwaiter &&) = delete;
+		SleepAwaiter &operator=(SleepAwaiter &&) = delete;
+
+		bool await_ready() const { return token_.isCancellationRequested() || deadline_ <= Clock::now(); }
+
+		bool await_suspend(std::coroutine_handle<> h)
+		{
+			handle_ = h;
+			// Registered first: once scheduled, the timer thread may resume the coroutine at any time.
+			if (token_.canBeCancelled()) {
+				cancellationCallback_.emplace(token_, [this]() { service_.cancel(*this); });
+			}
+			return service_.schedule(*this);
+		}
+
+		void await_resume() const { token_.throwIfCancellationRequested(); }
+
+	private:
+		friend class TimerService;
+
+		enum class State : std::uint8_t { Unscheduled, CancelledEarly, Wheel, Ready, Fired };
+
+		TimerService &service_;
+		const Clock::time_point deadline_;
+		const CancellationToken token_;
+
+		std::coroutine_handle<> handle_ = nullptr;
+		std::uint64_t deadlineTick_ = 0;
+		SleepAwaiter *prev_ = nullptr;
+		SleepAwaiter *next_ = nullptr;
+		// Written under the service mutex; read without it only by the destructor.
+		std::atomic<State> state_ = State::Unscheduled;
+
+		// Last, so it is unregistered before anything the callback touches goes away.
+		std::optional<CancellationCallback> cancellationCallback_;
+	};
+
+	TimerService() : epoch_(Clock::now()), thread_([this]() { run(); }) {}
+
+	~TimerService() noexcept
+	{
+		{
+			std::scoped_lock lock(mutex_);
+			stopping_ = true;
+		}
+		cv_.notify_one();
+		thread_.join();
+	}
+
+	TimerService(const TimerService &) = delete;
+	TimerService &operator=(const TimerService &) = delete;
+	TimerService(TimerService &&) = delete;
+	TimerService &operator=(TimerService &&) = delete;
+
+	/**
+	 * @brief The process-wide service behind `Async::sleepFor` and `Async::sleepUntil`.
+	 */
+	static TimerService &global()
+	{
+		static TimerService service;
+		return service;
+	}
+
+	/**
+	 * @brief Suspends until the deadline or until the token is cancelled.
+	 */
+	SleepAwaiter sleepUntil(Clock::time_point deadline, CancellationToken token = {}) noexcept
+	{
+		return SleepAwaiter(*this, deadline, std::move(token));
+	}
+
+	/**
+	 * @brief Suspends for at least the given duration or until the token is cancelled.
+	 */
+	SleepAwaiter sleepFor(Clock::duration duration, CancellationToken token = {}) noexcept
+	{
+		return SleepAwaiter(*this, Clock::now() + duration, std::move(token));
+	}
+
+	/**
+	 * @brief Returns the number of sleeps that have not been resumed yet.
+	 */
+	[[nodiscard]] std::size_t pendingCount() const
+	{
+		std::scoped_lock lock(mutex_);
+		return pendingCount_;
+	}
+
+private:
+	static constexpr std::size_t kWheelSize = 512;
+	static constexpr std::uint64_t kNoWakeUp = std::numeric_limits<std::uint64_t>::max();
+
+	// Intrusive doubly linked list of sleepers.
+	struct List {
+		SleepAwaiter *head = nullptr;
+
+		void pushFront(SleepAwaiter &node) noexcept
+		{
+			node.prev_ = nullptr;
+			node.next_ = head;
+			if (head) {
+				head->prev_ = &node;
+			}
+			head = &node;
+		}
+
+		void remove(SleepAwaiter &node) noexcept
+		{
+			if (node.prev_) {
+				node.prev_->next_ = node.next_;
+			} else {
+				head = node.next_;
+			}
+			if (node.next_) {
+				node.next_->prev_ = node.prev_;
+			}
+			node.prev_ = nullptr;
+			node.next_ = nullptr;
+		}
+	};
+
+	std::uint64_t tickOf(Clock::time_point time, bool roundUp) const noexcept
+	{
+		if (time <= epoch_) {
+			return 0;
+		}
+		const Clock::duration elapsed = time - epoch_;
+		const auto ticks = static_cast<std::uint64_t>(elapsed / kTickDuration);
+		return roundUp && elapsed % kTickDuration != Clock::duration::zero() ? ticks + 1 : ticks;
+	}
+
+	List &bucketOf(std::uint64_t tick) noexcept { return wheel_[tick % kWheelSize]; }
+
+	// Returns false if the sleep was cancelled before it could be scheduled.
+	bool schedule(SleepAwaiter &node)
+	{
+		bool notify = false;
+		{
+			std::scoped_lock lock(mutex_);
+			if (node.state_.load(std::memory_order_relaxed) == SleepAwaiter::State::CancelledEarly) {
+				return false;
+			}
+			// Rounded up so a sleep never ends early.
+			node.deadlineTick_ = tickOf(node.deadline_, true);
+			if (node.deadlineTick_ <= currentTick_) {
+				// The wheel has moved past this bucket already.
+				ready_.pushFront(node);
+				node.state_.store(SleepAwaiter::State::Ready, std::memory_order_relaxed);
+			} else {
+				bucketOf(node.deadlineTick_).pushFront(node);
+				node.state_.store(SleepAwaiter::State::Wheel, std::memory_order_relaxed);
+			}
+			pendingCount_++;
+			notify = node.deadlineTick_ < plannedWakeUpTick_;
+		}
+		if (notify) {
+			cv_.notify_one();
+		}
+		return true;
+	}
+
+	void cancel(SleepAwaiter &node) noexcept
+	{
+		{
+			std::scoped_lock lock(mutex_);
+			switch (node.state_.load(std::memory_order_relaxed)) {
+			case SleepAwaiter::State::Unscheduled:
+				node.state_.store(SleepAwaiter::State::CancelledEarly, std::memory_order_relaxed);
+				return;
+			case SleepAwaiter::State::Wheel:
+				bucketOf(node.deadlineTick_).remove(node);
+				ready_.pushFront(node);
+				node.state_.store(SleepAwaiter::State::Ready, std::memory_order_relaxed);
+				break;
+			default:
+				return;
+			}
+		}
+		// Resumed by the timer thread: the canceller may be holding locks the coroutine needs.
+		cv_.notify_one();
+	}
+
+	void forget(SleepAwaiter &node) noexcept
+	{
+		std::scoped_lock lock(mutex_);
+		switch (node.state_.load(std::memory_order_relaxed)) {
+		case SleepAwaiter::State::Wheel:
+			bucketOf(node.deadlineTick_).remove(node);
+			break;
+		case SleepAwaiter::State::Ready:
+			ready_.remove(node);
+			break;
+		default:
+			return;
+		}
+		node.state_.store(SleepAwaiter::State::Fired, std::memory_order_relaxed);
+		pendingCount_--;
+	}
+
+	// Called with the mutex held. Unlinks every due sleeper into a chain through next_.
+	SleepAwaiter *takeDue(std::uint64_t nowTick) noexcept
+	{
+		SleepAwaiter *due = nullptr;
+		const auto take = [&](List &list, SleepAwaiter &node) {
+			list.remove(node);
+			node.state_.store(SleepAwaiter::State::Fired, std::memory_order_relaxed);
+			node.next_ = due;
+			due = &node;
+			pendingCount_--;
+		};
+
+		while (ready_.head) {
+			take(ready_, *ready_.head);
+		}
+
+		// Buckets repeat after a lap, so a long gap never needs more than one pass over the wheel.
+		const std::uint64_t passed = nowTick - currentTick_;
+		const std::uint64_t steps = passed < kWheelSize ? passed : kWheelSize;
+		for (std::uint64_t i = 0; i <= steps; ++i) {
+			List &bucket = bucketOf(nowTick - i);
+			for (SleepAwaiter *node = bucket.head; node;) {
+				SleepAwaiter *next = node->next_;
+				// Later laps share the bucket and stay.
+				if (node->deadlineTick_ <= nowTick) {
+					take(bucket, *node);
+				}
+				node = next;
+			}
+		}
+		currentTick_ = nowTick;
+		return due;
+	}
+
+	// Called with the mutex held. The first tick after currentTick_ with something due, or a lap ahead.
+	std::uint64_t nextDueTick() const noexcept
+	{
+		for (std::uint64_t tick = currentTick_ + 1; tick <= currentTick_ + kWheelSize; ++tick) {
+			for (const SleepAwaiter *node = wheel_[tick % kWheelSize].head; node; node = node->next_) {
+				if (node->deadlineTick_ <= tick) {
+					return tick;
+				}
+			}
+		}
+		return currentTick_ + kWheelSize;
+	}
+
+	void run()
+	{
+		std::unique_lock lock(mutex_);
+		for (;;) {
+			SleepAwaiter *due = takeDue(tickOf(Clock::now(), false));
+			if (due) {
+				lock.unlock();
+				while (due) {
+					// The coroutine may destroy the node as soon as it runs.
+					SleepAwaiter *next = due->next_;
+					due->handle_.resume();
+					due = next;
+				}
+				lock.lock();
+				continue;
+			}
+
+			if (stopping_) {
+				return;
+			}
+
+			if (pendingCount_ == 0) {
+				plannedWakeUpTick_ = kNoWakeUp;
+				cv_.wait(lock);
+			} else {
+				plannedWakeUpTick_ = nextDueTick();
+				cv_.wait_until(lock, epoch_ + plannedWakeUpTick_ * kTickDuration);
+			}
+			plannedWakeUpTick_ = 0;
+		}
+	}
+
+	const Clock::time_point epoch_;
+
+	mutable std::mutex mutex_;
+	std::condition_variable cv_;
+	std::array<List, kWheelSize> wheel_{};
+	// Cancelled sleepers waiting to be resumed by the timer thread.
+	List ready_;
+	std::uint64_t currentTick_ = 0;
+	// Tick the timer thread sleeps until; schedule() only wakes it for something earlier.
+	std::uint64_t plannedWakeUpTick_ = 0;
+	std::size_t pendingCount_ = 0;
+	bool stopping_ = false;
+
+	// Last, so it starts once everything above is initialized.
+	std::thread thread_;
+};
+
+/**
+ * @brief Suspends the calling coroutine for at least the given duration on the global timer service.
+ */
+inline TimerService::SleepAwaiter sleepFor(TimerService::Clock::duration duration, CancellationToken token = {})
+{
+	return TimerService::global().sleepFor(duration, std::move(token));
+}
+
+/**
+ * @brief Suspends the calling coroutine until the deadline on the global timer service.
+ */
+inline TimerService::SleepAwaiter sleepUntil(TimerService::Clock::time_point deadline, CancellationToken token = {})
+{
+	return TimerService::global().sleepUntil(deadline, std::move(token));
+}
+
+} // namespace KaitoTokyo::Async
@@ -0,0 +1,371 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * KaitoTokyo Async Library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+/**
+ * =============================================================================
+ * KAITOTOKYO ASYNC LIBRARY - TRACING
+ * =============================================================================
+ *
+ * @brief Records where coroutine time goes, for chrome://tracing or Perfetto.
+ *
+ * Two kinds of spans are recorded:
+ *
+ * - **Hops** (category "hop"): from the moment an awaiter such as `ResumeOn`
+ *   or `AsyncQt::ResumeOnQObject` hands the coroutine over until it runs
+ *   again. The span is drawn on the thread that resumed it, and its `fromTid`
+ *   argument names the thread that suspended it, so the length of a span is
+ *   the time spent waiting in a queue or an event loop.
+ * - **Tasks** (category "task"): from the first resume of a `Task` until it
+ *   returns, named with `Task::named()`.
+ *
+ * Every thread appends to its own fixed-size buffer with a plain store and a
+ * release increment, so recording takes no lock; a full buffer drops events
+ * and counts them. `TraceRecorder::writeChromeTrace()` may run concurrently
+ * with recording and writes everything published so far.
+ *
+ * The hooks are compiled only when `KAITOTOKYO_ASYNC_TRACING` is defined (the
+ * `ENABLE_ASYNC_TRACING` CMake option). Otherwise `HopTrace` and `TaskTrace`
+ * are empty and their functions do nothing, so awaiters and promises keep
+ * their size and code. In tracing builds recording still starts only after
+ * `TraceRecorder::setEnabled(true)`.
+ *
+ * @section EXAMPLE Usage
+ *
+ * @code
+ * TraceRecorder::setEnabled(true);
+ * co_await fetchPlaylist().named("fetchPlaylist");
+ * TraceRecorder::writeChromeTraceFile("async-trace.json");
+ * @endcode
+ * =============================================================================
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace KaitoTokyo::Async {
+
+/**
+ * @brief One recorded span.
+ */
+struct TraceEvent {
+	// Static strings only: they are read when the trace is written, possibly much later.
+	const char *name;
+	const char *category;
+	std::int64_t startNanoseconds;
+	std::int64_t durationNanoseconds;
+	// For hops, the thread that suspended the coroutine; 0 otherwise.
+	std::uint32_t fromThreadId;
+};
+
+namespace TraceDetail {
+
+// Events kept per thread, about 512 KiB. Allocated on a thread's first event.
+inline constexpr std::size_t kEventsPerThread = 16384;
+
+struct ThreadBuffer {
+	explicit ThreadBuffer(std::uint32_t id) : threadId(id), events(new TraceEvent[kEventsPerThread]) {}
+
+	const std::uint32_t threadId;
+	const std::unique_ptr<TraceEvent[]> events;
+	// Written by the owning thread only; the release store publishes the event below it.
+	std::atomic<std::size_t> count = 0;
+	std::atomic<std::uint64_t> dropped = 0;
+};
+
+struct Registry {
+	std::atomic<bool> enabled = false;
+	std::atomic<std::uint32_t> nextThreadId = 1;
+	std::mutex mutex;
+	std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+};
+
+inline Registry &registry() noexcept
+{
+	static Registry instance;
+	return instance;
+}
+
+inline std::int64_t now() noexcept
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+		       std::chrono::steady_clock::now().time_since_epoch())
+		.count();
+}
+
+// Small and stable per thread, which reads better in the viewer than native thread ids.
+inline std::uint32_t currentThreadId() noexcept
+{
+	thread_local const std::uint32_t id = registry().nextThreadId.fetch_add(1, std::memory_order_relaxed);
+	return id;
+}
+
+inline ThreadBuffer *currentBuffer()
+{
+	thread_local std::shared_ptr<ThreadBuffer> buffer;
+	if (!buffer) {
+		auto created = std::make_shared<ThreadBuffer>(currentThreadId());
+		Registry &r = registry();
+		std::scoped_lock lock(r.mutex);
+		r.buffers.push_back(created);
+		buffer = std::move(created);
+	}
+	return buffer.get();
+}
+
+inline void writeEscaped(std::ostream &out, const char *text)
+{
+	for (; *text; ++text) {
+		if (*text == '"' || *text == '\\') {
+			out << '\\';
+		}
+		out << *text;
+	}
+}
+
+} // namespace TraceDetail
+
+/**
+ * @brief Process-wide switch and sink of coroutine traces.
+ */
+class TraceRecorder {
+public:
+	/**
+	 * @brief Returns whether the tracing hooks were compiled in.
+	 */
+	static constexpr bool isCompiledIn() noexcept
+	{
+#ifdef KAITOTOKYO_ASYNC_TRACING
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	/**
+	 * @brief Starts or stops recording. Has no effect unless isCompiledIn().
+	 */
+	static void setEnabled(bool enabled) noexcept
+	{
+		TraceDetail::registry().enabled.store(enabled, std::memory_order_relaxed);
+	}
+
+	[[nodiscard]] static bool isEnabled() noexcept
+	{
+		return isCompiledIn() && TraceDetail::registry().enabled.load(std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief Appends a span to the calling thread's buffer.
+	 *
+	 * @param name A string literal or other string that outlives the recorder.
+	 * @param category Likewise.
+	 */
+	static void recordSpan(const char *name, const char *category, std::int64_t startNanoseconds,
+			       std::int64_t endNanoseconds, std::uint32_t fromThreadId = 0) noexcept
+	{
+		TraceDetail::ThreadBuffer *buffer;
+		try {
+			buffer = TraceDetail::currentBuffer();
+		} catch (...) {
+			return;
+		}
+		const std::size_t index = buffer->count.load(std::memory_order_relaxed);
+		if (index >= TraceDetail::kEventsPerThread) {
+			buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+		buffer->events[index] = TraceEvent{name, category, startNanoseconds, endNanoseconds - startNanoseconds,
+						   fromThreadId};
+		buffer->count.store(index + 1, std::memory_order_release);
+	}
+
+	/**
+	 * @brief Returns the number of events dropped because a thread's buffer was full.
+	 */
+	[[nodiscard]] static std::uint64_t droppedCount()
+	{
+		TraceDetail::Registry &r = TraceDetail::registry();
+		std::scoped_lock lock(r.mutex);
+		std::uint64_t dropped = 0;
+		for (const std::shared_ptr<TraceDetail::ThreadBuffer> &buffer : r.buffers) {
+			dropped += buffer->dropped.load(std::memory_order_relaxed);
+		}
+		return dropped;
+	}
+
+	/**
+	 * @brief Writes every published event in the Chrome trace event format.
+	 */
+	static void writeChromeTrace(std::ostream &out)
+	{
+		TraceDetail::Registry &r = TraceDetail::registry();
+		std::vector<std::shared_ptr<TraceDetail::ThreadBuffer>> buffers;
+		{
+			std::scoped_lock lock(r.mutex);
+			buffers = r.buffers;
+		}
+
+		const std::ios_base::fmtflags flags = out.flags();
+		out.setf(std::ios_base::fixed, std::ios_base::floatfield);
+		const std::streamsize precision = out.precision(3);
+
+		out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+		bool first = true;
+		for (const std::shared_ptr<TraceDetail::ThreadBuffer> &buffer : buffers) {
+			const std::size_t count = buffer->count.load(std::memory_order_acquire);
+			for (std::size_t i = 0; i < count; ++i) {
+				const TraceEvent &event = buffer->events[i];
+				out << (first ? "" : ",") << "\n{\"name\":\"";
+				TraceDetail::writeEscaped(out, event.name);
+				out << "\",\"cat\":\"";
+				TraceDetail::writeEscaped(out, event.category);
+				out << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->threadId
+				    << ",\"ts\":" << static_cast<double>(event.startNanoseconds) / 1000.0
+				    << ",\"dur\":" << static_cast<double>(event.durationNanoseconds) / 1000.0;
+				if (event.fromThreadId != 0) {
+					out << ",\"args\":{\"fromTid\":" << event.fromThreadId << "}";
+				}
+				out << "}";
+				first = false;
+			}
+		}
+		out << "\n]}\n";
+
+		out.precision(precision);
+		out.flags(flags);
+	}
+
+	/**
+	 * @brief Writes the trace to a file.
+	 * @return false if the file could not be written.
+	 */
+	static bool writeChromeTraceFile(const std::filesystem::path &path)
+	{
+		std::ofstream out(path, std::ios::binary | std::ios::trunc);
+		if (!out) {
+			return false;
+		}
+		writeChromeTrace(out);
+		out.flush();
+		return static_cast<bool>(out);
+	}
+
+	/**
+	 * @brief Discards every recorded event and the buffers of threads that have exited.
+	 *
+	 * @warning Only call while no thread is recording, such as after setEnabled(false) once the
+	 * coroutines being traced have settled.
+	 */
+	static void clear()
+	{
+		TraceDetail::Registry &r = TraceDetail::registry();
+		std::scoped_lock lock(r.mutex);
+		std::erase_if(r.buffers, [](const std::shared_ptr<TraceDetail::ThreadBuffer> &buffer) {
+			return buffer.use_count() == 1;
+		});
+		for (const std::shared_ptr<TraceDetail::ThreadBuffer> &buffer : r.buffers) {
+			buffer->count.store(0, std::memory_order_relaxed);
+			buffer->dropped.store(0, std::memory_order_relaxed);
+		}
+	}
+};
+
+#ifdef KAITOTOKYO_ASYNC_TRACING
+
+/**
+ * @brief Embedded in an awaiter to record the span between handing a coroutine over and its resume.
+ */
+struct HopTrace {
+	std::int64_t suspendedAt = -1;
+	std::uint32_t fromThreadId = 0;
+
+	// Call in await_suspend before the handle is published; afterwards the awaiter may already be gone.
+	void onSuspend() noexcept
+	{
+		if (TraceRecorder::isEnabled()) {
+			suspendedAt = TraceDetail::now();
+			fromThreadId = TraceDetail::currentThreadId();
+		}
+	}
+
+	void onResume(const char *name) noexcept
+	{
+		if (suspendedAt >= 0) {
+			TraceRecorder::recordSpan(name, "hop", suspendedAt, TraceDetail::now(), fromThreadId);
+			suspendedAt = -1;
+		}
+	}
+};
+
+/**
+ * @brief Embedded in a promise to record the span of a task from its first resume to its return.
+ */
+struct TaskTrace {
+	const char *name = "Task";
+	std::int64_t startedAt = -1;
+
+	void setName(const char *taskName) noexcept { name = taskName; }
+
+	void onStart() noexcept
+	{
+		if (TraceRecorder::isEnabled()) {
+			startedAt = TraceDetail::now();
+		}
+	}
+
+	void onFinish() noexcept
+	{
+		if (startedAt >= 0) {
+			TraceRecorder::recordSpan(name, "task", startedAt, TraceDetail::now());
+		}
+	}
+};
+
+#else
+
+struct HopTrace {
+	void onSuspend() noexcept {}
+	void onResume(const char *) noexcept {}
+};
+
+struct TaskTrace {
+	void setName(const char *) noexcept {}
+	void onStart() noexcept {}
+	void onFinish() noexcept {}
+};
+
+#endif
+
+} // namespace KaitoTokyo::Async
@@ -0,0 +1,270 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * KaitoTokyo Async Library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+/**
+ * =============================================================================
+ * KAITOTOKYO ASYNC LIBRARY - WHEN ALL
+ * =============================================================================
+ *
+ * @brief Awaits several `Task`s at once and resumes when the last one finishes.
+ *
+ * `whenAll` starts every child task in order on the awaiting thread. It does
+ * not schedule anything by itself: children that should overlap must hop to
+ * an executor (e.g. `AsyncQt::ResumeOnQThreadPool`) before doing blocking work.
+ * The awaiting coroutine resumes on the thread that completed the last child.
+ *
+ * All children always run to completion. If any of them throws, the first
+ * exception (in argument order) is rethrown after every child has finished,
+ * so no child is ever destroyed while it is still running.
+ *
+ * @section EXAMPLE Usage
+ *
+ * @code
+ * Task<void> example() {
+ *         auto [a, b] = co_await whenAll(fetchA(), fetchB());
+ * }
+ * @endcode
+ * =============================================================================
+ */
+
+#include <array>
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "Task.hpp"
+
+namespace KaitoTokyo::Async {
+
+namespace WhenAllDetail {
+
+/**
+ * @brief Counts outstanding children plus the awaiting coroutine itself.
+ *
+ * Whoever drops the count to zero resumes the continuation, which makes the
+ * start/complete race between the awaiter and the children benign.
+ */
+struct WhenAllLatch {
+	explicit WhenAllLatch(std::size_t count) noexcept : count_(count + 1) {}
+
+	bool arrive() noexcept { return count_.fetch_sub(1, std::memory_order_acq_rel) == 1; }
+
+	std::atomic<std::size_t> count_;
+	std::coroutine_handle<> continuation_ = nullptr;
+};
+
+struct [[nodiscard]] WhenAllDriver {
+	struct promise_type {
+		WhenAllLatch *latch = nullptr;
+
+		WhenAllDriver get_return_object()
+		{
+			return WhenAllDriver{std::coroutine_handle<promise_type>::from_promise(*this)};
+		}
+
+		std::suspend_always initial_suspend() noexcept { return {}; }
+
+		auto final_suspend() noexcept
+		{
+			struct FinalAwaiter {
+				bool await_ready() noexcept { return false; }
+
+				std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> h) noexcept
+				{
+					WhenAllLatch *latch = h.promise().latch;
+					if (latch->arrive()) {
+						return latch->continuation_;
+					}
+					return std::noop_coroutine();
+				}
+
+				void await_resume() noexcept {}
+			};
+			return FinalAwaiter{};
+		}
+
+		void return_void() noexcept {}
+		[[noreturn]] void unhandled_exception() noexcept { std::terminate(); }
+	};
+
+	explicit WhenAllDriver(std::coroutine_handle<promise_type> h) : handle(h) {}
+
+	~WhenAllDriver() noexcept
+	{
+		if (handle)
+			handle.destroy();
+	}
+
+	WhenAllDriver(const WhenAllDriver &) = delete;
+	WhenAllDriver &operator=(const WhenAllDriver &) = delete;
+	WhenAllDriver(WhenAllDriver &&other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+	WhenAllDriver &operator=(WhenAllDriver &&) = delete;
+
+	void start(WhenAllLatch &latch)
+	{
+		handle.promise().latch = &latch;
+		handle.resume();
+	}
+
+private:
+	std::coroutine_handle<promise_type> handle;
+};
+
+/**
+ * @brief `void` results are reported as `std::monostate` so they fit in a tuple.
+ */
+template<typename T> using WhenAllValue = std::conditional_t<std::is_void_v<T>, std::monostate, T>;
+
+template<typename T> struct WhenAllSlot {
+	std::optional<WhenAllValue<T>> value;
+	std::exception_ptr error = nullptr;
+
+	WhenAllValue<T> extract() { return std::move(*value); }
+};
+
+template<typename T> WhenAllDriver makeWhenAllDriver(Task<T> &task, WhenAllSlot<T> &slot)
+{
+	try {
+		if constexpr (std::is_void_v<T>) {
+			co_await task;
+			slot.value.emplace();
+		} else {
+			slot.value.emplace(co_await task);
+		}
+	} catch (...) {
+		slot.error = std::current_exception();
+	}
+}
+
+template<std::size_t N> struct WhenAllAwaiter {
+	WhenAllLatch &latch;
+	std::array<WhenAllDriver, N> &drivers;
+
+	bool await_ready() const noexcept { return N == 0; }
+
+	bool await_suspend(std::coroutine_handle<> h)
+	{
+		latch.continuation_ = h;
+		for (WhenAllDriver &driver : drivers) {
+			driver.start(latch);
+		}
+		return !latch.arrive();
+	}
+
+	void await_resume() const noexcept {}
+};
+
+struct WhenAllRangeAwaiter {
+	WhenAllLatch &latch;
+	std::vector<WhenAllDriver> &drivers;
+
+	bool await_ready() const noexcept { return drivers.empty(); }
+
+	bool await_suspend(std::coroutine_handle<> h)
+	{
+		latch.continuation_ = h;
+		for (WhenAllDriver &driver : drivers) {
+			driver.start(latch);
+		}
+		return !latch.arrive();
+	}
+
+	void await_resume() const noexcept {}
+};
+
+template<typename... Ts, std::size_t... Is>
+Task<std::tuple<WhenAllValue<Ts>...>> whenAllImpl(std::index_sequence<Is...>, Task<Ts>... tasks)
+{
+	std::tuple<WhenAllSlot<Ts>...> childSlots;
+	std::array<WhenAllDriver, sizeof...(Ts)> drivers{makeWhenAllDriver(tasks, std::get<Is>(childSlots))...};
+	WhenAllLatch latch(sizeof...(Ts));
+
+	co_await WhenAllAwaiter<sizeof...(Ts)>{latch, drivers};
+
+	std::exception_ptr error = nullptr;
+	((error = error ? error : std::get<Is>(childSlots).error), ...);
+	if (error) {
+		std::rethrow_exception(error);
+	}
+
+	co_return std::tuple<WhenAllValue<Ts>...>{std::get<Is>(childSlots).extract()...};
+}
+
+} // namespace WhenAllDetail
+
+/**
+ * @brief Runs all tasks and returns their results as a tuple once every one has finished.
+ *
+ * @return A task yielding `std::tuple<T...>`, with `std::monostate` in place of `void`.
+ * @throws The first exception thrown by a child, in argument order.
+ */
+template<typename... Ts> Task<std::tuple<WhenAllDetail::WhenAllValue<Ts>...>> whenAll(Task<Ts>... tasks)
+{
+	return WhenAllDetail::whenAllImpl(std::index_sequence_for<Ts...>{}, std::move(tasks)...);
+}
+
+/**
+ * @brief Runs a homogeneous range of tasks and returns their results in order.
+ *
+ * @throws The first exception thrown by a child, in range order.
+ */
+template<typename T> Task<std::vector<WhenAllDetail::WhenAllValue<T>>> whenAll(std::vector<Task<T>> tasks)
+{
+	using namespace WhenAllDetail;
+
+	std::vector<WhenAllSlot<T>> childSlots(tasks.size());
+	std::vector<WhenAllDriver> drivers;
+	drivers.reserve(tasks.size());
+	for (std::size_t i = 0; i < tasks.size(); ++i) {
+		drivers.push_back(makeWhenAllDriver(tasks[i], childSlots[i]));
+	}
+	WhenAllLatch latch(tasks.size());
+
+	co_await WhenAllRangeAwaiter{latch, drivers};
+
+	for (WhenAllSlot<T> &slot : childSlots) {
+		if (slot.error) {
+			std::rethrow_exception(slot.error);
+		}
+	}
+
+	std::vector<WhenAllValue<T>> results;
+	results.reserve(childSlots.size());
+	for (WhenAllSlot<T> &slot : childSlots) {
+		results.push_back(slot.extract());
+	}
+	co_return results;
+}
+
+} // namespace KaitoTokyo::Async
@@ -0,0 +1,405 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * KaitoTokyo Async Library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+/**
+ * =============================================================================
+ * KAITOTOKYO ASYNC LIBRARY - WORK-STEALING EXECUTOR
+ * =============================================================================
+ *
+ * @brief A pool of workers with one queue each, for many short continuations.
+ *
+ * `ThreadPoolExecutor` feeds every worker from one FIFO, so a continuation
+ * woken on one core is usually resumed on another, and every hop contends on
+ * the same lock. Here each worker owns a deque and a LIFO slot:
+ *
+ * - A coroutine handle posted from one of the executor's own workers goes to
+ *   that worker's LIFO slot and runs next on the same thread, while its frame
+ *   is still in cache. The handle it displaces moves to the back of the deque.
+ * - Handles posted from any other thread go to a shared injection queue.
+ * - An idle worker takes from its LIFO slot, then from the front of its deque,
+ *   then from the injection queue, and finally steals half of the deque of a
+ *   randomly chosen worker. A slot is stolen only when its deque is empty, so a
+ *   worker stuck in a blocking call does not hold a ready continuation back.
+ *
+ * Awaits chained inside one coroutine tree never reach the executor at all:
+ * `TaskSymmetricTransfer` resumes the awaiting coroutine inline on the thread
+ * that finished the awaited one. Only explicit hops such as
+ * `co_await ResumeOn{executor}` are scheduled.
+ *
+ * @section EXAMPLE Usage
+ *
+ * @code
+ * WorkStealingExecutor executor({.name = "continuations", .threadCount = 4});
+ *
+ * Task<void> example() {
+ *         co_await ResumeOn{executor};
+ *         // Runs on one of the four workers.
+ * }
+ * @endcode
+ * =============================================================================
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "ThreadPoolExecutor.hpp"
+
+namespace KaitoTokyo::Async {
+
+/**
+ * @brief Configuration of a WorkStealingExecutor.
+ */
+struct WorkStealingExecutorOptions {
+	// Reported in logs and metrics.
+	std::string name;
+	// Number of worker threads, each with its own queue.
+	std::size_t threadCount = 1;
+};
+
+/**
+ * @brief Counters of a WorkStealingExecutor, taken at one point in time.
+ */
+struct WorkStealingExecutorStats {
+	// Handles accepted by post().
+	std::uint64_t submitted = 0;
+	// Handles that have been resumed and returned.
+	std::uint64_t completed = 0;
+	// Handles run straight from the posting worker's LIFO slot.
+	std::uint64_t lifoRuns = 0;
+	// Handles taken from another worker's queue or slot.
+	std::uint64_t stolen = 0;
+};
+
+/**
+ * @brief A fixed-size pool of workers with per-worker queues and work stealing.
+ *
+ * `post()` may be called from any thread. The destructor stops accepting handles from other threads,
+ * lets the workers run everything already queued, including what those handles post in turn, and
+ * joins them. As with `ThreadPoolExecutor`, destroying the executor from one of its own workers
+ * detaches that worker.
+ */
+class WorkStealingExecutor {
+public:
+	/**
+	 * @throws std::invalid_argument If threadCount is zero.
+	 */
+	explicit WorkStealingExecutor(WorkStealingExecutorOptions options)
+		: state_(std::make_shared<State>(std::move(options)))
+	{
+		if (state_->options.threadCount == 0) {
+			throw std::invalid_argument("InvalidThreadCountError(WorkStealingExecutor)");
+		}
+
+		for (std::size_t i = 0; i < state_->options.threadCount; ++i) {
+			state_->queues.push_back(std::make_unique<WorkerQueue>());
+		}
+
+		threads_.reserve(state_->options.threadCount);
+		try {
+			for (std::size_t i = 0; i < state_->options.threadCount; ++i) {
+				threads_.emplace_back([this, state = state_, i]() { run(this, state, i); });
+			}
+		} catch (...) {
+			stop();
+			throw;
+		}
+	}
+
+	~WorkStealingExecutor() noexcept { stop(); }
+
+	WorkStealingExecutor(const WorkStealingExecutor &) = delete;
+	WorkStealingExecutor &operator=(const WorkStealingExecutor &) = delete;
+	WorkStealingExecutor(WorkStealingExecutor &&) = delete;
+	WorkStealingExecutor &operator=(WorkStealingExecutor &&) = delete;
+
+	/**
+	 * @brief Queues a coroutine to be resumed on one of the workers.
+	 * @throws std::logic_error If called from another thread while the executor is being destroyed.
+	 */
+	void post(std::coroutine_handle<> h)
+	{
+		State &state = *state_;
+		const Worker &worker = currentWorker();
+		if (worker.executor == this) {
+			WorkerQueue &queue = *state.queues[worker.index];
+			std::scoped_lock lock(queue.mutex);
+			if (queue.lifoSlot) {
+				queue.deque.push_back(queue.lifoSlot);
+			}
+			queue.lifoSlot = h;
+			state.pending.fetch_add(1, std::memory_order_seq_cst);
+		} else {
+			std::scoped_lock lock(state.injectionMutex);
+			if (state.stopping.load(std::memory_order_relaxed)) {
+				throw std::logic_error("ExecutorStoppedError(WorkStealingExecutor::post)");
+			}
+			state.injection.push_back(h);
+			state.pending.fetch_add(1, std::memory_order_seq_cst);
+		}
+		state.submitted.fetch_add(1, std::memory_order_relaxed);
+		wakeOne(state);
+	}
+
+	[[nodiscard]] const std::string &getName() const noexcept { return state_->options.name; }
+
+	[[nodiscard]] std::size_t getThreadCount() const noexcept { return state_->options.threadCount; }
+
+	/**
+	 * @brief Returns the current counters.
+	 */
+	[[nodiscard]] WorkStealingExecutorStats getStats() const noexcept
+	{
+		return WorkStealingExecutorStats{
+			.submitted = state_->submitted.load(std::memory_order_relaxed),
+			.completed = state_->completed.load(std::memory_order_relaxed),
+			.lifoRuns = state_->lifoRuns.load(std::memory_order_relaxed),
+			.stolen = state_->stolen.load(std::memory_order_relaxed),
+		};
+	}
+
+	/**
+	 * @brief Returns the executor whose worker is calling, or nullptr on any other thread.
+	 */
+	[[nodiscard]] static WorkStealingExecutor *current() noexcept { return currentWorker().executor; }
+
+	/**
+	 * @brief Returns the index of the calling worker within its executor. Only meaningful on a worker.
+	 */
+	[[nodiscard]] static std::size_t currentThreadIndex() noexcept { return currentWorker().index; }
+
+private:
+	// Runs from the LIFO slot in a row before the deque gets a turn, so two coroutines waking each
+	// other cannot starve the rest of the queue.
+	static constexpr int kMaxLifoRuns = 3;
+
+	struct alignas(64) WorkerQueue {
+		std::mutex mutex;
+		std::deque<std::coroutine_handle<>> deque;
+		std::coroutine_handle<> lifoSlot;
+	};
+
+	// Shared with the workers, so one that outlives a destructor running on it still has its queues.
+	struct State {
+		explicit State(WorkStealingExecutorOptions opts) : options(std::move(opts)) {}
+
+		const WorkStealingExecutorOptions options;
+		std::vector<std::unique_ptr<WorkerQueue>> queues;
+
+		std::mutex injectionMutex;
+		std::deque<std::coroutine_handle<>> injection;
+
+		// Handles queued anywhere; changed under the lock of the queue that holds them.
+		std::atomic<std::size_t> pending = 0;
+		std::atomic<bool> stopping = false;
+
+		std::mutex sleepMutex;
+		std::condition_variable sleepCv;
+		std::atomic<std::size_t> sleepers = 0;
+
+		std::atomic<std::uint64_t> submitted = 0;
+		std::atomic<std::uint64_t> completed = 0;
+		std::atomic<std::uint64_t> lifoRuns = 0;
+		std::atomic<std::uint64_t> stolen = 0;
+	};
+
+	struct Worker {
+		WorkStealingExecutor *executor = nullptr;
+		std::size_t index = 0;
+	};
+
+	static Worker &currentWorker() noexcept
+	{
+		thread_local Worker worker;
+		return worker;
+	}
+
+	static void wakeOne(State &state)
+	{
+		// Pairs with the sleeper registering before it checks pending: one of the two sees the other.
+		if (state.sleepers.load(std::memory_order_seq_cst) > 0) {
+			{
+				std::scoped_lock lock(state.sleepMutex);
+			}
+			state.sleepCv.notify_one();
+		}
+	}
+
+	void stop() noexcept
+	{
+		{
+			std::scoped_lock lock(state_->injectionMutex);
+			state_->stopping.store(true, std::memory_order_seq_cst);
+		}
+		{
+			std::scoped_lock lock(state_->sleepMutex);
+		}
+		state_->sleepCv.notify_all();
+		for (std::thread &thread : threads_) {
+			if (thread.get_id() == std::this_thread::get_id()) {
+				currentWorker().executor = nullptr;
+				thread.detach();
+			} else {
+				thread.join();
+			}
+		}
+		threads_.clear();
+	}
+
+	// Takes one handle from the worker's own queue, honoring the LIFO slot up to kMaxLifoRuns in a row.
+	static std::coroutine_handle<> popLocal(State &state, WorkerQueue &queue, int &lifoRuns)
+	{
+		std::scoped_lock lock(queue.mutex);
+		if (queue.lifoSlot && (lifoRuns < kMaxLifoRuns || queue.deque.empty())) {
+			lifoRuns++;
+			state.lifoRuns.fetch_add(1, std::memory_order_relaxed);
+			state.pending.fetch_sub(1, std::memory_order_seq_cst);
+			return std::exchange(queue.lifoSlot, nullptr);
+		}
+		lifoRuns = 0;
+		if (queue.deque.empty()) {
+			return nullptr;
+		}
+		std::coroutine_handle<> h = queue.deque.front();
+		queue.deque.pop_front();
+		state.pending.fetch_sub(1, std::memory_order_seq_cst);
+		return h;
+	}
+
+	static std::coroutine_handle<> popInjection(State &state)
+	{
+		std::scoped_lock lock(state.injectionMutex);
+		if (state.injection.empty()) {
+			return nullptr;
+		}
+		std::coroutine_handle<> h = state.injection.front();
+		state.injection.pop_front();
+		state.pending.fetch_sub(1, std::memory_order_seq_cst);
+		return h;
+	}
+
+	// Takes the older half of a random victim's deque, or its LIFO slot if the deque is empty. Runs the
+	// first handle and keeps the rest in the thief's own deque.
+	static std::coroutine_handle<> steal(State &state, std::size_t self, std::uint32_t &random)
+	{
+		const std::size_t count = state.queues.size();
+		random ^= random << 13;
+		random ^= random >> 17;
+		random ^= random << 5;
+		const std::size_t start = random % count;
+
+		std::vector<std::coroutine_handle<>> taken;
+		for (std::size_t i = 0; i < count && taken.empty(); ++i) {
+			const std::size_t victim = (start + i) % count;
+			if (victim == self) {
+				continue;
+			}
+			WorkerQueue &queue = *state.queues[victim];
+			std::scoped_lock lock(queue.mutex);
+			if (!queue.deque.empty()) {
+				const std::size_t half = (queue.deque.size() + 1) / 2;
+				taken.assign(queue.deque.begin(),
+					     queue.deque.begin() + static_cast<std::ptrdiff_t>(half));
+				queue.deque.erase(queue.deque.begin(),
+						  queue.deque.begin() + static_cast<std::ptrdiff_t>(half));
+			} else if (queue.lifoSlot) {
+				taken.push_back(std::exchange(queue.lifoSlot, nullptr));
+			}
+			if (!taken.empty()) {
+				// Only the handle run now leaves the queues; the thief's deque re-counts the rest.
+				state.pending.fetch_sub(1, std::memory_order_seq_cst);
+			}
+		}
+		if (taken.empty()) {
+			return nullptr;
+		}
+
+		state.stolen.fetch_add(taken.size(), std::memory_order_relaxed);
+		if (taken.size() > 1) {
+			WorkerQueue &own = *state.queues[self];
+			std::scoped_lock lock(own.mutex);
+			own.deque.insert(own.deque.end(), taken.begin() + 1, taken.end());
+		}
+		if (taken.size() > 2) {
+			// The thief runs the first handle itself; another idle worker may take the rest.
+			wakeOne(state);
+		}
+		return taken.front();
+	}
+
+	static void run(WorkStealingExecutor *executor, const std::shared_ptr<State> state, std::size_t index)
+	{
+		currentWorker() = Worker{executor, index};
+		WorkerQueue &own = *state->queues[index];
+		std::uint32_t random = static_cast<std::uint32_t>(index) * 2654435761u + 1;
+		int lifoRuns = 0;
+
+		for (;;) {
+			std::coroutine_handle<> h = popLocal(*state, own, lifoRuns);
+			if (!h) {
+				h = popInjection(*state);
+			}
+			if (!h) {
+				h = steal(*state, index, random);
+			}
+			if (h) {
+				h.resume();
+				state->completed.fetch_add(1, std::memory_order_relaxed);
+				continue;
+			}
+
+			std::unique_lock lock(state->sleepMutex);
+			if (state->stopping.load(std::memory_order_seq_cst) &&
+			    state->pending.load(std::memory_order_seq_cst) == 0) {
+				break;
+			}
+			state->sleepers.fetch_add(1, std::memory_order_seq_cst);
+			state->sleepCv.wait(lock, [&state]() {
+				return state->pending.load(std::memory_order_seq_cst) > 0 ||
+				       state->stopping.load(std::memory_order_seq_cst);
+			});
+			state->sleepers.fetch_sub(1, std::memory_order_seq_cst);
+		}
+
+		currentWorker() = Worker{};
+	}
+
+	const std::shared_ptr<State> state_;
+	std::vector<std::thread> threads_;
+};
+
+} // namespace KaitoTokyo::Async
@@ -30,6 +30,8 @@
 
 #include <QMetaObject>
 
+#include <KaitoTokyo/Async/Tracing.hpp>
+
 namespace KaitoTokyo::AsyncQt {
 
 /**
@@ -88,8 +90,9 @@ public:
 	 *
 	 * @param h The handle to the suspended coroutine.
 	 */
-	void await_suspend(std::coroutine_handle<> h) const
+	void await_suspend(std::coroutine_handle<> h)
 	{
+		trace_.onSuspend();
 		// Use invokeMethod with context_ as the context object.
 		// Qt handles the cleanup if context_ dies pending the event.
 		QMetaObject::invokeMethod(context_, [h]() mutable { h.resume(); }, Qt::QueuedConnection);
@@ -102,10 +105,12 @@ public:
 	 * subsequent user code will result in Undefined Behavior (likely a crash).
 	 * This "Fail Fast" behavior is intentional.
 	 */
-	void await_resume() const noexcept {}
+	void await_resume() noexcept { trace_.onResume("ResumeOnQObject"); }
 
 private:
 	QObject *context_;
+	// Empty unless tracing is compiled in, so the awaiter stays a single pointer.
+	[[no_unique_address]] Async::HopTrace trace_;
 };
 
 } // namespace KaitoTokyo::AsyncQt
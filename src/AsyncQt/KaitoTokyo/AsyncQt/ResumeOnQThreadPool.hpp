@@ -30,6 +30,8 @@
 
 #include <QThreadPool>
 
+#include <KaitoTokyo/Async/Tracing.hpp>
+
 namespace KaitoTokyo::AsyncQt {
 
 /**
@@ -82,8 +84,9 @@ public:
 	 *
 	 * @param h The handle to the suspended coroutine.
 	 */
-	void await_suspend(std::coroutine_handle<> h) const
+	void await_suspend(std::coroutine_handle<> h)
 	{
+		trace_.onSuspend();
 		// Contract: threadPool must be valid at this point.
 		// If QThreadPool::start fails (rare, e.g., if strictly limited),
 		// it is usually handled by Qt internal queuing, but exceptions here are not caught
@@ -94,10 +97,12 @@ public:
 	/**
 	 * @brief Resumes execution. No checks are performed.
 	 */
-	void await_resume() const noexcept {}
+	void await_resume() noexcept { trace_.onResume("ResumeOnQThreadPool"); }
 
 private:
 	QThreadPool *threadPool;
+	// Empty unless tracing is compiled in, so the awaiter stays a single pointer.
+	[[no_unique_address]] Async::HopTrace trace_;
 };
 
 } // namespace KaitoTokyo::AsyncQt
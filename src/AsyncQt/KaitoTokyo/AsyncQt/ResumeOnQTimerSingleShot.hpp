@@ -30,6 +30,8 @@
 #include <QObject>
 #include <QTimer>
 
+#include <KaitoTokyo/Async/Tracing.hpp>
+
 namespace KaitoTokyo::AsyncQt {
 
 class ResumeOnQTimerSingleShot {
@@ -38,16 +40,18 @@ public:
 
 	bool await_ready() const noexcept { return false; }
 
-	void await_suspend(std::coroutine_handle<> h) const
+	void await_suspend(std::coroutine_handle<> h)
 	{
+		trace_.onSuspend();
 		QTimer::singleShot(interval_, parent_, [h]() mutable { h.resume(); });
 	}
 
-	void await_resume() const noexcept {}
+	void await_resume() noexcept { trace_.onResume("ResumeOnQTimerSingleShot"); }
 
 private:
 	const int interval_;
 	QObject *const parent_;
+	[[no_unique_address]] Async::HopTrace trace_;
 };
 
 } // namespace KaitoTokyo::AsyncQt
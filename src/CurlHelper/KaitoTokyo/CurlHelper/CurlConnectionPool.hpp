@@ -0,0 +1,329 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * KaitoTokyo CurlHelper Library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <curl/curl.h>
+
+namespace KaitoTokyo::CurlHelper {
+
+class CurlTransferTape;
+
+/**
+ * Pool of curl easy handles that share DNS, TLS sessions and connections.
+ *
+ * Every request checks out its own easy handle, so one pool can serve requests
+ * from several threads at once. Handles are reset and attached to the share
+ * handle on checkout, and go back to the pool when the lease is destroyed.
+ *
+ * Each handle also carries a response buffer and a URL buffer that are kept across
+ * checkouts, so repeated requests of similar size write into memory that is already
+ * allocated. Buffers that grew beyond maxRetainedBufferBytes are released on checkin.
+ */
+class CurlConnectionPool : public std::enable_shared_from_this<CurlConnectionPool> {
+	struct CurlDeleter {
+		void operator()(CURL *ptr) const { curl_easy_cleanup(ptr); }
+	};
+
+	using unique_curl_t = std::unique_ptr<CURL, CurlDeleter>;
+
+public:
+	struct Statistics {
+		std::uint64_t checkouts;
+		std::uint64_t handlesCreated;
+		std::uint64_t transfers;
+		std::uint64_t newConnections;
+		std::uint64_t reusedConnections;
+	};
+
+	class Lease {
+	public:
+		~Lease() noexcept
+		{
+			if (pool_) {
+				pool_->checkin(std::move(curl_), std::move(responseBuffer_), std::move(urlBuffer_));
+			}
+		}
+
+		Lease(const Lease &) = delete;
+		Lease &operator=(const Lease &) = delete;
+		Lease(Lease &&) noexcept = default;
+		Lease &operator=(Lease &&) = delete;
+
+		[[nodiscard]]
+		CURL *getRaw() const noexcept
+		{
+			return curl_.get();
+		}
+
+		/**
+		 * Empty on checkout but keeps the capacity of earlier responses on this handle.
+		 */
+		[[nodiscard]]
+		std::vector<char> &getResponseBuffer() noexcept
+		{
+			return responseBuffer_;
+		}
+
+		/**
+		 * Like the response buffer, for building the request URL in.
+		 */
+		[[nodiscard]]
+		std::string &getUrlBuffer() noexcept
+		{
+			return urlBuffer_;
+		}
+
+	private:
+		friend class CurlConnectionPool;
+
+		Lease(std::shared_ptr<CurlConnectionPool> pool, unique_curl_t curl,
+		      std::vector<char> responseBuffer, std::string urlBuffer) noexcept
+			: pool_(std::move(pool)),
+			  curl_(std::move(curl)),
+			  responseBuffer_(std::move(responseBuffer)),
+			  urlBuffer_(std::move(urlBuffer))
+		{
+		}
+
+		std::shared_ptr<CurlConnectionPool> pool_;
+		unique_curl_t curl_;
+		std::vector<char> responseBuffer_;
+		std::string urlBuffer_;
+	};
+
+	explicit CurlConnectionPool(std::size_t maxIdleHandles = 8, std::size_t maxRetainedBufferBytes = 1024 * 1024)
+		: maxIdleHandles_(maxIdleHandles),
+		  maxRetainedBufferBytes_(maxRetainedBufferBytes),
+		  share_(curl_share_init())
+	{
+		if (!share_) {
+			throw std::runtime_error("CurlShareInitError(CurlConnectionPool)");
+		}
+
+		curl_share_setopt(share_, CURLSHOPT_LOCKFUNC, lockCallback);
+		curl_share_setopt(share_, CURLSHOPT_UNLOCKFUNC, unlockCallback);
+		curl_share_setopt(share_, CURLSHOPT_USERDATA, this);
+		curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+		curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+		curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+	}
+
+	~CurlConnectionPool() noexcept
+	{
+		// Easy handles must be gone before the share handle they are attached to.
+		idleHandles_.clear();
+		curl_share_cleanup(share_);
+	}
+
+	CurlConnectionPool(const CurlConnectionPool &) = delete;
+	CurlConnectionPool &operator=(const CurlConnectionPool &) = delete;
+	CurlConnectionPool(CurlConnectionPool &&) = delete;
+	CurlConnectionPool &operator=(CurlConnectionPool &&) = delete;
+
+	/**
+	 * Returns a reset easy handle attached to the share handle, preferring HTTP/2 over TLS.
+	 * The pool must be owned by a std::shared_ptr.
+	 */
+	[[nodiscard]]
+	Lease checkout()
+	{
+		unique_curl_t curl;
+		std::vector<char> responseBuffer;
+		std::string urlBuffer;
+		{
+			std::scoped_lock lock(idleMutex_);
+			if (!idleHandles_.empty()) {
+				curl = std::move(idleHandles_.back().curl);
+				responseBuffer = std::move(idleHandles_.back().responseBuffer);
+				urlBuffer = std::move(idleHandles_.back().urlBuffer);
+				idleHandles_.pop_back();
+			}
+		}
+		responseBuffer.clear();
+		urlBuffer.clear();
+
+		if (curl) {
+			curl_easy_reset(curl.get());
+		} else {
+			curl.reset(curl_easy_init());
+			if (!curl) {
+				throw std::runtime_error("CurlEasyInitError(CurlConnectionPool::checkout)");
+			}
+			handlesCreated_.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		curl_easy_setopt(curl.get(), CURLOPT_SHARE, share_);
+		curl_easy_setopt(curl.get(), CURLOPT_PRIVATE, this);
+		curl_easy_setopt(curl.get(), CURLOPT_HTTP_VERSION, static_cast<long>(CURL_HTTP_VERSION_2TLS));
+		curl_easy_setopt(curl.get(), CURLOPT_TCP_KEEPALIVE, 1L);
+
+		checkouts_.fetch_add(1, std::memory_order_relaxed);
+		return Lease(shared_from_this(), std::move(curl), std::move(responseBuffer), std::move(urlBuffer));
+	}
+
+	/**
+	 * Counts the transfer just performed on a handle checked out from a pool.
+	 * Does nothing for handles that do not belong to a pool.
+	 */
+	static void recordTransfer(CURL *curl) noexcept
+	{
+		char *privateData = nullptr;
+		if (curl_easy_getinfo(curl, CURLINFO_PRIVATE, &privateData) != CURLE_OK || !privateData) {
+			return;
+		}
+
+		long newConnections = 0;
+		if (curl_easy_getinfo(curl, CURLINFO_NUM_CONNECTS, &newConnections) != CURLE_OK) {
+			return;
+		}
+
+		auto *pool = reinterpret_cast<CurlConnectionPool *>(privateData);
+		pool->transfers_.fetch_add(1, std::memory_order_relaxed);
+		if (newConnections > 0) {
+			pool->newConnections_.fetch_add(static_cast<std::uint64_t>(newConnections),
+							std::memory_order_relaxed);
+		} else {
+			pool->reusedConnections_.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	/**
+	 * Records or replays every transfer made through CurlTransferAwaiter on handles of this pool.
+	 * A null tape sends them to the network again.
+	 */
+	void setTransferTape(std::shared_ptr<CurlTransferTape> tape)
+	{
+		std::scoped_lock lock(tapeMutex_);
+		tape_ = std::move(tape);
+	}
+
+	/**
+	 * Returns the tape of the pool the handle belongs to, or null.
+	 */
+	[[nodiscard]]
+	static std::shared_ptr<CurlTransferTape> getTransferTape(CURL *curl)
+	{
+		char *privateData = nullptr;
+		if (curl_easy_getinfo(curl, CURLINFO_PRIVATE, &privateData) != CURLE_OK || !privateData) {
+			return nullptr;
+		}
+
+		auto *pool = reinterpret_cast<CurlConnectionPool *>(privateData);
+		std::scoped_lock lock(pool->tapeMutex_);
+		return pool->tape_;
+	}
+
+	[[nodiscard]]
+	Statistics getStatistics() const noexcept
+	{
+		return {
+			.checkouts = checkouts_.load(std::memory_order_relaxed),
+			.handlesCreated = handlesCreated_.load(std::memory_order_relaxed),
+			.transfers = transfers_.load(std::memory_order_relaxed),
+			.newConnections = newConnections_.load(std::memory_order_relaxed),
+			.reusedConnections = reusedConnections_.load(std::memory_order_relaxed),
+		};
+	}
+
+private:
+	void checkin(unique_curl_t curl, std::vector<char> responseBuffer, std::string urlBuffer) noexcept
+	{
+		if (!curl) {
+			return;
+		}
+
+		if (responseBuffer.capacity() > maxRetainedBufferBytes_) {
+			responseBuffer = std::vector<char>();
+		}
+		if (urlBuffer.capacity() > maxRetainedBufferBytes_) {
+			urlBuffer = std::string();
+		}
+
+		std::scoped_lock lock(idleMutex_);
+		if (idleHandles_.size() < maxIdleHandles_) {
+			try {
+				idleHandles_.push_back(
+					{std::move(curl), std::move(responseBuffer), std::move(urlBuffer)});
+			} catch (...) {
+				// The handle is dropped; the next checkout creates a new one.
+			}
+		}
+	}
+
+	static void lockCallback(CURL *, curl_lock_data data, curl_lock_access, void *userptr) noexcept
+	{
+		static_cast<CurlConnectionPool *>(userptr)->shareMutexes_[shareMutexIndex(data)].lock();
+	}
+
+	static void unlockCallback(CURL *, curl_lock_data data, void *userptr) noexcept
+	{
+		static_cast<CurlConnectionPool *>(userptr)->shareMutexes_[shareMutexIndex(data)].unlock();
+	}
+
+	static std::size_t shareMutexIndex(curl_lock_data data) noexcept
+	{
+		const auto index = static_cast<std::size_t>(data);
+		return index < kShareMutexCount ? index : 0;
+	}
+
+	static constexpr std::size_t kShareMutexCount = CURL_LOCK_DATA_LAST;
+
+	struct IdleHandle {
+		unique_curl_t curl;
+		std::vector<char> responseBuffer;
+		std::string urlBuffer;
+	};
+
+	const std::size_t maxIdleHandles_;
+	const std::size_t maxRetainedBufferBytes_;
+	CURLSH *const share_;
+	std::array<std::mutex, kShareMutexCount> shareMutexes_;
+
+	std::mutex idleMutex_;
+	std::vector<IdleHandle> idleHandles_;
+
+	std::mutex tapeMutex_;
+	std::shared_ptr<CurlTransferTape> tape_;
+
+	std::atomic<std::uint64_t> checkouts_{0};
+	std::atomic<std::uint64_t> handlesCreated_{0};
+	std::atomic<std::uint64_t> transfers_{0};
+	std::atomic<std::uint64_t> newConnections_{0};
+	std::atomic<std::uint64_t> reusedConnections_{0};
+};
+
+} // namespace KaitoTokyo::CurlHelper
@@ -0,0 +1,93 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * KaitoTokyo CurlHelper Library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#include <curl/curl.h>
+
+namespace KaitoTokyo::CurlHelper {
+
+namespace CurlHeaderCallbackDetail {
+
+inline bool startsWithIgnoringAsciiCase(std::string_view s, std::string_view lowercasePrefix) noexcept
+{
+	if (s.size() < lowercasePrefix.size()) {
+		return false;
+	}
+	for (std::size_t i = 0; i < lowercasePrefix.size(); ++i) {
+		const char c = s[i] >= 'A' && s[i] <= 'Z' ? static_cast<char>(s[i] - 'A' + 'a') : s[i];
+		if (c != lowercasePrefix[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+} // namespace CurlHeaderCallbackDetail
+
+/**
+ * CURLOPT_HEADERFUNCTION callback that reserves the std::vector<char> passed as CURLOPT_HEADERDATA
+ * for the announced Content-Length, so the body is appended without reallocating. The reservation
+ * is capped so that a bogus header cannot force a huge allocation.
+ */
+inline std::size_t CurlContentLengthReserveHeaderCallback(char *buffer, std::size_t size, std::size_t nitems,
+							  void *userp) noexcept
+{
+	constexpr std::string_view kContentLength = "content-length:";
+	constexpr std::size_t kMaxReserveBytes = 64 * 1024 * 1024;
+
+	const std::size_t totalSize = size * nitems;
+	const std::string_view header(buffer, totalSize);
+
+	if (!CurlHeaderCallbackDetail::startsWithIgnoringAsciiCase(header, kContentLength)) {
+		return totalSize;
+	}
+
+	std::string_view value = header.substr(kContentLength.size());
+	value.remove_prefix(std::min(value.find_first_not_of(" \t"), value.size()));
+
+	std::size_t contentLength = 0;
+	const auto [end, ec] = std::from_chars(value.data(), value.data() + value.size(), contentLength);
+	if (ec != std::errc() || end == value.data()) {
+		return totalSize;
+	}
+
+	try {
+		auto *vec = static_cast<std::vector<char> *>(userp);
+		vec->reserve(vec->size() + std::min(contentLength, kMaxReserveBytes));
+	} catch (...) {
+		// Reserving is only an optimization; the write callback still grows the buffer as needed.
+	}
+
+	return totalSize;
+}
+
+} // namespace KaitoTokyo::CurlHelper
@@ -0,0 +1,213 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * KaitoTokyo CurlHelper Library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <coroutine>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <curl/curl.h>
+
+namespace KaitoTokyo::CurlHelper {
+
+/**
+ * Runs curl easy handles on one multi handle driven by a dedicated poll thread.
+ *
+ * Awaiting perform() suspends the coroutine without blocking any thread until the
+ * transfer finishes, so many requests can be in flight at once. The coroutine is
+ * resumed on the poll thread; hop to another executor before doing blocking work,
+ * as everything resumed there delays the other transfers.
+ *
+ * Transfers still running when the executor is destroyed complete with
+ * CURLE_ABORTED_BY_CALLBACK. Do not destroy the executor from its own poll thread.
+ */
+class CurlMultiExecutor {
+public:
+	class PerformAwaiter {
+	public:
+		/**
+		 * A null executor performs the transfer inline on the awaiting thread.
+		 */
+		PerformAwaiter(CurlMultiExecutor *executor, CURL *curl) noexcept : executor_(executor), curl_(curl) {}
+
+		bool await_ready() noexcept
+		{
+			if (executor_) {
+				return false;
+			}
+			result_ = curl_easy_perform(curl_);
+			return true;
+		}
+
+		bool await_suspend(std::coroutine_handle<> handle)
+		{
+			handle_ = handle;
+			return executor_->submit(*this);
+		}
+
+		CURLcode await_resume() const noexcept { return result_; }
+
+	private:
+		friend class CurlMultiExecutor;
+
+		CurlMultiExecutor *const executor_;
+		CURL *const curl_;
+		std::coroutine_handle<> handle_;
+		CURLcode result_ = CURLE_OK;
+	};
+
+	CurlMultiExecutor() : multi_(curl_multi_init())
+	{
+		if (!multi_) {
+			throw std::runtime_error("CurlMultiInitError(CurlMultiExecutor)");
+		}
+
+		thread_ = std::thread([this]() { run(); });
+	}
+
+	~CurlMultiExecutor() noexcept
+	{
+		{
+			std::scoped_lock lock(mutex_);
+			stopping_ = true;
+		}
+		curl_multi_wakeup(multi_);
+		thread_.join();
+		curl_multi_cleanup(multi_);
+	}
+
+	CurlMultiExecutor(const CurlMultiExecutor &) = delete;
+	CurlMultiExecutor &operator=(const CurlMultiExecutor &) = delete;
+	CurlMultiExecutor(CurlMultiExecutor &&) = delete;
+	CurlMultiExecutor &operator=(CurlMultiExecutor &&) = delete;
+
+	/**
+	 * Returns an awaitable that performs the transfer configured on curl and yields its CURLcode.
+	 * The handle must stay untouched until the awaiting coroutine is resumed.
+	 */
+	[[nodiscard]]
+	PerformAwaiter perform(CURL *curl) noexcept
+	{
+		return PerformAwaiter(this, curl);
+	}
+
+private:
+	// Returns false when the executor is stopping and the awaiter should not suspend.
+	bool submit(PerformAwaiter &awaiter)
+	{
+		{
+			std::scoped_lock lock(mutex_);
+			if (stopping_) {
+				awaiter.result_ = CURLE_ABORTED_BY_CALLBACK;
+				return false;
+			}
+			submitted_.push_back(&awaiter);
+		}
+		curl_multi_wakeup(multi_);
+		return true;
+	}
+
+	static void complete(PerformAwaiter *awaiter, CURLcode result) noexcept
+	{
+		awaiter->result_ = result;
+		awaiter->handle_.resume();
+	}
+
+	void run() noexcept
+	{
+		constexpr int kPollTimeoutMilliseconds = 1000;
+
+		std::unordered_map<CURL *, PerformAwaiter *> running;
+		std::vector<PerformAwaiter *> submitted;
+
+		for (;;) {
+			{
+				std::scoped_lock lock(mutex_);
+				if (stopping_) {
+					break;
+				}
+				submitted.swap(submitted_);
+			}
+
+			for (PerformAwaiter *awaiter : submitted) {
+				if (curl_multi_add_handle(multi_, awaiter->curl_) != CURLM_OK) {
+					complete(awaiter, CURLE_FAILED_INIT);
+					continue;
+				}
+				running.emplace(awaiter->curl_, awaiter);
+			}
+			submitted.clear();
+
+			int runningHandles = 0;
+			curl_multi_perform(multi_, &runningHandles);
+
+			int queuedMessages = 0;
+			while (CURLMsg *message = curl_multi_info_read(multi_, &queuedMessages)) {
+				if (message->msg != CURLMSG_DONE) {
+					continue;
+				}
+
+				CURL *curl = message->easy_handle;
+				const CURLcode result = message->data.result;
+				curl_multi_remove_handle(multi_, curl);
+
+				if (auto it = running.find(curl); it != running.end()) {
+					PerformAwaiter *awaiter = it->second;
+					running.erase(it);
+					complete(awaiter, result);
+				}
+			}
+
+			curl_multi_poll(multi_, nullptr, 0, kPollTimeoutMilliseconds, nullptr);
+		}
+
+		for (auto &[curl, awaiter] : running) {
+			curl_multi_remove_handle(multi_, curl);
+			complete(awaiter, CURLE_ABORTED_BY_CALLBACK);
+		}
+
+		{
+			std::scoped_lock lock(mutex_);
+			submitted.swap(submitted_);
+		}
+		for (PerformAwaiter *awaiter : submitted) {
+			complete(awaiter, CURLE_ABORTED_BY_CALLBACK);
+		}
+	}
+
+	CURLM *const multi_;
+	std::thread thread_;
+
+	std::mutex mutex_;
+	bool stopping_ = false;
+	std::vector<PerformAwaiter *> submitted_;
+};
+
+} // namespace KaitoTokyo::CurlHelper
@@ -0,0 +1,112 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * KaitoTokyo CurlHelper Library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <coroutine>
+#include <memory>
+
+#include <curl/curl.h>
+
+#include "CurlConnectionPool.hpp"
+#include "CurlMultiExecutor.hpp"
+#include "CurlTransferTape.hpp"
+
+namespace KaitoTokyo::CurlHelper {
+
+/**
+ * Performs a transfer through the CurlTransferTape of the handle's pool, if it has one.
+ *
+ * Sets the options described by the transfer on the handle and performs it like
+ * CurlMultiExecutor::PerformAwaiter, then counts it with CurlConnectionPool::recordTransfer() and
+ * yields the CURLcode with the response code. Callers must take the response code from the result
+ * rather than from the handle, as a replayed transfer never touches the handle.
+ */
+class CurlTransferAwaiter {
+public:
+	/**
+	 * A null executor performs the transfer inline on the awaiting thread.
+	 */
+	CurlTransferAwaiter(CurlMultiExecutor *executor, CURL *curl, const CurlTransfer &transfer)
+		: curl_(curl),
+		  transfer_(transfer),
+		  tape_(CurlConnectionPool::getTransferTape(curl)),
+		  perform_(executor, curl)
+	{
+	}
+
+	CurlTransferAwaiter(const CurlTransferAwaiter &) = delete;
+	CurlTransferAwaiter &operator=(const CurlTransferAwaiter &) = delete;
+
+	bool await_ready()
+	{
+		if (tape_ && tape_->isReplaying()) {
+			result_ = tape_->replay(transfer_);
+			replayed_ = true;
+			return true;
+		}
+
+		applyCurlTransfer(curl_, tape_ ? tape_->beginRecording(transfer_, capture_) : transfer_);
+		return perform_.await_ready();
+	}
+
+	bool await_suspend(std::coroutine_handle<> handle) { return perform_.await_suspend(handle); }
+
+	CurlTransferResult await_resume() noexcept
+	{
+		if (replayed_) {
+			return result_;
+		}
+
+		result_.code = perform_.await_resume();
+		CurlConnectionPool::recordTransfer(curl_);
+		curl_easy_getinfo(curl_, CURLINFO_RESPONSE_CODE, &result_.responseCode);
+		if (tape_) {
+			tape_->finishRecording(capture_, result_);
+		}
+		return result_;
+	}
+
+private:
+	CURL *const curl_;
+	const CurlTransfer transfer_;
+	const std::shared_ptr<CurlTransferTape> tape_;
+	CurlMultiExecutor::PerformAwaiter perform_;
+	CurlTransferTape::Capture capture_;
+	CurlTransferResult result_;
+	bool replayed_ = false;
+};
+
+/**
+ * Performs a transfer inline on the calling thread, through the tape of the handle's pool if it has one.
+ */
+inline CurlTransferResult performCurlTransfer(CURL *curl, const CurlTransfer &transfer)
+{
+	CurlTransferAwaiter awaiter(nullptr, curl, transfer);
+	awaiter.await_ready();
+	return awaiter.await_resume();
+}
+
+} // namespace KaitoTokyo::CurlHelper
@@ -0,0 +1,528 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * KaitoTokyo CurlHelper Library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <curl/curl.h>
+#include <nlohmann/json.hpp>
+
+#include "CurlHeaderCallback.hpp"
+
+namespace KaitoTokyo::CurlHelper {
+
+using CurlTransferWriteFunction = std::size_t (*)(void *contents, std::size_t size, std::size_t nmemb, void *userp);
+using CurlTransferHeaderFunction = std::size_t (*)(char *buffer, std::size_t size, std::size_t nitems, void *userp);
+
+/**
+ * The parts of a request that a CurlTransferTape records and replays. Everything else, such as
+ * timeouts and redirects, is still set on the handle directly.
+ */
+struct CurlTransfer {
+	// "GET", "POST" or "PUT".
+	const char *method = "GET";
+	const char *url = nullptr;
+	curl_slist *headers = nullptr;
+	// Sent by POST and PUT straight from the caller's memory, which must outlive the transfer.
+	std::span<const char> body = {};
+	CurlTransferWriteFunction writeFunction = nullptr;
+	void *writeData = nullptr;
+	// Optional; without one response headers are discarded.
+	CurlTransferHeaderFunction headerFunction = nullptr;
+	void *headerData = nullptr;
+};
+
+struct CurlTransferResult {
+	CURLcode code = CURLE_OK;
+	long responseCode = 0;
+};
+
+/**
+ * Sets the options described by transfer on curl.
+ */
+inline void applyCurlTransfer(CURL *curl, const CurlTransfer &transfer) noexcept
+{
+	const std::string_view method(transfer.method);
+
+	curl_easy_setopt(curl, CURLOPT_URL, transfer.url);
+	curl_easy_setopt(curl, CURLOPT_HTTPHEADER, transfer.headers);
+	if (method != "GET") {
+		if (method == "POST") {
+			curl_easy_setopt(curl, CURLOPT_POST, 1L);
+		} else {
+			curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, transfer.method);
+		}
+		curl_easy_setopt(curl, CURLOPT_POSTFIELDS, transfer.body.empty() ? "" : transfer.body.data());
+		curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE_LARGE, static_cast<curl_off_t>(transfer.body.size()));
+	}
+
+	curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, transfer.writeFunction);
+	curl_easy_setopt(curl, CURLOPT_WRITEDATA, transfer.writeData);
+	curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, transfer.headerFunction);
+	curl_easy_setopt(curl, CURLOPT_HEADERDATA, transfer.headerData);
+}
+
+namespace CurlTransferTapeDetail {
+
+constexpr std::string_view kRedacted = "REDACTED";
+
+// Query and form parameters that grant access on their own.
+inline bool isSecretParameter(std::string_view name) noexcept
+{
+	constexpr std::array<std::string_view, 7> kNames{
+		"access_token", "client_secret", "code", "code_verifier", "key", "refresh_token", "upload_id"};
+	return std::find(kNames.begin(), kNames.end(), name) != kNames.end();
+}
+
+// JSON members that hold credentials, including the stream key of a live stream.
+inline bool isSecretMember(std::string_view name) noexcept
+{
+	constexpr std::array<std::string_view, 5> kNames{"access_token", "client_secret", "id_token",
+							 "refresh_token", "streamName"};
+	return std::find(kNames.begin(), kNames.end(), name) != kNames.end();
+}
+
+// Redacts the secret parameters of an application/x-www-form-urlencoded string.
+inline std::string redactParameters(std::string_view parameters)
+{
+	std::string redacted;
+	redacted.reserve(parameters.size());
+	while (true) {
+		const std::size_t end = std::min(parameters.find('&'), parameters.size());
+		const std::string_view parameter = parameters.substr(0, end);
+		const std::size_t equals = parameter.find('=');
+		if (equals != std::string_view::npos && isSecretParameter(parameter.substr(0, equals))) {
+			redacted.append(parameter.substr(0, equals + 1)).append(kRedacted);
+		} else {
+			redacted.append(parameter);
+		}
+		if (end == parameters.size()) {
+			return redacted;
+		}
+		redacted.push_back('&');
+		parameters.remove_prefix(end + 1);
+	}
+}
+
+inline bool redactJson(nlohmann::json &j)
+{
+	bool redacted = false;
+	if (j.is_object()) {
+		for (auto &[name, value] : j.items()) {
+			if (value.is_string() && isSecretMember(name)) {
+				value = kRedacted;
+				redacted = true;
+			} else {
+				redacted = redactJson(value) || redacted;
+			}
+		}
+	} else if (j.is_array()) {
+		for (nlohmann::json &element : j) {
+			redacted = redactJson(element) || redacted;
+		}
+	}
+	return redacted;
+}
+
+// Lines without their line break.
+inline std::vector<std::string> splitLines(std::string_view text)
+{
+	std::vector<std::string> lines;
+	while (!text.empty()) {
+		const std::size_t end = std::min(text.find('\n'), text.size());
+		std::string_view line = text.substr(0, end);
+		if (!line.empty() && line.back() == '\r') {
+			line.remove_suffix(1);
+		}
+		lines.emplace_back(line);
+		text.remove_prefix(std::min(end + 1, text.size()));
+	}
+	return lines;
+}
+
+} // namespace CurlTransferTapeDetail
+
+/**
+ * Records HTTP transfers to a file, or answers them from one.
+ *
+ * A tape installed on a CurlConnectionPool sees every transfer made through CurlTransferAwaiter or
+ * performCurlTransfer() on the handles of that pool. In record mode the transfers go to the network
+ * as usual, and each one is appended to the file as one JSON object per line once it finishes: the
+ * request, the result, the response headers and body, and how long it took. In replay mode nothing
+ * is sent; every transfer is answered with the next recorded response for the same method and URL,
+ * after the recorded duration multiplied by timeScale, so API-layer changes can be measured against
+ * production-shaped traffic without touching the quota.
+ *
+ * Secrets are redacted before anything is written: credential headers, secret query and form
+ * parameters such as tokens and upload session ids, and token and stream key members of JSON bodies.
+ * URLs are matched after redaction, so a replayed session URL still finds its recording. Request
+ * bodies larger than kMaxRecordedRequestBodyBytes, such as thumbnails, are recorded by size only.
+ *
+ * Replayed transfers complete on the calling thread, which sleeps for the scaled duration.
+ */
+class CurlTransferTape {
+public:
+	enum class Mode { Record, Replay };
+
+	static constexpr std::size_t kMaxRecordedRequestBodyBytes = 64 * 1024;
+
+	/**
+	 * Everything the tape keeps of one transfer between beginRecording() and finishRecording().
+	 */
+	struct Capture {
+		CurlTransfer original;
+		std::string responseHeaders;
+		std::string responseBody;
+		std::chrono::steady_clock::time_point startedAt;
+	};
+
+	/**
+	 * Record mode truncates the file. Replay mode reads all of it now.
+	 * @throws std::runtime_error If the file cannot be opened or a replayed line is malformed.
+	 */
+	CurlTransferTape(Mode mode, const std::filesystem::path &path, double timeScale = 1.0)
+		: mode_(mode),
+		  timeScale_(timeScale),
+		  createdAt_(std::chrono::steady_clock::now())
+	{
+		if (mode_ == Mode::Record) {
+#ifdef _WIN32
+			file_.reset(_wfopen(path.c_str(), L"wb"));
+#else
+			file_.reset(std::fopen(path.c_str(), "wb"));
+#endif
+			if (!file_) {
+				throw std::runtime_error("FileOpenError(CurlTransferTape)");
+			}
+			return;
+		}
+
+		std::ifstream ifs(path, std::ios::binary);
+		if (!ifs) {
+			throw std::runtime_error("FileOpenError(CurlTransferTape)");
+		}
+		std::string line;
+		while (std::getline(ifs, line)) {
+			if (line.empty()) {
+				continue;
+			}
+			try {
+				Entry entry = parseEntry(nlohmann::json::parse(line));
+				std::string key = makeKey(entry.method, entry.url);
+				recordings_[std::move(key)].entries.push_back(std::move(entry));
+			} catch (const nlohmann::json::exception &) {
+				throw std::runtime_error("MalformedRecordError(CurlTransferTape)");
+			}
+		}
+	}
+
+	CurlTransferTape(const CurlTransferTape &) = delete;
+	CurlTransferTape &operator=(const CurlTransferTape &) = delete;
+	CurlTransferTape(CurlTransferTape &&) = delete;
+	CurlTransferTape &operator=(CurlTransferTape &&) = delete;
+
+	bool isReplaying() const noexcept { return mode_ == Mode::Replay; }
+
+	/**
+	 * Returns a copy of transfer whose callbacks also copy the response into capture, which must stay
+	 * in place until finishRecording().
+	 */
+	CurlTransfer beginRecording(const CurlTransfer &transfer, Capture &capture) const
+	{
+		capture.original = transfer;
+		capture.responseHeaders.clear();
+		capture.responseBody.clear();
+		capture.startedAt = std::chrono::steady_clock::now();
+
+		CurlTransfer recorded = transfer;
+		recorded.writeFunction = recordWrite;
+		recorded.writeData = &capture;
+		recorded.headerFunction = recordHeader;
+		recorded.headerData = &capture;
+		return recorded;
+	}
+
+	/**
+	 * Appends the captured transfer to the file. Failures to write are ignored; the transfer itself
+	 * has already succeeded or failed on its own.
+	 */
+	void finishRecording(const Capture &capture, const CurlTransferResult &result) const noexcept
+	{
+		const auto finishedAt = std::chrono::steady_clock::now();
+		try {
+			const CurlTransfer &transfer = capture.original;
+
+			nlohmann::json j;
+			j["method"] = transfer.method;
+			j["url"] = redactUrl(transfer.url ? transfer.url : "");
+			nlohmann::json requestHeaders = nlohmann::json::array();
+			for (const curl_slist *header = transfer.headers; header; header = header->next) {
+				requestHeaders.push_back(redactHeader(header->data));
+			}
+			if (!requestHeaders.empty()) {
+				j["requestHeaders"] = std::move(requestHeaders);
+			}
+			if (!transfer.body.empty()) {
+				j["requestBodySize"] = transfer.body.size();
+				if (transfer.body.size() <= kMaxRecordedRequestBodyBytes) {
+					j["requestBody"] = redactBody({transfer.body.data(), transfer.body.size()});
+				}
+			}
+			if (result.code != CURLE_OK) {
+				j["result"] = static_cast<int>(result.code);
+			}
+			j["responseCode"] = result.responseCode;
+			nlohmann::json responseHeaders = nlohmann::json::array();
+			for (const std::string &header : CurlTransferTapeDetail::splitLines(capture.responseHeaders)) {
+				responseHeaders.push_back(redactHeader(header));
+			}
+			j["responseHeaders"] = std::move(responseHeaders);
+			j["responseBody"] = redactBody(capture.responseBody);
+			j["startMilliseconds"] = std::chrono::duration_cast<std::chrono::milliseconds>(
+							 capture.startedAt - createdAt_)
+							 .count();
+			j["durationMicroseconds"] =
+				std::chrono::duration_cast<std::chrono::microseconds>(finishedAt - capture.startedAt)
+					.count();
+
+			std::string line = j.dump(-1, ' ', false, nlohmann::json::error_handler_t::replace);
+			line.push_back('\n');
+
+			std::scoped_lock lock(mutex_);
+			std::fwrite(line.data(), 1, line.size(), file_.get());
+			std::fflush(file_.get());
+		} catch (...) {
+			// The recording of this transfer is lost.
+		}
+	}
+
+	/**
+	 * Answers transfer with the next recorded response for its method and URL, starting over after
+	 * the last one, through the callbacks of transfer.
+	 * @throws std::runtime_error If nothing was recorded for the method and URL.
+	 */
+	CurlTransferResult replay(const CurlTransfer &transfer) const
+	{
+		const Entry *entry = nullptr;
+		{
+			std::scoped_lock lock(mutex_);
+			const auto it = recordings_.find(makeKey(transfer.method, transfer.url ? transfer.url : ""));
+			if (it == recordings_.end()) {
+				throw std::runtime_error("TransferNotRecordedError(CurlTransferTape::replay)");
+			}
+			Recordings &recordings = it->second;
+			entry = &recordings.entries[recordings.next];
+			recordings.next = (recordings.next + 1) % recordings.entries.size();
+		}
+
+		if (timeScale_ > 0.0) {
+			std::this_thread::sleep_for(std::chrono::duration_cast<std::chrono::microseconds>(
+				std::chrono::duration<double, std::micro>(static_cast<double>(entry->duration.count()) *
+									  timeScale_)));
+		}
+
+		const CurlTransferResult result{entry->result, entry->responseCode};
+		if (transfer.headerFunction) {
+			for (const std::string &header : entry->responseHeaders) {
+				std::string line = header + "\r\n";
+				const std::size_t accepted =
+					transfer.headerFunction(line.data(), 1, line.size(), transfer.headerData);
+				if (accepted != line.size()) {
+					return {CURLE_WRITE_ERROR, result.responseCode};
+				}
+			}
+		}
+		// Handed over in pieces no larger than curl's, so callbacks see the same pattern of writes.
+		std::string body = entry->responseBody;
+		for (std::size_t offset = 0; offset < body.size() && transfer.writeFunction;) {
+			const std::size_t size = std::min<std::size_t>(body.size() - offset, CURL_MAX_WRITE_SIZE);
+			if (transfer.writeFunction(body.data() + offset, 1, size, transfer.writeData) != size) {
+				return {CURLE_WRITE_ERROR, result.responseCode};
+			}
+			offset += size;
+		}
+		return result;
+	}
+
+	/**
+	 * Replaces the values of secret query parameters.
+	 */
+	static std::string redactUrl(std::string_view url)
+	{
+		const std::size_t query = url.find('?');
+		if (query == std::string_view::npos) {
+			return std::string(url);
+		}
+		const std::size_t fragment = std::min(url.find('#', query), url.size());
+		std::string redacted(url.substr(0, query + 1));
+		redacted.append(CurlTransferTapeDetail::redactParameters(url.substr(query + 1, fragment - query - 1)));
+		redacted.append(url.substr(fragment));
+		return redacted;
+	}
+
+	/**
+	 * Replaces the values of credential headers, and redacts the URL of a Location header.
+	 */
+	static std::string redactHeader(std::string_view header)
+	{
+		using CurlHeaderCallbackDetail::startsWithIgnoringAsciiCase;
+
+		constexpr std::array<std::string_view, 5> kSecretHeaders{
+			"authorization:", "cookie:", "proxy-authorization:", "set-cookie:", "x-goog-api-key:"};
+		for (const std::string_view name : kSecretHeaders) {
+			if (startsWithIgnoringAsciiCase(header, name)) {
+				return std::string(header.substr(0, name.size())) + " " +
+				       std::string(CurlTransferTapeDetail::kRedacted);
+			}
+		}
+
+		constexpr std::string_view kLocation = "location:";
+		if (startsWithIgnoringAsciiCase(header, kLocation)) {
+			return std::string(header.substr(0, kLocation.size())) +
+			       redactUrl(header.substr(kLocation.size()));
+		}
+		return std::string(header);
+	}
+
+	/**
+	 * Redacts secret members of a JSON body or secret parameters of a form body. A JSON body is only
+	 * reformatted when something was redacted.
+	 */
+	static std::string redactBody(std::string_view body)
+	{
+		nlohmann::json j = nlohmann::json::parse(body, nullptr, false);
+		if (!j.is_discarded()) {
+			return CurlTransferTapeDetail::redactJson(j) ? j.dump(2) : std::string(body);
+		}
+		const bool looksLikeForm = body.find('=') != std::string_view::npos &&
+					   body.find_first_of(" \t\r\n{") == std::string_view::npos;
+		if (looksLikeForm) {
+			return CurlTransferTapeDetail::redactParameters(body);
+		}
+		return std::string(body);
+	}
+
+private:
+	struct FileCloser {
+		void operator()(std::FILE *file) const noexcept { std::fclose(file); }
+	};
+
+	struct Entry {
+		std::string method;
+		std::string url;
+		CURLcode result = CURLE_OK;
+		long responseCode = 0;
+		std::vector<std::string> responseHeaders;
+		std::string responseBody;
+		std::chrono::microseconds duration{0};
+	};
+
+	struct Recordings {
+		std::vector<Entry> entries;
+		std::size_t next = 0;
+	};
+
+	static std::string makeKey(std::string_view method, std::string_view url)
+	{
+		return std::string(method) + ' ' + redactUrl(url);
+	}
+
+	static Entry parseEntry(const nlohmann::json &j)
+	{
+		Entry entry;
+		entry.method = j.at("method").get<std::string>();
+		entry.url = j.at("url").get<std::string>();
+		entry.result = static_cast<CURLcode>(j.value("result", 0));
+		entry.responseCode = j.value("responseCode", 0L);
+		entry.responseHeaders = j.value("responseHeaders", std::vector<std::string>{});
+		entry.responseBody = j.value("responseBody", std::string());
+		entry.duration = std::chrono::microseconds(j.value("durationMicroseconds", std::int64_t{0}));
+		return entry;
+	}
+
+	static std::size_t recordWrite(void *contents, std::size_t size, std::size_t nmemb, void *userp) noexcept
+	{
+		auto *capture = static_cast<Capture *>(userp);
+		const std::size_t totalSize = size * nmemb;
+		const std::size_t accepted =
+			capture->original.writeFunction
+				? capture->original.writeFunction(contents, size, nmemb, capture->original.writeData)
+				: totalSize;
+		if (accepted == totalSize) {
+			try {
+				capture->responseBody.append(static_cast<const char *>(contents), totalSize);
+			} catch (...) {
+				// Only the recording is incomplete.
+			}
+		}
+		return accepted;
+	}
+
+	static std::size_t recordHeader(char *buffer, std::size_t size, std::size_t nitems, void *userp) noexcept
+	{
+		auto *capture = static_cast<Capture *>(userp);
+		const std::size_t totalSize = size * nitems;
+		const std::size_t accepted =
+			capture->original.headerFunction
+				? capture->original.headerFunction(buffer, size, nitems, capture->original.headerData)
+				: totalSize;
+		if (accepted == totalSize) {
+			try {
+				capture->responseHeaders.append(buffer, totalSize);
+			} catch (...) {
+				// Only the recording is incomplete.
+			}
+		}
+		return accepted;
+	}
+
+	const Mode mode_;
+	const double timeScale_;
+	const std::chrono::steady_clock::time_point createdAt_;
+
+	mutable std::mutex mutex_;
+	std::unique_ptr<std::FILE, FileCloser> file_;
+	mutable std::map<std::string, Recordings> recordings_;
+};
+
+} // namespace KaitoTokyo::CurlHelper
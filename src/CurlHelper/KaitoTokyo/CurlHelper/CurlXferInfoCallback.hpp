@@ -0,0 +1,51 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * KaitoTokyo CurlHelper Library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <functional>
+
+#include <curl/curl.h>
+
+namespace KaitoTokyo::CurlHelper {
+
+/**
+ * CURLOPT_XFERINFOFUNCTION that aborts the transfer once a predicate returns true.
+ * clientp must point to a std::function<bool()> that outlives the transfer. libcurl calls this
+ * frequently during transfers and about once per second while idle.
+ */
+inline int CurlAbortPredicateXferInfoCallback(void *clientp, [[maybe_unused]] curl_off_t dltotal,
+					      [[maybe_unused]] curl_off_t dlnow, [[maybe_unused]] curl_off_t ultotal,
+					      [[maybe_unused]] curl_off_t ulnow) noexcept
+{
+	try {
+		const auto *shouldAbort = static_cast<const std::function<bool()> *>(clientp);
+		return (*shouldAbort)() ? 1 : 0;
+	} catch (...) {
+		return 1;
+	}
+}
+
+} // namespace KaitoTokyo::CurlHelper
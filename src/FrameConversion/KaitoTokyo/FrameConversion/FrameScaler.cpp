@@ -0,0 +1,645 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * KaitoTokyo FrameConversion Library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "FrameScaler.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define KAITOTOKYO_FRAMECONVERSION_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+// MSVC accepts every intrinsic without per-function target flags.
+#define KAITOTOKYO_FRAMECONVERSION_TARGET(features)
+#else
+#define KAITOTOKYO_FRAMECONVERSION_TARGET(features) __attribute__((target(features)))
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define KAITOTOKYO_FRAMECONVERSION_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace KaitoTokyo::FrameConversion {
+
+namespace FrameScalerDetail {
+
+struct Kernels {
+	// Averages the 2x2 blocks of two rows into dstWidth pixels: the rows first, then the columns, each
+	// rounding up, which is what pavgb and vrhadd do.
+	void (*halveRow)(const std::uint8_t *row0, const std::uint8_t *row1, std::uint8_t *dst,
+			 std::uint32_t dstWidth) noexcept;
+	// dst = (a * (256 - weight) + b * weight + 128) >> 8 for each byte, with weight in [1, 255].
+	void (*blendRows)(const std::uint8_t *a, const std::uint8_t *b, std::uint8_t *dst, std::size_t size,
+			  std::uint32_t weight) noexcept;
+	void (*toRgbRow)(const std::uint8_t *src, std::uint8_t *dst, std::uint32_t width, bool fromBgra) noexcept;
+	void (*toLumaRow)(const std::uint8_t *src, std::uint8_t *dst, std::uint32_t width, bool fromBgra) noexcept;
+};
+
+} // namespace FrameScalerDetail
+
+namespace {
+
+using FrameScalerDetail::Kernels;
+
+// BT.709 limited range in 8-bit fixed point; the chroma rows sum to zero so grays stay neutral.
+constexpr int kLumaR = 47;
+constexpr int kLumaG = 157;
+constexpr int kLumaB = 16;
+constexpr int kCbR = -26;
+constexpr int kCbG = -86;
+constexpr int kCbB = 112;
+constexpr int kCrR = 112;
+constexpr int kCrG = -102;
+constexpr int kCrB = -10;
+
+void halveRowScalar(const std::uint8_t *row0, const std::uint8_t *row1, std::uint8_t *dst,
+		    std::uint32_t dstWidth) noexcept
+{
+	for (std::uint32_t x = 0; x < dstWidth; ++x) {
+		const std::uint8_t *top = row0 + 8 * static_cast<std::size_t>(x);
+		const std::uint8_t *bottom = row1 + 8 * static_cast<std::size_t>(x);
+		for (int c = 0; c < 4; ++c) {
+			const int left = (top[c] + bottom[c] + 1) >> 1;
+			const int right = (top[4 + c] + bottom[4 + c] + 1) >> 1;
+			dst[4 * static_cast<std::size_t>(x) + c] = static_cast<std::uint8_t>((left + right + 1) >> 1);
+		}
+	}
+}
+
+void blendRowsScalar(const std::uint8_t *a, const std::uint8_t *b, std::uint8_t *dst, std::size_t size,
+		     std::uint32_t weight) noexcept
+{
+	const std::uint32_t inverse = 256 - weight;
+	for (std::size_t i = 0; i < size; ++i) {
+		dst[i] = static_cast<std::uint8_t>((a[i] * inverse + b[i] * weight + 128) >> 8);
+	}
+}
+
+void toRgbRowScalar(const std::uint8_t *src, std::uint8_t *dst, std::uint32_t width, bool fromBgra) noexcept
+{
+	const int r = fromBgra ? 2 : 0;
+	const int b = fromBgra ? 0 : 2;
+	for (std::uint32_t x = 0; x < width; ++x) {
+		const std::uint8_t *pixel = src + 4 * static_cast<std::size_t>(x);
+		std::uint8_t *out = dst + 3 * static_cast<std::size_t>(x);
+		out[0] = pixel[r];
+		out[1] = pixel[1];
+		out[2] = pixel[b];
+	}
+}
+
+std::uint8_t luma(int r, int g, int b) noexcept
+{
+	return static_cast<std::uint8_t>(((kLumaR * r + kLumaG * g + kLumaB * b + 128) >> 8) + 16);
+}
+
+void toLumaRowScalar(const std::uint8_t *src, std::uint8_t *dst, std::uint32_t width, bool fromBgra) noexcept
+{
+	const int r = fromBgra ? 2 : 0;
+	const int b = fromBgra ? 0 : 2;
+	for (std::uint32_t x = 0; x < width; ++x) {
+		const std::uint8_t *pixel = src + 4 * static_cast<std::size_t>(x);
+		dst[x] = luma(pixel[r], pixel[1], pixel[b]);
+	}
+}
+
+constexpr Kernels kScalarKernels{halveRowScalar, blendRowsScalar, toRgbRowScalar, toLumaRowScalar};
+
+#ifdef KAITOTOKYO_FRAMECONVERSION_X86
+
+KAITOTOKYO_FRAMECONVERSION_TARGET("sse4.1")
+void halveRowSse41(const std::uint8_t *row0, const std::uint8_t *row1, std::uint8_t *dst,
+		   std::uint32_t dstWidth) noexcept
+{
+	std::uint32_t x = 0;
+	for (; x + 4 <= dstWidth; x += 4) {
+		const std::size_t offset = 8 * static_cast<std::size_t>(x);
+		const __m128i top0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row0 + offset));
+		const __m128i top1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row0 + offset + 16));
+		const __m128i bottom0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row1 + offset));
+		const __m128i bottom1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row1 + offset + 16));
+		const __m128 rows0 = _mm_castsi128_ps(_mm_avg_epu8(top0, bottom0));
+		const __m128 rows1 = _mm_castsi128_ps(_mm_avg_epu8(top1, bottom1));
+		const __m128i even = _mm_castps_si128(_mm_shuffle_ps(rows0, rows1, _MM_SHUFFLE(2, 0, 2, 0)));
+		const __m128i odd = _mm_castps_si128(_mm_shuffle_ps(rows0, rows1, _MM_SHUFFLE(3, 1, 3, 1)));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + 4 * static_cast<std::size_t>(x)),
+				 _mm_avg_epu8(even, odd));
+	}
+	halveRowScalar(row0 + 8 * static_cast<std::size_t>(x), row1 + 8 * static_cast<std::size_t>(x),
+		       dst + 4 * static_cast<std::size_t>(x), dstWidth - x);
+}
+
+KAITOTOKYO_FRAMECONVERSION_TARGET("sse4.1")
+void blendRowsSse41(const std::uint8_t *a, const std::uint8_t *b, std::uint8_t *dst, std::size_t size,
+		    std::uint32_t weight) noexcept
+{
+	// a * (256 - weight) + b * weight + 128 stays below 65536, so unsigned 16-bit lanes never overflow.
+	const __m128i weightA = _mm_set1_epi16(static_cast<short>(256 - weight));
+	const __m128i weightB = _mm_set1_epi16(static_cast<short>(weight));
+	const __m128i half = _mm_set1_epi16(128);
+
+	std::size_t i = 0;
+	for (; i + 16 <= size; i += 16) {
+		const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+		const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + i));
+		const __m128i lo = _mm_srli_epi16(
+			_mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_cvtepu8_epi16(va), weightA),
+						    _mm_mullo_epi16(_mm_cvtepu8_epi16(vb), weightB)),
+				      half),
+			8);
+		const __m128i hi = _mm_srli_epi16(
+			_mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_cvtepu8_epi16(_mm_srli_si128(va, 8)), weightA),
+						    _mm_mullo_epi16(_mm_cvtepu8_epi16(_mm_srli_si128(vb, 8)), weightB)),
+				      half),
+			8);
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_packus_epi16(lo, hi));
+	}
+	blendRowsScalar(a + i, b + i, dst + i, size - i, weight);
+}
+
+KAITOTOKYO_FRAMECONVERSION_TARGET("sse4.1")
+void toRgbRowSse41(const std::uint8_t *src, std::uint8_t *dst, std::uint32_t width, bool fromBgra) noexcept
+{
+	const __m128i shuffle = fromBgra ? _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1)
+					 : _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+
+	// Each store writes 16 bytes of which 12 are pixels; the next store overwrites the other 4, and the
+	// loop stops while a full store still fits in the row.
+	std::uint32_t x = 0;
+	for (; x + 6 <= width; x += 4) {
+		const std::uint8_t *pixel = src + 4 * static_cast<std::size_t>(x);
+		const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pixel));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + 3 * static_cast<std::size_t>(x)),
+				 _mm_shuffle_epi8(pixels, shuffle));
+	}
+	toRgbRowScalar(src + 4 * static_cast<std::size_t>(x), dst + 3 * static_cast<std::size_t>(x), width - x,
+		       fromBgra);
+}
+
+KAITOTOKYO_FRAMECONVERSION_TARGET("sse4.1")
+void toLumaRowSse41(const std::uint8_t *src, std::uint8_t *dst, std::uint32_t width, bool fromBgra) noexcept
+{
+	const short first = fromBgra ? kLumaB : kLumaR;
+	const short third = fromBgra ? kLumaR : kLumaB;
+	const __m128i coefficients = _mm_setr_epi16(first, kLumaG, third, 0, first, kLumaG, third, 0);
+	const __m128i half = _mm_set1_epi32(128);
+	const __m128i offset = _mm_set1_epi32(16);
+
+	std::uint32_t x = 0;
+	for (; x + 4 <= width; x += 4) {
+		const std::uint8_t *pixel = src + 4 * static_cast<std::size_t>(x);
+		const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pixel));
+		const __m128i lo = _mm_madd_epi16(_mm_cvtepu8_epi16(pixels), coefficients);
+		const __m128i hi = _mm_madd_epi16(_mm_cvtepu8_epi16(_mm_srli_si128(pixels, 8)), coefficients);
+		const __m128i sums = _mm_hadd_epi32(lo, hi);
+		const __m128i y = _mm_add_epi32(_mm_srli_epi32(_mm_add_epi32(sums, half), 8), offset);
+		const __m128i packed = _mm_packus_epi16(_mm_packus_epi32(y, y), _mm_setzero_si128());
+		const int bytes = _mm_cvtsi128_si32(packed);
+		std::memcpy(dst + x, &bytes, 4);
+	}
+	toLumaRowScalar(src + 4 * static_cast<std::size_t>(x), dst + x, width - x, fromBgra);
+}
+
+constexpr Kernels kSse41Kernels{halveRowSse41, blendRowsSse41, toRgbRowSse41, toLumaRowSse41};
+
+KAITOTOKYO_FRAMECONVERSION_TARGET("avx2")
+void halveRowAvx2(const std::uint8_t *row0, const std::uint8_t *row1, std::uint8_t *dst,
+		  std::uint32_t dstWidth) noexcept
+{
+	std::uint32_t x = 0;
+	for (; x + 8 <= dstWidth; x += 8) {
+		const std::size_t offset = 8 * static_cast<std::size_t>(x);
+		const __m256i top0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(row0 + offset));
+		const __m256i top1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(row0 + offset + 32));
+		const __m256i bottom0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(row1 + offset));
+		const __m256i bottom1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(row1 + offset + 32));
+		const __m256 rows0 = _mm256_castsi256_ps(_mm256_avg_epu8(top0, bottom0));
+		const __m256 rows1 = _mm256_castsi256_ps(_mm256_avg_epu8(top1, bottom1));
+		const __m256i even = _mm256_castps_si256(_mm256_shuffle_ps(rows0, rows1, _MM_SHUFFLE(2, 0, 2, 0)));
+		const __m256i odd = _mm256_castps_si256(_mm256_shuffle_ps(rows0, rows1, _MM_SHUFFLE(3, 1, 3, 1)));
+		// The shuffles work within 128-bit lanes and leave pixels 0, 1, 4, 5 | 2, 3, 6, 7.
+		const __m256i halved = _mm256_permute4x64_epi64(_mm256_avg_epu8(even, odd), _MM_SHUFFLE(3, 1, 2, 0));
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + 4 * static_cast<std::size_t>(x)), halved);
+	}
+	halveRowSse41(row0 + 8 * static_cast<std::size_t>(x), row1 + 8 * static_cast<std::size_t>(x),
+		      dst + 4 * static_cast<std::size_t>(x), dstWidth - x);
+}
+
+KAITOTOKYO_FRAMECONVERSION_TARGET("avx2")
+void blendRowsAvx2(const std::uint8_t *a, const std::uint8_t *b, std::uint8_t *dst, std::size_t size,
+		   std::uint32_t weight) noexcept
+{
+	const __m256i weightA = _mm256_set1_epi16(static_cast<short>(256 - weight));
+	const __m256i weightB = _mm256_set1_epi16(static_cast<short>(weight));
+	const __m256i half = _mm256_set1_epi16(128);
+
+	std::size_t i = 0;
+	for (; i + 32 <= size; i += 32) {
+		const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+		const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+		const __m256i lo = _mm256_srli_epi16(
+			_mm256_add_epi16(
+				_mm256_add_epi16(
+					_mm256_mullo_epi16(_mm256_cvtepu8_epi16(_mm256_castsi256_si128(va)), weightA),
+					_mm256_mullo_epi16(_mm256_cvtepu8_epi16(_mm256_castsi256_si128(vb)), weightB)),
+				half),
+			8);
+		const __m256i hi = _mm256_srli_epi16(
+			_mm256_add_epi16(
+				_mm256_add_epi16(
+					_mm256_mullo_epi16(_mm256_cvtepu8_epi16(_mm256_extracti128_si256(va, 1)),
+							   weightA),
+					_mm256_mullo_epi16(_mm256_cvtepu8_epi16(_mm256_extracti128_si256(vb, 1)),
+							   weightB)),
+				half),
+			8);
+		// packus interleaves the 128-bit lanes of lo and hi; the permute puts the bytes back in order.
+		const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(lo, hi), _MM_SHUFFLE(3, 1, 2, 0));
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), packed);
+	}
+	blendRowsSse41(a + i, b + i, dst + i, size - i, weight);
+}
+
+// The color conversions run on the scaled frame only, where 128-bit shuffles already keep up.
+constexpr Kernels kAvx2Kernels{halveRowAvx2, blendRowsAvx2, toRgbRowSse41, toLumaRowSse41};
+
+#endif // KAITOTOKYO_FRAMECONVERSION_X86
+
+#ifdef KAITOTOKYO_FRAMECONVERSION_NEON
+
+void halveRowNeon(const std::uint8_t *row0, const std::uint8_t *row1, std::uint8_t *dst,
+		  std::uint32_t dstWidth) noexcept
+{
+	std::uint32_t x = 0;
+	for (; x + 4 <= dstWidth; x += 4) {
+		const std::size_t offset = 8 * static_cast<std::size_t>(x);
+		// Deinterleaving 32-bit lanes splits the even pixels from the odd ones.
+		const uint32x4x2_t top = vld2q_u32(reinterpret_cast<const std::uint32_t *>(row0 + offset));
+		const uint32x4x2_t bottom = vld2q_u32(reinterpret_cast<const std::uint32_t *>(row1 + offset));
+		const uint8x16_t left =
+			vrhaddq_u8(vreinterpretq_u8_u32(top.val[0]), vreinterpretq_u8_u32(bottom.val[0]));
+		const uint8x16_t right =
+			vrhaddq_u8(vreinterpretq_u8_u32(top.val[1]), vreinterpretq_u8_u32(bottom.val[1]));
+		vst1q_u8(dst + 4 * static_cast<std::size_t>(x), vrhaddq_u8(left, right));
+	}
+	halveRowScalar(row0 + 8 * static_cast<std::size_t>(x), row1 + 8 * static_cast<std::size_t>(x),
+		       dst + 4 * static_cast<std::size_t>(x), dstWidth - x);
+}
+
+void blendRowsNeon(const std::uint8_t *a, const std::uint8_t *b, std::uint8_t *dst, std::size_t size,
+		   std::uint32_t weight) noexcept
+{
+	const uint8x8_t weightA = vdup_n_u8(static_cast<std::uint8_t>(256 - weight));
+	const uint8x8_t weightB = vdup_n_u8(static_cast<std::uint8_t>(weight));
+
+	std::size_t i = 0;
+	for (; i + 16 <= size; i += 16) {
+		const uint8x16_t va = vld1q_u8(a + i);
+		const uint8x16_t vb = vld1q_u8(b + i);
+		const uint16x8_t lo = vmlal_u8(vmull_u8(vget_low_u8(va), weightA), vget_low_u8(vb), weightB);
+		const uint16x8_t hi = vmlal_u8(vmull_u8(vget_high_u8(va), weightA), vget_high_u8(vb), weightB);
+		vst1q_u8(dst + i, vcombine_u8(vrshrn_n_u16(lo, 8), vrshrn_n_u16(hi, 8)));
+	}
+	blendRowsScalar(a + i, b + i, dst + i, size - i, weight);
+}
+
+void toRgbRowNeon(const std::uint8_t *src, std::uint8_t *dst, std::uint32_t width, bool fromBgra) noexcept
+{
+	std::uint32_t x = 0;
+	for (; x + 16 <= width; x += 16) {
+		const uint8x16x4_t pixels = vld4q_u8(src + 4 * static_cast<std::size_t>(x));
+		uint8x16x3_t rgb;
+		rgb.val[0] = fromBgra ? pixels.val[2] : pixels.val[0];
+		rgb.val[1] = pixels.val[1];
+		rgb.val[2] = fromBgra ? pixels.val[0] : pixels.val[2];
+		vst3q_u8(dst + 3 * static_cast<std::size_t>(x), rgb);
+	}
+	toRgbRowScalar(src + 4 * static_cast<std::size_t>(x), dst + 3 * static_cast<std::size_t>(x), width - x,
+		       fromBgra);
+}
+
+void toLumaRowNeon(const std::uint8_t *src, std::uint8_t *dst, std::uint32_t width, bool fromBgra) noexcept
+{
+	const uint8x8_t coefficientR = vdup_n_u8(kLumaR);
+	const uint8x8_t coefficientG = vdup_n_u8(kLumaG);
+	const uint8x8_t coefficientB = vdup_n_u8(kLumaB);
+	const uint8x16_t offset = vdupq_n_u8(16);
+
+	std::uint32_t x = 0;
+	for (; x + 16 <= width; x += 16) {
+		const uint8x16x4_t pixels = vld4q_u8(src + 4 * static_cast<std::size_t>(x));
+		const uint8x16_t r = fromBgra ? pixels.val[2] : pixels.val[0];
+		const uint8x16_t g = pixels.val[1];
+		const uint8x16_t b = fromBgra ? pixels.val[0] : pixels.val[2];
+		uint16x8_t lo = vmull_u8(vget_low_u8(r), coefficientR);
+		lo = vmlal_u8(lo, vget_low_u8(g), coefficientG);
+		lo = vmlal_u8(lo, vget_low_u8(b), coefficientB);
+		uint16x8_t hi = vmull_u8(vget_high_u8(r), coefficientR);
+		hi = vmlal_u8(hi, vget_high_u8(g), coefficientG);
+		hi = vmlal_u8(hi, vget_high_u8(b), coefficientB);
+		vst1q_u8(dst + x, vaddq_u8(vcombine_u8(vrshrn_n_u16(lo, 8), vrshrn_n_u16(hi, 8)), offset));
+	}
+	toLumaRowScalar(src + 4 * static_cast<std::size_t>(x), dst + x, width - x, fromBgra);
+}
+
+constexpr Kernels kNeonKernels{halveRowNeon, blendRowsNeon, toRgbRowNeon, toLumaRowNeon};
+
+#endif // KAITOTOKYO_FRAMECONVERSION_NEON
+
+CpuFeatureLevel detectCpuFeatureLevelUncached() noexcept
+{
+#if defined(KAITOTOKYO_FRAMECONVERSION_X86)
+#if defined(_MSC_VER) && !defined(__clang__)
+	int info[4];
+	__cpuid(info, 0);
+	const int maxLeaf = info[0];
+
+	__cpuid(info, 1);
+	const bool sse41 = (info[2] & (1 << 19)) != 0;
+	const bool osxsave = (info[2] & (1 << 27)) != 0;
+	const bool avx = (info[2] & (1 << 28)) != 0;
+	// The OS must save the YMM registers on context switches as well.
+	const bool ymmEnabled = osxsave && avx && (_xgetbv(0) & 0x6) == 0x6;
+
+	bool avx2 = false;
+	if (maxLeaf >= 7) {
+		__cpuidex(info, 7, 0);
+		avx2 = ymmEnabled && (info[1] & (1 << 5)) != 0;
+	}
+#else
+	__builtin_cpu_init();
+	const bool sse41 = __builtin_cpu_supports("sse4.1");
+	const bool avx2 = __builtin_cpu_supports("avx2");
+#endif
+	if (avx2) {
+		return CpuFeatureLevel::AVX2;
+	}
+	if (sse41) {
+		return CpuFeatureLevel::SSE41;
+	}
+	return CpuFeatureLevel::Scalar;
+#elif defined(KAITOTOKYO_FRAMECONVERSION_NEON)
+	// Advanced SIMD is part of every AArch64 CPU.
+	return CpuFeatureLevel::NEON;
+#else
+	return CpuFeatureLevel::Scalar;
+#endif
+}
+
+bool isSupported(CpuFeatureLevel level) noexcept
+{
+	const CpuFeatureLevel detected = detectCpuFeatureLevel();
+	switch (level) {
+	case CpuFeatureLevel::Scalar:
+		return true;
+	case CpuFeatureLevel::SSE41:
+		return detected == CpuFeatureLevel::SSE41 || detected == CpuFeatureLevel::AVX2;
+	case CpuFeatureLevel::AVX2:
+	case CpuFeatureLevel::NEON:
+		return detected == level;
+	}
+	return false;
+}
+
+const Kernels &selectKernels(CpuFeatureLevel level) noexcept
+{
+	switch (level) {
+#ifdef KAITOTOKYO_FRAMECONVERSION_X86
+	case CpuFeatureLevel::SSE41:
+		return kSse41Kernels;
+	case CpuFeatureLevel::AVX2:
+		return kAvx2Kernels;
+#endif
+#ifdef KAITOTOKYO_FRAMECONVERSION_NEON
+	case CpuFeatureLevel::NEON:
+		return kNeonKernels;
+#endif
+	default:
+		return kScalarKernels;
+	}
+}
+
+// Maps the centers of target pixels onto the source, in 1/256 of a source pixel.
+std::uint64_t sourcePosition(std::uint32_t index, std::uint32_t srcSize, std::uint32_t dstSize) noexcept
+{
+	const std::uint64_t center = ((2 * static_cast<std::uint64_t>(index) + 1) * srcSize * 256) / (2 * dstSize);
+	return center > 128 ? center - 128 : 0;
+}
+
+void validate(const FrameView &src, std::uint32_t dstWidth, std::uint32_t dstHeight)
+{
+	if (!src.data || src.width == 0 || src.height == 0 || src.linesize < 4 * static_cast<std::size_t>(src.width)) {
+		throw std::invalid_argument("InvalidSourceError(FrameScaler)");
+	}
+	if (dstWidth == 0 || dstHeight == 0) {
+		throw std::invalid_argument("InvalidTargetSizeError(FrameScaler)");
+	}
+}
+
+} // anonymous namespace
+
+CpuFeatureLevel detectCpuFeatureLevel() noexcept
+{
+	static const CpuFeatureLevel level = detectCpuFeatureLevelUncached();
+	return level;
+}
+
+std::string_view cpuFeatureLevelName(CpuFeatureLevel level) noexcept
+{
+	switch (level) {
+	case CpuFeatureLevel::Scalar:
+		return "Scalar";
+	case CpuFeatureLevel::SSE41:
+		return "SSE4.1";
+	case CpuFeatureLevel::AVX2:
+		return "AVX2";
+	case CpuFeatureLevel::NEON:
+		return "NEON";
+	}
+	return "Unknown";
+}
+
+std::pair<std::uint32_t, std::uint32_t> fitWithin(std::uint32_t width, std::uint32_t height, std::uint32_t maxWidth,
+						  std::uint32_t maxHeight) noexcept
+{
+	if (width == 0 || height == 0) {
+		return {std::max<std::uint32_t>(1, std::min(width, maxWidth)),
+			std::max<std::uint32_t>(1, std::min(height, maxHeight))};
+	}
+	if (width <= maxWidth && height <= maxHeight) {
+		return {width, height};
+	}
+
+	// Compare maxWidth / width with maxHeight / height without rounding.
+	if (static_cast<std::uint64_t>(maxWidth) * height <= static_cast<std::uint64_t>(maxHeight) * width) {
+		const auto fittedHeight =
+			static_cast<std::uint32_t>(static_cast<std::uint64_t>(height) * maxWidth / width);
+		return {maxWidth, std::max<std::uint32_t>(1, fittedHeight)};
+	}
+	const auto fittedWidth = static_cast<std::uint32_t>(static_cast<std::uint64_t>(width) * maxHeight / height);
+	return {std::max<std::uint32_t>(1, fittedWidth), maxHeight};
+}
+
+FrameScaler::FrameScaler(CpuFeatureLevel level) noexcept
+	: level_(isSupported(level) ? level : detectCpuFeatureLevel()),
+	  kernels_(selectKernels(level_))
+{
+}
+
+void FrameScaler::scaleToRgb(const FrameView &src, std::uint8_t *dst, std::uint32_t dstWidth, std::uint32_t dstHeight,
+			     std::size_t dstLinesize)
+{
+	validate(src, dstWidth, dstHeight);
+	if (!dst || dstLinesize < 3 * static_cast<std::size_t>(dstWidth)) {
+		throw std::invalid_argument("InvalidTargetError(FrameScaler::scaleToRgb)");
+	}
+
+	const FrameView scaled = scale(src, dstWidth, dstHeight);
+	const bool fromBgra = scaled.order == PixelOrder::BGRA;
+	for (std::uint32_t y = 0; y < dstHeight; ++y) {
+		kernels_.toRgbRow(scaled.data + y * scaled.linesize, dst + y * dstLinesize, dstWidth, fromBgra);
+	}
+}
+
+void FrameScaler::scaleToI420(const FrameView &src, const I420View &dst, std::uint32_t dstWidth,
+			      std::uint32_t dstHeight)
+{
+	validate(src, dstWidth, dstHeight);
+	const std::uint32_t chromaWidth = (dstWidth + 1) / 2;
+	const std::uint32_t chromaHeight = (dstHeight + 1) / 2;
+	if (!dst.y || !dst.u || !dst.v || dst.yLinesize < dstWidth || dst.uLinesize < chromaWidth ||
+	    dst.vLinesize < chromaWidth) {
+		throw std::invalid_argument("InvalidTargetError(FrameScaler::scaleToI420)");
+	}
+
+	const FrameView scaled = scale(src, dstWidth, dstHeight);
+	const bool fromBgra = scaled.order == PixelOrder::BGRA;
+	for (std::uint32_t y = 0; y < dstHeight; ++y) {
+		kernels_.toLumaRow(scaled.data + y * scaled.linesize, dst.y + y * dst.yLinesize, dstWidth, fromBgra);
+	}
+
+	// A quarter of the samples, so the chroma stays scalar.
+	const int r = fromBgra ? 2 : 0;
+	const int b = fromBgra ? 0 : 2;
+	for (std::uint32_t cy = 0; cy < chromaHeight; ++cy) {
+		const std::uint8_t *row0 = scaled.data + (2 * cy) * scaled.linesize;
+		const std::uint8_t *row1 = scaled.data + std::min(2 * cy + 1, dstHeight - 1) * scaled.linesize;
+		for (std::uint32_t cx = 0; cx < chromaWidth; ++cx) {
+			const std::size_t left = 8 * static_cast<std::size_t>(cx);
+			const std::size_t right = 4 * static_cast<std::size_t>(std::min(2 * cx + 1, dstWidth - 1));
+			const auto average = [&](int c) {
+				return (row0[left + c] + row0[right + c] + row1[left + c] + row1[right + c] + 2) >> 2;
+			};
+			const int red = average(r);
+			const int green = average(1);
+			const int blue = average(b);
+			const int u = ((kCbR * red + kCbG * green + kCbB * blue + 128) >> 8) + 128;
+			const int v = ((kCrR * red + kCrG * green + kCrB * blue + 128) >> 8) + 128;
+			dst.u[cy * dst.uLinesize + cx] = static_cast<std::uint8_t>(std::clamp(u, 0, 255));
+			dst.v[cy * dst.vLinesize + cx] = static_cast<std::uint8_t>(std::clamp(v, 0, 255));
+		}
+	}
+}
+
+FrameView FrameScaler::scale(const FrameView &src, std::uint32_t dstWidth, std::uint32_t dstHeight)
+{
+	FrameView current = src;
+	std::size_t buffer = 0;
+	while (current.width >= 2 * static_cast<std::uint64_t>(dstWidth) &&
+	       current.height >= 2 * static_cast<std::uint64_t>(dstHeight)) {
+		current = halve(current, halved_[buffer]);
+		buffer = 1 - buffer;
+	}
+
+	if (current.width != dstWidth || current.height != dstHeight) {
+		current = resample(current, dstWidth, dstHeight);
+	}
+	return current;
+}
+
+FrameView FrameScaler::halve(const FrameView &src, std::vector<std::uint8_t> &buffer)
+{
+	// An odd last column or row is dropped.
+	const std::uint32_t width = src.width / 2;
+	const std::uint32_t height = src.height / 2;
+	const std::size_t linesize = 4 * static_cast<std::size_t>(width);
+	buffer.resize(linesize * height);
+
+	for (std::uint32_t y = 0; y < height; ++y) {
+		const std::uint8_t *row0 = src.data + (2 * static_cast<std::size_t>(y)) * src.linesize;
+		kernels_.halveRow(row0, row0 + src.linesize, buffer.data() + y * linesize, width);
+	}
+	return FrameView{buffer.data(), width, height, linesize, src.order};
+}
+
+FrameView FrameScaler::resample(const FrameView &src, std::uint32_t dstWidth, std::uint32_t dstHeight)
+{
+	const std::size_t linesize = 4 * static_cast<std::size_t>(dstWidth);
+	scaled_.resize(linesize * dstHeight);
+	blendedRow_.resize(4 * static_cast<std::size_t>(src.width));
+
+	xOffsets_.resize(2 * static_cast<std::size_t>(dstWidth));
+	xWeights_.resize(dstWidth);
+	for (std::uint32_t x = 0; x < dstWidth; ++x) {
+		const std::uint64_t position = sourcePosition(x, src.width, dstWidth);
+		const auto left = std::min(static_cast<std::uint32_t>(position >> 8), src.width - 1);
+		const std::uint32_t right = std::min(left + 1, src.width - 1);
+		xOffsets_[2 * x] = 4 * left;
+		xOffsets_[2 * x + 1] = 4 * right;
+		xWeights_[x] = right == left ? 0 : static_cast<std::uint32_t>(position & 0xff);
+	}
+
+	for (std::uint32_t y = 0; y < dstHeight; ++y) {
+		const std::uint64_t position = sourcePosition(y, src.height, dstHeight);
+		const auto top = std::min(static_cast<std::uint32_t>(position >> 8), src.height - 1);
+		const std::uint32_t bottom = std::min(top + 1, src.height - 1);
+		const std::uint32_t weight = bottom == top ? 0 : static_cast<std::uint32_t>(position & 0xff);
+
+		const std::uint8_t *row = src.data + top * src.linesize;
+		if (weight != 0) {
+			const std::uint8_t *next = src.data + bottom * src.linesize;
+			kernels_.blendRows(row, next, blendedRow_.data(), blendedRow_.size(), weight);
+			row = blendedRow_.data();
+		}
+
+		std::uint8_t *out = scaled_.data() + y * linesize;
+		for (std::uint32_t x = 0; x < dstWidth; ++x) {
+			const std::uint8_t *left = row + xOffsets_[2 * x];
+			const std::uint8_t *right = row + xOffsets_[2 * x + 1];
+			const std::uint32_t rightWeight = xWeights_[x];
+			const std::uint32_t leftWeight = 256 - rightWeight;
+			for (int c = 0; c < 4; ++c) {
+				const std::uint32_t value = left[c] * leftWeight + right[c] * rightWeight + 128;
+				out[4 * static_cast<std::size_t>(x) + c] = static_cast<std::uint8_t>(value >> 8);
+			}
+		}
+	}
+	return FrameView{scaled_.data(), dstWidth, dstHeight, linesize, src.order};
+}
+
+} // namespace KaitoTokyo::FrameConversion
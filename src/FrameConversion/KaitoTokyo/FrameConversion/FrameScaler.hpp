@@ -0,0 +1,146 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * KaitoTokyo FrameConversion Library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace KaitoTokyo::FrameConversion {
+
+namespace FrameScalerDetail {
+
+// Row kernels of one CpuFeatureLevel; defined in FrameScaler.cpp.
+struct Kernels;
+
+} // namespace FrameScalerDetail
+
+/**
+ * Byte order of a 4-byte pixel. The fourth byte is ignored, so BGRX and RGBX frames work as well.
+ */
+enum class PixelOrder {
+	BGRA,
+	RGBA,
+};
+
+/**
+ * A frame of 4-byte pixels whose rows start linesize bytes apart, as read back from the GPU.
+ */
+struct FrameView {
+	const std::uint8_t *data = nullptr;
+	std::uint32_t width = 0;
+	std::uint32_t height = 0;
+	std::size_t linesize = 0;
+	PixelOrder order = PixelOrder::BGRA;
+};
+
+/**
+ * Planes of an I420 image. The chroma planes are half the width and height of the luma plane, rounded up.
+ */
+struct I420View {
+	std::uint8_t *y = nullptr;
+	std::size_t yLinesize = 0;
+	std::uint8_t *u = nullptr;
+	std::size_t uLinesize = 0;
+	std::uint8_t *v = nullptr;
+	std::size_t vLinesize = 0;
+};
+
+/**
+ * Instruction sets the kernels are compiled for. Only the ones of the target architecture can be detected.
+ */
+enum class CpuFeatureLevel {
+	Scalar,
+	SSE41,
+	AVX2,
+	NEON,
+};
+
+/**
+ * The best level the running CPU supports. Detected on the first call.
+ */
+CpuFeatureLevel detectCpuFeatureLevel() noexcept;
+
+std::string_view cpuFeatureLevelName(CpuFeatureLevel level) noexcept;
+
+/**
+ * The largest size with the aspect ratio of width x height that fits in maxWidth x maxHeight, never
+ * larger than the source and never zero.
+ */
+std::pair<std::uint32_t, std::uint32_t> fitWithin(std::uint32_t width, std::uint32_t height, std::uint32_t maxWidth,
+						  std::uint32_t maxHeight) noexcept;
+
+/**
+ * Downscales captured frames and converts them to RGB or I420 for encoding.
+ *
+ * The frame is first halved with a 2x2 box filter while it stays at least twice the target size, then
+ * resampled bilinearly to the exact size, so large ratios average every source pixel instead of
+ * skipping them. The halving, the vertical blend and the color conversions have SSE4.1, AVX2 and NEON
+ * kernels chosen at construction; all levels give bit-identical results.
+ *
+ * Scratch buffers are kept between calls, so a scaler should be reused. Not thread-safe.
+ */
+class FrameScaler {
+public:
+	/**
+	 * A level the CPU does not support falls back to the detected one.
+	 */
+	explicit FrameScaler(CpuFeatureLevel level = detectCpuFeatureLevel()) noexcept;
+
+	CpuFeatureLevel getCpuFeatureLevel() const noexcept { return level_; }
+
+	/**
+	 * Writes dstWidth x dstHeight packed R, G, B pixels, with rows dstLinesize bytes apart.
+	 * Throws std::invalid_argument for an empty source or target.
+	 */
+	void scaleToRgb(const FrameView &src, std::uint8_t *dst, std::uint32_t dstWidth, std::uint32_t dstHeight,
+			std::size_t dstLinesize);
+
+	/**
+	 * Writes dstWidth x dstHeight as BT.709 limited-range I420. Each chroma sample covers a 2x2 block.
+	 * Throws std::invalid_argument for an empty source or target.
+	 */
+	void scaleToI420(const FrameView &src, const I420View &dst, std::uint32_t dstWidth, std::uint32_t dstHeight);
+
+private:
+	const CpuFeatureLevel level_;
+	const FrameScalerDetail::Kernels &kernels_;
+
+	std::vector<std::uint8_t> halved_[2];
+	std::vector<std::uint8_t> scaled_;
+	std::vector<std::uint8_t> blendedRow_;
+	// Byte offsets of the left and right source pixels of each target column, and the weight of the right one.
+	std::vector<std::uint32_t> xOffsets_;
+	std::vector<std::uint32_t> xWeights_;
+
+	FrameView scale(const FrameView &src, std::uint32_t dstWidth, std::uint32_t dstHeight);
+	FrameView halve(const FrameView &src, std::vector<std::uint8_t> &buffer);
+	FrameView resample(const FrameView &src, std::uint32_t dstWidth, std::uint32_t dstHeight);
+};
+
+} // namespace KaitoTokyo::FrameConversion
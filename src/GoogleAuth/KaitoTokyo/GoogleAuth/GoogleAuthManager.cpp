@@ -25,17 +25,38 @@
 
 #include "GoogleAuthManager.hpp"
 
+#include <chrono>
+
 #include <nlohmann/json.hpp>
 
+#include <KaitoTokyo/CurlHelper/CurlTransferAwaiter.hpp>
 #include <KaitoTokyo/CurlHelper/CurlUrlSearchParams.hpp>
 #include <KaitoTokyo/CurlHelper/CurlWriteCallback.hpp>
+#include <KaitoTokyo/Metrics/MetricsRegistry.hpp>
 
 namespace KaitoTokyo::GoogleAuth {
 
-GoogleAuthManager::GoogleAuthManager(std::shared_ptr<CurlHelper::CurlHandle> curl,
+namespace {
+
+void recordTokenRefresh(const char *result, std::chrono::steady_clock::duration elapsed)
+{
+	Metrics::MetricsRegistry &metrics = Metrics::MetricsRegistry::global();
+	metrics.counter("google_oauth2_token_refreshes_total", "Google OAuth2 access token refreshes by result.",
+			{{"result", result}})
+		.inc();
+	metrics.histogram("google_oauth2_token_refresh_duration_seconds",
+			  "Duration of Google OAuth2 access token refreshes.", Metrics::kDefaultDurationBuckets)
+		.observe(elapsed);
+}
+
+} // anonymous namespace
+
+GoogleAuthManager::GoogleAuthManager(std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool,
 				     const GoogleOAuth2ClientCredentials &clientCredentials,
 				     std::shared_ptr<const Logger::ILogger> logger)
-	: curl_(curl ? curl : throw std::invalid_argument("CurlIsNullError(GoogleAuthManager::GoogleAuthManager)")),
+	: curlPool_(curlPool
+			    ? std::move(curlPool)
+			    : throw std::invalid_argument("CurlPoolIsNullError(GoogleAuthManager::GoogleAuthManager)")),
 	  clientCredentials_((!clientCredentials.client_id.empty() && !clientCredentials.client_secret.empty())
 				     ? clientCredentials
 				     : throw std::runtime_error(
@@ -49,44 +70,52 @@ GoogleAuthManager::~GoogleAuthManager() noexcept = default;
 
 GoogleAuthResponse GoogleAuthManager::fetchFreshAuthResponse(std::string refreshToken) const
 {
-	CurlHelper::CurlUrlSearchParams postParams(curl_->getRaw());
-	postParams.append("client_id", clientCredentials_.client_id);
-	postParams.append("client_secret", clientCredentials_.client_secret);
-	postParams.append("refresh_token", std::move(refreshToken));
-	postParams.append("grant_type", "refresh_token");
-
-	std::vector<char> readBuffer;
-	std::string postData = postParams.toString();
-
-	curl_easy_reset(curl_->getRaw());
-
-	curl_easy_setopt(curl_->getRaw(), CURLOPT_URL, "https://oauth2.googleapis.com/token");
-	curl_easy_setopt(curl_->getRaw(), CURLOPT_FOLLOWLOCATION, 2L);
-	curl_easy_setopt(curl_->getRaw(), CURLOPT_POST, 1L);
-	curl_easy_setopt(curl_->getRaw(), CURLOPT_POSTFIELDS, postData.c_str());
-	curl_easy_setopt(curl_->getRaw(), CURLOPT_POSTFIELDSIZE, static_cast<long>(postData.length()));
-
-	curl_easy_setopt(curl_->getRaw(), CURLOPT_WRITEFUNCTION, CurlHelper::CurlCharVectorWriteCallback);
-	curl_easy_setopt(curl_->getRaw(), CURLOPT_WRITEDATA, &readBuffer);
-
-	curl_easy_setopt(curl_->getRaw(), CURLOPT_CONNECTTIMEOUT, 10L);
-	curl_easy_setopt(curl_->getRaw(), CURLOPT_TIMEOUT, 60L);
-	curl_easy_setopt(curl_->getRaw(), CURLOPT_NOSIGNAL, 1L);
-
-	CURLcode res = curl_easy_perform(curl_->getRaw());
-	if (res != CURLE_OK) {
-		logger_->error("CurlPerformError", {{"error", curl_easy_strerror(res)}});
-		throw std::runtime_error("NetworkError(fetchFreshAuthResponse)");
-	}
-
-	nlohmann::json j = nlohmann::json::parse(readBuffer);
-	if (j.contains("error")) {
-		std::string errorJson = j["error"].dump();
-		logger_->error("GoogleOAuth2Error", {{"error", errorJson}});
-		throw std::runtime_error("APIError(fetchFreshAuthResponse)");
+	const auto startTime = std::chrono::steady_clock::now();
+	try {
+		const CurlHelper::CurlConnectionPool::Lease curl = curlPool_->checkout();
+
+		CurlHelper::CurlUrlSearchParams postParams(curl.getRaw());
+		postParams.append("client_id", clientCredentials_.client_id);
+		postParams.append("client_secret", clientCredentials_.client_secret);
+		postParams.append("refresh_token", std::move(refreshToken));
+		postParams.append("grant_type", "refresh_token");
+
+		std::vector<char> readBuffer;
+		std::string postData = postParams.toString();
+
+		const CurlHelper::CurlTransfer transfer{
+			.method = "POST",
+			.url = "https://oauth2.googleapis.com/token",
+			.body = postData,
+			.writeFunction = CurlHelper::CurlCharVectorWriteCallback,
+			.writeData = &readBuffer,
+		};
+		curl_easy_setopt(curl.getRaw(), CURLOPT_FOLLOWLOCATION, 2L);
+
+		curl_easy_setopt(curl.getRaw(), CURLOPT_CONNECTTIMEOUT, 10L);
+		curl_easy_setopt(curl.getRaw(), CURLOPT_TIMEOUT, 60L);
+		curl_easy_setopt(curl.getRaw(), CURLOPT_NOSIGNAL, 1L);
+
+		const CurlHelper::CurlTransferResult res = CurlHelper::performCurlTransfer(curl.getRaw(), transfer);
+		if (res.code != CURLE_OK) {
+			logger_->error("CurlPerformError", {{"error", curl_easy_strerror(res.code)}});
+			throw std::runtime_error("NetworkError(fetchFreshAuthResponse)");
+		}
+
+		nlohmann::json j = nlohmann::json::parse(readBuffer);
+		if (j.contains("error")) {
+			std::string errorJson = j["error"].dump();
+			logger_->error("GoogleOAuth2Error", {{"error", errorJson}});
+			throw std::runtime_error("APIError(fetchFreshAuthResponse)");
+		}
+
+		GoogleAuthResponse response = j.get<GoogleAuthResponse>();
+		recordTokenRefresh("success", std::chrono::steady_clock::now() - startTime);
+		return response;
+	} catch (...) {
+		recordTokenRefresh("failure", std::chrono::steady_clock::now() - startTime);
+		throw;
 	}
-
-	return j.get<GoogleAuthResponse>();
 }
 
 } // namespace KaitoTokyo::GoogleAuth
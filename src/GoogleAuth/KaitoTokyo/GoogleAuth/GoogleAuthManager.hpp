@@ -30,7 +30,7 @@
 
 #include <curl/curl.h>
 
-#include <KaitoTokyo/CurlHelper/CurlHandle.hpp>
+#include <KaitoTokyo/CurlHelper/CurlConnectionPool.hpp>
 #include <KaitoTokyo/Logger/ILogger.hpp>
 
 #include "GoogleAuthResponse.hpp"
@@ -40,7 +40,7 @@ namespace KaitoTokyo::GoogleAuth {
 
 class GoogleAuthManager {
 public:
-	GoogleAuthManager(std::shared_ptr<CurlHelper::CurlHandle> curl,
+	GoogleAuthManager(std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool,
 			  const GoogleOAuth2ClientCredentials &clientCredentials,
 			  std::shared_ptr<const Logger::ILogger> logger);
 
@@ -55,7 +55,7 @@ public:
 	GoogleAuthResponse fetchFreshAuthResponse(std::string refreshToken) const;
 
 private:
-	const std::shared_ptr<CurlHelper::CurlHandle> curl_;
+	const std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool_;
 	const GoogleOAuth2ClientCredentials clientCredentials_;
 	const std::shared_ptr<const Logger::ILogger> logger_;
 };
@@ -27,10 +27,10 @@
 
 namespace KaitoTokyo::GoogleAuth {
 
-GoogleAuthManager::GoogleAuthManager(std::shared_ptr<CurlHelper::CurlHandle> curl,
+GoogleAuthManager::GoogleAuthManager(std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool,
 				     const GoogleOAuth2ClientCredentials &clientCredentials,
 				     std::shared_ptr<const Logger::ILogger> logger)
-	: curl_(std::move(curl)),
+	: curlPool_(std::move(curlPool)),
 	  clientCredentials_(clientCredentials),
 	  logger_(std::move(logger))
 {
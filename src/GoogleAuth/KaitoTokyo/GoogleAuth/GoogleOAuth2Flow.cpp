@@ -30,17 +30,18 @@
 #include <fmt/format.h>
 #include <nlohmann/json.hpp>
 
-#include <KaitoTokyo/CurlHelper/CurlHandle.hpp>
+#include <KaitoTokyo/CurlHelper/CurlTransferAwaiter.hpp>
 #include <KaitoTokyo/CurlHelper/CurlUrlHandle.hpp>
 #include <KaitoTokyo/CurlHelper/CurlUrlSearchParams.hpp>
 #include <KaitoTokyo/CurlHelper/CurlWriteCallback.hpp>
 
 namespace KaitoTokyo::GoogleAuth {
 
-GoogleOAuth2Flow::GoogleOAuth2Flow(std::shared_ptr<CurlHelper::CurlHandle> curl,
+GoogleOAuth2Flow::GoogleOAuth2Flow(std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool,
 				   GoogleOAuth2ClientCredentials clientCredentials, std::string scopes,
 				   std::shared_ptr<const Logger::ILogger> logger)
-	: curl_(curl ? curl : throw std::invalid_argument("CurlIsNullError(GoogleOAuth2Flow)")),
+	: curlPool_(curlPool ? std::move(curlPool)
+			     : throw std::invalid_argument("CurlPoolIsNullError(GoogleOAuth2Flow)")),
 	  clientCredentials_(std::move(clientCredentials)),
 	  scopes_(std::move(scopes)),
 	  logger_(std::move(logger))
@@ -51,7 +52,9 @@ GoogleOAuth2Flow::~GoogleOAuth2Flow() noexcept = default;
 
 std::string GoogleOAuth2Flow::getAuthorizationUrl(std::string redirectUri) const
 {
-	CurlHelper::CurlUrlSearchParams params(curl_->getRaw());
+	const CurlHelper::CurlConnectionPool::Lease curl = curlPool_->checkout();
+
+	CurlHelper::CurlUrlSearchParams params(curl.getRaw());
 	params.append("client_id", clientCredentials_.client_id);
 	params.append("redirect_uri", std::move(redirectUri));
 	params.append("response_type", "code");
@@ -70,7 +73,9 @@ std::string GoogleOAuth2Flow::getAuthorizationUrl(std::string redirectUri) const
 
 GoogleAuthResponse GoogleOAuth2Flow::exchangeCode(std::string code, std::string redirectUri)
 {
-	CurlHelper::CurlUrlSearchParams params(curl_->getRaw());
+	const CurlHelper::CurlConnectionPool::Lease curl = curlPool_->checkout();
+
+	CurlHelper::CurlUrlSearchParams params(curl.getRaw());
 
 	params.append("client_id", clientCredentials_.client_id);
 	params.append("client_secret", clientCredentials_.client_secret);
@@ -81,23 +86,21 @@ GoogleAuthResponse GoogleOAuth2Flow::exchangeCode(std::string code, std::string
 
 	std::vector<char> readBuffer;
 
-	curl_easy_reset(curl_->getRaw());
-
-	curl_easy_setopt(curl_->getRaw(), CURLOPT_URL, "https://oauth2.googleapis.com/token");
-	curl_easy_setopt(curl_->getRaw(), CURLOPT_POST, 1L);
-	curl_easy_setopt(curl_->getRaw(), CURLOPT_POSTFIELDS, postData.c_str());
-	curl_easy_setopt(curl_->getRaw(), CURLOPT_POSTFIELDSIZE, static_cast<long>(postData.length()));
-
-	curl_easy_setopt(curl_->getRaw(), CURLOPT_WRITEFUNCTION, CurlHelper::CurlCharVectorWriteCallback);
-	curl_easy_setopt(curl_->getRaw(), CURLOPT_WRITEDATA, &readBuffer);
-
-	curl_easy_setopt(curl_->getRaw(), CURLOPT_CONNECTTIMEOUT, 10L);
-	curl_easy_setopt(curl_->getRaw(), CURLOPT_TIMEOUT, 60L);
-	curl_easy_setopt(curl_->getRaw(), CURLOPT_NOSIGNAL, 1L);
-
-	const CURLcode res = curl_easy_perform(curl_->getRaw());
-	if (res != CURLE_OK) {
-		logger_->error("CurlPerformError", {{"error", curl_easy_strerror(res)}});
+	const CurlHelper::CurlTransfer transfer{
+		.method = "POST",
+		.url = "https://oauth2.googleapis.com/token",
+		.body = postData,
+		.writeFunction = CurlHelper::CurlCharVectorWriteCallback,
+		.writeData = &readBuffer,
+	};
+
+	curl_easy_setopt(curl.getRaw(), CURLOPT_CONNECTTIMEOUT, 10L);
+	curl_easy_setopt(curl.getRaw(), CURLOPT_TIMEOUT, 60L);
+	curl_easy_setopt(curl.getRaw(), CURLOPT_NOSIGNAL, 1L);
+
+	const CurlHelper::CurlTransferResult res = CurlHelper::performCurlTransfer(curl.getRaw(), transfer);
+	if (res.code != CURLE_OK) {
+		logger_->error("CurlPerformError", {{"error", curl_easy_strerror(res.code)}});
 		throw std::runtime_error("CurlPerformError(exchangeCode)");
 	}
 
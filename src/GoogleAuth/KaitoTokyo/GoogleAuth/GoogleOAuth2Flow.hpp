@@ -29,7 +29,7 @@
 #include <optional>
 #include <string>
 
-#include <KaitoTokyo/CurlHelper/CurlHandle.hpp>
+#include <KaitoTokyo/CurlHelper/CurlConnectionPool.hpp>
 #include <KaitoTokyo/Logger/ILogger.hpp>
 
 #include "GoogleAuthResponse.hpp"
@@ -39,8 +39,9 @@ namespace KaitoTokyo::GoogleAuth {
 
 class GoogleOAuth2Flow {
 public:
-	GoogleOAuth2Flow(std::shared_ptr<CurlHelper::CurlHandle> curl, GoogleOAuth2ClientCredentials clientCredentials,
-			 std::string scopes, std::shared_ptr<const Logger::ILogger> logger);
+	GoogleOAuth2Flow(std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool,
+			 GoogleOAuth2ClientCredentials clientCredentials, std::string scopes,
+			 std::shared_ptr<const Logger::ILogger> logger);
 
 	~GoogleOAuth2Flow() noexcept;
 
@@ -55,7 +56,7 @@ public:
 	[[nodiscard]]
 	GoogleAuthResponse exchangeCode(std::string code, std::string redirectUri);
 
-	const std::shared_ptr<CurlHelper::CurlHandle> curl_;
+	const std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool_;
 	const GoogleOAuth2ClientCredentials clientCredentials_;
 	const std::string scopes_;
 	const std::shared_ptr<const Logger::ILogger> logger_;
@@ -29,10 +29,10 @@
 
 namespace KaitoTokyo::GoogleAuth {
 
-GoogleOAuth2Flow::GoogleOAuth2Flow(std::shared_ptr<CurlHelper::CurlHandle> curl,
+GoogleOAuth2Flow::GoogleOAuth2Flow(std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool,
 				   GoogleOAuth2ClientCredentials clientCredentials, std::string scopes,
 				   std::shared_ptr<const Logger::ILogger> logger)
-	: curl_(std::move(curl)),
+	: curlPool_(std::move(curlPool)),
 	  clientCredentials_(std::move(clientCredentials)),
 	  scopes_(std::move(scopes)),
 	  logger_(std::move(logger))
@@ -0,0 +1,76 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * KaitoTokyo GoogleAuth Library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "GoogleTokenRefresher.hpp"
+
+#include <exception>
+#include <string_view>
+#include <utility>
+
+namespace KaitoTokyo::GoogleAuth {
+
+GoogleAuthResponse GoogleTokenRefresher::refresh(const std::string &refreshToken, const RefreshFunction &refresh)
+{
+	const std::size_t key = std::hash<std::string_view>{}(refreshToken);
+
+	std::promise<GoogleAuthResponse> promise;
+	{
+		std::unique_lock lock(mutex_);
+		if (auto it = inFlight_.find(key); it != inFlight_.end()) {
+			std::shared_future<GoogleAuthResponse> flight = it->second;
+			stats_.joins++;
+			lock.unlock();
+			return flight.get();
+		}
+		inFlight_.emplace(key, promise.get_future().share());
+		stats_.refreshes++;
+	}
+
+	// Joiners hold their own copy of the future, so the entry can go before they wake up.
+	try {
+		GoogleAuthResponse response = refresh();
+		{
+			std::scoped_lock lock(mutex_);
+			inFlight_.erase(key);
+		}
+		promise.set_value(response);
+		return response;
+	} catch (...) {
+		{
+			std::scoped_lock lock(mutex_);
+			inFlight_.erase(key);
+		}
+		promise.set_exception(std::current_exception());
+		throw;
+	}
+}
+
+GoogleTokenRefresherStats GoogleTokenRefresher::getStats() const
+{
+	std::scoped_lock lock(mutex_);
+	return stats_;
+}
+
+} // namespace KaitoTokyo::GoogleAuth
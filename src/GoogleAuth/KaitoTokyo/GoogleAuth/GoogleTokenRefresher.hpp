@@ -0,0 +1,91 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * KaitoTokyo GoogleAuth Library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "GoogleAuthResponse.hpp"
+
+namespace KaitoTokyo::GoogleAuth {
+
+/**
+ * Counters of a GoogleTokenRefresher, taken at one point in time.
+ */
+struct GoogleTokenRefresherStats {
+	// Refreshes that ran the refresh function.
+	std::uint64_t refreshes = 0;
+	// Callers that waited for a refresh already in flight instead.
+	std::uint64_t joins = 0;
+};
+
+/**
+ * Lets concurrent callers share one token refresh per refresh token.
+ *
+ * The first caller runs its refresh function; callers that arrive while it is in flight block until
+ * it finishes and get its response, or its exception, without a request of their own. Whatever the
+ * refresh function publishes, such as the new token state, is therefore written once per refresh.
+ * Refresh tokens are keyed by hash and never kept. Thread-safe.
+ */
+class GoogleTokenRefresher {
+public:
+	using RefreshFunction = std::function<GoogleAuthResponse()>;
+
+	GoogleTokenRefresher() = default;
+	~GoogleTokenRefresher() noexcept = default;
+
+	GoogleTokenRefresher(const GoogleTokenRefresher &) = delete;
+	GoogleTokenRefresher &operator=(const GoogleTokenRefresher &) = delete;
+	GoogleTokenRefresher(GoogleTokenRefresher &&) = delete;
+	GoogleTokenRefresher &operator=(GoogleTokenRefresher &&) = delete;
+
+	/**
+	 * Runs refresh, or waits for the refresh in flight for the same refresh token.
+	 *
+	 * @return The response of the refresh that ran.
+	 * @throws Whatever that refresh threw.
+	 */
+	[[nodiscard]]
+	GoogleAuthResponse refresh(const std::string &refreshToken, const RefreshFunction &refresh);
+
+	/**
+	 * Returns the current counters.
+	 */
+	GoogleTokenRefresherStats getStats() const;
+
+private:
+	mutable std::mutex mutex_;
+	// Refreshes in flight by hash of their refresh token.
+	std::unordered_map<std::size_t, std::shared_future<GoogleAuthResponse>> inFlight_;
+	GoogleTokenRefresherStats stats_;
+};
+
+} // namespace KaitoTokyo::GoogleAuth
@@ -0,0 +1,98 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - Controller Module
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "LiveBroadcastIndex.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace KaitoTokyo::LiveStreamSegmenter::Controller {
+
+bool LiveBroadcastIndex::restore(const Store::SessionJournalRecord &record,
+				 std::span<const std::string> liveStreamIds)
+{
+	std::scoped_lock lock(mutex_);
+	liveBroadcastIds_.clear();
+
+	if (!std::ranges::equal(record.liveStreamIds, liveStreamIds) ||
+	    std::ranges::any_of(liveStreamIds, [](const std::string &id) { return id.empty(); })) {
+		return false;
+	}
+
+	for (const std::string &liveStreamId : liveStreamIds) {
+		liveBroadcastIds_.insert_or_assign(liveStreamId, std::nullopt);
+	}
+
+	for (const Store::SessionJournalBroadcast &broadcast : record.broadcasts) {
+		// Broadcasts that never went live cannot be completed and are left as unused broadcasts.
+		// A completing one may or may not have been completed before the record was superseded.
+		if (broadcast.state != "live" && broadcast.state != "completing") {
+			continue;
+		}
+		if (broadcast.id.empty() || broadcast.liveStreamIndex >= liveStreamIds.size()) {
+			liveBroadcastIds_.clear();
+			return false;
+		}
+		liveBroadcastIds_.insert_or_assign(liveStreamIds[broadcast.liveStreamIndex], broadcast.id);
+	}
+
+	return true;
+}
+
+std::optional<std::vector<std::string>> LiveBroadcastIndex::findLive(std::span<const std::string> liveStreamIds) const
+{
+	std::scoped_lock lock(mutex_);
+
+	std::vector<std::string> liveBroadcastIds;
+	for (const std::string &liveStreamId : liveStreamIds) {
+		const auto it = liveBroadcastIds_.find(liveStreamId);
+		if (it == liveBroadcastIds_.end()) {
+			return std::nullopt;
+		}
+		if (it->second) {
+			liveBroadcastIds.push_back(*it->second);
+		}
+	}
+	return liveBroadcastIds;
+}
+
+void LiveBroadcastIndex::setLive(const std::string &liveStreamId, std::string liveBroadcastId)
+{
+	std::scoped_lock lock(mutex_);
+	liveBroadcastIds_.insert_or_assign(liveStreamId, std::move(liveBroadcastId));
+}
+
+void LiveBroadcastIndex::setIdle(std::span<const std::string> liveStreamIds)
+{
+	std::scoped_lock lock(mutex_);
+	for (const std::string &liveStreamId : liveStreamIds) {
+		liveBroadcastIds_.insert_or_assign(liveStreamId, std::nullopt);
+	}
+}
+
+void LiveBroadcastIndex::forget(std::span<const std::string> liveStreamIds)
+{
+	std::scoped_lock lock(mutex_);
+	for (const std::string &liveStreamId : liveStreamIds) {
+		liveBroadcastIds_.erase(liveStreamId);
+	}
+}
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Controller
@@ -0,0 +1,79 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - Controller Module
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <SessionJournal.hpp>
+
+namespace KaitoTokyo::LiveStreamSegmenter::Controller {
+
+/**
+ * What the segmenter knows about the broadcasts it made live, keyed by live stream id.
+ *
+ * A live stream the index knows about either carries one of our live broadcasts or carries
+ * none, so completing the broadcasts of a known live stream needs no listing. A live stream
+ * it does not know about, as after a cold start, has to be found by scanning the active
+ * broadcasts. Thread-safe.
+ */
+class LiveBroadcastIndex {
+public:
+	LiveBroadcastIndex() = default;
+	~LiveBroadcastIndex() noexcept = default;
+
+	LiveBroadcastIndex(const LiveBroadcastIndex &) = delete;
+	LiveBroadcastIndex &operator=(const LiveBroadcastIndex &) = delete;
+	LiveBroadcastIndex(LiveBroadcastIndex &&) = delete;
+	LiveBroadcastIndex &operator=(LiveBroadcastIndex &&) = delete;
+
+	/**
+	 * Rebuilds the index from the last journal record. Returns false and leaves the index
+	 * empty when the record does not describe the given live streams, indexed by live
+	 * stream index, for example because the settings changed since it was written.
+	 */
+	bool restore(const Store::SessionJournalRecord &record, std::span<const std::string> liveStreamIds);
+
+	/**
+	 * Returns the ids of the live broadcasts on the given live streams, or std::nullopt when
+	 * any of them is unknown.
+	 */
+	std::optional<std::vector<std::string>> findLive(std::span<const std::string> liveStreamIds) const;
+
+	void setLive(const std::string &liveStreamId, std::string liveBroadcastId);
+
+	// Records that none of our broadcasts is live on the live streams.
+	void setIdle(std::span<const std::string> liveStreamIds);
+
+	// Makes the live streams unknown, so the next completion scans for them.
+	void forget(std::span<const std::string> liveStreamIds);
+
+private:
+	mutable std::mutex mutex_;
+	// std::nullopt marks a live stream known to carry none of our live broadcasts.
+	std::unordered_map<std::string, std::optional<std::string>> liveBroadcastIds_;
+};
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Controller
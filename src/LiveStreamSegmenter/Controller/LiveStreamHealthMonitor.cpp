@@ -0,0 +1,234 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - Controller Module
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "LiveStreamHealthMonitor.hpp"
+
+#include <array>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <KaitoTokyo/Async/TimerService.hpp>
+
+namespace KaitoTokyo::LiveStreamSegmenter::Controller {
+
+namespace {
+
+constexpr YouTubeApi::YouTubeFieldMask kLiveStreamHealthMask{
+	.parts = "id,status",
+	.fields = "id,status/streamStatus,status/healthStatus",
+};
+
+// A check costs one quota unit, so a healthy live stream is left alone for a while.
+constexpr std::chrono::milliseconds kHealthyCheckInterval{120000};
+constexpr std::chrono::milliseconds kDegradedCheckInterval{15000};
+constexpr std::chrono::milliseconds kFailedCheckInterval{30000};
+// Gives a live stream that just went live time to report its first health.
+constexpr std::chrono::milliseconds kFirstCheckDelay{10000};
+// How long run() sleeps while there is nothing to poll, unless woken.
+constexpr std::chrono::hours kIdleSleep{1};
+
+bool isSameHealth(const YouTubeApi::YouTubeLiveStream::Status &a, const YouTubeApi::YouTubeLiveStream::Status &b)
+{
+	const auto &aIssues = a.healthStatus.configurationIssues;
+	const auto &bIssues = b.healthStatus.configurationIssues;
+	if (a.streamStatus != b.streamStatus || a.healthStatus.status != b.healthStatus.status ||
+	    aIssues.size() != bIssues.size()) {
+		return false;
+	}
+	for (std::size_t i = 0; i < aIssues.size(); ++i) {
+		if (aIssues[i].type != bIssues[i].type || aIssues[i].severity != bIssues[i].severity) {
+			return false;
+		}
+	}
+	return true;
+}
+
+} // anonymous namespace
+
+bool isLiveStreamHealthy(const YouTubeApi::YouTubeLiveStream::Status &status) noexcept
+{
+	return status.streamStatus == "active" &&
+	       (status.healthStatus.status == "good" || status.healthStatus.status == "ok");
+}
+
+LiveStreamHealthMonitor::LiveStreamHealthMonitor(std::shared_ptr<YouTubeApi::YouTubeApiClient> youTubeApiClient,
+						 std::shared_ptr<Store::GoogleAccessTokenProvider> tokenProvider,
+						 std::shared_ptr<Async::ThreadPoolExecutor> networkExecutor,
+						 std::shared_ptr<const Logger::ILogger> logger)
+	: youTubeApiClient_(youTubeApiClient ? std::move(youTubeApiClient)
+					     : throw std::invalid_argument(
+						       "YouTubeApiClientIsNullError(LiveStreamHealthMonitor)")),
+	  tokenProvider_(tokenProvider ? std::move(tokenProvider)
+				       : throw std::invalid_argument(
+					         "TokenProviderIsNullError(LiveStreamHealthMonitor)")),
+	  networkExecutor_(networkExecutor ? std::move(networkExecutor)
+					   : throw std::invalid_argument(
+						     "NetworkExecutorIsNullError(LiveStreamHealthMonitor)")),
+	  logger_(logger ? std::move(logger)
+			 : throw std::invalid_argument("LoggerIsNullError(LiveStreamHealthMonitor)")),
+	  snapshot_(std::make_shared<const LiveStreamHealthSnapshot>())
+{
+	youTubeApiClient_->setAbortPredicate([this]() { return stopped_.load(std::memory_order_relaxed); });
+}
+
+void LiveStreamHealthMonitor::setChangedCallback(ChangedCallback callback)
+{
+	std::scoped_lock lock(mutex_);
+	changedCallback_ = std::move(callback);
+}
+
+void LiveStreamHealthMonitor::watch(const std::string &liveStreamId)
+{
+	std::scoped_lock lock(mutex_);
+	if (liveStreamId == liveStreamId_ && !paused_) {
+		return;
+	}
+
+	paused_ = false;
+	nextCheckAt_ = std::chrono::steady_clock::now() + kFirstCheckDelay;
+	if (liveStreamId != liveStreamId_) {
+		liveStreamId_ = liveStreamId;
+		snapshot_ = std::make_shared<const LiveStreamHealthSnapshot>(LiveStreamHealthSnapshot{
+			.version = snapshot_->version + 1,
+			.liveStreamId = liveStreamId,
+			.status = std::nullopt,
+		});
+	}
+	wakeSource_.cancel();
+}
+
+void LiveStreamHealthMonitor::pause()
+{
+	std::scoped_lock lock(mutex_);
+	paused_ = true;
+	wakeSource_.cancel();
+}
+
+void LiveStreamHealthMonitor::stop()
+{
+	stopped_.store(true, std::memory_order_relaxed);
+	std::scoped_lock lock(mutex_);
+	wakeSource_.cancel();
+}
+
+std::shared_ptr<const LiveStreamHealthSnapshot> LiveStreamHealthMonitor::getSnapshot() const
+{
+	std::scoped_lock lock(mutex_);
+	return snapshot_;
+}
+
+Async::Task<void> LiveStreamHealthMonitor::run(std::shared_ptr<LiveStreamHealthMonitor> monitor)
+{
+	while (!monitor->stopped_.load(std::memory_order_relaxed)) {
+		std::string liveStreamId;
+		std::chrono::steady_clock::duration delay = kIdleSleep;
+		Async::CancellationToken wakeToken;
+		{
+			std::scoped_lock lock(monitor->mutex_);
+			if (monitor->stopped_.load(std::memory_order_relaxed)) {
+				break;
+			}
+			monitor->wakeSource_ = Async::CancellationSource();
+			wakeToken = monitor->wakeSource_.token();
+			if (!monitor->paused_ && !monitor->liveStreamId_.empty()) {
+				liveStreamId = monitor->liveStreamId_;
+				delay = monitor->nextCheckAt_ - std::chrono::steady_clock::now();
+			}
+		}
+
+		try {
+			co_await Async::sleepFor(delay, wakeToken);
+		} catch (const Async::OperationCancelledError &) {
+			// Woken by watch(), pause() or stop(); look at the new state first.
+			continue;
+		}
+		if (liveStreamId.empty()) {
+			continue;
+		}
+
+		co_await Async::ResumeOn{*monitor->networkExecutor_};
+		std::chrono::milliseconds interval = kFailedCheckInterval;
+		try {
+			interval = monitor->check(liveStreamId);
+		} catch (const std::exception &e) {
+			if (monitor->stopped_.load(std::memory_order_relaxed)) {
+				break;
+			}
+			monitor->logger_->warn("YouTubeLiveStreamHealthCheckError",
+					       {{"liveStreamId", liveStreamId}, {"exception", e.what()}});
+		}
+
+		std::scoped_lock lock(monitor->mutex_);
+		if (liveStreamId == monitor->liveStreamId_) {
+			monitor->nextCheckAt_ = std::chrono::steady_clock::now() + interval;
+		}
+	}
+}
+
+std::chrono::milliseconds LiveStreamHealthMonitor::check(const std::string &liveStreamId)
+{
+	const std::string accessToken = tokenProvider_->getAccessToken();
+	const std::array<std::string, 1> liveStreamIdArray{liveStreamId};
+	const std::vector<YouTubeApi::YouTubeLiveStream> liveStreams =
+		youTubeApiClient_->listLiveStreams(accessToken, liveStreamIdArray, kLiveStreamHealthMask);
+	if (liveStreams.empty() || !liveStreams[0].status) {
+		logger_->warn("YouTubeLiveStreamHealthNotFound", {{"liveStreamId", liveStreamId}});
+		return kFailedCheckInterval;
+	}
+
+	const YouTubeApi::YouTubeLiveStream::Status &status = *liveStreams[0].status;
+	const std::chrono::milliseconds interval =
+		isLiveStreamHealthy(status) ? kHealthyCheckInterval : kDegradedCheckInterval;
+
+	std::shared_ptr<const LiveStreamHealthSnapshot> snapshot;
+	ChangedCallback changedCallback;
+	{
+		std::scoped_lock lock(mutex_);
+		// A cutover may have begun while the request was in flight; its result is stale then.
+		if (paused_ || liveStreamId != liveStreamId_ ||
+		    (snapshot_->status && isSameHealth(*snapshot_->status, status))) {
+			return interval;
+		}
+		snapshot_ = std::make_shared<const LiveStreamHealthSnapshot>(LiveStreamHealthSnapshot{
+			.version = snapshot_->version + 1,
+			.liveStreamId = liveStreamId,
+			.status = status,
+		});
+		snapshot = snapshot_;
+		changedCallback = changedCallback_;
+	}
+
+	const auto &issues = status.healthStatus.configurationIssues;
+	logger_->info("YouTubeLiveStreamHealthChanged",
+		      {{"liveStreamId", liveStreamId},
+		       {"streamStatus", status.streamStatus},
+		       {"healthStatus", status.healthStatus.status},
+		       {"healthy", isLiveStreamHealthy(status) ? "true" : "false"},
+		       {"configurationIssues", std::to_string(issues.size())},
+		       {"firstIssue", issues.empty() ? std::string() : issues[0].reason}});
+
+	if (changedCallback) {
+		changedCallback(std::move(snapshot));
+	}
+	return interval;
+}
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Controller
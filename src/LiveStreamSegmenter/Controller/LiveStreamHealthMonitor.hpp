@@ -0,0 +1,134 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - Controller Module
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+
+#include <KaitoTokyo/Async/Cancellation.hpp>
+#include <KaitoTokyo/Async/Task.hpp>
+#include <KaitoTokyo/Async/ThreadPoolExecutor.hpp>
+#include <KaitoTokyo/Logger/ILogger.hpp>
+#include <KaitoTokyo/YouTubeApi/YouTubeApiClient.hpp>
+#include <KaitoTokyo/YouTubeApi/YouTubeTypes.hpp>
+
+#include <GoogleAccessTokenProvider.hpp>
+
+namespace KaitoTokyo::LiveStreamSegmenter::Controller {
+
+/**
+ * The last health reported by YouTube for the watched live stream.
+ */
+struct LiveStreamHealthSnapshot {
+	// Bumped whenever the watched live stream or its health changes.
+	std::uint64_t version = 0;
+	// Empty while no session is live.
+	std::string liveStreamId;
+	// std::nullopt until the first successful check of liveStreamId.
+	std::optional<YouTubeApi::YouTubeLiveStream::Status> status;
+};
+
+/**
+ * Whether the live stream is active and YouTube rates its ingest good or ok.
+ */
+bool isLiveStreamHealthy(const YouTubeApi::YouTubeLiveStream::Status &status) noexcept;
+
+/**
+ * Polls the health of the live stream that is currently live, in the background.
+ *
+ * A healthy live stream is checked rarely and a degraded one more often, so problems are noticed
+ * quickly without spending quota while all is well. The main loop pauses polling for cutovers,
+ * where the outgoing live stream goes inactive on purpose, and points it at the new live stream
+ * afterwards. Only changes of stream status, health status or configuration issues are logged and
+ * reported to the changed callback; the update time YouTube bumps on every check is ignored.
+ * Thread-safe.
+ */
+class LiveStreamHealthMonitor {
+public:
+	using ChangedCallback = std::function<void(std::shared_ptr<const LiveStreamHealthSnapshot>)>;
+
+	LiveStreamHealthMonitor(std::shared_ptr<YouTubeApi::YouTubeApiClient> youTubeApiClient,
+				std::shared_ptr<Store::GoogleAccessTokenProvider> tokenProvider,
+				std::shared_ptr<Async::ThreadPoolExecutor> networkExecutor,
+				std::shared_ptr<const Logger::ILogger> logger);
+	~LiveStreamHealthMonitor() noexcept = default;
+
+	LiveStreamHealthMonitor(const LiveStreamHealthMonitor &) = delete;
+	LiveStreamHealthMonitor &operator=(const LiveStreamHealthMonitor &) = delete;
+	LiveStreamHealthMonitor(LiveStreamHealthMonitor &&) = delete;
+	LiveStreamHealthMonitor &operator=(LiveStreamHealthMonitor &&) = delete;
+
+	/**
+	 * Called on a network thread after the health of the watched live stream changed.
+	 */
+	void setChangedCallback(ChangedCallback callback);
+
+	/**
+	 * Polls liveStreamId from now on and ends a pause. An empty id stops polling until the next call.
+	 * Watching the live stream already watched only ends the pause.
+	 */
+	void watch(const std::string &liveStreamId);
+
+	/**
+	 * Stops polling until the next watch(), for the duration of a cutover or reconnect.
+	 */
+	void pause();
+
+	/**
+	 * Ends run() at its next wake-up and aborts the request in flight.
+	 */
+	void stop();
+
+	std::shared_ptr<const LiveStreamHealthSnapshot> getSnapshot() const;
+
+	/**
+	 * The polling loop. Runs on the network executor and sleeps on the timer service until stop().
+	 */
+	static Async::Task<void> run(std::shared_ptr<LiveStreamHealthMonitor> monitor);
+
+private:
+	const std::shared_ptr<YouTubeApi::YouTubeApiClient> youTubeApiClient_;
+	const std::shared_ptr<Store::GoogleAccessTokenProvider> tokenProvider_;
+	const std::shared_ptr<Async::ThreadPoolExecutor> networkExecutor_;
+	const std::shared_ptr<const Logger::ILogger> logger_;
+	// Read by the abort predicate of the client without taking mutex_.
+	std::atomic<bool> stopped_{false};
+
+	mutable std::mutex mutex_;
+	ChangedCallback changedCallback_;
+	std::string liveStreamId_;
+	bool paused_ = false;
+	std::chrono::steady_clock::time_point nextCheckAt_;
+	// Cancelled to cut the current sleep short; replaced before every sleep.
+	Async::CancellationSource wakeSource_;
+	std::shared_ptr<const LiveStreamHealthSnapshot> snapshot_;
+
+	// Fetches the status of liveStreamId and publishes it if it changed. Returns the delay until the next check.
+	std::chrono::milliseconds check(const std::string &liveStreamId);
+};
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Controller
@@ -0,0 +1,167 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - Controller Module
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "LiveStreamRing.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace KaitoTokyo::LiveStreamSegmenter::Controller {
+
+namespace {
+
+// The journal only tells apart what recovery has to complete.
+std::string journalBroadcastState(LiveStreamSlotState state)
+{
+	switch (state) {
+	case LiveStreamSlotState::Live:
+		return "live";
+	case LiveStreamSlotState::Completing:
+		return "completing";
+	default:
+		return "created";
+	}
+}
+
+} // anonymous namespace
+
+std::string_view liveStreamSlotStateName(LiveStreamSlotState state) noexcept
+{
+	switch (state) {
+	case LiveStreamSlotState::Idle:
+		return "Idle";
+	case LiveStreamSlotState::Prepared:
+		return "Prepared";
+	case LiveStreamSlotState::Bound:
+		return "Bound";
+	case LiveStreamSlotState::Live:
+		return "Live";
+	case LiveStreamSlotState::Completing:
+		return "Completing";
+	}
+	return "Unknown";
+}
+
+LiveStreamRing::LiveStreamRing(const std::vector<std::string> &liveStreamIds)
+{
+	if (liveStreamIds.size() < 2) {
+		throw std::invalid_argument("LiveStreamRingTooSmallError(LiveStreamRing)");
+	}
+	if (std::ranges::any_of(liveStreamIds, [](const std::string &id) { return id.empty(); })) {
+		throw std::invalid_argument("LiveStreamIdIsEmptyError(LiveStreamRing)");
+	}
+
+	slots_.reserve(liveStreamIds.size());
+	for (const std::string &liveStreamId : liveStreamIds) {
+		slots_.push_back(LiveStreamSlot{.liveStreamId = liveStreamId});
+	}
+}
+
+std::vector<std::string> LiveStreamRing::getLiveStreamIds() const
+{
+	std::vector<std::string> liveStreamIds;
+	liveStreamIds.reserve(slots_.size());
+	for (const LiveStreamSlot &slot : slots_) {
+		liveStreamIds.push_back(slot.liveStreamId);
+	}
+	return liveStreamIds;
+}
+
+void LiveStreamRing::assignPrepared(std::size_t index, YouTubeApi::YouTubeLiveBroadcast liveBroadcast)
+{
+	LiveStreamSlot &slot = at(index);
+	if (slot.state == LiveStreamSlotState::Live || slot.state == LiveStreamSlotState::Completing) {
+		slot.queuedLiveBroadcast = std::move(liveBroadcast);
+		return;
+	}
+	slot.state = LiveStreamSlotState::Prepared;
+	slot.liveBroadcast = std::move(liveBroadcast);
+}
+
+void LiveStreamRing::settle()
+{
+	for (LiveStreamSlot &slot : slots_) {
+		if (slot.state != LiveStreamSlotState::Completing || !slot.completed || !slot.completed->isSet()) {
+			continue;
+		}
+		slot.completed.reset();
+		if (slot.queuedLiveBroadcast) {
+			slot.state = LiveStreamSlotState::Prepared;
+			slot.liveBroadcast = std::move(*slot.queuedLiveBroadcast);
+			slot.queuedLiveBroadcast.reset();
+		} else {
+			slot.state = LiveStreamSlotState::Idle;
+			slot.liveBroadcast = {};
+		}
+	}
+}
+
+std::vector<std::shared_ptr<Async::OneShotEvent>> LiveStreamRing::getPendingCompletions() const
+{
+	std::vector<std::shared_ptr<Async::OneShotEvent>> completions;
+	for (const LiveStreamSlot &slot : slots_) {
+		if (slot.state == LiveStreamSlotState::Completing && slot.completed && !slot.completed->isSet()) {
+			completions.push_back(slot.completed);
+		}
+	}
+	return completions;
+}
+
+void LiveStreamRing::reset() noexcept
+{
+	for (LiveStreamSlot &slot : slots_) {
+		slot.state = LiveStreamSlotState::Idle;
+		slot.liveBroadcast = {};
+		slot.completed.reset();
+		slot.queuedLiveBroadcast.reset();
+	}
+}
+
+Store::SessionJournalRecord LiveStreamRing::makeJournalRecord(std::string phase) const
+{
+	Store::SessionJournalRecord record{
+		.phase = std::move(phase),
+		.currentLiveStreamIndex = currentIndex_,
+		.broadcasts = {},
+		.liveStreamIds = getLiveStreamIds(),
+	};
+
+	for (std::size_t index = 0; index < slots_.size(); ++index) {
+		const LiveStreamSlot &slot = slots_[index];
+		if (slot.state != LiveStreamSlotState::Idle) {
+			record.broadcasts.push_back({
+				.id = slot.liveBroadcast.id.value_or(""),
+				.liveStreamIndex = index,
+				.state = journalBroadcastState(slot.state),
+			});
+		}
+		if (slot.queuedLiveBroadcast) {
+			record.broadcasts.push_back({
+				.id = slot.queuedLiveBroadcast->id.value_or(""),
+				.liveStreamIndex = index,
+				.state = "created",
+			});
+		}
+	}
+	return record;
+}
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Controller
@@ -0,0 +1,132 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - Controller Module
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <KaitoTokyo/Async/OneShotEvent.hpp>
+#include <KaitoTokyo/YouTubeApi/YouTubeTypes.hpp>
+
+#include <SessionJournal.hpp>
+
+namespace KaitoTokyo::LiveStreamSegmenter::Controller {
+
+/**
+ * Where a live stream of the ring is in its turn.
+ *
+ * Idle carries nothing. Prepared holds the broadcast that will go live on it, and Bound means
+ * that broadcast is already bound to the live stream. Live carries the current broadcast, and
+ * Completing is a former Live slot whose broadcast is being completed in the background.
+ */
+enum class LiveStreamSlotState {
+	Idle,
+	Prepared,
+	Bound,
+	Live,
+	Completing,
+};
+
+std::string_view liveStreamSlotStateName(LiveStreamSlotState state) noexcept;
+
+struct LiveStreamSlot {
+	std::string liveStreamId;
+	LiveStreamSlotState state = LiveStreamSlotState::Idle;
+	// Empty while Idle.
+	YouTubeApi::YouTubeLiveBroadcast liveBroadcast;
+	// Set once the background completion has finished, whether it succeeded or not. Only set while Completing.
+	std::shared_ptr<Async::OneShotEvent> completed;
+	// A broadcast created for this live stream while it was still Live or Completing.
+	// It becomes the Prepared one on settle().
+	std::optional<YouTubeApi::YouTubeLiveBroadcast> queuedLiveBroadcast;
+};
+
+/**
+ * The live streams a continuous session rotates through, in the order they take turns.
+ *
+ * The current slot is Live and the one after it receives the next broadcast. A slot that goes out
+ * of turn is Completing until its broadcast has been completed, which no longer holds up the
+ * cutover; with three or more live streams it does not hold up the next prepare either.
+ * Not thread-safe: the main loop is the only one to touch it.
+ */
+class LiveStreamRing {
+public:
+	LiveStreamRing() = default;
+
+	/**
+	 * Throws std::invalid_argument when fewer than two ids are given or any of them is empty.
+	 */
+	explicit LiveStreamRing(const std::vector<std::string> &liveStreamIds);
+
+	bool empty() const noexcept { return slots_.empty(); }
+	std::size_t size() const noexcept { return slots_.size(); }
+
+	std::size_t next(std::size_t index) const noexcept { return (index + 1) % slots_.size(); }
+
+	std::size_t getCurrentIndex() const noexcept { return currentIndex_; }
+	void setCurrentIndex(std::size_t index) noexcept { currentIndex_ = slots_.empty() ? 0 : index % slots_.size(); }
+
+	LiveStreamSlot &at(std::size_t index) { return slots_.at(index); }
+	const LiveStreamSlot &at(std::size_t index) const { return slots_.at(index); }
+
+	LiveStreamSlot &current() { return at(currentIndex_); }
+	LiveStreamSlot &incoming() { return at(next(currentIndex_)); }
+
+	// Makes the incoming slot current.
+	void advance() noexcept { currentIndex_ = next(currentIndex_); }
+
+	std::vector<std::string> getLiveStreamIds() const;
+
+	/**
+	 * Gives the slot a broadcast to go live on it next. A slot that is still Live or Completing
+	 * keeps it queued until settle() finds the completion finished.
+	 */
+	void assignPrepared(std::size_t index, YouTubeApi::YouTubeLiveBroadcast liveBroadcast);
+
+	/**
+	 * Moves the Completing slots whose completion has finished to Prepared, when a broadcast is
+	 * queued for them, or to Idle.
+	 */
+	void settle();
+
+	/**
+	 * The completions still in flight, to wait on before the slots are reused or swept.
+	 */
+	std::vector<std::shared_ptr<Async::OneShotEvent>> getPendingCompletions() const;
+
+	// Drops every broadcast and keeps the live streams.
+	void reset() noexcept;
+
+	/**
+	 * Snapshot of every broadcast in the ring. Live and Completing broadcasts may still be live on YouTube.
+	 */
+	Store::SessionJournalRecord makeJournalRecord(std::string phase) const;
+
+private:
+	std::vector<LiveStreamSlot> slots_;
+	std::size_t currentIndex_ = 0;
+};
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Controller
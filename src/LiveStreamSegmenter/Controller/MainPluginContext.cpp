@@ -20,15 +20,21 @@
 
 #include "MainPluginContext.hpp"
 
+#include <chrono>
+#include <cstdlib>
+#include <exception>
 #include <memory>
 #include <mutex>
+#include <string>
 
 #include <QMainWindow>
 
 #include <obs-frontend-api.h>
 #include <obs-module.h>
 
-#include <KaitoTokyo/CurlHelper/CurlHandle.hpp>
+#include <KaitoTokyo/CurlHelper/CurlConnectionPool.hpp>
+#include <KaitoTokyo/CurlHelper/CurlTransferTape.hpp>
+#include <KaitoTokyo/Logger/AsyncLogger.hpp>
 #include <KaitoTokyo/Logger/ILogger.hpp>
 #include <KaitoTokyo/Logger/MultiLogger.hpp>
 
@@ -39,6 +45,30 @@
 
 namespace KaitoTokyo::LiveStreamSegmenter::Controller {
 
+namespace {
+
+// For measuring the API layer against real traffic: LIVE_STREAM_SEGMENTER_RECORD_HTTP=<path> records the
+// YouTube and OAuth transfers of this run, and LIVE_STREAM_SEGMENTER_REPLAY_HTTP=<path> answers them from
+// such a recording instead of the network.
+void installTransferTape(CurlHelper::CurlConnectionPool &curlPool, const Logger::ILogger &logger)
+{
+	using Mode = CurlHelper::CurlTransferTape::Mode;
+
+	try {
+		if (const char *path = std::getenv("LIVE_STREAM_SEGMENTER_REPLAY_HTTP"); path && *path) {
+			curlPool.setTransferTape(std::make_shared<CurlHelper::CurlTransferTape>(Mode::Replay, path));
+			logger.warn("HttpTransfersReplayed", {{"path", path}});
+		} else if (const char *path = std::getenv("LIVE_STREAM_SEGMENTER_RECORD_HTTP"); path && *path) {
+			curlPool.setTransferTape(std::make_shared<CurlHelper::CurlTransferTape>(Mode::Record, path));
+			logger.warn("HttpTransfersRecorded", {{"path", path}});
+		}
+	} catch (const std::exception &e) {
+		logger.error("HttpTransferTapeError", {{"exception", e.what()}});
+	}
+}
+
+} // anonymous namespace
+
 MainPluginContext::~MainPluginContext() noexcept
 {
 	obs_frontend_remove_event_callback(handleFrontendEvent, handleFrontendEventWeakSelfPtr_);
@@ -50,6 +80,7 @@ std::shared_ptr<MainPluginContext> MainPluginContext::create(std::shared_ptr<con
 {
 	auto self = std::shared_ptr<MainPluginContext>(new MainPluginContext(std::move(logger), mainWindow));
 	self->registerFrontendEventCallback();
+	self->registerActivationTrigger();
 	return self;
 }
 
@@ -64,23 +95,21 @@ std::shared_ptr<const Logger::ILogger> composeLogger(std::shared_ptr<const Logge
 	if (!dock) {
 		throw std::invalid_argument("DockIsNullError(composeLogger)");
 	}
-	return std::make_shared<Logger::MultiLogger>(
+	// One writer thread drains for both sinks, so the main loop never waits on blog() or the dock.
+	auto multiLogger = std::make_shared<Logger::MultiLogger>(
 		std::vector<std::shared_ptr<const Logger::ILogger>>{std::move(logger), dock->getLoggerAdapter()});
+	return std::make_shared<Logger::AsyncLogger>(std::move(multiLogger));
 }
 
 } // anonymous namespace
 
 MainPluginContext::MainPluginContext(std::shared_ptr<const Logger::ILogger> logger, QMainWindow *mainWindow)
-	: runtime_(std::make_shared<Scripting::ScriptingRuntime>()),
-	  dock_(new UI::StreamSegmenterDock(runtime_, mainWindow)),
+	: dock_(new UI::StreamSegmenterDock(mainWindow)),
 	  logger_(composeLogger(std::move(logger), dock_))
 {
-	runtime_->setLogger(logger_);
 	dock_->setLogger(logger_);
 
 	obs_frontend_add_dock_by_id("live_stream_segmenter_dock", obs_module_text("LiveStreamSegmenterDock"), dock_);
-
-	profileContext_ = std::make_shared<ProfileContext>(runtime_, logger_, dock_);
 }
 
 void MainPluginContext::registerFrontendEventCallback()
@@ -89,6 +118,51 @@ void MainPluginContext::registerFrontendEventCallback()
 	obs_frontend_add_event_callback(handleFrontendEvent, handleFrontendEventWeakSelfPtr_);
 }
 
+void MainPluginContext::registerActivationTrigger()
+{
+	// Queued, so a dock restored as visible with the OBS window does not hold up its first paint.
+	QObject::connect(
+		dock_, &UI::StreamSegmenterDock::firstShown, dock_,
+		[weakSelf = weak_from_this()]() {
+			if (auto self = weakSelf.lock()) {
+				try {
+					self->activate();
+				} catch (const std::exception &e) {
+					self->logger_->error("PluginActivationError", {{"exception", e.what()}});
+				} catch (...) {
+					self->logger_->error("PluginActivationError");
+				}
+			}
+		},
+		Qt::QueuedConnection);
+}
+
+void MainPluginContext::activate()
+{
+	std::scoped_lock lock(mutex_);
+	if (profileContext_) {
+		return;
+	}
+
+	const auto startTime = std::chrono::steady_clock::now();
+
+	if (!runtime_) {
+		auto runtime = std::make_shared<Scripting::ScriptingRuntime>();
+		runtime->setLogger(logger_);
+		runtime->setExecutor(std::make_shared<Scripting::ScriptingExecutor>());
+		curlPool_ = std::make_shared<CurlHelper::CurlConnectionPool>();
+		installTransferTape(*curlPool_, *logger_);
+		executors_ = std::make_shared<PluginExecutors>();
+		runtime_ = std::move(runtime);
+	}
+
+	profileContext_ = std::make_shared<ProfileContext>(runtime_, curlPool_, executors_, logger_, dock_);
+
+	const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() -
+										   startTime);
+	logger_->info("PluginActivated", {{"elapsedMilliseconds", std::to_string(elapsed.count())}});
+}
+
 void MainPluginContext::handleFrontendEvent(enum obs_frontend_event event, void *private_data) noexcept
 {
 	auto *weakSelfPtr = static_cast<std::weak_ptr<MainPluginContext> *>(private_data);
@@ -100,8 +174,12 @@ void MainPluginContext::handleFrontendEvent(enum obs_frontend_event event, void
 				self->profileContext_.reset();
 			} else if (event == OBS_FRONTEND_EVENT_PROFILE_CHANGED) {
 				std::scoped_lock lock(self->mutex_);
-				self->profileContext_ =
-					std::make_shared<ProfileContext>(self->runtime_, self->logger_, self->dock_);
+				if (self->runtime_) {
+					// Before activation, activate() picks up the new profile.
+					self->profileContext_ = std::make_shared<ProfileContext>(
+						self->runtime_, self->curlPool_, self->executors_, self->logger_,
+						self->dock_);
+				}
 				self->logger_->info("ProfileChanged");
 			}
 		} catch (...) {
@@ -28,11 +28,12 @@
 #include <obs-frontend-api.h>
 
 #include <KaitoTokyo/Logger/ILogger.hpp>
-#include <KaitoTokyo/CurlHelper/CurlHandle.hpp>
+#include <KaitoTokyo/CurlHelper/CurlConnectionPool.hpp>
 
 #include <ScriptingRuntime.hpp>
 #include <StreamSegmenterDock.hpp>
 
+#include "PluginExecutors.hpp"
 #include "ProfileContext.hpp"
 
 namespace KaitoTokyo::LiveStreamSegmenter::Controller {
@@ -53,14 +54,27 @@ private:
 	MainPluginContext(std::shared_ptr<const Logger::ILogger> logger, QMainWindow *mainWindow);
 
 	void registerFrontendEventCallback();
+	void registerActivationTrigger();
+
+	/**
+	 * Builds the scripting runtime, the HTTP stack, the worker pools and the profile context.
+	 *
+	 * Deferred until the dock is first shown, which is also the only way to start a session, so OBS
+	 * does not pay for them at startup. Safe to call more than once.
+	 */
+	void activate();
 
 	static void handleFrontendEvent(enum obs_frontend_event event, void *private_data) noexcept;
 
-	const std::shared_ptr<Scripting::ScriptingRuntime> runtime_;
 	UI::StreamSegmenterDock *const dock_ = nullptr;
 	const std::shared_ptr<const Logger::ILogger> logger_;
 
 	mutable std::mutex mutex_;
+	// Null until activate().
+	std::shared_ptr<Scripting::ScriptingRuntime> runtime_;
+	std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool_;
+	// Outlives every profile, so work a profile left queued still has threads to run on.
+	std::shared_ptr<PluginExecutors> executors_;
 	std::shared_ptr<ProfileContext> profileContext_;
 	std::weak_ptr<MainPluginContext> *handleFrontendEventWeakSelfPtr_ = nullptr;
 };
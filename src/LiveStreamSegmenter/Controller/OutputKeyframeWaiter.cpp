@@ -0,0 +1,70 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - Controller Module
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "OutputKeyframeWaiter.hpp"
+
+#include <stdexcept>
+
+#include <KaitoTokyo/Async/TimerService.hpp>
+
+namespace KaitoTokyo::LiveStreamSegmenter::Controller {
+
+OutputKeyframeWaiter::OutputKeyframeWaiter(obs_output_t *output)
+	: output_(output ? obs_output_get_ref(output)
+			 : throw std::invalid_argument("OutputIsNullError(OutputKeyframeWaiter)"))
+{
+	obs_output_add_packet_callback(output_.get(), &OutputKeyframeWaiter::onPacket, this);
+}
+
+OutputKeyframeWaiter::~OutputKeyframeWaiter() noexcept
+{
+	// Once this returns the output no longer calls onPacket, so the members can go.
+	obs_output_remove_packet_callback(output_.get(), &OutputKeyframeWaiter::onPacket, this);
+}
+
+Async::Task<bool> OutputKeyframeWaiter::waitForNextKeyframe(std::chrono::milliseconds timeout,
+							     Async::CancellationToken cancellationToken)
+{
+	Async::CancellationCallback cancellationCallback(cancellationToken,
+							 [source = wakeSource_]() mutable { source.cancel(); });
+
+	try {
+		co_await Async::sleepFor(timeout, wakeSource_.token());
+	} catch (const Async::OperationCancelledError &) {
+		// Woken early by a keyframe or by the caller's token; keyframeSent_ tells which.
+	}
+	co_return keyframeSent_.load(std::memory_order_acquire);
+}
+
+void OutputKeyframeWaiter::onPacket([[maybe_unused]] obs_output_t *output, encoder_packet *packet,
+				    [[maybe_unused]] encoder_packet_time *packetTime, void *param) noexcept
+{
+	// Runs on the output's send thread for every packet, so it only flips a flag and queues a wake-up.
+	if (!packet || packet->type != OBS_ENCODER_VIDEO || !packet->keyframe) {
+		return;
+	}
+
+	auto *self = static_cast<OutputKeyframeWaiter *>(param);
+	if (!self->keyframeSent_.exchange(true, std::memory_order_acq_rel)) {
+		self->wakeSource_.cancel();
+	}
+}
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Controller
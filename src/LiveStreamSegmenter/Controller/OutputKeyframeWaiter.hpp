@@ -0,0 +1,74 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - Controller Module
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+
+#include <obs.h>
+
+#include <KaitoTokyo/Async/Cancellation.hpp>
+#include <KaitoTokyo/Async/Task.hpp>
+#include <KaitoTokyo/ObsBridgeUtils/ObsUnique.hpp>
+
+namespace KaitoTokyo::LiveStreamSegmenter::Controller {
+
+/**
+ * Watches the packets an OBS output sends, so that a cut can wait for the next video keyframe.
+ *
+ * Stopping an output right after a keyframe went out ends the broadcast on a complete GOP, and
+ * lands the cut on a frame boundary instead of wherever the segment timer fired. The packet
+ * callback is installed by the constructor and removed by the destructor, so arm the waiter
+ * when the boundary is due and destroy it once the cut is made.
+ */
+class OutputKeyframeWaiter {
+public:
+	/**
+	 * Takes a reference to output for the lifetime of the waiter. Throws if output is null.
+	 */
+	explicit OutputKeyframeWaiter(obs_output_t *output);
+	~OutputKeyframeWaiter() noexcept;
+
+	OutputKeyframeWaiter(const OutputKeyframeWaiter &) = delete;
+	OutputKeyframeWaiter &operator=(const OutputKeyframeWaiter &) = delete;
+	OutputKeyframeWaiter(OutputKeyframeWaiter &&) = delete;
+	OutputKeyframeWaiter &operator=(OutputKeyframeWaiter &&) = delete;
+
+	/**
+	 * Completes once the output has sent a video keyframe since the waiter was constructed, without
+	 * holding a thread meanwhile. Returns false when timeout passes or cancellationToken is cancelled
+	 * first. Resumes on the timer thread, so callers should hop back to their executor.
+	 */
+	Async::Task<bool> waitForNextKeyframe(std::chrono::milliseconds timeout,
+					      Async::CancellationToken cancellationToken = {});
+
+private:
+	static void onPacket(obs_output_t *output, encoder_packet *packet, encoder_packet_time *packetTime,
+			     void *param) noexcept;
+
+	const ObsBridgeUtils::unique_obs_output_t output_;
+
+	std::atomic<bool> keyframeSent_ = false;
+	// Cancelled by the first keyframe or the caller's token, which ends the sleep in waitForNextKeyframe().
+	Async::CancellationSource wakeSource_;
+};
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Controller
@@ -0,0 +1,196 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - Controller Module
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "OverlappingStreamingOutputs.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <obs-frontend-api.h>
+
+namespace KaitoTokyo::LiveStreamSegmenter::Controller {
+
+ObsBridgeUtils::unique_obs_service_t createYouTubeStreamingService(const YouTubeApi::YouTubeLiveStream &liveStream,
+								   std::shared_ptr<const Logger::ILogger> logger)
+{
+	if (liveStream.cdn.ingestionType == "rtmp") {
+		logger->info("OBSStreamingYouTubeRTMPServiceCreating");
+
+		auto settings = ObsBridgeUtils::unique_obs_data_t(obs_data_create());
+		obs_data_set_string(settings.get(), "service", "YouTube - RTMP");
+		obs_data_set_string(settings.get(), "server", "rtmps://a.rtmps.youtube.com:443/live2");
+		obs_data_set_string(settings.get(), "key", liveStream.cdn.ingestionInfo.streamName.c_str());
+
+		ObsBridgeUtils::unique_obs_service_t service(
+			obs_service_create("rtmp_common", "YouTube RTMP Service", settings.get(), NULL));
+
+		logger->info("OBSStreamingYouTubeRTMPServiceCreated");
+		return service;
+	} else if (liveStream.cdn.ingestionType == "hls") {
+		logger->info("OBSStreamingYouTubeHLSServiceCreating");
+
+		auto settings = ObsBridgeUtils::unique_obs_data_t(obs_data_create());
+		obs_data_set_string(settings.get(), "service", "YouTube - HLS");
+		obs_data_set_string(
+			settings.get(), "server",
+			"https://a.upload.youtube.com/http_upload_hls?cid={stream_key}&copy=0&file=out.m3u8");
+		obs_data_set_string(settings.get(), "key", liveStream.cdn.ingestionInfo.streamName.c_str());
+
+		ObsBridgeUtils::unique_obs_service_t service(
+			obs_service_create("rtmp_common", "YouTube HLS Service", settings.get(), NULL));
+
+		logger->info("OBSStreamingYouTubeHLSServiceCreated");
+		return service;
+	} else {
+		logger->error("OBSStreamingUnsupportedYouTubeIngestionTypeError",
+			      {{"ingestionType", liveStream.cdn.ingestionType}});
+		throw std::runtime_error(
+			"OBSStreamingUnsupportedYouTubeIngestionTypeError(createYouTubeStreamingService)");
+	}
+}
+
+OverlappingStreamingOutputs::~OverlappingStreamingOutputs() noexcept
+{
+	for (ObsBridgeUtils::unique_obs_output_t &output : outputs_) {
+		if (output) {
+			obs_output_stop(output.get());
+		}
+	}
+}
+
+void OverlappingStreamingOutputs::start(std::size_t liveStreamIndex, std::size_t sourceLiveStreamIndex,
+					const YouTubeApi::YouTubeLiveStream &liveStream,
+					std::shared_ptr<const Logger::ILogger> logger)
+{
+	std::scoped_lock lock(mutex_);
+
+	if (liveStreamIndex >= outputs_.size() || sourceLiveStreamIndex >= outputs_.size() ||
+	    liveStreamIndex == sourceLiveStreamIndex) {
+		logger->error("OBSStreamingOverlapIndexOutOfRange",
+			      {{"liveStreamIndex", std::to_string(liveStreamIndex)},
+			       {"sourceLiveStreamIndex", std::to_string(sourceLiveStreamIndex)}});
+		throw std::out_of_range("OBSStreamingOverlapIndexOutOfRange(OverlappingStreamingOutputs::start)");
+	}
+
+	if (outputs_[liveStreamIndex]) {
+		logger->warn("OBSStreamingOverlapOutputReplaced",
+			     {{"liveStreamIndex", std::to_string(liveStreamIndex)}});
+		obs_output_stop(outputs_[liveStreamIndex].get());
+		outputs_[liveStreamIndex].reset();
+		services_[liveStreamIndex].reset();
+	}
+
+	// The outgoing live stream is carried either by its own slot or by the frontend output.
+	ObsBridgeUtils::unique_obs_output_t frontendOutput;
+	obs_output_t *sourceOutput = outputs_[sourceLiveStreamIndex].get();
+	if (!sourceOutput) {
+		frontendOutput.reset(obs_frontend_get_streaming_output());
+		sourceOutput = frontendOutput.get();
+	}
+
+	if (!sourceOutput || !obs_output_active(sourceOutput)) {
+		logger->error("OBSStreamingOverlapSourceInactive");
+		throw std::runtime_error("OBSStreamingOverlapSourceInactive(OverlappingStreamingOutputs::start)");
+	}
+
+	obs_encoder_t *videoEncoder = obs_output_get_video_encoder(sourceOutput);
+	obs_encoder_t *audioEncoder = obs_output_get_audio_encoder(sourceOutput, 0);
+	if (!videoEncoder || !audioEncoder) {
+		logger->error("OBSStreamingOverlapEncoderMissing");
+		throw std::runtime_error("OBSStreamingOverlapEncoderMissing(OverlappingStreamingOutputs::start)");
+	}
+
+	ObsBridgeUtils::unique_obs_service_t service = createYouTubeStreamingService(liveStream, logger);
+
+	const char *preferredOutputType = obs_service_get_preferred_output_type(service.get());
+	const std::string outputType = preferredOutputType ? preferredOutputType : "rtmp_output";
+	const std::string outputName = "Live Stream Segmenter Output " + std::to_string(liveStreamIndex);
+
+	ObsBridgeUtils::unique_obs_output_t output(
+		obs_output_create(outputType.c_str(), outputName.c_str(), nullptr, nullptr));
+	if (!output) {
+		logger->error("OBSStreamingOverlapOutputCreateError", {{"outputType", outputType}});
+		throw std::runtime_error("OBSStreamingOverlapOutputCreateError(OverlappingStreamingOutputs::start)");
+	}
+
+	obs_output_set_video_encoder(output.get(), videoEncoder);
+	obs_output_set_audio_encoder(output.get(), audioEncoder, 0);
+	obs_output_set_service(output.get(), service.get());
+
+	logger->info("OBSStreamingOverlapOutputStarting",
+		     {{"liveStreamIndex", std::to_string(liveStreamIndex)}, {"outputType", outputType}});
+
+	if (!obs_output_start(output.get())) {
+		const char *lastError = obs_output_get_last_error(output.get());
+		logger->error("OBSStreamingOverlapOutputStartError",
+			      {{"liveStreamIndex", std::to_string(liveStreamIndex)},
+			       {"lastError", lastError ? lastError : "(UNKNOWN)"}});
+		throw std::runtime_error("OBSStreamingOverlapOutputStartError(OverlappingStreamingOutputs::start)");
+	}
+
+	logger->info("OBSStreamingOverlapOutputStarted", {{"liveStreamIndex", std::to_string(liveStreamIndex)}});
+
+	outputs_[liveStreamIndex] = std::move(output);
+	services_[liveStreamIndex] = std::move(service);
+}
+
+bool OverlappingStreamingOutputs::stop(std::size_t liveStreamIndex, std::shared_ptr<const Logger::ILogger> logger)
+{
+	std::scoped_lock lock(mutex_);
+
+	if (liveStreamIndex >= outputs_.size() || !outputs_[liveStreamIndex]) {
+		return false;
+	}
+
+	logger->info("OBSStreamingOverlapOutputStopping", {{"liveStreamIndex", std::to_string(liveStreamIndex)}});
+
+	obs_output_stop(outputs_[liveStreamIndex].get());
+	outputs_[liveStreamIndex].reset();
+	services_[liveStreamIndex].reset();
+
+	logger->info("OBSStreamingOverlapOutputStopped", {{"liveStreamIndex", std::to_string(liveStreamIndex)}});
+
+	return true;
+}
+
+bool OverlappingStreamingOutputs::hasOutput(std::size_t liveStreamIndex)
+{
+	std::scoped_lock lock(mutex_);
+	return liveStreamIndex < outputs_.size() && outputs_[liveStreamIndex];
+}
+
+ObsBridgeUtils::unique_obs_output_t OverlappingStreamingOutputs::getCarryingOutput(std::size_t liveStreamIndex)
+{
+	std::scoped_lock lock(mutex_);
+	if (liveStreamIndex < outputs_.size() && outputs_[liveStreamIndex]) {
+		return ObsBridgeUtils::unique_obs_output_t(obs_output_get_ref(outputs_[liveStreamIndex].get()));
+	}
+	return ObsBridgeUtils::unique_obs_output_t(obs_frontend_get_streaming_output());
+}
+
+void OverlappingStreamingOutputs::stopAll(std::shared_ptr<const Logger::ILogger> logger)
+{
+	for (std::size_t i = 0; i < outputs_.size(); ++i) {
+		stop(i, logger);
+	}
+}
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Controller
@@ -0,0 +1,98 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - Controller Module
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+
+#include <KaitoTokyo/Logger/ILogger.hpp>
+#include <KaitoTokyo/ObsBridgeUtils/ObsUnique.hpp>
+#include <KaitoTokyo/YouTubeApi/YouTubeTypes.hpp>
+
+#include <YouTubeStore.hpp>
+
+namespace KaitoTokyo::LiveStreamSegmenter::Controller {
+
+/**
+ * Creates an OBS service that streams to the ingestion point of the given live stream.
+ */
+ObsBridgeUtils::unique_obs_service_t createYouTubeStreamingService(const YouTubeApi::YouTubeLiveStream &liveStream,
+								   std::shared_ptr<const Logger::ILogger> logger);
+
+/**
+ * Segmenter-owned OBS outputs used for make-before-break cutovers.
+ *
+ * At a boundary the incoming live stream gets its own output, sharing the encoders of
+ * whichever output is currently streaming, so both streams run until the incoming one is
+ * live. Slots are indexed by live stream index. A live stream with no slot output is
+ * assumed to be carried by the frontend streaming output.
+ */
+class OverlappingStreamingOutputs {
+public:
+	OverlappingStreamingOutputs() = default;
+	~OverlappingStreamingOutputs() noexcept;
+
+	OverlappingStreamingOutputs(const OverlappingStreamingOutputs &) = delete;
+	OverlappingStreamingOutputs &operator=(const OverlappingStreamingOutputs &) = delete;
+	OverlappingStreamingOutputs(OverlappingStreamingOutputs &&) = delete;
+	OverlappingStreamingOutputs &operator=(OverlappingStreamingOutputs &&) = delete;
+
+	void setEnabled(bool enabled) noexcept { enabled_.store(enabled, std::memory_order_relaxed); }
+	bool isEnabled() const noexcept { return enabled_.load(std::memory_order_relaxed); }
+
+	/**
+	 * Starts an output for the live stream at liveStreamIndex alongside the one carrying sourceLiveStreamIndex.
+	 * Throws if there is no running output to share encoders with or the output fails to start.
+	 */
+	void start(std::size_t liveStreamIndex, std::size_t sourceLiveStreamIndex,
+		   const YouTubeApi::YouTubeLiveStream &liveStream, std::shared_ptr<const Logger::ILogger> logger);
+
+	/**
+	 * Stops and releases the output at liveStreamIndex.
+	 * Returns false when the slot is empty, meaning the frontend output carries that live stream.
+	 */
+	bool stop(std::size_t liveStreamIndex, std::shared_ptr<const Logger::ILogger> logger);
+
+	void stopAll(std::shared_ptr<const Logger::ILogger> logger);
+
+	/**
+	 * Whether the live stream at liveStreamIndex has an output of its own rather than the frontend one.
+	 */
+	bool hasOutput(std::size_t liveStreamIndex);
+
+	/**
+	 * Returns a new reference to the output carrying the live stream at liveStreamIndex: its own output
+	 * if it has one, or else the frontend streaming output. Null if there is neither.
+	 */
+	ObsBridgeUtils::unique_obs_output_t getCarryingOutput(std::size_t liveStreamIndex);
+
+private:
+	std::atomic<bool> enabled_{false};
+
+	std::mutex mutex_;
+	std::array<ObsBridgeUtils::unique_obs_output_t, Store::YouTubeStore::kMaxLiveStreams> outputs_;
+	std::array<ObsBridgeUtils::unique_obs_service_t, Store::YouTubeStore::kMaxLiveStreams> services_;
+};
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Controller
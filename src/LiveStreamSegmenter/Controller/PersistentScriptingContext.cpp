@@ -0,0 +1,169 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - Controller Module
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "PersistentScriptingContext.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+#include <quickjs.h>
+
+namespace KaitoTokyo::LiveStreamSegmenter::Controller {
+
+namespace {
+
+// Optional export that lets an event handler clear module-level state before each event.
+constexpr const char *kResetEventStateFunctionName = "onResetEventState";
+
+} // anonymous namespace
+
+PersistentScriptingContext::PersistentScriptingContext(std::shared_ptr<Scripting::ScriptingRuntime> runtime,
+						       std::shared_ptr<Store::EventHandlerStore> eventHandlerStore,
+						       std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool,
+						       std::shared_ptr<CurlHelper::CurlMultiExecutor> curlExecutor,
+						       std::shared_ptr<const Logger::ILogger> logger)
+	: runtime_(runtime ? std::move(runtime)
+			   : throw std::invalid_argument("RuntimeIsNullError(PersistentScriptingContext)")),
+	  eventHandlerStore_(eventHandlerStore
+				     ? std::move(eventHandlerStore)
+				     : throw std::invalid_argument(
+					       "EventHandlerStoreIsNullError(PersistentScriptingContext)")),
+	  curlPool_(curlPool ? std::move(curlPool)
+			     : throw std::invalid_argument("CurlPoolIsNullError(PersistentScriptingContext)")),
+	  curlExecutor_(std::move(curlExecutor)),
+	  logger_(logger ? std::move(logger)
+			 : throw std::invalid_argument("LoggerIsNullError(PersistentScriptingContext)"))
+{
+}
+
+PersistentScriptingContext::~PersistentScriptingContext() noexcept = default;
+
+void PersistentScriptingContext::warm()
+{
+	std::scoped_lock lock(mutex_);
+	ensureBuilt();
+}
+
+std::shared_ptr<Scripting::EventScriptingContext> PersistentScriptingContext::acquire()
+{
+	std::scoped_lock lock(mutex_);
+	ensureBuilt();
+	// Other sessions and the settings dialog write the same table, so pick up their changes per event.
+	database_->revalidateLocalStorage();
+	resetEventState();
+	return context_;
+}
+
+Async::Task<std::shared_ptr<Scripting::EventScriptingContext>> PersistentScriptingContext::acquireTask()
+{
+	co_await Scripting::ScriptingExecutor::ScheduleAwaiter(runtime_->getExecutor());
+	co_return acquire();
+}
+
+void PersistentScriptingContext::invalidate()
+{
+	std::scoped_lock lock(mutex_);
+	context_.reset();
+	fetch_.reset();
+	database_.reset();
+	ctx_.reset();
+	loadedSnapshot_.reset();
+}
+
+void PersistentScriptingContext::ensureBuilt()
+{
+	const std::shared_ptr<const Store::EventHandlerSnapshot> snapshot = eventHandlerStore_->getSnapshot();
+	if (context_ && snapshot->version == loadedSnapshot_->version) {
+		return;
+	}
+
+	// Applied whenever the store changed so that new settings take effect without rebuilding the context.
+	const Store::EventHandlerExecutionSettings &executionSettings = snapshot->executionSettings;
+	const auto nonNegative = [](std::int64_t value) { return std::max<std::int64_t>(value, 0); };
+	runtime_->setLimits({
+		.executionBudget = std::chrono::milliseconds(nonNegative(executionSettings.timeBudgetMilliseconds)),
+		.memoryLimit = static_cast<std::size_t>(nonNegative(executionSettings.memoryLimitBytes)),
+		.gcThreshold = static_cast<std::size_t>(nonNegative(executionSettings.gcThresholdBytes)),
+	});
+
+	if (context_ && snapshot->eventHandlerScript == loadedSnapshot_->eventHandlerScript) {
+		loadedSnapshot_ = snapshot;
+		return;
+	}
+
+	logger_->info("ScriptingContextBuilding");
+	const auto startTime = std::chrono::steady_clock::now();
+
+	// Release the previous context before creating the new one so the database is never opened twice.
+	context_.reset();
+	fetch_.reset();
+	database_.reset();
+	ctx_.reset();
+
+	std::shared_ptr<JSContext> ctx = runtime_->createContextRaw();
+	auto context = std::make_shared<Scripting::EventScriptingContext>(runtime_, ctx, logger_);
+	const Store::EventHandlerDatabaseSettings &databaseSettings = snapshot->databaseSettings;
+	const Scripting::ScriptingDatabaseOptions databaseOptions{
+		.journalMode = databaseSettings.journalMode,
+		.synchronous = databaseSettings.synchronous,
+		.cacheSize = databaseSettings.cacheSize,
+		.mmapSize = databaseSettings.mmapSize,
+	};
+	auto database = std::make_unique<Scripting::ScriptingDatabase>(
+		runtime_, ctx, logger_, eventHandlerStore_->getEventHandlerDatabasePath(), true, databaseOptions);
+	auto fetch = std::make_unique<Scripting::ScriptingFetch>(runtime_, ctx, logger_, context->getHostJobQueue(),
+								 curlPool_, curlExecutor_);
+	context->setupContext();
+	database->setupContext();
+	fetch->setupContext();
+	context->setupLocalStorage(*database);
+	context->loadEventHandler(snapshot->eventHandlerScript.c_str(),
+				  eventHandlerStore_->getEventHandlerBytecodeCachePath());
+
+	ctx_ = std::move(ctx);
+	database_ = std::move(database);
+	fetch_ = std::move(fetch);
+	context_ = std::move(context);
+	loadedSnapshot_ = snapshot;
+
+	const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() -
+										   startTime);
+	logger_->info("ScriptingContextBuilt", {{"elapsedMilliseconds", std::to_string(elapsed.count())}});
+}
+
+void PersistentScriptingContext::resetEventState()
+{
+	Scripting::ScopedJSValue resetFunction = context_->getModuleProperty(kResetEventStateFunctionName);
+	if (!JS_IsFunction(ctx_.get(), resetFunction.get())) {
+		return;
+	}
+
+	try {
+		context_->executeFunction(kResetEventStateFunctionName, "{}");
+	} catch (const std::exception &e) {
+		logger_->warn("ScriptingContextResetError", {{"exception", e.what()}});
+	}
+}
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Controller
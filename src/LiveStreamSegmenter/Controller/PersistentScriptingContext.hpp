@@ -0,0 +1,103 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - Controller Module
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+
+#include <KaitoTokyo/Async/Task.hpp>
+#include <KaitoTokyo/CurlHelper/CurlConnectionPool.hpp>
+#include <KaitoTokyo/CurlHelper/CurlMultiExecutor.hpp>
+#include <KaitoTokyo/Logger/ILogger.hpp>
+
+#include <EventHandlerStore.hpp>
+#include <EventScriptingContext.hpp>
+#include <ScriptingDatabase.hpp>
+#include <ScriptingFetch.hpp>
+#include <ScriptingRuntime.hpp>
+
+namespace KaitoTokyo::LiveStreamSegmenter::Controller {
+
+/**
+ * Keeps one event scripting context alive across sessions and segments.
+ *
+ * Bundles, the SQLite database, fetch() and the user event handler are loaded
+ * once and reused. The context is rebuilt only when the event handler script in the
+ * store changes, or after invalidate(). Unchanged store versions are detected without
+ * comparing the script. Callers must not use it concurrently.
+ */
+class PersistentScriptingContext {
+public:
+	PersistentScriptingContext(std::shared_ptr<Scripting::ScriptingRuntime> runtime,
+				   std::shared_ptr<Store::EventHandlerStore> eventHandlerStore,
+				   std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool,
+				   std::shared_ptr<CurlHelper::CurlMultiExecutor> curlExecutor,
+				   std::shared_ptr<const Logger::ILogger> logger);
+
+	~PersistentScriptingContext() noexcept;
+
+	PersistentScriptingContext(const PersistentScriptingContext &) = delete;
+	PersistentScriptingContext &operator=(const PersistentScriptingContext &) = delete;
+	PersistentScriptingContext(PersistentScriptingContext &&) = delete;
+	PersistentScriptingContext &operator=(PersistentScriptingContext &&) = delete;
+
+	/**
+	 * Builds the context ahead of time if the script changed, so that the next acquire() is cheap.
+	 */
+	void warm();
+
+	/**
+	 * Returns the context for a new event, rebuilding it if needed and calling the reset hook.
+	 */
+	std::shared_ptr<Scripting::EventScriptingContext> acquire();
+
+	/**
+	 * Same as acquire(), but on the runtime's executor when it has one. Resumes there, so callers should
+	 * hop back to their own executor afterwards.
+	 */
+	Async::Task<std::shared_ptr<Scripting::EventScriptingContext>> acquireTask();
+
+	/**
+	 * Drops the current context; the next warm() or acquire() rebuilds it.
+	 */
+	void invalidate();
+
+private:
+	const std::shared_ptr<Scripting::ScriptingRuntime> runtime_;
+	const std::shared_ptr<Store::EventHandlerStore> eventHandlerStore_;
+	const std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool_;
+	const std::shared_ptr<CurlHelper::CurlMultiExecutor> curlExecutor_;
+	const std::shared_ptr<const Logger::ILogger> logger_;
+
+	std::mutex mutex_;
+	// The store contents the context was last checked against; null until the first build.
+	std::shared_ptr<const Store::EventHandlerSnapshot> loadedSnapshot_;
+	std::shared_ptr<JSContext> ctx_;
+	std::unique_ptr<Scripting::ScriptingDatabase> database_;
+	std::unique_ptr<Scripting::ScriptingFetch> fetch_;
+	std::shared_ptr<Scripting::EventScriptingContext> context_;
+
+	// Both require mutex_ to be held.
+	void ensureBuilt();
+	void resetEventState();
+};
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Controller
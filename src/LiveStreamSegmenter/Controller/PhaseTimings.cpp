@@ -0,0 +1,160 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - Controller Module
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "PhaseTimings.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <KaitoTokyo/Metrics/MetricsRegistry.hpp>
+
+namespace KaitoTokyo::LiveStreamSegmenter::Controller {
+
+namespace {
+
+// Nearest-rank percentile; sorted must not be empty.
+std::chrono::milliseconds percentile(const std::vector<std::chrono::milliseconds> &sorted, std::size_t percent)
+{
+	const std::size_t rank = (percent * sorted.size() + 99) / 100;
+	return sorted[std::max<std::size_t>(rank, 1) - 1];
+}
+
+} // anonymous namespace
+
+std::string_view sessionPhaseName(SessionPhase phase) noexcept
+{
+	switch (phase) {
+	case SessionPhase::TokenFetch:
+		return "tokenFetch";
+	case SessionPhase::ScriptCall:
+		return "scriptCall";
+	case SessionPhase::Insert:
+		return "insert";
+	case SessionPhase::Thumbnail:
+		return "thumbnail";
+	case SessionPhase::Bind:
+		return "bind";
+	case SessionPhase::KeyframeWait:
+		return "keyframeWait";
+	case SessionPhase::OBSStop:
+		return "obsStop";
+	case SessionPhase::OBSStart:
+		return "obsStart";
+	case SessionPhase::WaitForActive:
+		return "waitForActive";
+	case SessionPhase::Testing:
+		return "testing";
+	case SessionPhase::Live:
+		return "live";
+	}
+	return "unknown";
+}
+
+PhaseTimings::Span::Span(std::shared_ptr<PhaseTimings> timings, SessionPhase phase)
+	: timings_(timings ? std::move(timings)
+			   : throw std::invalid_argument("TimingsIsNullError(PhaseTimings::Span)")),
+	  phase_(phase),
+	  startTime_(std::chrono::steady_clock::now())
+{
+}
+
+PhaseTimings::Span::~Span() noexcept
+{
+	stop();
+}
+
+void PhaseTimings::Span::stop() noexcept
+{
+	if (!timings_) {
+		return;
+	}
+	timings_->add(phase_, std::chrono::steady_clock::now() - startTime_);
+	timings_.reset();
+}
+
+PhaseTimings::PhaseTimings(std::string runName) : runName_(std::move(runName)) {}
+
+void PhaseTimings::add(SessionPhase phase, std::chrono::steady_clock::duration duration) noexcept
+{
+	std::scoped_lock lock(mutex_);
+	std::optional<std::chrono::steady_clock::duration> &slot = durations_[static_cast<std::size_t>(phase)];
+	slot = slot.value_or(std::chrono::steady_clock::duration::zero()) + duration;
+}
+
+std::array<std::optional<std::chrono::steady_clock::duration>, kSessionPhaseCount> PhaseTimings::snapshot() const
+{
+	std::scoped_lock lock(mutex_);
+	return durations_;
+}
+
+PhaseTimingStatistics::PhaseTimingStatistics(std::string sessionId, std::size_t windowSize)
+	: sessionId_(std::move(sessionId)),
+	  windowSize_(windowSize > 0 ? windowSize
+				     : throw std::invalid_argument("WindowSizeIsZeroError(PhaseTimingStatistics)"))
+{
+}
+
+void PhaseTimingStatistics::record(const PhaseTimings &timings, const Logger::ILogger &logger)
+{
+	using namespace std::chrono;
+
+	const auto durations = timings.snapshot();
+
+	std::scoped_lock lock(mutex_);
+	std::array<Window, kSessionPhaseCount> &windows = windows_[timings.getRunName()];
+
+	for (std::size_t i = 0; i < kSessionPhaseCount; ++i) {
+		if (!durations[i]) {
+			continue;
+		}
+
+		const milliseconds elapsed = duration_cast<milliseconds>(*durations[i]);
+
+		Metrics::MetricsRegistry::global()
+			.histogram("segmenter_phase_duration_seconds", "Time spent in each phase of a run.",
+				   kPhaseDurationBuckets,
+				   {{"session", sessionId_},
+				    {"run", timings.getRunName()},
+				    {"phase", std::string(sessionPhaseName(static_cast<SessionPhase>(i)))}})
+			.observe(*durations[i]);
+
+		Window &window = windows[i];
+		window.push_back(elapsed);
+		while (window.size() > windowSize_) {
+			window.pop_front();
+		}
+
+		std::vector<milliseconds> sorted(window.begin(), window.end());
+		std::ranges::sort(sorted);
+
+		logger.info("PhaseTimingRecorded",
+			    {{"runName", timings.getRunName()},
+			     {"phase", sessionPhaseName(static_cast<SessionPhase>(i))},
+			     {"elapsedMilliseconds", std::to_string(elapsed.count())},
+			     {"p50Milliseconds", std::to_string(percentile(sorted, 50).count())},
+			     {"p95Milliseconds", std::to_string(percentile(sorted, 95).count())},
+			     {"maxMilliseconds", std::to_string(sorted.back().count())},
+			     {"samples", std::to_string(sorted.size())}});
+	}
+}
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Controller
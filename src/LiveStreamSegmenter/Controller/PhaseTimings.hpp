@@ -0,0 +1,139 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - Controller Module
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <KaitoTokyo/Logger/ILogger.hpp>
+
+namespace KaitoTokyo::LiveStreamSegmenter::Controller {
+
+enum class SessionPhase {
+	TokenFetch,
+	ScriptCall,
+	Insert,
+	Thumbnail,
+	Bind,
+	KeyframeWait,
+	OBSStop,
+	OBSStart,
+	WaitForActive,
+	Testing,
+	Live,
+};
+
+inline constexpr std::size_t kSessionPhaseCount = static_cast<std::size_t>(SessionPhase::Live) + 1;
+
+// Histogram bounds in seconds, wide enough for phases that wait on YouTube or OBS.
+inline constexpr double kPhaseDurationBuckets[] = {0.1, 0.25, 0.5, 1.0, 2.5, 5.0, 10.0, 30.0, 60.0, 120.0, 300.0};
+
+std::string_view sessionPhaseName(SessionPhase phase) noexcept;
+
+/**
+ * Durations of the phases of a single run, such as one session start or one cutover.
+ *
+ * Spans may be recorded from several threads at once. Spans of the same phase are
+ * summed, so overlapping branches report the work done rather than the wall time.
+ */
+class PhaseTimings {
+public:
+	class Span {
+	public:
+		Span(std::shared_ptr<PhaseTimings> timings, SessionPhase phase);
+		~Span() noexcept;
+
+		Span(const Span &) = delete;
+		Span &operator=(const Span &) = delete;
+		Span(Span &&) = delete;
+		Span &operator=(Span &&) = delete;
+
+		void stop() noexcept;
+
+	private:
+		std::shared_ptr<PhaseTimings> timings_;
+		const SessionPhase phase_;
+		const std::chrono::steady_clock::time_point startTime_;
+	};
+
+	explicit PhaseTimings(std::string runName);
+	~PhaseTimings() noexcept = default;
+
+	PhaseTimings(const PhaseTimings &) = delete;
+	PhaseTimings &operator=(const PhaseTimings &) = delete;
+	PhaseTimings(PhaseTimings &&) = delete;
+	PhaseTimings &operator=(PhaseTimings &&) = delete;
+
+	const std::string &getRunName() const noexcept { return runName_; }
+
+	void add(SessionPhase phase, std::chrono::steady_clock::duration duration) noexcept;
+
+	std::array<std::optional<std::chrono::steady_clock::duration>, kSessionPhaseCount> snapshot() const;
+
+private:
+	const std::string runName_;
+
+	mutable std::mutex mutex_;
+	std::array<std::optional<std::chrono::steady_clock::duration>, kSessionPhaseCount> durations_;
+};
+
+/**
+ * Rolling per-phase statistics over the last runs of each run name.
+ */
+class PhaseTimingStatistics {
+public:
+	/**
+	 * @param sessionId Added as the session label of the histogram, so sessions can be told apart.
+	 */
+	explicit PhaseTimingStatistics(std::string sessionId, std::size_t windowSize = 32);
+	~PhaseTimingStatistics() noexcept = default;
+
+	PhaseTimingStatistics(const PhaseTimingStatistics &) = delete;
+	PhaseTimingStatistics &operator=(const PhaseTimingStatistics &) = delete;
+	PhaseTimingStatistics(PhaseTimingStatistics &&) = delete;
+	PhaseTimingStatistics &operator=(PhaseTimingStatistics &&) = delete;
+
+	/**
+	 * Folds a finished run into the window and logs one PhaseTimingRecorded line per
+	 * phase that ran, with the run's duration and the rolling p50, p95 and max. Each
+	 * duration is also observed into the segmenter_phase_duration_seconds histogram.
+	 */
+	void record(const PhaseTimings &timings, const Logger::ILogger &logger);
+
+private:
+	using Window = std::deque<std::chrono::milliseconds>;
+
+	const std::string sessionId_;
+	const std::size_t windowSize_;
+
+	std::mutex mutex_;
+	std::map<std::string, std::array<Window, kSessionPhaseCount>, std::less<>> windows_;
+};
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Controller
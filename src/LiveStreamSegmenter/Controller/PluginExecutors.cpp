@@ -0,0 +1,64 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - Controller Module
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "PluginExecutors.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+namespace KaitoTokyo::LiveStreamSegmenter::Controller {
+
+namespace {
+
+// A session start overlaps at most four requests; more would only spend quota faster.
+constexpr std::size_t kNetworkThreadCount = 4;
+// Journal appends are ordered, so one thread keeps them in submission order.
+constexpr std::size_t kDiskIoThreadCount = 1;
+
+void logExecutorStats(const Async::ThreadPoolExecutor &executor, const Logger::ILogger &logger)
+{
+	const Async::ThreadPoolExecutorStats stats = executor.getStats();
+	logger.info("ExecutorStats",
+		    {{"executor", executor.getName()},
+		     {"queueDepth", std::to_string(stats.queueDepth)},
+		     {"maxQueueDepth", std::to_string(stats.maxQueueDepth)},
+		     {"completed", std::to_string(stats.completed)},
+		     {"busyMilliseconds",
+		      std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(stats.busyTime).count())}});
+}
+
+} // anonymous namespace
+
+PluginExecutors::PluginExecutors()
+	: network_(std::make_shared<Async::ThreadPoolExecutor>(
+		  Async::ThreadPoolExecutorOptions{.name = "network", .threadCount = kNetworkThreadCount})),
+	  diskIo_(std::make_shared<Async::ThreadPoolExecutor>(
+		  Async::ThreadPoolExecutorOptions{.name = "disk-io", .threadCount = kDiskIoThreadCount}))
+{
+}
+
+void PluginExecutors::logStats(const Logger::ILogger &logger) const
+{
+	logExecutorStats(*network_, logger);
+	logExecutorStats(*diskIo_, logger);
+}
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Controller
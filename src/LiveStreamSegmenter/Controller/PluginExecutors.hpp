@@ -0,0 +1,77 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - Controller Module
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include <KaitoTokyo/Async/ThreadPoolExecutor.hpp>
+#include <KaitoTokyo/Logger/ILogger.hpp>
+
+namespace KaitoTokyo::LiveStreamSegmenter::Controller {
+
+/**
+ * The plugin's own worker pools, kept apart from QThreadPool::globalInstance() that OBS shares.
+ *
+ * The network pool runs blocking YouTube and OAuth requests, and the disk IO pool runs writes that
+ * sync to disk. Each has its own threads and concurrency limit, so a slow request never holds up a
+ * write. Scripts run on the ScriptingRuntime executor thread rather than here.
+ */
+class PluginExecutors {
+public:
+	PluginExecutors();
+	~PluginExecutors() noexcept = default;
+
+	PluginExecutors(const PluginExecutors &) = delete;
+	PluginExecutors &operator=(const PluginExecutors &) = delete;
+	PluginExecutors(PluginExecutors &&) = delete;
+	PluginExecutors &operator=(PluginExecutors &&) = delete;
+
+	/**
+	 * Blocking YouTube and OAuth requests.
+	 */
+	Async::ThreadPoolExecutor &getNetwork() const noexcept { return *network_; }
+
+	/**
+	 * The network pool, for owners that may outlive this object such as GoogleAccessTokenProvider.
+	 */
+	std::shared_ptr<Async::ThreadPoolExecutor> getNetworkShared() const noexcept { return network_; }
+
+	/**
+	 * Writes that sync to disk, such as the session journal.
+	 */
+	Async::ThreadPoolExecutor &getDiskIo() const noexcept { return *diskIo_; }
+
+	/**
+	 * The disk IO pool, for owners that may outlive this object such as ProfileStore.
+	 */
+	std::shared_ptr<Async::ThreadPoolExecutor> getDiskIoShared() const noexcept { return diskIo_; }
+
+	/**
+	 * Logs the queue depth and busy time of every pool.
+	 */
+	void logStats(const Logger::ILogger &logger) const;
+
+private:
+	const std::shared_ptr<Async::ThreadPoolExecutor> network_;
+	const std::shared_ptr<Async::ThreadPoolExecutor> diskIo_;
+};
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Controller
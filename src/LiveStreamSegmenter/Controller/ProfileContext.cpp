@@ -20,62 +20,171 @@
 
 #include "ProfileContext.hpp"
 
-#include <curl/curl.h>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <vector>
 
-#include <obs-frontend-api.h>
+#include <QMainWindow>
+
+#include <nlohmann/json.hpp>
+
+#include <obs-module.h>
 
 #include <KaitoTokyo/Logger/ILogger.hpp>
-#include <KaitoTokyo/YouTubeApi/YouTubeApiClient.hpp>
+#include <KaitoTokyo/Logger/JsonLinesFileLogger.hpp>
+#include <KaitoTokyo/Logger/MultiLogger.hpp>
+#include <KaitoTokyo/Metrics/MetricsRegistry.hpp>
 
-#include <AuthStore.hpp>
-#include <EventHandlerStore.hpp>
-#include <YouTubeStore.hpp>
+#include <ProfilePaths.hpp>
 #include <ScriptingRuntime.hpp>
 #include <StreamSegmenterDock.hpp>
 
-#include "YouTubeStreamSegmenterMainLoop.hpp"
+#include "SegmenterSession.hpp"
 
 namespace KaitoTokyo::LiveStreamSegmenter::Controller {
 
-ProfileContext::ProfileContext(std::shared_ptr<Scripting::ScriptingRuntime> runtime,
-			       std::shared_ptr<const Logger::ILogger> logger, UI::StreamSegmenterDock *dock)
-	: runtime_(runtime ? std::move(runtime) : throw std::invalid_argument("RuntimeIsNullError(ProfileContext)")),
-	  dock_(dock ? dock : throw std::invalid_argument("DockIsNullError(ProfileContext)")),
-	  authStore_(std::make_shared<Store::AuthStore>()),
-	  eventHandlerStore_(std::make_shared<Store::EventHandlerStore>()),
-	  youTubeStore_(std::make_shared<Store::YouTubeStore>()),
-	  logger_(logger ? std::move(logger) : throw std::invalid_argument("LoggerIsNullError(ProfileContext)")),
-	  youTubeStreamSegmenterMainLoop_(std::make_shared<YouTubeStreamSegmenterMainLoop>(
-		  runtime_, authStore_, eventHandlerStore_, youTubeStore_, logger_, dock_))
-{
-	authStore_->setLogger(logger_);
-	eventHandlerStore_->setLogger(logger_);
-	youTubeStore_->setLogger(logger_);
-
-	authStore_->restore();
-	eventHandlerStore_->restore();
-	youTubeStore_->restore();
+namespace {
 
-	dock_->setAuthStore(authStore_);
-	dock_->setEventHandlerStore(eventHandlerStore_);
-	dock_->setYouTubeStore(youTubeStore_);
+// Adds a file sink in the profile directory that keeps every structured record of the session.
+std::shared_ptr<const Logger::ILogger> composeProfileLogger(std::shared_ptr<const Logger::ILogger> logger,
+							    const Store::ProfilePaths &paths)
+{
+	if (!logger) {
+		throw std::invalid_argument("LoggerIsNullError(ProfileContext)");
+	}
+
+	const std::filesystem::path &directory = paths.sessionLogDirectory;
+
+	try {
+		auto fileLogger = std::make_shared<Logger::JsonLinesFileLogger>(
+			Logger::JsonLinesFileLoggerOptions{.directory = directory});
+		return std::make_shared<Logger::MultiLogger>(
+			std::vector<std::shared_ptr<const Logger::ILogger>>{logger, std::move(fileLogger)});
+	} catch (const std::exception &e) {
+		logger->warn("SessionLogFileUnavailable", {{"path", directory.string()}, {"exception", e.what()}});
+		return logger;
+	}
+}
 
-	QObject::connect(dock_, &UI::StreamSegmenterDock::startButtonClicked, youTubeStreamSegmenterMainLoop_.get(),
-			 &YouTubeStreamSegmenterMainLoop::onStartContinuousSession);
+// Serves the metrics only when the profile has a live-stream-segmenter_Metrics.json such as
+// {"listenPort": 9464}, so that a scrape port is never opened without being asked for.
+std::unique_ptr<UI::MetricsHttpServer> startMetricsHttpServer(const Store::ProfilePaths &paths,
+							      const Logger::ILogger &logger)
+{
+	const std::filesystem::path &configPath = paths.metricsConfig;
+
+	std::ifstream configFile(configPath);
+	if (!configFile) {
+		return nullptr;
+	}
+
+	try {
+		const nlohmann::json config = nlohmann::json::parse(configFile);
+		const int port = config.at("listenPort").get<int>();
+		if (port <= 0 || port > 65535) {
+			throw std::out_of_range("ListenPortOutOfRangeError(startMetricsHttpServer)");
+		}
+
+		auto server = std::make_unique<UI::MetricsHttpServer>(Metrics::MetricsRegistry::global(), nullptr);
+		server->listen(static_cast<quint16>(port));
+		logger.info("MetricsHttpServerListening", {{"port", std::to_string(port)}});
+		return server;
+	} catch (const std::exception &e) {
+		logger.warn("MetricsHttpServerUnavailable", {{"path", configPath.string()}, {"exception", e.what()}});
+		return nullptr;
+	}
+}
 
-	QObject::connect(dock_, &UI::StreamSegmenterDock::stopButtonClicked, youTubeStreamSegmenterMainLoop_.get(),
-			 &YouTubeStreamSegmenterMainLoop::onStopContinuousSession);
+// Reads the ids of the additional sessions. Without the file the profile has only its own session.
+std::vector<std::string> readAdditionalSessionIds(const Store::ProfilePaths &paths, const Logger::ILogger &logger)
+{
+	const std::filesystem::path &configPath = paths.sessionsConfig;
+
+	std::ifstream configFile(configPath);
+	if (!configFile) {
+		return {};
+	}
+
+	std::vector<std::string> sessionIds;
+	try {
+		const nlohmann::json config = nlohmann::json::parse(configFile);
+		for (const std::string &sessionId : config.at("sessions").get<std::vector<std::string>>()) {
+			if (!Store::ProfilePaths::isValidSessionId(sessionId)) {
+				logger.warn("SessionIdInvalid", {{"sessionId", sessionId}});
+			} else if (std::ranges::find(sessionIds, sessionId) != sessionIds.end()) {
+				logger.warn("SessionIdDuplicated", {{"sessionId", sessionId}});
+			} else {
+				sessionIds.push_back(sessionId);
+			}
+		}
+	} catch (const std::exception &e) {
+		logger.warn("SessionsConfigUnavailable", {{"path", configPath.string()}, {"exception", e.what()}});
+		return {};
+	}
+	return sessionIds;
+}
 
-	QObject::connect(dock_, &UI::StreamSegmenterDock::segmentNowButtonClicked,
-			 youTubeStreamSegmenterMainLoop_.get(),
-			 &YouTubeStreamSegmenterMainLoop::onSegmentContinuousSession);
+} // anonymous namespace
 
-	QObject::connect(youTubeStreamSegmenterMainLoop_.get(), &YouTubeStreamSegmenterMainLoop::tick, dock_,
-			 &UI::StreamSegmenterDock::onMainLoopTimerTick);
+ProfileContext::ProfileContext(std::shared_ptr<Scripting::ScriptingRuntime> runtime,
+			       std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool,
+			       std::shared_ptr<PluginExecutors> executors,
+			       std::shared_ptr<const Logger::ILogger> logger, UI::StreamSegmenterDock *dock)
+	: runtime_(runtime ? std::move(runtime) : throw std::invalid_argument("RuntimeIsNullError(ProfileContext)")),
+	  curlPool_(curlPool ? std::move(curlPool)
+			     : throw std::invalid_argument("CurlPoolIsNullError(ProfileContext)")),
+	  executors_(executors ? std::move(executors)
+			       : throw std::invalid_argument("ExecutorsIsNullError(ProfileContext)")),
+	  dock_(dock ? dock : throw std::invalid_argument("DockIsNullError(ProfileContext)")),
+	  paths_(std::make_shared<const Store::ProfilePaths>(Store::ProfilePaths::fromCurrentProfile())),
+	  logger_(composeProfileLogger(std::move(logger), *paths_))
+{
+	sessions_.push_back(
+		std::make_unique<SegmenterSession>("", runtime_, curlPool_, executors_, paths_, logger_, dock_));
+
+	for (const std::string &sessionId : readAdditionalSessionIds(*paths_, *logger_)) {
+		try {
+			addSession(sessionId);
+		} catch (const std::exception &e) {
+			logger_->error("SessionStartError", {{"sessionId", sessionId}, {"exception", e.what()}});
+		}
+	}
+
+	metricsHttpServer_ = startMetricsHttpServer(*paths_, *logger_);
+}
 
-	youTubeStreamSegmenterMainLoop_->startMainLoop();
+ProfileContext::~ProfileContext() noexcept
+{
+	// The sessions hold their docks, so they go first; OBS deletes a dock when it is removed.
+	sessions_.clear();
+	for (const std::string &dockId : sessionDockIds_) {
+		obs_frontend_remove_dock(dockId.c_str());
+	}
 }
 
-ProfileContext::~ProfileContext() noexcept = default;
+void ProfileContext::addSession(const std::string &sessionId)
+{
+	const std::string dockId = "live_stream_segmenter_dock_" + sessionId;
+	const std::string dockTitle = std::string(obs_module_text("LiveStreamSegmenterDock")) + " (" + sessionId + ")";
+
+	auto *mainWindow = static_cast<QMainWindow *>(obs_frontend_get_main_window());
+	auto *dock = new UI::StreamSegmenterDock(mainWindow);
+	if (!obs_frontend_add_dock_by_id(dockId.c_str(), dockTitle.c_str(), dock)) {
+		delete dock;
+		throw std::runtime_error("AddDockError(ProfileContext::addSession)");
+	}
+	sessionDockIds_.push_back(dockId);
+
+	// The dock of the profile's own session already sees every record through logger_.
+	auto sessionLogger = std::make_shared<Logger::MultiLogger>(
+		std::vector<std::shared_ptr<const Logger::ILogger>>{logger_, dock->getLoggerAdapter()});
+	dock->setLogger(sessionLogger);
+
+	sessions_.push_back(std::make_unique<SegmenterSession>(
+		sessionId, runtime_, curlPool_, executors_,
+		std::make_shared<const Store::ProfilePaths>(paths_->forSession(sessionId)), std::move(sessionLogger),
+		dock));
+}
 
 } // namespace KaitoTokyo::LiveStreamSegmenter::Controller
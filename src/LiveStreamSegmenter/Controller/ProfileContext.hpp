@@ -20,28 +20,36 @@
 
 #pragma once
 
-#include <curl/curl.h>
+#include <memory>
+#include <string>
+#include <vector>
 
 #include <obs-frontend-api.h>
 
-#include <KaitoTokyo/CurlHelper/CurlHandle.hpp>
+#include <KaitoTokyo/CurlHelper/CurlConnectionPool.hpp>
 #include <KaitoTokyo/Logger/ILogger.hpp>
-#include <KaitoTokyo/YouTubeApi/YouTubeApiClient.hpp>
 
-#include <AuthStore.hpp>
-#include <EventHandlerStore.hpp>
-#include <YouTubeStore.hpp>
+#include <ProfilePaths.hpp>
+#include <MetricsHttpServer.hpp>
 #include <ScriptingRuntime.hpp>
 #include <StreamSegmenterDock.hpp>
 
-#include "YouTubeStreamSegmenterMainLoop.hpp"
+#include "PluginExecutors.hpp"
+#include "SegmenterSession.hpp"
 
 namespace KaitoTokyo::LiveStreamSegmenter::Controller {
 
+/**
+ * Everything that belongs to the current OBS profile: the profile's own session on the plugin dock, and
+ * one more session with its own dock for every id listed in ProfilePaths::sessionsConfig, such as
+ * {"sessions": ["second-channel"]}.
+ */
 class ProfileContext {
 public:
 	ProfileContext(std::shared_ptr<Scripting::ScriptingRuntime> runtime,
-		       std::shared_ptr<const Logger::ILogger> logger, UI::StreamSegmenterDock *dock);
+		       std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool,
+		       std::shared_ptr<PluginExecutors> executors, std::shared_ptr<const Logger::ILogger> logger,
+		       UI::StreamSegmenterDock *dock);
 
 	~ProfileContext() noexcept;
 
@@ -51,15 +59,21 @@ public:
 	ProfileContext &operator=(ProfileContext &&) = delete;
 
 private:
+	void addSession(const std::string &sessionId);
+
 	const std::shared_ptr<Scripting::ScriptingRuntime> runtime_;
+	const std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool_;
+	const std::shared_ptr<PluginExecutors> executors_;
 	UI::StreamSegmenterDock *const dock_;
-
-	const std::shared_ptr<Store::AuthStore> authStore_;
-	const std::shared_ptr<Store::EventHandlerStore> eventHandlerStore_;
-	const std::shared_ptr<Store::YouTubeStore> youTubeStore_;
-
+	// Resolved once; MainPluginContext rebuilds this object when the profile changes.
+	const std::shared_ptr<const Store::ProfilePaths> paths_;
 	const std::shared_ptr<const Logger::ILogger> logger_;
-	std::shared_ptr<YouTubeStreamSegmenterMainLoop> youTubeStreamSegmenterMainLoop_;
+
+	// OBS dock ids of the docks added for additional sessions, removed again with this object.
+	std::vector<std::string> sessionDockIds_;
+	std::vector<std::unique_ptr<SegmenterSession>> sessions_;
+	// Null unless the profile opted in to the metrics endpoint.
+	std::unique_ptr<UI::MetricsHttpServer> metricsHttpServer_;
 };
 
 } // namespace KaitoTokyo::LiveStreamSegmenter::Controller
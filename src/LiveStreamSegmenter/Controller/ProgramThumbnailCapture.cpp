@@ -0,0 +1,207 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - Controller Module
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ProgramThumbnailCapture.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <QBuffer>
+#include <QByteArray>
+#include <QImage>
+
+#include <obs.h>
+
+#include <KaitoTokyo/FrameConversion/FrameScaler.hpp>
+#include <KaitoTokyo/ObsBridgeUtils/GsUnique.hpp>
+
+namespace KaitoTokyo::LiveStreamSegmenter::Controller {
+
+namespace {
+
+constexpr int kJpegQuality = 90;
+
+// The downscaler renders into BGRA, which also turns HDR float canvases into 8-bit pixels.
+constexpr gs_color_format kReadbackFormat = GS_BGRA;
+
+// Staging surfaces of a size that has not been captured for this long are given back to the driver.
+constexpr std::chrono::minutes kStagesurfIdleTimeout{30};
+
+} // anonymous namespace
+
+ProgramThumbnailCapture::ProgramThumbnailCapture(std::shared_ptr<const Logger::ILogger> logger)
+	: logger_(logger ? std::move(logger)
+			 : throw std::invalid_argument("LoggerIsNullError(ProgramThumbnailCapture)")),
+	  stagesurfPool_(std::make_shared<ObsBridgeUtils::GsStagesurfPool>())
+{
+}
+
+ProgramThumbnailCapture::~ProgramThumbnailCapture() noexcept
+{
+	if (!callbackAdded_) {
+		return;
+	}
+
+	// Waits for a callback that is running right now, so nothing touches this object afterwards.
+	obs_remove_main_rendered_callback(onMainRendered, this);
+
+	const ObsBridgeUtils::GraphicsContextGuard graphicsContextGuard;
+	reader_.reset();
+	stagesurfPool_->clear();
+	downscaler_.reset();
+	ObsBridgeUtils::GsUnique::drain();
+}
+
+YouTubeApi::YouTubeUploadSource ProgramThumbnailCapture::capture(std::chrono::milliseconds timeout)
+{
+	std::scoped_lock captureLock(captureMutex_);
+
+	// Not under mutex_: OBS holds its callback mutex while calling onMainRendered, which takes mutex_.
+	if (!callbackAdded_) {
+		obs_add_main_rendered_callback(onMainRendered, this);
+		callbackAdded_ = true;
+	}
+
+	{
+		std::unique_lock lock(mutex_);
+		state_ = State::Requested;
+		const bool settled = stateChanged_.wait_for(
+			lock, timeout, [this]() { return state_ == State::Ready || state_ == State::Failed; });
+		if (!settled) {
+			state_ = State::Idle;
+			logger_->error("ProgramThumbnailCaptureTimedOut");
+			throw std::runtime_error("TimeoutError(ProgramThumbnailCapture::capture)");
+		}
+		if (state_ == State::Failed) {
+			state_ = State::Idle;
+			throw std::runtime_error("StageError(ProgramThumbnailCapture::capture)");
+		}
+	}
+
+	struct IdleOnExit {
+		ProgramThumbnailCapture *self;
+		~IdleOnExit()
+		{
+			std::scoped_lock lock(self->mutex_);
+			self->state_ = State::Idle;
+		}
+	} idleOnExit{this};
+
+	// The render thread only touches reader_ while a capture is requested, so it can be used here
+	// without holding mutex_. The lease maps the staged surface in place and is released, before the
+	// state goes back to idle, once the frame has been encoded.
+	std::optional<ObsBridgeUtils::AsyncTextureReader::Lease> lease;
+	try {
+		lease = reader_->tryLease();
+	} catch (const std::exception &e) {
+		logger_->error("ProgramThumbnailReadbackError", {{"exception", e.what()}});
+		throw std::runtime_error("ReadbackError(ProgramThumbnailCapture::capture)");
+	}
+	if (!lease) {
+		logger_->error("ProgramThumbnailReadbackError", {{"exception", "no staged frame is ready"}});
+		throw std::runtime_error("ReadbackError(ProgramThumbnailCapture::capture)");
+	}
+
+	const FrameConversion::FrameView frame{lease->getData(), lease->getWidth(), lease->getHeight(),
+					       lease->getLinesize(), FrameConversion::PixelOrder::BGRA};
+	const auto [width, height] = FrameConversion::fitWithin(frame.width, frame.height, kMaxWidth, kMaxHeight);
+	const std::size_t linesize = 3 * static_cast<std::size_t>(width);
+	rgb_.resize(linesize * height);
+	scaler_.scaleToRgb(frame, rgb_.data(), width, height, linesize);
+	const QImage thumbnail(rgb_.data(), static_cast<int>(width), static_cast<int>(height),
+			       static_cast<qsizetype>(linesize), QImage::Format_RGB888);
+
+	QByteArray encoded;
+	QBuffer buffer(&encoded);
+	buffer.open(QIODevice::WriteOnly);
+	if (!thumbnail.save(&buffer, "JPG", kJpegQuality)) {
+		logger_->error("ProgramThumbnailEncodeError");
+		throw std::runtime_error("EncodeError(ProgramThumbnailCapture::capture)");
+	}
+
+	logger_->info("ProgramThumbnailCaptured", {{"width", std::to_string(thumbnail.width())},
+						   {"height", std::to_string(thumbnail.height())},
+						   {"size", std::to_string(encoded.size())}});
+
+	return YouTubeApi::YouTubeUploadSource::fromBuffer(std::vector<char>(encoded.begin(), encoded.end()),
+							   "image/jpeg");
+}
+
+void ProgramThumbnailCapture::onMainRendered(void *param) noexcept
+{
+	static_cast<ProgramThumbnailCapture *>(param)->stageOnRenderThread();
+}
+
+void ProgramThumbnailCapture::stageOnRenderThread() noexcept
+{
+	// Staging surfaces replaced below are only destroyed here, where the graphics context is current.
+	ObsBridgeUtils::GsUnique::drain();
+
+	std::scoped_lock lock(mutex_);
+	if (state_ == State::Staged) {
+		// One frame later the copy has landed, so mapping it will not stall the GPU.
+		reader_->poll();
+		state_ = State::Ready;
+		stateChanged_.notify_all();
+		return;
+	}
+	if (state_ != State::Requested) {
+		return;
+	}
+
+	gs_texture_t *texture = obs_get_main_texture();
+	if (!texture) {
+		return;
+	}
+
+	try {
+		const auto [width, height] = FrameConversion::fitWithin(
+			gs_texture_get_width(texture), gs_texture_get_height(texture), kMaxWidth, kMaxHeight);
+		if (!downscaler_) {
+			downscaler_ = std::make_unique<ObsBridgeUtils::TextureDownscaler>(kReadbackFormat);
+		}
+		gs_texture_t *downscaled = downscaler_->render(texture, width, height);
+		if (!reader_ || reader_->getWidth() != width || reader_->getHeight() != height) {
+			reader_.reset();
+			reader_ = std::make_unique<ObsBridgeUtils::AsyncTextureReader>(
+				width, height, kReadbackFormat, 2, stagesurfPool_);
+			stagesurfPool_->evictIdle(kStagesurfIdleTimeout);
+
+			const ObsBridgeUtils::GsResourcePoolStats stats = stagesurfPool_->getStats();
+			logger_->info("ProgramThumbnailReaderCreated", {{"width", std::to_string(width)},
+									{"height", std::to_string(height)},
+									{"poolHits", std::to_string(stats.hits)},
+									{"poolMisses", std::to_string(stats.misses)},
+									{"poolIdle", std::to_string(stats.idle)}});
+		}
+		reader_->stage(downscaled);
+		state_ = State::Staged;
+	} catch (const std::exception &e) {
+		logger_->error("ProgramThumbnailStageError", {{"exception", e.what()}});
+		state_ = State::Failed;
+		stateChanged_.notify_all();
+	}
+}
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Controller
@@ -0,0 +1,104 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - Controller Module
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <KaitoTokyo/FrameConversion/FrameScaler.hpp>
+#include <KaitoTokyo/Logger/ILogger.hpp>
+#include <KaitoTokyo/ObsBridgeUtils/AsyncTextureReader.hpp>
+#include <KaitoTokyo/ObsBridgeUtils/GsResourcePool.hpp>
+#include <KaitoTokyo/ObsBridgeUtils/TextureDownscaler.hpp>
+#include <KaitoTokyo/YouTubeApi/YouTubeUploadSource.hpp>
+
+namespace KaitoTokyo::LiveStreamSegmenter::Controller {
+
+/**
+ * Captures the program output as a JPEG thumbnail, without going through a file.
+ *
+ * A capture draws the main texture into a BGRA render target no larger than kMaxWidth x kMaxHeight
+ * with TextureDownscaler, stages that with AsyncTextureReader and leases the mapped copy on the calling
+ * thread one frame later, when it has finished on the GPU, so the pixels are encoded without a copy.
+ * Only the reduced image is read back: 3.7 MB instead of 33 MB for a 4K canvas. The render callback
+ * is only installed by the first capture and does nothing between captures. FrameScaler converts the
+ * frame to RGB before encoding.
+ */
+class ProgramThumbnailCapture {
+public:
+	// The largest size of a YouTube thumbnail; larger frames are scaled down to fit.
+	static constexpr std::uint32_t kMaxWidth = 1280;
+	static constexpr std::uint32_t kMaxHeight = 720;
+
+	explicit ProgramThumbnailCapture(std::shared_ptr<const Logger::ILogger> logger);
+	~ProgramThumbnailCapture() noexcept;
+
+	ProgramThumbnailCapture(const ProgramThumbnailCapture &) = delete;
+	ProgramThumbnailCapture &operator=(const ProgramThumbnailCapture &) = delete;
+	ProgramThumbnailCapture(ProgramThumbnailCapture &&) = delete;
+	ProgramThumbnailCapture &operator=(ProgramThumbnailCapture &&) = delete;
+
+	/**
+	 * Blocks until the next program frame has been read back and encoded. Must be called from a worker
+	 * thread, never from the render or the Qt main thread. Concurrent captures are served one at a time.
+	 * Throws when no frame is rendered within timeout or the frame cannot be encoded.
+	 */
+	YouTubeApi::YouTubeUploadSource capture(std::chrono::milliseconds timeout = std::chrono::seconds(5));
+
+private:
+	enum class State {
+		Idle,
+		Requested,
+		Staged,
+		Ready,
+		Failed,
+	};
+
+	static void onMainRendered(void *param) noexcept;
+	void stageOnRenderThread() noexcept;
+
+	const std::shared_ptr<const Logger::ILogger> logger_;
+
+	// Serializes capture() so there is a single request in flight.
+	std::mutex captureMutex_;
+
+	// Taken inside the graphics context by both threads, never the other way round.
+	std::mutex mutex_;
+	std::condition_variable stateChanged_;
+	bool callbackAdded_ = false;
+	State state_ = State::Idle;
+	// Created on the render thread by the first capture.
+	std::unique_ptr<ObsBridgeUtils::TextureDownscaler> downscaler_;
+	// Recreated on the render thread when the downscaled size changes, with surfaces from the pool so
+	// switching back to an earlier canvas size does not allocate.
+	const std::shared_ptr<ObsBridgeUtils::GsStagesurfPool> stagesurfPool_;
+	std::unique_ptr<ObsBridgeUtils::AsyncTextureReader> reader_;
+
+	// Only used by capture(), under captureMutex_.
+	FrameConversion::FrameScaler scaler_;
+	std::vector<std::uint8_t> rgb_;
+};
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Controller
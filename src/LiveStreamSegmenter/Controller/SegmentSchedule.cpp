@@ -0,0 +1,201 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - Controller Module
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "SegmentSchedule.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+#include <utility>
+
+#include <nlohmann/json.hpp>
+
+namespace KaitoTokyo::LiveStreamSegmenter::Controller {
+
+namespace {
+
+constexpr std::chrono::milliseconds kDay = std::chrono::hours(24);
+
+// Rounds towards negative infinity, so times before the origin fall into the right period.
+std::int64_t floorDiv(std::int64_t numerator, std::int64_t denominator)
+{
+	const std::int64_t quotient = numerator / denominator;
+	return (numerator % denominator != 0 && (numerator < 0) != (denominator < 0)) ? quotient - 1 : quotient;
+}
+
+// The first boundary strictly after the given time among origin + k * interval.
+SegmentSchedule::Clock::time_point nextMultiple(SegmentSchedule::Clock::time_point origin,
+						std::chrono::milliseconds interval,
+						SegmentSchedule::Clock::time_point after)
+{
+	const auto elapsed = std::chrono::floor<std::chrono::milliseconds>(after - origin);
+	const std::int64_t periods = floorDiv(elapsed.count(), interval.count()) + 1;
+	return origin + interval * periods;
+}
+
+// Reads the two digits at pos, or returns -1 if they are not both there.
+int parseTwoDigits(const std::string &text, std::size_t pos)
+{
+	const auto isDigit = [](char c) { return c >= '0' && c <= '9'; };
+	if (pos + 2 > text.size() || !isDigit(text[pos]) || !isDigit(text[pos + 1])) {
+		return -1;
+	}
+	return (text[pos] - '0') * 10 + (text[pos + 1] - '0');
+}
+
+// Parses "HH:MM" or "HH:MM:SS", two digits each, into the time since midnight. Checked by hand because
+// sscanf("%2d") also takes one digit, leading spaces and signs.
+std::chrono::milliseconds parseTimeOfDay(const std::string &text)
+{
+	const bool withSeconds = text.size() == 8;
+	const bool shapeOk = (text.size() == 5 || withSeconds) && text[2] == ':' && (!withSeconds || text[5] == ':');
+	const int hours = shapeOk ? parseTwoDigits(text, 0) : -1;
+	const int minutes = shapeOk ? parseTwoDigits(text, 3) : -1;
+	const int seconds = !shapeOk ? -1 : withSeconds ? parseTwoDigits(text, 6) : 0;
+	if (hours < 0 || hours > 23 || minutes < 0 || minutes > 59 || seconds < 0 || seconds > 59) {
+		throw std::invalid_argument("InvalidTimeOfDayError(SegmentSchedule::fromConfig):" + text);
+	}
+	return std::chrono::hours(hours) + std::chrono::minutes(minutes) + std::chrono::seconds(seconds);
+}
+
+} // anonymous namespace
+
+SegmentSchedule::SegmentSchedule(Kind kind, std::chrono::milliseconds interval, std::chrono::milliseconds offset,
+				 std::vector<std::chrono::milliseconds> timesOfDay, std::chrono::minutes utcOffset)
+	: kind_(kind),
+	  interval_(interval),
+	  offset_(offset),
+	  timesOfDay_(std::move(timesOfDay)),
+	  utcOffset_(utcOffset)
+{
+	if (kind_ != Kind::TimesOfDay && interval_ <= std::chrono::milliseconds::zero()) {
+		throw std::invalid_argument("NonPositiveIntervalError(SegmentSchedule)");
+	}
+	if (kind_ == Kind::TimesOfDay && timesOfDay_.empty()) {
+		throw std::invalid_argument("TimesOfDayIsEmptyError(SegmentSchedule)");
+	}
+	if (utcOffset_ < -std::chrono::hours(24) || utcOffset_ > std::chrono::hours(24)) {
+		throw std::invalid_argument("UtcOffsetOutOfRangeError(SegmentSchedule)");
+	}
+	std::ranges::sort(timesOfDay_);
+	const auto [first, last] = std::ranges::unique(timesOfDay_);
+	timesOfDay_.erase(first, last);
+}
+
+SegmentSchedule SegmentSchedule::everyIntervalFromStart(std::chrono::milliseconds interval)
+{
+	return SegmentSchedule(Kind::IntervalFromStart, interval, {}, {}, {});
+}
+
+SegmentSchedule SegmentSchedule::everyIntervalOnWallClock(std::chrono::milliseconds interval,
+							  std::chrono::milliseconds offset,
+							  std::chrono::minutes utcOffset)
+{
+	return SegmentSchedule(Kind::IntervalOnWallClock, interval, offset, {}, utcOffset);
+}
+
+SegmentSchedule SegmentSchedule::atTimesOfDay(std::vector<std::chrono::milliseconds> timesOfDay,
+					      std::chrono::minutes utcOffset)
+{
+	return SegmentSchedule(Kind::TimesOfDay, {}, {}, std::move(timesOfDay), utcOffset);
+}
+
+SegmentSchedule SegmentSchedule::fromConfig(const nlohmann::json &jConfig)
+{
+	try {
+		const std::chrono::minutes utcOffset(jConfig.value("segmentUtcOffsetMinutes", 0));
+
+		if (jConfig.contains("segmentTimesOfDay")) {
+			std::vector<std::chrono::milliseconds> timesOfDay;
+			for (const nlohmann::json &jTime : jConfig.at("segmentTimesOfDay")) {
+				timesOfDay.push_back(parseTimeOfDay(jTime.get<std::string>()));
+			}
+			return atTimesOfDay(std::move(timesOfDay), utcOffset);
+		}
+
+		const std::chrono::milliseconds interval(jConfig.at("segmentIntervalMilliseconds").get<std::int64_t>());
+		if (jConfig.value("segmentAlignToWallClock", false)) {
+			const std::chrono::milliseconds offset(
+				jConfig.value("segmentOffsetMilliseconds", std::int64_t{0}));
+			return everyIntervalOnWallClock(interval, offset, utcOffset);
+		}
+		return everyIntervalFromStart(interval);
+	} catch (const nlohmann::json::exception &e) {
+		throw std::invalid_argument(std::string("InvalidConfigError(SegmentSchedule::fromConfig):") + e.what());
+	}
+}
+
+SegmentSchedule::Clock::time_point SegmentSchedule::nextBoundary(Clock::time_point sessionStartedAt,
+								 Clock::time_point after) const
+{
+	// Midnight of the configured offset, on 1970-01-01.
+	const Clock::time_point midnight = Clock::time_point{} - utcOffset_;
+
+	switch (kind_) {
+	case Kind::IntervalFromStart:
+		return nextMultiple(sessionStartedAt, interval_, after);
+	case Kind::IntervalOnWallClock:
+		return nextMultiple(midnight + offset_, interval_, after);
+	case Kind::TimesOfDay:
+		break;
+	}
+
+	const auto sinceMidnight = std::chrono::floor<std::chrono::milliseconds>(after - midnight);
+	const Clock::time_point today = midnight + kDay * floorDiv(sinceMidnight.count(), kDay.count());
+	for (const Clock::time_point day : {today, today + kDay}) {
+		for (const std::chrono::milliseconds timeOfDay : timesOfDay_) {
+			if (day + timeOfDay > after) {
+				return day + timeOfDay;
+			}
+		}
+	}
+	// Unreachable: the first time of tomorrow is always later.
+	return today + kDay + kDay;
+}
+
+std::string SegmentSchedule::describe() const
+{
+	const std::string zone = "UTC" + std::string(utcOffset_.count() < 0 ? "" : "+") +
+				 std::to_string(utcOffset_.count()) + "min";
+	switch (kind_) {
+	case Kind::IntervalFromStart:
+		return "every " + std::to_string(interval_.count()) + "ms from start";
+	case Kind::IntervalOnWallClock:
+		return "every " + std::to_string(interval_.count()) + "ms on wall clock offset " +
+		       std::to_string(offset_.count()) + "ms " + zone;
+	case Kind::TimesOfDay:
+		break;
+	}
+
+	std::string times;
+	for (const std::chrono::milliseconds timeOfDay : timesOfDay_) {
+		const auto seconds =
+			static_cast<int>(std::chrono::duration_cast<std::chrono::seconds>(timeOfDay).count());
+		char buffer[32];
+		std::snprintf(buffer, sizeof(buffer), "%02d:%02d:%02d", seconds / 3600, seconds / 60 % 60,
+			      seconds % 60);
+		times += times.empty() ? buffer : std::string(",") + buffer;
+	}
+	return "at " + times + " " + zone;
+}
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Controller
@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - Controller Module
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json_fwd.hpp>
+
+namespace KaitoTokyo::LiveStreamSegmenter::Controller {
+
+/**
+ * When the segments of a continuous session end.
+ *
+ * Every boundary is computed as an absolute wall-clock time from the session start or from
+ * midnight, rather than by adding timer intervals one after another, so a session that runs
+ * for days stays aligned. Wall-clock rules count midnight in a fixed offset from UTC, so
+ * "04:00 JST" is 04:00 with an offset of 540 minutes.
+ */
+class SegmentSchedule {
+public:
+	using Clock = std::chrono::system_clock;
+
+	/**
+	 * Every interval, counted from the session start. This is the default rule.
+	 */
+	static SegmentSchedule everyIntervalFromStart(std::chrono::milliseconds interval);
+
+	/**
+	 * Every interval, counted from midnight plus offset, such as at the top of every hour.
+	 */
+	static SegmentSchedule everyIntervalOnWallClock(std::chrono::milliseconds interval,
+							std::chrono::milliseconds offset,
+							std::chrono::minutes utcOffset);
+
+	/**
+	 * At the given times of day, each counted from midnight.
+	 */
+	static SegmentSchedule atTimesOfDay(std::vector<std::chrono::milliseconds> timesOfDay,
+					    std::chrono::minutes utcOffset);
+
+	/**
+	 * Reads the rule from the result of onInitYouTubeStreamSegmenter. Throws
+	 * std::invalid_argument when the keys are missing or out of range.
+	 */
+	static SegmentSchedule fromConfig(const nlohmann::json &jConfig);
+
+	/**
+	 * Returns the first boundary strictly after the given time.
+	 */
+	Clock::time_point nextBoundary(Clock::time_point sessionStartedAt, Clock::time_point after) const;
+
+	/**
+	 * Whether boundaries depend on the wall clock rather than on the session start.
+	 */
+	bool isWallClock() const noexcept { return kind_ != Kind::IntervalFromStart; }
+
+	// Summary for the log, such as "every 3600000ms on wall clock offset 0ms UTC+540min".
+	std::string describe() const;
+
+private:
+	enum class Kind { IntervalFromStart, IntervalOnWallClock, TimesOfDay };
+
+	SegmentSchedule(Kind kind, std::chrono::milliseconds interval, std::chrono::milliseconds offset,
+			std::vector<std::chrono::milliseconds> timesOfDay, std::chrono::minutes utcOffset);
+
+	Kind kind_;
+	std::chrono::milliseconds interval_;
+	std::chrono::milliseconds offset_;
+	// Sorted and unique, each within one day.
+	std::vector<std::chrono::milliseconds> timesOfDay_;
+	std::chrono::minutes utcOffset_;
+};
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Controller
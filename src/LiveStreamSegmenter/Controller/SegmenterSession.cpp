@@ -0,0 +1,111 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - Controller Module
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "SegmenterSession.hpp"
+
+#include <stdexcept>
+#include <utility>
+
+#include <KaitoTokyo/Logger/ContextLogger.hpp>
+
+namespace KaitoTokyo::LiveStreamSegmenter::Controller {
+
+namespace {
+
+// Records of additional sessions carry their id; the profile's own session logs as it always did.
+std::shared_ptr<const Logger::ILogger> composeSessionLogger(std::shared_ptr<const Logger::ILogger> logger,
+							    const std::string &sessionId)
+{
+	if (!logger) {
+		throw std::invalid_argument("LoggerIsNullError(SegmenterSession)");
+	}
+	if (sessionId.empty()) {
+		return logger;
+	}
+	return Logger::ContextLogger::create(std::move(logger), {{"sessionId", sessionId}});
+}
+
+} // anonymous namespace
+
+SegmenterSession::SegmenterSession(std::string sessionId, std::shared_ptr<Scripting::ScriptingRuntime> runtime,
+				   std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool,
+				   std::shared_ptr<PluginExecutors> executors,
+				   std::shared_ptr<const Store::ProfilePaths> paths,
+				   std::shared_ptr<const Logger::ILogger> logger, UI::StreamSegmenterDock *dock)
+	: sessionId_(std::move(sessionId)),
+	  runtime_(runtime ? std::move(runtime) : throw std::invalid_argument("RuntimeIsNullError(SegmenterSession)")),
+	  curlPool_(curlPool ? std::move(curlPool)
+			     : throw std::invalid_argument("CurlPoolIsNullError(SegmenterSession)")),
+	  executors_(executors ? std::move(executors)
+			       : throw std::invalid_argument("ExecutorsIsNullError(SegmenterSession)")),
+	  paths_(paths ? std::move(paths) : throw std::invalid_argument("PathsIsNullError(SegmenterSession)")),
+	  dock_(dock ? dock : throw std::invalid_argument("DockIsNullError(SegmenterSession)")),
+	  authStore_(std::make_shared<Store::AuthStore>(sessionId_)),
+	  eventHandlerStore_(std::make_shared<Store::EventHandlerStore>(paths_)),
+	  youTubeStore_(std::make_shared<Store::YouTubeStore>(paths_)),
+	  logger_(composeSessionLogger(std::move(logger), sessionId_)),
+	  profileStore_(std::make_shared<Store::ProfileStore>(paths_->profileStoreDatabase,
+							      executors_->getDiskIoShared(), logger_)),
+	  tokenProvider_(std::make_shared<Store::GoogleAccessTokenProvider>(
+		  authStore_, curlPool_, executors_->getNetworkShared(), logger_)),
+	  liveStreamCache_(std::make_shared<Store::LiveStreamCache>(authStore_, tokenProvider_, curlPool_,
+								    executors_->getNetworkShared(), logger_)),
+	  youTubeStreamSegmenterMainLoop_(std::make_shared<YouTubeStreamSegmenterMainLoop>(
+		  runtime_, curlPool_, executors_, tokenProvider_, eventHandlerStore_, youTubeStore_,
+		  liveStreamCache_, paths_, sessionId_.empty() ? "default" : sessionId_, logger_, dock_))
+{
+	authStore_->setLogger(logger_);
+	eventHandlerStore_->setLogger(logger_);
+	youTubeStore_->setLogger(logger_);
+
+	eventHandlerStore_->setProfileStore(profileStore_);
+	youTubeStore_->setProfileStore(profileStore_);
+
+	profileStore_->restore();
+	authStore_->restore();
+	eventHandlerStore_->restore();
+	youTubeStore_->restore();
+
+	dock_->setScriptingRuntime(runtime_);
+	dock_->setCurlConnectionPool(curlPool_);
+	dock_->setAuthStore(authStore_);
+	dock_->setEventHandlerStore(eventHandlerStore_);
+	dock_->setYouTubeStore(youTubeStore_);
+	dock_->setLiveStreamCache(liveStreamCache_);
+
+	QObject::connect(dock_, &UI::StreamSegmenterDock::startButtonClicked, youTubeStreamSegmenterMainLoop_.get(),
+			 &YouTubeStreamSegmenterMainLoop::onStartContinuousSession);
+
+	QObject::connect(dock_, &UI::StreamSegmenterDock::stopButtonClicked, youTubeStreamSegmenterMainLoop_.get(),
+			 &YouTubeStreamSegmenterMainLoop::onStopContinuousSession);
+
+	QObject::connect(dock_, &UI::StreamSegmenterDock::segmentNowButtonClicked,
+			 youTubeStreamSegmenterMainLoop_.get(),
+			 &YouTubeStreamSegmenterMainLoop::onSegmentContinuousSession);
+
+	QObject::connect(youTubeStreamSegmenterMainLoop_.get(), &YouTubeStreamSegmenterMainLoop::tick, dock_,
+			 &UI::StreamSegmenterDock::onMainLoopTimerTick);
+
+	youTubeStreamSegmenterMainLoop_->startMainLoop();
+}
+
+SegmenterSession::~SegmenterSession() noexcept = default;
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Controller
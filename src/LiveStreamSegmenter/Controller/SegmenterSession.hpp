@@ -0,0 +1,92 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - Controller Module
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include <KaitoTokyo/CurlHelper/CurlConnectionPool.hpp>
+#include <KaitoTokyo/Logger/ILogger.hpp>
+
+#include <AuthStore.hpp>
+#include <EventHandlerStore.hpp>
+#include <GoogleAccessTokenProvider.hpp>
+#include <LiveStreamCache.hpp>
+#include <ProfilePaths.hpp>
+#include <ProfileStore.hpp>
+#include <YouTubeStore.hpp>
+#include <ScriptingRuntime.hpp>
+#include <StreamSegmenterDock.hpp>
+
+#include "PluginExecutors.hpp"
+#include "YouTubeStreamSegmenterMainLoop.hpp"
+
+namespace KaitoTokyo::LiveStreamSegmenter::Controller {
+
+/**
+ * One segmenter session, driven from one dock: its own Google sign-in, stores, streaming outputs,
+ * segment timer and journal.
+ *
+ * The scripting runtime, the connection pool and the worker pools belong to MainPluginContext and are
+ * shared by every session, so another channel costs a few objects rather than more threads.
+ */
+class SegmenterSession {
+public:
+	/**
+	 * @param sessionId Empty for the profile's own session, which keeps the keychain entry it had before
+	 * sessions existed. Others come from ProfilePaths::sessionsConfig.
+	 * @param paths The profile paths for this session, see ProfilePaths::forSession().
+	 */
+	SegmenterSession(std::string sessionId, std::shared_ptr<Scripting::ScriptingRuntime> runtime,
+			 std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool,
+			 std::shared_ptr<PluginExecutors> executors, std::shared_ptr<const Store::ProfilePaths> paths,
+			 std::shared_ptr<const Logger::ILogger> logger, UI::StreamSegmenterDock *dock);
+
+	~SegmenterSession() noexcept;
+
+	SegmenterSession(const SegmenterSession &) = delete;
+	SegmenterSession &operator=(const SegmenterSession &) = delete;
+	SegmenterSession(SegmenterSession &&) = delete;
+	SegmenterSession &operator=(SegmenterSession &&) = delete;
+
+	const std::string &getSessionId() const noexcept { return sessionId_; }
+
+private:
+	const std::string sessionId_;
+	const std::shared_ptr<Scripting::ScriptingRuntime> runtime_;
+	const std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool_;
+	const std::shared_ptr<PluginExecutors> executors_;
+	const std::shared_ptr<const Store::ProfilePaths> paths_;
+	UI::StreamSegmenterDock *const dock_;
+
+	const std::shared_ptr<Store::AuthStore> authStore_;
+	const std::shared_ptr<Store::EventHandlerStore> eventHandlerStore_;
+	const std::shared_ptr<Store::YouTubeStore> youTubeStore_;
+
+	const std::shared_ptr<const Logger::ILogger> logger_;
+	const std::shared_ptr<Store::ProfileStore> profileStore_;
+	const std::shared_ptr<Store::GoogleAccessTokenProvider> tokenProvider_;
+	// Shared by the settings dialog and the main loop, so neither lists the live streams from scratch.
+	const std::shared_ptr<Store::LiveStreamCache> liveStreamCache_;
+	const std::shared_ptr<YouTubeStreamSegmenterMainLoop> youTubeStreamSegmenterMainLoop_;
+};
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Controller
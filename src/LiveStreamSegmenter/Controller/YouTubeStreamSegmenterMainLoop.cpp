@@ -20,45 +20,162 @@
 
 #include "YouTubeStreamSegmenterMainLoop.hpp"
 
+#include "OutputKeyframeWaiter.hpp"
+
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <filesystem>
 #include <fstream>
+#include <functional>
+#include <limits>
 #include <optional>
 #include <string_view>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include <QCoreApplication>
 #include <QMessageBox>
 #include <QObject>
+#include <QPointer>
 
 #include <quickjs.h>
 #include <nlohmann/json.hpp>
 
 #include <obs-frontend-api.h>
 
-#include <KaitoTokyo/Async/Join.hpp>
+#include <KaitoTokyo/Async/Cancellation.hpp>
+#include <KaitoTokyo/Async/Generator.hpp>
+#include <KaitoTokyo/Async/ThreadPoolExecutor.hpp>
+#include <KaitoTokyo/Async/TimerService.hpp>
+#include <KaitoTokyo/Async/Tracing.hpp>
+#include <KaitoTokyo/Async/WhenAll.hpp>
 #include <KaitoTokyo/AsyncQt/ResumeOnQObject.hpp>
-#include <KaitoTokyo/AsyncQt/ResumeOnQThreadPool.hpp>
-#include <KaitoTokyo/AsyncQt/ResumeOnQTimerSingleShot.hpp>
 #include <KaitoTokyo/CurlHelper/CurlWriteCallback.hpp>
-#include <KaitoTokyo/GoogleAuth/GoogleAuthManager.hpp>
+#include <KaitoTokyo/Logger/ContextLogger.hpp>
+#include <KaitoTokyo/Metrics/MetricsRegistry.hpp>
 #include <KaitoTokyo/ObsBridgeUtils/ObsUnique.hpp>
 #include <KaitoTokyo/YouTubeApi/YouTubeTypes.hpp>
 
 #include <EventScriptingContext.hpp>
-#include <ScriptingDatabase.hpp>
 
 namespace KaitoTokyo::LiveStreamSegmenter::Controller {
 
+namespace {
+
+// Partial responses for calls that only need a few fields; getLiveStream keeps the full one for cdn.
+constexpr YouTubeApi::YouTubeFieldMask kActiveLiveBroadcastMask{
+	.parts = "id,snippet,contentDetails",
+	.fields = "id,snippet/title,contentDetails/boundStreamId",
+};
+constexpr YouTubeApi::YouTubeFieldMask kLiveStreamStatusMask{
+	.parts = "id,status",
+	.fields = "id,status/streamStatus",
+};
+constexpr YouTubeApi::YouTubeFieldMask kLiveBroadcastStatusMask{
+	.parts = "id,status",
+	.fields = "id,status/lifeCycleStatus",
+};
+
+// Indexed by live stream index, as journaled. All ids come from the same store version.
+std::vector<std::string> getLiveStreamIds(const Store::YouTubeStore &youtubeStore)
+{
+	return youtubeStore.getSnapshot()->liveStreamIds;
+}
+
+// Waits until the slot at index is no longer Completing, so that its live stream can take a broadcast.
+// Must be called from a worker thread and returns on a worker thread
+Async::Task<void> waitForSlotCompletion(LiveStreamRing &ring, std::size_t index,
+					Async::ThreadPoolExecutor &networkExecutor,
+					std::shared_ptr<const Logger::ILogger> logger)
+{
+	ring.settle();
+	const LiveStreamSlot &slot = ring.at(index);
+	if (slot.state != LiveStreamSlotState::Completing || !slot.completed) {
+		co_return;
+	}
+
+	const std::shared_ptr<Async::OneShotEvent> completed = slot.completed;
+	logger->info("LiveStreamSlotWaitingForCompletion", {{"liveStreamId", slot.liveStreamId}});
+	co_await completed->wait();
+	// set() resumes us on the thread that finished the completion.
+	co_await Async::ResumeOn{networkExecutor};
+	ring.settle();
+}
+
+// Waits for every background completion, before the live streams are swept or taken by a new session.
+// Must be called from a worker thread and returns on a worker thread
+Async::Task<void> joinCompletions(Async::TaskScope &completionScope, Async::ThreadPoolExecutor &networkExecutor,
+				  std::shared_ptr<const Logger::ILogger> logger)
+{
+	if (const std::size_t pending = completionScope.size(); pending > 0) {
+		logger->info("LiveBroadcastCompletionsWaiting", {{"count", std::to_string(pending)}});
+	}
+	co_await completionScope.joinAsync();
+	co_await Async::ResumeOn{networkExecutor};
+}
+
+// Written next to the session journal when a session stops, in builds with ENABLE_ASYNC_TRACING.
+void writeAsyncTrace(const std::filesystem::path &tracePath, const Logger::ILogger &logger)
+{
+	if (Async::TraceRecorder::writeChromeTraceFile(tracePath)) {
+		logger.info("AsyncTraceWritten", {{"path", tracePath.string()},
+						 {"dropped", std::to_string(Async::TraceRecorder::droppedCount())}});
+	} else {
+		logger.error("FileWriteError", {{"path", tracePath.string()}});
+	}
+}
+
+// How long unloading waits for the main loop to wind down after cancelling it.
+constexpr std::chrono::milliseconds kMainLoopShutdownTimeout{3000};
+
+// The segment timer wakes up at least this often to look at the wall clock again, so a clock step or a
+// suspend moves a boundary by no more than this.
+constexpr std::chrono::milliseconds kSegmentTimerMaxWait{60 * 1000};
+
+// Wall-clock boundaries closer than this to the session start are skipped, so a session does not open with
+// a stub segment.
+constexpr std::chrono::milliseconds kMinimumFirstSegment{60 * 1000};
+
+// QTimer takes an int, which holds a little over 24 days.
+int toTimerInterval(std::chrono::milliseconds duration)
+{
+	return static_cast<int>(std::clamp<std::chrono::milliseconds::rep>(duration.count(), 0,
+									    std::numeric_limits<int>::max()));
+}
+
+// Health checks spend the quota of the session, but wait behind everything else it asks for.
+std::shared_ptr<YouTubeApi::YouTubeApiClient>
+makeHealthCheckClient(std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool,
+		      std::shared_ptr<YouTubeApi::YouTubeRequestScheduler> requestScheduler,
+		      std::shared_ptr<const Logger::ILogger> logger)
+{
+	auto youTubeApiClient = std::make_shared<YouTubeApi::YouTubeApiClient>(std::move(curlPool));
+	youTubeApiClient->setLogger(std::move(logger));
+	youTubeApiClient->setRequestScheduler(std::move(requestScheduler));
+	youTubeApiClient->setRequestPriority(YouTubeApi::YouTubeRequestPriority::Background);
+	return youTubeApiClient;
+}
+
+} // anonymous namespace
+
 YouTubeStreamSegmenterMainLoop::YouTubeStreamSegmenterMainLoop(
-	std::shared_ptr<Scripting::ScriptingRuntime> runtime, std::shared_ptr<Store::AuthStore> authStore,
+	std::shared_ptr<Scripting::ScriptingRuntime> runtime, std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool,
+	std::shared_ptr<PluginExecutors> executors, std::shared_ptr<Store::GoogleAccessTokenProvider> tokenProvider,
 	std::shared_ptr<Store::EventHandlerStore> eventHandlerStore, std::shared_ptr<Store::YouTubeStore> youtubeStore,
-	std::shared_ptr<const Logger::ILogger> logger, QWidget *parent)
+	std::shared_ptr<Store::LiveStreamCache> liveStreamCache, std::shared_ptr<const Store::ProfilePaths> paths,
+	std::string sessionId, std::shared_ptr<const Logger::ILogger> logger, QWidget *parent)
 	: QObject(nullptr),
 	  runtime_(runtime ? std::move(runtime)
 			   : throw std::invalid_argument("RuntimeIsNullError(YouTubeStreamSegmenterMainLoop)")),
-	  authStore_(authStore ? std::move(authStore)
-			       : throw std::invalid_argument("AuthStoreIsNullError(YouTubeStreamSegmenterMainLoop)")),
+	  curlPool_(curlPool ? std::move(curlPool)
+			     : throw std::invalid_argument("CurlPoolIsNullError(YouTubeStreamSegmenterMainLoop)")),
+	  executors_(executors ? std::move(executors)
+			       : throw std::invalid_argument("ExecutorsIsNullError(YouTubeStreamSegmenterMainLoop)")),
+	  tokenProvider_(tokenProvider ? std::move(tokenProvider)
+				       : throw std::invalid_argument(
+					         "TokenProviderIsNullError(YouTubeStreamSegmenterMainLoop)")),
 	  eventHandlerStore_(eventHandlerStore
 				     ? std::move(eventHandlerStore)
 				     : throw std::invalid_argument(
@@ -66,54 +183,110 @@ YouTubeStreamSegmenterMainLoop::YouTubeStreamSegmenterMainLoop(
 	  youtubeStore_(youtubeStore ? std::move(youtubeStore)
 				     : throw std::invalid_argument(
 					       "YouTubeStoreIsNullError(YouTubeStreamSegmenterMainLoop)")),
+	  liveStreamCache_(liveStreamCache ? std::move(liveStreamCache)
+					   : throw std::invalid_argument(
+						     "LiveStreamCacheIsNullError(YouTubeStreamSegmenterMainLoop)")),
+	  paths_(paths ? std::move(paths)
+		       : throw std::invalid_argument("PathsIsNullError(YouTubeStreamSegmenterMainLoop)")),
+	  sessionId_(std::move(sessionId)),
 	  logger_(logger ? std::move(logger)
 			 : throw std::invalid_argument("LoggerIsNullError(YouTubeStreamSegmenterMainLoop)")),
 	  parent_(parent),
-	  curl_(std::make_shared<CurlHelper::CurlHandle>()),
-	  youTubeApiClient_(std::make_shared<YouTubeApi::YouTubeApiClient>(curl_)),
+	  youTubeApiClient_(std::make_shared<YouTubeApi::YouTubeApiClient>(curlPool_)),
 	  tickTimer_(new QTimer(this)),
-	  segmentTimer_(new QTimer(this))
+	  segmentTimer_(new QTimer(this)),
+	  prepareTimer_(new QTimer(this)),
+	  scriptingCurlExecutor_(std::make_shared<CurlHelper::CurlMultiExecutor>()),
+	  scriptingContext_(std::make_shared<PersistentScriptingContext>(runtime_, eventHandlerStore_, curlPool_,
+									 scriptingCurlExecutor_, logger_)),
+	  phaseTimingStatistics_(std::make_shared<PhaseTimingStatistics>(sessionId_)),
+	  overlappingOutputs_(std::make_shared<OverlappingStreamingOutputs>()),
+	  thumbnailCapture_(std::make_shared<ProgramThumbnailCapture>(logger_)),
+	  sessionJournal_(std::make_shared<Store::SessionJournal>(paths_->sessionJournal)),
+	  liveBroadcastIndex_(std::make_shared<LiveBroadcastIndex>()),
+	  liveStreamHealthMonitor_(std::make_shared<LiveStreamHealthMonitor>(
+		  makeHealthCheckClient(curlPool_, youTubeApiClient_->getRequestScheduler(), logger_), tokenProvider_,
+		  executors_->getNetworkShared(), logger_)),
+	  channel_(std::make_shared<Async::Channel<Message>>())
 {
 	youTubeApiClient_->setLogger(logger_);
+	sessionJournal_->setLogger(logger_);
 
 	tickTimer_->setTimerType(Qt::VeryCoarseTimer);
-	segmentTimer_->setTimerType(Qt::VeryCoarseTimer);
-
-	connect(tickTimer_, &QTimer::timeout, this, [this]() { emit tick(segmentTimer_->remainingTime()); });
-	connect(segmentTimer_, &QTimer::timeout, this, &YouTubeStreamSegmenterMainLoop::onSegmentContinuousSession);
+	// Arms the keyframe-aligned cut; a very coarse timer would arm it up to a second late.
+	segmentTimer_->setTimerType(Qt::PreciseTimer);
+	segmentTimer_->setSingleShot(true);
+	prepareTimer_->setTimerType(Qt::VeryCoarseTimer);
+	prepareTimer_->setSingleShot(true);
+
+	connect(tickTimer_, &QTimer::timeout, this, [this]() {
+		if (!nextSegmentAt_) {
+			emit tick(-1);
+			return;
+		}
+		const auto remaining = *nextSegmentAt_ - SegmentSchedule::Clock::now();
+		emit tick(toTimerInterval(std::chrono::ceil<std::chrono::milliseconds>(remaining)));
+	});
+	connect(segmentTimer_, &QTimer::timeout, this, &YouTubeStreamSegmenterMainLoop::onSegmentTimerTimeout);
+	connect(prepareTimer_, &QTimer::timeout, this,
+		&YouTubeStreamSegmenterMainLoop::onPrepareContinuousSessionSegment);
+
+	QPointer<YouTubeStreamSegmenterMainLoop> self(this);
+	liveStreamHealthMonitor_->setChangedCallback([self](std::shared_ptr<const LiveStreamHealthSnapshot>) {
+		QMetaObject::invokeMethod(
+			QCoreApplication::instance(),
+			[self]() {
+				if (self) {
+					self->onLiveStreamHealthChanged();
+				}
+			},
+			Qt::QueuedConnection);
+	});
 }
 
 YouTubeStreamSegmenterMainLoop::~YouTubeStreamSegmenterMainLoop()
 {
-	channel_.close();
-	Async::join(std::move(mainLoopTask_));
+	sessionCancellationSource_.cancel();
+	liveStreamHealthMonitor_->stop();
+	channel_->close();
+	// Runs on the UI thread during unload, so a main loop stuck in a request must not hold up OBS shutdown.
+	try {
+		if (!mainLoopScope_.joinFor(kMainLoopShutdownTimeout)) {
+			logger_->warn("YouTubeStreamSegmenterMainLoopShutdownTimedOut",
+				      {{"timeoutMilliseconds", std::to_string(kMainLoopShutdownTimeout.count())}});
+		}
+	} catch (const std::exception &e) {
+		logger_->error("YouTubeStreamSegmenterMainLoopError", {{"exception", e.what()}});
+	}
 }
 
 void YouTubeStreamSegmenterMainLoop::startMainLoop()
 {
-	mainLoopTask_ = mainLoop(channel_, curl_, youTubeApiClient_, runtime_, authStore_, eventHandlerStore_,
-				 youtubeStore_, logger_, parent_);
-	mainLoopTask_.start();
+	mainLoopScope_.spawn(mainLoop(channel_, curlPool_, executors_, youTubeApiClient_, scriptingContext_,
+				      tokenProvider_, liveStreamCache_, youtubeStore_, phaseTimingStatistics_,
+				      overlappingOutputs_, thumbnailCapture_, sessionJournal_, liveBroadcastIndex_,
+				      liveStreamHealthMonitor_, paths_, sessionId_, logger_, parent_));
+	mainLoopScope_.spawn(LiveStreamHealthMonitor::run(liveStreamHealthMonitor_));
 
 	// --- Scripting ---
-	std::shared_ptr<JSContext> ctx = runtime_->createContextRaw();
-	std::shared_ptr<Scripting::EventScriptingContext> context =
-		std::make_shared<Scripting::EventScriptingContext>(runtime_, ctx, logger_);
-	Scripting::ScriptingDatabase database(runtime_, ctx, logger_, eventHandlerStore_->getEventHandlerDatabasePath(),
-					      true);
-	context->setupContext();
-	database.setupContext();
-	context->setupLocalStorage();
-
-	const std::string scriptContent = eventHandlerStore_->getEventHandlerScript();
-	context->loadEventHandler(scriptContent.c_str());
-
-	int segmentIntervalMilliseconds = 60 * 60 * 1000;
+	// Building the context here also warms it up for the first session start.
+	std::shared_ptr<Scripting::EventScriptingContext> context = Scripting::ScriptingExecutor::runBlocking(
+		runtime_->getExecutor(), [this]() { return scriptingContext_->acquire(); });
+
+	int prepareAheadMilliseconds = 5 * 60 * 1000;
+	bool makeBeforeBreak = false;
 	try {
-		std::string config = context->executeFunction("onInitYouTubeStreamSegmenter", "{}");
-		nlohmann::json jConfig = nlohmann::json::parse(config);
-		jConfig.at("segmentIntervalMilliseconds").get_to(segmentIntervalMilliseconds);
+		const nlohmann::json jConfig =
+			context->executeFunction("onInitYouTubeStreamSegmenter", nlohmann::json::object());
+		segmentSchedule_ = SegmentSchedule::fromConfig(jConfig);
+		if (jConfig.contains("prepareAheadMilliseconds")) {
+			jConfig.at("prepareAheadMilliseconds").get_to(prepareAheadMilliseconds);
+		}
+		if (jConfig.contains("makeBeforeBreak")) {
+			jConfig.at("makeBeforeBreak").get_to(makeBeforeBreak);
+		}
 	} catch (std::exception &e) {
+		segmentSchedule_ = SegmentSchedule::everyIntervalFromStart(std::chrono::hours(1));
 		logger_->error(
 			"YouTubeStreamSegmenterMainLoopScriptError",
 			{{"exception", e.what()},
@@ -122,143 +295,421 @@ void YouTubeStreamSegmenterMainLoop::startMainLoop()
 			 {"segmentIntervalMilliseconds", "3600000"}});
 	}
 	tickTimer_->setInterval(1000);
-	segmentTimer_->setInterval(segmentIntervalMilliseconds);
-
-	logger_->info("YouTubeStreamSegmenterMainLoopStarted");
+	// The prepare stage fires once per segment, prepareAheadMilliseconds before the boundary.
+	prepareAhead_ = std::chrono::milliseconds(std::max(prepareAheadMilliseconds, 0));
+	overlappingOutputs_->setEnabled(makeBeforeBreak);
+
+	logger_->info("YouTubeStreamSegmenterMainLoopStarted",
+		      {{"segmentSchedule", segmentSchedule_.describe()},
+		       {"prepareAheadMilliseconds", std::to_string(prepareAheadMilliseconds)},
+		       {"makeBeforeBreak", makeBeforeBreak ? "true" : "false"}});
 }
 
 void YouTubeStreamSegmenterMainLoop::onStartContinuousSession()
 {
+	sessionStartedAt_ = SegmentSchedule::Clock::now();
+	nextSegmentAt_ = segmentSchedule_.nextBoundary(
+		sessionStartedAt_,
+		segmentSchedule_.isWallClock() ? sessionStartedAt_ + kMinimumFirstSegment : sessionStartedAt_);
 	tickTimer_->start();
-	segmentTimer_->start();
-	channel_.send(Message{MessageType::StartContinuousSession});
+	armSegmentTimer();
+	armPrepareTimer();
+	sessionCancellationSource_.cancel();
+	sessionCancellationSource_ = Async::CancellationSource();
+	channel_->send(Message{MessageType::StartContinuousSession, sessionCancellationSource_.token()},
+		       {.coalesce = true});
 }
 
 void YouTubeStreamSegmenterMainLoop::onStopContinuousSession()
 {
+	nextSegmentAt_.reset();
 	tickTimer_->stop();
 	segmentTimer_->stop();
-	channel_.send(Message{MessageType::StopContinuousSession});
+	prepareTimer_->stop();
+	// Interrupt whatever the session is doing right now; the stop itself is never cancelled.
+	sessionCancellationSource_.cancel();
+	// Stop overtakes pending segments so a slow YouTube cannot delay it behind a backlog.
+	channel_->send(Message{MessageType::StopContinuousSession, {}}, {.priority = 1, .coalesce = true});
 }
 
 void YouTubeStreamSegmenterMainLoop::onSegmentContinuousSession()
 {
-	channel_.send(Message{MessageType::SegmentContinuousSession});
+	// A manual segment uses up the prepared one, so the next boundary needs its own.
+	if (nextSegmentAt_) {
+		armPrepareTimer();
+	}
+	channel_->send(Message{MessageType::SegmentContinuousSession, sessionCancellationSource_.token()},
+		       {.coalesce = true});
+}
+
+void YouTubeStreamSegmenterMainLoop::onPrepareContinuousSessionSegment()
+{
+	channel_->send(Message{MessageType::PrepareContinuousSessionSegment, sessionCancellationSource_.token()},
+		       {.coalesce = true});
+}
+
+void YouTubeStreamSegmenterMainLoop::onLiveStreamHealthChanged()
+{
+	channel_->send(Message{MessageType::LiveStreamHealthChanged, sessionCancellationSource_.token()},
+		       {.coalesce = true});
+}
+
+void YouTubeStreamSegmenterMainLoop::onSegmentTimerTimeout()
+{
+	if (!nextSegmentAt_) {
+		return;
+	}
+
+	const SegmentSchedule::Clock::time_point now = SegmentSchedule::Clock::now();
+	if (now < *nextSegmentAt_) {
+		// Woke up early to follow the wall clock, which may have stepped since the timer was armed.
+		armSegmentTimer();
+		if (prepareTimer_->isActive()) {
+			armPrepareTimer();
+		}
+		return;
+	}
+
+	// After a suspend several boundaries may have passed; they make one cut, and the schedule resumes from now.
+	const SegmentSchedule::Clock::time_point reached = *nextSegmentAt_;
+	nextSegmentAt_ = segmentSchedule_.nextBoundary(sessionStartedAt_, std::max(reached, now));
+	logger_->info("ContinuousSessionSegmentBoundaryReached",
+		      {{"lateMilliseconds",
+			std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(now - reached).count())},
+		       {"nextSegmentInMilliseconds",
+			std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(*nextSegmentAt_ - now)
+					       .count())}});
+	armSegmentTimer();
+	onSegmentContinuousSession();
+}
+
+void YouTubeStreamSegmenterMainLoop::armSegmentTimer()
+{
+	const auto remaining =
+		std::chrono::ceil<std::chrono::milliseconds>(*nextSegmentAt_ - SegmentSchedule::Clock::now());
+	segmentTimer_->start(toTimerInterval(std::min(remaining, kSegmentTimerMaxWait)));
+}
+
+void YouTubeStreamSegmenterMainLoop::armPrepareTimer()
+{
+	// Fires at once when the boundary is closer than the lead time.
+	prepareTimer_->start(toTimerInterval(std::chrono::ceil<std::chrono::milliseconds>(
+		*nextSegmentAt_ - prepareAhead_ - SegmentSchedule::Clock::now())));
+}
+
+std::string_view YouTubeStreamSegmenterMainLoop::messageTypeName(MessageType type) noexcept
+{
+	switch (type) {
+	case MessageType::StartContinuousSession:
+		return "StartContinuousSession";
+	case MessageType::StopContinuousSession:
+		return "StopContinuousSession";
+	case MessageType::SegmentContinuousSession:
+		return "SegmentContinuousSession";
+	case MessageType::PrepareContinuousSessionSegment:
+		return "PrepareContinuousSessionSegment";
+	case MessageType::LiveStreamHealthChanged:
+		return "LiveStreamHealthChanged";
+	}
+	return "Unknown";
 }
 
 Async::Task<void> YouTubeStreamSegmenterMainLoop::mainLoop(
-	Async::Channel<Message> &channel, std::shared_ptr<CurlHelper::CurlHandle> curl,
-	std::shared_ptr<YouTubeApi::YouTubeApiClient> youTubeApiClient,
-	std::shared_ptr<Scripting::ScriptingRuntime> runtime, std::shared_ptr<Store::AuthStore> authStore,
-	std::shared_ptr<Store::EventHandlerStore> eventHandlerStore, std::shared_ptr<Store::YouTubeStore> youtubeStore,
+	std::shared_ptr<Async::Channel<Message>> channel, std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool,
+	std::shared_ptr<PluginExecutors> executors, std::shared_ptr<YouTubeApi::YouTubeApiClient> youTubeApiClient,
+	std::shared_ptr<PersistentScriptingContext> scriptingContext,
+	std::shared_ptr<Store::GoogleAccessTokenProvider> tokenProvider,
+	std::shared_ptr<Store::LiveStreamCache> liveStreamCache, std::shared_ptr<Store::YouTubeStore> youtubeStore,
+	std::shared_ptr<PhaseTimingStatistics> phaseTimingStatistics,
+	std::shared_ptr<OverlappingStreamingOutputs> overlappingOutputs,
+	std::shared_ptr<ProgramThumbnailCapture> thumbnailCapture,
+	std::shared_ptr<Store::SessionJournal> sessionJournal, std::shared_ptr<LiveBroadcastIndex> liveBroadcastIndex,
+	std::shared_ptr<LiveStreamHealthMonitor> liveStreamHealthMonitor,
+	std::shared_ptr<const Store::ProfilePaths> paths, std::string sessionId,
 	std::shared_ptr<const Logger::ILogger> logger, QWidget *parent)
 {
-	int currentLiveStreamIndex = 0;
-	std::array<YouTubeApi::YouTubeLiveBroadcast, 2> liveBroadcasts;
+	// Every client of the main loop spends the same quota, so they all share this scheduler.
+	const std::shared_ptr<YouTubeApi::YouTubeRequestScheduler> requestScheduler =
+		youTubeApiClient->getRequestScheduler();
+
+	// The live stream the next session starts on; the one the last session ended on.
+	std::size_t startLiveStreamIndex = 0;
+	LiveStreamRing ring;
+	std::optional<PreparedSegment> preparedSegment;
+	// Outgoing broadcasts are completed here, off the cutover path.
+	Async::TaskScope completionScope;
+
+	Async::TraceRecorder::setEnabled(Async::TraceRecorder::isCompiledIn());
+
+	// The journal tells which broadcasts the last session left live, so they can be completed without a scan.
+	// A session that did not stop cleanly is finished this way by the next start.
+	std::optional<Store::SessionJournalRecord> recoveredSession;
+	try {
+		recoveredSession = sessionJournal->replay();
+	} catch (const std::exception &e) {
+		logger->error("SessionJournalReplayError", {{"exception", e.what()}});
+	}
+	if (recoveredSession) {
+		logger->info("SessionJournalRecovered",
+			     {{"phase", recoveredSession->phase},
+			      {"currentLiveStreamIndex", std::to_string(recoveredSession->currentLiveStreamIndex)}});
+		startLiveStreamIndex = recoveredSession->currentLiveStreamIndex;
+
+		const std::vector<std::string> liveStreamIds = getLiveStreamIds(*youtubeStore);
+		if (liveBroadcastIndex->restore(*recoveredSession, liveStreamIds)) {
+			logger->info("LiveBroadcastIndexRestored");
+		} else {
+			// Written for other live streams or by an older version; the first completion scans instead.
+			logger->warn("LiveBroadcastIndexNotRestored");
+		}
+	}
 
 	while (true) {
-		std::optional<Message> message = co_await channel.receive();
+		std::optional<Message> message = co_await channel->receive();
 
 		if (!message.has_value()) {
 			break;
 		}
 
-		co_await AsyncQt::ResumeOnQThreadPool{QThreadPool::globalInstance()};
+		logger->info("MainLoopMessageReceived",
+			     {{"messageType", messageTypeName(message->type)},
+			      {"queueDepth", std::to_string(channel->size())},
+			      {"coalescedCount", std::to_string(channel->coalescedCount())}});
+
+		co_await Async::ResumeOn{executors->getNetwork()};
+
+		Metrics::MetricsRegistry &metrics = Metrics::MetricsRegistry::global();
+		const Metrics::MetricLabels messageLabels{{"session", sessionId},
+							  {"message", std::string(messageTypeName(message->type))}};
+		Metrics::Histogram &messageDuration =
+			metrics.histogram("segmenter_message_duration_seconds",
+					  "Time the main loop spent on each message, such as a whole cutover.",
+					  kPhaseDurationBuckets, messageLabels);
+		const auto messageStartTime = std::chrono::steady_clock::now();
 
 		Async::Task<void> task;
 		try {
 			switch (message->type) {
 			case MessageType::StartContinuousSession: {
-				liveBroadcasts = co_await startContinuousSessionTask(
-					curl, youTubeApiClient, runtime, authStore, eventHandlerStore, youtubeStore,
-					currentLiveStreamIndex, parent, logger);
+				liveStreamHealthMonitor->pause();
+				preparedSegment.reset();
+				co_await joinCompletions(completionScope, executors->getNetwork(), logger);
+				ring = LiveStreamRing();
+				const std::vector<std::string> liveStreamIds = getLiveStreamIds(*youtubeStore);
+				const std::size_t currentLiveStreamIndex =
+					liveStreamIds.empty() ? 0 : startLiveStreamIndex % liveStreamIds.size();
+				auto timings = std::make_shared<PhaseTimings>("start");
+				const std::array<YouTubeApi::YouTubeLiveBroadcast, 2> liveBroadcasts =
+					co_await startContinuousSessionTask(
+						curlPool, executors, requestScheduler, scriptingContext, tokenProvider,
+						liveStreamCache, overlappingOutputs, thumbnailCapture, sessionJournal,
+						liveBroadcastIndex, liveStreamIds, currentLiveStreamIndex, parent,
+						message->cancellationToken, timings, logger)
+						.named("startContinuousSessionTask");
+				ring = LiveStreamRing(liveStreamIds);
+				ring.setCurrentIndex(currentLiveStreamIndex);
+				ring.current().state = LiveStreamSlotState::Live;
+				ring.current().liveBroadcast = liveBroadcasts[0];
+				ring.assignPrepared(ring.next(currentLiveStreamIndex), liveBroadcasts[1]);
+				co_await Async::ResumeOn{executors->getDiskIo()};
+				sessionJournal->append(ring.makeJournalRecord("started"));
+				phaseTimingStatistics->record(*timings, *logger);
 				break;
 			}
 			case MessageType::StopContinuousSession: {
-				Async::Task<void> task = stopContinuousSessionTask(channel, curl, youTubeApiClient,
-										   authStore, youtubeStore, logger);
+				preparedSegment.reset();
+				co_await joinCompletions(completionScope, executors->getNetwork(), logger);
+				// Before any session ran, the live streams in the settings are swept instead.
+				const std::vector<std::string> liveStreamIds =
+					ring.empty() ? getLiveStreamIds(*youtubeStore) : ring.getLiveStreamIds();
+				auto timings = std::make_shared<PhaseTimings>("stop");
+				Async::Task<void> task =
+					stopContinuousSessionTask(*channel, executors, youTubeApiClient, tokenProvider,
+								  overlappingOutputs, liveBroadcastIndex, liveStreamIds,
+								  timings, logger)
+						.named("stopContinuousSessionTask");
 				co_await task;
+				if (!ring.empty()) {
+					startLiveStreamIndex = ring.getCurrentIndex();
+				}
+				ring.reset();
+				co_await Async::ResumeOn{executors->getDiskIo()};
+				sessionJournal->append(Store::SessionJournalRecord{
+					.phase = "stopped",
+					.currentLiveStreamIndex = startLiveStreamIndex,
+					.broadcasts = {},
+					.liveStreamIds = liveStreamIds,
+				});
+				phaseTimingStatistics->record(*timings, *logger);
+
+				const CurlHelper::CurlConnectionPool::Statistics curlStatistics =
+					curlPool->getStatistics();
+				logger->info("CurlConnectionPoolStatistics",
+					     {{"checkouts", std::to_string(curlStatistics.checkouts)},
+					      {"handlesCreated", std::to_string(curlStatistics.handlesCreated)},
+					      {"transfers", std::to_string(curlStatistics.transfers)},
+					      {"newConnections", std::to_string(curlStatistics.newConnections)},
+					      {"reusedConnections", std::to_string(curlStatistics.reusedConnections)}});
+				executors->logStats(*logger);
+				if (Async::TraceRecorder::isEnabled()) {
+					writeAsyncTrace(paths->asyncTrace, *logger);
+				}
 				break;
 			}
 			case MessageType::SegmentContinuousSession: {
-				liveBroadcasts = co_await segmentContinuousSessionTask(
-					curl, youTubeApiClient, runtime, authStore, eventHandlerStore, youtubeStore,
-					currentLiveStreamIndex, liveBroadcasts[1], parent, logger);
-				currentLiveStreamIndex = (currentLiveStreamIndex + 1) % 2;
+				if (ring.empty()) {
+					logger->warn("ContinuousYouTubeSessionSegmentSkipped");
+					break;
+				}
+				// The outgoing live stream goes inactive on purpose during the cutover.
+				liveStreamHealthMonitor->pause();
+				const std::size_t currentLiveStreamIndex = ring.getCurrentIndex();
+				const std::size_t incomingLiveStreamIndex = ring.next(currentLiveStreamIndex);
+				co_await waitForSlotCompletion(ring, incomingLiveStreamIndex, executors->getNetwork(),
+							       logger);
+				const LiveStreamSlot incomingSlot = ring.at(incomingLiveStreamIndex);
+				if (incomingSlot.state != LiveStreamSlotState::Prepared &&
+				    incomingSlot.state != LiveStreamSlotState::Bound) {
+					logger->warn("ContinuousYouTubeSessionSegmentSkipped",
+						     {{"incomingState", liveStreamSlotStateName(incomingSlot.state)}});
+					break;
+				}
+
+				// Both broadcasts may be live from the handover until the outgoing one is completed.
+				LiveStreamRing cutoverRing = ring;
+				cutoverRing.at(incomingLiveStreamIndex).state = LiveStreamSlotState::Live;
+
+				std::optional<PreparedSegment> prepared = std::exchange(preparedSegment, std::nullopt);
+				auto timings = std::make_shared<PhaseTimings>("segment");
+				const std::array<YouTubeApi::YouTubeLiveBroadcast, 2> liveBroadcasts =
+					co_await segmentContinuousSessionTask(
+						curlPool, executors, requestScheduler, scriptingContext, tokenProvider,
+						liveStreamCache, overlappingOutputs, thumbnailCapture, sessionJournal,
+						liveBroadcastIndex, currentLiveStreamIndex, incomingLiveStreamIndex,
+						incomingSlot.liveStreamId, incomingSlot.liveBroadcast,
+						std::move(prepared), cutoverRing.makeJournalRecord("cutover"), parent,
+						message->cancellationToken, timings, logger)
+						.named("segmentContinuousSessionTask");
+
+				// --- Complete the outgoing broadcast in the background ---
+				LiveStreamSlot &outgoingSlot = ring.at(currentLiveStreamIndex);
+				outgoingSlot.state = LiveStreamSlotState::Completing;
+				outgoingSlot.completed = std::make_shared<Async::OneShotEvent>();
+				completionScope.spawn(completeOutgoingLiveBroadcastTask(
+							      curlPool, executors, requestScheduler, tokenProvider,
+							      liveBroadcastIndex, outgoingSlot.liveStreamId,
+							      outgoingSlot.completed, completionScope.token(), logger)
+							      .named("completeOutgoingLiveBroadcastTask"));
+
+				LiveStreamSlot &liveSlot = ring.at(incomingLiveStreamIndex);
+				liveSlot.state = LiveStreamSlotState::Live;
+				liveSlot.liveBroadcast = liveBroadcasts[0];
+				ring.advance();
+				ring.assignPrepared(ring.next(incomingLiveStreamIndex), liveBroadcasts[1]);
+				co_await Async::ResumeOn{executors->getDiskIo()};
+				sessionJournal->append(ring.makeJournalRecord("segmented"));
+				phaseTimingStatistics->record(*timings, *logger);
+				break;
+			}
+			case MessageType::PrepareContinuousSessionSegment: {
+				if (ring.empty()) {
+					logger->warn("ContinuousYouTubeSessionSegmentPrepareSkipped");
+					break;
+				}
+				const std::size_t currentLiveStreamIndex = ring.getCurrentIndex();
+				const std::size_t incomingLiveStreamIndex = ring.next(currentLiveStreamIndex);
+				// Only a ring of two waits here; with more, this slot finished completing a turn ago.
+				co_await waitForSlotCompletion(ring, incomingLiveStreamIndex, executors->getNetwork(),
+							       logger);
+				const LiveStreamSlot incomingSlot = ring.at(incomingLiveStreamIndex);
+				if (incomingSlot.state != LiveStreamSlotState::Prepared &&
+				    incomingSlot.state != LiveStreamSlotState::Bound) {
+					logger->warn("ContinuousYouTubeSessionSegmentPrepareSkipped",
+						     {{"incomingState", liveStreamSlotStateName(incomingSlot.state)}});
+					break;
+				}
+				auto timings = std::make_shared<PhaseTimings>("prepare");
+				// Preparing ahead of the boundary must not hold up a cutover or a stop.
+				preparedSegment = co_await prepareContinuousSessionSegmentTask(
+					curlPool, executors, requestScheduler,
+					YouTubeApi::YouTubeRequestPriority::Background, scriptingContext, tokenProvider,
+					liveStreamCache, thumbnailCapture, currentLiveStreamIndex,
+					incomingSlot.liveStreamId, incomingSlot.liveBroadcast,
+					message->cancellationToken, timings, logger)
+					.named("prepareContinuousSessionSegmentTask");
+				ring.at(incomingLiveStreamIndex).state = LiveStreamSlotState::Bound;
+				phaseTimingStatistics->record(*timings, *logger);
+				break;
+			}
+			case MessageType::LiveStreamHealthChanged: {
+				const std::shared_ptr<const LiveStreamHealthSnapshot> health =
+					liveStreamHealthMonitor->getSnapshot();
+				// Stale once the session stopped or a cutover moved on to another live stream.
+				if (ring.empty() || !health->status ||
+				    health->liveStreamId != ring.current().liveStreamId) {
+					break;
+				}
+				co_await liveStreamHealthChangedTask(*channel, executors, scriptingContext,
+								     overlappingOutputs, liveStreamHealthMonitor,
+								     health, ring.getCurrentIndex(),
+								     message->cancellationToken, logger)
+					.named("liveStreamHealthChangedTask");
 				break;
 			}
 			default:
 				logger->warn("UnknownMessageType");
 			}
+
+			messageDuration.observe(std::chrono::steady_clock::now() - messageStartTime);
+
+			const YouTubeApi::YouTubeQuotaStatistics quotaStatistics = requestScheduler->getStatistics();
+			const Metrics::MetricLabels sessionLabels{{"session", sessionId}};
+			metrics.gauge("youtube_quota_units_used", "Estimated YouTube Data API quota units used today.",
+				      sessionLabels)
+				.set(static_cast<double>(quotaStatistics.unitsUsed));
+			metrics.gauge("youtube_quota_units_daily", "YouTube Data API quota units available per day.",
+				      sessionLabels)
+				.set(static_cast<double>(quotaStatistics.dailyQuotaUnits));
+			logger->info("YouTubeQuotaStatistics",
+				     {{"unitsUsed", std::to_string(quotaStatistics.unitsUsed)},
+				      {"dailyQuotaUnits", std::to_string(quotaStatistics.dailyQuotaUnits)},
+				      {"requests", std::to_string(quotaStatistics.requests)},
+				      {"retries", std::to_string(quotaStatistics.retries)},
+				      {"throttledRequests", std::to_string(quotaStatistics.throttledRequests)}});
 		} catch (const std::exception &e) {
-			logger->error("MainLoopError", {{"exception", e.what()}});
+			messageDuration.observe(std::chrono::steady_clock::now() - messageStartTime);
+			if (message->cancellationToken.isCancellationRequested()) {
+				// Aborted waits and HTTP calls surface as errors; a requested cancel explains them.
+				logger->warn("MainLoopTaskCancelled", {{"exception", e.what()}});
+			} else {
+				metrics.counter("segmenter_message_failures_total",
+						"Main loop messages that ended with an error.", messageLabels)
+					.inc();
+				logger->error("MainLoopError", {{"exception", e.what()}});
+			}
 		} catch (...) {
+			messageDuration.observe(std::chrono::steady_clock::now() - messageStartTime);
+			metrics.counter("segmenter_message_failures_total",
+					"Main loop messages that ended with an error.", messageLabels)
+				.inc();
 			logger->error("MainLoopUnknownError");
 		}
+
+		// Resumes polling after a cutover, now on the live stream that is live, if any.
+		liveStreamHealthMonitor->watch(ring.empty() ? std::string() : ring.current().liveStreamId);
 	}
 }
 
 namespace {
 
-class TaskBoundLogger : public Logger::ILogger {
-public:
-	TaskBoundLogger(std::shared_ptr<const Logger::ILogger> baseLogger, std::string_view taskName)
-		: baseLogger_(std::move(baseLogger)),
-		  taskName_(taskName)
-	{
-	}
-
-private:
-	void log(Logger::LogLevel level, std::string_view name, std::source_location loc,
-		 std::span<const Logger::LogField> context) const noexcept override
-	{
-		std::vector<Logger::LogField> extendedContext;
-		extendedContext.reserve(context.size() + 1);
-		extendedContext.emplace_back("taskName", taskName_);
-		extendedContext.insert(extendedContext.end(), context.begin(), context.end());
-		baseLogger_->log(level, name, loc, std::span<const Logger::LogField>(extendedContext));
-	}
-
-	std::shared_ptr<const Logger::ILogger> baseLogger_;
-	std::string taskName_;
-};
-
+// Usually served from the provider's cache; blocks on a refresh only if the background one has not run.
 // Must be called from a worker thread and returns on a worker thread
-std::string getAccessToken(std::shared_ptr<CurlHelper::CurlHandle> curl, std::shared_ptr<Store::AuthStore> authStore,
+std::string getAccessToken(std::shared_ptr<Store::GoogleAccessTokenProvider> tokenProvider,
 			   std::shared_ptr<const Logger::ILogger> logger)
 {
 	logger->info("YouTubeAccessTokenGetting");
 
-	std::string accessToken;
-
-	GoogleAuth::GoogleOAuth2ClientCredentials clientCredentials = authStore->getGoogleOAuth2ClientCredentials();
-	GoogleAuth::GoogleAuthManager authManager(curl, clientCredentials, logger);
-
-	GoogleAuth::GoogleTokenState tokenState = authStore->getGoogleTokenState();
-
-	if (!tokenState.isAuthorized()) {
-		logger->error("YouTubeAccessTokenNotAuthorized");
-		throw std::runtime_error(
-			"YouTubeAccessTokenNotAuthorized(YouTubeStreamSegmenterMainLoop::getAccessToken)");
-	}
-
-	if (tokenState.isAccessTokenFresh()) {
-		logger->info("YouTubeAccessTokenFresh");
-		accessToken = tokenState.access_token;
-	} else {
-		logger->info("YouTubeAccessTokenRefreshing");
-
-		GoogleAuth::GoogleAuthResponse freshAuthResponse =
-			authManager.fetchFreshAuthResponse(tokenState.refresh_token);
-
-		tokenState.loadAuthResponse(freshAuthResponse);
-
-		authStore->setGoogleTokenState(tokenState);
-
-		accessToken = freshAuthResponse.access_token;
-
-		logger->info("YouTubeAccessTokenRefreshed");
-	}
+	std::string accessToken = tokenProvider->getAccessToken();
 
 	logger->info("YouTubeAccessTokenGotten");
 
@@ -312,10 +763,18 @@ void completeActiveLiveBroadcasts(std::shared_ptr<YouTubeApi::YouTubeApiClient>
 {
 	logger->info("YouTubeLiveBroadcastCompletingAllActive");
 
-	const std::vector<YouTubeApi::YouTubeLiveBroadcast> activeLiveBroadcasts =
-		youTubeApiClient->listLiveBroadcastsByStatus(accessToken, "active");
+	Async::Generator<YouTubeApi::YouTubeLiveBroadcast> activeLiveBroadcasts =
+		youTubeApiClient->iterateLiveBroadcastsByStatus(accessToken, "active", kActiveLiveBroadcastMask);
+
+	// A live stream feeds one active broadcast at a time, so the listing stops once each one is found.
+	std::size_t remainingLiveStreams = liveStreamIds.size();
+	while (remainingLiveStreams > 0) {
+		const std::optional<YouTubeApi::YouTubeLiveBroadcast> nextLiveBroadcast =
+			activeLiveBroadcasts.nextInline();
+		if (!nextLiveBroadcast)
+			break;
 
-	for (const YouTubeApi::YouTubeLiveBroadcast &liveBroadcast : activeLiveBroadcasts) {
+		const YouTubeApi::YouTubeLiveBroadcast &liveBroadcast = *nextLiveBroadcast;
 		if (!liveBroadcast.contentDetails || !liveBroadcast.contentDetails->boundStreamId) {
 			logger->warn("YouTubeLiveBroadcastBoundStreamIdMissing");
 			continue;
@@ -326,6 +785,7 @@ void completeActiveLiveBroadcasts(std::shared_ptr<YouTubeApi::YouTubeApiClient>
 		const auto it = std::ranges::find(liveStreamIds, boundStreamId);
 		if (it == liveStreamIds.end())
 			continue;
+		--remainingLiveStreams;
 
 		if (!liveBroadcast.id) {
 			logger->warn("YouTubeLiveBroadcastIdMissing");
@@ -340,7 +800,8 @@ void completeActiveLiveBroadcasts(std::shared_ptr<YouTubeApi::YouTubeApiClient>
 		logger->info("YouTubeLiveBroadcastCompleting",
 			     {{"broadcastId", liveBroadcastId}, {"title", liveBroadcastTitle}});
 
-		youTubeApiClient->transitionLiveBroadcast(accessToken, liveBroadcastId, "complete");
+		youTubeApiClient->transitionLiveBroadcast(accessToken, liveBroadcastId, "complete",
+							  kLiveBroadcastStatusMask);
 		logger->info("YouTubeLiveBroadcastCompleted",
 			     {{"broadcastId", liveBroadcastId}, {"title", liveBroadcastTitle}});
 	}
@@ -348,24 +809,83 @@ void completeActiveLiveBroadcasts(std::shared_ptr<YouTubeApi::YouTubeApiClient>
 	logger->info("YouTubeLiveBroadcastCompletedAllActive");
 }
 
+// Completes the live broadcasts the index knows about, and scans the active broadcasts only for live streams
+// it does not know or got wrong. Afterwards none of the live streams carries a live broadcast.
 // Must be called from a worker thread and returns on a worker thread
-YouTubeApi::YouTubeLiveBroadcast createLiveBroadcast(std::shared_ptr<YouTubeApi::YouTubeApiClient> youTubeApiClient,
-						     const std::string &accessToken,
-						     std::shared_ptr<Scripting::EventScriptingContext> context,
-						     const std::string &onCreateLiveBroadcastFunctionName,
-						     const std::string &onSetThumbnailFunctionName,
-						     std::shared_ptr<const Logger::ILogger> logger)
+void completeLiveBroadcasts(std::shared_ptr<YouTubeApi::YouTubeApiClient> youTubeApiClient,
+			    const std::string &accessToken, std::span<const std::string> liveStreamIds,
+			    LiveBroadcastIndex &liveBroadcastIndex, std::shared_ptr<const Logger::ILogger> logger)
 {
-	logger->info("YouTubeLiveBroadcastCreating");
+	if (const std::optional<std::vector<std::string>> liveBroadcastIds =
+		    liveBroadcastIndex.findLive(liveStreamIds)) {
+		logger->info("YouTubeLiveBroadcastCompletingIndexed",
+			     {{"count", std::to_string(liveBroadcastIds->size())}});
+
+		try {
+			for (const std::string &liveBroadcastId : *liveBroadcastIds) {
+				logger->info("YouTubeLiveBroadcastCompleting", {{"broadcastId", liveBroadcastId}});
+				youTubeApiClient->transitionLiveBroadcast(accessToken, liveBroadcastId, "complete",
+									  kLiveBroadcastStatusMask);
+				logger->info("YouTubeLiveBroadcastCompleted", {{"broadcastId", liveBroadcastId}});
+			}
+
+			liveBroadcastIndex.setIdle(liveStreamIds);
+			logger->info("YouTubeLiveBroadcastCompletedIndexed");
+			return;
+		} catch (const std::exception &e) {
+			// Most likely completed or deleted elsewhere; the scan finds out what is really active.
+			logger->warn("LiveBroadcastIndexInconsistent", {{"exception", e.what()}});
+			liveBroadcastIndex.forget(liveStreamIds);
+		}
+	} else {
+		logger->info("LiveBroadcastIndexMissed");
+	}
 
-	const std::string result = context->executeFunction(onCreateLiveBroadcastFunctionName.c_str(), R"({})");
-	const nlohmann::json j = nlohmann::json::parse(result);
+	completeActiveLiveBroadcasts(youTubeApiClient, accessToken, liveStreamIds, logger);
+	liveBroadcastIndex.setIdle(liveStreamIds);
+}
+
+struct LiveBroadcastThumbnail {
+	std::string videoId;
+	std::string thumbnailFile;
+	// Set when the handler returned captureThumbnail: true instead of a file.
+	bool captureThumbnail = false;
+};
+
+YouTubeApi::InsertingYouTubeLiveBroadcast parseInsertingLiveBroadcast(const nlohmann::json &j)
+{
 	YouTubeApi::InsertingYouTubeLiveBroadcast insertingLiveBroadcast;
 	j.at("YouTubeLiveBroadcast").get_to(insertingLiveBroadcast);
+	return insertingLiveBroadcast;
+}
+
+// Must be called from a worker thread and returns on a worker thread.
+// No thread is held while the handler awaits fetch() and friends.
+Async::Task<YouTubeApi::InsertingYouTubeLiveBroadcast>
+evaluateInsertingLiveBroadcastTask(Async::ThreadPoolExecutor &networkExecutor,
+				   std::shared_ptr<Scripting::EventScriptingContext> context,
+				   std::string onCreateLiveBroadcastFunctionName,
+				   std::shared_ptr<const Logger::ILogger> logger)
+{
+	logger->info("YouTubeLiveBroadcastCreating");
+
+	const nlohmann::json j =
+		co_await context->executeFunctionTask(onCreateLiveBroadcastFunctionName, nlohmann::json::object());
+	// Host jobs resume the handler on the curl poll thread; leave it before doing anything else.
+	co_await Async::ResumeOn{networkExecutor};
+
+	co_return parseInsertingLiveBroadcast(j);
+}
 
+// Must be called from a worker thread and returns on a worker thread
+YouTubeApi::YouTubeLiveBroadcast
+insertLiveBroadcast(std::shared_ptr<YouTubeApi::YouTubeApiClient> youTubeApiClient, const std::string &accessToken,
+		    const YouTubeApi::InsertingYouTubeLiveBroadcast &insertingLiveBroadcast,
+		    std::shared_ptr<const Logger::ILogger> logger)
+{
 	logger->info("YouTubeLiveBroadcastInserting");
 
-	const YouTubeApi::YouTubeLiveBroadcast liveBroadcast =
+	YouTubeApi::YouTubeLiveBroadcast liveBroadcast =
 		youTubeApiClient->insertLiveBroadcast(accessToken, insertingLiveBroadcast);
 	const std::string liveBroadcastId = liveBroadcast.id.value_or("(ID MISSING)");
 	const std::string liveBroadcastTitle = (liveBroadcast.snippet && liveBroadcast.snippet->title)
@@ -373,137 +893,300 @@ YouTubeApi::YouTubeLiveBroadcast createLiveBroadcast(std::shared_ptr<YouTubeApi:
 						       : "(TITLE MISSING)";
 	logger->info("YouTubeLiveBroadcastInserted", {{"broadcastId", liveBroadcastId}, {"title", liveBroadcastTitle}});
 
-	const nlohmann::json setThumbnailEventObj{
+	return liveBroadcast;
+}
+
+std::optional<LiveBroadcastThumbnail> parseThumbnail(const nlohmann::json &jThumbnail,
+						     std::shared_ptr<const Logger::ILogger> logger)
+{
+	if (!jThumbnail.contains("videoId") || !jThumbnail["videoId"].is_string()) {
+		logger->warn("YouTubeLiveBroadcastThumbnailVideoIdMissing");
+		return std::nullopt;
+	}
+
+	LiveBroadcastThumbnail thumbnail;
+	jThumbnail.at("videoId").get_to(thumbnail.videoId);
+
+	if (jThumbnail.contains("captureThumbnail") && jThumbnail["captureThumbnail"].is_boolean() &&
+	    jThumbnail["captureThumbnail"].get<bool>()) {
+		thumbnail.captureThumbnail = true;
+		return thumbnail;
+	}
+
+	if (!jThumbnail.contains("thumbnailFile") || !jThumbnail["thumbnailFile"].is_string()) {
+		logger->warn("YouTubeLiveBroadcastThumbnailFileMissing", {{"videoId", thumbnail.videoId}});
+		return std::nullopt;
+	}
+	jThumbnail.at("thumbnailFile").get_to(thumbnail.thumbnailFile);
+
+	return thumbnail;
+}
+
+// Must be called from a worker thread and returns on a worker thread
+Async::Task<std::optional<LiveBroadcastThumbnail>>
+evaluateThumbnailTask(Async::ThreadPoolExecutor &networkExecutor,
+		      std::shared_ptr<Scripting::EventScriptingContext> context, std::string onSetThumbnailFunctionName,
+		      YouTubeApi::YouTubeLiveBroadcast liveBroadcast, std::shared_ptr<const Logger::ILogger> logger)
+{
+	nlohmann::json setThumbnailEventObj{
 		{"LiveBroadcast", liveBroadcast},
 	};
-	const std::string setThumbnailEventObjJson = setThumbnailEventObj.dump();
-	const std::string thumbnailResult =
-		context->executeFunction(onSetThumbnailFunctionName.c_str(), setThumbnailEventObjJson.c_str());
-	const nlohmann::json jThumbnail = nlohmann::json::parse(thumbnailResult);
-
-	if (jThumbnail.contains("videoId") && jThumbnail["videoId"].is_string()) {
-		std::string videoId;
-		jThumbnail.at("videoId").get_to(videoId);
+	const nlohmann::json jThumbnail =
+		co_await context->executeFunctionTask(onSetThumbnailFunctionName, std::move(setThumbnailEventObj));
+	co_await Async::ResumeOn{networkExecutor};
 
-		if (jThumbnail.contains("thumbnailFile") && jThumbnail["thumbnailFile"].is_string()) {
-			std::string thumbnailFile;
-			jThumbnail.at("thumbnailFile").get_to(thumbnailFile);
+	co_return parseThumbnail(jThumbnail, logger);
+}
 
-			const std::filesystem::path thumbnailPath(
-				reinterpret_cast<const char8_t *>(thumbnailFile.data()));
+// Must be called from a worker thread and returns on a worker thread
+void setLiveBroadcastThumbnail(std::shared_ptr<YouTubeApi::YouTubeApiClient> youTubeApiClient,
+			       std::shared_ptr<ProgramThumbnailCapture> thumbnailCapture,
+			       const std::string &accessToken, const std::optional<LiveBroadcastThumbnail> &thumbnail,
+			       std::shared_ptr<const Logger::ILogger> logger)
+{
+	if (!thumbnail) {
+		return;
+	}
 
-			logger->info("YouTubeLiveBroadcastThumbnailSetting",
-				     {{"videoId", videoId}, {"thumbnailFile", thumbnailFile}});
+	if (thumbnail->captureThumbnail) {
+		logger->info("YouTubeLiveBroadcastThumbnailCapturing", {{"videoId", thumbnail->videoId}});
 
-			youTubeApiClient->setThumbnail(accessToken, videoId, thumbnailPath);
+		const YouTubeApi::YouTubeUploadSource capturedThumbnail = thumbnailCapture->capture();
+		youTubeApiClient->setThumbnail(accessToken, thumbnail->videoId, capturedThumbnail);
 
-			logger->info("YouTubeLiveBroadcastThumbnailSet",
-				     {{"videoId", videoId}, {"thumbnailFile", thumbnailFile}});
-		} else {
-			logger->warn("YouTubeLiveBroadcastThumbnailFileMissing", {{"videoId", videoId}});
-		}
-	} else {
-		logger->warn("YouTubeLiveBroadcastThumbnailVideoIdMissing");
+		logger->info("YouTubeLiveBroadcastThumbnailSet",
+			     {{"videoId", thumbnail->videoId}, {"thumbnailFile", "(captured)"}});
+		return;
 	}
 
-	logger->info("YouTubeLiveBroadcastCreated");
+	const std::filesystem::path thumbnailPath(reinterpret_cast<const char8_t *>(thumbnail->thumbnailFile.data()));
 
-	return liveBroadcast;
+	logger->info("YouTubeLiveBroadcastThumbnailSetting",
+		     {{"videoId", thumbnail->videoId}, {"thumbnailFile", thumbnail->thumbnailFile}});
+
+	youTubeApiClient->setThumbnail(accessToken, thumbnail->videoId, thumbnailPath);
+
+	logger->info("YouTubeLiveBroadcastThumbnailSet",
+		     {{"videoId", thumbnail->videoId}, {"thumbnailFile", thumbnail->thumbnailFile}});
 }
 
-// Must be called from a worker thread and returns on the main thread
-Async::Task<void> startStreaming(std::shared_ptr<YouTubeApi::YouTubeApiClient> youTubeApiClient,
-				 const std::string &accessToken, QObject *parent,
-				 std::shared_ptr<YouTubeApi::YouTubeLiveBroadcast> nextLiveBroadcast,
-				 std::shared_ptr<YouTubeApi::YouTubeLiveStream> nextLiveStream,
-				 std::shared_ptr<const Logger::ILogger> logger)
+// Returns on a worker thread. The handlers are awaited like in the start path, so no thread is held while
+// they wait for fetch() and friends.
+Async::Task<YouTubeApi::YouTubeLiveBroadcast>
+createLiveBroadcastTask(Async::ThreadPoolExecutor &networkExecutor,
+			std::shared_ptr<YouTubeApi::YouTubeApiClient> youTubeApiClient,
+			std::shared_ptr<ProgramThumbnailCapture> thumbnailCapture, std::string accessToken,
+			std::shared_ptr<Scripting::EventScriptingContext> context,
+			std::string onCreateLiveBroadcastFunctionName, std::string onSetThumbnailFunctionName,
+			std::shared_ptr<PhaseTimings> timings, std::shared_ptr<const Logger::ILogger> logger)
 {
-	logger->info("StreamingStarting");
+	co_await Async::ResumeOn{networkExecutor};
 
-	if (!nextLiveBroadcast->id) {
-		logger->error("YouTubeLiveBroadcastIdMissing");
-		throw std::runtime_error(
-			"YouTubeLiveBroadcastIdMissing(YouTubeStreamSegmenterMainLoop::startStreaming)");
-	}
-	logger->info("YouTubeLiveBroadcastBindingLiveStream",
-		     {{"broadcastId", *nextLiveBroadcast->id}, {"streamId", nextLiveStream->id}});
+	PhaseTimings::Span insertingScriptSpan(timings, SessionPhase::ScriptCall);
+	const YouTubeApi::InsertingYouTubeLiveBroadcast insertingLiveBroadcast =
+		co_await evaluateInsertingLiveBroadcastTask(networkExecutor, context,
+							    std::move(onCreateLiveBroadcastFunctionName), logger);
+	insertingScriptSpan.stop();
 
-	youTubeApiClient->bindLiveBroadcast(accessToken, *nextLiveBroadcast->id, nextLiveStream->id);
-	logger->info("YouTubeLiveBroadcastBoundToLiveStream",
-		     {{"broadcastId", *nextLiveBroadcast->id}, {"streamId", nextLiveStream->id}});
+	PhaseTimings::Span insertSpan(timings, SessionPhase::Insert);
+	YouTubeApi::YouTubeLiveBroadcast liveBroadcast =
+		insertLiveBroadcast(youTubeApiClient, accessToken, insertingLiveBroadcast, logger);
+	insertSpan.stop();
 
-	if (nextLiveStream->cdn.ingestionType == "rtmp") {
-		logger->info("OBSStreamingYouTubeRTMPServiceCreating");
+	PhaseTimings::Span thumbnailScriptSpan(timings, SessionPhase::ScriptCall);
+	const std::optional<LiveBroadcastThumbnail> thumbnail = co_await evaluateThumbnailTask(
+		networkExecutor, context, std::move(onSetThumbnailFunctionName), liveBroadcast, logger);
+	thumbnailScriptSpan.stop();
 
-		auto settings = ObsBridgeUtils::unique_obs_data_t(obs_data_create());
-		obs_data_set_string(settings.get(), "service", "YouTube - RTMP");
-		obs_data_set_string(settings.get(), "server", "rtmps://a.rtmps.youtube.com:443/live2");
-		obs_data_set_string(settings.get(), "key", nextLiveStream->cdn.ingestionInfo.streamName.c_str());
+	PhaseTimings::Span thumbnailSpan(timings, SessionPhase::Thumbnail);
+	setLiveBroadcastThumbnail(youTubeApiClient, thumbnailCapture, accessToken, thumbnail, logger);
+	thumbnailSpan.stop();
 
-		obs_service_t *service =
-			obs_service_create("rtmp_common", "YouTube RTMP Service", settings.get(), NULL);
+	logger->info("YouTubeLiveBroadcastCreated");
 
-		obs_frontend_set_streaming_service(service);
-		obs_service_release(service);
+	co_return liveBroadcast;
+}
 
-		logger->info("OBSStreamingYouTubeRTMPServiceCreated");
-	} else if (nextLiveStream->cdn.ingestionType == "hls") {
-		logger->info("OBSStreamingYouTubeHLSServiceCreating");
+// Concurrent branches can share the client; each request checks out its own pooled connection.
+// Requests made through the client are aborted once cancellationToken is cancelled, and compete for
+// requestScheduler with the given priority.
+std::shared_ptr<YouTubeApi::YouTubeApiClient>
+makeYouTubeApiClient(std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool,
+		     std::shared_ptr<YouTubeApi::YouTubeRequestScheduler> requestScheduler,
+		     YouTubeApi::YouTubeRequestPriority requestPriority, std::shared_ptr<const Logger::ILogger> logger,
+		     Async::CancellationToken cancellationToken)
+{
+	auto youTubeApiClient = std::make_shared<YouTubeApi::YouTubeApiClient>(std::move(curlPool));
+	youTubeApiClient->setLogger(std::move(logger));
+	youTubeApiClient->setRequestScheduler(std::move(requestScheduler));
+	youTubeApiClient->setRequestPriority(requestPriority);
+	if (cancellationToken.canBeCancelled()) {
+		youTubeApiClient->setAbortPredicate(
+			[cancellationToken]() { return cancellationToken.isCancellationRequested(); });
+	}
+	return youTubeApiClient;
+}
 
-		auto settings = ObsBridgeUtils::unique_obs_data_t(obs_data_create());
-		obs_data_set_string(settings.get(), "service", "YouTube - HLS");
-		obs_data_set_string(
-			settings.get(), "server",
-			"https://a.upload.youtube.com/http_upload_hls?cid={stream_key}&copy=0&file=out.m3u8");
-		obs_data_set_string(settings.get(), "key", nextLiveStream->cdn.ingestionInfo.streamName.c_str());
+// Runs fn on a worker thread; combine with Async::whenAll to overlap blocking calls.
+// fn is taken by value and must not capture references to the caller's locals.
+template<typename F> Async::Task<std::invoke_result_t<F>> runOnExecutor(Async::ThreadPoolExecutor &executor, F fn)
+{
+	co_await Async::ResumeOn{executor};
+	if constexpr (std::is_void_v<std::invoke_result_t<F>>) {
+		fn();
+	} else {
+		co_return fn();
+	}
+}
+
+struct ReadinessWaitPolicy {
+	std::chrono::milliseconds initialDelay;
+	std::chrono::milliseconds maxDelay;
+	std::chrono::milliseconds deadline;
+};
 
-		obs_service_t *service = obs_service_create("rtmp_common", "YouTube HLS Service", settings.get(), NULL);
+// Probes quickly at first and backs off exponentially up to maxDelay, giving up once the deadline has passed.
+// Throws Async::OperationCancelledError as soon as cancellationToken is cancelled.
+// Must be called from a worker thread and returns on a worker thread
+Async::Task<bool> waitUntilReady(Async::ThreadPoolExecutor &networkExecutor, std::string waitName,
+				 ReadinessWaitPolicy policy, Async::CancellationToken cancellationToken,
+				 std::function<bool()> probe, std::shared_ptr<const Logger::ILogger> logger)
+{
+	using namespace std::chrono;
+
+	const steady_clock::time_point startTime = steady_clock::now();
+	milliseconds delay = policy.initialDelay;
+
+	for (int attempt = 1; true; ++attempt) {
+		// The timer thread only resumes sleepers, so the probe moves to the pool without a trip through
+		// the UI thread.
+		co_await Async::sleepFor(delay, cancellationToken);
+		co_await Async::ResumeOn{networkExecutor};
+		cancellationToken.throwIfCancellationRequested();
+
+		const bool ready = probe();
+		const milliseconds elapsed = duration_cast<milliseconds>(steady_clock::now() - startTime);
+
+		if (ready) {
+			logger->info("ReadinessWaitSucceeded",
+				     {{"waitName", waitName},
+				      {"attempts", std::to_string(attempt)},
+				      {"elapsedMilliseconds", std::to_string(elapsed.count())}});
+			co_return true;
+		}
 
-		obs_frontend_set_streaming_service(service);
-		obs_service_release(service);
+		if (elapsed >= policy.deadline) {
+			logger->error("ReadinessWaitTimedOut",
+				      {{"waitName", waitName},
+				       {"attempts", std::to_string(attempt)},
+				       {"elapsedMilliseconds", std::to_string(elapsed.count())}});
+			co_return false;
+		}
 
-		logger->info("OBSStreamingYouTubeHLSServiceCreated");
-	} else {
-		logger->error("OBSStreamingUnsupportedYouTubeIngestionTypeError",
-			      {{"ingestionType", nextLiveStream->cdn.ingestionType}});
-		throw std::runtime_error(
-			"OBSStreamingUnsupportedYouTubeIngestionTypeError(YouTubeStreamSegmenterMainLoop::startOBSStreaming)");
+		delay = std::min({delay * 2, policy.maxDelay, policy.deadline - elapsed});
+		logger->debug("ReadinessWaitRetrying", [&] {
+			return std::to_array<Logger::OwnedLogField>({
+				{"waitName", waitName},
+				{"attempts", std::to_string(attempt)},
+				{"nextDelayMilliseconds", std::to_string(delay.count())},
+			});
+		});
 	}
+}
 
-	obs_frontend_streaming_start();
+constexpr ReadinessWaitPolicy kLiveStreamActivePolicy{
+	.initialDelay = std::chrono::milliseconds{500},
+	.maxDelay = std::chrono::milliseconds{5000},
+	.deadline = std::chrono::milliseconds{100000},
+};
 
-	logger->info("OBSStreamingStarted");
+constexpr ReadinessWaitPolicy kLiveBroadcastTestingPolicy{
+	.initialDelay = std::chrono::milliseconds{250},
+	.maxDelay = std::chrono::milliseconds{2000},
+	.deadline = std::chrono::milliseconds{30000},
+};
 
-	logger->info("YouTubeLiveStreamWaitingForActive", {{"liveStreamId", nextLiveStream->id}});
+// Must be called from a worker thread and returns on a worker thread
+YouTubeApi::YouTubeLiveStream getLiveStream(std::shared_ptr<YouTubeApi::YouTubeApiClient> youTubeApiClient,
+					    const std::string &accessToken, Store::LiveStreamCache &liveStreamCache,
+					    const std::string &liveStreamId,
+					    std::shared_ptr<const Logger::ILogger> logger)
+{
+	// The ingestion settings of a live stream do not change, so a cached one saves the round trip.
+	if (std::optional<YouTubeApi::YouTubeLiveStream> cached = liveStreamCache.find(liveStreamId)) {
+		logger->info("YouTubeLiveStreamCached", {{"liveStreamId", liveStreamId}});
+		return *std::move(cached);
+	}
 
-	const std::array<std::string, 1> nextLiveStreamIdArray{nextLiveStream->id};
-	for (int maxAttempts = 20; true; --maxAttempts) {
-		co_await AsyncQt::ResumeOnQTimerSingleShot{5000, parent};
-		co_await AsyncQt::ResumeOnQThreadPool{QThreadPool::globalInstance()};
+	const std::array<std::string, 1> liveStreamIdArray{liveStreamId};
+	const std::vector<YouTubeApi::YouTubeLiveStream> liveStreams =
+		youTubeApiClient->listLiveStreams(accessToken, liveStreamIdArray);
+	if (liveStreams.empty()) {
+		logger->error("YouTubeLiveStreamNotFound", {{"liveStreamId", liveStreamId}});
+		throw std::runtime_error("YouTubeLiveStreamNotFound(YouTubeStreamSegmenterMainLoop::getLiveStream)");
+	} else if (liveStreams.size() > 1) {
+		logger->warn("YouTubeLiveStreamMultipleFound", {{"liveStreamId", liveStreamId}});
+	}
+	liveStreamCache.put(liveStreams[0]);
+	return liveStreams[0];
+}
 
-		const std::string maxAttemptsStr = std::to_string(maxAttempts);
-		logger->info("YouTubeLiveStreamCheckingIfActive",
-			     {{"liveStreamId", nextLiveStream->id}, {"attemptsLeft", maxAttemptsStr}});
+// Must be called from a worker thread and returns on a worker thread
+void bindLiveBroadcast(std::shared_ptr<YouTubeApi::YouTubeApiClient> youTubeApiClient, const std::string &accessToken,
+		       const YouTubeApi::YouTubeLiveBroadcast &liveBroadcast, const std::string &liveStreamId,
+		       std::shared_ptr<const Logger::ILogger> logger)
+{
+	if (!liveBroadcast.id) {
+		logger->error("YouTubeLiveBroadcastIdMissing");
+		throw std::runtime_error(
+			"YouTubeLiveBroadcastIdMissing(YouTubeStreamSegmenterMainLoop::bindLiveBroadcast)");
+	}
+	logger->info("YouTubeLiveBroadcastBindingLiveStream",
+		     {{"broadcastId", *liveBroadcast.id}, {"streamId", liveStreamId}});
 
-		const std::vector<YouTubeApi::YouTubeLiveStream> liveStreams =
-			youTubeApiClient->listLiveStreams(accessToken, nextLiveStreamIdArray);
+	youTubeApiClient->bindLiveBroadcast(accessToken, *liveBroadcast.id, liveStreamId, kLiveBroadcastStatusMask);
+	logger->info("YouTubeLiveBroadcastBoundToLiveStream",
+		     {{"broadcastId", *liveBroadcast.id}, {"streamId", liveStreamId}});
+}
 
-		if (liveStreams.size() == 1 && liveStreams[0].status.has_value() &&
-		    liveStreams[0].status->streamStatus == "active") {
-			logger->info("YouTubeLiveStreamActive", {{"liveStreamId", nextLiveStream->id}});
-			break;
-		}
+// Waits for the live stream to become active and then takes the broadcast through testing to live.
+// Returns false when the live stream never became active; the broadcast is then left as is.
+// Must be called from a worker thread and returns on a worker thread
+Async::Task<bool> goLiveWhenStreamActive(Async::ThreadPoolExecutor &networkExecutor,
+					 std::shared_ptr<YouTubeApi::YouTubeApiClient> youTubeApiClient,
+					 const std::string &accessToken, Async::CancellationToken cancellationToken,
+					 std::shared_ptr<YouTubeApi::YouTubeLiveBroadcast> nextLiveBroadcast,
+					 std::shared_ptr<YouTubeApi::YouTubeLiveStream> nextLiveStream,
+					 std::shared_ptr<PhaseTimings> timings,
+					 std::shared_ptr<const Logger::ILogger> logger)
+{
+	logger->info("YouTubeLiveStreamWaitingForActive", {{"liveStreamId", nextLiveStream->id}});
 
-		if (maxAttempts <= 0) {
-			logger->error("YouTubeLiveStreamTimeout", {{"liveStreamId", nextLiveStream->id}});
-			co_return;
-		}
+	PhaseTimings::Span waitForActiveSpan(timings, SessionPhase::WaitForActive);
+	const std::array<std::string, 1> nextLiveStreamIdArray{nextLiveStream->id};
+	const bool liveStreamActive = co_await waitUntilReady(
+		networkExecutor, "YouTubeLiveStreamActive", kLiveStreamActivePolicy, cancellationToken,
+		[&]() {
+			logger->info("YouTubeLiveStreamCheckingIfActive", {{"liveStreamId", nextLiveStream->id}});
+			const std::vector<YouTubeApi::YouTubeLiveStream> liveStreams =
+				youTubeApiClient->listLiveStreams(accessToken, nextLiveStreamIdArray,
+								  kLiveStreamStatusMask);
+			return liveStreams.size() == 1 && liveStreams[0].status.has_value() &&
+			       liveStreams[0].status->streamStatus == "active";
+		},
+		logger);
+	waitForActiveSpan.stop();
+
+	if (!liveStreamActive) {
+		logger->error("YouTubeLiveStreamTimeout", {{"liveStreamId", nextLiveStream->id}});
+		co_return false;
 	}
+	logger->info("YouTubeLiveStreamActive", {{"liveStreamId", nextLiveStream->id}});
 
 	if (!nextLiveBroadcast->id) {
 		logger->error("YouTubeLiveBroadcastIdMissing");
 		throw std::runtime_error(
-			"YouTubeLiveBroadcastIdMissing(YouTubeStreamSegmenterMainLoop::startStreaming)");
+			"YouTubeLiveBroadcastIdMissing(YouTubeStreamSegmenterMainLoop::goLiveWhenStreamActive)");
 	}
 	const std::string nextLiveBroadcastTitle = (nextLiveBroadcast->snippet && nextLiveBroadcast->snippet->title)
 							   ? *nextLiveBroadcast->snippet->title
@@ -511,87 +1194,373 @@ Async::Task<void> startStreaming(std::shared_ptr<YouTubeApi::YouTubeApiClient> y
 	logger->info("YouTubeLiveBroadcastTransitioningToTesting",
 		     {{"broadcastId", *nextLiveBroadcast->id}, {"title", nextLiveBroadcastTitle}});
 
-	youTubeApiClient->transitionLiveBroadcast(accessToken, *nextLiveBroadcast->id, "testing");
+	PhaseTimings::Span testingSpan(timings, SessionPhase::Testing);
+	youTubeApiClient->transitionLiveBroadcast(accessToken, *nextLiveBroadcast->id, "testing",
+						  kLiveBroadcastStatusMask);
 
 	logger->info("YouTubeLiveBroadcastTransitionedToTesting",
 		     {{"broadcastId", *nextLiveBroadcast->id}, {"title", nextLiveBroadcastTitle}});
-	co_await AsyncQt::ResumeOnQTimerSingleShot{5000, parent};
-	co_await AsyncQt::ResumeOnQThreadPool{QThreadPool::globalInstance()};
+
+	// The testing transition completes asynchronously; going live before it settles is rejected.
+	const std::array<std::string, 1> nextLiveBroadcastIdArray{*nextLiveBroadcast->id};
+	const bool liveBroadcastTesting = co_await waitUntilReady(
+		networkExecutor, "YouTubeLiveBroadcastTesting", kLiveBroadcastTestingPolicy, cancellationToken,
+		[&]() {
+			const std::vector<YouTubeApi::YouTubeLiveBroadcast> liveBroadcasts =
+				youTubeApiClient->listLiveBroadcasts(accessToken, nextLiveBroadcastIdArray,
+								     kLiveBroadcastStatusMask);
+			return liveBroadcasts.size() == 1 && liveBroadcasts[0].status &&
+			       liveBroadcasts[0].status->lifeCycleStatus == "testing";
+		},
+		logger);
+	testingSpan.stop();
+
+	if (!liveBroadcastTesting) {
+		logger->warn("YouTubeLiveBroadcastTestingTimeout", {{"broadcastId", *nextLiveBroadcast->id}});
+	}
 
 	logger->info("YouTubeLiveBroadcastTransitioningToLive",
 		     {{"broadcastId", *nextLiveBroadcast->id}, {"title", nextLiveBroadcastTitle}});
 
-	youTubeApiClient->transitionLiveBroadcast(accessToken, *nextLiveBroadcast->id, "live");
+	PhaseTimings::Span liveSpan(timings, SessionPhase::Live);
+	youTubeApiClient->transitionLiveBroadcast(accessToken, *nextLiveBroadcast->id, "live",
+						  kLiveBroadcastStatusMask);
+	liveSpan.stop();
 
 	logger->info("YouTubeLiveBroadcastTransitionedToLive",
 		     {{"broadcastId", *nextLiveBroadcast->id}, {"title", nextLiveBroadcastTitle}});
+
+	co_return true;
+}
+
+// Longer than the keyframe interval YouTube accepts, so a keyframe is only missed when the encoder stalls.
+constexpr std::chrono::milliseconds kKeyframeWaitTimeout{5000};
+
+// The segment timer only arms the cut; it is made right after the outgoing output sends its next video
+// keyframe, so the outgoing broadcast ends on a whole GOP. Gives up after kKeyframeWaitTimeout and cuts anyway.
+// Must be called from a worker thread and returns on a worker thread
+Async::Task<void> waitForKeyframeBoundary(Async::ThreadPoolExecutor &networkExecutor,
+					  OverlappingStreamingOutputs &overlappingOutputs,
+					  std::size_t outgoingLiveStreamIndex,
+					  Async::CancellationToken cancellationToken,
+					  std::shared_ptr<PhaseTimings> timings,
+					  std::shared_ptr<const Logger::ILogger> logger)
+{
+	const ObsBridgeUtils::unique_obs_output_t output =
+		overlappingOutputs.getCarryingOutput(outgoingLiveStreamIndex);
+	if (!output || !obs_output_active(output.get())) {
+		co_return;
+	}
+
+	PhaseTimings::Span keyframeWaitSpan(timings, SessionPhase::KeyframeWait);
+	OutputKeyframeWaiter keyframeWaiter(output.get());
+	const bool reached = co_await keyframeWaiter.waitForNextKeyframe(kKeyframeWaitTimeout, cancellationToken);
+	co_await Async::ResumeOn{networkExecutor};
+	if (reached) {
+		logger->info("OBSStreamingKeyframeBoundaryReached");
+	} else {
+		logger->warn("OBSStreamingKeyframeBoundaryMissed",
+			     {{"timeoutMilliseconds", std::to_string(kKeyframeWaitTimeout.count())}});
+	}
+}
+
+// Throws when the live stream never becomes active, so the caller does not record the broadcast as live.
+// Must be called from a worker thread and returns on a worker thread
+// The live broadcast must already be bound to the live stream.
+Async::Task<void> startStreaming(Async::ThreadPoolExecutor &networkExecutor,
+				 std::shared_ptr<YouTubeApi::YouTubeApiClient> youTubeApiClient,
+				 const std::string &accessToken, Async::CancellationToken cancellationToken,
+				 std::shared_ptr<YouTubeApi::YouTubeLiveBroadcast> nextLiveBroadcast,
+				 std::shared_ptr<YouTubeApi::YouTubeLiveStream> nextLiveStream,
+				 std::shared_ptr<PhaseTimings> timings, std::shared_ptr<const Logger::ILogger> logger)
+{
+	logger->info("StreamingStarting");
+
+	cancellationToken.throwIfCancellationRequested();
+
+	PhaseTimings::Span obsStartSpan(timings, SessionPhase::OBSStart);
+
+	ObsBridgeUtils::unique_obs_service_t service = createYouTubeStreamingService(*nextLiveStream, logger);
+	obs_frontend_set_streaming_service(service.get());
+
+	obs_frontend_streaming_start();
+	obsStartSpan.stop();
+
+	logger->info("OBSStreamingStarted");
+
+	const bool live = co_await goLiveWhenStreamActive(networkExecutor, youTubeApiClient, accessToken,
+							  cancellationToken, nextLiveBroadcast, nextLiveStream, timings,
+							  logger);
+	if (!live) {
+		logger->error("StreamingStartFailed");
+		throw std::runtime_error("StreamingStartFailed(YouTubeStreamSegmenterMainLoop::startStreaming)");
+	}
+}
+
+// Starts the incoming output next to the outgoing one and stops the outgoing one only after the incoming
+// broadcast is live. If the incoming live stream never becomes active, the incoming output is stopped
+// and the outgoing one is kept. The same happens when cancelled while waiting for the handover.
+// Must be called from a worker thread and returns on a worker thread
+// The live broadcast must already be bound to the live stream.
+Async::Task<void> startStreamingOverlapped(Async::ThreadPoolExecutor &networkExecutor,
+					   std::shared_ptr<YouTubeApi::YouTubeApiClient> youTubeApiClient,
+					   const std::string &accessToken, Async::CancellationToken cancellationToken,
+					   std::shared_ptr<OverlappingStreamingOutputs> overlappingOutputs,
+					   std::size_t outgoingLiveStreamIndex, std::size_t incomingLiveStreamIndex,
+					   std::shared_ptr<YouTubeApi::YouTubeLiveBroadcast> nextLiveBroadcast,
+					   std::shared_ptr<YouTubeApi::YouTubeLiveStream> nextLiveStream,
+					   std::shared_ptr<PhaseTimings> timings,
+					   std::shared_ptr<const Logger::ILogger> logger)
+{
+	logger->info("StreamingStartingOverlapped");
+
+	cancellationToken.throwIfCancellationRequested();
+
+	PhaseTimings::Span obsStartSpan(timings, SessionPhase::OBSStart);
+	overlappingOutputs->start(incomingLiveStreamIndex, outgoingLiveStreamIndex, *nextLiveStream, logger);
+	obsStartSpan.stop();
+
+	bool live = false;
+	try {
+		live = co_await goLiveWhenStreamActive(networkExecutor, youTubeApiClient, accessToken,
+						       cancellationToken, nextLiveBroadcast, nextLiveStream, timings,
+						       logger);
+	} catch (...) {
+		overlappingOutputs->stop(incomingLiveStreamIndex, logger);
+		throw;
+	}
+	if (!live) {
+		overlappingOutputs->stop(incomingLiveStreamIndex, logger);
+		logger->error("StreamingOverlappedHandoverFailed");
+		throw std::runtime_error(
+			"StreamingOverlappedHandoverFailed(YouTubeStreamSegmenterMainLoop::startStreamingOverlapped)");
+	}
+
+	// --- Break the outgoing output only now that the incoming broadcast is live ---
+	co_await waitForKeyframeBoundary(networkExecutor, *overlappingOutputs, outgoingLiveStreamIndex,
+					 cancellationToken, timings, logger);
+	PhaseTimings::Span obsStopSpan(timings, SessionPhase::OBSStop);
+	if (!overlappingOutputs->stop(outgoingLiveStreamIndex, logger)) {
+		co_await ensureOBSStreamingStopped(logger);
+	}
+	obsStopSpan.stop();
+
+	logger->info("StreamingStartedOverlapped");
+}
+
+// Restarts the frontend output on the live stream it streams to, so that the ingest gets a new connection.
+// The streaming service set at the last cutover stays in place.
+// Must be called from a worker thread and returns on a worker thread
+Async::Task<void> restartOBSStreaming(Async::ThreadPoolExecutor &networkExecutor,
+				      Async::CancellationToken cancellationToken,
+				      std::shared_ptr<const Logger::ILogger> logger)
+{
+	logger->info("OBSStreamingRestarting");
+
+	co_await ensureOBSStreamingStopped(logger);
+	cancellationToken.throwIfCancellationRequested();
+	obs_frontend_streaming_start();
+	co_await Async::ResumeOn{networkExecutor};
+
+	logger->info("OBSStreamingRestarted");
+}
+
+enum class LiveStreamHealthAction {
+	None,
+	Segment,
+	Reconnect,
+};
+
+nlohmann::json makeLiveStreamHealthEventObject(const LiveStreamHealthSnapshot &health)
+{
+	const YouTubeApi::YouTubeLiveStream::Status &status = *health.status;
+	nlohmann::json configurationIssues = nlohmann::json::array();
+	for (const auto &issue : status.healthStatus.configurationIssues) {
+		configurationIssues.push_back({{"type", issue.type},
+					       {"severity", issue.severity},
+					       {"reason", issue.reason},
+					       {"description", issue.description}});
+	}
+
+	nlohmann::json healthStatus{{"status", status.healthStatus.status},
+				    {"configurationIssues", std::move(configurationIssues)}};
+	if (status.healthStatus.lastUpdateTimeSeconds) {
+		healthStatus["lastUpdateTimeSeconds"] = *status.healthStatus.lastUpdateTimeSeconds;
+	}
+
+	return nlohmann::json{
+		{"LiveStream",
+		 {{"id", health.liveStreamId},
+		  {"status", {{"streamStatus", status.streamStatus}, {"healthStatus", std::move(healthStatus)}}}}},
+		{"healthy", isLiveStreamHealthy(status)},
+	};
+}
+
+LiveStreamHealthAction parseLiveStreamHealthAction(const nlohmann::json &jResult,
+						   std::shared_ptr<const Logger::ILogger> logger)
+{
+	if (!jResult.is_object() || !jResult.contains("action")) {
+		return LiveStreamHealthAction::None;
+	}
+
+	const std::string action = jResult.at("action").get<std::string>();
+	if (action == "segment") {
+		return LiveStreamHealthAction::Segment;
+	} else if (action == "reconnect") {
+		return LiveStreamHealthAction::Reconnect;
+	} else if (action != "none") {
+		logger->warn("LiveStreamHealthActionUnknown", {{"action", action}});
+	}
+	return LiveStreamHealthAction::None;
 }
 
 } // anonymous namespace
 
 Async::Task<std::array<YouTubeApi::YouTubeLiveBroadcast, 2>> YouTubeStreamSegmenterMainLoop::startContinuousSessionTask(
-	std::shared_ptr<CurlHelper::CurlHandle> curl, std::shared_ptr<YouTubeApi::YouTubeApiClient> youTubeApiClient,
-	std::shared_ptr<Scripting::ScriptingRuntime> runtime, std::shared_ptr<Store::AuthStore> authStore,
-	std::shared_ptr<Store::EventHandlerStore> eventHandlerStore, std::shared_ptr<Store::YouTubeStore> youtubeStore,
-	std::size_t currentLiveStreamIndex, QObject *parent, std::shared_ptr<const Logger::ILogger> baseLogger)
+	std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool, std::shared_ptr<PluginExecutors> executors,
+	std::shared_ptr<YouTubeApi::YouTubeRequestScheduler> requestScheduler,
+	std::shared_ptr<PersistentScriptingContext> scriptingContext,
+	std::shared_ptr<Store::GoogleAccessTokenProvider> tokenProvider,
+	std::shared_ptr<Store::LiveStreamCache> liveStreamCache,
+	std::shared_ptr<OverlappingStreamingOutputs> overlappingOutputs,
+	std::shared_ptr<ProgramThumbnailCapture> thumbnailCapture,
+	std::shared_ptr<Store::SessionJournal> sessionJournal, std::shared_ptr<LiveBroadcastIndex> liveBroadcastIndex,
+	std::vector<std::string> liveStreamIds, std::size_t currentLiveStreamIndex, [[maybe_unused]] QObject *parent,
+	Async::CancellationToken cancellationToken, std::shared_ptr<PhaseTimings> timings,
+	std::shared_ptr<const Logger::ILogger> baseLogger)
 {
 	// on the main thread
-	const std::shared_ptr<const Logger::ILogger> logger = std::make_shared<TaskBoundLogger>(
-		baseLogger, "YouTubeStreamSegmenterMainLoop::startContinuousSessionTask");
+	const std::shared_ptr<const Logger::ILogger> logger = Logger::ContextLogger::create(
+		baseLogger, {{"taskName", "YouTubeStreamSegmenterMainLoop::startContinuousSessionTask"}});
+	Async::ThreadPoolExecutor &networkExecutor = executors->getNetwork();
+	const std::shared_ptr<YouTubeApi::YouTubeApiClient> youTubeApiClient =
+		makeYouTubeApiClient(curlPool, requestScheduler, YouTubeApi::YouTubeRequestPriority::Cutover, logger,
+				     cancellationToken);
+
+	cancellationToken.throwIfCancellationRequested();
 
 	logger->info("ContinuousYouTubeSessionStarting");
 
 	logger->info("OBSStreamingEnsuringStopped");
 
+	PhaseTimings::Span obsStopSpan(timings, SessionPhase::OBSStop);
+	overlappingOutputs->stopAll(logger);
 	co_await ensureOBSStreamingStopped(logger);
+	obsStopSpan.stop();
 
 	logger->info("OBSStreamingEnsuredStopped");
 
-	co_await AsyncQt::ResumeOnQThreadPool{QThreadPool::globalInstance()};
+	co_await Async::ResumeOn{networkExecutor};
 	// on a worker thread
 
 	// --- Scripting ---
-	std::shared_ptr<JSContext> ctx = runtime->createContextRaw();
-	std::shared_ptr<Scripting::EventScriptingContext> context =
-		std::make_shared<Scripting::EventScriptingContext>(runtime, ctx, logger);
-	Scripting::ScriptingDatabase database(runtime, ctx, logger, eventHandlerStore->getEventHandlerDatabasePath(),
-					      true);
-	context->setupContext();
-	database.setupContext();
-	context->setupLocalStorage();
-
-	const std::string scriptContent = eventHandlerStore->getEventHandlerScript();
-	context->loadEventHandler(scriptContent.c_str());
+	std::shared_ptr<Scripting::EventScriptingContext> context = co_await scriptingContext->acquireTask();
+	co_await Async::ResumeOn{networkExecutor};
 
 	// --- YouTube access token ---
-	const std::string accessToken = getAccessToken(curl, authStore, logger);
+	PhaseTimings::Span tokenFetchSpan(timings, SessionPhase::TokenFetch);
+	if (!tokenProvider->isReady()) {
+		// Only right after the profile loaded, while the keychain read is still in flight.
+		logger->info("GoogleAuthWaitingForKeychain");
+		co_await tokenProvider->waitUntilReady();
+		co_await Async::ResumeOn{networkExecutor};
+	}
+	const std::string accessToken = getAccessToken(tokenProvider, logger);
+	tokenFetchSpan.stop();
 
 	// --- Complete active broadcasts ---
 	logger->info("YouTubeLiveBroadcastCompletingActive");
 
-	const std::string currentLiveStreamId = youtubeStore->getLiveStreamId(currentLiveStreamIndex);
-	const std::string nextLiveStreamId = youtubeStore->getLiveStreamId(1 - currentLiveStreamIndex);
-	if (currentLiveStreamId.empty() || nextLiveStreamId.empty()) {
+	if (liveStreamIds.size() < Store::YouTubeStore::kMinLiveStreams ||
+	    liveStreamIds.size() > Store::YouTubeStore::kMaxLiveStreams) {
+		logger->error("YouTubeLiveStreamCountOutOfRange", {{"count", std::to_string(liveStreamIds.size())}});
+		throw std::runtime_error(
+			"YouTubeLiveStreamCountOutOfRange(YouTubeStreamSegmenterMainLoop::startContinuousSessionTask)");
+	}
+	if (std::ranges::any_of(liveStreamIds, [](const std::string &id) { return id.empty(); })) {
 		logger->error("YouTubeLiveStreamIdNotSet");
 		throw std::runtime_error(
 			"YouTubeLiveStreamIdNotSet(YouTubeStreamSegmenterMainLoop::startContinuousSessionTask)");
 	}
 
-	const std::array<std::string, 2> liveStreamIds{
-		currentLiveStreamId,
-		nextLiveStreamId,
-	};
+	// Every live stream of the ring is swept, not only the two that take the first turns.
+	const std::string currentLiveStreamId = liveStreamIds.at(currentLiveStreamIndex);
 
-	completeActiveLiveBroadcasts(youTubeApiClient, accessToken, liveStreamIds, logger);
+	// --- Evaluate the scripts in order; they may depend on local storage written by each other ---
+	PhaseTimings::Span insertingScriptSpan(timings, SessionPhase::ScriptCall);
 
-	logger->info("YouTubeLiveBroadcastCompletedActive");
-
-	// --- Create an initial live broadcast ---
 	logger->info("YouTubeLiveBroadcastCreatingInitial");
+	const YouTubeApi::InsertingYouTubeLiveBroadcast initialInsertingLiveBroadcast =
+		co_await evaluateInsertingLiveBroadcastTask(networkExecutor, context,
+							    "onCreateYouTubeLiveBroadcastInitial", logger);
+
+	logger->info("YouTubeLiveBroadcastCreatingNext");
+	const YouTubeApi::InsertingYouTubeLiveBroadcast nextInsertingLiveBroadcast =
+		co_await evaluateInsertingLiveBroadcastTask(networkExecutor, context,
+							    "onCreateYouTubeLiveBroadcastInitialNext", logger);
+
+	insertingScriptSpan.stop();
+
+	// --- Complete active broadcasts, insert both broadcasts and get the current live stream concurrently ---
+	logger->info("YouTubeLiveStreamGettingCurrent", {{"liveStreamId", currentLiveStreamId}});
 
-	auto initialLiveBroadcast = std::make_shared<YouTubeApi::YouTubeLiveBroadcast>(
-		createLiveBroadcast(youTubeApiClient, accessToken, context, "onCreateYouTubeLiveBroadcastInitial",
-				    "onSetYouTubeThumbnailInitial", logger));
+	[[maybe_unused]] auto [completed, initialInsertedLiveBroadcast, nextInsertedLiveBroadcast,
+			       currentLiveStreamValue] =
+		co_await Async::whenAll(
+			runOnExecutor(networkExecutor,
+				[youTubeApiClient, accessToken, liveStreamIds, liveBroadcastIndex, logger]() {
+					completeLiveBroadcasts(youTubeApiClient, accessToken, liveStreamIds,
+							       *liveBroadcastIndex, logger);
+				}),
+			runOnExecutor(networkExecutor,
+				[youTubeApiClient, accessToken, initialInsertingLiveBroadcast, timings, logger]() {
+					PhaseTimings::Span insertSpan(timings, SessionPhase::Insert);
+					return insertLiveBroadcast(youTubeApiClient, accessToken,
+								   initialInsertingLiveBroadcast, logger);
+				}),
+			runOnExecutor(networkExecutor,
+				[youTubeApiClient, accessToken, nextInsertingLiveBroadcast, timings, logger]() {
+					PhaseTimings::Span insertSpan(timings, SessionPhase::Insert);
+					return insertLiveBroadcast(youTubeApiClient, accessToken,
+								   nextInsertingLiveBroadcast, logger);
+				}),
+			runOnExecutor(networkExecutor,
+				[youTubeApiClient, accessToken, liveStreamCache, currentLiveStreamId, logger]() {
+					return getLiveStream(youTubeApiClient, accessToken, *liveStreamCache,
+							     currentLiveStreamId, logger);
+				}));
+	// on a worker thread
+
+	logger->info("YouTubeLiveBroadcastCompletedActive");
+	logger->info("YouTubeLiveStreamGottenCurrent", {{"liveStreamId", currentLiveStreamId}});
+
+	// The previous session is finished; from here on the journal only covers this one.
+	sessionJournal->reset();
+
+	// --- Thumbnails: scripts in order, uploads concurrently ---
+	PhaseTimings::Span thumbnailScriptSpan(timings, SessionPhase::ScriptCall);
+	const std::optional<LiveBroadcastThumbnail> initialThumbnail = co_await evaluateThumbnailTask(
+		networkExecutor, context, "onSetYouTubeThumbnailInitial", initialInsertedLiveBroadcast, logger);
+	const std::optional<LiveBroadcastThumbnail> nextThumbnail = co_await evaluateThumbnailTask(
+		networkExecutor, context, "onSetYouTubeThumbnailInitialNext", nextInsertedLiveBroadcast, logger);
+	thumbnailScriptSpan.stop();
+
+	co_await Async::whenAll(
+		runOnExecutor(networkExecutor,
+			[youTubeApiClient, thumbnailCapture, accessToken, initialThumbnail, timings, logger]() {
+				PhaseTimings::Span thumbnailSpan(timings, SessionPhase::Thumbnail);
+				setLiveBroadcastThumbnail(youTubeApiClient, thumbnailCapture, accessToken,
+							  initialThumbnail, logger);
+			}),
+		runOnExecutor(networkExecutor,
+			[youTubeApiClient, thumbnailCapture, accessToken, nextThumbnail, timings, logger]() {
+				PhaseTimings::Span thumbnailSpan(timings, SessionPhase::Thumbnail);
+				setLiveBroadcastThumbnail(youTubeApiClient, thumbnailCapture, accessToken,
+							  nextThumbnail, logger);
+			}));
+
+	auto initialLiveBroadcast =
+		std::make_shared<YouTubeApi::YouTubeLiveBroadcast>(std::move(initialInsertedLiveBroadcast));
 
 	const std::string initialLiveBroadcastId = initialLiveBroadcast->id.value_or("(ID MISSING)");
 	const std::string initialLiveBroadcastTitle =
@@ -601,12 +1570,7 @@ Async::Task<std::array<YouTubeApi::YouTubeLiveBroadcast, 2>> YouTubeStreamSegmen
 	logger->info("YouTubeLiveBroadcastCreatedInitial",
 		     {{"broadcastId", initialLiveBroadcastId}, {"title", initialLiveBroadcastTitle}});
 
-	// --- Create the next live broadcast ---
-	logger->info("YouTubeLiveBroadcastCreatingNext");
-
-	const YouTubeApi::YouTubeLiveBroadcast nextLiveBroadcast =
-		createLiveBroadcast(youTubeApiClient, accessToken, context, "onCreateYouTubeLiveBroadcastInitialNext",
-				    "onSetYouTubeThumbnailInitialNext", logger);
+	const YouTubeApi::YouTubeLiveBroadcast nextLiveBroadcast = std::move(nextInsertedLiveBroadcast);
 
 	const std::string nextLiveBroadcastId = nextLiveBroadcast.id.value_or("(ID MISSING)");
 	const std::string nextLiveBroadcastTitle = (nextLiveBroadcast.snippet && nextLiveBroadcast.snippet->title)
@@ -616,27 +1580,27 @@ Async::Task<std::array<YouTubeApi::YouTubeLiveBroadcast, 2>> YouTubeStreamSegmen
 	logger->info("YouTubeLiveBroadcastCreatedNext",
 		     {{"broadcastId", nextLiveBroadcastId}, {"title", nextLiveBroadcastTitle}});
 
-	// --- Get the next live stream ---
-	logger->info("YouTubeLiveStreamGettingCurrent", {{"liveStreamId", currentLiveStreamId}});
-
-	const std::array<std::string, 1> currentLiveStreamIdArray{currentLiveStreamId};
-	std::vector<YouTubeApi::YouTubeLiveStream> liveStreams =
-		youTubeApiClient->listLiveStreams(accessToken, currentLiveStreamIdArray);
-	if (liveStreams.empty()) {
-		logger->error("YouTubeLiveStreamNotFound", {{"liveStreamId", currentLiveStreamId}});
-		throw std::runtime_error(
-			"YouTubeLiveStreamNotFound(YouTubeStreamSegmenterMainLoop::startContinuousSessionTask)");
-	} else if (liveStreams.size() > 1) {
-		logger->warn("YouTubeLiveStreamMultipleFound", {{"liveStreamId", currentLiveStreamId}});
-	}
-	auto currentLiveStream = std::make_shared<YouTubeApi::YouTubeLiveStream>(liveStreams[0]);
+	auto currentLiveStream = std::make_shared<YouTubeApi::YouTubeLiveStream>(std::move(currentLiveStreamValue));
 
-	logger->info("YouTubeLiveStreamGottenCurrent", {{"liveStreamId", currentLiveStreamId}});
+	PhaseTimings::Span bindSpan(timings, SessionPhase::Bind);
+	bindLiveBroadcast(youTubeApiClient, accessToken, *initialLiveBroadcast, currentLiveStream->id, logger);
+	bindSpan.stop();
 
 	// --- Start streaming the initial live broadcast ---
 	logger->info("StreamingStarting");
 
-	co_await startStreaming(youTubeApiClient, accessToken, parent, initialLiveBroadcast, currentLiveStream, logger);
+	const std::array<std::string, 1> currentLiveStreamIdArray{currentLiveStreamId};
+	try {
+		co_await startStreaming(networkExecutor, youTubeApiClient, accessToken, cancellationToken,
+					initialLiveBroadcast, currentLiveStream, timings, logger);
+	} catch (...) {
+		// The broadcast may or may not have gone live.
+		liveBroadcastIndex->forget(currentLiveStreamIdArray);
+		throw;
+	}
+	if (initialLiveBroadcast->id) {
+		liveBroadcastIndex->setLive(currentLiveStreamId, *initialLiveBroadcast->id);
+	}
 
 	logger->info("StreamingStarted");
 
@@ -647,42 +1611,48 @@ Async::Task<std::array<YouTubeApi::YouTubeLiveBroadcast, 2>> YouTubeStreamSegmen
 }
 
 Async::Task<void> YouTubeStreamSegmenterMainLoop::stopContinuousSessionTask(
-	[[maybe_unused]] Async::Channel<Message> &channel, std::shared_ptr<CurlHelper::CurlHandle> curl,
-	std::shared_ptr<YouTubeApi::YouTubeApiClient> youTubeApiClient, std::shared_ptr<Store::AuthStore> authStore,
-	std::shared_ptr<Store::YouTubeStore> youtubeStore, std::shared_ptr<const Logger::ILogger> baseLogger)
+	[[maybe_unused]] Async::Channel<Message> &channel, std::shared_ptr<PluginExecutors> executors,
+	std::shared_ptr<YouTubeApi::YouTubeApiClient> youTubeApiClient,
+	std::shared_ptr<Store::GoogleAccessTokenProvider> tokenProvider,
+	std::shared_ptr<OverlappingStreamingOutputs> overlappingOutputs,
+	std::shared_ptr<LiveBroadcastIndex> liveBroadcastIndex, std::vector<std::string> liveStreamIds,
+	std::shared_ptr<PhaseTimings> timings, std::shared_ptr<const Logger::ILogger> baseLogger)
 {
 	// on the main thread
-	const std::shared_ptr<const Logger::ILogger> logger = std::make_shared<TaskBoundLogger>(
-		baseLogger, "YouTubeStreamSegmenterMainLoop::StopContinuousYouTubeSessionTask");
+	const std::shared_ptr<const Logger::ILogger> logger = Logger::ContextLogger::create(
+		baseLogger, {{"taskName", "YouTubeStreamSegmenterMainLoop::StopContinuousYouTubeSessionTask"}});
+	Async::ThreadPoolExecutor &networkExecutor = executors->getNetwork();
 
 	logger->info("ContinuousYouTubeSessionStopping");
 
 	logger->info("OBSStreamingEnsuringStopped");
 
+	PhaseTimings::Span obsStopSpan(timings, SessionPhase::OBSStop);
+	overlappingOutputs->stopAll(logger);
 	co_await ensureOBSStreamingStopped(logger);
+	obsStopSpan.stop();
 
 	logger->info("OBSStreamingEnsuredStopped");
 
-	co_await AsyncQt::ResumeOnQThreadPool{QThreadPool::globalInstance()};
+	co_await Async::ResumeOn{networkExecutor};
 	// on a worker thread
 
 	// --- YouTube access token ---
-	const std::string accessToken = getAccessToken(curl, authStore, logger);
+	PhaseTimings::Span tokenFetchSpan(timings, SessionPhase::TokenFetch);
+	const std::string accessToken = getAccessToken(tokenProvider, logger);
+	tokenFetchSpan.stop();
 
 	// --- Complete active broadcasts ---
 	logger->info("YouTubeLiveBroadcastCompletingActive");
 
-	const std::array<std::string, 2> liveStreamIds{
-		youtubeStore->getLiveStreamId(0),
-		youtubeStore->getLiveStreamId(1),
-	};
-	if (liveStreamIds[0].empty() || liveStreamIds[1].empty()) {
+	if (liveStreamIds.empty() ||
+	    std::ranges::any_of(liveStreamIds, [](const std::string &id) { return id.empty(); })) {
 		logger->error("YouTubeLiveStreamIdNotSet");
 		throw std::runtime_error(
 			"YouTubeLiveStreamIdNotSet(YouTubeStreamSegmenterMainLoop::stopContinuousSessionTask)");
 	}
 
-	completeActiveLiveBroadcasts(youTubeApiClient, accessToken, liveStreamIds, logger);
+	completeLiveBroadcasts(youTubeApiClient, accessToken, liveStreamIds, *liveBroadcastIndex, logger);
 
 	logger->info("YouTubeLiveBroadcastCompletedActive");
 
@@ -690,105 +1660,199 @@ Async::Task<void> YouTubeStreamSegmenterMainLoop::stopContinuousSessionTask(
 	logger->info("ContinuousYouTubeSessionStopped");
 }
 
-Async::Task<std::array<YouTubeApi::YouTubeLiveBroadcast, 2>>
-YouTubeStreamSegmenterMainLoop::segmentContinuousSessionTask(
-	std::shared_ptr<CurlHelper::CurlHandle> curl, std::shared_ptr<YouTubeApi::YouTubeApiClient> youTubeApiClient,
-	std::shared_ptr<Scripting::ScriptingRuntime> runtime, std::shared_ptr<Store::AuthStore> authStore,
-	std::shared_ptr<Store::EventHandlerStore> eventHandlerStore, std::shared_ptr<Store::YouTubeStore> youtubeStore,
-	std::size_t currentLiveStreamIndex, YouTubeApi::YouTubeLiveBroadcast incomingLiveBroadcast,
-	[[maybe_unused]] QObject *parent, std::shared_ptr<const Logger::ILogger> baseLogger)
+Async::Task<YouTubeStreamSegmenterMainLoop::PreparedSegment>
+YouTubeStreamSegmenterMainLoop::prepareContinuousSessionSegmentTask(
+	std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool, std::shared_ptr<PluginExecutors> executors,
+	std::shared_ptr<YouTubeApi::YouTubeRequestScheduler> requestScheduler,
+	YouTubeApi::YouTubeRequestPriority requestPriority,
+	std::shared_ptr<PersistentScriptingContext> scriptingContext,
+	std::shared_ptr<Store::GoogleAccessTokenProvider> tokenProvider,
+	std::shared_ptr<Store::LiveStreamCache> liveStreamCache,
+	std::shared_ptr<ProgramThumbnailCapture> thumbnailCapture, std::size_t currentLiveStreamIndex,
+	std::string incomingLiveStreamId, YouTubeApi::YouTubeLiveBroadcast incomingLiveBroadcast,
+	Async::CancellationToken cancellationToken,
+	std::shared_ptr<PhaseTimings> timings, std::shared_ptr<const Logger::ILogger> baseLogger)
 {
-	const std::shared_ptr<const Logger::ILogger> logger = std::make_shared<TaskBoundLogger>(
-		baseLogger, "YouTubeStreamSegmenterMainLoop::segmentContinuousSessionTask");
+	const std::shared_ptr<const Logger::ILogger> logger = Logger::ContextLogger::create(
+		baseLogger, {{"taskName", "YouTubeStreamSegmenterMainLoop::prepareContinuousSessionSegmentTask"}});
+	Async::ThreadPoolExecutor &networkExecutor = executors->getNetwork();
+	const std::shared_ptr<YouTubeApi::YouTubeApiClient> youTubeApiClient =
+		makeYouTubeApiClient(curlPool, requestScheduler, requestPriority, logger, cancellationToken);
 
-	logger->info("ContinuousYouTubeSessionSegmenting");
+	cancellationToken.throwIfCancellationRequested();
 
-	co_await AsyncQt::ResumeOnQThreadPool{QThreadPool::globalInstance()};
+	logger->info("ContinuousYouTubeSessionSegmentPreparing");
+
+	co_await Async::ResumeOn{networkExecutor};
 	// on a worker thread
 
-	const std::string currentLiveStreamId = youtubeStore->getLiveStreamId(currentLiveStreamIndex);
-	const std::string incomingLiveStreamId = youtubeStore->getLiveStreamId(1 - currentLiveStreamIndex);
-	if (currentLiveStreamId.empty() || incomingLiveStreamId.empty()) {
+	if (incomingLiveStreamId.empty()) {
 		logger->error("YouTubeLiveStreamIdNotSet");
 		throw std::runtime_error(
-			"YouTubeLiveStreamIdNotSet(YouTubeStreamSegmenterMainLoop::segmentContinuousSessionTask)");
+			"YouTubeLiveStreamIdNotSet(YouTubeStreamSegmenterMainLoop::prepareContinuousSessionSegmentTask)");
 	}
 
 	// --- Scripting ---
-	std::shared_ptr<JSContext> ctx = runtime->createContextRaw();
-	std::shared_ptr<Scripting::EventScriptingContext> context =
-		std::make_shared<Scripting::EventScriptingContext>(runtime, ctx, logger);
-	Scripting::ScriptingDatabase database(runtime, ctx, logger, eventHandlerStore->getEventHandlerDatabasePath(),
-					      true);
-	context->setupContext();
-	database.setupContext();
-	context->setupLocalStorage();
-
-	const std::string scriptContent = eventHandlerStore->getEventHandlerScript();
-	context->loadEventHandler(scriptContent.c_str());
+	std::shared_ptr<Scripting::EventScriptingContext> context = co_await scriptingContext->acquireTask();
+	co_await Async::ResumeOn{networkExecutor};
 
 	// --- YouTube access token ---
-	const std::string accessToken = getAccessToken(curl, authStore, logger);
+	PhaseTimings::Span tokenFetchSpan(timings, SessionPhase::TokenFetch);
+	const std::string accessToken = getAccessToken(tokenProvider, logger);
+	tokenFetchSpan.stop();
 
-	// --- Create the next live broadcast ---
-	logger->info("YouTubeLiveBroadcastCreatingNext");
+	// --- Get the incoming live stream, bind the incoming live broadcast while the incoming live stream is
+	// idle, and create the live broadcast after the incoming one, all concurrently ---
+	logger->info("YouTubeLiveStreamGettingIncoming", {{"liveStreamId", incomingLiveStreamId}});
+	logger->info("YouTubeLiveBroadcastPreparingNext");
+
+	// Only the last branch touches the scripting context, so it is never entered concurrently.
+	[[maybe_unused]] auto [incomingLiveStream, bound, nextLiveBroadcast] = co_await Async::whenAll(
+		runOnExecutor(networkExecutor,
+			[youTubeApiClient, accessToken, liveStreamCache, incomingLiveStreamId, logger]() {
+				return getLiveStream(youTubeApiClient, accessToken, *liveStreamCache,
+						     incomingLiveStreamId, logger);
+			}),
+		runOnExecutor(networkExecutor,
+			[youTubeApiClient, accessToken, incomingLiveBroadcast, incomingLiveStreamId, timings,
+			 logger]() {
+				PhaseTimings::Span bindSpan(timings, SessionPhase::Bind);
+				bindLiveBroadcast(youTubeApiClient, accessToken, incomingLiveBroadcast,
+						  incomingLiveStreamId, logger);
+			}),
+		createLiveBroadcastTask(networkExecutor, youTubeApiClient, thumbnailCapture, accessToken, context,
+					"onCreateYouTubeLiveBroadcastNext", "onSetYouTubeThumbnailNext", timings,
+					logger));
+	// on a worker thread
 
-	const YouTubeApi::YouTubeLiveBroadcast nextLiveBroadcast =
-		createLiveBroadcast(youTubeApiClient, accessToken, context, "onCreateYouTubeLiveBroadcastNext",
-				    "onSetYouTubeThumbnailNext", logger);
+	logger->info("YouTubeLiveStreamGottenIncoming", {{"liveStreamId", incomingLiveStream.id}});
 
 	const std::string nextLiveBroadcastId = nextLiveBroadcast.id.value_or("(ID MISSING)");
 	const std::string nextLiveBroadcastTitle = (nextLiveBroadcast.snippet && nextLiveBroadcast.snippet->title)
 							   ? *nextLiveBroadcast.snippet->title
 							   : "(TITLE MISSING)";
 
-	logger->info("YouTubeLiveBroadcastCreatedNext",
+	logger->info("YouTubeLiveBroadcastPreparedNext",
 		     {{"broadcastId", nextLiveBroadcastId}, {"title", nextLiveBroadcastTitle}});
 
-	// --- Get the incoming live stream ---
-	logger->info("YouTubeLiveStreamGettingIncoming", {{"liveStreamId", incomingLiveStreamId}});
+	logger->info("ContinuousYouTubeSessionSegmentPrepared");
 
-	const std::array<std::string, 1> incomingLiveStreamIdArray{incomingLiveStreamId};
-	const std::vector<YouTubeApi::YouTubeLiveStream> liveStreams =
-		youTubeApiClient->listLiveStreams(accessToken, incomingLiveStreamIdArray);
-	if (liveStreams.empty()) {
-		logger->error("YouTubeLiveStreamNotFound", {{"liveStreamId", incomingLiveStreamId}});
+	co_return PreparedSegment{
+		.currentLiveStreamIndex = currentLiveStreamIndex,
+		.incomingLiveBroadcast = std::move(incomingLiveBroadcast),
+		.incomingLiveStream = std::move(incomingLiveStream),
+		.nextLiveBroadcast = std::move(nextLiveBroadcast),
+	};
+}
+
+Async::Task<std::array<YouTubeApi::YouTubeLiveBroadcast, 2>>
+YouTubeStreamSegmenterMainLoop::segmentContinuousSessionTask(
+	std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool, std::shared_ptr<PluginExecutors> executors,
+	std::shared_ptr<YouTubeApi::YouTubeRequestScheduler> requestScheduler,
+	std::shared_ptr<PersistentScriptingContext> scriptingContext,
+	std::shared_ptr<Store::GoogleAccessTokenProvider> tokenProvider,
+	std::shared_ptr<Store::LiveStreamCache> liveStreamCache,
+	std::shared_ptr<OverlappingStreamingOutputs> overlappingOutputs,
+	std::shared_ptr<ProgramThumbnailCapture> thumbnailCapture,
+	std::shared_ptr<Store::SessionJournal> sessionJournal, std::shared_ptr<LiveBroadcastIndex> liveBroadcastIndex,
+	std::size_t currentLiveStreamIndex, std::size_t incomingLiveStreamIndex, std::string incomingLiveStreamId,
+	YouTubeApi::YouTubeLiveBroadcast incomingLiveBroadcast, std::optional<PreparedSegment> preparedSegment,
+	Store::SessionJournalRecord cutoverRecord, [[maybe_unused]] QObject *parent,
+	Async::CancellationToken cancellationToken, std::shared_ptr<PhaseTimings> timings,
+	std::shared_ptr<const Logger::ILogger> baseLogger)
+{
+	const std::shared_ptr<const Logger::ILogger> logger = Logger::ContextLogger::create(
+		baseLogger, {{"taskName", "YouTubeStreamSegmenterMainLoop::segmentContinuousSessionTask"}});
+	Async::ThreadPoolExecutor &networkExecutor = executors->getNetwork();
+	const std::shared_ptr<YouTubeApi::YouTubeApiClient> youTubeApiClient =
+		makeYouTubeApiClient(curlPool, requestScheduler, YouTubeApi::YouTubeRequestPriority::Cutover, logger,
+				     cancellationToken);
+
+	cancellationToken.throwIfCancellationRequested();
+
+	logger->info("ContinuousYouTubeSessionSegmenting");
+
+	co_await Async::ResumeOn{networkExecutor};
+	// on a worker thread
+
+	if (incomingLiveStreamId.empty()) {
+		logger->error("YouTubeLiveStreamIdNotSet");
 		throw std::runtime_error(
-			"YouTubeLiveStreamNotFound(YouTubeStreamSegmenterMainLoop::segmentContinuousSessionTask)");
-	} else if (liveStreams.size() > 1) {
-		logger->warn("YouTubeLiveStreamMultipleFound", {{"liveStreamId", incomingLiveStreamId}});
+			"YouTubeLiveStreamIdNotSet(YouTubeStreamSegmenterMainLoop::segmentContinuousSessionTask)");
+	}
+
+	// --- Use the prepared segment or prepare it now ---
+	if (preparedSegment && (preparedSegment->currentLiveStreamIndex != currentLiveStreamIndex ||
+				preparedSegment->incomingLiveBroadcast.id != incomingLiveBroadcast.id ||
+				preparedSegment->incomingLiveStream.id != incomingLiveStreamId)) {
+		logger->warn("ContinuousYouTubeSessionSegmentPreparedStale");
+		preparedSegment.reset();
 	}
-	const auto incomingLiveStream = std::make_shared<YouTubeApi::YouTubeLiveStream>(liveStreams[0]);
 
-	logger->info("YouTubeLiveStreamGottenIncoming", {{"liveStreamId", incomingLiveStream->id}});
+	if (preparedSegment) {
+		logger->info("ContinuousYouTubeSessionSegmentPreparedUsed");
+	} else {
+		logger->info("ContinuousYouTubeSessionSegmentPreparingInline");
+		preparedSegment = co_await prepareContinuousSessionSegmentTask(
+			curlPool, executors, requestScheduler, YouTubeApi::YouTubeRequestPriority::Cutover,
+			scriptingContext, tokenProvider, liveStreamCache, thumbnailCapture, currentLiveStreamIndex,
+			incomingLiveStreamId, incomingLiveBroadcast, cancellationToken, timings, baseLogger);
+	}
 
-	// --- Ensure OBS streaming is stopped ---
-	logger->info("OBSStreamingEnsuringStopped");
+	// --- YouTube access token ---
+	PhaseTimings::Span tokenFetchSpan(timings, SessionPhase::TokenFetch);
+	const std::string accessToken = getAccessToken(tokenProvider, logger);
+	tokenFetchSpan.stop();
 
-	co_await ensureOBSStreamingStopped(logger);
+	auto incomingLiveBroadcastShared =
+		std::make_shared<YouTubeApi::YouTubeLiveBroadcast>(preparedSegment->incomingLiveBroadcast);
+	auto incomingLiveStream = std::make_shared<YouTubeApi::YouTubeLiveStream>(preparedSegment->incomingLiveStream);
 
-	logger->info("OBSStreamingEnsuredStopped");
+	const bool makeBeforeBreak = overlappingOutputs->isEnabled();
+	const std::array<std::string, 1> incomingLiveStreamIdArray{incomingLiveStreamId};
+	try {
+		if (makeBeforeBreak) {
+			// --- Start streaming the incoming live broadcast before stopping the outgoing one ---
+			logger->info("StreamingStarting");
 
-	// --- Start streaming the initial live broadcast ---
-	logger->info("StreamingStarting");
+			co_await startStreamingOverlapped(networkExecutor, youTubeApiClient, accessToken,
+							  cancellationToken, overlappingOutputs, currentLiveStreamIndex,
+							  incomingLiveStreamIndex, incomingLiveBroadcastShared,
+							  incomingLiveStream, timings, logger);
 
-	auto incomingLiveBroadcastShared = std::make_shared<YouTubeApi::YouTubeLiveBroadcast>(incomingLiveBroadcast);
-	co_await startStreaming(youTubeApiClient, accessToken, parent, incomingLiveBroadcastShared, incomingLiveStream,
-				logger);
+			logger->info("StreamingStarted");
+		} else {
+			// --- Ensure OBS streaming is stopped ---
+			logger->info("OBSStreamingEnsuringStopped");
 
-	logger->info("StreamingStarted");
+			co_await waitForKeyframeBoundary(networkExecutor, *overlappingOutputs, currentLiveStreamIndex,
+							 cancellationToken, timings, logger);
+			PhaseTimings::Span obsStopSpan(timings, SessionPhase::OBSStop);
+			co_await ensureOBSStreamingStopped(logger);
+			obsStopSpan.stop();
 
-	// --- Complete active broadcasts ---
-	logger->info("YouTubeLiveBroadcastCompletingActive");
+			logger->info("OBSStreamingEnsuredStopped");
 
-	const std::array<std::string, 2> liveStreamIds{
-		currentLiveStreamId,
-		incomingLiveStreamId,
-	};
+			// --- Start streaming the incoming live broadcast ---
+			logger->info("StreamingStarting");
 
-	completeActiveLiveBroadcasts(youTubeApiClient, accessToken, liveStreamIds, logger);
+			co_await startStreaming(networkExecutor, youTubeApiClient, accessToken, cancellationToken,
+						incomingLiveBroadcastShared, incomingLiveStream, timings, logger);
 
-	logger->info("YouTubeLiveBroadcastCompletedActive");
+			logger->info("StreamingStarted");
+		}
+	} catch (...) {
+		// The incoming broadcast may or may not have gone live.
+		liveBroadcastIndex->forget(incomingLiveStreamIdArray);
+		throw;
+	}
+
+	// Both broadcasts may be live until the outgoing one has been completed in the background.
+	sessionJournal->append(std::move(cutoverRecord));
+
+	if (incomingLiveBroadcast.id) {
+		liveBroadcastIndex->setLive(incomingLiveStreamId, *incomingLiveBroadcast.id);
+	}
 
 	// --- Segment completed ---
 	if (!incomingLiveBroadcast.id) {
@@ -804,7 +1868,105 @@ YouTubeStreamSegmenterMainLoop::segmentContinuousSessionTask(
 	logger->info("ContinuousYouTubeSessionSegmented",
 		     {{"broadcastId", *incomingLiveBroadcast.id}, {"title", *incomingLiveBroadcast.snippet->title}});
 
+	const YouTubeApi::YouTubeLiveBroadcast &nextLiveBroadcast = preparedSegment->nextLiveBroadcast;
+	const std::string nextLiveBroadcastId = nextLiveBroadcast.id.value_or("(ID MISSING)");
+	const std::string nextLiveBroadcastTitle = (nextLiveBroadcast.snippet && nextLiveBroadcast.snippet->title)
+							   ? *nextLiveBroadcast.snippet->title
+							   : "(TITLE MISSING)";
+	logger->info("YouTubeLiveBroadcastPromotedNext",
+		     {{"broadcastId", nextLiveBroadcastId}, {"title", nextLiveBroadcastTitle}});
+
 	co_return {incomingLiveBroadcast, nextLiveBroadcast};
 }
 
+Async::Task<void> YouTubeStreamSegmenterMainLoop::completeOutgoingLiveBroadcastTask(
+	std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool, std::shared_ptr<PluginExecutors> executors,
+	std::shared_ptr<YouTubeApi::YouTubeRequestScheduler> requestScheduler,
+	std::shared_ptr<Store::GoogleAccessTokenProvider> tokenProvider,
+	std::shared_ptr<LiveBroadcastIndex> liveBroadcastIndex, std::string outgoingLiveStreamId,
+	std::shared_ptr<Async::OneShotEvent> completed, Async::CancellationToken cancellationToken,
+	std::shared_ptr<const Logger::ILogger> baseLogger)
+{
+	const std::shared_ptr<const Logger::ILogger> logger = Logger::ContextLogger::create(
+		baseLogger, {{"taskName", "YouTubeStreamSegmenterMainLoop::completeOutgoingLiveBroadcastTask"},
+			     {"liveStreamId", outgoingLiveStreamId}});
+	// The next cutover may already be under way, so this must not compete with it for quota.
+	const std::shared_ptr<YouTubeApi::YouTubeApiClient> youTubeApiClient =
+		makeYouTubeApiClient(curlPool, requestScheduler, YouTubeApi::YouTubeRequestPriority::Background, logger,
+				     cancellationToken);
+	const std::array<std::string, 1> liveStreamIds{outgoingLiveStreamId};
+
+	co_await Async::ResumeOn{executors->getNetwork()};
+	// on a worker thread
+
+	logger->info("YouTubeLiveBroadcastCompletingOutgoing");
+
+	try {
+		const std::string accessToken = getAccessToken(tokenProvider, logger);
+		completeLiveBroadcasts(youTubeApiClient, accessToken, liveStreamIds, *liveBroadcastIndex, logger);
+		logger->info("YouTubeLiveBroadcastCompletedOutgoing");
+	} catch (const std::exception &e) {
+		// The broadcast may still be live; the next completion on this live stream scans for it.
+		logger->error("YouTubeLiveBroadcastCompleteOutgoingError", {{"exception", e.what()}});
+		liveBroadcastIndex->forget(liveStreamIds);
+	} catch (...) {
+		logger->error("YouTubeLiveBroadcastCompleteOutgoingUnknownError");
+		liveBroadcastIndex->forget(liveStreamIds);
+	}
+
+	completed->set();
+}
+
+Async::Task<void> YouTubeStreamSegmenterMainLoop::liveStreamHealthChangedTask(
+	Async::Channel<Message> &channel, std::shared_ptr<PluginExecutors> executors,
+	std::shared_ptr<PersistentScriptingContext> scriptingContext,
+	std::shared_ptr<OverlappingStreamingOutputs> overlappingOutputs,
+	std::shared_ptr<LiveStreamHealthMonitor> liveStreamHealthMonitor,
+	std::shared_ptr<const LiveStreamHealthSnapshot> health, std::size_t currentLiveStreamIndex,
+	Async::CancellationToken cancellationToken, std::shared_ptr<const Logger::ILogger> baseLogger)
+{
+	const std::shared_ptr<const Logger::ILogger> logger = Logger::ContextLogger::create(
+		baseLogger, {{"taskName", "YouTubeStreamSegmenterMainLoop::liveStreamHealthChangedTask"}});
+	Async::ThreadPoolExecutor &networkExecutor = executors->getNetwork();
+
+	cancellationToken.throwIfCancellationRequested();
+
+	// --- Scripting ---
+	std::shared_ptr<Scripting::EventScriptingContext> context = co_await scriptingContext->acquireTask();
+	co_await Async::ResumeOn{networkExecutor};
+
+	// The handler is optional; without it health is only shown and logged.
+	constexpr const char *kHealthChangedFunctionName = "onYouTubeLiveStreamHealthChanged";
+	if (!context->hasFunction(kHealthChangedFunctionName)) {
+		co_return;
+	}
+
+	const nlohmann::json jResult = co_await context->executeFunctionTask(kHealthChangedFunctionName,
+									     makeLiveStreamHealthEventObject(*health));
+	co_await Async::ResumeOn{networkExecutor};
+
+	LiveStreamHealthAction action = parseLiveStreamHealthAction(jResult, logger);
+	if (action == LiveStreamHealthAction::Reconnect && overlappingOutputs->hasOutput(currentLiveStreamIndex)) {
+		// Only the frontend output can be restarted in place; a cutover gives the live stream a fresh one.
+		logger->warn("LiveStreamHealthReconnectBySegment", {{"liveStreamId", health->liveStreamId}});
+		action = LiveStreamHealthAction::Segment;
+	}
+
+	switch (action) {
+	case LiveStreamHealthAction::Segment:
+		logger->warn("LiveStreamHealthSegmentRequested", {{"liveStreamId", health->liveStreamId}});
+		// Queued like Segment Now, so the segment and prepare timers keep their schedule.
+		channel.send(Message{MessageType::SegmentContinuousSession, cancellationToken}, {.coalesce = true});
+		break;
+	case LiveStreamHealthAction::Reconnect:
+		logger->warn("LiveStreamHealthReconnectRequested", {{"liveStreamId", health->liveStreamId}});
+		// The live stream goes inactive while reconnecting; the main loop resumes polling afterwards.
+		liveStreamHealthMonitor->pause();
+		co_await restartOBSStreaming(networkExecutor, cancellationToken, logger);
+		break;
+	case LiveStreamHealthAction::None:
+		break;
+	}
+}
+
 } // namespace KaitoTokyo::LiveStreamSegmenter::Controller
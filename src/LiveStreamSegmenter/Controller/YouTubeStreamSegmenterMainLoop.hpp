@@ -20,24 +20,47 @@
 
 #pragma once
 
+#include <array>
 #include <chrono>
+#include <cstddef>
 #include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include <QObject>
 #include <QTimer>
 #include <QWidget>
 
+#include <KaitoTokyo/Async/Cancellation.hpp>
 #include <KaitoTokyo/Async/Channel.hpp>
+#include <KaitoTokyo/Async/OneShotEvent.hpp>
 #include <KaitoTokyo/Async/Task.hpp>
-#include <KaitoTokyo/CurlHelper/CurlHandle.hpp>
+#include <KaitoTokyo/Async/TaskScope.hpp>
+#include <KaitoTokyo/CurlHelper/CurlConnectionPool.hpp>
+#include <KaitoTokyo/CurlHelper/CurlMultiExecutor.hpp>
 #include <KaitoTokyo/Logger/ILogger.hpp>
 #include <KaitoTokyo/YouTubeApi/YouTubeApiClient.hpp>
 
-#include <AuthStore.hpp>
 #include <EventHandlerStore.hpp>
+#include <GoogleAccessTokenProvider.hpp>
+#include <LiveStreamCache.hpp>
 #include <ScriptingRuntime.hpp>
+#include <ProfilePaths.hpp>
+#include <SessionJournal.hpp>
 #include <YouTubeStore.hpp>
 
+#include "LiveBroadcastIndex.hpp"
+#include "LiveStreamHealthMonitor.hpp"
+#include "LiveStreamRing.hpp"
+#include "OverlappingStreamingOutputs.hpp"
+#include "PersistentScriptingContext.hpp"
+#include "PhaseTimings.hpp"
+#include "PluginExecutors.hpp"
+#include "ProgramThumbnailCapture.hpp"
+#include "SegmentSchedule.hpp"
+
 namespace KaitoTokyo::LiveStreamSegmenter::Controller {
 
 class YouTubeStreamSegmenterMainLoop : public QObject {
@@ -47,17 +70,41 @@ class YouTubeStreamSegmenterMainLoop : public QObject {
 		StartContinuousSession,
 		StopContinuousSession,
 		SegmentContinuousSession,
+		PrepareContinuousSessionSegment,
+		LiveStreamHealthChanged,
 	};
 
 	struct Message {
 		MessageType type;
+		// Cancelled when the session is stopped; empty for messages that must always run to completion.
+		Async::CancellationToken cancellationToken;
+
+		bool operator==(const Message &) const = default;
+	};
+
+	static std::string_view messageTypeName(MessageType type) noexcept;
+
+	/**
+	 * Everything the next segment boundary needs that can be done ahead of time.
+	 * The incoming broadcast is already bound to the incoming live stream, so the
+	 * cutover only has to restart OBS and transition the broadcast.
+	 */
+	struct PreparedSegment {
+		std::size_t currentLiveStreamIndex;
+		YouTubeApi::YouTubeLiveBroadcast incomingLiveBroadcast;
+		YouTubeApi::YouTubeLiveStream incomingLiveStream;
+		YouTubeApi::YouTubeLiveBroadcast nextLiveBroadcast;
 	};
 
 public:
 	YouTubeStreamSegmenterMainLoop(std::shared_ptr<Scripting::ScriptingRuntime> runtime,
-				       std::shared_ptr<Store::AuthStore> authStore,
+				       std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool,
+				       std::shared_ptr<PluginExecutors> executors,
+				       std::shared_ptr<Store::GoogleAccessTokenProvider> tokenProvider,
 				       std::shared_ptr<Store::EventHandlerStore> eventHandlerStore,
 				       std::shared_ptr<Store::YouTubeStore> youtubeStore,
+				       std::shared_ptr<Store::LiveStreamCache> liveStreamCache,
+				       std::shared_ptr<const Store::ProfilePaths> paths, std::string sessionId,
 				       std::shared_ptr<const Logger::ILogger> logger, QWidget *parent);
 
 	~YouTubeStreamSegmenterMainLoop() override;
@@ -76,54 +123,141 @@ public slots:
 	void onStartContinuousSession();
 	void onStopContinuousSession();
 	void onSegmentContinuousSession();
+	void onPrepareContinuousSessionSegment();
 
 private:
+	// Called on the thread that owns this object whenever the monitor saw the health change.
+	void onLiveStreamHealthChanged();
+	// Segments once nextSegmentAt_ has passed, and otherwise re-arms the timers towards it.
+	void onSegmentTimerTimeout();
+	void armSegmentTimer();
+	void armPrepareTimer();
+
 	const std::shared_ptr<Scripting::ScriptingRuntime> runtime_;
-	const std::shared_ptr<Store::AuthStore> authStore_;
+	const std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool_;
+	const std::shared_ptr<PluginExecutors> executors_;
+	const std::shared_ptr<Store::GoogleAccessTokenProvider> tokenProvider_;
 	const std::shared_ptr<Store::EventHandlerStore> eventHandlerStore_;
 	const std::shared_ptr<Store::YouTubeStore> youtubeStore_;
+	const std::shared_ptr<Store::LiveStreamCache> liveStreamCache_;
+	const std::shared_ptr<const Store::ProfilePaths> paths_;
+	// Labels the metrics of this session.
+	const std::string sessionId_;
 	const std::shared_ptr<const Logger::ILogger> logger_;
 	QWidget *const parent_;
 
-	const std::shared_ptr<CurlHelper::CurlHandle> curl_;
 	const std::shared_ptr<YouTubeApi::YouTubeApiClient> youTubeApiClient_;
 	QTimer *tickTimer_;
 	QTimer *segmentTimer_;
+	QTimer *prepareTimer_;
+	// Read from onInitYouTubeStreamSegmenter. Like the timers, only touched on the thread that owns this object.
+	SegmentSchedule segmentSchedule_ = SegmentSchedule::everyIntervalFromStart(std::chrono::hours(1));
+	std::chrono::milliseconds prepareAhead_{std::chrono::minutes(5)};
+	SegmentSchedule::Clock::time_point sessionStartedAt_;
+	// The boundary the timers are armed for, while a session runs.
+	std::optional<SegmentSchedule::Clock::time_point> nextSegmentAt_;
+	// Runs the transfers of fetch() calls made by event handlers.
+	const std::shared_ptr<CurlHelper::CurlMultiExecutor> scriptingCurlExecutor_;
+	const std::shared_ptr<PersistentScriptingContext> scriptingContext_;
+	const std::shared_ptr<PhaseTimingStatistics> phaseTimingStatistics_;
+	const std::shared_ptr<OverlappingStreamingOutputs> overlappingOutputs_;
+	const std::shared_ptr<ProgramThumbnailCapture> thumbnailCapture_;
+	const std::shared_ptr<Store::SessionJournal> sessionJournal_;
+	const std::shared_ptr<LiveBroadcastIndex> liveBroadcastIndex_;
+	const std::shared_ptr<LiveStreamHealthMonitor> liveStreamHealthMonitor_;
 
-	Async::Channel<Message> channel_;
-	Async::Task<void> mainLoopTask_;
+	// Replaced on every start and cancelled on stop; only touched on the thread that owns this object.
+	Async::CancellationSource sessionCancellationSource_;
+	// Shared with the main loop, which may outlive this object if it misses the shutdown deadline.
+	const std::shared_ptr<Async::Channel<Message>> channel_;
+	Async::TaskScope mainLoopScope_;
 
-	static Async::Task<void> mainLoop(Async::Channel<Message> &channel,
-					  std::shared_ptr<CurlHelper::CurlHandle> curl,
+	static Async::Task<void> mainLoop(std::shared_ptr<Async::Channel<Message>> channel,
+					  std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool,
+					  std::shared_ptr<PluginExecutors> executors,
 					  std::shared_ptr<YouTubeApi::YouTubeApiClient> youTubeApiClient,
-					  std::shared_ptr<Scripting::ScriptingRuntime> runtime,
-					  std::shared_ptr<Store::AuthStore> authStore,
-					  std::shared_ptr<Store::EventHandlerStore> eventHandlerStore,
+					  std::shared_ptr<PersistentScriptingContext> scriptingContext,
+					  std::shared_ptr<Store::GoogleAccessTokenProvider> tokenProvider,
+					  std::shared_ptr<Store::LiveStreamCache> liveStreamCache,
 					  std::shared_ptr<Store::YouTubeStore> youtubeStore,
+					  std::shared_ptr<PhaseTimingStatistics> phaseTimingStatistics,
+					  std::shared_ptr<OverlappingStreamingOutputs> overlappingOutputs,
+					  std::shared_ptr<ProgramThumbnailCapture> thumbnailCapture,
+					  std::shared_ptr<Store::SessionJournal> sessionJournal,
+					  std::shared_ptr<LiveBroadcastIndex> liveBroadcastIndex,
+					  std::shared_ptr<LiveStreamHealthMonitor> liveStreamHealthMonitor,
+					  std::shared_ptr<const Store::ProfilePaths> paths, std::string sessionId,
 					  std::shared_ptr<const Logger::ILogger> logger, QWidget *parent);
 
+	// Returns the broadcast live on currentLiveStreamIndex and the one to go live on the live stream after it.
 	static Async::Task<std::array<YouTubeApi::YouTubeLiveBroadcast, 2>> startContinuousSessionTask(
-		std::shared_ptr<CurlHelper::CurlHandle> curl,
-		std::shared_ptr<YouTubeApi::YouTubeApiClient> youTubeApiClient,
-		std::shared_ptr<Scripting::ScriptingRuntime> runtime, std::shared_ptr<Store::AuthStore> authStore,
-		std::shared_ptr<Store::EventHandlerStore> eventHandlerStore,
-		std::shared_ptr<Store::YouTubeStore> youtubeStore, std::size_t currentLiveStreamIndex, QObject *parent,
-		std::shared_ptr<const Logger::ILogger> baseLogger);
+		std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool, std::shared_ptr<PluginExecutors> executors,
+		std::shared_ptr<YouTubeApi::YouTubeRequestScheduler> requestScheduler,
+		std::shared_ptr<PersistentScriptingContext> scriptingContext,
+		std::shared_ptr<Store::GoogleAccessTokenProvider> tokenProvider,
+		std::shared_ptr<Store::LiveStreamCache> liveStreamCache,
+		std::shared_ptr<OverlappingStreamingOutputs> overlappingOutputs,
+		std::shared_ptr<ProgramThumbnailCapture> thumbnailCapture,
+		std::shared_ptr<Store::SessionJournal> sessionJournal,
+		std::shared_ptr<LiveBroadcastIndex> liveBroadcastIndex, std::vector<std::string> liveStreamIds,
+		std::size_t currentLiveStreamIndex, QObject *parent, Async::CancellationToken cancellationToken,
+		std::shared_ptr<PhaseTimings> timings, std::shared_ptr<const Logger::ILogger> baseLogger);
 
 	static Async::Task<void> stopContinuousSessionTask(
-		[[maybe_unused]] Async::Channel<Message> &channel, std::shared_ptr<CurlHelper::CurlHandle> curl,
+		[[maybe_unused]] Async::Channel<Message> &channel, std::shared_ptr<PluginExecutors> executors,
 		std::shared_ptr<YouTubeApi::YouTubeApiClient> youTubeApiClient,
-		std::shared_ptr<Store::AuthStore> authStore, std::shared_ptr<Store::YouTubeStore> youtubeStore,
-		std::shared_ptr<const Logger::ILogger> logger);
+		std::shared_ptr<Store::GoogleAccessTokenProvider> tokenProvider,
+		std::shared_ptr<OverlappingStreamingOutputs> overlappingOutputs,
+		std::shared_ptr<LiveBroadcastIndex> liveBroadcastIndex, std::vector<std::string> liveStreamIds,
+		std::shared_ptr<PhaseTimings> timings, std::shared_ptr<const Logger::ILogger> logger);
+
+	static Async::Task<PreparedSegment> prepareContinuousSessionSegmentTask(
+		std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool, std::shared_ptr<PluginExecutors> executors,
+		std::shared_ptr<YouTubeApi::YouTubeRequestScheduler> requestScheduler,
+		YouTubeApi::YouTubeRequestPriority requestPriority,
+		std::shared_ptr<PersistentScriptingContext> scriptingContext,
+		std::shared_ptr<Store::GoogleAccessTokenProvider> tokenProvider,
+		std::shared_ptr<Store::LiveStreamCache> liveStreamCache,
+		std::shared_ptr<ProgramThumbnailCapture> thumbnailCapture, std::size_t currentLiveStreamIndex,
+		std::string incomingLiveStreamId, YouTubeApi::YouTubeLiveBroadcast incomingLiveBroadcast,
+		Async::CancellationToken cancellationToken,
+		std::shared_ptr<PhaseTimings> timings, std::shared_ptr<const Logger::ILogger> baseLogger);
 
+	// Returns the broadcast now live on the incoming live stream and the one to go live after it.
+	// The outgoing broadcast is left live for completeOutgoingLiveBroadcastTask.
 	static Async::Task<std::array<YouTubeApi::YouTubeLiveBroadcast, 2>> segmentContinuousSessionTask(
-		std::shared_ptr<CurlHelper::CurlHandle> curl,
-		std::shared_ptr<YouTubeApi::YouTubeApiClient> youTubeApiClient,
-		std::shared_ptr<Scripting::ScriptingRuntime> runtime, std::shared_ptr<Store::AuthStore> authStore,
-		std::shared_ptr<Store::EventHandlerStore> eventHandlerStore,
-		std::shared_ptr<Store::YouTubeStore> youtubeStore, std::size_t currentLiveStreamIndex,
-		YouTubeApi::YouTubeLiveBroadcast incomingLiveBroadcast, QObject *parent,
+		std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool, std::shared_ptr<PluginExecutors> executors,
+		std::shared_ptr<YouTubeApi::YouTubeRequestScheduler> requestScheduler,
+		std::shared_ptr<PersistentScriptingContext> scriptingContext,
+		std::shared_ptr<Store::GoogleAccessTokenProvider> tokenProvider,
+		std::shared_ptr<Store::LiveStreamCache> liveStreamCache,
+		std::shared_ptr<OverlappingStreamingOutputs> overlappingOutputs,
+		std::shared_ptr<ProgramThumbnailCapture> thumbnailCapture,
+		std::shared_ptr<Store::SessionJournal> sessionJournal,
+		std::shared_ptr<LiveBroadcastIndex> liveBroadcastIndex, std::size_t currentLiveStreamIndex,
+		std::size_t incomingLiveStreamIndex, std::string incomingLiveStreamId,
+		YouTubeApi::YouTubeLiveBroadcast incomingLiveBroadcast, std::optional<PreparedSegment> preparedSegment,
+		Store::SessionJournalRecord cutoverRecord, QObject *parent, Async::CancellationToken cancellationToken,
+		std::shared_ptr<PhaseTimings> timings, std::shared_ptr<const Logger::ILogger> baseLogger);
+
+	// Completes the broadcast left live on the outgoing live stream and sets completed, even on failure.
+	static Async::Task<void> completeOutgoingLiveBroadcastTask(
+		std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool, std::shared_ptr<PluginExecutors> executors,
+		std::shared_ptr<YouTubeApi::YouTubeRequestScheduler> requestScheduler,
+		std::shared_ptr<Store::GoogleAccessTokenProvider> tokenProvider,
+		std::shared_ptr<LiveBroadcastIndex> liveBroadcastIndex, std::string outgoingLiveStreamId,
+		std::shared_ptr<Async::OneShotEvent> completed, Async::CancellationToken cancellationToken,
 		std::shared_ptr<const Logger::ILogger> baseLogger);
+
+	// Passes a health change of the live stream that is live to the event handler, if it exports
+	// onYouTubeLiveStreamHealthChanged, and carries out the segment or reconnect it asks for.
+	static Async::Task<void> liveStreamHealthChangedTask(
+		Async::Channel<Message> &channel, std::shared_ptr<PluginExecutors> executors,
+		std::shared_ptr<PersistentScriptingContext> scriptingContext,
+		std::shared_ptr<OverlappingStreamingOutputs> overlappingOutputs,
+		std::shared_ptr<LiveStreamHealthMonitor> liveStreamHealthMonitor,
+		std::shared_ptr<const LiveStreamHealthSnapshot> health, std::size_t currentLiveStreamIndex,
+		Async::CancellationToken cancellationToken, std::shared_ptr<const Logger::ILogger> baseLogger);
 };
 
 } // namespace KaitoTokyo::LiveStreamSegmenter::Controller
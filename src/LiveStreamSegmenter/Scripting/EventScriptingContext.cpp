@@ -25,17 +25,59 @@
 
 #include "EventScriptingContext.hpp"
 
-extern "C" const std::uint32_t qjsc_dayjs_bundle_size;
-extern "C" const std::uint8_t qjsc_dayjs_bundle[];
-extern "C" const std::uint32_t qjsc_ini_bundle_size;
-extern "C" const std::uint8_t qjsc_ini_bundle[];
-extern "C" const std::uint32_t qjsc_localstorage_bundle_size;
-extern "C" const std::uint8_t qjsc_localstorage_bundle[];
-extern "C" const uint32_t qjsc_youtube_bundle_size;
-extern "C" const uint8_t qjsc_youtube_bundle[];
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <iterator>
+#include <system_error>
+#include <vector>
+
+#include <KaitoTokyo/Metrics/MetricsRegistry.hpp>
+
+#include "ScriptingJson.hpp"
 
 namespace KaitoTokyo::LiveStreamSegmenter::Scripting {
 
+namespace {
+
+// How long localStorage writes may stay in memory while a handler waits for host jobs.
+constexpr std::chrono::seconds kLocalStorageFlushInterval{1};
+
+constexpr std::array<char, 8> kBytecodeCacheMagic{'L', 'S', 'S', 'Q', 'J', 'S', 'B', '1'};
+
+struct BytecodeCacheHeader {
+	std::array<char, 8> magic;
+	std::array<char, 32> engineVersion;
+	std::uint64_t sourceHash;
+	std::uint64_t sourceSize;
+	std::uint64_t bytecodeHash;
+	std::uint64_t bytecodeSize;
+};
+
+// FNV-1a; collisions are also guarded by the size fields, and the header is not a security boundary.
+std::uint64_t hashBytes(const void *data, std::size_t size) noexcept
+{
+	std::uint64_t hash = 0xcbf29ce484222325ULL;
+	const auto *bytes = static_cast<const unsigned char *>(data);
+	for (std::size_t i = 0; i < size; ++i) {
+		hash ^= bytes[i];
+		hash *= 0x100000001b3ULL;
+	}
+	return hash;
+}
+
+std::array<char, 32> getEngineVersion() noexcept
+{
+	std::array<char, 32> engineVersion{};
+	const char *version = JS_GetVersion();
+	std::strncpy(engineVersion.data(), version ? version : "", engineVersion.size() - 1);
+	return engineVersion;
+}
+
+} // anonymous namespace
+
 EventScriptingContext::EventScriptingContext(std::shared_ptr<ScriptingRuntime> runtime, std::shared_ptr<JSContext> ctx,
 					     std::shared_ptr<const Logger::ILogger> logger)
 	: runtime_(runtime ? std::move(runtime)
@@ -44,7 +86,9 @@ EventScriptingContext::EventScriptingContext(std::shared_ptr<ScriptingRuntime> r
 	  ctx_(ctx ? std::move(ctx)
 		   : throw std::invalid_argument("ContextNullError(EventScriptingContext::EventScriptingContext)")),
 	  logger_(logger ? std::move(logger)
-			 : throw std::invalid_argument("LoggerNullError(EventScriptingContext::EventScriptingContext)"))
+			 : throw std::invalid_argument(
+				   "LoggerNullError(EventScriptingContext::EventScriptingContext)")),
+	  hostJobs_(std::make_shared<ScriptingHostJobQueue>(ctx_))
 {
 }
 
@@ -60,17 +104,44 @@ void EventScriptingContext::setupContext()
 	JS_AddIntrinsicEval(ctx_.get());
 	JS_AddIntrinsicPromise(ctx_.get());
 
-	loadModule(qjsc_dayjs_bundle_size, qjsc_dayjs_bundle);
-	loadModule(qjsc_ini_bundle_size, qjsc_ini_bundle);
-	loadModule(qjsc_youtube_bundle_size, qjsc_youtube_bundle);
+	// builtin:dayjs, builtin:ini and builtin:youtube are resolved on import by ScriptingRuntime.
 }
 
-void EventScriptingContext::setupLocalStorage()
+void EventScriptingContext::setupLocalStorage(ScriptingDatabase &database)
 {
-	loadModule(qjsc_localstorage_bundle_size, qjsc_localstorage_bundle);
+	database.setupLocalStorage();
+	localStorageDatabase_ = &database;
 }
 
 void EventScriptingContext::loadEventHandler(const char *script)
+{
+	ScopedJSValue moduleObj = compileEventHandler(script);
+	if (JS_IsUndefined(moduleObj.get())) {
+		return;
+	}
+
+	evaluateEventHandler(moduleObj);
+}
+
+void EventScriptingContext::loadEventHandler(const char *script, const std::filesystem::path &bytecodeCachePath)
+{
+	const std::string_view source(script);
+
+	ScopedJSValue moduleObj = readEventHandlerBytecodeCache(source, bytecodeCachePath);
+	if (JS_IsUndefined(moduleObj.get())) {
+		moduleObj = compileEventHandler(script);
+		if (JS_IsUndefined(moduleObj.get())) {
+			return;
+		}
+
+		// Serialized straight after compilation, as qjsc does, before evaluation links the module.
+		writeEventHandlerBytecodeCache(source, moduleObj, bytecodeCachePath);
+	}
+
+	evaluateEventHandler(moduleObj);
+}
+
+ScopedJSValue EventScriptingContext::compileEventHandler(const char *script)
 {
 	std::shared_ptr<const Logger::ILogger> logger = logger_;
 
@@ -85,11 +156,118 @@ void EventScriptingContext::loadEventHandler(const char *script)
 		} else {
 			logger->error("ModuleCompileError");
 		}
-		return;
+		return ScopedJSValue();
 	} else if (!JS_IsModule(moduleObj.get())) {
 		throw std::runtime_error("InvalidModuleError(EventScriptingContext::loadEventHandler)");
 	}
 
+	return moduleObj;
+}
+
+ScopedJSValue EventScriptingContext::readEventHandlerBytecodeCache(std::string_view script,
+								 const std::filesystem::path &path)
+{
+	std::ifstream ifs(path, std::ios::in | std::ios::binary);
+	if (!ifs.is_open()) {
+		logger_->info("EventHandlerBytecodeCacheMiss", {{"reason", "NotFound"}});
+		return ScopedJSValue();
+	}
+
+	const std::vector<char> contents{std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>()};
+
+	BytecodeCacheHeader header;
+	if (contents.size() < sizeof(header)) {
+		logger_->warn("EventHandlerBytecodeCacheMiss", {{"reason", "Truncated"}});
+		return ScopedJSValue();
+	}
+	std::memcpy(&header, contents.data(), sizeof(header));
+
+	const std::uint8_t *bytecode = reinterpret_cast<const std::uint8_t *>(contents.data()) + sizeof(header);
+	const std::size_t bytecodeSize = contents.size() - sizeof(header);
+
+	if (header.magic != kBytecodeCacheMagic || header.engineVersion != getEngineVersion()) {
+		logger_->info("EventHandlerBytecodeCacheMiss", {{"reason", "VersionMismatch"}});
+		return ScopedJSValue();
+	}
+	if (header.sourceSize != script.size() || header.sourceHash != hashBytes(script.data(), script.size())) {
+		logger_->info("EventHandlerBytecodeCacheMiss", {{"reason", "SourceChanged"}});
+		return ScopedJSValue();
+	}
+	// JS_ReadObject trusts its input, so anything damaged on disk must be rejected before it gets there.
+	if (header.bytecodeSize != bytecodeSize || header.bytecodeHash != hashBytes(bytecode, bytecodeSize)) {
+		logger_->warn("EventHandlerBytecodeCacheMiss", {{"reason", "Corrupted"}});
+		return ScopedJSValue();
+	}
+
+	ScopedJSValue moduleObj(ctx_.get(), JS_ReadObject(ctx_.get(), bytecode, bytecodeSize, JS_READ_OBJ_BYTECODE));
+	if (std::optional<std::string> exceptionString = moduleObj.asExceptionString()) {
+		logger_->warn("EventHandlerBytecodeCacheReadError", {{"message", exceptionString.value()}});
+		return ScopedJSValue();
+	} else if (!JS_IsModule(moduleObj.get())) {
+		logger_->warn("EventHandlerBytecodeCacheReadError", {{"message", "NotAModule"}});
+		return ScopedJSValue();
+	}
+
+	logger_->info("EventHandlerBytecodeCacheHit");
+	return moduleObj;
+}
+
+void EventScriptingContext::writeEventHandlerBytecodeCache(std::string_view script, const ScopedJSValue &moduleObj,
+							   const std::filesystem::path &path)
+{
+	std::size_t bytecodeSize = 0;
+	std::uint8_t *bytecode = JS_WriteObject(ctx_.get(), &bytecodeSize, moduleObj.get(), JS_WRITE_OBJ_BYTECODE);
+	if (!bytecode) {
+		ScopedJSValue exception(ctx_.get(), JS_GetException(ctx_.get()));
+		logger_->warn("EventHandlerBytecodeCacheWriteError", {{"reason", "SerializeFailed"}});
+		return;
+	}
+
+	const BytecodeCacheHeader header{
+		.magic = kBytecodeCacheMagic,
+		.engineVersion = getEngineVersion(),
+		.sourceHash = hashBytes(script.data(), script.size()),
+		.sourceSize = script.size(),
+		.bytecodeHash = hashBytes(bytecode, bytecodeSize),
+		.bytecodeSize = bytecodeSize,
+	};
+
+	std::filesystem::path tmpPath = path;
+	tmpPath += ".tmp";
+	{
+		std::ofstream ofs(tmpPath, std::ios::out | std::ios::binary | std::ios::trunc);
+		if (ofs.is_open()) {
+			ofs.write(reinterpret_cast<const char *>(&header), sizeof(header));
+			ofs.write(reinterpret_cast<const char *>(bytecode), static_cast<std::streamsize>(bytecodeSize));
+		}
+		js_free(ctx_.get(), bytecode);
+
+		if (!ofs.is_open() || !ofs.flush()) {
+			logger_->warn("EventHandlerBytecodeCacheWriteError", {{"path", tmpPath.string()}});
+			return;
+		}
+	}
+
+	// Readers see either the previous cache or the complete new one.
+	std::error_code ec;
+	std::filesystem::rename(tmpPath, path, ec);
+	if (ec) {
+		logger_->warn("EventHandlerBytecodeCacheWriteError",
+			      {{"path", path.string()}, {"error", ec.message()}});
+		std::filesystem::remove(tmpPath, ec);
+		return;
+	}
+
+	logger_->info("EventHandlerBytecodeCacheWritten", {{"bytecodeSize", std::to_string(bytecodeSize)}});
+}
+
+void EventScriptingContext::evaluateEventHandler(const ScopedJSValue &moduleObj)
+{
+	std::shared_ptr<const Logger::ILogger> logger = logger_;
+
+	// Top-level code of the handler module gets the same budget as a single event.
+	ScriptingRuntime::ExecutionBudgetScope budget(*runtime_);
+
 	ScopedJSValue ret(ctx_.get(), JS_EvalFunction(ctx_.get(), JS_DupValue(ctx_.get(), moduleObj.get())));
 	if (JS_IsException(ret.get())) {
 		ScopedJSValue exception(ctx_.get(), JS_GetException(ctx_.get()));
@@ -99,6 +277,7 @@ void EventScriptingContext::loadEventHandler(const char *script)
 		} else {
 			logger->error("ModuleEvalError");
 		}
+		flushLocalStorage();
 		return;
 	}
 
@@ -114,11 +293,13 @@ void EventScriptingContext::loadEventHandler(const char *script)
 		} else {
 			logger->error("ModuleEvalError");
 		}
+		flushLocalStorage();
 		return;
 	}
 
 	ScopedJSValue ns(ctx_.get(), JS_GetModuleNamespace(ctx_.get(), m));
 	eventHandlerNs_ = std::move(ns);
+	flushLocalStorage();
 }
 
 ScopedJSValue EventScriptingContext::getModuleProperty(const char *property) const
@@ -127,94 +308,283 @@ ScopedJSValue EventScriptingContext::getModuleProperty(const char *property) con
 	return val;
 }
 
+bool EventScriptingContext::hasFunction(const char *functionName) const
+{
+	return ScriptingExecutor::runBlocking(runtime_->getExecutor(), [&]() -> bool {
+		ScopedJSValue func = getModuleProperty(functionName);
+		return JS_IsFunction(ctx_.get(), func.get());
+	});
+}
+
 std::string EventScriptingContext::executeFunction(const char *functionName, const char *eventObject)
+{
+	// Runs on the runtime's executor, if any, so that callers on other threads never share the runtime.
+	return ScriptingExecutor::runBlocking(runtime_->getExecutor(), [&]() -> std::string {
+		ScopedJSValue eventObj(ctx_.get(),
+				       JS_ParseJSON(ctx_.get(), eventObject, strlen(eventObject), "<eventObject>"));
+		if (std::optional<std::string> exception = eventObj.asExceptionString())
+			throw std::runtime_error("EventObjectParseError(EventScriptingContext::executeFunction):" +
+						 exception.value());
+
+		ScopedJSValue resultObj = callFunction(functionName, eventObj);
+
+		ScopedJSValue resultJson(ctx_.get(),
+					 JS_JSONStringify(ctx_.get(), resultObj.get(), JS_UNDEFINED, JS_UNDEFINED));
+		ScopedJSString resultStr(ctx_.get(), JS_ToCString(ctx_.get(), resultJson.get()));
+		if (!resultStr)
+			throw std::runtime_error("ResultConversionError(EventScriptingContext::executeFunction)");
+
+		return std::string(resultStr.get());
+	});
+}
+
+nlohmann::json EventScriptingContext::executeFunction(const char *functionName, const nlohmann::json &eventObject)
+{
+	return ScriptingExecutor::runBlocking(runtime_->getExecutor(), [&]() -> nlohmann::json {
+		ScopedJSValue eventObj = jsonToJSValue(ctx_.get(), eventObject);
+		ScopedJSValue resultObj = callFunction(functionName, eventObj);
+		return jsValueToJson(ctx_.get(), resultObj.get());
+	});
+}
+
+ScopedJSValue EventScriptingContext::callFunction(const char *functionName, const ScopedJSValue &eventObj)
 {
 	ScopedJSValue func = getModuleProperty(functionName);
 	if (!JS_IsFunction(ctx_.get(), func.get()))
 		throw std::runtime_error("FunctionNotFoundError(EventScriptingContext::executeFunction)");
 
-	ScopedJSValue eventObj(ctx_.get(), JS_ParseJSON(ctx_.get(), eventObject, strlen(eventObject), "<eventObject>"));
-	if (std::optional<std::string> exception = eventObj.asExceptionString())
-		throw std::runtime_error("EventObjectParseError(EventScriptingContext::executeFunction):" +
-					 exception.value());
+	const auto startTime = std::chrono::steady_clock::now();
+	ScriptingRuntime::ExecutionBudgetScope budget(*runtime_);
+	try {
+		ScopedJSValue resultObj = invokeFunction(func, eventObj, budget);
+		if (JS_IsPromise(resultObj.get())) {
+			for (;;) {
+				runPendingJobs(budget);
+				if (JS_PromiseState(ctx_.get(), resultObj.get()) != JS_PROMISE_PENDING ||
+				    !hostJobs_->hasPendingJobs()) {
+					break;
+				}
+				flushLocalStorageIfStale();
+				hostJobs_->waitForCompletionBlocking();
+				hostJobs_->settleCompleted();
+			}
+			resultObj = takePromiseResult(resultObj);
+		}
+		abandonHostJobsBlocking();
+		flushLocalStorage();
+		recordEventHandlerProfile(functionName, std::chrono::steady_clock::now() - startTime, false);
+		return resultObj;
+	} catch (...) {
+		abandonHostJobsBlocking();
+		flushLocalStorage();
+		recordEventHandlerProfile(functionName, std::chrono::steady_clock::now() - startTime,
+					  budget.isExpired());
+		throw;
+	}
+}
+
+Async::Task<nlohmann::json> EventScriptingContext::executeFunctionTask(std::string functionName,
+								       nlohmann::json eventObject)
+{
+	ScriptingExecutor *const executor = runtime_->getExecutor();
+	co_await ScriptingExecutor::ScheduleAwaiter(executor);
 
+	ScopedJSValue func = getModuleProperty(functionName.c_str());
+	if (!JS_IsFunction(ctx_.get(), func.get()))
+		throw std::runtime_error("FunctionNotFoundError(EventScriptingContext::executeFunctionTask)");
+
+	const auto startTime = std::chrono::steady_clock::now();
+	const std::optional<std::chrono::steady_clock::time_point> deadline = runtime_->makeExecutionDeadline();
+
+	nlohmann::json result;
+	std::exception_ptr error;
+	try {
+		ScopedJSValue eventObj = jsonToJSValue(ctx_.get(), eventObject);
+		ScopedJSValue resultObj;
+		{
+			ScriptingRuntime::ExecutionBudgetScope budget(*runtime_, deadline);
+			resultObj = invokeFunction(func, eventObj, budget);
+			if (JS_IsPromise(resultObj.get())) {
+				runPendingJobs(budget);
+			}
+		}
+
+		// The budget is armed only while script code runs, not while this coroutine waits for host I/O.
+		while (JS_IsPromise(resultObj.get()) &&
+		       JS_PromiseState(ctx_.get(), resultObj.get()) == JS_PROMISE_PENDING &&
+		       hostJobs_->hasPendingJobs()) {
+			flushLocalStorageIfStale();
+			co_await hostJobs_->waitForCompletion();
+			// Host jobs complete on their own threads; come back before touching the runtime.
+			co_await ScriptingExecutor::ScheduleAwaiter(executor);
+
+			ScriptingRuntime::ExecutionBudgetScope budget(*runtime_, deadline);
+			hostJobs_->settleCompleted();
+			runPendingJobs(budget);
+		}
+
+		if (JS_IsPromise(resultObj.get())) {
+			resultObj = takePromiseResult(resultObj);
+		}
+		result = jsValueToJson(ctx_.get(), resultObj.get());
+	} catch (...) {
+		error = std::current_exception();
+	}
+
+	// Jobs still running own coroutine frames and curl handles, so they are waited for even on failure.
+	while (hostJobs_->hasPendingJobs()) {
+		co_await hostJobs_->waitForCompletion();
+		co_await ScriptingExecutor::ScheduleAwaiter(executor);
+		hostJobs_->abandonCompleted();
+	}
+	flushLocalStorage();
+
+	const bool budgetExceeded = error && deadline && std::chrono::steady_clock::now() >= *deadline;
+	recordEventHandlerProfile(functionName.c_str(), std::chrono::steady_clock::now() - startTime, budgetExceeded);
+
+	if (error) {
+		std::rethrow_exception(error);
+	}
+	co_return result;
+}
+
+ScopedJSValue EventScriptingContext::invokeFunction(const ScopedJSValue &func, const ScopedJSValue &eventObj,
+						    const ScriptingRuntime::ExecutionBudgetScope &budget)
+{
 	JSValue args[] = {eventObj.get()};
 	ScopedJSValue resultObj(ctx_.get(), JS_Call(ctx_.get(), func.get(), JS_UNDEFINED, 1, args));
 
+	if (JS_IsException(resultObj.get()) && budget.isExpired()) {
+		JS_FreeValue(ctx_.get(), JS_GetException(ctx_.get()));
+		logger_->error("ExecutionBudgetExceeded");
+		throw std::runtime_error("ExecutionBudgetExceededError(EventScriptingContext::executeFunction)");
+	}
+
 	if (std::optional<std::string> exception = resultObj.asExceptionString())
 		throw std::runtime_error("FunctionCallError(EventScriptingContext::executeFunction):" +
 					 exception.value());
 
-	if (JS_IsPromise(resultObj.get())) {
-		JSContext *pctx;
-		int err;
+	return resultObj;
+}
 
-		while ((err = JS_ExecutePendingJob(runtime_->rt_.get(), &pctx)) > 0) {
+void EventScriptingContext::runPendingJobs(const ScriptingRuntime::ExecutionBudgetScope &budget)
+{
+	JSContext *pctx;
+	int err;
+
+	while ((err = JS_ExecutePendingJob(runtime_->rt_.get(), &pctx)) > 0) {
+		if (budget.isExpired()) {
+			break;
 		}
+	}
 
-		if (err < 0) {
-			ScopedJSValue exception(ctx_.get(), JS_GetException(ctx_.get()));
-			ScopedJSString str(ctx_.get(), JS_ToCString(ctx_.get(), exception.get()));
-			if (str) {
-				logger_->error("PromiseExecutionError", {{"message", str.get()}});
-			} else {
-				logger_->error("PromiseExecutionError");
+	if (budget.isExpired()) {
+		// Drop whatever the handler left queued so it does not run on the next event. With the
+		// deadline passed, any job that still loops is interrupted as soon as QuickJS polls.
+		while (JS_IsJobPending(runtime_->rt_.get())) {
+			if (JS_ExecutePendingJob(runtime_->rt_.get(), &pctx) < 0) {
+				JS_FreeValue(pctx, JS_GetException(pctx));
 			}
-			throw std::runtime_error("PromiseExecutionError(EventScriptingContext::executeFunction)");
 		}
+		if (err < 0) {
+			JS_FreeValue(ctx_.get(), JS_GetException(ctx_.get()));
+		}
+		logger_->error("ExecutionBudgetExceeded");
+		throw std::runtime_error("ExecutionBudgetExceededError(EventScriptingContext::executeFunction)");
+	}
 
-		JSPromiseStateEnum promiseState = JS_PromiseState(ctx_.get(), resultObj.get());
-		if (promiseState == JS_PROMISE_FULFILLED) {
-			logger_->info("PromiseFulfilled");
-			ScopedJSValue resolvedObj(ctx_.get(), JS_PromiseResult(ctx_.get(), resultObj.get()));
-			ScopedJSValue resultJson(ctx_.get(), JS_JSONStringify(ctx_.get(), resolvedObj.get(),
-									      JS_UNDEFINED, JS_UNDEFINED));
-			ScopedJSString resultStr(ctx_.get(), JS_ToCString(ctx_.get(), resultJson.get()));
-			if (!resultStr)
-				throw std::runtime_error(
-					"ResultConversionError(EventScriptingContext::executeFunction)");
-
-			return std::string(resultStr.get());
-		} else if (promiseState == JS_PROMISE_REJECTED) {
-			ScopedJSValue rejectedObj(ctx_.get(), JS_PromiseResult(ctx_.get(), resultObj.get()));
-			ScopedJSString str(ctx_.get(), JS_ToCString(ctx_.get(), rejectedObj.get()));
-			if (str) {
-				logger_->error("PromiseRejected", {{"message", str.get()}});
-			} else {
-				logger_->error("PromiseRejected");
-			}
-			throw std::runtime_error("PromiseRejectedError(EventScriptingContext::executeFunction)");
+	if (err < 0) {
+		ScopedJSValue exception(ctx_.get(), JS_GetException(ctx_.get()));
+		ScopedJSString str(ctx_.get(), JS_ToCString(ctx_.get(), exception.get()));
+		if (str) {
+			logger_->error("PromiseExecutionError", {{"message", str.get()}});
+		} else {
+			logger_->error("PromiseExecutionError");
+		}
+		throw std::runtime_error("PromiseExecutionError(EventScriptingContext::executeFunction)");
+	}
+}
+
+ScopedJSValue EventScriptingContext::takePromiseResult(const ScopedJSValue &resultObj)
+{
+	JSPromiseStateEnum promiseState = JS_PromiseState(ctx_.get(), resultObj.get());
+	if (promiseState == JS_PROMISE_FULFILLED) {
+		logger_->info("PromiseFulfilled");
+		return ScopedJSValue(ctx_.get(), JS_PromiseResult(ctx_.get(), resultObj.get()));
+	} else if (promiseState == JS_PROMISE_REJECTED) {
+		ScopedJSValue rejectedObj(ctx_.get(), JS_PromiseResult(ctx_.get(), resultObj.get()));
+		ScopedJSString str(ctx_.get(), JS_ToCString(ctx_.get(), rejectedObj.get()));
+		if (str) {
+			logger_->error("PromiseRejected", {{"message", str.get()}});
 		} else {
-			logger_->error("PromisePending");
-			throw std::runtime_error("PromisePendingError(EventScriptingContext::executeFunction)");
+			logger_->error("PromiseRejected");
 		}
+		throw std::runtime_error("PromiseRejectedError(EventScriptingContext::executeFunction)");
 	} else {
-		ScopedJSValue resultJson(ctx_.get(),
-					 JS_JSONStringify(ctx_.get(), resultObj.get(), JS_UNDEFINED, JS_UNDEFINED));
-		ScopedJSString resultStr(ctx_.get(), JS_ToCString(ctx_.get(), resultJson.get()));
-		if (!resultStr)
-			throw std::runtime_error("ResultConversionError(EventScriptingContext::executeFunction)");
+		logger_->error("PromisePending");
+		throw std::runtime_error("PromisePendingError(EventScriptingContext::executeFunction)");
+	}
+}
 
-		return std::string(resultStr.get());
+void EventScriptingContext::abandonHostJobsBlocking()
+{
+	while (hostJobs_->hasPendingJobs()) {
+		hostJobs_->waitForCompletionBlocking();
+		hostJobs_->abandonCompleted();
 	}
 }
 
-void EventScriptingContext::loadModule(std::uint32_t size, const std::uint8_t *buf)
+void EventScriptingContext::recordEventHandlerProfile(const char *functionName, std::chrono::nanoseconds elapsed,
+						      bool budgetExceeded)
 {
-	std::shared_ptr<const Logger::ILogger> logger = logger_;
+	EventHandlerProfile &profile = eventHandlerProfiles_[functionName];
+	profile.callCount++;
+	if (budgetExceeded) {
+		profile.budgetExceededCount++;
+	}
+	profile.lastElapsed = elapsed;
+	profile.totalElapsed += elapsed;
+	profile.maxElapsed = std::max(profile.maxElapsed, elapsed);
+
+	Metrics::MetricsRegistry &metrics = Metrics::MetricsRegistry::global();
+	const Metrics::MetricLabels labels{{"function", functionName}};
+	metrics.histogram("script_handler_duration_seconds", "Duration of event handler calls.",
+			  Metrics::kDefaultDurationBuckets, labels)
+		.observe(elapsed);
+	if (budgetExceeded) {
+		metrics.counter("script_handler_budget_exceeded_total",
+				"Event handler calls stopped by the execution budget.", labels)
+			.inc();
+	}
 
-	ScopedJSValue moduleObj(ctx_.get(), JS_ReadObject(ctx_.get(), buf, size, JS_READ_OBJ_BYTECODE));
+	JSMemoryUsage usage;
+	JS_ComputeMemoryUsage(runtime_->rt_.get(), &usage);
+
+	using std::chrono::duration_cast;
+	using std::chrono::microseconds;
+	logger_->info("EventHandlerProfiled",
+		      {{"functionName", functionName},
+		       {"elapsedMicroseconds", std::to_string(duration_cast<microseconds>(elapsed).count())},
+		       {"maxMicroseconds", std::to_string(duration_cast<microseconds>(profile.maxElapsed).count())},
+		       {"callCount", std::to_string(profile.callCount)},
+		       {"budgetExceeded", budgetExceeded ? "true" : "false"},
+		       {"mallocSize", std::to_string(usage.malloc_size)},
+		       {"memoryUsedSize", std::to_string(usage.memory_used_size)},
+		       {"objCount", std::to_string(usage.obj_count)}});
+}
 
-	if (std::optional<std::string> exceptionString = moduleObj.asExceptionString()) {
-		logger->error("ReadObjectError", {{"message", exceptionString.value()}});
-		throw std::runtime_error("ReadObjectError(EventScriptingContext::loadModule)");
+// A failed flush keeps the writes in memory for the next one, so it is not an error of the handler.
+void EventScriptingContext::flushLocalStorage() noexcept
+{
+	if (localStorageDatabase_) {
+		localStorageDatabase_->flushLocalStorage();
 	}
+}
 
-	ScopedJSValue res(ctx_.get(), JS_EvalFunction(ctx_.get(), JS_DupValue(ctx_.get(), moduleObj.get())));
-
-	if (std::optional<std::string> exceptionString = res.asExceptionString()) {
-		logger->error("EvalError", {{"message", exceptionString.value()}});
-		throw std::runtime_error("EvalError(EventScriptingContext::loadModule)");
+void EventScriptingContext::flushLocalStorageIfStale() noexcept
+{
+	if (localStorageDatabase_) {
+		localStorageDatabase_->flushLocalStorageIfOlderThan(kLocalStorageFlushInterval);
 	}
 }
 
@@ -25,18 +25,36 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <filesystem>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 
+#include <nlohmann/json.hpp>
+
+#include <KaitoTokyo/Async/Task.hpp>
 #include <KaitoTokyo/Logger/ILogger.hpp>
 
 #include "ScriptingDatabase.hpp"
+#include "ScriptingHostJobQueue.hpp"
 #include "ScriptingRuntime.hpp"
 
 namespace KaitoTokyo::LiveStreamSegmenter::Scripting {
 
+/**
+ * Timings of one exported event handler function, accumulated over the life of its context.
+ */
+struct EventHandlerProfile {
+	std::uint64_t callCount = 0;
+	std::uint64_t budgetExceededCount = 0;
+	std::chrono::nanoseconds lastElapsed{0};
+	std::chrono::nanoseconds totalElapsed{0};
+	std::chrono::nanoseconds maxElapsed{0};
+};
+
 class EventScriptingContext {
 public:
 	EventScriptingContext(std::shared_ptr<ScriptingRuntime> runtime, std::shared_ptr<JSContext> ctx,
@@ -44,20 +62,93 @@ public:
 	~EventScriptingContext();
 
 	void setupContext();
-	void setupLocalStorage();
+
+	/**
+	 * Installs localStorage backed by database, which must outlive this context. Writes made by a handler
+	 * are flushed in one transaction when the call returns, and while it awaits host jobs once they have
+	 * been held in memory for a second.
+	 */
+	void setupLocalStorage(ScriptingDatabase &database);
 
 	void loadEventHandler(const char *script);
+
+	/**
+	 * Same as loadEventHandler(script), but reuses the compiled module stored at bytecodeCachePath when it
+	 * was written for the same source and QuickJS version. Otherwise the source is compiled and the cache
+	 * is rewritten. Failing to read or write the cache only costs the compilation.
+	 */
+	void loadEventHandler(const char *script, const std::filesystem::path &bytecodeCachePath);
 	ScopedJSValue getModuleProperty(const char *property) const;
+
+	/**
+	 * Whether the event handler exports a function of that name, for handlers that are optional. Runs on
+	 * the runtime's executor, if any, like executeFunction().
+	 */
+	bool hasFunction(const char *functionName) const;
+
+	/**
+	 * Calls an exported function and returns its settled result as JSON text. When the runtime has an
+	 * executor, the call runs there and the calling thread blocks until it returns.
+	 */
 	std::string executeFunction(const char *functionName, const char *eventObject);
 
+	/**
+	 * Same as executeFunction(functionName, eventObject) but converts the event object and the settled
+	 * result directly between nlohmann::json and JS values, without going through JSON text.
+	 */
+	nlohmann::json executeFunction(const char *functionName, const nlohmann::json &eventObject);
+
+	/**
+	 * Same as executeFunction(functionName, eventObject), but suspends instead of blocking while the handler
+	 * awaits host jobs such as fetch(). All script code runs on the runtime's executor when it has one, or
+	 * else on the thread that completes a job, so callers should hop back to their own executor afterwards.
+	 * The execution budget covers the script code only,
+	 * not the time spent waiting. The synchronous overloads block the calling thread for host jobs instead.
+	 */
+	Async::Task<nlohmann::json> executeFunctionTask(std::string functionName, nlohmann::json eventObject);
+
+	/**
+	 * Queue that host primitives installed in this context use to settle the promises they return.
+	 */
+	std::shared_ptr<ScriptingHostJobQueue> getHostJobQueue() const noexcept { return hostJobs_; }
+
+	/**
+	 * Per-function timings of the executeFunction() calls made so far, keyed by function name.
+	 * Each call also logs an EventHandlerProfiled entry with these timings and the runtime's heap usage.
+	 */
+	const std::unordered_map<std::string, EventHandlerProfile> &getEventHandlerProfiles() const noexcept
+	{
+		return eventHandlerProfiles_;
+	}
+
 private:
 	const std::shared_ptr<ScriptingRuntime> runtime_;
 	const std::shared_ptr<JSContext> ctx_;
 	const std::shared_ptr<const Logger::ILogger> logger_;
 
+	const std::shared_ptr<ScriptingHostJobQueue> hostJobs_;
+
 	ScopedJSValue eventHandlerNs_;
+	std::unordered_map<std::string, EventHandlerProfile> eventHandlerProfiles_;
+
+	ScriptingDatabase *localStorageDatabase_ = nullptr;
+
+	ScopedJSValue compileEventHandler(const char *script);
+	ScopedJSValue readEventHandlerBytecodeCache(std::string_view script, const std::filesystem::path &path);
+	void writeEventHandlerBytecodeCache(std::string_view script, const ScopedJSValue &moduleObj,
+					    const std::filesystem::path &path);
+	void evaluateEventHandler(const ScopedJSValue &moduleObj);
 
-	void loadModule(std::uint32_t size, const std::uint8_t *buf);
+	ScopedJSValue callFunction(const char *functionName, const ScopedJSValue &eventObj);
+	ScopedJSValue invokeFunction(const ScopedJSValue &func, const ScopedJSValue &eventObj,
+				     const ScriptingRuntime::ExecutionBudgetScope &budget);
+	void runPendingJobs(const ScriptingRuntime::ExecutionBudgetScope &budget);
+	ScopedJSValue takePromiseResult(const ScopedJSValue &resultObj);
+	void abandonHostJobsBlocking();
+	void flushLocalStorage() noexcept;
+	void flushLocalStorageIfStale() noexcept;
+	void recordEventHandlerProfile(const char *functionName, std::chrono::nanoseconds elapsed,
+				       bool budgetExceeded);
 };
 
 } // namespace KaitoTokyo::LiveStreamSegmenter::Scripting
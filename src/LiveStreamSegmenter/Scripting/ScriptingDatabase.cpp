@@ -25,7 +25,11 @@
 
 #include "ScriptingDatabase.hpp"
 
+#include <initializer_list>
 #include <iterator>
+#include <optional>
+#include <string>
+#include <vector>
 
 #include <sqlite3.h>
 #include <fmt/format.h>
@@ -67,11 +71,63 @@ sqlite3 *openSqlite3(const std::filesystem::path &dbPath, bool write)
 	return db;
 }
 
-struct SqliteStmtDeleter {
-	void operator()(sqlite3_stmt *stmt) const { sqlite3_finalize(stmt); }
-};
+// PRAGMA values cannot be bound, so only these literal modes are ever spliced into the SQL.
+bool isOneOf(const std::string &value, std::initializer_list<const char *> allowed)
+{
+	for (const char *candidate : allowed) {
+		if (sqlite3_stricmp(value.c_str(), candidate) == 0) {
+			return true;
+		}
+	}
+	return false;
+}
 
-using ScopedStmt = std::unique_ptr<sqlite3_stmt, SqliteStmtDeleter>;
+void execPragma(sqlite3 *db, const std::string &sql, std::shared_ptr<const Logger::ILogger> logger)
+{
+	std::string result;
+	const auto readFirstColumn = [](void *out, int columnCount, char **values, char **) -> int {
+		if (columnCount > 0 && values[0]) {
+			*static_cast<std::string *>(out) = values[0];
+		}
+		return 0;
+	};
+
+	char *errmsg = nullptr;
+	if (sqlite3_exec(db, sql.c_str(), readFirstColumn, &result, &errmsg) != SQLITE_OK) {
+		logger->warn("ScriptingDatabasePragmaError",
+			     {{"sql", sql}, {"message", errmsg ? errmsg : "(UNKNOWN)"}});
+		sqlite3_free(errmsg);
+		return;
+	}
+
+	logger->info("ScriptingDatabasePragmaApplied", {{"sql", sql}, {"result", result}});
+}
+
+void applyOptions(sqlite3 *db, const ScriptingDatabaseOptions &options, std::shared_ptr<const Logger::ILogger> logger)
+{
+	if (options.journalMode) {
+		if (!isOneOf(*options.journalMode, {"DELETE", "TRUNCATE", "PERSIST", "MEMORY", "WAL", "OFF"})) {
+			throw std::invalid_argument("InvalidJournalModeError(ScriptingDatabase::ScriptingDatabase)");
+		}
+		// Reports the mode actually in effect, e.g. "memory" for an in-memory database.
+		execPragma(db, "PRAGMA journal_mode=" + *options.journalMode + ";", logger);
+	}
+
+	if (options.synchronous) {
+		if (!isOneOf(*options.synchronous, {"OFF", "NORMAL", "FULL", "EXTRA"})) {
+			throw std::invalid_argument("InvalidSynchronousError(ScriptingDatabase::ScriptingDatabase)");
+		}
+		execPragma(db, "PRAGMA synchronous=" + *options.synchronous + ";", logger);
+	}
+
+	if (options.cacheSize) {
+		execPragma(db, "PRAGMA cache_size=" + std::to_string(*options.cacheSize) + ";", logger);
+	}
+
+	if (options.mmapSize) {
+		execPragma(db, "PRAGMA mmap_size=" + std::to_string(*options.mmapSize) + ";", logger);
+	}
+}
 
 const static JSClassDef kClassDef = {
 	.class_name = "ScriptingDatabase",
@@ -79,7 +135,10 @@ const static JSClassDef kClassDef = {
 
 const static JSCFunctionListEntry kClassFuncList[] = {
 	JS_CFUNC_DEF("execute", 1, ScriptingDatabase::execute),
+	JS_CFUNC_DEF("executeMany", 2, ScriptingDatabase::executeMany),
+	JS_CFUNC_DEF("iterate", 1, ScriptingDatabase::iterate),
 	JS_CFUNC_DEF("query", 1, ScriptingDatabase::query),
+	JS_CFUNC_DEF("transaction", 1, ScriptingDatabase::transaction),
 	JS_CFUNC_DEF("toString", 0, ScriptingDatabase::toString),
 };
 
@@ -91,70 +150,239 @@ ScriptingDatabase *unwrap(JSContext *ctx, JSValueConst this_val)
 	return reinterpret_cast<ScriptingDatabase *>(JS_GetOpaque(this_val, classId));
 }
 
+void bindValue(JSContext *ctx, sqlite3_stmt *stmt, int bindIdx, JSValueConst value)
+{
+	int tag = JS_VALUE_GET_TAG(value);
+
+	if (tag == JS_TAG_INT) {
+		int64_t val;
+
+		if (JS_ToInt64(ctx, &val, value) < 0)
+			throw std::runtime_error("Int64ConversionError(ScriptingDatabase::bindValue)");
+
+		sqlite3_bind_int64(stmt, bindIdx, val);
+	} else if (tag == JS_TAG_FLOAT64) {
+		double val;
+
+		if (JS_ToFloat64(ctx, &val, value) < 0)
+			throw std::runtime_error("Float64ConversionError(ScriptingDatabase::bindValue)");
+
+		sqlite3_bind_double(stmt, bindIdx, val);
+	} else if (tag == JS_TAG_STRING) {
+		ScopedJSString str(ctx, JS_ToCString(ctx, value));
+
+		if (!str)
+			throw std::runtime_error("StringConversionError(ScriptingDatabase::bindValue)");
+
+		sqlite3_bind_text(stmt, bindIdx, str.get(), -1, SQLITE_TRANSIENT);
+	} else if (tag == JS_TAG_BOOL) {
+		int val = JS_ToBool(ctx, value);
+
+		if (val < 0)
+			throw std::runtime_error("BoolConversionError(ScriptingDatabase::bindValue)");
+
+		sqlite3_bind_int(stmt, bindIdx, val);
+	} else if (JS_IsNull(value) || JS_IsUndefined(value)) {
+		sqlite3_bind_null(stmt, bindIdx);
+	} else {
+		std::size_t len;
+		std::uint8_t *buf = JS_GetArrayBuffer(ctx, &len, value);
+
+		if (!buf)
+			throw std::runtime_error("UnknownValueError(ScriptingDatabase::bindValue)");
+
+		sqlite3_bind_blob(stmt, bindIdx, buf, static_cast<int>(len), SQLITE_TRANSIENT);
+	}
+}
+
 void bindArgs(JSContext *ctx, sqlite3_stmt *stmt, int argc, JSValueConst *argv)
 {
 	for (int i = 1; i < argc; i++) {
-		int bindIdx = i;
-		int tag = JS_VALUE_GET_TAG(argv[i]);
+		bindValue(ctx, stmt, i, argv[i]);
+	}
+}
+
+// Binds the elements of a row array to the statement parameters in order.
+void bindRow(JSContext *ctx, sqlite3_stmt *stmt, JSValueConst row)
+{
+	if (!JS_IsArray(row))
+		throw std::runtime_error("RowNotArrayError(ScriptingDatabase::bindRow)");
+
+	std::int64_t length = 0;
+	if (JS_GetLength(ctx, row, &length) < 0)
+		throw std::runtime_error("RowLengthError(ScriptingDatabase::bindRow)");
+
+	for (std::int64_t i = 0; i < length; i++) {
+		ScopedJSValue value(ctx, JS_GetPropertyInt64(ctx, row, i));
+		if (JS_IsException(value.get()))
+			throw std::runtime_error("RowElementError(ScriptingDatabase::bindRow)");
 
-		if (tag == JS_TAG_INT) {
-			int64_t val;
+		bindValue(ctx, stmt, static_cast<int>(i + 1), value.get());
+	}
+}
 
-			if (JS_ToInt64(ctx, &val, argv[i]) < 0)
-				throw std::runtime_error("Int64ConversionError(ScriptingDatabase::bindArgs)");
+// Column name atoms, created once per statement instead of once per cell.
+class ColumnAtoms {
+public:
+	ColumnAtoms(JSContext *ctx, sqlite3_stmt *stmt) : rt_(JS_GetRuntime(ctx))
+	{
+		const int colCount = sqlite3_column_count(stmt);
+		atoms_.reserve(static_cast<std::size_t>(colCount));
+		for (int i = 0; i < colCount; i++) {
+			const char *colName = sqlite3_column_name(stmt, i);
+			if (!colName)
+				throw std::runtime_error("ColumnNameError(ScriptingDatabase::ColumnAtoms)");
+
+			const JSAtom atom = JS_NewAtom(ctx, colName);
+			if (atom == JS_ATOM_NULL)
+				throw std::runtime_error("ColumnAtomError(ScriptingDatabase::ColumnAtoms)");
+			atoms_.push_back(atom);
+		}
+	}
 
-			sqlite3_bind_int64(stmt, bindIdx, val);
-		} else if (tag == JS_TAG_FLOAT64) {
-			double val;
+	~ColumnAtoms() noexcept
+	{
+		for (JSAtom atom : atoms_) {
+			JS_FreeAtomRT(rt_, atom);
+		}
+	}
 
-			if (JS_ToFloat64(ctx, &val, argv[i]) < 0)
-				throw std::runtime_error("Float64ConversionError(ScriptingDatabase::bindArgs)");
+	ColumnAtoms(const ColumnAtoms &) = delete;
+	ColumnAtoms &operator=(const ColumnAtoms &) = delete;
 
-			sqlite3_bind_double(stmt, bindIdx, val);
-		} else if (tag == JS_TAG_STRING) {
-			ScopedJSString str(ctx, JS_ToCString(ctx, argv[i]));
+	const std::vector<JSAtom> &get() const noexcept { return atoms_; }
 
-			if (!str)
-				throw std::runtime_error("StringConversionError(ScriptingDatabase::bindArgs)");
+private:
+	JSRuntime *const rt_;
+	std::vector<JSAtom> atoms_;
+};
 
-			sqlite3_bind_text(stmt, bindIdx, str.get(), -1, SQLITE_TRANSIENT);
-		} else if (tag == JS_TAG_BOOL) {
-			int val = JS_ToBool(ctx, argv[i]);
+JSValue readColumn(JSContext *ctx, sqlite3_stmt *stmt, int i)
+{
+	switch (sqlite3_column_type(stmt, i)) {
+	case SQLITE_INTEGER:
+		return JS_NewInt64(ctx, sqlite3_column_int64(stmt, i));
+	case SQLITE_FLOAT:
+		return JS_NewFloat64(ctx, sqlite3_column_double(stmt, i));
+	case SQLITE_TEXT:
+		return JS_NewStringLen(ctx, reinterpret_cast<const char *>(sqlite3_column_text(stmt, i)),
+				       static_cast<std::size_t>(sqlite3_column_bytes(stmt, i)));
+	case SQLITE_BLOB: {
+		// The blob pointer is only valid until the next step or reset, so the bytes are copied once
+		// into the ArrayBuffer; lending them out would dangle as soon as the cursor moves.
+		const void *blob = sqlite3_column_blob(stmt, i);
+		const int size = sqlite3_column_bytes(stmt, i);
+		return JS_NewArrayBufferCopy(ctx, static_cast<const std::uint8_t *>(blob),
+					     static_cast<std::size_t>(size));
+	}
+	case SQLITE_NULL:
+	default:
+		return JS_NULL;
+	}
+}
 
-			if (val < 0)
-				throw std::runtime_error("BoolConversionError(ScriptingDatabase::bindArgs)");
+// Returns the current row as an object, or JS_EXCEPTION with a pending exception.
+JSValue readRow(JSContext *ctx, sqlite3_stmt *stmt, const ColumnAtoms &columnAtoms)
+{
+	JSValue rowObj = JS_NewObject(ctx);
+	if (JS_IsException(rowObj))
+		return rowObj;
+
+	const std::vector<JSAtom> &atoms = columnAtoms.get();
+	for (std::size_t i = 0; i < atoms.size(); i++) {
+		JSValue val = readColumn(ctx, stmt, static_cast<int>(i));
+		// A repeated column name keeps the last value, as JS_SetPropertyStr did.
+		if (JS_DefinePropertyValue(ctx, rowObj, atoms[i], val, JS_PROP_C_W_E) < 0) {
+			JS_FreeValue(ctx, rowObj);
+			return JS_EXCEPTION;
+		}
+	}
+	return rowObj;
+}
 
-			sqlite3_bind_int(stmt, bindIdx, val);
-		} else if (JS_IsNull(argv[i]) || JS_IsUndefined(argv[i])) {
-			sqlite3_bind_null(stmt, bindIdx);
-		} else {
-			std::size_t len;
-			std::uint8_t *buf = JS_GetArrayBuffer(ctx, &len, argv[i]);
+// A savepoint behaves like BEGIN outside a transaction and nests inside one, so scripts that
+// already manage their own transaction keep working.
+constexpr const char *kSavepointSql = "SAVEPOINT lss_batch;";
+constexpr const char *kReleaseSql = "RELEASE lss_batch;";
+constexpr const char *kRollbackSql = "ROLLBACK TO lss_batch; RELEASE lss_batch;";
 
-			if (!buf)
-				throw std::runtime_error("UnknownValueError(ScriptingDatabase::bindArgs)");
+} // anonymous namespace
 
-			sqlite3_bind_blob(stmt, bindIdx, buf, static_cast<int>(len), SQLITE_TRANSIENT);
+struct ScriptingDatabase::Cursor {
+	ScriptingDatabase *owner;
+	ScriptingStatementCache::Lease stmt;
+	std::optional<ColumnAtoms> columnAtoms;
+
+	// Idempotent; afterwards the cursor only reports done.
+	void close() noexcept
+	{
+		if (owner) {
+			owner->cursors_.erase(this);
+			owner = nullptr;
 		}
+		stmt = ScriptingStatementCache::Lease();
+		columnAtoms.reset();
 	}
+};
+
+namespace {
+
+const static JSClassDef kCursorClassDef = {
+	.class_name = "ScriptingDatabaseCursor",
+	.finalizer = ScriptingDatabase::cursorFinalizer,
+};
+
+const static JSCFunctionListEntry kCursorFuncList[] = {
+	JS_CFUNC_DEF("next", 0, ScriptingDatabase::cursorNext),
+	JS_CFUNC_DEF("return", 0, ScriptingDatabase::cursorClose),
+	JS_CFUNC_DEF("close", 0, ScriptingDatabase::cursorClose),
+	JS_CFUNC_DEF("[Symbol.iterator]", 0, ScriptingDatabase::cursorIterator),
+};
+
+JSValue newIteratorResult(JSContext *ctx, JSValue value, bool done)
+{
+	JSValue resultObj = JS_NewObject(ctx);
+	JS_SetPropertyStr(ctx, resultObj, "value", value);
+	JS_SetPropertyStr(ctx, resultObj, "done", JS_NewBool(ctx, done));
+	return resultObj;
 }
 
 } // anonymous namespace
 
 ScriptingDatabase::ScriptingDatabase(std::shared_ptr<ScriptingRuntime> runtime, std::shared_ptr<JSContext> ctx,
 				     std::shared_ptr<const Logger::ILogger> logger, const std::filesystem::path &dbPath,
-				     bool write)
+				     bool write, const ScriptingDatabaseOptions &options)
 	: runtime_(runtime ? std::move(runtime)
 			   : throw std::invalid_argument("RuntimeNullError(ScriptingDatabase::ScriptingDatabase)")),
 	  ctx_(ctx ? std::move(ctx)
 		   : throw std::invalid_argument("ContextNullError(ScriptingDatabase::ScriptingDatabase)")),
 	  logger_(logger ? std::move(logger)
 			 : throw std::invalid_argument("LoggerNullError(ScriptingDatabase::ScriptingDatabase)")),
-	  db_(openSqlite3(dbPath, write), sqlite3_close_v2)
+	  db_(openSqlite3(dbPath, write), sqlite3_close_v2),
+	  statementCache_(db_.get())
 {
+	if (write) {
+		applyOptions(db_.get(), options, logger_);
+	}
 }
 
-ScriptingDatabase::~ScriptingDatabase() = default;
+ScriptingDatabase::~ScriptingDatabase()
+{
+	// Flushed first, so its statements are counted below.
+	localStorage_.reset();
+
+	// The JS objects may outlive us; they see a closed cursor from now on.
+	while (!cursors_.empty()) {
+		(*cursors_.begin())->close();
+	}
+
+	const ScriptingStatementCache::Stats stats = statementCache_.getStats();
+	if (stats.hits + stats.misses > 0) {
+		logger_->info("ScriptingStatementCacheStats", {{"hits", std::to_string(stats.hits)},
+							     {"misses", std::to_string(stats.misses)},
+							     {"evictions", std::to_string(stats.evictions)}});
+	}
+}
 
 void ScriptingDatabase::setupContext()
 {
@@ -165,11 +393,22 @@ void ScriptingDatabase::setupContext()
 
 	JS_SetPropertyFunctionList(ctx_.get(), dbObj, kClassFuncList, std::size(kClassFuncList));
 
+	JSClassID cursorClassId = runtime_->registerCustomClass<Cursor>(&kCursorClassDef);
+	JSValue cursorProto = JS_NewObject(ctx_.get());
+	JS_SetPropertyFunctionList(ctx_.get(), cursorProto, kCursorFuncList, std::size(kCursorFuncList));
+	JS_SetClassProto(ctx_.get(), cursorClassId, cursorProto);
+
 	JSValue globalObj = JS_GetGlobalObject(ctx_.get());
 	JS_SetPropertyStr(ctx_.get(), globalObj, "db", dbObj);
 	JS_FreeValue(ctx_.get(), globalObj);
 }
 
+void ScriptingDatabase::setupLocalStorage()
+{
+	localStorage_ = std::make_unique<ScriptingLocalStorage>(runtime_, ctx_, logger_, db_.get(), statementCache_);
+	localStorage_->setupContext();
+}
+
 JSValue ScriptingDatabase::query(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv)
 {
 	if (argc < 1)
@@ -183,61 +422,35 @@ JSValue ScriptingDatabase::query(JSContext *ctx, JSValueConst this_val, int argc
 	if (!sqlStr)
 		return JS_ThrowInternalError(ctx, "SQL string conversion failed");
 
-	sqlite3_stmt *stmtRaw = nullptr;
-	int rc = sqlite3_prepare_v3(self->db_.get(), sqlStr.get(), -1, 0, &stmtRaw, nullptr);
-
-	if (rc != SQLITE_OK) {
+	ScriptingStatementCache::Lease stmt = self->statementCache_.acquire(sqlStr.get());
+	if (!stmt) {
 		return JS_ThrowInternalError(ctx, "SQL Error: %s", sqlite3_errmsg(self->db_.get()));
 	}
 
-	ScopedStmt stmt(stmtRaw);
-
 	try {
 		bindArgs(ctx, stmt.get(), argc, argv);
 	} catch (const std::exception &e) {
 		return JS_ThrowTypeError(ctx, "BindArgsError: %s", e.what());
 	}
 
+	std::optional<ColumnAtoms> columnAtoms;
+	try {
+		columnAtoms.emplace(ctx, stmt.get());
+	} catch (const std::exception &e) {
+		return JS_ThrowInternalError(ctx, "SQL Error: %s", e.what());
+	}
+
 	JSValue resultArr = JS_NewArray(ctx);
-	int rowIdx = 0;
+	std::uint32_t rowIdx = 0;
+	int rc;
 
 	while ((rc = sqlite3_step(stmt.get())) == SQLITE_ROW) {
-		JSValue rowObj = JS_NewObject(ctx);
-		int colCount = sqlite3_column_count(stmt.get());
-
-		for (int i = 0; i < colCount; i++) {
-			const char *colName = sqlite3_column_name(stmt.get(), i);
-			int colType = sqlite3_column_type(stmt.get(), i);
-			JSValue val;
-
-			switch (colType) {
-			case SQLITE_INTEGER:
-				val = JS_NewInt64(ctx, sqlite3_column_int64(stmt.get(), i));
-				break;
-			case SQLITE_FLOAT:
-				val = JS_NewFloat64(ctx, sqlite3_column_double(stmt.get(), i));
-				break;
-			case SQLITE_TEXT:
-				val = JS_NewString(ctx,
-						   reinterpret_cast<const char *>(sqlite3_column_text(stmt.get(), i)));
-				break;
-			case SQLITE_NULL:
-				val = JS_NULL;
-				break;
-			default:
-				val = JS_NULL;
-				break;
-			}
-
-			if (!colName) {
-				JS_FreeValue(ctx, val);
-				JS_FreeValue(ctx, rowObj);
-				JS_FreeValue(ctx, resultArr);
-				return JS_ThrowInternalError(ctx, "SQL Error: failed to get column name");
-			}
-			JS_SetPropertyStr(ctx, rowObj, colName, val);
+		JSValue rowObj = readRow(ctx, stmt.get(), *columnAtoms);
+		if (JS_IsException(rowObj)) {
+			JS_FreeValue(ctx, resultArr);
+			return rowObj;
 		}
-		JS_SetPropertyUint32(ctx, resultArr, rowIdx++, rowObj);
+		JS_DefinePropertyValueUint32(ctx, resultArr, rowIdx++, rowObj, JS_PROP_C_W_E);
 	}
 
 	if (rc != SQLITE_DONE) {
@@ -248,7 +461,7 @@ JSValue ScriptingDatabase::query(JSContext *ctx, JSValueConst this_val, int argc
 	return resultArr;
 }
 
-JSValue ScriptingDatabase::execute(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv)
+JSValue ScriptingDatabase::iterate(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv)
 {
 	if (argc < 1)
 		return JS_ThrowTypeError(ctx, "SQL string required");
@@ -261,14 +474,112 @@ JSValue ScriptingDatabase::execute(JSContext *ctx, JSValueConst this_val, int ar
 	if (!sqlStr)
 		return JS_ThrowInternalError(ctx, "SQL string conversion failed");
 
-	sqlite3_stmt *stmtRaw = nullptr;
-	int rc = sqlite3_prepare_v3(self->db_.get(), sqlStr.get(), -1, 0, &stmtRaw, nullptr);
-
-	if (rc != SQLITE_OK) {
+	auto cursor = std::make_unique<Cursor>();
+	cursor->stmt = self->statementCache_.acquire(sqlStr.get());
+	if (!cursor->stmt) {
 		return JS_ThrowInternalError(ctx, "SQL Error: %s", sqlite3_errmsg(self->db_.get()));
 	}
 
-	ScopedStmt stmt(stmtRaw);
+	try {
+		bindArgs(ctx, cursor->stmt.get(), argc, argv);
+	} catch (const std::exception &e) {
+		return JS_ThrowTypeError(ctx, "BindArgsError: %s", e.what());
+	}
+
+	try {
+		cursor->columnAtoms.emplace(ctx, cursor->stmt.get());
+	} catch (const std::exception &e) {
+		return JS_ThrowInternalError(ctx, "SQL Error: %s", e.what());
+	}
+
+	const JSClassID cursorClassId = self->runtime_->getClassId<Cursor>();
+	JSValue cursorObj = JS_NewObjectClass(ctx, static_cast<int>(cursorClassId));
+	if (JS_IsException(cursorObj))
+		return cursorObj;
+
+	cursor->owner = self;
+	self->cursors_.insert(cursor.get());
+	JS_SetOpaque(cursorObj, cursor.release());
+
+	return cursorObj;
+}
+
+JSValue ScriptingDatabase::cursorNext(JSContext *ctx, JSValueConst this_val, int, JSValueConst *)
+{
+	JSRuntime *rt = JS_GetRuntime(ctx);
+	auto runtime = static_cast<ScriptingRuntime *>(JS_GetRuntimeOpaque(rt));
+	auto *cursor = static_cast<Cursor *>(JS_GetOpaque(this_val, runtime->getClassId<Cursor>()));
+	if (!cursor)
+		return JS_ThrowTypeError(ctx, "Invalid cursor object");
+
+	if (!cursor->stmt)
+		return newIteratorResult(ctx, JS_UNDEFINED, true);
+
+	sqlite3_stmt *stmt = cursor->stmt.get();
+	const int rc = sqlite3_step(stmt);
+
+	if (rc == SQLITE_ROW) {
+		JSValue rowObj = readRow(ctx, stmt, *cursor->columnAtoms);
+		if (JS_IsException(rowObj))
+			return rowObj;
+		return newIteratorResult(ctx, rowObj, false);
+	}
+
+	if (rc != SQLITE_DONE) {
+		JSValue error =
+			JS_ThrowInternalError(ctx, "Execution Error: %s", sqlite3_errmsg(sqlite3_db_handle(stmt)));
+		cursor->close();
+		return error;
+	}
+
+	cursor->close();
+	return newIteratorResult(ctx, JS_UNDEFINED, true);
+}
+
+JSValue ScriptingDatabase::cursorClose(JSContext *ctx, JSValueConst this_val, int, JSValueConst *)
+{
+	JSRuntime *rt = JS_GetRuntime(ctx);
+	auto runtime = static_cast<ScriptingRuntime *>(JS_GetRuntimeOpaque(rt));
+	auto *cursor = static_cast<Cursor *>(JS_GetOpaque(this_val, runtime->getClassId<Cursor>()));
+	if (!cursor)
+		return JS_ThrowTypeError(ctx, "Invalid cursor object");
+
+	cursor->close();
+	return newIteratorResult(ctx, JS_UNDEFINED, true);
+}
+
+JSValue ScriptingDatabase::cursorIterator(JSContext *ctx, JSValueConst this_val, int, JSValueConst *)
+{
+	return JS_DupValue(ctx, this_val);
+}
+
+void ScriptingDatabase::cursorFinalizer(JSRuntime *rt, JSValue val)
+{
+	auto runtime = static_cast<ScriptingRuntime *>(JS_GetRuntimeOpaque(rt));
+	auto *cursor = static_cast<Cursor *>(JS_GetOpaque(val, runtime->getClassId<Cursor>()));
+	if (cursor) {
+		cursor->close();
+		delete cursor;
+	}
+}
+
+JSValue ScriptingDatabase::execute(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv)
+{
+	if (argc < 1)
+		return JS_ThrowTypeError(ctx, "SQL string required");
+
+	ScriptingDatabase *self = unwrap(ctx, this_val);
+	if (!self)
+		return JS_ThrowInternalError(ctx, "Invalid database object");
+
+	ScopedJSString sqlStr(ctx, JS_ToCString(ctx, argv[0]));
+	if (!sqlStr)
+		return JS_ThrowInternalError(ctx, "SQL string conversion failed");
+
+	ScriptingStatementCache::Lease stmt = self->statementCache_.acquire(sqlStr.get());
+	if (!stmt) {
+		return JS_ThrowInternalError(ctx, "SQL Error: %s", sqlite3_errmsg(self->db_.get()));
+	}
 
 	try {
 		bindArgs(ctx, stmt.get(), argc, argv);
@@ -276,7 +587,7 @@ JSValue ScriptingDatabase::execute(JSContext *ctx, JSValueConst this_val, int ar
 		return JS_ThrowTypeError(ctx, "BindArgsError: %s", e.what());
 	}
 
-	rc = sqlite3_step(stmt.get());
+	const int rc = sqlite3_step(stmt.get());
 
 	if (rc != SQLITE_DONE && rc != SQLITE_ROW) {
 		return JS_ThrowInternalError(ctx, "Execute Error: %s", sqlite3_errmsg(self->db_.get()));
@@ -290,6 +601,118 @@ JSValue ScriptingDatabase::execute(JSContext *ctx, JSValueConst this_val, int ar
 	return resultObj;
 }
 
+JSValue ScriptingDatabase::executeMany(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv)
+{
+	if (argc < 2)
+		return JS_ThrowTypeError(ctx, "SQL string and rows array required");
+
+	ScriptingDatabase *self = unwrap(ctx, this_val);
+	if (!self)
+		return JS_ThrowInternalError(ctx, "Invalid database object");
+
+	ScopedJSString sqlStr(ctx, JS_ToCString(ctx, argv[0]));
+	if (!sqlStr)
+		return JS_ThrowInternalError(ctx, "SQL string conversion failed");
+
+	if (!JS_IsArray(argv[1]))
+		return JS_ThrowTypeError(ctx, "Rows must be an array");
+
+	std::int64_t rowCount = 0;
+	if (JS_GetLength(ctx, argv[1], &rowCount) < 0)
+		return JS_EXCEPTION;
+
+	sqlite3 *db = self->db_.get();
+
+	ScriptingStatementCache::Lease stmt = self->statementCache_.acquire(sqlStr.get());
+	if (!stmt) {
+		return JS_ThrowInternalError(ctx, "SQL Error: %s", sqlite3_errmsg(db));
+	}
+
+	if (sqlite3_exec(db, kSavepointSql, nullptr, nullptr, nullptr) != SQLITE_OK) {
+		return JS_ThrowInternalError(ctx, "Transaction Error: %s", sqlite3_errmsg(db));
+	}
+
+	std::int64_t changes = 0;
+	for (std::int64_t i = 0; i < rowCount; i++) {
+		ScopedJSValue row(ctx, JS_GetPropertyInt64(ctx, argv[1], i));
+
+		try {
+			if (JS_IsException(row.get()))
+				throw std::runtime_error("RowReadError(ScriptingDatabase::executeMany)");
+			bindRow(ctx, stmt.get(), row.get());
+		} catch (const std::exception &e) {
+			sqlite3_reset(stmt.get());
+			sqlite3_exec(db, kRollbackSql, nullptr, nullptr, nullptr);
+			return JS_ThrowTypeError(ctx, "BindArgsError at row %lld: %s", static_cast<long long>(i),
+						 e.what());
+		}
+
+		const int rc = sqlite3_step(stmt.get());
+		if (rc != SQLITE_DONE && rc != SQLITE_ROW) {
+			// Formatted before the rollback replaces the error message.
+			JSValue error = JS_ThrowInternalError(ctx, "Execute Error at row %lld: %s",
+							      static_cast<long long>(i), sqlite3_errmsg(db));
+			sqlite3_reset(stmt.get());
+			sqlite3_exec(db, kRollbackSql, nullptr, nullptr, nullptr);
+			return error;
+		}
+
+		changes += sqlite3_changes(db);
+		sqlite3_reset(stmt.get());
+		sqlite3_clear_bindings(stmt.get());
+	}
+
+	if (sqlite3_exec(db, kReleaseSql, nullptr, nullptr, nullptr) != SQLITE_OK) {
+		JSValue error = JS_ThrowInternalError(ctx, "Commit Error: %s", sqlite3_errmsg(db));
+		sqlite3_exec(db, kRollbackSql, nullptr, nullptr, nullptr);
+		return error;
+	}
+
+	JSValue resultObj = JS_NewObject(ctx);
+	JS_SetPropertyStr(ctx, resultObj, "changes", JS_NewInt64(ctx, changes));
+	JS_SetPropertyStr(ctx, resultObj, "lastInsertId", JS_NewInt64(ctx, sqlite3_last_insert_rowid(db)));
+
+	return resultObj;
+}
+
+JSValue ScriptingDatabase::transaction(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv)
+{
+	if (argc < 1 || !JS_IsFunction(ctx, argv[0]))
+		return JS_ThrowTypeError(ctx, "Transaction function required");
+
+	ScriptingDatabase *self = unwrap(ctx, this_val);
+	if (!self)
+		return JS_ThrowInternalError(ctx, "Invalid database object");
+
+	sqlite3 *db = self->db_.get();
+
+	if (sqlite3_exec(db, kSavepointSql, nullptr, nullptr, nullptr) != SQLITE_OK) {
+		return JS_ThrowInternalError(ctx, "Transaction Error: %s", sqlite3_errmsg(db));
+	}
+
+	JSValue result = JS_Call(ctx, argv[0], JS_UNDEFINED, 0, nullptr);
+
+	if (JS_IsException(result)) {
+		sqlite3_exec(db, kRollbackSql, nullptr, nullptr, nullptr);
+		return result;
+	}
+
+	if (JS_IsPromise(result)) {
+		JS_FreeValue(ctx, result);
+		sqlite3_exec(db, kRollbackSql, nullptr, nullptr, nullptr);
+		return JS_ThrowTypeError(ctx, "Transaction function must not be async");
+	}
+
+	if (sqlite3_exec(db, kReleaseSql, nullptr, nullptr, nullptr) != SQLITE_OK) {
+		JS_FreeValue(ctx, result);
+		JSValue error = JS_ThrowInternalError(ctx, "Commit Error: %s", sqlite3_errmsg(db));
+		sqlite3_exec(db, kRollbackSql, nullptr, nullptr, nullptr);
+		return error;
+	}
+
+	return result;
+}
+
 JSValue ScriptingDatabase::toString(JSContext *ctx, JSValueConst, int, JSValueConst *)
 {
 	return JS_NewString(ctx, "[object ScriptingDatabase]");
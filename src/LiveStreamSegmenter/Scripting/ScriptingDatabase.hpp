@@ -25,35 +25,121 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <filesystem>
 #include <memory>
+#include <optional>
+#include <string>
+#include <unordered_set>
 
 #include <quickjs.h>
 #include <sqlite3.h>
 
+#include "ScriptingLocalStorage.hpp"
 #include "ScriptingRuntime.hpp"
+#include "ScriptingStatementCache.hpp"
 
 namespace KaitoTokyo::LiveStreamSegmenter::Scripting {
 
+/**
+ * Connection PRAGMAs applied when a ScriptingDatabase opens for writing. Unset fields keep the
+ * SQLite defaults. Unknown journal or synchronous modes are rejected with std::invalid_argument.
+ */
+struct ScriptingDatabaseOptions {
+	// DELETE, TRUNCATE, PERSIST, MEMORY, WAL or OFF.
+	std::optional<std::string> journalMode;
+	// OFF, NORMAL, FULL or EXTRA.
+	std::optional<std::string> synchronous;
+	// PRAGMA cache_size; a negative value is a size in KiB, a positive one a number of pages.
+	std::optional<std::int64_t> cacheSize;
+	// PRAGMA mmap_size in bytes; 0 disables memory-mapped I/O.
+	std::optional<std::int64_t> mmapSize;
+};
+
 class ScriptingDatabase {
 public:
 	ScriptingDatabase(std::shared_ptr<ScriptingRuntime> runtime, std::shared_ptr<JSContext> ctx,
 			  std::shared_ptr<const Logger::ILogger> logger, const std::filesystem::path &dbPath,
-			  bool write);
+			  bool write, const ScriptingDatabaseOptions &options = {});
 	~ScriptingDatabase();
 
 	void setupContext();
 
+	/**
+	 * Installs globalThis.localStorage on top of this connection. See ScriptingLocalStorage for when
+	 * writes reach SQLite; call flushLocalStorage() once a script has finished running.
+	 */
+	void setupLocalStorage();
+
+	/**
+	 * Writes what localStorage still holds in memory. Returns true when there is nothing to write or no
+	 * localStorage was set up.
+	 */
+	bool flushLocalStorage() noexcept { return localStorage_ ? localStorage_->flush() : true; }
+
+	bool flushLocalStorageIfOlderThan(std::chrono::steady_clock::duration maxAge) noexcept
+	{
+		return localStorage_ ? localStorage_->flushIfOlderThan(maxAge) : true;
+	}
+
+	/**
+	 * Makes localStorage read the table again if another connection has written to it since.
+	 */
+	void revalidateLocalStorage() noexcept
+	{
+		if (localStorage_) {
+			localStorage_->revalidate();
+		}
+	}
+
+	ScriptingStatementCache::Stats getStatementCacheStats() const noexcept { return statementCache_.getStats(); }
+
 	static JSValue query(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv);
+
+	/**
+	 * db.iterate(sql, ...args): returns an iterator that steps the statement one row per next(),
+	 * so only the current row lives in the QuickJS heap. The statement is released when the
+	 * iterator is exhausted, on close()/return(), when it is collected, or with the database.
+	 */
+	static JSValue iterate(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv);
 	static JSValue execute(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv);
+
+	/**
+	 * db.executeMany(sql, rows): runs sql once per element of rows, binding each row array as its
+	 * parameters, with a single prepare and inside one savepoint. Any failure rolls back every row.
+	 */
+	static JSValue executeMany(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv);
+
+	/**
+	 * db.transaction(fn): calls fn inside a savepoint, commits when it returns and rolls back when
+	 * it throws. fn must be synchronous; a returned promise is rolled back and rejected.
+	 */
+	static JSValue transaction(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv);
 	static JSValue toString(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv);
 
+	static JSValue cursorNext(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv);
+	static JSValue cursorClose(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv);
+	static JSValue cursorIterator(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv);
+	static void cursorFinalizer(JSRuntime *rt, JSValue val);
+
 private:
+	struct Cursor;
+
 	const std::shared_ptr<ScriptingRuntime> runtime_;
 	const std::shared_ptr<JSContext> ctx_;
 	const std::shared_ptr<const Logger::ILogger> logger_;
 
 	const std::unique_ptr<sqlite3, decltype(&sqlite3_close_v2)> db_;
+
+	// Declared after db_ so that the statements are finalized before the connection closes.
+	ScriptingStatementCache statementCache_;
+
+	// Cursors still open in JS; closed by the destructor, since JS may keep them past the database.
+	std::unordered_set<Cursor *> cursors_;
+
+	// Declared after statementCache_, as it writes through the cache when destroyed.
+	std::unique_ptr<ScriptingLocalStorage> localStorage_;
 };
 
 } // namespace KaitoTokyo::LiveStreamSegmenter::Scripting
@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * Live Stream Segmenter - Scripting Module
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ScriptingExecutor.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+
+namespace KaitoTokyo::LiveStreamSegmenter::Scripting {
+
+struct ScriptingExecutor::State {
+	std::mutex mutex;
+	std::condition_variable condition;
+	std::deque<std::function<void()>> jobs;
+	bool stopping = false;
+};
+
+ScriptingExecutor::ScriptingExecutor()
+	: state_(std::make_shared<State>()),
+	  thread_([state = state_]() { runJobs(*state); }),
+	  threadId_(thread_.get_id())
+{
+}
+
+ScriptingExecutor::~ScriptingExecutor() noexcept
+{
+	{
+		std::scoped_lock lock(state_->mutex);
+		state_->stopping = true;
+	}
+	state_->condition.notify_all();
+
+	if (isCurrentThread()) {
+		// A job dropped the last owner; the thread drains the queue and exits on its own.
+		thread_.detach();
+	} else {
+		thread_.join();
+	}
+}
+
+void ScriptingExecutor::post(std::function<void()> job)
+{
+	{
+		std::scoped_lock lock(state_->mutex);
+		if (state_->stopping) {
+			throw std::runtime_error("ExecutorStoppingError(ScriptingExecutor::post)");
+		}
+		state_->jobs.push_back(std::move(job));
+	}
+	state_->condition.notify_one();
+}
+
+void ScriptingExecutor::runJobs(State &state) noexcept
+{
+	for (;;) {
+		std::function<void()> job;
+		{
+			std::unique_lock lock(state.mutex);
+			state.condition.wait(lock, [&state]() { return state.stopping || !state.jobs.empty(); });
+			if (state.jobs.empty()) {
+				return;
+			}
+			job = std::move(state.jobs.front());
+			state.jobs.pop_front();
+		}
+		job();
+	}
+}
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Scripting
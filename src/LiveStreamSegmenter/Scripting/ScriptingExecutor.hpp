@@ -0,0 +1,133 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * Live Stream Segmenter - Scripting Module
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <coroutine>
+#include <functional>
+#include <future>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include <KaitoTokyo/Async/Task.hpp>
+
+namespace KaitoTokyo::LiveStreamSegmenter::Scripting {
+
+/**
+ * One pinned thread that owns a ScriptingRuntime, fed by a FIFO job queue.
+ *
+ * QuickJS does not allow a runtime to be used concurrently, so everything that drives scripts hops onto
+ * this thread first, either by awaiting schedule() or run(), or by blocking in runBlocking(). Awaiting
+ * coroutines are resumed on the executor thread; hop to another executor before doing blocking work, as
+ * everything resumed there delays the other scripts.
+ *
+ * Jobs queued before destruction still run. Jobs must not throw.
+ */
+class ScriptingExecutor {
+public:
+	class ScheduleAwaiter {
+	public:
+		/**
+		 * A null executor, or awaiting from the executor thread itself, continues inline.
+		 */
+		explicit ScheduleAwaiter(ScriptingExecutor *executor) noexcept : executor_(executor) {}
+
+		bool await_ready() const noexcept { return !executor_ || executor_->isCurrentThread(); }
+
+		void await_suspend(std::coroutine_handle<> handle)
+		{
+			executor_->post([handle]() { handle.resume(); });
+		}
+
+		void await_resume() const noexcept {}
+
+	private:
+		ScriptingExecutor *const executor_;
+	};
+
+	ScriptingExecutor();
+	~ScriptingExecutor() noexcept;
+
+	ScriptingExecutor(const ScriptingExecutor &) = delete;
+	ScriptingExecutor &operator=(const ScriptingExecutor &) = delete;
+	ScriptingExecutor(ScriptingExecutor &&) = delete;
+	ScriptingExecutor &operator=(ScriptingExecutor &&) = delete;
+
+	/**
+	 * Returns an awaitable that continues the coroutine on the executor thread.
+	 */
+	[[nodiscard]]
+	ScheduleAwaiter schedule() noexcept
+	{
+		return ScheduleAwaiter(this);
+	}
+
+	/**
+	 * Calls f on the executor thread and yields its result. The awaiting coroutine resumes on the executor
+	 * thread. A null executor calls f inline.
+	 */
+	template<typename F> static Async::Task<std::invoke_result_t<F &>> run(ScriptingExecutor *executor, F f)
+	{
+		co_await ScheduleAwaiter(executor);
+		co_return f();
+	}
+
+	/**
+	 * Calls f on the executor thread and blocks until it returns, rethrowing what it throws.
+	 * A null executor, or a call from the executor thread itself, calls f inline.
+	 */
+	template<typename F> static std::invoke_result_t<F &> runBlocking(ScriptingExecutor *executor, F f)
+	{
+		if (!executor || executor->isCurrentThread()) {
+			return f();
+		}
+
+		std::packaged_task<std::invoke_result_t<F &>()> task(std::move(f));
+		std::future<std::invoke_result_t<F &>> future = task.get_future();
+		executor->post([&task]() { task(); });
+		return future.get();
+	}
+
+	/**
+	 * Queues job to run on the executor thread. Throws once the executor is being destroyed.
+	 */
+	void post(std::function<void()> job);
+
+	bool isCurrentThread() const noexcept { return std::this_thread::get_id() == threadId_; }
+
+private:
+	struct State;
+
+	static void runJobs(State &state) noexcept;
+
+	// Shared with the thread, which outlives the executor if the executor is destroyed by one of its jobs.
+	const std::shared_ptr<State> state_;
+	std::thread thread_;
+	const std::thread::id threadId_;
+};
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Scripting
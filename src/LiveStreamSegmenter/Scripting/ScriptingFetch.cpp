@@ -0,0 +1,282 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * Live Stream Segmenter - Scripting Module
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ScriptingFetch.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include <KaitoTokyo/Async/Task.hpp>
+#include <KaitoTokyo/CurlHelper/CurlSlistHandle.hpp>
+#include <KaitoTokyo/CurlHelper/CurlWriteCallback.hpp>
+
+#include "ScriptingJson.hpp"
+
+namespace KaitoTokyo::LiveStreamSegmenter::Scripting {
+
+namespace {
+
+const static JSClassDef kClassDef = {
+	.class_name = "ScriptingFetch",
+};
+
+struct FetchRequest {
+	std::string url;
+	std::string method = "GET";
+	std::vector<std::string> headers;
+	std::optional<std::string> body;
+};
+
+FetchRequest parseFetchRequest(JSContext *ctx, int argc, JSValueConst *argv)
+{
+	FetchRequest request;
+
+	ScopedJSString url(ctx, JS_ToCString(ctx, argv[0]));
+	if (!url) {
+		throw std::invalid_argument("URL must be a string");
+	}
+	request.url = url.get();
+
+	if (argc < 2 || JS_IsUndefined(argv[1]) || JS_IsNull(argv[1])) {
+		return request;
+	}
+
+	const nlohmann::json init = jsValueToJson(ctx, argv[1]);
+	if (!init.is_object()) {
+		throw std::invalid_argument("init must be an object");
+	}
+	if (init.contains("method")) {
+		init.at("method").get_to(request.method);
+	}
+	if (init.contains("headers")) {
+		for (const auto &[name, value] : init.at("headers").items()) {
+			request.headers.push_back(name + ": " + value.get<std::string>());
+		}
+	}
+	if (init.contains("body")) {
+		request.body = init.at("body").get<std::string>();
+	}
+
+	return request;
+}
+
+// Collects "Name: value" lines with lower-case names; the status line and the final blank line are skipped.
+std::size_t collectHeaderCallback(char *buffer, std::size_t size, std::size_t nitems, void *userp) noexcept
+{
+	const std::size_t totalSize = size * nitems;
+	std::string_view line(buffer, totalSize);
+	while (!line.empty() && (line.back() == '\r' || line.back() == '\n')) {
+		line.remove_suffix(1);
+	}
+
+	const std::size_t colon = line.find(':');
+	if (colon == std::string_view::npos) {
+		return totalSize;
+	}
+
+	try {
+		std::string name(line.substr(0, colon));
+		for (char &c : name) {
+			if (c >= 'A' && c <= 'Z') {
+				c = static_cast<char>(c - 'A' + 'a');
+			}
+		}
+		std::string_view value = line.substr(colon + 1);
+		value.remove_prefix(std::min(value.find_first_not_of(" \t"), value.size()));
+
+		auto *headers = static_cast<nlohmann::json *>(userp);
+		(*headers)[name] = std::string(value);
+	} catch (...) {
+		return 0;
+	}
+
+	return totalSize;
+}
+
+nlohmann::json makeFetchResponse(CURL *curl, const FetchRequest &request, CURLcode result,
+				 const std::vector<char> &body, nlohmann::json headers)
+{
+	if (result != CURLE_OK) {
+		throw std::runtime_error(curl_easy_strerror(result));
+	}
+
+	long status = 0;
+	curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &status);
+	char *effectiveUrl = nullptr;
+	curl_easy_getinfo(curl, CURLINFO_EFFECTIVE_URL, &effectiveUrl);
+
+	return nlohmann::json{
+		{"status", status},
+		{"ok", status == 0 || (status >= 200 && status < 300)},
+		{"url", effectiveUrl ? effectiveUrl : request.url},
+		{"headers", std::move(headers)},
+		{"body", std::string(body.begin(), body.end())},
+	};
+}
+
+// Runs as a host job; every outcome, including failures, ends in complete() so the promise settles.
+Async::Task<void> fetchTask(ScriptingHostJobQueue &hostJobs, std::uint64_t jobId, FetchRequest request,
+			    std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool,
+			    std::shared_ptr<CurlHelper::CurlMultiExecutor> curlExecutor,
+			    std::shared_ptr<const Logger::ILogger> logger)
+{
+	ScriptingHostJobQueue::Settle settle;
+
+	try {
+		const CurlHelper::CurlConnectionPool::Lease lease = curlPool->checkout();
+		CURL *curl = lease.getRaw();
+
+		CurlHelper::CurlSlistHandle headers;
+		for (const std::string &header : request.headers) {
+			headers.append(header.c_str());
+		}
+
+		std::vector<char> body;
+		nlohmann::json responseHeaders = nlohmann::json::object();
+
+		curl_easy_setopt(curl, CURLOPT_URL, request.url.c_str());
+		curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers.getRaw());
+		curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 2L);
+		if (request.method != "GET") {
+			curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, request.method.c_str());
+		}
+		if (request.body) {
+			curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE_LARGE,
+					 static_cast<curl_off_t>(request.body->size()));
+			curl_easy_setopt(curl, CURLOPT_POSTFIELDS, request.body->data());
+		}
+
+		curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, CurlHelper::CurlCharVectorWriteCallback);
+		curl_easy_setopt(curl, CURLOPT_WRITEDATA, &body);
+		curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, collectHeaderCallback);
+		curl_easy_setopt(curl, CURLOPT_HEADERDATA, &responseHeaders);
+
+		curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, 10L);
+		curl_easy_setopt(curl, CURLOPT_TIMEOUT, 30L);
+		curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+
+		logger->info("ScriptingFetchStarting", {{"method", request.method}, {"url", request.url}});
+		const CURLcode result =
+			co_await CurlHelper::CurlMultiExecutor::PerformAwaiter(curlExecutor.get(), curl);
+		CurlHelper::CurlConnectionPool::recordTransfer(curl);
+
+		nlohmann::json response = makeFetchResponse(curl, request, result, body, std::move(responseHeaders));
+		logger->info("ScriptingFetchFinished",
+			     {{"url", request.url}, {"status", std::to_string(response.at("status").get<long>())}});
+
+		settle = [response = std::move(response)](JSContext *ctx) -> JSValue {
+			try {
+				ScopedJSValue value = jsonToJSValue(ctx, response);
+				return JS_DupValue(ctx, value.get());
+			} catch (const std::exception &e) {
+				return JS_ThrowInternalError(ctx, "fetch response conversion failed: %s", e.what());
+			}
+		};
+	} catch (const std::exception &e) {
+		logger->warn("ScriptingFetchError", {{"url", request.url}, {"exception", e.what()}});
+		settle = [message = std::string(e.what())](JSContext *ctx) -> JSValue {
+			return JS_ThrowTypeError(ctx, "fetch failed: %s", message.c_str());
+		};
+	}
+
+	co_await hostJobs.complete(jobId, std::move(settle));
+}
+
+} // anonymous namespace
+
+ScriptingFetch::ScriptingFetch(std::shared_ptr<ScriptingRuntime> runtime, std::shared_ptr<JSContext> ctx,
+			       std::shared_ptr<const Logger::ILogger> logger,
+			       std::shared_ptr<ScriptingHostJobQueue> hostJobs,
+			       std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool,
+			       std::shared_ptr<CurlHelper::CurlMultiExecutor> curlExecutor)
+	: runtime_(runtime ? std::move(runtime)
+			   : throw std::invalid_argument("RuntimeNullError(ScriptingFetch::ScriptingFetch)")),
+	  ctx_(ctx ? std::move(ctx) : throw std::invalid_argument("ContextNullError(ScriptingFetch::ScriptingFetch)")),
+	  logger_(logger ? std::move(logger)
+			 : throw std::invalid_argument("LoggerNullError(ScriptingFetch::ScriptingFetch)")),
+	  hostJobs_(hostJobs ? std::move(hostJobs)
+			     : throw std::invalid_argument("HostJobsNullError(ScriptingFetch::ScriptingFetch)")),
+	  curlPool_(curlPool ? std::move(curlPool)
+			     : throw std::invalid_argument("CurlPoolNullError(ScriptingFetch::ScriptingFetch)")),
+	  curlExecutor_(std::move(curlExecutor))
+{
+}
+
+ScriptingFetch::~ScriptingFetch()
+{
+	if (!JS_IsUndefined(dataObj_.get())) {
+		JS_SetOpaque(dataObj_.get(), nullptr);
+	}
+}
+
+void ScriptingFetch::setupContext()
+{
+	JSClassID classId = runtime_->registerCustomClass<ScriptingFetch>(&kClassDef);
+
+	dataObj_ = ScopedJSValue(ctx_.get(), JS_NewObjectClass(ctx_.get(), classId));
+	JS_SetOpaque(dataObj_.get(), this);
+
+	JSValueConst data[] = {dataObj_.get()};
+	JSValue fetchFunc = JS_NewCFunctionData(ctx_.get(), &ScriptingFetch::fetch, 2, 0, 1, data);
+
+	JSValue globalObj = JS_GetGlobalObject(ctx_.get());
+	JS_SetPropertyStr(ctx_.get(), globalObj, "fetch", fetchFunc);
+	JS_FreeValue(ctx_.get(), globalObj);
+}
+
+JSValue ScriptingFetch::fetch(JSContext *ctx, JSValueConst, int argc, JSValueConst *argv, int, JSValueConst *funcData)
+{
+	if (argc < 1)
+		return JS_ThrowTypeError(ctx, "URL required");
+
+	auto *runtime = static_cast<ScriptingRuntime *>(JS_GetRuntimeOpaque(JS_GetRuntime(ctx)));
+	auto *self =
+		static_cast<ScriptingFetch *>(JS_GetOpaque(funcData[0], runtime->getClassId<ScriptingFetch>()));
+	if (!self)
+		return JS_ThrowInternalError(ctx, "fetch is no longer available");
+
+	FetchRequest request;
+	try {
+		request = parseFetchRequest(ctx, argc, argv);
+	} catch (const std::exception &e) {
+		return JS_ThrowTypeError(ctx, "fetch: %s", e.what());
+	}
+
+	return self->hostJobs_->startJob([&](std::uint64_t jobId) {
+		return fetchTask(*self->hostJobs_, jobId, std::move(request), self->curlPool_, self->curlExecutor_,
+				 self->logger_);
+	});
+}
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Scripting
@@ -0,0 +1,79 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * Live Stream Segmenter - Scripting Module
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include <quickjs.h>
+
+#include <KaitoTokyo/CurlHelper/CurlConnectionPool.hpp>
+#include <KaitoTokyo/CurlHelper/CurlMultiExecutor.hpp>
+#include <KaitoTokyo/Logger/ILogger.hpp>
+
+#include "ScriptingHostJobQueue.hpp"
+#include "ScriptingRuntime.hpp"
+
+namespace KaitoTokyo::LiveStreamSegmenter::Scripting {
+
+/**
+ * Installs a global fetch(url, init) for event handlers, run as a host job on the curl multi executor.
+ *
+ * This is a small subset of the WHATWG API: init accepts method, headers (an object) and body (a
+ * string), and the promise resolves to a plain { status, ok, url, headers, body } object with the body
+ * as text and header names in lower case. HTTP error statuses resolve; transfer failures reject with a
+ * TypeError. A null executor performs the transfer inline on the scripting thread.
+ */
+class ScriptingFetch {
+public:
+	ScriptingFetch(std::shared_ptr<ScriptingRuntime> runtime, std::shared_ptr<JSContext> ctx,
+		       std::shared_ptr<const Logger::ILogger> logger, std::shared_ptr<ScriptingHostJobQueue> hostJobs,
+		       std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool,
+		       std::shared_ptr<CurlHelper::CurlMultiExecutor> curlExecutor);
+	~ScriptingFetch();
+
+	ScriptingFetch(const ScriptingFetch &) = delete;
+	ScriptingFetch &operator=(const ScriptingFetch &) = delete;
+	ScriptingFetch(ScriptingFetch &&) = delete;
+	ScriptingFetch &operator=(ScriptingFetch &&) = delete;
+
+	void setupContext();
+
+	static JSValue fetch(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv, int magic,
+			     JSValueConst *funcData);
+
+private:
+	const std::shared_ptr<ScriptingRuntime> runtime_;
+	const std::shared_ptr<JSContext> ctx_;
+	const std::shared_ptr<const Logger::ILogger> logger_;
+	const std::shared_ptr<ScriptingHostJobQueue> hostJobs_;
+	const std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool_;
+	const std::shared_ptr<CurlHelper::CurlMultiExecutor> curlExecutor_;
+
+	// Carries this to fetch(); detached in the destructor so a leftover fetch function cannot dangle.
+	ScopedJSValue dataObj_;
+};
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Scripting
@@ -0,0 +1,124 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * Live Stream Segmenter - Scripting Module
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ScriptingHostJobQueue.hpp"
+
+#include <stdexcept>
+
+namespace KaitoTokyo::LiveStreamSegmenter::Scripting {
+
+ScriptingHostJobQueue::ScriptingHostJobQueue(std::shared_ptr<JSContext> ctx)
+	: ctx_(ctx ? std::move(ctx) : throw std::invalid_argument("ContextNullError(ScriptingHostJobQueue)"))
+{
+}
+
+ScriptingHostJobQueue::~ScriptingHostJobQueue() noexcept
+{
+	while (!jobs_.empty()) {
+		releaseJob(jobs_.begin());
+	}
+}
+
+void ScriptingHostJobQueue::waitForCompletionBlocking()
+{
+	std::unique_lock lock(mutex_);
+	completedCondition_.wait(lock, [this]() { return !completed_.empty(); });
+}
+
+void ScriptingHostJobQueue::settleCompleted()
+{
+	for (Completion &completion : takeCompleted()) {
+		auto it = jobs_.find(completion.jobId);
+		if (it == jobs_.end()) {
+			continue;
+		}
+
+		JSContext *ctx = ctx_.get();
+		JSValue value = completion.settle ? completion.settle(ctx) : JS_UNDEFINED;
+		const bool rejected = JS_IsException(value);
+		if (rejected) {
+			value = JS_GetException(ctx);
+		}
+
+		JSValue ret = JS_Call(ctx, rejected ? it->second.reject : it->second.resolve, JS_UNDEFINED, 1, &value);
+		JS_FreeValue(ctx, ret);
+		JS_FreeValue(ctx, value);
+
+		releaseJob(it);
+	}
+}
+
+void ScriptingHostJobQueue::abandonCompleted()
+{
+	for (const Completion &completion : takeCompleted()) {
+		if (auto it = jobs_.find(completion.jobId); it != jobs_.end()) {
+			releaseJob(it);
+		}
+	}
+}
+
+JSValue ScriptingHostJobQueue::createJob(std::uint64_t &jobId)
+{
+	JSValue resolvingFuncs[2];
+	JSValue promise = JS_NewPromiseCapability(ctx_.get(), resolvingFuncs);
+	if (JS_IsException(promise)) {
+		return promise;
+	}
+
+	jobId = nextJobId_++;
+	jobs_.emplace(jobId, Job{.resolve = resolvingFuncs[0], .reject = resolvingFuncs[1], .task = {}});
+	return promise;
+}
+
+std::vector<ScriptingHostJobQueue::Completion> ScriptingHostJobQueue::takeCompleted()
+{
+	std::vector<Completion> completed;
+	std::scoped_lock lock(mutex_);
+	completed.swap(completed_);
+	return completed;
+}
+
+void ScriptingHostJobQueue::releaseJob(std::unordered_map<std::uint64_t, Job>::iterator it) noexcept
+{
+	JS_FreeValue(ctx_.get(), it->second.resolve);
+	JS_FreeValue(ctx_.get(), it->second.reject);
+	// The task is suspended in complete() or has not started, so destroying its frame is safe.
+	jobs_.erase(it);
+}
+
+std::coroutine_handle<> ScriptingHostJobQueue::post(std::uint64_t jobId, Settle settle) noexcept
+{
+	std::coroutine_handle<> waiter;
+	{
+		std::scoped_lock lock(mutex_);
+		completed_.push_back(Completion{jobId, std::move(settle)});
+		waiter = std::exchange(waiter_, nullptr);
+		// Notified under the lock so that a blocked owner cannot destroy the queue before this returns.
+		completedCondition_.notify_all();
+	}
+	return waiter ? waiter : std::noop_coroutine();
+}
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Scripting
@@ -0,0 +1,208 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * Live Stream Segmenter - Scripting Module
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <coroutine>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <quickjs.h>
+
+#include <KaitoTokyo/Async/Task.hpp>
+
+namespace KaitoTokyo::LiveStreamSegmenter::Scripting {
+
+/**
+ * Promises handed to scripts by host primitives such as fetch(), and the host I/O that settles them.
+ *
+ * A primitive calls startJob() on the scripting thread, which returns a pending promise and starts
+ * the job's task. The task does its I/O wherever it likes and finishes with co_await complete(...),
+ * from any thread. The completion is queued and the promise is settled later by settleCompleted(),
+ * back on the thread that drives the event handler, as QuickJS must not be used concurrently.
+ *
+ * Jobs that are still running must not be cut short: the owner waits until hasPendingJobs() is false
+ * before destroying the queue, settling or abandoning the completions as they arrive.
+ */
+class ScriptingHostJobQueue {
+public:
+	/**
+	 * Runs on the scripting thread and returns the value to resolve the promise with, or JS_EXCEPTION
+	 * to reject it with the pending exception.
+	 */
+	using Settle = std::function<JSValue(JSContext *ctx)>;
+
+	class CompleteAwaiter {
+	public:
+		CompleteAwaiter(ScriptingHostJobQueue &queue, std::uint64_t jobId, Settle settle) noexcept
+			: queue_(queue),
+			  jobId_(jobId),
+			  settle_(std::move(settle))
+		{
+		}
+
+		bool await_ready() const noexcept { return false; }
+
+		// The job's coroutine stays suspended here until the queue destroys it.
+		std::coroutine_handle<> await_suspend(std::coroutine_handle<>) noexcept
+		{
+			return queue_.post(jobId_, std::move(settle_));
+		}
+
+		void await_resume() const noexcept {}
+
+	private:
+		ScriptingHostJobQueue &queue_;
+		const std::uint64_t jobId_;
+		Settle settle_;
+	};
+
+	class CompletionAwaiter {
+	public:
+		explicit CompletionAwaiter(ScriptingHostJobQueue &queue) noexcept : queue_(queue) {}
+
+		bool await_ready() const noexcept { return false; }
+
+		// Resumes on the thread that posts the next completion, or does not suspend if one is queued.
+		bool await_suspend(std::coroutine_handle<> handle) noexcept
+		{
+			std::scoped_lock lock(queue_.mutex_);
+			if (!queue_.completed_.empty()) {
+				return false;
+			}
+			queue_.waiter_ = handle;
+			return true;
+		}
+
+		void await_resume() const noexcept {}
+
+	private:
+		ScriptingHostJobQueue &queue_;
+	};
+
+	explicit ScriptingHostJobQueue(std::shared_ptr<JSContext> ctx);
+	~ScriptingHostJobQueue() noexcept;
+
+	ScriptingHostJobQueue(const ScriptingHostJobQueue &) = delete;
+	ScriptingHostJobQueue &operator=(const ScriptingHostJobQueue &) = delete;
+	ScriptingHostJobQueue(ScriptingHostJobQueue &&) = delete;
+	ScriptingHostJobQueue &operator=(ScriptingHostJobQueue &&) = delete;
+
+	/**
+	 * Creates a pending promise and starts makeTask(jobId), which must end with co_await complete(jobId, ...).
+	 * Returns the promise, or JS_EXCEPTION if it could not be created. Scripting thread only.
+	 */
+	template<typename MakeTask> JSValue startJob(MakeTask &&makeTask)
+	{
+		std::uint64_t jobId = 0;
+		JSValue promise = createJob(jobId);
+		if (JS_IsException(promise)) {
+			return promise;
+		}
+
+		Async::Task<void> &task = jobs_.at(jobId).task;
+		task = std::forward<MakeTask>(makeTask)(jobId);
+		task.start();
+		return promise;
+	}
+
+	/**
+	 * Finishes a job from its task. Safe to await from any thread; the awaiting coroutine is never resumed.
+	 */
+	[[nodiscard]]
+	CompleteAwaiter complete(std::uint64_t jobId, Settle settle) noexcept
+	{
+		return CompleteAwaiter(*this, jobId, std::move(settle));
+	}
+
+	/**
+	 * Returns an awaitable that resumes once at least one job has completed.
+	 */
+	[[nodiscard]]
+	CompletionAwaiter waitForCompletion() noexcept
+	{
+		return CompletionAwaiter(*this);
+	}
+
+	/**
+	 * Blocks the calling thread until at least one job has completed.
+	 */
+	void waitForCompletionBlocking();
+
+	/**
+	 * Settles the promises of the jobs completed so far. The reactions run with the next pending jobs.
+	 * Scripting thread only.
+	 */
+	void settleCompleted();
+
+	/**
+	 * Drops the jobs completed so far without settling their promises, which stay pending.
+	 * Scripting thread only.
+	 */
+	void abandonCompleted();
+
+	/**
+	 * True while some job has not been settled or abandoned yet. Scripting thread only.
+	 */
+	bool hasPendingJobs() const noexcept { return !jobs_.empty(); }
+
+private:
+	struct Job {
+		JSValue resolve = JS_UNDEFINED;
+		JSValue reject = JS_UNDEFINED;
+		Async::Task<void> task;
+	};
+
+	struct Completion {
+		std::uint64_t jobId;
+		Settle settle;
+	};
+
+	JSValue createJob(std::uint64_t &jobId);
+	std::vector<Completion> takeCompleted();
+	void releaseJob(std::unordered_map<std::uint64_t, Job>::iterator it) noexcept;
+
+	// Must not touch the completing job's frame after the lock is released; it may be destroyed by then.
+	std::coroutine_handle<> post(std::uint64_t jobId, Settle settle) noexcept;
+
+	const std::shared_ptr<JSContext> ctx_;
+
+	// Scripting thread only.
+	std::unordered_map<std::uint64_t, Job> jobs_;
+	std::uint64_t nextJobId_ = 1;
+
+	std::mutex mutex_;
+	std::condition_variable completedCondition_;
+	std::vector<Completion> completed_;
+	std::coroutine_handle<> waiter_;
+};
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Scripting
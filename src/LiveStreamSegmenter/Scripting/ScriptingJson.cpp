@@ -0,0 +1,260 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * Live Stream Segmenter - Scripting Module
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ScriptingJson.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace KaitoTokyo::LiveStreamSegmenter::Scripting {
+
+namespace {
+
+// JSON.stringify reports cycles; a depth limit catches them without tracking visited objects.
+constexpr int kMaxDepth = 256;
+
+// Largest magnitude up to which every integer is exactly representable as a double.
+constexpr double kMaxSafeInteger = 9007199254740991.0;
+
+JSValue newValue(JSContext *ctx, const nlohmann::json &j);
+
+JSValue checked(JSContext *ctx, JSValue value)
+{
+	if (JS_IsException(value)) {
+		ScopedJSValue exception(ctx, JS_GetException(ctx));
+		throw std::runtime_error("JSValueCreateError(jsonToJSValue)");
+	}
+	return value;
+}
+
+JSValue newArray(JSContext *ctx, const nlohmann::json &j)
+{
+	ScopedJSValue array(ctx, checked(ctx, JS_NewArray(ctx)));
+	std::uint32_t index = 0;
+	for (const nlohmann::json &element : j) {
+		if (JS_SetPropertyUint32(ctx, array.get(), index++, newValue(ctx, element)) < 0) {
+			ScopedJSValue exception(ctx, JS_GetException(ctx));
+			throw std::runtime_error("JSValueCreateError(jsonToJSValue)");
+		}
+	}
+	return JS_DupValue(ctx, array.get());
+}
+
+JSValue newObject(JSContext *ctx, const nlohmann::json &j)
+{
+	ScopedJSValue object(ctx, checked(ctx, JS_NewObject(ctx)));
+	for (const auto &[key, element] : j.items()) {
+		JSValue elementValue = newValue(ctx, element);
+		const JSAtom atom = JS_NewAtomLen(ctx, key.data(), key.size());
+		// Defined rather than set, so that keys such as "__proto__" become own properties as in JSON.parse.
+		const int result = JS_DefinePropertyValue(ctx, object.get(), atom, elementValue, JS_PROP_C_W_E);
+		JS_FreeAtom(ctx, atom);
+		if (result < 0) {
+			ScopedJSValue exception(ctx, JS_GetException(ctx));
+			throw std::runtime_error("JSValueCreateError(jsonToJSValue)");
+		}
+	}
+	return JS_DupValue(ctx, object.get());
+}
+
+JSValue newValue(JSContext *ctx, const nlohmann::json &j)
+{
+	switch (j.type()) {
+	case nlohmann::json::value_t::null:
+		return JS_NULL;
+	case nlohmann::json::value_t::boolean:
+		return JS_NewBool(ctx, j.get<bool>());
+	case nlohmann::json::value_t::number_integer:
+		return JS_NewInt64(ctx, j.get<std::int64_t>());
+	case nlohmann::json::value_t::number_unsigned: {
+		const std::uint64_t value = j.get<std::uint64_t>();
+		if (value <= static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max())) {
+			return JS_NewInt64(ctx, static_cast<std::int64_t>(value));
+		}
+		return JS_NewFloat64(ctx, static_cast<double>(value));
+	}
+	case nlohmann::json::value_t::number_float:
+		return JS_NewFloat64(ctx, j.get<double>());
+	case nlohmann::json::value_t::string: {
+		const std::string &value = j.get_ref<const std::string &>();
+		return checked(ctx, JS_NewStringLen(ctx, value.data(), value.size()));
+	}
+	case nlohmann::json::value_t::array:
+		return newArray(ctx, j);
+	case nlohmann::json::value_t::object:
+		return newObject(ctx, j);
+	case nlohmann::json::value_t::binary:
+	case nlohmann::json::value_t::discarded:
+		break;
+	}
+	throw std::runtime_error("UnsupportedJsonTypeError(jsonToJSValue)");
+}
+
+[[noreturn]] void throwPendingException(JSContext *ctx)
+{
+	ScopedJSValue exception(ctx, JS_GetException(ctx));
+	ScopedJSString str(ctx, JS_ToCString(ctx, exception.get()));
+	throw std::runtime_error(std::string("JSValueConvertError(jsValueToJson):") +
+				 (str ? str.get() : "(UNKNOWN)"));
+}
+
+ScopedJSValue getChecked(JSContext *ctx, JSValue value)
+{
+	if (JS_IsException(value)) {
+		throwPendingException(ctx);
+	}
+	return ScopedJSValue(ctx, value);
+}
+
+bool isSkipped(JSContext *ctx, JSValueConst value)
+{
+	return JS_IsUndefined(value) || JS_IsSymbol(value) || JS_IsFunction(ctx, value);
+}
+
+nlohmann::json toJson(JSContext *ctx, JSValueConst value, int depth);
+
+nlohmann::json numberToJson(JSContext *ctx, JSValueConst value)
+{
+	double number = 0.0;
+	if (JS_ToFloat64(ctx, &number, value) < 0) {
+		throwPendingException(ctx);
+	}
+
+	if (!std::isfinite(number)) {
+		return nullptr;
+	}
+	// JSON.stringify prints integral doubles without a fraction, and nlohmann parses them back as integers.
+	if (std::trunc(number) == number && std::fabs(number) <= kMaxSafeInteger) {
+		return static_cast<std::int64_t>(number);
+	}
+	return number;
+}
+
+nlohmann::json arrayToJson(JSContext *ctx, JSValueConst value, int depth)
+{
+	std::int64_t length = 0;
+	if (JS_GetLength(ctx, value, &length) < 0) {
+		throwPendingException(ctx);
+	}
+
+	nlohmann::json j = nlohmann::json::array();
+	for (std::int64_t i = 0; i < length; ++i) {
+		ScopedJSValue element = getChecked(ctx, JS_GetPropertyInt64(ctx, value, i));
+		if (isSkipped(ctx, element.get())) {
+			j.push_back(nullptr);
+		} else {
+			j.push_back(toJson(ctx, element.get(), depth));
+		}
+	}
+	return j;
+}
+
+nlohmann::json objectToJson(JSContext *ctx, JSValueConst value, int depth)
+{
+	JSPropertyEnum *properties = nullptr;
+	std::uint32_t propertyCount = 0;
+	if (JS_GetOwnPropertyNames(ctx, &properties, &propertyCount, value,
+				   JS_GPN_STRING_MASK | JS_GPN_ENUM_ONLY) < 0) {
+		throwPendingException(ctx);
+	}
+
+	struct PropertiesGuard {
+		JSContext *ctx;
+		JSPropertyEnum *properties;
+		std::uint32_t count;
+		~PropertiesGuard() { JS_FreePropertyEnum(ctx, properties, count); }
+	} guard{ctx, properties, propertyCount};
+
+	nlohmann::json j = nlohmann::json::object();
+	for (std::uint32_t i = 0; i < propertyCount; ++i) {
+		ScopedJSValue element = getChecked(ctx, JS_GetProperty(ctx, value, properties[i].atom));
+		if (isSkipped(ctx, element.get())) {
+			continue;
+		}
+
+		ScopedJSString key(ctx, JS_AtomToCString(ctx, properties[i].atom));
+		if (!key) {
+			throwPendingException(ctx);
+		}
+		j[key.get()] = toJson(ctx, element.get(), depth);
+	}
+	return j;
+}
+
+nlohmann::json toJson(JSContext *ctx, JSValueConst value, int depth)
+{
+	if (++depth > kMaxDepth) {
+		throw std::runtime_error("JSValueTooDeepError(jsValueToJson)");
+	}
+
+	if (JS_IsNull(value) || isSkipped(ctx, value)) {
+		return nullptr;
+	} else if (JS_IsBool(value)) {
+		return JS_ToBool(ctx, value) != 0;
+	} else if (JS_IsNumber(value)) {
+		return numberToJson(ctx, value);
+	} else if (JS_IsString(value)) {
+		std::size_t length = 0;
+		const char *str = JS_ToCStringLen(ctx, &length, value);
+		ScopedJSString scopedStr(ctx, str);
+		if (!str) {
+			throwPendingException(ctx);
+		}
+		return std::string(str, length);
+	} else if (JS_IsBigInt(ctx, value)) {
+		throw std::runtime_error("BigIntNotSerializableError(jsValueToJson)");
+	} else if (!JS_IsObject(value)) {
+		return nullptr;
+	}
+
+	// Date and dayjs objects, among others, serialize through toJSON().
+	ScopedJSValue toJSON = getChecked(ctx, JS_GetPropertyStr(ctx, value, "toJSON"));
+	if (JS_IsFunction(ctx, toJSON.get())) {
+		ScopedJSValue replaced = getChecked(ctx, JS_Call(ctx, toJSON.get(), value, 0, nullptr));
+		return toJson(ctx, replaced.get(), depth);
+	}
+
+	if (JS_IsArray(value)) {
+		return arrayToJson(ctx, value, depth);
+	}
+	return objectToJson(ctx, value, depth);
+}
+
+} // anonymous namespace
+
+ScopedJSValue jsonToJSValue(JSContext *ctx, const nlohmann::json &j)
+{
+	return ScopedJSValue(ctx, newValue(ctx, j));
+}
+
+nlohmann::json jsValueToJson(JSContext *ctx, JSValueConst value)
+{
+	return toJson(ctx, value, 0);
+}
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Scripting
@@ -0,0 +1,49 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * Live Stream Segmenter - Scripting Module
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include <quickjs.h>
+
+#include "ScriptingRuntime.hpp"
+
+namespace KaitoTokyo::LiveStreamSegmenter::Scripting {
+
+/**
+ * Builds the JS value for j directly, as JS_ParseJSON would from j.dump() but without the text.
+ * Throws std::runtime_error when an allocation fails or j holds binary data.
+ */
+ScopedJSValue jsonToJSValue(JSContext *ctx, const nlohmann::json &j);
+
+/**
+ * Converts a JS value to JSON directly, with the same result as JSON.parse(JSON.stringify(value)).
+ * toJSON() is honoured, properties that are undefined, functions or symbols are skipped, and
+ * non-finite numbers become null. Throws std::runtime_error on exceptions, cycles and BigInts.
+ */
+nlohmann::json jsValueToJson(JSContext *ctx, JSValueConst value);
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Scripting
@@ -0,0 +1,553 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * Live Stream Segmenter - Scripting Module
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ScriptingLocalStorage.hpp"
+
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+#include <fmt/format.h>
+
+namespace KaitoTokyo::LiveStreamSegmenter::Scripting {
+
+namespace {
+
+constexpr const char *kCreateTableSql =
+	"CREATE TABLE IF NOT EXISTS __sys_local_storage (key TEXT PRIMARY KEY, value TEXT);";
+constexpr std::string_view kSelectAllSql = "SELECT key, value FROM __sys_local_storage;";
+constexpr std::string_view kUpsertSql = "INSERT OR REPLACE INTO __sys_local_storage (key, value) VALUES (?, ?);";
+constexpr std::string_view kDeleteSql = "DELETE FROM __sys_local_storage WHERE key = ?;";
+constexpr const char *kClearSql = "DELETE FROM __sys_local_storage;";
+constexpr std::string_view kDataVersionSql = "PRAGMA data_version;";
+
+// Named apart from the savepoint of db.transaction(), which a flush never runs inside, to be safe anyway.
+constexpr const char *kSavepointSql = "SAVEPOINT lss_local_storage;";
+constexpr const char *kReleaseSql = "RELEASE lss_local_storage;";
+constexpr const char *kRollbackSql = "ROLLBACK TO lss_local_storage; RELEASE lss_local_storage;";
+
+constexpr const char *kTableExistsSql =
+	"SELECT 1 FROM sqlite_master WHERE type = 'table' AND name = '__sys_local_storage';";
+constexpr const char *kBeginImmediateSql = "BEGIN IMMEDIATE;";
+constexpr const char *kCommitSql = "COMMIT;";
+constexpr const char *kRollbackTransactionSql = "ROLLBACK;";
+
+// Sessions hold the write lock only for the savepoint of a flush, so an editor waits that long at most.
+constexpr int kEditorBusyTimeoutMs = 2000;
+
+const static JSClassDef kClassDef = {
+	.class_name = "Storage",
+};
+
+const static JSCFunctionListEntry kProtoFuncList[] = {
+	JS_CFUNC_DEF("getItem", 1, ScriptingLocalStorage::getItem),
+	JS_CFUNC_DEF("setItem", 2, ScriptingLocalStorage::setItem),
+	JS_CFUNC_DEF("removeItem", 1, ScriptingLocalStorage::removeItem),
+	JS_CFUNC_DEF("clear", 0, ScriptingLocalStorage::clear),
+	JS_CFUNC_DEF("key", 1, ScriptingLocalStorage::key),
+	JS_CGETSET_DEF("length", ScriptingLocalStorage::getLength, nullptr),
+};
+
+ScriptingLocalStorage *unwrap(JSContext *ctx, JSValueConst this_val)
+{
+	JSRuntime *rt = JS_GetRuntime(ctx);
+	auto runtime = static_cast<ScriptingRuntime *>(JS_GetRuntimeOpaque(rt));
+	JSClassID classId = runtime->getClassId<ScriptingLocalStorage>();
+	return static_cast<ScriptingLocalStorage *>(JS_GetOpaque(this_val, classId));
+}
+
+// Keys and values are converted with String(), as the Web Storage API does.
+std::optional<std::string> toStdString(JSContext *ctx, JSValueConst value)
+{
+	std::size_t length = 0;
+	ScopedJSString str(ctx, JS_ToCStringLen(ctx, &length, value));
+	if (!str) {
+		return std::nullopt;
+	}
+	return std::string(str.get(), length);
+}
+
+JSValue newString(JSContext *ctx, const std::string &value)
+{
+	return JS_NewStringLen(ctx, value.data(), value.size());
+}
+
+std::string readTextColumn(sqlite3_stmt *stmt, int column)
+{
+	const unsigned char *text = sqlite3_column_text(stmt, column);
+	if (!text) {
+		// What String(null) gave the rows other code stored as NULL.
+		return "null";
+	}
+	return std::string(reinterpret_cast<const char *>(text),
+			   static_cast<std::size_t>(sqlite3_column_bytes(stmt, column)));
+}
+
+using UniqueSqlite3 = std::unique_ptr<sqlite3, decltype(&sqlite3_close_v2)>;
+using UniqueSqlite3Stmt = std::unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)>;
+
+UniqueSqlite3 openDatabaseFile(const std::filesystem::path &dbPath, int flags)
+{
+	std::u8string dbPathU8 = dbPath.u8string();
+	sqlite3 *db = nullptr;
+	const int rc = sqlite3_open_v2(reinterpret_cast<const char *>(dbPathU8.c_str()), &db, flags, nullptr);
+	UniqueSqlite3 scoped(db, sqlite3_close_v2);
+	if (rc != SQLITE_OK) {
+		throw std::runtime_error(fmt::format("OpenError(ScriptingLocalStorage::openDatabaseFile):{}",
+						     db ? sqlite3_errmsg(db) : sqlite3_errstr(rc)));
+	}
+	sqlite3_busy_timeout(db, kEditorBusyTimeoutMs);
+	return scoped;
+}
+
+UniqueSqlite3Stmt prepare(sqlite3 *db, std::string_view sql)
+{
+	sqlite3_stmt *stmt = nullptr;
+	if (sqlite3_prepare_v2(db, sql.data(), static_cast<int>(sql.size()), &stmt, nullptr) != SQLITE_OK) {
+		throw std::runtime_error(
+			fmt::format("PrepareError(ScriptingLocalStorage::prepare):{}", sqlite3_errmsg(db)));
+	}
+	return UniqueSqlite3Stmt(stmt, sqlite3_finalize);
+}
+
+} // anonymous namespace
+
+std::map<std::string, std::string> ScriptingLocalStorage::readDatabaseFile(const std::filesystem::path &dbPath)
+{
+	std::map<std::string, std::string> items;
+	if (!std::filesystem::exists(dbPath)) {
+		return items;
+	}
+
+	UniqueSqlite3 db = openDatabaseFile(dbPath, SQLITE_OPEN_READONLY);
+
+	UniqueSqlite3Stmt exists = prepare(db.get(), kTableExistsSql);
+	if (sqlite3_step(exists.get()) != SQLITE_ROW) {
+		return items;
+	}
+
+	UniqueSqlite3Stmt stmt = prepare(db.get(), kSelectAllSql);
+	int rc;
+	while ((rc = sqlite3_step(stmt.get())) == SQLITE_ROW) {
+		items.insert_or_assign(readTextColumn(stmt.get(), 0), readTextColumn(stmt.get(), 1));
+	}
+	if (rc != SQLITE_DONE) {
+		throw std::runtime_error(fmt::format("SelectError(ScriptingLocalStorage::readDatabaseFile):{}",
+						     sqlite3_errmsg(db.get())));
+	}
+	return items;
+}
+
+void ScriptingLocalStorage::writeDatabaseFile(const std::filesystem::path &dbPath,
+					      const std::map<std::string, std::optional<std::string>> &changes)
+{
+	UniqueSqlite3 db = openDatabaseFile(dbPath, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE);
+
+	if (sqlite3_exec(db.get(), kBeginImmediateSql, nullptr, nullptr, nullptr) != SQLITE_OK) {
+		throw std::runtime_error(fmt::format("BeginError(ScriptingLocalStorage::writeDatabaseFile):{}",
+						     sqlite3_errmsg(db.get())));
+	}
+
+	try {
+		if (sqlite3_exec(db.get(), kCreateTableSql, nullptr, nullptr, nullptr) != SQLITE_OK) {
+			throw std::runtime_error(
+				fmt::format("CreateTableError(ScriptingLocalStorage::writeDatabaseFile):{}",
+					    sqlite3_errmsg(db.get())));
+		}
+
+		UniqueSqlite3Stmt upsert = prepare(db.get(), kUpsertSql);
+		UniqueSqlite3Stmt remove = prepare(db.get(), kDeleteSql);
+		for (const auto &[key, value] : changes) {
+			sqlite3_stmt *stmt = value ? upsert.get() : remove.get();
+			sqlite3_reset(stmt);
+			sqlite3_bind_text(stmt, 1, key.data(), static_cast<int>(key.size()), SQLITE_STATIC);
+			if (value) {
+				sqlite3_bind_text(stmt, 2, value->data(), static_cast<int>(value->size()),
+						  SQLITE_STATIC);
+			}
+			if (sqlite3_step(stmt) != SQLITE_DONE) {
+				throw std::runtime_error(
+					fmt::format("WriteError(ScriptingLocalStorage::writeDatabaseFile):{}",
+						    sqlite3_errmsg(db.get())));
+			}
+		}
+
+		if (sqlite3_exec(db.get(), kCommitSql, nullptr, nullptr, nullptr) != SQLITE_OK) {
+			throw std::runtime_error(fmt::format(
+				"CommitError(ScriptingLocalStorage::writeDatabaseFile):{}", sqlite3_errmsg(db.get())));
+		}
+	} catch (...) {
+		sqlite3_exec(db.get(), kRollbackTransactionSql, nullptr, nullptr, nullptr);
+		throw;
+	}
+}
+
+ScriptingLocalStorage::ScriptingLocalStorage(std::shared_ptr<ScriptingRuntime> runtime, std::shared_ptr<JSContext> ctx,
+					     std::shared_ptr<const Logger::ILogger> logger, sqlite3 *db,
+					     ScriptingStatementCache &statementCache)
+	: runtime_(runtime ? std::move(runtime)
+			   : throw std::invalid_argument(
+				     "RuntimeNullError(ScriptingLocalStorage::ScriptingLocalStorage)")),
+	  ctx_(ctx ? std::move(ctx)
+		   : throw std::invalid_argument("ContextNullError(ScriptingLocalStorage::ScriptingLocalStorage)")),
+	  logger_(logger ? std::move(logger)
+			 : throw std::invalid_argument(
+				   "LoggerNullError(ScriptingLocalStorage::ScriptingLocalStorage)")),
+	  db_(db ? db : throw std::invalid_argument("DatabaseNullError(ScriptingLocalStorage::ScriptingLocalStorage)")),
+	  statementCache_(statementCache)
+{
+}
+
+ScriptingLocalStorage::~ScriptingLocalStorage() noexcept
+{
+	flush();
+}
+
+void ScriptingLocalStorage::setupContext()
+{
+	JSContext *ctx = ctx_.get();
+	JSClassID classId = runtime_->registerCustomClass<ScriptingLocalStorage>(&kClassDef);
+
+	JSValue proto = JS_NewObject(ctx);
+	JS_SetPropertyFunctionList(ctx, proto, kProtoFuncList, std::size(kProtoFuncList));
+
+	// Storage cannot be constructed from scripts, but localStorage instanceof Storage holds.
+	JSValue storageCtor = JS_NewCFunction2(ctx, constructor, "Storage", 0, JS_CFUNC_constructor, 0);
+	JS_SetConstructor(ctx, storageCtor, proto);
+	JS_SetClassProto(ctx, classId, proto);
+
+	JSValue storageObj = JS_NewObjectClass(ctx, classId);
+	JS_SetOpaque(storageObj, this);
+
+	JSValue globalObj = JS_GetGlobalObject(ctx);
+	JS_SetPropertyStr(ctx, globalObj, "Storage", storageCtor);
+	JS_SetPropertyStr(ctx, globalObj, "localStorage", storageObj);
+	JS_FreeValue(ctx, globalObj);
+}
+
+bool ScriptingLocalStorage::flush() noexcept
+{
+	if (!isDirty()) {
+		return true;
+	}
+
+	if (sqlite3_exec(db_, kSavepointSql, nullptr, nullptr, nullptr) != SQLITE_OK) {
+		logger_->warn("LocalStorageFlushError", {{"message", sqlite3_errmsg(db_)}});
+		return false;
+	}
+
+	try {
+		writeDirty();
+	} catch (const std::exception &e) {
+		logger_->warn("LocalStorageFlushError", {{"message", e.what()}});
+		sqlite3_exec(db_, kRollbackSql, nullptr, nullptr, nullptr);
+		return false;
+	}
+
+	if (sqlite3_exec(db_, kReleaseSql, nullptr, nullptr, nullptr) != SQLITE_OK) {
+		logger_->warn("LocalStorageFlushError", {{"message", sqlite3_errmsg(db_)}});
+		sqlite3_exec(db_, kRollbackSql, nullptr, nullptr, nullptr);
+		return false;
+	}
+
+	logger_->debug("LocalStorageFlushed", [&] {
+		return std::to_array<Logger::OwnedLogField>(
+			{{"dirtyCount", std::to_string(dirty_.size())}, {"cleared", cleared_ ? "true" : "false"}});
+	});
+	dirty_.clear();
+	cleared_ = false;
+	dirtySince_.reset();
+	return true;
+}
+
+bool ScriptingLocalStorage::flushIfOlderThan(std::chrono::steady_clock::duration maxAge) noexcept
+{
+	if (!dirtySince_ || std::chrono::steady_clock::now() - *dirtySince_ < maxAge) {
+		return true;
+	}
+	return flush();
+}
+
+void ScriptingLocalStorage::revalidate() noexcept
+{
+	if (!loaded_) {
+		return;
+	}
+
+	try {
+		if (readDataVersion() == dataVersion_) {
+			return;
+		}
+	} catch (const std::exception &e) {
+		logger_->warn("LocalStorageRevalidateError", {{"message", e.what()}});
+	}
+
+	loaded_ = false;
+	logger_->debug("LocalStorageInvalidated");
+}
+
+void ScriptingLocalStorage::ensureLoaded()
+{
+	if (loaded_) {
+		return;
+	}
+
+	if (sqlite3_exec(db_, kCreateTableSql, nullptr, nullptr, nullptr) != SQLITE_OK) {
+		throw std::runtime_error(
+			fmt::format("CreateTableError(ScriptingLocalStorage::ensureLoaded):{}", sqlite3_errmsg(db_)));
+	}
+
+	// Read before the rows, so that a commit in between is seen by the next revalidate() instead of lost.
+	const std::int64_t dataVersion = readDataVersion();
+
+	ScriptingStatementCache::Lease stmt = statementCache_.acquire(kSelectAllSql);
+	if (!stmt) {
+		throw std::runtime_error(
+			fmt::format("PrepareError(ScriptingLocalStorage::ensureLoaded):{}", sqlite3_errmsg(db_)));
+	}
+
+	std::map<std::string, std::string> items;
+	int rc;
+	while ((rc = sqlite3_step(stmt.get())) == SQLITE_ROW) {
+		items.insert_or_assign(readTextColumn(stmt.get(), 0), readTextColumn(stmt.get(), 1));
+	}
+	if (rc != SQLITE_DONE) {
+		throw std::runtime_error(
+			fmt::format("SelectError(ScriptingLocalStorage::ensureLoaded):{}", sqlite3_errmsg(db_)));
+	}
+
+	if (cleared_) {
+		items.clear();
+	}
+	for (const auto &[key, value] : dirty_) {
+		if (value) {
+			items.insert_or_assign(key, *value);
+		} else {
+			items.erase(key);
+		}
+	}
+
+	items_ = std::move(items);
+	dataVersion_ = dataVersion;
+	loaded_ = true;
+	logger_->debug("LocalStorageLoaded", [&] {
+		return std::to_array<Logger::OwnedLogField>({{"itemCount", std::to_string(items_.size())}});
+	});
+}
+
+std::int64_t ScriptingLocalStorage::readDataVersion()
+{
+	ScriptingStatementCache::Lease stmt = statementCache_.acquire(kDataVersionSql);
+	if (!stmt || sqlite3_step(stmt.get()) != SQLITE_ROW) {
+		throw std::runtime_error(fmt::format("DataVersionError(ScriptingLocalStorage::readDataVersion):{}",
+						     sqlite3_errmsg(db_)));
+	}
+	return sqlite3_column_int64(stmt.get(), 0);
+}
+
+void ScriptingLocalStorage::markDirty(const std::string &key, std::optional<std::string> value)
+{
+	dirty_.insert_or_assign(key, std::move(value));
+	if (!dirtySince_) {
+		dirtySince_ = std::chrono::steady_clock::now();
+	}
+}
+
+void ScriptingLocalStorage::writeDirty()
+{
+	if (cleared_ && sqlite3_exec(db_, kClearSql, nullptr, nullptr, nullptr) != SQLITE_OK) {
+		throw std::runtime_error(
+			fmt::format("ClearError(ScriptingLocalStorage::writeDirty):{}", sqlite3_errmsg(db_)));
+	}
+
+	for (const auto &[key, value] : dirty_) {
+		ScriptingStatementCache::Lease stmt = statementCache_.acquire(value ? kUpsertSql : kDeleteSql);
+		if (!stmt) {
+			throw std::runtime_error(
+				fmt::format("PrepareError(ScriptingLocalStorage::writeDirty):{}", sqlite3_errmsg(db_)));
+		}
+
+		sqlite3_bind_text(stmt.get(), 1, key.data(), static_cast<int>(key.size()), SQLITE_STATIC);
+		if (value) {
+			sqlite3_bind_text(stmt.get(), 2, value->data(), static_cast<int>(value->size()), SQLITE_STATIC);
+		}
+
+		if (sqlite3_step(stmt.get()) != SQLITE_DONE) {
+			throw std::runtime_error(
+				fmt::format("WriteError(ScriptingLocalStorage::writeDirty):{}", sqlite3_errmsg(db_)));
+		}
+	}
+}
+
+JSValue ScriptingLocalStorage::getItem(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv)
+{
+	if (argc < 1)
+		return JS_ThrowTypeError(ctx, "Key required");
+
+	ScriptingLocalStorage *self = unwrap(ctx, this_val);
+	if (!self)
+		return JS_ThrowTypeError(ctx, "Illegal invocation");
+
+	const std::optional<std::string> key = toStdString(ctx, argv[0]);
+	if (!key)
+		return JS_EXCEPTION;
+
+	try {
+		self->ensureLoaded();
+	} catch (const std::exception &e) {
+		return JS_ThrowInternalError(ctx, "LocalStorageError: %s", e.what());
+	}
+
+	const auto it = self->items_.find(*key);
+	return it != self->items_.end() ? newString(ctx, it->second) : JS_NULL;
+}
+
+JSValue ScriptingLocalStorage::setItem(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv)
+{
+	if (argc < 2)
+		return JS_ThrowTypeError(ctx, "Key and value required");
+
+	ScriptingLocalStorage *self = unwrap(ctx, this_val);
+	if (!self)
+		return JS_ThrowTypeError(ctx, "Illegal invocation");
+
+	std::optional<std::string> key = toStdString(ctx, argv[0]);
+	if (!key)
+		return JS_EXCEPTION;
+	std::optional<std::string> value = toStdString(ctx, argv[1]);
+	if (!value)
+		return JS_EXCEPTION;
+
+	try {
+		self->ensureLoaded();
+	} catch (const std::exception &e) {
+		return JS_ThrowInternalError(ctx, "LocalStorageError: %s", e.what());
+	}
+
+	const auto it = self->items_.find(*key);
+	if (it != self->items_.end() && it->second == *value) {
+		return JS_UNDEFINED;
+	}
+
+	self->markDirty(*key, *value);
+	self->items_.insert_or_assign(std::move(*key), std::move(*value));
+	return JS_UNDEFINED;
+}
+
+JSValue ScriptingLocalStorage::removeItem(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv)
+{
+	if (argc < 1)
+		return JS_ThrowTypeError(ctx, "Key required");
+
+	ScriptingLocalStorage *self = unwrap(ctx, this_val);
+	if (!self)
+		return JS_ThrowTypeError(ctx, "Illegal invocation");
+
+	const std::optional<std::string> key = toStdString(ctx, argv[0]);
+	if (!key)
+		return JS_EXCEPTION;
+
+	try {
+		self->ensureLoaded();
+	} catch (const std::exception &e) {
+		return JS_ThrowInternalError(ctx, "LocalStorageError: %s", e.what());
+	}
+
+	if (self->items_.erase(*key) > 0) {
+		self->markDirty(*key, std::nullopt);
+	}
+	return JS_UNDEFINED;
+}
+
+JSValue ScriptingLocalStorage::clear(JSContext *ctx, JSValueConst this_val, int, JSValueConst *)
+{
+	ScriptingLocalStorage *self = unwrap(ctx, this_val);
+	if (!self)
+		return JS_ThrowTypeError(ctx, "Illegal invocation");
+
+	try {
+		self->ensureLoaded();
+	} catch (const std::exception &e) {
+		return JS_ThrowInternalError(ctx, "LocalStorageError: %s", e.what());
+	}
+
+	self->items_.clear();
+	self->dirty_.clear();
+	self->cleared_ = true;
+	if (!self->dirtySince_) {
+		self->dirtySince_ = std::chrono::steady_clock::now();
+	}
+	return JS_UNDEFINED;
+}
+
+JSValue ScriptingLocalStorage::key(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv)
+{
+	if (argc < 1)
+		return JS_ThrowTypeError(ctx, "Index required");
+
+	ScriptingLocalStorage *self = unwrap(ctx, this_val);
+	if (!self)
+		return JS_ThrowTypeError(ctx, "Illegal invocation");
+
+	std::int64_t index = 0;
+	if (JS_ToInt64(ctx, &index, argv[0]) < 0)
+		return JS_EXCEPTION;
+
+	try {
+		self->ensureLoaded();
+	} catch (const std::exception &e) {
+		return JS_ThrowInternalError(ctx, "LocalStorageError: %s", e.what());
+	}
+
+	if (index < 0 || static_cast<std::uint64_t>(index) >= self->items_.size()) {
+		return JS_NULL;
+	}
+	return newString(ctx, std::next(self->items_.begin(), static_cast<std::ptrdiff_t>(index))->first);
+}
+
+JSValue ScriptingLocalStorage::getLength(JSContext *ctx, JSValueConst this_val)
+{
+	ScriptingLocalStorage *self = unwrap(ctx, this_val);
+	if (!self)
+		return JS_ThrowTypeError(ctx, "Illegal invocation");
+
+	try {
+		self->ensureLoaded();
+	} catch (const std::exception &e) {
+		return JS_ThrowInternalError(ctx, "LocalStorageError: %s", e.what());
+	}
+
+	return JS_NewInt64(ctx, static_cast<std::int64_t>(self->items_.size()));
+}
+
+JSValue ScriptingLocalStorage::constructor(JSContext *ctx, JSValueConst, int, JSValueConst *)
+{
+	return JS_ThrowTypeError(ctx, "Illegal constructor: Storage cannot be instantiated directly.");
+}
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Scripting
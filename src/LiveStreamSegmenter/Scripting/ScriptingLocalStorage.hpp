@@ -0,0 +1,137 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * Live Stream Segmenter - Scripting Module
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include <quickjs.h>
+#include <sqlite3.h>
+
+#include <KaitoTokyo/Logger/ILogger.hpp>
+
+#include "ScriptingRuntime.hpp"
+#include "ScriptingStatementCache.hpp"
+
+namespace KaitoTokyo::LiveStreamSegmenter::Scripting {
+
+/**
+ * Installs globalThis.localStorage, a Web Storage compatible store kept in the __sys_local_storage table.
+ *
+ * The whole table is read into memory on first access, so reads never touch SQLite afterwards. Writes
+ * only update the in-memory copy and mark the key dirty; flush() writes every dirty key in one savepoint.
+ * Not thread-safe: use it on the thread that runs the scripts of its context. Must be destroyed before
+ * the database connection; the destructor flushes what is still dirty.
+ */
+class ScriptingLocalStorage {
+public:
+	ScriptingLocalStorage(std::shared_ptr<ScriptingRuntime> runtime, std::shared_ptr<JSContext> ctx,
+			      std::shared_ptr<const Logger::ILogger> logger, sqlite3 *db,
+			      ScriptingStatementCache &statementCache);
+	~ScriptingLocalStorage() noexcept;
+
+	ScriptingLocalStorage(const ScriptingLocalStorage &) = delete;
+	ScriptingLocalStorage &operator=(const ScriptingLocalStorage &) = delete;
+	ScriptingLocalStorage(ScriptingLocalStorage &&) = delete;
+	ScriptingLocalStorage &operator=(ScriptingLocalStorage &&) = delete;
+
+	void setupContext();
+
+	/**
+	 * Writes the dirty keys in one savepoint. On failure they stay dirty for the next flush and false is
+	 * returned. Returns true without touching SQLite when nothing is dirty.
+	 */
+	bool flush() noexcept;
+
+	/**
+	 * Same as flush(), but only once the oldest unflushed write is at least maxAge old.
+	 */
+	bool flushIfOlderThan(std::chrono::steady_clock::duration maxAge) noexcept;
+
+	/**
+	 * Drops the in-memory copy once another connection, such as the settings dialog, has committed to
+	 * the database since it was read, so the next access reads the table again. Writes not yet flushed
+	 * are laid over what is read, so they are not lost.
+	 */
+	void revalidate() noexcept;
+
+	[[nodiscard]]
+	bool isDirty() const noexcept
+	{
+		return cleared_ || !dirty_.empty();
+	}
+
+	/**
+	 * Reads the table from the database file on a connection of its own, without a JS context, for
+	 * editors outside the scripts. A file or table that does not exist yet reads as empty.
+	 */
+	static std::map<std::string, std::string> readDatabaseFile(const std::filesystem::path &dbPath);
+
+	/**
+	 * Writes changes to the table in the database file in one transaction, on a connection of its own;
+	 * nullopt removes the key. Keys not in changes are left as they are, so values that sessions flushed
+	 * meanwhile survive, and sessions read the changes on their next revalidate().
+	 */
+	static void writeDatabaseFile(const std::filesystem::path &dbPath,
+				      const std::map<std::string, std::optional<std::string>> &changes);
+
+	static JSValue getItem(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv);
+	static JSValue setItem(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv);
+	static JSValue removeItem(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv);
+	static JSValue clear(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv);
+	static JSValue key(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv);
+	static JSValue getLength(JSContext *ctx, JSValueConst this_val);
+	static JSValue constructor(JSContext *ctx, JSValueConst new_target, int argc, JSValueConst *argv);
+
+private:
+	const std::shared_ptr<ScriptingRuntime> runtime_;
+	const std::shared_ptr<JSContext> ctx_;
+	const std::shared_ptr<const Logger::ILogger> logger_;
+	sqlite3 *const db_;
+	ScriptingStatementCache &statementCache_;
+
+	bool loaded_ = false;
+	// PRAGMA data_version when items_ was read; it changes only on commits of other connections.
+	std::int64_t dataVersion_ = 0;
+	std::map<std::string, std::string> items_;
+	// Keys written since the last flush; nullopt marks a removed key.
+	std::map<std::string, std::optional<std::string>> dirty_;
+	// Set by clear(), so the flush empties the table before writing dirty_.
+	bool cleared_ = false;
+	std::optional<std::chrono::steady_clock::time_point> dirtySince_;
+
+	void ensureLoaded();
+	std::int64_t readDataVersion();
+	void markDirty(const std::string &key, std::optional<std::string> value);
+	void writeDirty();
+};
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Scripting
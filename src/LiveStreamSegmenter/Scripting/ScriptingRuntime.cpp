@@ -25,11 +25,26 @@
 
 #include "ScriptingRuntime.hpp"
 
+extern "C" const std::uint32_t qjsc_dayjs_bundle_size;
+extern "C" const std::uint8_t qjsc_dayjs_bundle[];
+extern "C" const std::uint32_t qjsc_ini_bundle_size;
+extern "C" const std::uint8_t qjsc_ini_bundle[];
+extern "C" const std::uint32_t qjsc_youtube_bundle_size;
+extern "C" const std::uint8_t qjsc_youtube_bundle[];
+
 namespace KaitoTokyo::LiveStreamSegmenter::Scripting {
 
-ScriptingRuntime::ScriptingRuntime() : rt_(std::shared_ptr<JSRuntime>(JS_NewRuntime(), JS_FreeRuntime))
+ScriptingRuntime::ScriptingRuntime()
+	: rt_(std::shared_ptr<JSRuntime>(JS_NewRuntime(), JS_FreeRuntime)),
+	  builtinModules_{
+		  {"builtin:dayjs", std::span<const std::uint8_t>(qjsc_dayjs_bundle, qjsc_dayjs_bundle_size)},
+		  {"builtin:ini", std::span<const std::uint8_t>(qjsc_ini_bundle, qjsc_ini_bundle_size)},
+		  {"builtin:youtube", std::span<const std::uint8_t>(qjsc_youtube_bundle, qjsc_youtube_bundle_size)},
+	  }
 {
 	JS_SetRuntimeOpaque(rt_.get(), this);
+	JS_SetModuleLoaderFunc(rt_.get(), nullptr, &ScriptingRuntime::loadBuiltinModule, this);
+	JS_SetInterruptHandler(rt_.get(), &ScriptingRuntime::interruptHandler, this);
 }
 
 ScriptingRuntime::~ScriptingRuntime() = default;
@@ -39,4 +54,75 @@ std::shared_ptr<JSContext> ScriptingRuntime::createContextRaw() const
 	return std::shared_ptr<JSContext>(JS_NewContextRaw(rt_.get()), JS_FreeContext);
 }
 
+void ScriptingRuntime::setLimits(const ScriptingLimits &limits)
+{
+	// QuickJS treats the maximum size as "no limit"; a limit of zero would fail every allocation.
+	JS_SetMemoryLimit(rt_.get(), limits.memoryLimit > 0 ? limits.memoryLimit : static_cast<std::size_t>(-1));
+	if (limits.gcThreshold > 0) {
+		JS_SetGCThreshold(rt_.get(), limits.gcThreshold);
+	}
+	limits_ = limits;
+}
+
+std::optional<std::chrono::steady_clock::time_point> ScriptingRuntime::makeExecutionDeadline() const noexcept
+{
+	if (limits_.executionBudget.count() <= 0) {
+		return std::nullopt;
+	}
+	return std::chrono::steady_clock::now() + limits_.executionBudget;
+}
+
+ScriptingRuntime::ExecutionBudgetScope::ExecutionBudgetScope(
+	ScriptingRuntime &runtime, std::optional<std::chrono::steady_clock::time_point> deadline) noexcept
+	: runtime_(runtime),
+	  previousDeadline_(runtime.deadline_)
+{
+	if (deadline && (!previousDeadline_ || *deadline < *previousDeadline_)) {
+		runtime_.deadline_ = deadline;
+	}
+}
+
+ScriptingRuntime::ExecutionBudgetScope::~ExecutionBudgetScope() noexcept
+{
+	runtime_.deadline_ = previousDeadline_;
+}
+
+bool ScriptingRuntime::ExecutionBudgetScope::isExpired() const noexcept
+{
+	return runtime_.deadline_ && std::chrono::steady_clock::now() >= *runtime_.deadline_;
+}
+
+int ScriptingRuntime::interruptHandler(JSRuntime *, void *opaque) noexcept
+{
+	// QuickJS polls this every few thousand operations, so a clock read here is cheap enough.
+	const auto *self = static_cast<const ScriptingRuntime *>(opaque);
+	return self->deadline_ && std::chrono::steady_clock::now() >= *self->deadline_ ? 1 : 0;
+}
+
+JSModuleDef *ScriptingRuntime::loadBuiltinModule(JSContext *ctx, const char *moduleName, void *opaque) noexcept
+{
+	const auto *self = static_cast<const ScriptingRuntime *>(opaque);
+
+	auto it = self->builtinModules_.find(moduleName);
+	if (it == self->builtinModules_.end()) {
+		JS_ThrowReferenceError(ctx, "could not load module '%s'", moduleName);
+		return nullptr;
+	}
+
+	// The module is not evaluated here; QuickJS evaluates it once per context when the importer runs.
+	JSValue moduleObj = JS_ReadObject(ctx, it->second.data(), it->second.size(), JS_READ_OBJ_BYTECODE);
+	if (JS_IsException(moduleObj)) {
+		return nullptr;
+	} else if (!JS_IsModule(moduleObj)) {
+		JS_FreeValue(ctx, moduleObj);
+		JS_ThrowTypeError(ctx, "builtin module '%s' is not a module", moduleName);
+		return nullptr;
+	}
+
+	// The context keeps the module alive in its module list.
+	JSModuleDef *m = static_cast<JSModuleDef *>(JS_VALUE_GET_PTR(moduleObj));
+	JS_FreeValue(ctx, moduleObj);
+	return m;
+}
+
 } // namespace KaitoTokyo::LiveStreamSegmenter::Scripting
@@ -25,8 +25,12 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <optional>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <typeindex>
@@ -36,6 +40,8 @@
 
 #include <KaitoTokyo/Logger/ILogger.hpp>
 
+#include "ScriptingExecutor.hpp"
+
 namespace KaitoTokyo::LiveStreamSegmenter::Scripting {
 
 class ScopedJSString {
@@ -144,6 +150,25 @@ private:
 	JSValue v_;
 };
 
+/**
+ * Resource limits for scripts running on a ScriptingRuntime. Zero disables a limit.
+ */
+struct ScriptingLimits {
+	// Wall-clock budget for one event handler call, including the promise jobs it queues.
+	std::chrono::milliseconds executionBudget{0};
+	// Cap on the bytes allocated by the whole runtime.
+	std::size_t memoryLimit = 0;
+	// Allocated bytes after which the cycle collector runs; zero keeps the QuickJS default.
+	std::size_t gcThreshold = 0;
+};
+
+/**
+ * Owns the QuickJS runtime shared by all scripting contexts.
+ *
+ * The builtin:dayjs, builtin:ini and builtin:youtube bundles are registered once here and
+ * handed to contexts through the runtime's module loader, so a context only deserializes and
+ * evaluates the bundles its event handler actually imports, and only on first import.
+ */
 class ScriptingRuntime {
 public:
 	ScriptingRuntime();
@@ -156,8 +181,58 @@ public:
 
 	void setLogger(std::shared_ptr<const Logger::ILogger> logger) { logger_ = std::move(logger); }
 
+	/**
+	 * Pins the runtime to one thread. Code that drives scripts hops onto the executor first, so the runtime
+	 * never migrates between threads. Without an executor, callers must serialize their use of the runtime.
+	 * Set it before any context is created.
+	 */
+	void setExecutor(std::shared_ptr<ScriptingExecutor> executor) { executor_ = std::move(executor); }
+
+	/**
+	 * The executor set with setExecutor(), or null.
+	 */
+	ScriptingExecutor *getExecutor() const noexcept { return executor_.get(); }
+
 	std::shared_ptr<JSContext> createContextRaw() const;
 
+	/**
+	 * Arms the runtime's execution budget for as long as it is alive. Code running past the deadline is
+	 * interrupted with an uncatchable exception. Scopes nest; an inner scope never extends an outer one.
+	 */
+	class ExecutionBudgetScope {
+	public:
+		explicit ExecutionBudgetScope(ScriptingRuntime &runtime) noexcept
+			: ExecutionBudgetScope(runtime, runtime.makeExecutionDeadline())
+		{
+		}
+
+		/**
+		 * Arms a deadline taken earlier from makeExecutionDeadline(), for calls that run in several stretches.
+		 */
+		ExecutionBudgetScope(ScriptingRuntime &runtime,
+				     std::optional<std::chrono::steady_clock::time_point> deadline) noexcept;
+		~ExecutionBudgetScope() noexcept;
+
+		ExecutionBudgetScope(const ExecutionBudgetScope &) = delete;
+		ExecutionBudgetScope &operator=(const ExecutionBudgetScope &) = delete;
+		ExecutionBudgetScope(ExecutionBudgetScope &&) = delete;
+		ExecutionBudgetScope &operator=(ExecutionBudgetScope &&) = delete;
+
+		bool isExpired() const noexcept;
+
+	private:
+		ScriptingRuntime &runtime_;
+		const std::optional<std::chrono::steady_clock::time_point> previousDeadline_;
+	};
+
+	void setLimits(const ScriptingLimits &limits);
+	ScriptingLimits getLimits() const noexcept { return limits_; }
+
+	/**
+	 * The deadline for a call starting now, or nullopt when the execution budget is disabled.
+	 */
+	std::optional<std::chrono::steady_clock::time_point> makeExecutionDeadline() const noexcept;
+
 	template<typename T> JSClassID registerCustomClass(const JSClassDef *classDef)
 	{
 		auto it = registeredClasses_.find(std::type_index(typeid(T)));
@@ -190,6 +265,18 @@ public:
 
 	std::shared_ptr<const Logger::ILogger> logger_;
 	mutable std::unordered_map<std::type_index, JSClassID> registeredClasses_;
+
+private:
+	static JSModuleDef *loadBuiltinModule(JSContext *ctx, const char *moduleName, void *opaque) noexcept;
+	static int interruptHandler(JSRuntime *rt, void *opaque) noexcept;
+
+	const std::unordered_map<std::string, std::span<const std::uint8_t>> builtinModules_;
+
+	// Destroyed before rt_, so queued jobs still find the runtime alive.
+	std::shared_ptr<ScriptingExecutor> executor_;
+	ScriptingLimits limits_;
+	// Only touched by the thread running scripts, like the rest of the runtime.
+	std::optional<std::chrono::steady_clock::time_point> deadline_;
 };
 
 } // namespace KaitoTokyo::LiveStreamSegmenter::Scripting
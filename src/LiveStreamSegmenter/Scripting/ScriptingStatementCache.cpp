@@ -0,0 +1,102 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * Live Stream Segmenter - Scripting Module
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ScriptingStatementCache.hpp"
+
+#include <utility>
+
+namespace KaitoTokyo::LiveStreamSegmenter::Scripting {
+
+ScriptingStatementCache::ScriptingStatementCache(sqlite3 *db, std::size_t capacity) noexcept
+	: db_(db),
+	  capacity_(capacity)
+{
+}
+
+ScriptingStatementCache::~ScriptingStatementCache() noexcept
+{
+	for (Entry &entry : entries_) {
+		sqlite3_finalize(entry.stmt);
+	}
+}
+
+ScriptingStatementCache::Lease ScriptingStatementCache::acquire(std::string_view sql)
+{
+	std::string key(sql);
+
+	if (auto it = index_.find(key); it != index_.end()) {
+		sqlite3_stmt *stmt = it->second->stmt;
+		entries_.erase(it->second);
+		index_.erase(it);
+		++stats_.hits;
+		return Lease(this, std::move(key), stmt);
+	}
+
+	++stats_.misses;
+
+	sqlite3_stmt *stmt = nullptr;
+	const unsigned int prepareFlags = capacity_ > 0 ? SQLITE_PREPARE_PERSISTENT : 0;
+	if (sqlite3_prepare_v3(db_, key.c_str(), static_cast<int>(key.size() + 1), prepareFlags, &stmt, nullptr) !=
+		    SQLITE_OK ||
+	    !stmt) {
+		// A null statement without an error means sql held only whitespace or comments.
+		sqlite3_finalize(stmt);
+		return Lease();
+	}
+
+	return Lease(this, std::move(key), stmt);
+}
+
+void ScriptingStatementCache::giveBack(std::string sql, sqlite3_stmt *stmt) noexcept
+{
+	sqlite3_reset(stmt);
+	sqlite3_clear_bindings(stmt);
+
+	if (capacity_ == 0 || index_.contains(sql)) {
+		sqlite3_finalize(stmt);
+		return;
+	}
+
+	try {
+		entries_.push_front(Entry{sql, stmt});
+		index_.emplace(std::move(sql), entries_.begin());
+	} catch (...) {
+		if (!entries_.empty() && entries_.front().stmt == stmt) {
+			entries_.pop_front();
+		}
+		sqlite3_finalize(stmt);
+		return;
+	}
+
+	while (entries_.size() > capacity_) {
+		Entry &oldest = entries_.back();
+		index_.erase(oldest.sql);
+		sqlite3_finalize(oldest.stmt);
+		entries_.pop_back();
+		++stats_.evictions;
+	}
+}
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Scripting
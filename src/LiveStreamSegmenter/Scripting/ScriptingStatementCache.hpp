@@ -0,0 +1,146 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * Live Stream Segmenter - Scripting Module
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+#include <sqlite3.h>
+
+namespace KaitoTokyo::LiveStreamSegmenter::Scripting {
+
+/**
+ * Bounded LRU of prepared statements keyed by SQL text.
+ *
+ * Statements are prepared with SQLITE_PREPARE_PERSISTENT and handed out through a Lease, which
+ * resets them and clears their bindings when it is released. A statement is removed from the
+ * cache while leased, so the same SQL can be leased twice at once; the extra copy is finalized
+ * on release. Not thread-safe, and must be destroyed before the database connection.
+ */
+class ScriptingStatementCache {
+public:
+	static constexpr std::size_t kDefaultCapacity = 32;
+
+	struct Stats {
+		std::uint64_t hits = 0;
+		std::uint64_t misses = 0;
+		std::uint64_t evictions = 0;
+	};
+
+	class Lease {
+	public:
+		Lease() noexcept = default;
+		~Lease() noexcept { release(); }
+
+		Lease(const Lease &) = delete;
+		Lease &operator=(const Lease &) = delete;
+
+		Lease(Lease &&other) noexcept
+			: cache_(std::exchange(other.cache_, nullptr)),
+			  sql_(std::move(other.sql_)),
+			  stmt_(std::exchange(other.stmt_, nullptr))
+		{
+		}
+
+		Lease &operator=(Lease &&other) noexcept
+		{
+			if (this != &other) {
+				release();
+				cache_ = std::exchange(other.cache_, nullptr);
+				sql_ = std::move(other.sql_);
+				stmt_ = std::exchange(other.stmt_, nullptr);
+			}
+			return *this;
+		}
+
+		sqlite3_stmt *get() const noexcept { return stmt_; }
+
+		explicit operator bool() const noexcept { return stmt_ != nullptr; }
+
+	private:
+		friend class ScriptingStatementCache;
+
+		Lease(ScriptingStatementCache *cache, std::string sql, sqlite3_stmt *stmt) noexcept
+			: cache_(cache),
+			  sql_(std::move(sql)),
+			  stmt_(stmt)
+		{
+		}
+
+		void release() noexcept
+		{
+			if (stmt_) {
+				cache_->giveBack(std::move(sql_), std::exchange(stmt_, nullptr));
+			}
+		}
+
+		ScriptingStatementCache *cache_ = nullptr;
+		std::string sql_;
+		sqlite3_stmt *stmt_ = nullptr;
+	};
+
+	explicit ScriptingStatementCache(sqlite3 *db, std::size_t capacity = kDefaultCapacity) noexcept;
+	~ScriptingStatementCache() noexcept;
+
+	ScriptingStatementCache(const ScriptingStatementCache &) = delete;
+	ScriptingStatementCache &operator=(const ScriptingStatementCache &) = delete;
+	ScriptingStatementCache(ScriptingStatementCache &&) = delete;
+	ScriptingStatementCache &operator=(ScriptingStatementCache &&) = delete;
+
+	/**
+	 * Returns the cached statement for sql or prepares a new one. Only the first statement in sql
+	 * is prepared. On failure the lease is empty and sqlite3_errmsg() on the connection has the reason.
+	 */
+	[[nodiscard]]
+	Lease acquire(std::string_view sql);
+
+	Stats getStats() const noexcept { return stats_; }
+
+	std::size_t size() const noexcept { return entries_.size(); }
+
+private:
+	struct Entry {
+		std::string sql;
+		sqlite3_stmt *stmt;
+	};
+
+	void giveBack(std::string sql, sqlite3_stmt *stmt) noexcept;
+
+	sqlite3 *const db_;
+	const std::size_t capacity_;
+
+	// Most recently used first.
+	std::list<Entry> entries_;
+	std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+	Stats stats_;
+};
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Scripting
@@ -1,467 +0,0 @@
-/* File generated automatically by the QuickJS-ng compiler. */
-
-#include <inttypes.h>
-
-const uint32_t qjsc_localstorage_bundle_size = 8246;
-
-const uint8_t qjsc_localstorage_bundle[8246] = {
-	0x15, 0x1e, 0x01, 0x04, 0x64, 0x62, 0x01, 0x14, 0x54, 0x41, 0x42, 0x4c, 0x45, 0x5f, 0x4e, 0x41, 0x4d, 0x45,
-	0x01, 0x24, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x69, 0x61, 0x74, 0x69,
-	0x6f, 0x6e, 0x01, 0x0e, 0x53, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x01, 0x7a, 0x49, 0x6c, 0x6c, 0x65, 0x67,
-	0x61, 0x6c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x6f, 0x72, 0x3a, 0x20, 0x53, 0x74,
-	0x6f, 0x72, 0x61, 0x67, 0x65, 0x20, 0x63, 0x61, 0x6e, 0x6e, 0x6f, 0x74, 0x20, 0x62, 0x65, 0x20, 0x69, 0x6e,
-	0x73, 0x74, 0x61, 0x6e, 0x74, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6c,
-	0x79, 0x2e, 0x01, 0x1e, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x2e, 0x6a,
-	0x73, 0x01, 0x06, 0x72, 0x65, 0x73, 0x01, 0x0a, 0x71, 0x75, 0x65, 0x72, 0x79, 0x01, 0x3c, 0x53, 0x45, 0x4c,
-	0x45, 0x43, 0x54, 0x20, 0x43, 0x4f, 0x55, 0x4e, 0x54, 0x28, 0x2a, 0x29, 0x20, 0x61, 0x73, 0x20, 0x63, 0x6f,
-	0x75, 0x6e, 0x74, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20, 0x01, 0x0a, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x01, 0x02,
-	0x6e, 0x01, 0x20, 0x53, 0x45, 0x4c, 0x45, 0x43, 0x54, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x46, 0x52, 0x4f, 0x4d,
-	0x20, 0x01, 0x22, 0x20, 0x4c, 0x49, 0x4d, 0x49, 0x54, 0x20, 0x31, 0x20, 0x4f, 0x46, 0x46, 0x53, 0x45, 0x54,
-	0x20, 0x3f, 0x01, 0x06, 0x6b, 0x65, 0x79, 0x01, 0x02, 0x6b, 0x01, 0x24, 0x53, 0x45, 0x4c, 0x45, 0x43, 0x54,
-	0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20, 0x01, 0x1c, 0x20, 0x57, 0x48, 0x45,
-	0x52, 0x45, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20, 0x3f, 0x01, 0x02, 0x76, 0x01, 0x0e, 0x65, 0x78, 0x65,
-	0x63, 0x75, 0x74, 0x65, 0x01, 0x2e, 0x49, 0x4e, 0x53, 0x45, 0x52, 0x54, 0x20, 0x4f, 0x52, 0x20, 0x52, 0x45,
-	0x50, 0x4c, 0x41, 0x43, 0x45, 0x20, 0x49, 0x4e, 0x54, 0x4f, 0x20, 0x01, 0x36, 0x20, 0x28, 0x6b, 0x65, 0x79,
-	0x2c, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x29, 0x20, 0x56, 0x41, 0x4c, 0x55, 0x45, 0x53, 0x20, 0x28, 0x3f,
-	0x2c, 0x20, 0x3f, 0x29, 0x01, 0x18, 0x44, 0x45, 0x4c, 0x45, 0x54, 0x45, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20,
-	0x01, 0x26, 0x5f, 0x5f, 0x73, 0x79, 0x73, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x73, 0x74, 0x6f, 0x72,
-	0x61, 0x67, 0x65, 0x01, 0x36, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45, 0x20, 0x54, 0x41, 0x42, 0x4c, 0x45, 0x20,
-	0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45, 0x58, 0x49, 0x53, 0x54, 0x53, 0x20, 0x01, 0x46, 0x20, 0x28,
-	0x6b, 0x65, 0x79, 0x20, 0x54, 0x45, 0x58, 0x54, 0x20, 0x50, 0x52, 0x49, 0x4d, 0x41, 0x52, 0x59, 0x20, 0x4b,
-	0x45, 0x59, 0x2c, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x54, 0x45, 0x58, 0x54, 0x29, 0x01, 0x0e, 0x67,
-	0x65, 0x74, 0x49, 0x74, 0x65, 0x6d, 0x01, 0x0e, 0x73, 0x65, 0x74, 0x49, 0x74, 0x65, 0x6d, 0x01, 0x14, 0x72,
-	0x65, 0x6d, 0x6f, 0x76, 0x65, 0x49, 0x74, 0x65, 0x6d, 0x01, 0x0a, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x01, 0x18,
-	0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x53, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x0c, 0x00, 0x0a, 0x00, 0xa2, 0x01,
-	0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x05, 0x01, 0xa4, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x43, 0x0a, 0x00, 0x00,
-	0x00, 0x06, 0x00, 0x06, 0x00, 0x07, 0xba, 0x01, 0x06, 0xc6, 0x03, 0x01, 0x00, 0x70, 0xc8, 0x03, 0x01, 0x01,
-	0x70, 0xca, 0x03, 0x01, 0x02, 0x60, 0xcc, 0x03, 0x03, 0x06, 0x30, 0xee, 0x01, 0x04, 0x04, 0x70, 0xcc, 0x03,
-	0x01, 0x03, 0x20, 0x0c, 0x42, 0x0b, 0x01, 0x00, 0x00, 0x01, 0x00, 0x03, 0x02, 0x00, 0x25, 0x01, 0x10, 0x00,
-	0x01, 0x00, 0xee, 0x01, 0x04, 0x0d, 0xca, 0x03, 0x02, 0x09, 0x08, 0xcb, 0x2b, 0x66, 0x00, 0x00, 0x11, 0xec,
-	0x06, 0xc7, 0x1b, 0x24, 0x00, 0x00, 0x0e, 0x66, 0x01, 0x00, 0x97, 0xec, 0x10, 0x39, 0xd0, 0x00, 0x00, 0x00,
-	0x11, 0x04, 0xe7, 0x00, 0x00, 0x00, 0x21, 0x01, 0x00, 0x30, 0x29, 0xd0, 0x03, 0x46, 0x05, 0x02, 0x6d, 0x1c,
-	0x94, 0x12, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x20, 0x53, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x20, 0x7b, 0x0a,
-	0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x6f, 0x72, 0x28, 0x29, 0x20,
-	0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
-	0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x69, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x29, 0x20, 0x7b, 0x0a, 0x20,
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x68, 0x72, 0x6f, 0x77, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x54,
-	0x79, 0x70, 0x65, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-	0x20, 0x20, 0x22, 0x49, 0x6c, 0x6c, 0x65, 0x67, 0x61, 0x6c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x72, 0x75,
-	0x63, 0x74, 0x6f, 0x72, 0x3a, 0x20, 0x53, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x20, 0x63, 0x61, 0x6e, 0x6e,
-	0x6f, 0x74, 0x20, 0x62, 0x65, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x69, 0x61, 0x74, 0x65, 0x64,
-	0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6c, 0x79, 0x2e, 0x22, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-	0x20, 0x20, 0x20, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-	0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2a, 0x2a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20,
-	0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72,
-	0x20, 0x6f, 0x66, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x20, 0x73, 0x74, 0x6f,
-	0x72, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65,
-	0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x40, 0x72,
-	0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x7b, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x7d, 0x20, 0x54, 0x68,
-	0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x64,
-	0x20, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x2f, 0x0a, 0x20, 0x20,
-	0x20, 0x20, 0x67, 0x65, 0x74, 0x20, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x28, 0x29, 0x20, 0x7b, 0x0a, 0x20,
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73, 0x20, 0x3d, 0x20, 0x64,
-	0x62, 0x2e, 0x71, 0x75, 0x65, 0x72, 0x79, 0x28, 0x60, 0x53, 0x45, 0x4c, 0x45, 0x43, 0x54, 0x20, 0x43, 0x4f,
-	0x55, 0x4e, 0x54, 0x28, 0x2a, 0x29, 0x20, 0x61, 0x73, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x46, 0x52,
-	0x4f, 0x4d, 0x20, 0x24, 0x7b, 0x54, 0x41, 0x42, 0x4c, 0x45, 0x5f, 0x4e, 0x41, 0x4d, 0x45, 0x7d, 0x60, 0x29,
-	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x72, 0x65, 0x73,
-	0x20, 0x26, 0x26, 0x20, 0x72, 0x65, 0x73, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x3e, 0x20, 0x30,
-	0x20, 0x3f, 0x20, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x28, 0x72, 0x65, 0x73, 0x5b, 0x30, 0x5d, 0x2e, 0x63,
-	0x6f, 0x75, 0x6e, 0x74, 0x29, 0x20, 0x3a, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a,
-	0x20, 0x20, 0x20, 0x20, 0x2f, 0x2a, 0x2a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x52, 0x65, 0x74,
-	0x75, 0x72, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74,
-	0x68, 0x65, 0x20, 0x6e, 0x74, 0x68, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20,
-	0x73, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x40, 0x70,
-	0x61, 0x72, 0x61, 0x6d, 0x20, 0x7b, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x7d, 0x20, 0x6e, 0x20, 0x2d, 0x20,
-	0x54, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6b,
-	0x65, 0x79, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x74, 0x72, 0x69, 0x65, 0x76, 0x65, 0x20, 0x28, 0x30, 0x2d,
-	0x62, 0x61, 0x73, 0x65, 0x64, 0x29, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x40, 0x72, 0x65,
-	0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x7b, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x7c, 0x6e, 0x75, 0x6c, 0x6c,
-	0x7d, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
-	0x6b, 0x65, 0x79, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68,
-	0x65, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x69, 0x73, 0x20, 0x6f, 0x75, 0x74, 0x20, 0x6f, 0x66, 0x20,
-	0x72, 0x61, 0x6e, 0x67, 0x65, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x2f, 0x0a, 0x20, 0x20, 0x20,
-	0x20, 0x6b, 0x65, 0x79, 0x28, 0x6e, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
-	0x20, 0x55, 0x73, 0x65, 0x20, 0x4f, 0x46, 0x46, 0x53, 0x45, 0x54, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x74,
-	0x72, 0x69, 0x65, 0x76, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x74, 0x68, 0x20, 0x6b, 0x65, 0x79, 0x2e,
-	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73, 0x20, 0x3d,
-	0x20, 0x64, 0x62, 0x2e, 0x71, 0x75, 0x65, 0x72, 0x79, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-	0x20, 0x60, 0x53, 0x45, 0x4c, 0x45, 0x43, 0x54, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20,
-	0x24, 0x7b, 0x54, 0x41, 0x42, 0x4c, 0x45, 0x5f, 0x4e, 0x41, 0x4d, 0x45, 0x7d, 0x20, 0x4c, 0x49, 0x4d, 0x49,
-	0x54, 0x20, 0x31, 0x20, 0x4f, 0x46, 0x46, 0x53, 0x45, 0x54, 0x20, 0x3f, 0x60, 0x2c, 0x0a, 0x20, 0x20, 0x20,
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x28, 0x6e, 0x29, 0x2c, 0x0a, 0x20, 0x20,
-	0x20, 0x20, 0x20, 0x20, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
-	0x6e, 0x20, 0x72, 0x65, 0x73, 0x20, 0x26, 0x26, 0x20, 0x72, 0x65, 0x73, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74,
-	0x68, 0x20, 0x3e, 0x20, 0x30, 0x20, 0x3f, 0x20, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x72, 0x65, 0x73,
-	0x5b, 0x30, 0x5d, 0x2e, 0x6b, 0x65, 0x79, 0x29, 0x20, 0x3a, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x3b, 0x0a, 0x20,
-	0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2a, 0x2a, 0x0a, 0x20, 0x20, 0x20, 0x20,
-	0x20, 0x2a, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72,
-	0x72, 0x65, 0x6e, 0x74, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61,
-	0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6e,
-	0x20, 0x6b, 0x65, 0x79, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x40, 0x70, 0x61, 0x72, 0x61,
-	0x6d, 0x20, 0x7b, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x7d, 0x20, 0x6b, 0x20, 0x2d, 0x20, 0x54, 0x68, 0x65,
-	0x20, 0x6b, 0x65, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
-	0x74, 0x6f, 0x20, 0x72, 0x65, 0x74, 0x72, 0x69, 0x65, 0x76, 0x65, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-	0x2a, 0x20, 0x40, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x7b, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
-	0x7c, 0x6e, 0x75, 0x6c, 0x6c, 0x7d, 0x20, 0x54, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x61,
-	0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65,
-	0x20, 0x6b, 0x65, 0x79, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x20, 0x69, 0x66, 0x20, 0x74,
-	0x68, 0x65, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x65, 0x78,
-	0x69, 0x73, 0x74, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x2f, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x67,
-	0x65, 0x74, 0x49, 0x74, 0x65, 0x6d, 0x28, 0x6b, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-	0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73, 0x20, 0x3d, 0x20, 0x64, 0x62, 0x2e, 0x71, 0x75, 0x65,
-	0x72, 0x79, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x60, 0x53, 0x45, 0x4c, 0x45, 0x43,
-	0x54, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20, 0x24, 0x7b, 0x54, 0x41, 0x42,
-	0x4c, 0x45, 0x5f, 0x4e, 0x41, 0x4d, 0x45, 0x7d, 0x20, 0x57, 0x48, 0x45, 0x52, 0x45, 0x20, 0x6b, 0x65, 0x79,
-	0x20, 0x3d, 0x20, 0x3f, 0x60, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x74, 0x72,
-	0x69, 0x6e, 0x67, 0x28, 0x6b, 0x29, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x3b, 0x0a, 0x20,
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x72, 0x65, 0x73, 0x20, 0x26, 0x26,
-	0x20, 0x72, 0x65, 0x73, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x3e, 0x20, 0x30, 0x20, 0x3f, 0x20,
-	0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x72, 0x65, 0x73, 0x5b, 0x30, 0x5d, 0x2e, 0x76, 0x61, 0x6c, 0x75,
-	0x65, 0x29, 0x20, 0x3a, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a,
-	0x20, 0x20, 0x20, 0x20, 0x2f, 0x2a, 0x2a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x41, 0x64, 0x64,
-	0x73, 0x20, 0x61, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
-	0x74, 0x6f, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x75, 0x70, 0x64,
-	0x61, 0x74, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x69, 0x66, 0x20,
-	0x74, 0x68, 0x65, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x61, 0x6c, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x65, 0x78,
-	0x69, 0x73, 0x74, 0x73, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x42, 0x6f, 0x74, 0x68, 0x20,
-	0x6b, 0x65, 0x79, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x61, 0x72, 0x65, 0x20,
-	0x61, 0x75, 0x74, 0x6f, 0x6d, 0x61, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x63, 0x6f, 0x6e, 0x76,
-	0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x0a,
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x40, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x20, 0x7b, 0x73, 0x74, 0x72,
-	0x69, 0x6e, 0x67, 0x7d, 0x20, 0x6b, 0x20, 0x2d, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x20,
-	0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6b, 0x65, 0x79, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a,
-	0x20, 0x40, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x20, 0x7b, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x7d, 0x20, 0x76,
-	0x20, 0x2d, 0x20, 0x54, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x74,
-	0x6f, 0x72, 0x65, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x40, 0x72, 0x65, 0x74, 0x75, 0x72,
-	0x6e, 0x73, 0x20, 0x7b, 0x76, 0x6f, 0x69, 0x64, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x2f, 0x0a,
-	0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x49, 0x74, 0x65, 0x6d, 0x28, 0x6b, 0x2c, 0x20, 0x76, 0x29, 0x20,
-	0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x55, 0x73, 0x65, 0x20, 0x49, 0x4e, 0x53,
-	0x45, 0x52, 0x54, 0x20, 0x4f, 0x52, 0x20, 0x52, 0x45, 0x50, 0x4c, 0x41, 0x43, 0x45, 0x20, 0x74, 0x6f, 0x20,
-	0x61, 0x63, 0x68, 0x69, 0x65, 0x76, 0x65, 0x20, 0x75, 0x70, 0x73, 0x65, 0x72, 0x74, 0x20, 0x62, 0x65, 0x68,
-	0x61, 0x76, 0x69, 0x6f, 0x72, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x62, 0x2e, 0x65, 0x78,
-	0x65, 0x63, 0x75, 0x74, 0x65, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x60, 0x49, 0x4e,
-	0x53, 0x45, 0x52, 0x54, 0x20, 0x4f, 0x52, 0x20, 0x52, 0x45, 0x50, 0x4c, 0x41, 0x43, 0x45, 0x20, 0x49, 0x4e,
-	0x54, 0x4f, 0x20, 0x24, 0x7b, 0x54, 0x41, 0x42, 0x4c, 0x45, 0x5f, 0x4e, 0x41, 0x4d, 0x45, 0x7d, 0x20, 0x28,
-	0x6b, 0x65, 0x79, 0x2c, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x29, 0x20, 0x56, 0x41, 0x4c, 0x55, 0x45, 0x53,
-	0x20, 0x28, 0x3f, 0x2c, 0x20, 0x3f, 0x29, 0x60, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-	0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x6b, 0x29, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-	0x20, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x76, 0x29, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-	0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2a, 0x2a, 0x0a,
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x52, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65,
-	0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x66, 0x72, 0x6f,
-	0x6d, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20,
-	0x40, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x20, 0x7b, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x7d, 0x20, 0x6b, 0x20,
-	0x2d, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
-	0x6b, 0x65, 0x79, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x2e, 0x0a, 0x20, 0x20, 0x20,
-	0x20, 0x20, 0x2a, 0x20, 0x40, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x7b, 0x76, 0x6f, 0x69, 0x64,
-	0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x2f, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x6d, 0x6f,
-	0x76, 0x65, 0x49, 0x74, 0x65, 0x6d, 0x28, 0x6b, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-	0x64, 0x62, 0x2e, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x28, 0x60, 0x44, 0x45, 0x4c, 0x45, 0x54, 0x45,
-	0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20, 0x24, 0x7b, 0x54, 0x41, 0x42, 0x4c, 0x45, 0x5f, 0x4e, 0x41, 0x4d, 0x45,
-	0x7d, 0x20, 0x57, 0x48, 0x45, 0x52, 0x45, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20, 0x3f, 0x60, 0x2c, 0x20,
-	0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x6b, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a,
-	0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2a, 0x2a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x52, 0x65,
-	0x6d, 0x6f, 0x76, 0x65, 0x73, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x6b, 0x65, 0x79, 0x73, 0x20, 0x66, 0x72, 0x6f,
-	0x6d, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20,
-	0x40, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x7b, 0x76, 0x6f, 0x69, 0x64, 0x7d, 0x0a, 0x20, 0x20,
-	0x20, 0x20, 0x20, 0x2a, 0x2f, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x28, 0x29, 0x20,
-	0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x62, 0x2e, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65,
-	0x28, 0x60, 0x44, 0x45, 0x4c, 0x45, 0x54, 0x45, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20, 0x24, 0x7b, 0x54, 0x41,
-	0x42, 0x4c, 0x45, 0x5f, 0x4e, 0x41, 0x4d, 0x45, 0x7d, 0x60, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d,
-	0x0a, 0x20, 0x20, 0x7d, 0x0c, 0x42, 0x0b, 0x01, 0x00, 0x00, 0x01, 0x00, 0x05, 0x02, 0x00, 0x3f, 0x01, 0xd2,
-	0x03, 0x01, 0x00, 0x30, 0xc6, 0x03, 0x00, 0x0d, 0xc8, 0x03, 0x01, 0x0d, 0x62, 0x00, 0x00, 0x66, 0x00, 0x00,
-	0x43, 0xea, 0x00, 0x00, 0x00, 0x04, 0xeb, 0x00, 0x00, 0x00, 0x43, 0x5d, 0x00, 0x00, 0x00, 0x66, 0x01, 0x00,
-	0x24, 0x01, 0x00, 0x24, 0x01, 0x00, 0xcb, 0x63, 0x00, 0x00, 0xec, 0x1a, 0x63, 0x00, 0x00, 0xeb, 0xb6, 0xa9,
-	0xec, 0x12, 0x39, 0x97, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0xb6, 0x48, 0x42, 0xec, 0x00, 0x00, 0x00, 0xf1,
-	0x28, 0xb6, 0x28, 0xd0, 0x03, 0x52, 0x09, 0x06, 0x3a, 0x1a, 0x94, 0x18, 0x2f, 0x16, 0x9e, 0x01, 0x67, 0x65,
-	0x74, 0x20, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x28, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-	0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73, 0x20, 0x3d, 0x20, 0x64, 0x62, 0x2e, 0x71, 0x75,
-	0x65, 0x72, 0x79, 0x28, 0x60, 0x53, 0x45, 0x4c, 0x45, 0x43, 0x54, 0x20, 0x43, 0x4f, 0x55, 0x4e, 0x54, 0x28,
-	0x2a, 0x29, 0x20, 0x61, 0x73, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20, 0x24,
-	0x7b, 0x54, 0x41, 0x42, 0x4c, 0x45, 0x5f, 0x4e, 0x41, 0x4d, 0x45, 0x7d, 0x60, 0x29, 0x3b, 0x0a, 0x20, 0x20,
-	0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x72, 0x65, 0x73, 0x20, 0x26, 0x26, 0x20,
-	0x72, 0x65, 0x73, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x3e, 0x20, 0x30, 0x20, 0x3f, 0x20, 0x4e,
-	0x75, 0x6d, 0x62, 0x65, 0x72, 0x28, 0x72, 0x65, 0x73, 0x5b, 0x30, 0x5d, 0x2e, 0x63, 0x6f, 0x75, 0x6e, 0x74,
-	0x29, 0x20, 0x3a, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0c, 0x42, 0x0b, 0x01, 0x00, 0x01,
-	0x01, 0x01, 0x06, 0x02, 0x00, 0x4b, 0x02, 0xda, 0x03, 0x00, 0x01, 0x00, 0xd2, 0x03, 0x01, 0x00, 0x30, 0xc6,
-	0x03, 0x00, 0x0d, 0xc8, 0x03, 0x01, 0x0d, 0x62, 0x00, 0x00, 0x66, 0x00, 0x00, 0x43, 0xea, 0x00, 0x00, 0x00,
-	0x04, 0xee, 0x00, 0x00, 0x00, 0x43, 0x5d, 0x00, 0x00, 0x00, 0x66, 0x01, 0x00, 0x04, 0xef, 0x00, 0x00, 0x00,
-	0x24, 0x02, 0x00, 0x39, 0x97, 0x00, 0x00, 0x00, 0xd3, 0xf1, 0x24, 0x02, 0x00, 0xcb, 0x63, 0x00, 0x00, 0xec,
-	0x1a, 0x63, 0x00, 0x00, 0xeb, 0xb6, 0xa9, 0xec, 0x12, 0x39, 0x98, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0xb6,
-	0x48, 0x42, 0xf0, 0x00, 0x00, 0x00, 0xf1, 0x28, 0x07, 0x28, 0xd0, 0x03, 0x5c, 0x05, 0x08, 0x3c, 0x08, 0x85,
-	0x0e, 0x4f, 0x24, 0x2f, 0x16, 0xed, 0x01, 0x6b, 0x65, 0x79, 0x28, 0x6e, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20,
-	0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x55, 0x73, 0x65, 0x20, 0x4f, 0x46, 0x46, 0x53, 0x45, 0x54, 0x20,
-	0x74, 0x6f, 0x20, 0x72, 0x65, 0x74, 0x72, 0x69, 0x65, 0x76, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x74,
-	0x68, 0x20, 0x6b, 0x65, 0x79, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
-	0x20, 0x72, 0x65, 0x73, 0x20, 0x3d, 0x20, 0x64, 0x62, 0x2e, 0x71, 0x75, 0x65, 0x72, 0x79, 0x28, 0x0a, 0x20,
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x60, 0x53, 0x45, 0x4c, 0x45, 0x43, 0x54, 0x20, 0x6b, 0x65, 0x79,
-	0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20, 0x24, 0x7b, 0x54, 0x41, 0x42, 0x4c, 0x45, 0x5f, 0x4e, 0x41, 0x4d, 0x45,
-	0x7d, 0x20, 0x4c, 0x49, 0x4d, 0x49, 0x54, 0x20, 0x31, 0x20, 0x4f, 0x46, 0x46, 0x53, 0x45, 0x54, 0x20, 0x3f,
-	0x60, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x28,
-	0x6e, 0x29, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-	0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x72, 0x65, 0x73, 0x20, 0x26, 0x26, 0x20, 0x72, 0x65, 0x73,
-	0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x3e, 0x20, 0x30, 0x20, 0x3f, 0x20, 0x53, 0x74, 0x72, 0x69,
-	0x6e, 0x67, 0x28, 0x72, 0x65, 0x73, 0x5b, 0x30, 0x5d, 0x2e, 0x6b, 0x65, 0x79, 0x29, 0x20, 0x3a, 0x20, 0x6e,
-	0x75, 0x6c, 0x6c, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0c, 0x42, 0x0b, 0x01, 0x00, 0x01, 0x01, 0x01,
-	0x06, 0x02, 0x00, 0x4b, 0x02, 0xe2, 0x03, 0x00, 0x01, 0x00, 0xd2, 0x03, 0x01, 0x00, 0x30, 0xc6, 0x03, 0x00,
-	0x0d, 0xc8, 0x03, 0x01, 0x0d, 0x62, 0x00, 0x00, 0x66, 0x00, 0x00, 0x43, 0xea, 0x00, 0x00, 0x00, 0x04, 0xf2,
-	0x00, 0x00, 0x00, 0x43, 0x5d, 0x00, 0x00, 0x00, 0x66, 0x01, 0x00, 0x04, 0xf3, 0x00, 0x00, 0x00, 0x24, 0x02,
-	0x00, 0x39, 0x98, 0x00, 0x00, 0x00, 0xd3, 0xf1, 0x24, 0x02, 0x00, 0xcb, 0x63, 0x00, 0x00, 0xec, 0x1a, 0x63,
-	0x00, 0x00, 0xeb, 0xb6, 0xa9, 0xec, 0x12, 0x39, 0x98, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0xb6, 0x48, 0x42,
-	0x41, 0x00, 0x00, 0x00, 0xf1, 0x28, 0x07, 0x28, 0xd0, 0x03, 0x6a, 0x05, 0x08, 0x3b, 0x08, 0x85, 0x0e, 0x4f,
-	0x24, 0x2f, 0x16, 0xc5, 0x01, 0x67, 0x65, 0x74, 0x49, 0x74, 0x65, 0x6d, 0x28, 0x6b, 0x29, 0x20, 0x7b, 0x0a,
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73, 0x20, 0x3d, 0x20,
-	0x64, 0x62, 0x2e, 0x71, 0x75, 0x65, 0x72, 0x79, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-	0x60, 0x53, 0x45, 0x4c, 0x45, 0x43, 0x54, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x46, 0x52, 0x4f, 0x4d,
-	0x20, 0x24, 0x7b, 0x54, 0x41, 0x42, 0x4c, 0x45, 0x5f, 0x4e, 0x41, 0x4d, 0x45, 0x7d, 0x20, 0x57, 0x48, 0x45,
-	0x52, 0x45, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20, 0x3f, 0x60, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-	0x20, 0x20, 0x20, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x6b, 0x29, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
-	0x20, 0x20, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20,
-	0x72, 0x65, 0x73, 0x20, 0x26, 0x26, 0x20, 0x72, 0x65, 0x73, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20,
-	0x3e, 0x20, 0x30, 0x20, 0x3f, 0x20, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x72, 0x65, 0x73, 0x5b, 0x30,
-	0x5d, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x29, 0x20, 0x3a, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x3b, 0x0a, 0x20,
-	0x20, 0x20, 0x20, 0x7d, 0x0c, 0x42, 0x0b, 0x01, 0x00, 0x02, 0x00, 0x02, 0x06, 0x02, 0x00, 0x2f, 0x02, 0xe2,
-	0x03, 0x00, 0x01, 0x00, 0xe8, 0x03, 0x00, 0x01, 0x00, 0xc6, 0x03, 0x00, 0x0d, 0xc8, 0x03, 0x01, 0x0d, 0x66,
-	0x00, 0x00, 0x43, 0xf5, 0x00, 0x00, 0x00, 0x04, 0xf6, 0x00, 0x00, 0x00, 0x43, 0x5d, 0x00, 0x00, 0x00, 0x66,
-	0x01, 0x00, 0x04, 0xf7, 0x00, 0x00, 0x00, 0x24, 0x02, 0x00, 0x39, 0x98, 0x00, 0x00, 0x00, 0xd3, 0xf1, 0x39,
-	0x98, 0x00, 0x00, 0x00, 0xd4, 0xf1, 0x24, 0x03, 0x00, 0x29, 0xd0, 0x03, 0x79, 0x05, 0x08, 0x04, 0x04, 0x2b,
-	0x04, 0x85, 0x0e, 0x26, 0x00, 0xdc, 0x01, 0x73, 0x65, 0x74, 0x49, 0x74, 0x65, 0x6d, 0x28, 0x6b, 0x2c, 0x20,
-	0x76, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x55, 0x73, 0x65, 0x20,
-	0x49, 0x4e, 0x53, 0x45, 0x52, 0x54, 0x20, 0x4f, 0x52, 0x20, 0x52, 0x45, 0x50, 0x4c, 0x41, 0x43, 0x45, 0x20,
-	0x74, 0x6f, 0x20, 0x61, 0x63, 0x68, 0x69, 0x65, 0x76, 0x65, 0x20, 0x75, 0x70, 0x73, 0x65, 0x72, 0x74, 0x20,
-	0x62, 0x65, 0x68, 0x61, 0x76, 0x69, 0x6f, 0x72, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x62,
-	0x2e, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-	0x60, 0x49, 0x4e, 0x53, 0x45, 0x52, 0x54, 0x20, 0x4f, 0x52, 0x20, 0x52, 0x45, 0x50, 0x4c, 0x41, 0x43, 0x45,
-	0x20, 0x49, 0x4e, 0x54, 0x4f, 0x20, 0x24, 0x7b, 0x54, 0x41, 0x42, 0x4c, 0x45, 0x5f, 0x4e, 0x41, 0x4d, 0x45,
-	0x7d, 0x20, 0x28, 0x6b, 0x65, 0x79, 0x2c, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x29, 0x20, 0x56, 0x41, 0x4c,
-	0x55, 0x45, 0x53, 0x20, 0x28, 0x3f, 0x2c, 0x20, 0x3f, 0x29, 0x60, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-	0x20, 0x20, 0x20, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x6b, 0x29, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
-	0x20, 0x20, 0x20, 0x20, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x76, 0x29, 0x2c, 0x0a, 0x20, 0x20, 0x20,
-	0x20, 0x20, 0x20, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0c, 0x42, 0x0b, 0x01, 0x00, 0x01, 0x00,
-	0x01, 0x06, 0x02, 0x00, 0x28, 0x01, 0xe2, 0x03, 0x00, 0x01, 0x00, 0xc6, 0x03, 0x00, 0x0d, 0xc8, 0x03, 0x01,
-	0x0d, 0x66, 0x00, 0x00, 0x43, 0xf5, 0x00, 0x00, 0x00, 0x04, 0xf8, 0x00, 0x00, 0x00, 0x43, 0x5d, 0x00, 0x00,
-	0x00, 0x66, 0x01, 0x00, 0x04, 0xf3, 0x00, 0x00, 0x00, 0x24, 0x02, 0x00, 0x39, 0x98, 0x00, 0x00, 0x00, 0xd3,
-	0xf1, 0x24, 0x02, 0x00, 0x29, 0xd0, 0x03, 0x87, 0x01, 0x05, 0x06, 0x03, 0x04, 0x2a, 0x06, 0x84, 0x74, 0x5d,
-	0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x49, 0x74, 0x65, 0x6d, 0x28, 0x6b, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20,
-	0x20, 0x20, 0x20, 0x20, 0x64, 0x62, 0x2e, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x28, 0x60, 0x44, 0x45,
-	0x4c, 0x45, 0x54, 0x45, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20, 0x24, 0x7b, 0x54, 0x41, 0x42, 0x4c, 0x45, 0x5f,
-	0x4e, 0x41, 0x4d, 0x45, 0x7d, 0x20, 0x57, 0x48, 0x45, 0x52, 0x45, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20,
-	0x3f, 0x60, 0x2c, 0x20, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x6b, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20,
-	0x20, 0x20, 0x7d, 0x0c, 0x42, 0x0b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x1c, 0x00, 0xc6, 0x03,
-	0x00, 0x0d, 0xc8, 0x03, 0x01, 0x0d, 0x66, 0x00, 0x00, 0x43, 0xf5, 0x00, 0x00, 0x00, 0x04, 0xf8, 0x00, 0x00,
-	0x00, 0x43, 0x5d, 0x00, 0x00, 0x00, 0x66, 0x01, 0x00, 0x24, 0x01, 0x00, 0x24, 0x01, 0x00, 0x29, 0xd0, 0x03,
-	0x8f, 0x01, 0x05, 0x04, 0x03, 0x04, 0x2a, 0x06, 0x3e, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x28, 0x29, 0x20, 0x7b,
-	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x62, 0x2e, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x28,
-	0x60, 0x44, 0x45, 0x4c, 0x45, 0x54, 0x45, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20, 0x24, 0x7b, 0x54, 0x41, 0x42,
-	0x4c, 0x45, 0x5f, 0x4e, 0x41, 0x4d, 0x45, 0x7d, 0x60, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x62,
-	0x05, 0x00, 0x62, 0x02, 0x00, 0x62, 0x01, 0x00, 0x62, 0x00, 0x00, 0x39, 0x8d, 0x00, 0x00, 0x00, 0x42, 0xe3,
-	0x00, 0x00, 0x00, 0xcb, 0x63, 0x00, 0x00, 0xf6, 0xec, 0x02, 0x29, 0x04, 0xf9, 0x00, 0x00, 0x00, 0xcc, 0x63,
-	0x00, 0x00, 0x43, 0xf5, 0x00, 0x00, 0x00, 0x04, 0xfa, 0x00, 0x00, 0x00, 0x43, 0x5d, 0x00, 0x00, 0x00, 0x63,
-	0x01, 0x00, 0x04, 0xfb, 0x00, 0x00, 0x00, 0x24, 0x02, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x09, 0xcd, 0x62, 0x03,
-	0x00, 0x06, 0x62, 0x04, 0x00, 0xc0, 0x00, 0x57, 0xe6, 0x00, 0x00, 0x00, 0x00, 0xc1, 0x01, 0x55, 0x32, 0x00,
-	0x00, 0x00, 0x01, 0xc1, 0x02, 0x55, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xc1, 0x03, 0x55, 0xfc, 0x00, 0x00, 0x00,
-	0x00, 0xc1, 0x04, 0x55, 0xfd, 0x00, 0x00, 0x00, 0x00, 0xc1, 0x05, 0x55, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xc1,
-	0x06, 0x55, 0xff, 0x00, 0x00, 0x00, 0x00, 0x06, 0xc4, 0x04, 0x0e, 0xd2, 0x69, 0x04, 0x00, 0xc4, 0x05, 0x39,
-	0x8d, 0x00, 0x00, 0x00, 0x63, 0x05, 0x00, 0x44, 0xe6, 0x00, 0x00, 0x00, 0x0a, 0x11, 0x64, 0x02, 0x00, 0x0e,
-	0x39, 0x8d, 0x00, 0x00, 0x00, 0x63, 0x05, 0x00, 0x11, 0x21, 0x00, 0x00, 0x44, 0x00, 0x01, 0x00, 0x00, 0x09,
-	0x11, 0x64, 0x02, 0x00, 0x29, 0xd0, 0x03, 0x29, 0x02, 0x17, 0x00, 0x1a, 0x12, 0x26, 0x00, 0x0a, 0x0e, 0x23,
-	0x2b, 0x04, 0x00, 0x64, 0xb8, 0x01, 0x03, 0x46, 0x00, 0x22, 0x00, 0x1b, 0x3c, 0x3f, 0x3b, 0xc9, 0x1b, 0x66,
-	0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x28, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x2f, 0x2a, 0x2a,
-	0x0a, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x52, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x74, 0x6f,
-	0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x64, 0x62, 0x20, 0x6f, 0x62, 0x6a,
-	0x65, 0x63, 0x74, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x40, 0x74, 0x79, 0x70, 0x65, 0x20, 0x7b, 0x53,
-	0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6e, 0x67, 0x44, 0x61, 0x74, 0x61, 0x62, 0x61, 0x73, 0x65, 0x7d, 0x0a,
-	0x20, 0x20, 0x20, 0x2a, 0x2f, 0x0a, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x40, 0x74, 0x73, 0x2d, 0x69, 0x67, 0x6e,
-	0x6f, 0x72, 0x65, 0x20, 0x28, 0x64, 0x62, 0x20, 0x69, 0x73, 0x20, 0x69, 0x6e, 0x6a, 0x65, 0x63, 0x74, 0x65,
-	0x64, 0x20, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x43, 0x2b,
-	0x2b, 0x2c, 0x20, 0x73, 0x6f, 0x20, 0x69, 0x67, 0x6e, 0x6f, 0x72, 0x65, 0x20, 0x54, 0x53, 0x20, 0x63, 0x68,
-	0x65, 0x63, 0x6b, 0x73, 0x29, 0x0a, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x64, 0x62, 0x20, 0x3d,
-	0x20, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x54, 0x68, 0x69, 0x73, 0x2e, 0x64, 0x62, 0x3b, 0x0a, 0x0a, 0x20,
-	0x20, 0x2f, 0x2f, 0x20, 0x44, 0x6f, 0x20, 0x6e, 0x6f, 0x74, 0x68, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x66, 0x20,
-	0x74, 0x68, 0x65, 0x20, 0x64, 0x62, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x20, 0x69, 0x73, 0x20, 0x75,
-	0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x28, 0x65, 0x2e, 0x67, 0x2e, 0x20, 0x73, 0x65, 0x72,
-	0x76, 0x65, 0x72, 0x2d, 0x73, 0x69, 0x64, 0x65, 0x20, 0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x69, 0x6e, 0x67,
-	0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x78, 0x74, 0x29, 0x2e, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x74,
-	0x79, 0x70, 0x65, 0x6f, 0x66, 0x20, 0x64, 0x62, 0x20, 0x3d, 0x3d, 0x3d, 0x20, 0x22, 0x75, 0x6e, 0x64, 0x65,
-	0x66, 0x69, 0x6e, 0x65, 0x64, 0x22, 0x29, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x0a, 0x0a, 0x20,
-	0x20, 0x2f, 0x2f, 0x20, 0x50, 0x72, 0x65, 0x66, 0x69, 0x78, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x76, 0x6f, 0x69,
-	0x64, 0x20, 0x63, 0x6f, 0x6e, 0x66, 0x6c, 0x69, 0x63, 0x74, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x75,
-	0x73, 0x65, 0x72, 0x2d, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x73,
-	0x20, 0x6f, 0x72, 0x20, 0x53, 0x51, 0x4c, 0x69, 0x74, 0x65, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x20,
-	0x74, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x2e, 0x0a, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x54, 0x41,
-	0x42, 0x4c, 0x45, 0x5f, 0x4e, 0x41, 0x4d, 0x45, 0x20, 0x3d, 0x20, 0x22, 0x5f, 0x5f, 0x73, 0x79, 0x73, 0x5f,
-	0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x22, 0x3b, 0x0a, 0x0a, 0x20,
-	0x20, 0x2f, 0x2f, 0x20, 0x49, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x20, 0x74, 0x68, 0x65,
-	0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x2e, 0x0a, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x4b, 0x65, 0x79, 0x73, 0x20,
-	0x61, 0x6e, 0x64, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x74, 0x6f,
-	0x72, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x74, 0x6f, 0x20,
-	0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x79, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x57, 0x65,
-	0x62, 0x20, 0x53, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x20, 0x41, 0x50, 0x49, 0x20, 0x73, 0x70, 0x65, 0x63,
-	0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x0a, 0x20, 0x20, 0x64, 0x62, 0x2e, 0x65, 0x78,
-	0x65, 0x63, 0x75, 0x74, 0x65, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x60, 0x43, 0x52, 0x45, 0x41, 0x54, 0x45,
-	0x20, 0x54, 0x41, 0x42, 0x4c, 0x45, 0x20, 0x49, 0x46, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x45, 0x58, 0x49, 0x53,
-	0x54, 0x53, 0x20, 0x24, 0x7b, 0x54, 0x41, 0x42, 0x4c, 0x45, 0x5f, 0x4e, 0x41, 0x4d, 0x45, 0x7d, 0x20, 0x28,
-	0x6b, 0x65, 0x79, 0x20, 0x54, 0x45, 0x58, 0x54, 0x20, 0x50, 0x52, 0x49, 0x4d, 0x41, 0x52, 0x59, 0x20, 0x4b,
-	0x45, 0x59, 0x2c, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x54, 0x45, 0x58, 0x54, 0x29, 0x60, 0x2c, 0x0a,
-	0x20, 0x20, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x6e, 0x61,
-	0x6c, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x20, 0x74, 0x6f, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x20,
-	0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x69, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x0a, 0x20, 0x20, 0x6c,
-	0x65, 0x74, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x69, 0x61, 0x74,
-	0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x2f, 0x2a,
-	0x2a, 0x0a, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x49, 0x6d, 0x70, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x61, 0x74,
-	0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x57, 0x65, 0x62, 0x20, 0x53, 0x74, 0x6f,
-	0x72, 0x61, 0x67, 0x65, 0x20, 0x41, 0x50, 0x49, 0x27, 0x73, 0x20, 0x53, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65,
-	0x20, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x66, 0x61, 0x63, 0x65, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x55,
-	0x73, 0x65, 0x73, 0x20, 0x53, 0x51, 0x4c, 0x69, 0x74, 0x65, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x62, 0x61,
-	0x63, 0x6b, 0x65, 0x6e, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x70, 0x65, 0x72, 0x73, 0x69, 0x73, 0x74, 0x20, 0x64,
-	0x61, 0x74, 0x61, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x40, 0x69, 0x6d, 0x70, 0x6c, 0x65, 0x6d, 0x65,
-	0x6e, 0x74, 0x73, 0x20, 0x7b, 0x53, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x2a,
-	0x2f, 0x0a, 0x20, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x20, 0x53, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x20,
-	0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x6f, 0x72, 0x28,
-	0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x61, 0x6c, 0x6c,
-	0x6f, 0x77, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x69, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x29, 0x20, 0x7b,
-	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x68, 0x72, 0x6f, 0x77, 0x20, 0x6e, 0x65, 0x77,
-	0x20, 0x54, 0x79, 0x70, 0x65, 0x45, 0x72, 0x72, 0x6f, 0x72, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-	0x20, 0x20, 0x20, 0x20, 0x22, 0x49, 0x6c, 0x6c, 0x65, 0x67, 0x61, 0x6c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
-	0x72, 0x75, 0x63, 0x74, 0x6f, 0x72, 0x3a, 0x20, 0x53, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x20, 0x63, 0x61,
-	0x6e, 0x6e, 0x6f, 0x74, 0x20, 0x62, 0x65, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x69, 0x61, 0x74,
-	0x65, 0x64, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6c, 0x79, 0x2e, 0x22, 0x2c, 0x0a, 0x20, 0x20, 0x20,
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20,
-	0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2a, 0x2a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-	0x2a, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62,
-	0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x20, 0x73,
-	0x74, 0x6f, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x74, 0x6f, 0x72, 0x61,
-	0x67, 0x65, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20,
-	0x40, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x7b, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x7d, 0x20,
-	0x54, 0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x74, 0x6f, 0x72,
-	0x65, 0x64, 0x20, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x2f, 0x0a,
-	0x20, 0x20, 0x20, 0x20, 0x67, 0x65, 0x74, 0x20, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x28, 0x29, 0x20, 0x7b,
-	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73, 0x20, 0x3d,
-	0x20, 0x64, 0x62, 0x2e, 0x71, 0x75, 0x65, 0x72, 0x79, 0x28, 0x60, 0x53, 0x45, 0x4c, 0x45, 0x43, 0x54, 0x20,
-	0x43, 0x4f, 0x55, 0x4e, 0x54, 0x28, 0x2a, 0x29, 0x20, 0x61, 0x73, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20,
-	0x46, 0x52, 0x4f, 0x4d, 0x20, 0x24, 0x7b, 0x54, 0x41, 0x42, 0x4c, 0x45, 0x5f, 0x4e, 0x41, 0x4d, 0x45, 0x7d,
-	0x60, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x72,
-	0x65, 0x73, 0x20, 0x26, 0x26, 0x20, 0x72, 0x65, 0x73, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x3e,
-	0x20, 0x30, 0x20, 0x3f, 0x20, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x28, 0x72, 0x65, 0x73, 0x5b, 0x30, 0x5d,
-	0x2e, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x29, 0x20, 0x3a, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d,
-	0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2a, 0x2a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x52,
-	0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x6f, 0x66,
-	0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x74, 0x68, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68,
-	0x65, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20,
-	0x40, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x20, 0x7b, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x7d, 0x20, 0x6e, 0x20,
-	0x2d, 0x20, 0x54, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65,
-	0x20, 0x6b, 0x65, 0x79, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x74, 0x72, 0x69, 0x65, 0x76, 0x65, 0x20, 0x28,
-	0x30, 0x2d, 0x62, 0x61, 0x73, 0x65, 0x64, 0x29, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x40,
-	0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x7b, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x7c, 0x6e, 0x75,
-	0x6c, 0x6c, 0x7d, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
-	0x65, 0x20, 0x6b, 0x65, 0x79, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x20, 0x69, 0x66, 0x20,
-	0x74, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x69, 0x73, 0x20, 0x6f, 0x75, 0x74, 0x20, 0x6f,
-	0x66, 0x20, 0x72, 0x61, 0x6e, 0x67, 0x65, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x2f, 0x0a, 0x20,
-	0x20, 0x20, 0x20, 0x6b, 0x65, 0x79, 0x28, 0x6e, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-	0x2f, 0x2f, 0x20, 0x55, 0x73, 0x65, 0x20, 0x4f, 0x46, 0x46, 0x53, 0x45, 0x54, 0x20, 0x74, 0x6f, 0x20, 0x72,
-	0x65, 0x74, 0x72, 0x69, 0x65, 0x76, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x74, 0x68, 0x20, 0x6b, 0x65,
-	0x79, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73,
-	0x20, 0x3d, 0x20, 0x64, 0x62, 0x2e, 0x71, 0x75, 0x65, 0x72, 0x79, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-	0x20, 0x20, 0x20, 0x60, 0x53, 0x45, 0x4c, 0x45, 0x43, 0x54, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x46, 0x52, 0x4f,
-	0x4d, 0x20, 0x24, 0x7b, 0x54, 0x41, 0x42, 0x4c, 0x45, 0x5f, 0x4e, 0x41, 0x4d, 0x45, 0x7d, 0x20, 0x4c, 0x49,
-	0x4d, 0x49, 0x54, 0x20, 0x31, 0x20, 0x4f, 0x46, 0x46, 0x53, 0x45, 0x54, 0x20, 0x3f, 0x60, 0x2c, 0x0a, 0x20,
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x28, 0x6e, 0x29, 0x2c, 0x0a,
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74,
-	0x75, 0x72, 0x6e, 0x20, 0x72, 0x65, 0x73, 0x20, 0x26, 0x26, 0x20, 0x72, 0x65, 0x73, 0x2e, 0x6c, 0x65, 0x6e,
-	0x67, 0x74, 0x68, 0x20, 0x3e, 0x20, 0x30, 0x20, 0x3f, 0x20, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x72,
-	0x65, 0x73, 0x5b, 0x30, 0x5d, 0x2e, 0x6b, 0x65, 0x79, 0x29, 0x20, 0x3a, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x3b,
-	0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2a, 0x2a, 0x0a, 0x20, 0x20,
-	0x20, 0x20, 0x20, 0x2a, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63,
-	0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x61, 0x73, 0x73, 0x6f, 0x63,
-	0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76,
-	0x65, 0x6e, 0x20, 0x6b, 0x65, 0x79, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x40, 0x70, 0x61,
-	0x72, 0x61, 0x6d, 0x20, 0x7b, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x7d, 0x20, 0x6b, 0x20, 0x2d, 0x20, 0x54,
-	0x68, 0x65, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75,
-	0x65, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x74, 0x72, 0x69, 0x65, 0x76, 0x65, 0x2e, 0x0a, 0x20, 0x20, 0x20,
-	0x20, 0x20, 0x2a, 0x20, 0x40, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x7b, 0x73, 0x74, 0x72, 0x69,
-	0x6e, 0x67, 0x7c, 0x6e, 0x75, 0x6c, 0x6c, 0x7d, 0x20, 0x54, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65,
-	0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74,
-	0x68, 0x65, 0x20, 0x6b, 0x65, 0x79, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x20, 0x69, 0x66,
-	0x20, 0x74, 0x68, 0x65, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20,
-	0x65, 0x78, 0x69, 0x73, 0x74, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x2f, 0x0a, 0x20, 0x20, 0x20,
-	0x20, 0x67, 0x65, 0x74, 0x49, 0x74, 0x65, 0x6d, 0x28, 0x6b, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-	0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x72, 0x65, 0x73, 0x20, 0x3d, 0x20, 0x64, 0x62, 0x2e, 0x71,
-	0x75, 0x65, 0x72, 0x79, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x60, 0x53, 0x45, 0x4c,
-	0x45, 0x43, 0x54, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20, 0x24, 0x7b, 0x54,
-	0x41, 0x42, 0x4c, 0x45, 0x5f, 0x4e, 0x41, 0x4d, 0x45, 0x7d, 0x20, 0x57, 0x48, 0x45, 0x52, 0x45, 0x20, 0x6b,
-	0x65, 0x79, 0x20, 0x3d, 0x20, 0x3f, 0x60, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53,
-	0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x6b, 0x29, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x3b,
-	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x72, 0x65, 0x73, 0x20,
-	0x26, 0x26, 0x20, 0x72, 0x65, 0x73, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x3e, 0x20, 0x30, 0x20,
-	0x3f, 0x20, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x72, 0x65, 0x73, 0x5b, 0x30, 0x5d, 0x2e, 0x76, 0x61,
-	0x6c, 0x75, 0x65, 0x29, 0x20, 0x3a, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d,
-	0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2a, 0x2a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x41,
-	0x64, 0x64, 0x73, 0x20, 0x61, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x76, 0x61, 0x6c, 0x75,
-	0x65, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x75,
-	0x70, 0x64, 0x61, 0x74, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x69,
-	0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x61, 0x6c, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20,
-	0x65, 0x78, 0x69, 0x73, 0x74, 0x73, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x42, 0x6f, 0x74,
-	0x68, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x61, 0x72,
-	0x65, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x6d, 0x61, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x63, 0x6f,
-	0x6e, 0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x73,
-	0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x40, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x20, 0x7b, 0x73,
-	0x74, 0x72, 0x69, 0x6e, 0x67, 0x7d, 0x20, 0x6b, 0x20, 0x2d, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6e, 0x61, 0x6d,
-	0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6b, 0x65, 0x79, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20,
-	0x20, 0x2a, 0x20, 0x40, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x20, 0x7b, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x7d,
-	0x20, 0x76, 0x20, 0x2d, 0x20, 0x54, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x74, 0x6f, 0x20,
-	0x73, 0x74, 0x6f, 0x72, 0x65, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x40, 0x72, 0x65, 0x74,
-	0x75, 0x72, 0x6e, 0x73, 0x20, 0x7b, 0x76, 0x6f, 0x69, 0x64, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a,
-	0x2f, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x49, 0x74, 0x65, 0x6d, 0x28, 0x6b, 0x2c, 0x20, 0x76,
-	0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x55, 0x73, 0x65, 0x20, 0x49,
-	0x4e, 0x53, 0x45, 0x52, 0x54, 0x20, 0x4f, 0x52, 0x20, 0x52, 0x45, 0x50, 0x4c, 0x41, 0x43, 0x45, 0x20, 0x74,
-	0x6f, 0x20, 0x61, 0x63, 0x68, 0x69, 0x65, 0x76, 0x65, 0x20, 0x75, 0x70, 0x73, 0x65, 0x72, 0x74, 0x20, 0x62,
-	0x65, 0x68, 0x61, 0x76, 0x69, 0x6f, 0x72, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x62, 0x2e,
-	0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x60,
-	0x49, 0x4e, 0x53, 0x45, 0x52, 0x54, 0x20, 0x4f, 0x52, 0x20, 0x52, 0x45, 0x50, 0x4c, 0x41, 0x43, 0x45, 0x20,
-	0x49, 0x4e, 0x54, 0x4f, 0x20, 0x24, 0x7b, 0x54, 0x41, 0x42, 0x4c, 0x45, 0x5f, 0x4e, 0x41, 0x4d, 0x45, 0x7d,
-	0x20, 0x28, 0x6b, 0x65, 0x79, 0x2c, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x29, 0x20, 0x56, 0x41, 0x4c, 0x55,
-	0x45, 0x53, 0x20, 0x28, 0x3f, 0x2c, 0x20, 0x3f, 0x29, 0x60, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-	0x20, 0x20, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x6b, 0x29, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-	0x20, 0x20, 0x20, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x76, 0x29, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
-	0x20, 0x20, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2a,
-	0x2a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x52, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x20, 0x74,
-	0x68, 0x65, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x66,
-	0x72, 0x6f, 0x6d, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-	0x2a, 0x20, 0x40, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x20, 0x7b, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x7d, 0x20,
-	0x6b, 0x20, 0x2d, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
-	0x65, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x2e, 0x0a, 0x20,
-	0x20, 0x20, 0x20, 0x20, 0x2a, 0x20, 0x40, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x7b, 0x76, 0x6f,
-	0x69, 0x64, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x2f, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65,
-	0x6d, 0x6f, 0x76, 0x65, 0x49, 0x74, 0x65, 0x6d, 0x28, 0x6b, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-	0x20, 0x20, 0x64, 0x62, 0x2e, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x28, 0x60, 0x44, 0x45, 0x4c, 0x45,
-	0x54, 0x45, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20, 0x24, 0x7b, 0x54, 0x41, 0x42, 0x4c, 0x45, 0x5f, 0x4e, 0x41,
-	0x4d, 0x45, 0x7d, 0x20, 0x57, 0x48, 0x45, 0x52, 0x45, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20, 0x3f, 0x60,
-	0x2c, 0x20, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x6b, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-	0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2a, 0x2a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x20,
-	0x52, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x6b, 0x65, 0x79, 0x73, 0x20, 0x66,
-	0x72, 0x6f, 0x6d, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x2e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-	0x2a, 0x20, 0x40, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x7b, 0x76, 0x6f, 0x69, 0x64, 0x7d, 0x0a,
-	0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x2f, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x28,
-	0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x62, 0x2e, 0x65, 0x78, 0x65, 0x63, 0x75,
-	0x74, 0x65, 0x28, 0x60, 0x44, 0x45, 0x4c, 0x45, 0x54, 0x45, 0x20, 0x46, 0x52, 0x4f, 0x4d, 0x20, 0x24, 0x7b,
-	0x54, 0x41, 0x42, 0x4c, 0x45, 0x5f, 0x4e, 0x41, 0x4d, 0x45, 0x7d, 0x60, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
-	0x20, 0x7d, 0x0a, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x45, 0x78, 0x70, 0x6f, 0x73,
-	0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x69,
-	0x74, 0x69, 0x6f, 0x6e, 0x20, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x6c, 0x79, 0x2e, 0x0a, 0x20, 0x20, 0x2f,
-	0x2f, 0x20, 0x40, 0x74, 0x73, 0x2d, 0x69, 0x67, 0x6e, 0x6f, 0x72, 0x65, 0x0a, 0x20, 0x20, 0x67, 0x6c, 0x6f,
-	0x62, 0x61, 0x6c, 0x54, 0x68, 0x69, 0x73, 0x2e, 0x53, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x20, 0x3d, 0x20,
-	0x53, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x43, 0x72, 0x65,
-	0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x53, 0x74, 0x6f, 0x72, 0x61,
-	0x67, 0x65, 0x20, 0x73, 0x69, 0x6e, 0x67, 0x6c, 0x65, 0x74, 0x6f, 0x6e, 0x2c, 0x20, 0x61, 0x6c, 0x6c, 0x6f,
-	0x77, 0x69, 0x6e, 0x67, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x69, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-	0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x77, 0x69, 0x74, 0x68, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20,
-	0x73, 0x63, 0x6f, 0x70, 0x65, 0x2e, 0x0a, 0x20, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x49, 0x6e, 0x73, 0x74,
-	0x61, 0x6e, 0x74, 0x69, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3b, 0x0a,
-	0x20, 0x20, 0x2f, 0x2f, 0x20, 0x40, 0x74, 0x73, 0x2d, 0x69, 0x67, 0x6e, 0x6f, 0x72, 0x65, 0x0a, 0x20, 0x20,
-	0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x54, 0x68, 0x69, 0x73, 0x2e, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x53, 0x74,
-	0x6f, 0x72, 0x61, 0x67, 0x65, 0x20, 0x3d, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x53, 0x74, 0x6f, 0x72, 0x61, 0x67,
-	0x65, 0x28, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e,
-	0x74, 0x69, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x7d,
-	0xc1, 0x00, 0xf0, 0xcf, 0x28, 0xd0, 0x03, 0x01, 0x01, 0x09, 0x00, 0x00, 0x50, 0x00, 0x00, 0x02, 0xe8, 0x01,
-	0x00, 0x00,
-};
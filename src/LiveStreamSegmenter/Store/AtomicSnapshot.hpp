@@ -0,0 +1,73 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - Store Module
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace KaitoTokyo::LiveStreamSegmenter::Store {
+
+/**
+ * Holds the current immutable snapshot of a store. load() never blocks a writer and never copies the
+ * snapshot itself; store() publishes a new one for subsequent loads.
+ */
+template<typename T> class AtomicSnapshot {
+public:
+	explicit AtomicSnapshot(std::shared_ptr<const T> initial) noexcept : current_(std::move(initial)) {}
+
+	AtomicSnapshot(const AtomicSnapshot &) = delete;
+	AtomicSnapshot &operator=(const AtomicSnapshot &) = delete;
+	AtomicSnapshot(AtomicSnapshot &&) = delete;
+	AtomicSnapshot &operator=(AtomicSnapshot &&) = delete;
+
+#if defined(__cpp_lib_atomic_shared_ptr)
+	std::shared_ptr<const T> load() const noexcept { return current_.load(std::memory_order_acquire); }
+
+	void store(std::shared_ptr<const T> next) noexcept
+	{
+		current_.store(std::move(next), std::memory_order_release);
+	}
+
+private:
+	std::atomic<std::shared_ptr<const T>> current_;
+#else
+	// Fallback for standard libraries without std::atomic<std::shared_ptr>.
+	std::shared_ptr<const T> load() const noexcept
+	{
+		std::scoped_lock lock(mutex_);
+		return current_;
+	}
+
+	void store(std::shared_ptr<const T> next) noexcept
+	{
+		std::scoped_lock lock(mutex_);
+		current_ = std::move(next);
+	}
+
+private:
+	mutable std::mutex mutex_;
+	std::shared_ptr<const T> current_;
+#endif
+};
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Store
@@ -38,9 +38,34 @@ namespace {
 
 const QString kKeychainService = "tokyo.kaito.live-stream-segmenter";
 
+// Credentials and token state together, so that save() and restore() need one keychain job each.
+// Additional sessions append their id, as they sign in to their own channel.
+const QString kKeychainKey = "googleAuth";
+
+// Separate entries written before kKeychainKey existed; read once to migrate.
+const QString kLegacyGoogleOAuth2ClientCredentialsKey = "googleOAuth2ClientCredentials";
+const QString kLegacyGoogleTokenStateKey = "googleTokenState";
+
+std::string serializeKeychainEntry(const GoogleAuth::GoogleOAuth2ClientCredentials &googleOAuth2ClientCredentials,
+				   GoogleAuth::GoogleTokenState googleTokenState)
+{
+	// Access tokens are short-lived and refreshed on demand, so they are never persisted.
+	googleTokenState.access_token.clear();
+
+	nlohmann::json j{
+		{"googleOAuth2ClientCredentials", googleOAuth2ClientCredentials},
+		{"googleTokenState", googleTokenState},
+	};
+	return j.dump();
+}
+
 } // anonymous namespace
 
-AuthStore::AuthStore(QObject *parent) : QObject(parent) {}
+AuthStore::AuthStore(const std::string &sessionId, QObject *parent)
+	: QObject(parent),
+	  keychainKey_(sessionId.empty() ? kKeychainKey : kKeychainKey + "." + QString::fromStdString(sessionId))
+{
+}
 
 AuthStore::~AuthStore() noexcept = default;
 
@@ -66,6 +91,7 @@ void AuthStore::setGoogleTokenState(GoogleAuth::GoogleTokenState tokenState)
 {
 	std::scoped_lock lock(mutex_);
 	googleTokenState_ = std::move(tokenState);
+	googleTokenStateGeneration_.fetch_add(1, std::memory_order_acq_rel);
 }
 
 GoogleAuth::GoogleTokenState AuthStore::getGoogleTokenState() const
@@ -76,33 +102,25 @@ GoogleAuth::GoogleTokenState AuthStore::getGoogleTokenState() const
 
 void AuthStore::save()
 {
-	GoogleAuth::GoogleOAuth2ClientCredentials googleOAuth2ClientCredentials;
-	GoogleAuth::GoogleTokenState googleTokenState;
+	std::string entry;
 	{
 		std::scoped_lock lock(mutex_);
-		googleOAuth2ClientCredentials = googleOAuth2ClientCredentials_;
-		googleTokenState = googleTokenState_;
+		entry = serializeKeychainEntry(googleOAuth2ClientCredentials_, googleTokenState_);
+		if (entry == savedEntry_) {
+			if (logger_) {
+				logger_->debug("KeychainWriteSkipped");
+			}
+			return;
+		}
+		savedEntry_ = entry;
 	}
 
-	googleTokenState.access_token.clear();
-
-	nlohmann::json jGoogleOAuth2ClientCredentials = googleOAuth2ClientCredentials;
-	nlohmann::json jGoogleTokenState = googleTokenState;
-
-	auto writeGoogleOAuth2ClientCredentialsJob = new QKeychain::WritePasswordJob(kKeychainService, this);
-	writeGoogleOAuth2ClientCredentialsJob->setAutoDelete(true);
-	writeGoogleOAuth2ClientCredentialsJob->setKey("googleOAuth2ClientCredentials");
-	writeGoogleOAuth2ClientCredentialsJob->setTextData(
-		QString::fromStdString(jGoogleOAuth2ClientCredentials.dump()));
-	connect(writeGoogleOAuth2ClientCredentialsJob, &QKeychain::Job::finished, this, &AuthStore::onWriteFinished);
-	writeGoogleOAuth2ClientCredentialsJob->start();
-
-	auto writeGoogleTokenStateJob = new QKeychain::WritePasswordJob(kKeychainService, this);
-	writeGoogleTokenStateJob->setAutoDelete(true);
-	writeGoogleTokenStateJob->setKey("googleTokenState");
-	writeGoogleTokenStateJob->setTextData(QString::fromStdString(jGoogleTokenState.dump()));
-	connect(writeGoogleTokenStateJob, &QKeychain::Job::finished, this, &AuthStore::onWriteFinished);
-	writeGoogleTokenStateJob->start();
+	auto writeJob = new QKeychain::WritePasswordJob(kKeychainService, this);
+	writeJob->setAutoDelete(true);
+	writeJob->setKey(keychainKey_);
+	writeJob->setTextData(QString::fromStdString(entry));
+	connect(writeJob, &QKeychain::Job::finished, this, &AuthStore::onWriteFinished);
+	writeJob->start();
 }
 
 void AuthStore::onWriteFinished(QKeychain::Job *job)
@@ -111,6 +129,10 @@ void AuthStore::onWriteFinished(QKeychain::Job *job)
 	{
 		std::scoped_lock lock(mutex_);
 		logger = logger_;
+		if (job->error()) {
+			// Unknown again, so that the next save() retries.
+			savedEntry_.clear();
+		}
 	}
 
 	if (logger) {
@@ -127,21 +149,109 @@ void AuthStore::onWriteFinished(QKeychain::Job *job)
 
 void AuthStore::restore()
 {
+	auto readJob = new QKeychain::ReadPasswordJob(kKeychainService, this);
+	readJob->setAutoDelete(true);
+	readJob->setKey(keychainKey_);
+	connect(readJob, &QKeychain::Job::finished, this, &AuthStore::onReadFinished);
+	readJob->start();
+}
+
+void AuthStore::onReadFinished(QKeychain::Job *job)
+{
+	auto readJob = static_cast<QKeychain::ReadPasswordJob *>(job);
+
+	if (readJob->error() == QKeychain::Error::EntryNotFound) {
+		if (keychainKey_ == kKeychainKey) {
+			restoreLegacy();
+		} else {
+			// An additional session that has not signed in yet; there are no legacy entries for it.
+			restored_.set();
+		}
+		return;
+	}
+
+	{
+		std::scoped_lock lock(mutex_);
+		if (readJob->error()) {
+			if (logger_) {
+				std::string error = readJob->errorString().toStdString();
+				logger_->error("KeychainReadError", {{"error", error}});
+			}
+		} else {
+			try {
+				const nlohmann::json j = nlohmann::json::parse(readJob->textData().toStdString());
+				GoogleAuth::GoogleOAuth2ClientCredentials googleOAuth2ClientCredentials;
+				GoogleAuth::GoogleTokenState googleTokenState;
+				j.at("googleOAuth2ClientCredentials").get_to(googleOAuth2ClientCredentials);
+				j.at("googleTokenState").get_to(googleTokenState);
+				googleTokenState.access_token.clear();
+
+				googleOAuth2ClientCredentials_ = std::move(googleOAuth2ClientCredentials);
+				googleTokenState_ = std::move(googleTokenState);
+				googleTokenStateGeneration_.fetch_add(1, std::memory_order_acq_rel);
+				savedEntry_ = serializeKeychainEntry(googleOAuth2ClientCredentials_, googleTokenState_);
+
+				if (logger_) {
+					logger_->info("RestoredGoogleAuth");
+				}
+			} catch (const std::exception &e) {
+				if (logger_) {
+					logger_->error("KeychainJsonParseError", {{"what", e.what()}});
+				}
+			}
+		}
+	}
+	// Outside the lock: waiters resume inline and may call the getters.
+	restored_.set();
+}
+
+void AuthStore::restoreLegacy()
+{
+	{
+		std::scoped_lock lock(mutex_);
+		// Nothing to migrate unless a legacy entry changes this, in which case save() writes the new entry.
+		savedEntry_ = serializeKeychainEntry(googleOAuth2ClientCredentials_, googleTokenState_);
+	}
+	pendingLegacyReads_ = 2;
+
 	auto readGoogleOAuth2ClientCredentialsJob = new QKeychain::ReadPasswordJob(kKeychainService, this);
 	readGoogleOAuth2ClientCredentialsJob->setAutoDelete(true);
-	readGoogleOAuth2ClientCredentialsJob->setKey("googleOAuth2ClientCredentials");
+	readGoogleOAuth2ClientCredentialsJob->setKey(kLegacyGoogleOAuth2ClientCredentialsKey);
 	connect(readGoogleOAuth2ClientCredentialsJob, &QKeychain::Job::finished, this,
-		&AuthStore::onReadGoogleOAuth2ClientCredentialsFinished);
+		&AuthStore::onReadLegacyGoogleOAuth2ClientCredentialsFinished);
 	readGoogleOAuth2ClientCredentialsJob->start();
 
 	auto readGoogleTokenStateJob = new QKeychain::ReadPasswordJob(kKeychainService, this);
 	readGoogleTokenStateJob->setAutoDelete(true);
-	readGoogleTokenStateJob->setKey("googleTokenState");
-	connect(readGoogleTokenStateJob, &QKeychain::Job::finished, this, &AuthStore::onReadGoogleTokenStateFinished);
+	readGoogleTokenStateJob->setKey(kLegacyGoogleTokenStateKey);
+	connect(readGoogleTokenStateJob, &QKeychain::Job::finished, this,
+		&AuthStore::onReadLegacyGoogleTokenStateFinished);
 	readGoogleTokenStateJob->start();
 }
 
-void AuthStore::onReadGoogleOAuth2ClientCredentialsFinished(QKeychain::Job *job)
+void AuthStore::onReadLegacyGoogleOAuth2ClientCredentialsFinished(QKeychain::Job *job)
+{
+	restoreLegacyGoogleOAuth2ClientCredentials(job);
+	onLegacyReadFinished();
+}
+
+void AuthStore::onReadLegacyGoogleTokenStateFinished(QKeychain::Job *job)
+{
+	restoreLegacyGoogleTokenState(job);
+	onLegacyReadFinished();
+}
+
+void AuthStore::onLegacyReadFinished()
+{
+	if (--pendingLegacyReads_ > 0) {
+		return;
+	}
+
+	restored_.set();
+	save();
+}
+
+void AuthStore::restoreLegacyGoogleOAuth2ClientCredentials(QKeychain::Job *job)
 try {
 	auto readJob = static_cast<QKeychain::ReadPasswordJob *>(job);
 
@@ -197,7 +307,7 @@ try {
 	return;
 }
 
-void AuthStore::onReadGoogleTokenStateFinished(QKeychain::Job *job)
+void AuthStore::restoreLegacyGoogleTokenState(QKeychain::Job *job)
 try {
 	auto readJob = static_cast<QKeychain::ReadPasswordJob *>(job);
 
@@ -220,6 +330,7 @@ try {
 	nlohmann::json j = nlohmann::json::parse(jsonStr);
 
 	std::scoped_lock lock(mutex_);
+	googleTokenStateGeneration_.fetch_add(1, std::memory_order_acq_rel);
 	try {
 		j.get_to(googleTokenState_);
 		googleTokenState_.access_token.clear();
@@ -244,6 +355,7 @@ try {
 		logger_->error("KeychainJsonParseError", {{"what", e.what()}});
 	}
 	googleTokenState_ = {};
+	googleTokenStateGeneration_.fetch_add(1, std::memory_order_acq_rel);
 	return;
 } catch (...) {
 	std::scoped_lock lock(mutex_);
@@ -251,6 +363,7 @@ try {
 		logger_->error("KeychainUnknownError");
 	}
 	googleTokenState_ = {};
+	googleTokenStateGeneration_.fetch_add(1, std::memory_order_acq_rel);
 	return;
 }
 
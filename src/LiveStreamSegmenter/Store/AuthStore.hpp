@@ -20,12 +20,16 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <filesystem>
 #include <memory>
 #include <mutex>
+#include <string>
 
 #include <QObject>
 
+#include <KaitoTokyo/Async/OneShotEvent.hpp>
 #include <KaitoTokyo/GoogleAuth/GoogleOAuth2ClientCredentials.hpp>
 #include <KaitoTokyo/GoogleAuth/GoogleTokenState.hpp>
 #include <KaitoTokyo/Logger/ILogger.hpp>
@@ -36,11 +40,21 @@ class Job;
 
 namespace KaitoTokyo::LiveStreamSegmenter::Store {
 
+/**
+ * Holds the OAuth2 client credentials and token state, persisted together as one keychain entry.
+ *
+ * Keychain jobs can take a long time and may prompt the user, so restore() only starts the read and
+ * returns; waitRestored() completes once it is done. save() writes only when the persisted contents
+ * changed since the last read or write.
+ */
 class AuthStore : public QObject {
 	Q_OBJECT
 
 public:
-	explicit AuthStore(QObject *parent = nullptr);
+	/**
+	 * @param sessionId Empty for the profile's own session, which also migrates the legacy entries.
+	 */
+	explicit AuthStore(const std::string &sessionId = {}, QObject *parent = nullptr);
 
 	~AuthStore() noexcept;
 
@@ -57,20 +71,53 @@ public:
 	void setGoogleTokenState(GoogleAuth::GoogleTokenState tokenState);
 	GoogleAuth::GoogleTokenState getGoogleTokenState() const;
 
+	/**
+	 * Incremented whenever the token state is replaced, so caches can detect changes without locking.
+	 */
+	std::uint64_t getGoogleTokenStateGeneration() const noexcept
+	{
+		return googleTokenStateGeneration_.load(std::memory_order_acquire);
+	}
+
 	void save();
 	void restore();
 
+	/**
+	 * True once the read started by restore() has finished, whether or not it found anything.
+	 */
+	bool isRestored() const noexcept { return restored_.isSet(); }
+
+	/**
+	 * Completes once isRestored() is true. When it has to wait, the coroutine resumes on the thread
+	 * that owns this object, so callers should hop back to their own executor.
+	 */
+	auto waitRestored() noexcept { return restored_.wait(); }
+
 private slots:
 	void onWriteFinished(QKeychain::Job *job);
-	void onReadGoogleOAuth2ClientCredentialsFinished(QKeychain::Job *job);
-	void onReadGoogleTokenStateFinished(QKeychain::Job *job);
+	void onReadFinished(QKeychain::Job *job);
+	void onReadLegacyGoogleOAuth2ClientCredentialsFinished(QKeychain::Job *job);
+	void onReadLegacyGoogleTokenStateFinished(QKeychain::Job *job);
 
 private:
+	void restoreLegacy();
+	void restoreLegacyGoogleOAuth2ClientCredentials(QKeychain::Job *job);
+	void restoreLegacyGoogleTokenState(QKeychain::Job *job);
+	void onLegacyReadFinished();
+
+	const QString keychainKey_;
+
 	mutable std::mutex mutex_;
 	std::shared_ptr<const Logger::ILogger> logger_;
+	// What the keychain holds as far as this object knows; empty when unknown.
+	std::string savedEntry_;
+	// Touched only on the owning thread, where the keychain jobs finish.
+	int pendingLegacyReads_ = 0;
+	Async::OneShotEvent restored_;
 
 	GoogleAuth::GoogleOAuth2ClientCredentials googleOAuth2ClientCredentials_;
 	GoogleAuth::GoogleTokenState googleTokenState_;
+	std::atomic<std::uint64_t> googleTokenStateGeneration_{0};
 };
 
 } // namespace KaitoTokyo::LiveStreamSegmenter::Store
@@ -21,99 +21,181 @@
 #include "EventHandlerStore.hpp"
 
 #include <fstream>
+#include <optional>
 #include <stdexcept>
 
 #include <nlohmann/json.hpp>
 
-#include <obs-frontend-api.h>
+namespace KaitoTokyo::LiveStreamSegmenter::Store {
 
-#include <KaitoTokyo/ObsBridgeUtils/ObsUnique.hpp>
+namespace {
 
-namespace KaitoTokyo::LiveStreamSegmenter::Store {
+constexpr ProfileStoreKey<std::string> kEventHandlerScriptKey{"eventHandler.script"};
+constexpr ProfileStoreKey<EventHandlerDatabaseSettings> kEventHandlerDatabaseKey{"eventHandler.database"};
+constexpr ProfileStoreKey<EventHandlerExecutionSettings> kEventHandlerExecutionKey{"eventHandler.execution"};
 
-EventHandlerStore::EventHandlerStore() = default;
+} // anonymous namespace
 
-EventHandlerStore::~EventHandlerStore() noexcept = default;
+void to_json(nlohmann::json &j, const EventHandlerDatabaseSettings &p)
+{
+	j = nlohmann::json{
+		{"journalMode", p.journalMode},
+		{"synchronous", p.synchronous},
+		{"cacheSize", p.cacheSize},
+		{"mmapSize", p.mmapSize},
+	};
+}
+
+void from_json(const nlohmann::json &j, EventHandlerDatabaseSettings &p)
+{
+	if (j.contains("journalMode")) {
+		j.at("journalMode").get_to(p.journalMode);
+	}
+	if (j.contains("synchronous")) {
+		j.at("synchronous").get_to(p.synchronous);
+	}
+	if (j.contains("cacheSize")) {
+		j.at("cacheSize").get_to(p.cacheSize);
+	}
+	if (j.contains("mmapSize")) {
+		j.at("mmapSize").get_to(p.mmapSize);
+	}
+}
 
-std::filesystem::path EventHandlerStore::getConfigPath()
+void to_json(nlohmann::json &j, const EventHandlerExecutionSettings &p)
 {
-	ObsBridgeUtils::unique_bfree_char_t profilePathRaw(obs_frontend_get_current_profile_path());
-	if (!profilePathRaw) {
-		throw std::runtime_error("GetCurrentProfilePathFailed(getConfigPath)");
+	j = nlohmann::json{
+		{"timeBudgetMilliseconds", p.timeBudgetMilliseconds},
+		{"memoryLimitBytes", p.memoryLimitBytes},
+		{"gcThresholdBytes", p.gcThresholdBytes},
+	};
+}
+
+void from_json(const nlohmann::json &j, EventHandlerExecutionSettings &p)
+{
+	if (j.contains("timeBudgetMilliseconds")) {
+		j.at("timeBudgetMilliseconds").get_to(p.timeBudgetMilliseconds);
+	}
+	if (j.contains("memoryLimitBytes")) {
+		j.at("memoryLimitBytes").get_to(p.memoryLimitBytes);
 	}
+	if (j.contains("gcThresholdBytes")) {
+		j.at("gcThresholdBytes").get_to(p.gcThresholdBytes);
+	}
+}
 
-	std::filesystem::path profilePath(reinterpret_cast<const char8_t *>(profilePathRaw.get()));
-	return profilePath / "live-stream-segmenter_EventHandlerStore.json";
+EventHandlerStore::EventHandlerStore(std::shared_ptr<const ProfilePaths> paths)
+	: paths_(paths ? std::move(paths) : throw std::invalid_argument("PathsIsNullError(EventHandlerStore)")),
+	  snapshot_(std::make_shared<const EventHandlerSnapshot>())
+{
 }
 
+EventHandlerStore::~EventHandlerStore() noexcept = default;
+
 void EventHandlerStore::setLogger(std::shared_ptr<const Logger::ILogger> logger)
 {
 	std::scoped_lock lock(mutex_);
 	logger_ = std::move(logger);
 }
 
+void EventHandlerStore::setProfileStore(std::shared_ptr<ProfileStore> profileStore)
+{
+	std::scoped_lock lock(mutex_);
+	profileStore_ = std::move(profileStore);
+}
+
 void EventHandlerStore::setEventHandlerScript(std::string eventHandlerScript)
 {
 	std::scoped_lock lock(mutex_);
-	eventHandlerScript_ = std::move(eventHandlerScript);
+	EventHandlerSnapshot next = *snapshot_.load();
+	next.eventHandlerScript = std::move(eventHandlerScript);
+	publish(std::move(next));
 }
 
 std::string EventHandlerStore::getEventHandlerScript() const
 {
-	std::scoped_lock lock(mutex_);
-	return eventHandlerScript_;
+	return snapshot_.load()->eventHandlerScript;
 }
 
-std::filesystem::path EventHandlerStore::getEventHandlerDatabasePath() const
+void EventHandlerStore::setEventHandlerDatabaseSettings(EventHandlerDatabaseSettings settings)
 {
-	ObsBridgeUtils::unique_bfree_char_t profilePathRaw(obs_frontend_get_current_profile_path());
-	if (!profilePathRaw) {
-		logger_->error("ProfilePathError(getEventHandlerDatabasePath)");
-		throw std::runtime_error("ProfilePathError(getEventHandlerDatabasePath)");
-	}
+	std::scoped_lock lock(mutex_);
+	EventHandlerSnapshot next = *snapshot_.load();
+	next.databaseSettings = std::move(settings);
+	publish(std::move(next));
+}
 
-	std::filesystem::path profilePath(reinterpret_cast<const char8_t *>(profilePathRaw.get()));
-	return profilePath / "live-stream-segmenter_EventHandlerStore_db.sqlite";
+EventHandlerDatabaseSettings EventHandlerStore::getEventHandlerDatabaseSettings() const
+{
+	return snapshot_.load()->databaseSettings;
 }
 
-void EventHandlerStore::save() const
+void EventHandlerStore::setEventHandlerExecutionSettings(EventHandlerExecutionSettings settings)
 {
-	const std::filesystem::path configPath = getConfigPath();
+	std::scoped_lock lock(mutex_);
+	EventHandlerSnapshot next = *snapshot_.load();
+	next.executionSettings = settings;
+	publish(std::move(next));
+}
 
-	std::string eventHandlerScript;
-	{
-		std::scoped_lock lock(mutex_);
-		eventHandlerScript = eventHandlerScript_;
-	}
+EventHandlerExecutionSettings EventHandlerStore::getEventHandlerExecutionSettings() const
+{
+	return snapshot_.load()->executionSettings;
+}
 
-	nlohmann::json j{
-		{"eventHandlerScript", eventHandlerScript},
-	};
+std::shared_ptr<const EventHandlerSnapshot> EventHandlerStore::getSnapshot() const noexcept
+{
+	return snapshot_.load();
+}
 
-	std::filesystem::path tmpConfigPath = configPath;
-	tmpConfigPath += ".tmp";
-	std::ofstream ofs(tmpConfigPath, std::ios::out);
-	if (!ofs.is_open()) {
-		logger_->error("FileOpenError", {{"path", configPath.string()}});
-		throw std::runtime_error("FileOpenError(save)");
-	}
+const std::filesystem::path &EventHandlerStore::getEventHandlerDatabasePath() const noexcept
+{
+	return paths_->eventHandlerDatabase;
+}
 
-	ofs << j;
+const std::filesystem::path &EventHandlerStore::getEventHandlerBytecodeCachePath() const noexcept
+{
+	return paths_->eventHandlerBytecodeCache;
+}
 
-	ofs.close();
+void EventHandlerStore::save() const
+{
+	const std::shared_ptr<const EventHandlerSnapshot> snapshot = snapshot_.load();
+	profileStore_->set(kEventHandlerScriptKey, snapshot->eventHandlerScript);
+	profileStore_->set(kEventHandlerDatabaseKey, snapshot->databaseSettings);
+	profileStore_->set(kEventHandlerExecutionKey, snapshot->executionSettings);
+}
 
-	std::filesystem::path bakConfigPath = configPath;
-	bakConfigPath += ".bak";
+void EventHandlerStore::restore()
+{
+	std::optional<std::string> eventHandlerScript = profileStore_->get(kEventHandlerScriptKey);
+	std::optional<EventHandlerDatabaseSettings> databaseSettings = profileStore_->get(kEventHandlerDatabaseKey);
+	std::optional<EventHandlerExecutionSettings> executionSettings = profileStore_->get(kEventHandlerExecutionKey);
+	if (!eventHandlerScript && !databaseSettings && !executionSettings) {
+		restoreLegacyConfig();
+		return;
+	}
 
-	if (std::filesystem::is_regular_file(configPath)) {
-		std::filesystem::rename(configPath, bakConfigPath);
+	std::scoped_lock lock(mutex_);
+	EventHandlerSnapshot next = *snapshot_.load();
+	if (eventHandlerScript) {
+		next.eventHandlerScript = std::move(*eventHandlerScript);
+		logger_->info("RestoredEventHandlerScript");
+	}
+	if (databaseSettings) {
+		next.databaseSettings = std::move(*databaseSettings);
+		logger_->info("RestoredEventHandlerDatabaseSettings");
+	}
+	if (executionSettings) {
+		next.executionSettings = *executionSettings;
+		logger_->info("RestoredEventHandlerExecutionSettings");
 	}
-	std::filesystem::rename(tmpConfigPath, configPath);
+	publish(std::move(next));
 }
 
-void EventHandlerStore::restore()
+void EventHandlerStore::restoreLegacyConfig()
 {
-	const std::filesystem::path configPath = getConfigPath();
+	const std::filesystem::path &configPath = paths_->eventHandlerStoreLegacyConfig;
 	if (!std::filesystem::is_regular_file(configPath)) {
 		logger_->info("EventHandlerStoreConfigFileNotExist", {{"path", configPath.string()}});
 		return;
@@ -122,22 +204,37 @@ void EventHandlerStore::restore()
 	std::ifstream ifs(configPath, std::ios::in);
 	if (!ifs.is_open()) {
 		logger_->error("FileOpenError", {{"path", configPath.string()}});
-		throw std::runtime_error("FileOpenError(restore)");
+		throw std::runtime_error("FileOpenError(restoreLegacyConfig)");
 	}
 
 	nlohmann::json j;
 	ifs >> j;
 
-	std::scoped_lock lock(mutex_);
-	try {
-		if (j.contains("eventHandlerScript")) {
-			j.at("eventHandlerScript").get_to(eventHandlerScript_);
-			logger_->info("RestoredEventHandlerScript");
-		}
-	} catch (...) {
-		eventHandlerScript_.clear();
-		throw;
+	EventHandlerSnapshot next;
+	if (j.contains("eventHandlerScript")) {
+		j.at("eventHandlerScript").get_to(next.eventHandlerScript);
+	}
+	if (j.contains("eventHandlerDatabase")) {
+		j.at("eventHandlerDatabase").get_to(next.databaseSettings);
+	}
+	if (j.contains("eventHandlerExecution")) {
+		j.at("eventHandlerExecution").get_to(next.executionSettings);
 	}
+
+	{
+		std::scoped_lock lock(mutex_);
+		publish(std::move(next));
+	}
+
+	// The legacy file is left in place as a backup; the profile store is read from now on.
+	save();
+	logger_->info("EventHandlerStoreMigrated", {{"path", configPath.string()}});
+}
+
+void EventHandlerStore::publish(EventHandlerSnapshot next)
+{
+	next.version = snapshot_.load()->version + 1;
+	snapshot_.store(std::make_shared<const EventHandlerSnapshot>(std::move(next)));
 }
 
 } // namespace KaitoTokyo::LiveStreamSegmenter::Store
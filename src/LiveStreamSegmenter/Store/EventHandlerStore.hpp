@@ -20,17 +20,64 @@
 
 #pragma once
 
+#include <cstdint>
 #include <filesystem>
 #include <memory>
 #include <mutex>
+#include <string>
+
+#include <nlohmann/json_fwd.hpp>
 
 #include <KaitoTokyo/Logger/ILogger.hpp>
 
+#include "AtomicSnapshot.hpp"
+#include "ProfilePaths.hpp"
+#include "ProfileStore.hpp"
+
 namespace KaitoTokyo::LiveStreamSegmenter::Store {
 
+/**
+ * SQLite tuning for the event handler database. The defaults favour scripts that write often
+ * during a session: WAL with synchronous=NORMAL commits without an fsync per transaction.
+ */
+struct EventHandlerDatabaseSettings {
+	std::string journalMode = "WAL";
+	std::string synchronous = "NORMAL";
+	// Negative values are KiB, as in PRAGMA cache_size.
+	std::int64_t cacheSize = -8192;
+	std::int64_t mmapSize = 0;
+};
+
+/**
+ * Limits for event handler scripts. A handler that exceeds its time budget fails the event instead
+ * of holding the worker thread, so a cutover is not stalled by a runaway loop. Zero disables a limit.
+ */
+struct EventHandlerExecutionSettings {
+	std::int64_t timeBudgetMilliseconds = 10000;
+	std::int64_t memoryLimitBytes = 256 * 1024 * 1024;
+	std::int64_t gcThresholdBytes = 0;
+};
+
+void to_json(nlohmann::json &j, const EventHandlerDatabaseSettings &p);
+void from_json(const nlohmann::json &j, EventHandlerDatabaseSettings &p);
+void to_json(nlohmann::json &j, const EventHandlerExecutionSettings &p);
+void from_json(const nlohmann::json &j, EventHandlerExecutionSettings &p);
+
+/**
+ * The contents of an EventHandlerStore at one version. Never modified once published, so readers may
+ * keep it, and anything derived from it such as a compiled script, for as long as the version matches.
+ */
+struct EventHandlerSnapshot {
+	// Incremented by every write.
+	std::uint64_t version = 0;
+	std::string eventHandlerScript;
+	EventHandlerDatabaseSettings databaseSettings;
+	EventHandlerExecutionSettings executionSettings;
+};
+
 class EventHandlerStore {
 public:
-	EventHandlerStore();
+	explicit EventHandlerStore(std::shared_ptr<const ProfilePaths> paths);
 
 	~EventHandlerStore() noexcept;
 
@@ -39,25 +86,49 @@ public:
 	EventHandlerStore(EventHandlerStore &&) = delete;
 	EventHandlerStore &operator=(EventHandlerStore &&) = delete;
 
-	static std::filesystem::path getConfigPath();
-
 	void setLogger(std::shared_ptr<const Logger::ILogger> logger);
 
+	void setProfileStore(std::shared_ptr<ProfileStore> profileStore);
+
 	void setEventHandlerScript(std::string eventHandlerScript);
 
 	std::string getEventHandlerScript() const;
 
-	std::filesystem::path getEventHandlerDatabasePath() const;
+	const std::filesystem::path &getEventHandlerDatabasePath() const noexcept;
+
+	const std::filesystem::path &getEventHandlerBytecodeCachePath() const noexcept;
+
+	void setEventHandlerDatabaseSettings(EventHandlerDatabaseSettings settings);
+
+	EventHandlerDatabaseSettings getEventHandlerDatabaseSettings() const;
+
+	void setEventHandlerExecutionSettings(EventHandlerExecutionSettings settings);
+
+	EventHandlerExecutionSettings getEventHandlerExecutionSettings() const;
+
+	/**
+	 * Returns the current contents without locking or copying them.
+	 */
+	std::shared_ptr<const EventHandlerSnapshot> getSnapshot() const noexcept;
 
 	void save() const;
 
 	void restore();
 
 private:
+	void restoreLegacyConfig();
+
+	// Requires mutex_ to be held.
+	void publish(EventHandlerSnapshot next);
+
+	const std::shared_ptr<const ProfilePaths> paths_;
+
+	// Serializes writers; readers only load snapshot_.
 	mutable std::mutex mutex_;
-	std::string eventHandlerScript_;
+	AtomicSnapshot<EventHandlerSnapshot> snapshot_;
 
 	std::shared_ptr<const Logger::ILogger> logger_;
+	std::shared_ptr<ProfileStore> profileStore_;
 };
 
 } // namespace KaitoTokyo::LiveStreamSegmenter::Store
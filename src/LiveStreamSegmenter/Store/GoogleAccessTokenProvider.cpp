@@ -0,0 +1,215 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - Store Module
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "GoogleAccessTokenProvider.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+#include <KaitoTokyo/GoogleAuth/GoogleAuthManager.hpp>
+#include <KaitoTokyo/GoogleAuth/GoogleTokenRefresher.hpp>
+#include <KaitoTokyo/GoogleAuth/GoogleTokenState.hpp>
+
+#include "AtomicSnapshot.hpp"
+
+namespace KaitoTokyo::LiveStreamSegmenter::Store {
+
+namespace {
+
+// Same margin as GoogleTokenState::isAccessTokenFresh().
+constexpr std::chrono::seconds kFreshMargin{60};
+
+// The background refresh starts this long before expiry, so callers never hit the fresh margin.
+constexpr std::chrono::seconds kRefreshAhead{5 * 60};
+
+constexpr std::chrono::milliseconds kRefreshCheckInterval{30 * 1000};
+
+struct CachedAccessToken {
+	std::string accessToken;
+	std::chrono::system_clock::time_point expiresAt;
+	std::uint64_t generation;
+};
+
+} // anonymous namespace
+
+class GoogleAccessTokenProvider::State {
+public:
+	State(std::shared_ptr<AuthStore> authStore, std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool,
+	      std::shared_ptr<const Logger::ILogger> logger)
+		: authStore_(authStore
+				     ? std::move(authStore)
+				     : throw std::invalid_argument("AuthStoreIsNullError(GoogleAccessTokenProvider)")),
+		  curlPool_(curlPool ? std::move(curlPool)
+				     : throw std::invalid_argument("CurlPoolIsNullError(GoogleAccessTokenProvider)")),
+		  logger_(logger ? std::move(logger)
+				 : throw std::invalid_argument("LoggerIsNullError(GoogleAccessTokenProvider)"))
+	{
+	}
+
+	std::string getAccessToken()
+	{
+		if (std::shared_ptr<const CachedAccessToken> cached = cached_.load(); isUsable(cached, kFreshMargin)) {
+			logger_->debug("YouTubeAccessTokenCached");
+			return cached->accessToken;
+		}
+
+		return refresh(kFreshMargin)->accessToken;
+	}
+
+	// Must be called from a worker thread
+	void refreshInBackground() noexcept
+	{
+		if (backgroundRefreshing_.exchange(true, std::memory_order_acq_rel)) {
+			return;
+		}
+
+		try {
+			if (!isUsable(cached_.load(), kRefreshAhead) &&
+			    authStore_->getGoogleTokenState().isAuthorized()) {
+				logger_->info("YouTubeAccessTokenBackgroundRefreshing");
+				refresh(kRefreshAhead);
+				logger_->info("YouTubeAccessTokenBackgroundRefreshed");
+			}
+		} catch (const std::exception &e) {
+			logger_->error("YouTubeAccessTokenBackgroundRefreshError", {{"exception", e.what()}});
+		} catch (...) {
+			logger_->error("YouTubeAccessTokenBackgroundRefreshUnknownError");
+		}
+
+		backgroundRefreshing_.store(false, std::memory_order_release);
+	}
+
+private:
+	bool isUsable(const std::shared_ptr<const CachedAccessToken> &cached,
+		      std::chrono::seconds margin) const noexcept
+	{
+		return cached && cached->generation == authStore_->getGoogleTokenStateGeneration() &&
+		       std::chrono::system_clock::now() + margin < cached->expiresAt;
+	}
+
+	// Callers that race here share one refresh; the one that runs it publishes the new token state.
+	std::shared_ptr<const CachedAccessToken> refresh(std::chrono::seconds margin)
+	{
+		if (std::shared_ptr<const CachedAccessToken> cached = cached_.load(); isUsable(cached, margin)) {
+			return cached;
+		}
+
+		const std::uint64_t generation = authStore_->getGoogleTokenStateGeneration();
+		const GoogleAuth::GoogleTokenState tokenState = authStore_->getGoogleTokenState();
+
+		if (!tokenState.isAuthorized()) {
+			logger_->error("YouTubeAccessTokenNotAuthorized");
+			throw std::runtime_error("YouTubeAccessTokenNotAuthorized(GoogleAccessTokenProvider::refresh)");
+		}
+
+		if (!tokenState.access_token.empty() && tokenState.expires_at &&
+		    std::chrono::system_clock::now() + margin < tokenState.expirationTimePoint()) {
+			logger_->info("YouTubeAccessTokenFresh");
+			return publish(tokenState, generation);
+		}
+
+		(void)refresher_.refresh(tokenState.refresh_token, [this, tokenState, margin]() {
+			const std::shared_ptr<const CachedAccessToken> cached = cached_.load();
+			if (isUsable(cached, margin)) {
+				// A refresh finished between the check above and this one; the response is not used.
+				GoogleAuth::GoogleAuthResponse cachedAuthResponse;
+				cachedAuthResponse.access_token = cached->accessToken;
+				return cachedAuthResponse;
+			}
+
+			logger_->info("YouTubeAccessTokenRefreshing");
+
+			GoogleAuth::GoogleAuthManager authManager(
+				curlPool_, authStore_->getGoogleOAuth2ClientCredentials(), logger_);
+			GoogleAuth::GoogleAuthResponse freshAuthResponse =
+				authManager.fetchFreshAuthResponse(tokenState.refresh_token);
+
+			GoogleAuth::GoogleTokenState freshTokenState = tokenState;
+			freshTokenState.loadAuthResponse(freshAuthResponse);
+			authStore_->setGoogleTokenState(freshTokenState);
+			publish(freshTokenState, authStore_->getGoogleTokenStateGeneration());
+
+			logger_->info("YouTubeAccessTokenRefreshed");
+			return freshAuthResponse;
+		});
+
+		// Published by whichever caller ran the refresh before it let the others go.
+		return cached_.load();
+	}
+
+	std::shared_ptr<const CachedAccessToken> publish(const GoogleAuth::GoogleTokenState &tokenState,
+							 std::uint64_t generation)
+	{
+		auto cached = std::make_shared<const CachedAccessToken>(CachedAccessToken{
+			.accessToken = tokenState.access_token,
+			.expiresAt = tokenState.expirationTimePoint(),
+			.generation = generation,
+		});
+		cached_.store(cached);
+		return cached;
+	}
+
+	AtomicSnapshot<CachedAccessToken> cached_{nullptr};
+
+	const std::shared_ptr<AuthStore> authStore_;
+	const std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool_;
+	const std::shared_ptr<const Logger::ILogger> logger_;
+
+	GoogleAuth::GoogleTokenRefresher refresher_;
+	std::atomic<bool> backgroundRefreshing_{false};
+};
+
+GoogleAccessTokenProvider::GoogleAccessTokenProvider(std::shared_ptr<AuthStore> authStore,
+						     std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool,
+						     std::shared_ptr<Async::ThreadPoolExecutor> networkExecutor,
+						     std::shared_ptr<const Logger::ILogger> logger, QObject *parent)
+	: QObject(parent),
+	  authStore_(authStore ? std::move(authStore)
+			       : throw std::invalid_argument("AuthStoreIsNullError(GoogleAccessTokenProvider)")),
+	  state_(std::make_shared<State>(authStore_, std::move(curlPool), std::move(logger))),
+	  networkExecutor_(networkExecutor
+				   ? std::move(networkExecutor)
+				   : throw std::invalid_argument(
+					     "NetworkExecutorIsNullError(GoogleAccessTokenProvider)")),
+	  refreshTimer_(new QTimer(this))
+{
+	refreshTimer_->setTimerType(Qt::VeryCoarseTimer);
+	refreshTimer_->setInterval(static_cast<int>(kRefreshCheckInterval.count()));
+	connect(refreshTimer_, &QTimer::timeout, this, &GoogleAccessTokenProvider::onRefreshTimerTimeout);
+	refreshTimer_->start();
+}
+
+GoogleAccessTokenProvider::~GoogleAccessTokenProvider() noexcept = default;
+
+std::string GoogleAccessTokenProvider::getAccessToken()
+{
+	return state_->getAccessToken();
+}
+
+void GoogleAccessTokenProvider::onRefreshTimerTimeout()
+{
+	// In-flight refreshes keep the state alive even if this provider is destroyed meanwhile.
+	networkExecutor_->post([state = state_]() { state->refreshInBackground(); });
+}
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Store
@@ -0,0 +1,92 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - Store Module
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include <QObject>
+#include <QTimer>
+
+#include <KaitoTokyo/Async/ThreadPoolExecutor.hpp>
+#include <KaitoTokyo/CurlHelper/CurlConnectionPool.hpp>
+#include <KaitoTokyo/Logger/ILogger.hpp>
+
+#include "AuthStore.hpp"
+
+namespace KaitoTokyo::LiveStreamSegmenter::Store {
+
+/**
+ * Hands out YouTube access tokens from an in-memory cache and refreshes them in the background.
+ *
+ * A timer on the owning thread checks the cached token and refreshes it on the network executor
+ * passed to the constructor well before it expires, so callers normally get a token without a
+ * network round trip.
+ * Concurrent refreshes are deduplicated, and changes to the token state in the AuthStore are
+ * picked up on the next call.
+ */
+class GoogleAccessTokenProvider : public QObject {
+	Q_OBJECT
+
+public:
+	GoogleAccessTokenProvider(std::shared_ptr<AuthStore> authStore,
+				  std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool,
+				  std::shared_ptr<Async::ThreadPoolExecutor> networkExecutor,
+				  std::shared_ptr<const Logger::ILogger> logger, QObject *parent = nullptr);
+
+	~GoogleAccessTokenProvider() noexcept override;
+
+	GoogleAccessTokenProvider(const GoogleAccessTokenProvider &) = delete;
+	GoogleAccessTokenProvider &operator=(const GoogleAccessTokenProvider &) = delete;
+	GoogleAccessTokenProvider(GoogleAccessTokenProvider &&) = delete;
+	GoogleAccessTokenProvider &operator=(GoogleAccessTokenProvider &&) = delete;
+
+	/**
+	 * Returns a fresh access token. Refreshes synchronously only when the cache cannot be used.
+	 * Thread-safe; throws if the AuthStore is not authorized or the refresh fails.
+	 */
+	[[nodiscard]]
+	std::string getAccessToken();
+
+	/**
+	 * True once the AuthStore has been restored from the keychain.
+	 */
+	bool isReady() const noexcept { return authStore_->isRestored(); }
+
+	/**
+	 * Completes once isReady() is true. See AuthStore::waitRestored() for where it resumes.
+	 */
+	auto waitUntilReady() noexcept { return authStore_->waitRestored(); }
+
+private slots:
+	void onRefreshTimerTimeout();
+
+private:
+	class State;
+
+	const std::shared_ptr<AuthStore> authStore_;
+	const std::shared_ptr<State> state_;
+	// Background refreshes run here rather than on a shared Qt pool.
+	const std::shared_ptr<Async::ThreadPoolExecutor> networkExecutor_;
+	QTimer *const refreshTimer_;
+};
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Store
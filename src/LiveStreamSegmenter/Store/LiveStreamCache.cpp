@@ -0,0 +1,247 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - Store Module
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "LiveStreamCache.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+#include <KaitoTokyo/YouTubeApi/YouTubeApiClient.hpp>
+
+#include "AtomicSnapshot.hpp"
+
+namespace KaitoTokyo::LiveStreamSegmenter::Store {
+
+namespace {
+
+// Every live stream resource carries an ETag, so equal ids and ETags in the same order mean an equal list.
+bool isSameList(const std::vector<YouTubeApi::YouTubeLiveStream> &a,
+		const std::vector<YouTubeApi::YouTubeLiveStream> &b) noexcept
+{
+	return std::equal(a.begin(), a.end(), b.begin(), b.end(),
+			  [](const YouTubeApi::YouTubeLiveStream &x, const YouTubeApi::YouTubeLiveStream &y) {
+				  return x.id == y.id && x.etag == y.etag && !x.etag.empty();
+			  });
+}
+
+} // anonymous namespace
+
+class LiveStreamCache::State {
+public:
+	State(std::shared_ptr<AuthStore> authStore, std::shared_ptr<GoogleAccessTokenProvider> tokenProvider,
+	      std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool, std::shared_ptr<const Logger::ILogger> logger)
+		: authStore_(authStore ? std::move(authStore)
+				       : throw std::invalid_argument("AuthStoreIsNullError(LiveStreamCache)")),
+		  tokenProvider_(tokenProvider
+					 ? std::move(tokenProvider)
+					 : throw std::invalid_argument("TokenProviderIsNullError(LiveStreamCache)")),
+		  logger_(logger ? std::move(logger)
+				 : throw std::invalid_argument("LoggerIsNullError(LiveStreamCache)")),
+		  youTubeApiClient_(std::make_shared<YouTubeApi::YouTubeApiClient>(
+			  curlPool ? std::move(curlPool)
+				   : throw std::invalid_argument("CurlPoolIsNullError(LiveStreamCache)"))),
+		  snapshot_(std::make_shared<const LiveStreamListSnapshot>())
+	{
+		youTubeApiClient_->setLogger(logger_);
+	}
+
+	std::shared_ptr<const LiveStreamListSnapshot> load() const noexcept { return snapshot_.load(); }
+
+	void put(YouTubeApi::YouTubeLiveStream liveStream)
+	{
+		std::scoped_lock lock(mutex_);
+		LiveStreamListSnapshot next = *snapshot_.load();
+		auto it = std::find_if(next.liveStreams.begin(), next.liveStreams.end(),
+				       [&liveStream](const YouTubeApi::YouTubeLiveStream &cached) {
+					       return cached.id == liveStream.id;
+				       });
+		if (it == next.liveStreams.end()) {
+			next.liveStreams.push_back(std::move(liveStream));
+		} else if (!liveStream.etag.empty() && it->etag == liveStream.etag) {
+			return;
+		} else {
+			*it = std::move(liveStream);
+		}
+		publish(std::move(next), true);
+	}
+
+	void clear()
+	{
+		std::scoped_lock lock(mutex_);
+		clearCount_++;
+		publish(LiveStreamListSnapshot{}, true);
+	}
+
+	// Returns true if the caller has to start a revalidation, false if one in flight takes the callback.
+	bool enqueue(RevalidatedCallback onRevalidated)
+	{
+		std::scoped_lock lock(mutex_);
+		if (onRevalidated) {
+			callbacks_.push_back(std::move(onRevalidated));
+		}
+		if (revalidating_) {
+			return false;
+		}
+		revalidating_ = true;
+		return true;
+	}
+
+	// Must be called from a worker thread
+	void revalidate() noexcept
+	{
+		std::vector<RevalidatedCallback> callbacks;
+		std::optional<std::string> error;
+		for (;;) {
+			const std::uint64_t clearCount = [this]() {
+				std::scoped_lock lock(mutex_);
+				return clearCount_;
+			}();
+
+			error.reset();
+			try {
+				if (authStore_->getGoogleTokenState().isAuthorized()) {
+					const std::string accessToken = tokenProvider_->getAccessToken();
+					std::vector<YouTubeApi::YouTubeLiveStream> liveStreams =
+						youTubeApiClient_->listLiveStreams(accessToken);
+					logger_->info("LiveStreamCacheRevalidated",
+						      {{"liveStreamCount", std::to_string(liveStreams.size())}});
+					publishList(std::move(liveStreams), clearCount);
+				} else {
+					logger_->info("LiveStreamCacheNotAuthorized");
+				}
+			} catch (const std::exception &e) {
+				logger_->error("LiveStreamCacheRevalidateError", {{"exception", e.what()}});
+				error = e.what();
+			} catch (...) {
+				logger_->error("LiveStreamCacheRevalidateUnknownError");
+				error = "Unknown error";
+			}
+
+			std::scoped_lock lock(mutex_);
+			if (clearCount == clearCount_) {
+				callbacks.swap(callbacks_);
+				revalidating_ = false;
+				break;
+			}
+			// Cleared meanwhile, so the list above was dropped; callers that asked since expect a new one.
+		}
+
+		const std::shared_ptr<const LiveStreamListSnapshot> snapshot = snapshot_.load();
+		for (const RevalidatedCallback &callback : callbacks) {
+			try {
+				callback(snapshot, error);
+			} catch (const std::exception &e) {
+				logger_->error("LiveStreamCacheCallbackError", {{"exception", e.what()}});
+			} catch (...) {
+				logger_->error("LiveStreamCacheCallbackUnknownError");
+			}
+		}
+	}
+
+private:
+	void publishList(std::vector<YouTubeApi::YouTubeLiveStream> liveStreams, std::uint64_t clearCount)
+	{
+		std::scoped_lock lock(mutex_);
+		if (clearCount != clearCount_) {
+			// Listed for the account signed in before clear(), which may not be the current one.
+			logger_->info("LiveStreamCacheRevalidationDiscarded");
+			return;
+		}
+		LiveStreamListSnapshot next = *snapshot_.load();
+		const bool changed = !isSameList(next.liveStreams, liveStreams);
+		next.listedAt = std::chrono::steady_clock::now();
+		next.liveStreams = std::move(liveStreams);
+		publish(std::move(next), changed);
+	}
+
+	// Requires mutex_ to be held.
+	void publish(LiveStreamListSnapshot next, bool changed)
+	{
+		next.version = snapshot_.load()->version + (changed ? 1 : 0);
+		snapshot_.store(std::make_shared<const LiveStreamListSnapshot>(std::move(next)));
+	}
+
+	const std::shared_ptr<AuthStore> authStore_;
+	const std::shared_ptr<GoogleAccessTokenProvider> tokenProvider_;
+	const std::shared_ptr<const Logger::ILogger> logger_;
+	// Keeps the ETags of earlier lists, so an unchanged list is answered with 304 Not Modified.
+	const std::shared_ptr<YouTubeApi::YouTubeApiClient> youTubeApiClient_;
+
+	// Serializes writers and guards the members below it; readers only load snapshot_.
+	std::mutex mutex_;
+	AtomicSnapshot<LiveStreamListSnapshot> snapshot_;
+	std::vector<RevalidatedCallback> callbacks_;
+	bool revalidating_ = false;
+	std::uint64_t clearCount_ = 0;
+};
+
+LiveStreamCache::LiveStreamCache(std::shared_ptr<AuthStore> authStore,
+				 std::shared_ptr<GoogleAccessTokenProvider> tokenProvider,
+				 std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool,
+				 std::shared_ptr<Async::ThreadPoolExecutor> networkExecutor,
+				 std::shared_ptr<const Logger::ILogger> logger)
+	: state_(std::make_shared<State>(std::move(authStore), std::move(tokenProvider), std::move(curlPool),
+					 std::move(logger))),
+	  networkExecutor_(networkExecutor
+				   ? std::move(networkExecutor)
+				   : throw std::invalid_argument("NetworkExecutorIsNullError(LiveStreamCache)"))
+{
+}
+
+LiveStreamCache::~LiveStreamCache() noexcept = default;
+
+std::shared_ptr<const LiveStreamListSnapshot> LiveStreamCache::getSnapshot() const noexcept
+{
+	return state_->load();
+}
+
+std::optional<YouTubeApi::YouTubeLiveStream> LiveStreamCache::find(const std::string &liveStreamId) const
+{
+	const std::shared_ptr<const LiveStreamListSnapshot> snapshot = state_->load();
+	for (const YouTubeApi::YouTubeLiveStream &liveStream : snapshot->liveStreams) {
+		if (liveStream.id == liveStreamId) {
+			return liveStream;
+		}
+	}
+	return std::nullopt;
+}
+
+void LiveStreamCache::put(YouTubeApi::YouTubeLiveStream liveStream)
+{
+	state_->put(std::move(liveStream));
+}
+
+void LiveStreamCache::revalidate(RevalidatedCallback onRevalidated)
+{
+	if (state_->enqueue(std::move(onRevalidated))) {
+		// A revalidation in flight keeps the state alive even if this cache is destroyed meanwhile.
+		networkExecutor_->post([state = state_]() { state->revalidate(); });
+	}
+}
+
+void LiveStreamCache::clear()
+{
+	state_->clear();
+}
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Store
@@ -0,0 +1,114 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - Store Module
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <KaitoTokyo/Async/ThreadPoolExecutor.hpp>
+#include <KaitoTokyo/CurlHelper/CurlConnectionPool.hpp>
+#include <KaitoTokyo/Logger/ILogger.hpp>
+#include <KaitoTokyo/YouTubeApi/YouTubeTypes.hpp>
+
+#include "AuthStore.hpp"
+#include "GoogleAccessTokenProvider.hpp"
+
+namespace KaitoTokyo::LiveStreamSegmenter::Store {
+
+/**
+ * The live streams of the channel as last seen. Never modified once published, so readers may keep it,
+ * and anything derived from it, for as long as the version matches.
+ */
+struct LiveStreamListSnapshot {
+	// Incremented whenever the live streams change; a revalidation that finds no change keeps it.
+	std::uint64_t version = 0;
+	// When the whole list was last fetched; unset until then, even if single live streams were put.
+	std::optional<std::chrono::steady_clock::time_point> listedAt;
+	std::vector<YouTubeApi::YouTubeLiveStream> liveStreams;
+};
+
+/**
+ * Caches the channel's live streams for the settings dialog and the main loop of one session.
+ *
+ * Readers get the last list at once from getSnapshot() and ask for a revalidation, which runs on the
+ * network pool; one in flight is shared by every caller that asks meanwhile. The list request goes
+ * through a single YouTubeApiClient, so an unchanged list costs a conditional request only.
+ */
+class LiveStreamCache {
+public:
+	/**
+	 * Receives the snapshot after a revalidation, on a network worker thread. If the revalidation failed,
+	 * the snapshot is the previous one and error holds why; error is unset otherwise.
+	 */
+	using RevalidatedCallback =
+		std::function<void(std::shared_ptr<const LiveStreamListSnapshot>, std::optional<std::string> error)>;
+
+	LiveStreamCache(std::shared_ptr<AuthStore> authStore, std::shared_ptr<GoogleAccessTokenProvider> tokenProvider,
+			std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool,
+			std::shared_ptr<Async::ThreadPoolExecutor> networkExecutor,
+			std::shared_ptr<const Logger::ILogger> logger);
+
+	~LiveStreamCache() noexcept;
+
+	LiveStreamCache(const LiveStreamCache &) = delete;
+	LiveStreamCache &operator=(const LiveStreamCache &) = delete;
+	LiveStreamCache(LiveStreamCache &&) = delete;
+	LiveStreamCache &operator=(LiveStreamCache &&) = delete;
+
+	/**
+	 * Returns the current contents without locking or copying them.
+	 */
+	std::shared_ptr<const LiveStreamListSnapshot> getSnapshot() const noexcept;
+
+	/**
+	 * Returns the cached live stream with the given id, if any.
+	 */
+	std::optional<YouTubeApi::YouTubeLiveStream> find(const std::string &liveStreamId) const;
+
+	/**
+	 * Adds or replaces one live stream, as fetched by id elsewhere.
+	 */
+	void put(YouTubeApi::YouTubeLiveStream liveStream);
+
+	/**
+	 * Fetches the list again in the background and then calls onRevalidated, which may be empty.
+	 * Thread-safe; never blocks on the network.
+	 */
+	void revalidate(RevalidatedCallback onRevalidated);
+
+	/**
+	 * Forgets every live stream, for when the signed-in account may have changed.
+	 */
+	void clear();
+
+private:
+	class State;
+
+	const std::shared_ptr<State> state_;
+	const std::shared_ptr<Async::ThreadPoolExecutor> networkExecutor_;
+};
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Store
@@ -0,0 +1,85 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - Store Module
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ProfilePaths.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <obs-frontend-api.h>
+
+#include <KaitoTokyo/ObsBridgeUtils/ObsUnique.hpp>
+
+namespace KaitoTokyo::LiveStreamSegmenter::Store {
+
+namespace {
+
+ProfilePaths makeProfilePaths(const std::filesystem::path &profileDirectory, const std::string &sessionPrefix)
+{
+	const std::string prefix = "live-stream-segmenter_";
+	return ProfilePaths{
+		.profileDirectory = profileDirectory,
+		.profileStoreDatabase = profileDirectory / (sessionPrefix + "ProfileStore.sqlite"),
+		.youTubeStoreLegacyConfig = profileDirectory / (sessionPrefix + "YouTubeStore.json"),
+		.eventHandlerStoreLegacyConfig = profileDirectory / (sessionPrefix + "EventHandlerStore.json"),
+		.eventHandlerDatabase = profileDirectory / (sessionPrefix + "EventHandlerStore_db.sqlite"),
+		.eventHandlerBytecodeCache = profileDirectory / (sessionPrefix + "EventHandlerStore_bytecode.bin"),
+		.sessionJournal = profileDirectory / (sessionPrefix + "SessionJournal.jsonl"),
+		.sessionLogDirectory = profileDirectory / (prefix + "SessionLogs"),
+		.metricsConfig = profileDirectory / (prefix + "Metrics.json"),
+		.sessionsConfig = profileDirectory / (prefix + "Sessions.json"),
+		.asyncTrace = profileDirectory / (sessionPrefix + "AsyncTrace.json"),
+	};
+}
+
+} // anonymous namespace
+
+ProfilePaths ProfilePaths::fromProfileDirectory(const std::filesystem::path &profileDirectory)
+{
+	return makeProfilePaths(profileDirectory, "live-stream-segmenter_");
+}
+
+ProfilePaths ProfilePaths::forSession(const std::string &sessionId) const
+{
+	if (!isValidSessionId(sessionId)) {
+		throw std::invalid_argument("InvalidSessionIdError(ProfilePaths::forSession)");
+	}
+	return makeProfilePaths(profileDirectory, "live-stream-segmenter_" + sessionId + "_");
+}
+
+bool ProfilePaths::isValidSessionId(std::string_view sessionId) noexcept
+{
+	return !sessionId.empty() && sessionId.size() <= 32 && std::ranges::all_of(sessionId, [](char c) {
+		return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '-' ||
+		       c == '_';
+	});
+}
+
+ProfilePaths ProfilePaths::fromCurrentProfile()
+{
+	ObsBridgeUtils::unique_bfree_char_t profilePathRaw(obs_frontend_get_current_profile_path());
+	if (!profilePathRaw) {
+		throw std::runtime_error("GetCurrentProfilePathFailed(ProfilePaths::fromCurrentProfile)");
+	}
+
+	return fromProfileDirectory(std::filesystem::path(reinterpret_cast<const char8_t *>(profilePathRaw.get())));
+}
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Store
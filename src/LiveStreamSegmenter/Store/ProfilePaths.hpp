@@ -0,0 +1,71 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - Store Module
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace KaitoTokyo::LiveStreamSegmenter::Store {
+
+/**
+ * Every file the plugin keeps in one OBS profile directory, resolved once when the profile is loaded.
+ * ProfileContext owns it and is rebuilt on OBS_FRONTEND_EVENT_PROFILE_CHANGED, so holders never see
+ * paths of a profile that is no longer current.
+ */
+struct ProfilePaths {
+	std::filesystem::path profileDirectory;
+	std::filesystem::path profileStoreDatabase;
+	// Read once to migrate settings saved before the profile store existed.
+	std::filesystem::path youTubeStoreLegacyConfig;
+	std::filesystem::path eventHandlerStoreLegacyConfig;
+	std::filesystem::path eventHandlerDatabase;
+	std::filesystem::path eventHandlerBytecodeCache;
+	std::filesystem::path sessionJournal;
+	std::filesystem::path sessionLogDirectory;
+	std::filesystem::path metricsConfig;
+	// Lists the additional segmenter sessions of the profile.
+	std::filesystem::path sessionsConfig;
+	std::filesystem::path asyncTrace;
+
+	static ProfilePaths fromProfileDirectory(const std::filesystem::path &profileDirectory);
+
+	/**
+	 * The paths of an additional session in the same profile. Files that belong to one session get the
+	 * session id in their name; the session logs, the metrics config and the sessions config are shared.
+	 *
+	 * @throws std::invalid_argument If isValidSessionId(sessionId) is false.
+	 */
+	ProfilePaths forSession(const std::string &sessionId) const;
+
+	/**
+	 * Session ids end up in file names and dock ids, so only ASCII letters, digits, '-' and '_' are
+	 * allowed, up to 32 of them.
+	 */
+	static bool isValidSessionId(std::string_view sessionId) noexcept;
+
+	/**
+	 * @throws std::runtime_error If OBS has no current profile.
+	 */
+	static ProfilePaths fromCurrentProfile();
+};
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Store
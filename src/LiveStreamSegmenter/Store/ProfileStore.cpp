@@ -0,0 +1,252 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - Store Module
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ProfileStore.hpp"
+
+#include <array>
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <KaitoTokyo/Async/TimerService.hpp>
+
+namespace KaitoTokyo::LiveStreamSegmenter::Store {
+
+namespace {
+
+constexpr const char *kCreateTableSql =
+	"CREATE TABLE IF NOT EXISTS profile_store (key TEXT PRIMARY KEY, value TEXT NOT NULL);";
+constexpr const char *kSelectAllSql = "SELECT key, value FROM profile_store;";
+constexpr const char *kUpsertSql = "INSERT OR REPLACE INTO profile_store (key, value) VALUES (?, ?);";
+constexpr const char *kBeginSql = "BEGIN IMMEDIATE;";
+constexpr const char *kCommitSql = "COMMIT;";
+constexpr const char *kRollbackSql = "ROLLBACK;";
+
+struct StatementFinalizer {
+	void operator()(sqlite3_stmt *stmt) const noexcept { sqlite3_finalize(stmt); }
+};
+
+using unique_sqlite3_stmt_t = std::unique_ptr<sqlite3_stmt, StatementFinalizer>;
+
+unique_sqlite3_stmt_t prepare(sqlite3 *db, const char *sql)
+{
+	sqlite3_stmt *stmt = nullptr;
+	if (sqlite3_prepare_v2(db, sql, -1, &stmt, nullptr) != SQLITE_OK) {
+		throw std::runtime_error(fmt::format("PrepareError(ProfileStore):{}", sqlite3_errmsg(db)));
+	}
+	return unique_sqlite3_stmt_t(stmt);
+}
+
+std::string readTextColumn(sqlite3_stmt *stmt, int column)
+{
+	const unsigned char *text = sqlite3_column_text(stmt, column);
+	if (!text) {
+		return {};
+	}
+	return std::string(reinterpret_cast<const char *>(text),
+			   static_cast<std::size_t>(sqlite3_column_bytes(stmt, column)));
+}
+
+} // anonymous namespace
+
+ProfileStore::ProfileStore(std::filesystem::path databasePath, std::shared_ptr<Async::ThreadPoolExecutor> ioExecutor,
+			   std::shared_ptr<const Logger::ILogger> logger, std::chrono::milliseconds flushDelay)
+	: databasePath_(!databasePath.empty() ? std::move(databasePath)
+					      : throw std::invalid_argument("DatabasePathIsEmptyError(ProfileStore)")),
+	  ioExecutor_(ioExecutor ? std::move(ioExecutor)
+				 : throw std::invalid_argument("IoExecutorIsNullError(ProfileStore)")),
+	  logger_(logger ? std::move(logger) : throw std::invalid_argument("LoggerIsNullError(ProfileStore)")),
+	  flushDelay_(flushDelay)
+{
+}
+
+ProfileStore::~ProfileStore() noexcept
+{
+	flushScope_.cancel();
+	try {
+		flushScope_.join();
+	} catch (...) {
+		// flushAfterDelay() does not throw; the final flush below covers whatever it left.
+	}
+	flush();
+}
+
+void ProfileStore::restore()
+{
+	std::scoped_lock databaseLock(databaseMutex_);
+
+	if (!db_) {
+		sqlite3 *db = nullptr;
+		const std::u8string databasePathU8 = databasePath_.u8string();
+		const int result = sqlite3_open_v2(reinterpret_cast<const char *>(databasePathU8.c_str()), &db,
+						   SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, nullptr);
+		db_.reset(db);
+		if (result != SQLITE_OK) {
+			logger_->error("ProfileStoreOpenError",
+				       {{"path", databasePath_.string()}, {"message", sqlite3_errmsg(db)}});
+			db_.reset();
+			throw std::runtime_error("OpenError(ProfileStore::restore)");
+		}
+	}
+
+	if (sqlite3_exec(db_.get(), kCreateTableSql, nullptr, nullptr, nullptr) != SQLITE_OK) {
+		throw std::runtime_error(
+			fmt::format("CreateTableError(ProfileStore::restore):{}", sqlite3_errmsg(db_.get())));
+	}
+
+	unique_sqlite3_stmt_t stmt = prepare(db_.get(), kSelectAllSql);
+	std::map<std::string, std::string, std::less<>> items;
+	int rc;
+	while ((rc = sqlite3_step(stmt.get())) == SQLITE_ROW) {
+		items.insert_or_assign(readTextColumn(stmt.get(), 0), readTextColumn(stmt.get(), 1));
+	}
+	if (rc != SQLITE_DONE) {
+		throw std::runtime_error(
+			fmt::format("SelectError(ProfileStore::restore):{}", sqlite3_errmsg(db_.get())));
+	}
+
+	std::scoped_lock lock(mutex_);
+	// Keys set before restore() win over what the database had.
+	for (auto &[name, value] : items) {
+		items_.try_emplace(name, std::move(value));
+	}
+	logger_->info("ProfileStoreRestored", {{"itemCount", std::to_string(items_.size())}});
+}
+
+bool ProfileStore::flush() noexcept
+{
+	std::scoped_lock databaseLock(databaseMutex_);
+
+	std::map<std::string, std::string, std::less<>> dirty;
+	{
+		std::scoped_lock lock(mutex_);
+		dirty.swap(dirty_);
+	}
+	if (dirty.empty()) {
+		return true;
+	}
+
+	try {
+		if (!db_) {
+			throw std::runtime_error("DatabaseNotOpenError(ProfileStore::flush)");
+		}
+		writeDirty(dirty);
+	} catch (const std::exception &e) {
+		logger_->warn("ProfileStoreFlushError", {{"exception", e.what()}});
+		std::scoped_lock lock(mutex_);
+		// Keys set again while this flush ran already carry a newer value.
+		dirty_.merge(dirty);
+		return false;
+	}
+
+	logger_->debug("ProfileStoreFlushed", [&] {
+		return std::to_array<Logger::OwnedLogField>({{"dirtyCount", std::to_string(dirty.size())}});
+	});
+	return true;
+}
+
+std::optional<std::string> ProfileStore::getRaw(std::string_view name) const
+{
+	std::scoped_lock lock(mutex_);
+	const auto it = items_.find(name);
+	if (it == items_.end()) {
+		return std::nullopt;
+	}
+	return it->second;
+}
+
+void ProfileStore::setRaw(std::string_view name, std::string value)
+{
+	{
+		std::scoped_lock lock(mutex_);
+		const auto it = items_.find(name);
+		if (it != items_.end() && it->second == value) {
+			return;
+		}
+		items_.insert_or_assign(std::string(name), value);
+		dirty_.insert_or_assign(std::string(name), std::move(value));
+		if (flushScheduled_) {
+			return;
+		}
+		flushScheduled_ = true;
+	}
+	flushScope_.spawn(flushAfterDelay(flushScope_.token()));
+}
+
+Async::Task<void> ProfileStore::flushAfterDelay(Async::CancellationToken token)
+{
+	for (;;) {
+		try {
+			co_await Async::sleepFor(flushDelay_, token);
+		} catch (const Async::OperationCancelledError &) {
+			// Shutting down: flush right away instead of after the delay.
+		}
+
+		co_await Async::ResumeOn{*ioExecutor_};
+		{
+			std::scoped_lock lock(mutex_);
+			// Writes made from here on arm a new flush rather than joining this one.
+			flushScheduled_ = false;
+		}
+		if (flush() || token.isCancellationRequested()) {
+			co_return;
+		}
+
+		// The failed keys are dirty again; retry after another delay unless a set() meanwhile armed a flush.
+		{
+			std::scoped_lock lock(mutex_);
+			if (flushScheduled_) {
+				co_return;
+			}
+			flushScheduled_ = true;
+		}
+	}
+}
+
+void ProfileStore::writeDirty(const std::map<std::string, std::string, std::less<>> &dirty)
+{
+	sqlite3 *db = db_.get();
+	if (sqlite3_exec(db, kBeginSql, nullptr, nullptr, nullptr) != SQLITE_OK) {
+		throw std::runtime_error(fmt::format("BeginError(ProfileStore::writeDirty):{}", sqlite3_errmsg(db)));
+	}
+
+	try {
+		unique_sqlite3_stmt_t stmt = prepare(db, kUpsertSql);
+		for (const auto &[name, value] : dirty) {
+			sqlite3_reset(stmt.get());
+			sqlite3_bind_text(stmt.get(), 1, name.data(), static_cast<int>(name.size()), SQLITE_STATIC);
+			sqlite3_bind_text(stmt.get(), 2, value.data(), static_cast<int>(value.size()), SQLITE_STATIC);
+			if (sqlite3_step(stmt.get()) != SQLITE_DONE) {
+				throw std::runtime_error(
+					fmt::format("WriteError(ProfileStore::writeDirty):{}", sqlite3_errmsg(db)));
+			}
+		}
+		if (sqlite3_exec(db, kCommitSql, nullptr, nullptr, nullptr) != SQLITE_OK) {
+			throw std::runtime_error(
+				fmt::format("CommitError(ProfileStore::writeDirty):{}", sqlite3_errmsg(db)));
+		}
+	} catch (...) {
+		sqlite3_exec(db, kRollbackSql, nullptr, nullptr, nullptr);
+		throw;
+	}
+}
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Store
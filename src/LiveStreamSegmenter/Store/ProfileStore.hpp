@@ -0,0 +1,123 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - Store Module
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <nlohmann/json.hpp>
+#include <sqlite3.h>
+
+#include <KaitoTokyo/Async/Task.hpp>
+#include <KaitoTokyo/Async/TaskScope.hpp>
+#include <KaitoTokyo/Async/ThreadPoolExecutor.hpp>
+#include <KaitoTokyo/Logger/ILogger.hpp>
+
+namespace KaitoTokyo::LiveStreamSegmenter::Store {
+
+/**
+ * Names a value in the ProfileStore together with its type. T is stored as JSON, so it needs
+ * to_json and from_json overloads, which the standard types already have.
+ */
+template<typename T> struct ProfileStoreKey {
+	std::string_view name;
+};
+
+/**
+ * One SQLite database per profile that holds the settings of every store as typed keys.
+ *
+ * restore() reads the whole table once; get() and set() only touch the in-memory copy after that.
+ * set() marks the key dirty and arms a flush that runs flushDelay later on ioExecutor, so a burst of
+ * changes is written once, in one transaction. A failed flush is retried after another flushDelay. The
+ * destructor flushes what is still dirty.
+ */
+class ProfileStore {
+public:
+	ProfileStore(std::filesystem::path databasePath, std::shared_ptr<Async::ThreadPoolExecutor> ioExecutor,
+		     std::shared_ptr<const Logger::ILogger> logger,
+		     std::chrono::milliseconds flushDelay = std::chrono::milliseconds(500));
+
+	~ProfileStore() noexcept;
+
+	ProfileStore(const ProfileStore &) = delete;
+	ProfileStore &operator=(const ProfileStore &) = delete;
+	ProfileStore(ProfileStore &&) = delete;
+	ProfileStore &operator=(ProfileStore &&) = delete;
+
+	/**
+	 * Opens the database and reads every key. Call once before the other methods.
+	 */
+	void restore();
+
+	template<typename T> std::optional<T> get(const ProfileStoreKey<T> &key) const
+	{
+		const std::optional<std::string> value = getRaw(key.name);
+		if (!value) {
+			return std::nullopt;
+		}
+		return nlohmann::json::parse(*value).get<T>();
+	}
+
+	template<typename T> void set(const ProfileStoreKey<T> &key, const T &value)
+	{
+		setRaw(key.name, nlohmann::json(value).dump());
+	}
+
+	/**
+	 * Writes the dirty keys in one transaction. On failure they stay dirty for the next flush and
+	 * false is returned. Blocks the calling thread; set() schedules this on the IO executor.
+	 */
+	bool flush() noexcept;
+
+private:
+	std::optional<std::string> getRaw(std::string_view name) const;
+	void setRaw(std::string_view name, std::string value);
+
+	Async::Task<void> flushAfterDelay(Async::CancellationToken token);
+	void writeDirty(const std::map<std::string, std::string, std::less<>> &dirty);
+
+	const std::filesystem::path databasePath_;
+	const std::shared_ptr<Async::ThreadPoolExecutor> ioExecutor_;
+	const std::shared_ptr<const Logger::ILogger> logger_;
+	const std::chrono::milliseconds flushDelay_;
+
+	mutable std::mutex mutex_;
+	std::map<std::string, std::string, std::less<>> items_;
+	// Keys set since the last flush, with their serialized values.
+	std::map<std::string, std::string, std::less<>> dirty_;
+	bool flushScheduled_ = false;
+
+	// Serializes flushes; the connection is only used under it.
+	std::mutex databaseMutex_;
+	std::unique_ptr<sqlite3, decltype(&sqlite3_close_v2)> db_{nullptr, sqlite3_close_v2};
+
+	// Holds the pending delayed flush; the destructor cancels and joins it before flushing itself.
+	Async::TaskScope flushScope_;
+};
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Store
@@ -0,0 +1,197 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - Store Module
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "SessionJournal.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include <nlohmann/json.hpp>
+
+namespace KaitoTokyo::LiveStreamSegmenter::Store {
+
+namespace {
+
+struct FileCloser {
+	void operator()(std::FILE *file) const noexcept { std::fclose(file); }
+};
+
+using unique_file_t = std::unique_ptr<std::FILE, FileCloser>;
+
+unique_file_t openJournalFile(const std::filesystem::path &path, bool truncate)
+{
+#ifdef _WIN32
+	return unique_file_t(_wfopen(path.c_str(), truncate ? L"wb" : L"ab"));
+#else
+	return unique_file_t(std::fopen(path.c_str(), truncate ? "wb" : "ab"));
+#endif
+}
+
+bool syncJournalFile(std::FILE *file) noexcept
+{
+	if (std::fflush(file) != 0) {
+		return false;
+	}
+#ifdef _WIN32
+	return _commit(_fileno(file)) == 0;
+#else
+	return fsync(fileno(file)) == 0;
+#endif
+}
+
+nlohmann::json recordToJson(const SessionJournalRecord &record)
+{
+	nlohmann::json broadcasts = nlohmann::json::array();
+	for (const SessionJournalBroadcast &broadcast : record.broadcasts) {
+		broadcasts.push_back({
+			{"id", broadcast.id},
+			{"liveStreamIndex", broadcast.liveStreamIndex},
+			{"state", broadcast.state},
+		});
+	}
+
+	return {
+		{"phase", record.phase},
+		{"currentLiveStreamIndex", record.currentLiveStreamIndex},
+		{"broadcasts", std::move(broadcasts)},
+		{"liveStreamIds", record.liveStreamIds},
+	};
+}
+
+SessionJournalRecord recordFromJson(const nlohmann::json &j)
+{
+	SessionJournalRecord record;
+	j.at("phase").get_to(record.phase);
+	j.at("currentLiveStreamIndex").get_to(record.currentLiveStreamIndex);
+	for (const nlohmann::json &broadcastJson : j.at("broadcasts")) {
+		SessionJournalBroadcast broadcast;
+		broadcastJson.at("id").get_to(broadcast.id);
+		broadcastJson.at("liveStreamIndex").get_to(broadcast.liveStreamIndex);
+		broadcastJson.at("state").get_to(broadcast.state);
+		record.broadcasts.push_back(std::move(broadcast));
+	}
+	if (j.contains("liveStreamIds")) {
+		j.at("liveStreamIds").get_to(record.liveStreamIds);
+	}
+	return record;
+}
+
+} // anonymous namespace
+
+SessionJournal::SessionJournal(std::filesystem::path journalPath)
+	: journalPath_(!journalPath.empty() ? std::move(journalPath)
+					    : throw std::invalid_argument("JournalPathIsEmptyError(SessionJournal)"))
+{
+}
+
+SessionJournal::~SessionJournal() noexcept = default;
+
+const std::filesystem::path &SessionJournal::getJournalPath() const noexcept
+{
+	return journalPath_;
+}
+
+void SessionJournal::setLogger(std::shared_ptr<const Logger::ILogger> logger)
+{
+	std::scoped_lock lock(mutex_);
+	logger_ = std::move(logger);
+}
+
+void SessionJournal::append(const SessionJournalRecord &record) const
+{
+	const std::filesystem::path &journalPath = journalPath_;
+	const std::string line = recordToJson(record).dump() + "\n";
+
+	std::scoped_lock lock(mutex_);
+
+	unique_file_t file = openJournalFile(journalPath, false);
+	if (!file) {
+		logger_->error("FileOpenError", {{"path", journalPath.string()}});
+		throw std::runtime_error("FileOpenError(SessionJournal::append)");
+	}
+
+	if (std::fwrite(line.data(), 1, line.size(), file.get()) != line.size() || !syncJournalFile(file.get())) {
+		logger_->error("FileWriteError", {{"path", journalPath.string()}});
+		throw std::runtime_error("FileWriteError(SessionJournal::append)");
+	}
+
+	logger_->info("SessionJournalAppended",
+		      {{"phase", record.phase},
+		       {"currentLiveStreamIndex", std::to_string(record.currentLiveStreamIndex)}});
+}
+
+std::optional<SessionJournalRecord> SessionJournal::replay() const
+{
+	const std::filesystem::path &journalPath = journalPath_;
+
+	std::scoped_lock lock(mutex_);
+
+	if (!std::filesystem::is_regular_file(journalPath)) {
+		logger_->info("SessionJournalNotExist", {{"path", journalPath.string()}});
+		return std::nullopt;
+	}
+
+	std::ifstream ifs(journalPath, std::ios::in);
+	if (!ifs.is_open()) {
+		logger_->error("FileOpenError", {{"path", journalPath.string()}});
+		throw std::runtime_error("FileOpenError(SessionJournal::replay)");
+	}
+
+	std::optional<SessionJournalRecord> lastRecord;
+	std::size_t lineNumber = 0;
+	for (std::string line; std::getline(ifs, line);) {
+		++lineNumber;
+		if (line.empty()) {
+			continue;
+		}
+
+		try {
+			lastRecord = recordFromJson(nlohmann::json::parse(line));
+		} catch (const std::exception &e) {
+			// Only the line being written when the process died can be torn; keep the previous record.
+			logger_->warn("SessionJournalRecordSkipped",
+				      {{"lineNumber", std::to_string(lineNumber)}, {"exception", e.what()}});
+		}
+	}
+
+	return lastRecord;
+}
+
+void SessionJournal::reset() const
+{
+	const std::filesystem::path &journalPath = journalPath_;
+
+	std::scoped_lock lock(mutex_);
+
+	unique_file_t file = openJournalFile(journalPath, true);
+	if (!file || !syncJournalFile(file.get())) {
+		logger_->error("FileOpenError", {{"path", journalPath.string()}});
+		throw std::runtime_error("FileOpenError(SessionJournal::reset)");
+	}
+}
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Store
@@ -0,0 +1,96 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - Store Module
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <KaitoTokyo/Logger/ILogger.hpp>
+
+namespace KaitoTokyo::LiveStreamSegmenter::Store {
+
+struct SessionJournalBroadcast {
+	std::string id;
+	std::size_t liveStreamIndex = 0;
+	// One of "created", "live", "completing" or "complete".
+	std::string state;
+};
+
+struct SessionJournalRecord {
+	// One of "started", "cutover", "segmented" or "stopped".
+	std::string phase;
+	std::size_t currentLiveStreamIndex = 0;
+	std::vector<SessionJournalBroadcast> broadcasts;
+	// Indexed by live stream index; empty in records written before the ids were journaled.
+	std::vector<std::string> liveStreamIds;
+};
+
+/**
+ * Append-only journal of the running continuous session, kept in the profile directory.
+ *
+ * Every phase transition appends a full snapshot of the session and flushes it to disk, so
+ * after a crash the last complete record tells which broadcasts were live on which stream.
+ * A torn last line is ignored on replay.
+ */
+class SessionJournal {
+public:
+	explicit SessionJournal(std::filesystem::path journalPath);
+
+	~SessionJournal() noexcept;
+
+	SessionJournal(const SessionJournal &) = delete;
+	SessionJournal &operator=(const SessionJournal &) = delete;
+	SessionJournal(SessionJournal &&) = delete;
+	SessionJournal &operator=(SessionJournal &&) = delete;
+
+	const std::filesystem::path &getJournalPath() const noexcept;
+
+	void setLogger(std::shared_ptr<const Logger::ILogger> logger);
+
+	/**
+	 * Appends the record and returns only after it has been flushed to disk.
+	 */
+	void append(const SessionJournalRecord &record) const;
+
+	/**
+	 * Returns the last complete record, or std::nullopt when the journal is missing or empty.
+	 */
+	std::optional<SessionJournalRecord> replay() const;
+
+	/**
+	 * Truncates the journal so that it only covers the session about to start.
+	 */
+	void reset() const;
+
+private:
+	const std::filesystem::path journalPath_;
+
+	mutable std::mutex mutex_;
+
+	std::shared_ptr<const Logger::ILogger> logger_;
+};
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::Store
@@ -21,94 +21,95 @@
 #include "YouTubeStore.hpp"
 
 #include <fstream>
+#include <optional>
 #include <stdexcept>
 
 #include <nlohmann/json.hpp>
 
-#include <obs-frontend-api.h>
-
-#include <KaitoTokyo/ObsBridgeUtils/ObsUnique.hpp>
-
 namespace KaitoTokyo::LiveStreamSegmenter::Store {
 
-YouTubeStore::YouTubeStore() = default;
+namespace {
 
-YouTubeStore::~YouTubeStore() noexcept = default;
+constexpr ProfileStoreKey<std::vector<std::string>> kLiveStreamIdsKey{"youTube.liveStreamIds"};
 
-std::filesystem::path YouTubeStore::getConfigPath()
-{
-	ObsBridgeUtils::unique_bfree_char_t profilePathRaw(obs_frontend_get_current_profile_path());
-	if (!profilePathRaw) {
-		return {};
-	}
+} // anonymous namespace
 
-	std::filesystem::path profilePath(reinterpret_cast<const char8_t *>(profilePathRaw.get()));
-	return profilePath / "live-stream-segmenter_YouTubeStore.json";
+YouTubeStore::YouTubeStore(std::shared_ptr<const ProfilePaths> paths)
+	: paths_(paths ? std::move(paths) : throw std::invalid_argument("PathsIsNullError(YouTubeStore)")),
+	  snapshot_(std::make_shared<const YouTubeSnapshot>())
+{
 }
 
+YouTubeStore::~YouTubeStore() noexcept = default;
+
 void YouTubeStore::setLogger(std::shared_ptr<const Logger::ILogger> logger)
 {
 	std::scoped_lock lock(mutex_);
 	logger_ = std::move(logger);
 }
 
+void YouTubeStore::setProfileStore(std::shared_ptr<ProfileStore> profileStore)
+{
+	std::scoped_lock lock(mutex_);
+	profileStore_ = std::move(profileStore);
+}
+
 void YouTubeStore::setLiveStreamId(std::size_t index, std::string liveStreamId)
 {
 	std::scoped_lock lock(mutex_);
-	if (index >= liveStreamIds_.size()) {
-		liveStreamIds_.resize(index + 1);
+	YouTubeSnapshot next = *snapshot_.load();
+	if (index >= next.liveStreamIds.size()) {
+		next.liveStreamIds.resize(index + 1);
 	}
-	liveStreamIds_[index] = std::move(liveStreamId);
+	next.liveStreamIds[index] = std::move(liveStreamId);
+	publish(std::move(next));
 }
 
-std::string YouTubeStore::getLiveStreamId(std::size_t index) const
+void YouTubeStore::setLiveStreamIds(std::vector<std::string> liveStreamIds)
 {
 	std::scoped_lock lock(mutex_);
-	if (index < liveStreamIds_.size()) {
-		return liveStreamIds_[index];
+	YouTubeSnapshot next = *snapshot_.load();
+	next.liveStreamIds = std::move(liveStreamIds);
+	publish(std::move(next));
+}
+
+std::string YouTubeStore::getLiveStreamId(std::size_t index) const
+{
+	const std::shared_ptr<const YouTubeSnapshot> snapshot = snapshot_.load();
+	if (index < snapshot->liveStreamIds.size()) {
+		return snapshot->liveStreamIds[index];
 	} else {
 		return {};
 	}
 }
 
-void YouTubeStore::save() const
+std::shared_ptr<const YouTubeSnapshot> YouTubeStore::getSnapshot() const noexcept
 {
-	const std::filesystem::path configPath = getConfigPath();
-
-	std::vector<std::string> liveStreamIds;
-	{
-		std::scoped_lock lock(mutex_);
-		liveStreamIds = liveStreamIds_;
-	}
+	return snapshot_.load();
+}
 
-	nlohmann::json j{
-		{"liveStreamIds", liveStreamIds},
-	};
+void YouTubeStore::save() const
+{
+	profileStore_->set(kLiveStreamIdsKey, snapshot_.load()->liveStreamIds);
+}
 
-	std::filesystem::path tmpConfigPath = configPath;
-	tmpConfigPath += ".tmp";
-	std::ofstream ofs(tmpConfigPath, std::ios::out);
-	if (!ofs.is_open()) {
-		logger_->error("FileOpenError", {{"path", configPath.string()}});
-		throw std::runtime_error("FileOpenError(save)");
+void YouTubeStore::restore()
+{
+	std::optional<std::vector<std::string>> liveStreamIds = profileStore_->get(kLiveStreamIdsKey);
+	if (!liveStreamIds) {
+		restoreLegacyConfig();
+		return;
 	}
 
-	ofs << j;
-
-	ofs.close();
-
-	std::filesystem::path bakConfigPath = configPath;
-	bakConfigPath += ".bak";
-
-	if (std::filesystem::is_regular_file(configPath)) {
-		std::filesystem::rename(configPath, bakConfigPath);
-	}
-	std::filesystem::rename(tmpConfigPath, configPath);
+	std::scoped_lock lock(mutex_);
+	YouTubeSnapshot next = *snapshot_.load();
+	next.liveStreamIds = std::move(*liveStreamIds);
+	publish(std::move(next));
 }
 
-void YouTubeStore::restore()
+void YouTubeStore::restoreLegacyConfig()
 {
-	const std::filesystem::path configPath = getConfigPath();
+	const std::filesystem::path &configPath = paths_->youTubeStoreLegacyConfig;
 	if (!std::filesystem::is_regular_file(configPath)) {
 		logger_->info("YouTubeStoreConfigFileNotExist", {{"path", configPath.string()}});
 		return;
@@ -117,21 +118,33 @@ void YouTubeStore::restore()
 	std::ifstream ifs(configPath, std::ios::in);
 	if (!ifs.is_open()) {
 		logger_->error("FileOpenError", {{"path", configPath.string()}});
-		throw std::runtime_error("FileOpenError(restore)");
+		throw std::runtime_error("FileOpenError(restoreLegacyConfig)");
 	}
 
 	nlohmann::json j;
 	ifs >> j;
 
-	std::scoped_lock lock(mutex_);
-	try {
-		if (j.contains("liveStreamIds")) {
-			j.at("liveStreamIds").get_to(liveStreamIds_);
-		}
-	} catch (...) {
-		liveStreamIds_.clear();
-		throw;
+	std::vector<std::string> liveStreamIds;
+	if (j.contains("liveStreamIds")) {
+		j.at("liveStreamIds").get_to(liveStreamIds);
+	}
+
+	{
+		std::scoped_lock lock(mutex_);
+		YouTubeSnapshot next = *snapshot_.load();
+		next.liveStreamIds = std::move(liveStreamIds);
+		publish(std::move(next));
 	}
+
+	// The legacy file is left in place as a backup; the profile store is read from now on.
+	save();
+	logger_->info("YouTubeStoreMigrated", {{"path", configPath.string()}});
+}
+
+void YouTubeStore::publish(YouTubeSnapshot next)
+{
+	next.version = snapshot_.load()->version + 1;
+	snapshot_.store(std::make_shared<const YouTubeSnapshot>(std::move(next)));
 }
 
 } // namespace KaitoTokyo::LiveStreamSegmenter::Store
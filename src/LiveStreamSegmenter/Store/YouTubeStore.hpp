@@ -20,18 +20,40 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
 #include <memory>
 #include <mutex>
+#include <string>
+#include <vector>
 
 #include <KaitoTokyo/Logger/ILogger.hpp>
 #include <KaitoTokyo/YouTubeApi/YouTubeTypes.hpp>
 
+#include "AtomicSnapshot.hpp"
+#include "ProfilePaths.hpp"
+#include "ProfileStore.hpp"
+
 namespace KaitoTokyo::LiveStreamSegmenter::Store {
 
+/**
+ * The contents of a YouTubeStore at one version. Never modified once published, so readers may keep
+ * it, and anything derived from it, for as long as the version matches.
+ */
+struct YouTubeSnapshot {
+	// Incremented by every write.
+	std::uint64_t version = 0;
+	std::vector<std::string> liveStreamIds;
+};
+
 class YouTubeStore {
 public:
-	YouTubeStore();
+	// Bounds of the live stream rotation; a continuous session needs at least kMinLiveStreams ids set.
+	static constexpr std::size_t kMinLiveStreams = 2;
+	static constexpr std::size_t kMaxLiveStreams = 8;
+
+	explicit YouTubeStore(std::shared_ptr<const ProfilePaths> paths);
 
 	~YouTubeStore() noexcept;
 
@@ -40,23 +62,42 @@ public:
 	YouTubeStore(YouTubeStore &&) = delete;
 	YouTubeStore &operator=(YouTubeStore &&) = delete;
 
-	static std::filesystem::path getConfigPath();
-
 	void setLogger(std::shared_ptr<const Logger::ILogger> logger);
 
+	void setProfileStore(std::shared_ptr<ProfileStore> profileStore);
+
 	void setLiveStreamId(std::size_t index, std::string liveStreamId);
 
+	/**
+	 * Replaces the whole rotation, in the order the live streams take turns.
+	 */
+	void setLiveStreamIds(std::vector<std::string> liveStreamIds);
+
 	std::string getLiveStreamId(std::size_t index) const;
 
+	/**
+	 * Returns the current contents without locking or copying them.
+	 */
+	std::shared_ptr<const YouTubeSnapshot> getSnapshot() const noexcept;
+
 	void save() const;
 
 	void restore();
 
 private:
+	void restoreLegacyConfig();
+
+	// Requires mutex_ to be held.
+	void publish(YouTubeSnapshot next);
+
+	const std::shared_ptr<const ProfilePaths> paths_;
+
+	// Serializes writers; readers only load snapshot_.
 	mutable std::mutex mutex_;
-	std::vector<std::string> liveStreamIds_;
+	AtomicSnapshot<YouTubeSnapshot> snapshot_;
 
 	std::shared_ptr<const Logger::ILogger> logger_;
+	std::shared_ptr<ProfileStore> profileStore_;
 };
 
 } // namespace KaitoTokyo::LiveStreamSegmenter::Store
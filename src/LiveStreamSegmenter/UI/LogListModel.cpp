@@ -0,0 +1,140 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - UI Module
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "LogListModel.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace KaitoTokyo::LiveStreamSegmenter::UI {
+
+LogListModel::LogListModel(std::size_t capacity, QObject *parent)
+	: QAbstractListModel(parent),
+	  capacity_(std::max<std::size_t>(capacity, 1))
+{
+	// Default-constructed QStrings and QColors do not allocate.
+	ring_.resize(capacity_);
+}
+
+int LogListModel::rowCount(const QModelIndex &parent) const
+{
+	return parent.isValid() ? 0 : static_cast<int>(visible_.size());
+}
+
+QVariant LogListModel::data(const QModelIndex &index, int role) const
+{
+	if (!index.isValid() || index.row() < 0 || static_cast<std::size_t>(index.row()) >= visible_.size()) {
+		return {};
+	}
+
+	const LogListEntry &entry = entryAt(visible_[static_cast<std::size_t>(index.row())]);
+	switch (role) {
+	case Qt::DisplayRole:
+		return QString("[%1] %2").arg(entry.timestamp, entry.text);
+	case Qt::ToolTipRole:
+		return entry.text;
+	case Qt::ForegroundRole:
+		return entry.color;
+	case LevelRole:
+		return entry.level;
+	default:
+		return {};
+	}
+}
+
+void LogListModel::append(std::vector<LogListEntry> entries)
+{
+	if (entries.empty()) {
+		return;
+	}
+	if (entries.size() > capacity_) {
+		// Only the newest capacity_ lines of an oversized batch could survive it anyway.
+		const std::size_t skipped = entries.size() - capacity_;
+		entries.erase(entries.begin(), entries.begin() + static_cast<std::ptrdiff_t>(skipped));
+		nextSequence_ += skipped;
+	}
+
+	// Remove the rows of the lines this batch overwrites before their slots are reused.
+	const std::uint64_t end = nextSequence_ + entries.size();
+	const std::uint64_t newFirst = end > capacity_ ? std::max(firstSequence_, end - capacity_) : firstSequence_;
+	std::size_t evictedRows = 0;
+	while (evictedRows < visible_.size() && visible_[evictedRows] < newFirst) {
+		evictedRows++;
+	}
+	if (evictedRows > 0) {
+		beginRemoveRows(QModelIndex(), 0, static_cast<int>(evictedRows) - 1);
+		visible_.erase(visible_.begin(), visible_.begin() + static_cast<std::ptrdiff_t>(evictedRows));
+		endRemoveRows();
+	}
+	firstSequence_ = newFirst;
+
+	std::vector<std::uint64_t> added;
+	for (LogListEntry &entry : entries) {
+		const std::uint64_t sequence = nextSequence_++;
+		if (accepts(entry)) {
+			added.push_back(sequence);
+		}
+		ring_[sequence % capacity_] = std::move(entry);
+	}
+	if (added.empty()) {
+		return;
+	}
+
+	const int first = static_cast<int>(visible_.size());
+	beginInsertRows(QModelIndex(), first, first + static_cast<int>(added.size()) - 1);
+	visible_.insert(visible_.end(), added.begin(), added.end());
+	endInsertRows();
+}
+
+void LogListModel::setMinLevel(int level)
+{
+	if (minLevel_ != level) {
+		minLevel_ = level;
+		rebuildVisible();
+	}
+}
+
+void LogListModel::setSearchText(const QString &text)
+{
+	if (searchText_ != text) {
+		searchText_ = text;
+		rebuildVisible();
+	}
+}
+
+bool LogListModel::accepts(const LogListEntry &entry) const
+{
+	return entry.level >= minLevel_ &&
+	       (searchText_.isEmpty() || entry.text.contains(searchText_, Qt::CaseInsensitive));
+}
+
+void LogListModel::rebuildVisible()
+{
+	beginResetModel();
+	visible_.clear();
+	for (std::uint64_t sequence = firstSequence_; sequence < nextSequence_; ++sequence) {
+		if (accepts(entryAt(sequence))) {
+			visible_.push_back(sequence);
+		}
+	}
+	endResetModel();
+}
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::UI
@@ -0,0 +1,101 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - UI Module
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include <QAbstractListModel>
+#include <QColor>
+#include <QString>
+
+namespace KaitoTokyo {
+namespace LiveStreamSegmenter {
+namespace UI {
+
+/**
+ * @brief One line of the dock's operation log.
+ */
+struct LogListEntry {
+	QString timestamp;
+	// Logger::LogLevel as int.
+	int level;
+	QString text;
+	QColor color;
+};
+
+/**
+ * @class LogListModel
+ * @brief Keeps the newest lines of the operation log in a fixed-capacity ring for a QListView.
+ *
+ * Lines are appended in batches; once the ring is full each batch evicts as many old lines as it adds,
+ * so memory and per-batch cost stay the same however long the session runs. Lines below the minimum
+ * level or not containing the search text are kept but not shown.
+ */
+class LogListModel final : public QAbstractListModel {
+	Q_OBJECT
+
+public:
+	static constexpr std::size_t kDefaultCapacity = 5000;
+
+	enum Role { LevelRole = Qt::UserRole + 1 };
+
+	explicit LogListModel(std::size_t capacity = kDefaultCapacity, QObject *parent = nullptr);
+	~LogListModel() override = default;
+
+	LogListModel(const LogListModel &) = delete;
+	LogListModel &operator=(const LogListModel &) = delete;
+	LogListModel(LogListModel &&) = delete;
+	LogListModel &operator=(LogListModel &&) = delete;
+
+	int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+	QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+	/**
+	 * @brief Appends lines, evicting the oldest ones beyond the capacity.
+	 */
+	void append(std::vector<LogListEntry> entries);
+
+	void setMinLevel(int level);
+	void setSearchText(const QString &text);
+
+private:
+	bool accepts(const LogListEntry &entry) const;
+	const LogListEntry &entryAt(std::uint64_t sequence) const { return ring_[sequence % capacity_]; }
+	void rebuildVisible();
+
+	const std::size_t capacity_;
+	std::vector<LogListEntry> ring_;
+	// Sequence numbers of the oldest retained line and of the next line to be appended.
+	std::uint64_t firstSequence_ = 0;
+	std::uint64_t nextSequence_ = 0;
+	// Sequence numbers of the lines shown, oldest first.
+	std::deque<std::uint64_t> visible_;
+
+	int minLevel_ = 0;
+	QString searchText_;
+};
+
+} // namespace UI
+} // namespace LiveStreamSegmenter
+} // namespace KaitoTokyo
@@ -0,0 +1,115 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - UI Module
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "MetricsHttpServer.hpp"
+
+#include <stdexcept>
+#include <string>
+
+#include <QHostAddress>
+#include <QTcpServer>
+#include <QTcpSocket>
+
+namespace KaitoTokyo::LiveStreamSegmenter::UI {
+
+MetricsHttpServer::MetricsHttpServer(const Metrics::MetricsRegistry &registry, QObject *parent)
+	: QObject(parent),
+	  registry_(registry),
+	  server_(new QTcpServer(this))
+{
+}
+
+MetricsHttpServer::~MetricsHttpServer() noexcept
+{
+	if (server_) {
+		try {
+			server_->close();
+		} catch (...) {
+			// ignore
+		}
+	}
+}
+
+void MetricsHttpServer::listen(quint16 port)
+{
+	connect(server_, &QTcpServer::newConnection, this, [this]() {
+		while (QTcpSocket *socket = server_->nextPendingConnection()) {
+			connect(socket, &QTcpSocket::readyRead, this, [this, socket]() { handleReadyRead(socket); });
+			connect(socket, &QTcpSocket::disconnected, this, [this, socket]() {
+				requests_.remove(socket);
+				socket->deleteLater();
+			});
+		}
+	});
+
+	// Bound to loopback only; the endpoint has no authentication.
+	if (!server_->listen(QHostAddress::LocalHost, port)) {
+		throw std::runtime_error("ListenError(MetricsHttpServer::listen)");
+	}
+}
+
+quint16 MetricsHttpServer::getPort() const
+{
+	return server_->serverPort();
+}
+
+void MetricsHttpServer::handleReadyRead(QTcpSocket *socket)
+{
+	QByteArray &request = requests_[socket];
+	request += socket->readAll();
+
+	if (request.size() > kMaxRequestBytes) {
+		sendResponse(socket, "431 Request Header Fields Too Large", "text/plain; charset=utf-8", {});
+		return;
+	}
+	const qsizetype headerEnd = request.indexOf("\r\n\r\n");
+	if (headerEnd < 0) {
+		return;
+	}
+
+	const QList<QByteArray> requestLine = request.left(request.indexOf("\r\n")).split(' ');
+	if (requestLine.size() != 3 || requestLine[0] != "GET") {
+		sendResponse(socket, "405 Method Not Allowed", "text/plain; charset=utf-8", "Method Not Allowed\n");
+	} else if (requestLine[1] != "/metrics") {
+		sendResponse(socket, "404 Not Found", "text/plain; charset=utf-8", "Not Found\n");
+	} else {
+		const std::string body = registry_.render();
+		sendResponse(socket, "200 OK", "text/plain; version=0.0.4; charset=utf-8",
+			     QByteArray(body.data(), static_cast<qsizetype>(body.size())));
+	}
+}
+
+void MetricsHttpServer::sendResponse(QTcpSocket *socket, const QByteArray &status, const QByteArray &contentType,
+				     const QByteArray &body)
+{
+	requests_.remove(socket);
+
+	QByteArray response = "HTTP/1.1 " + status + "\r\n";
+	response += "Content-Type: " + contentType + "\r\n";
+	response += "Content-Length: " + QByteArray::number(body.size()) + "\r\n";
+	response += "Connection: close\r\n\r\n";
+	response += body;
+
+	socket->write(response);
+	socket->flush();
+	socket->disconnectFromHost();
+}
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::UI
@@ -0,0 +1,67 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - UI Module
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <QByteArray>
+#include <QHash>
+#include <QObject>
+
+#include <KaitoTokyo/Metrics/MetricsRegistry.hpp>
+
+class QTcpServer;
+class QTcpSocket;
+
+namespace KaitoTokyo::LiveStreamSegmenter::UI {
+
+/**
+ * Serves a MetricsRegistry at GET /metrics on localhost for Prometheus to scrape.
+ * Lives on the UI thread like GoogleOAuth2FlowCallbackServer; rendering only takes the registry lock.
+ */
+class MetricsHttpServer : public QObject {
+	Q_OBJECT
+
+public:
+	MetricsHttpServer(const Metrics::MetricsRegistry &registry, QObject *parent);
+
+	~MetricsHttpServer() noexcept override;
+
+	/**
+	 * @throws std::runtime_error If the port cannot be bound.
+	 */
+	void listen(quint16 port);
+
+	quint16 getPort() const;
+
+private:
+	// Requests larger than this are answered with 431 and the connection is closed.
+	static constexpr qsizetype kMaxRequestBytes = 8192;
+
+	const Metrics::MetricsRegistry &registry_;
+	QTcpServer *const server_;
+	QHash<QTcpSocket *, QByteArray> requests_;
+
+	void handleReadyRead(QTcpSocket *socket);
+
+	void sendResponse(QTcpSocket *socket, const QByteArray &status, const QByteArray &contentType,
+			  const QByteArray &body);
+};
+
+} // namespace KaitoTokyo::LiveStreamSegmenter::UI
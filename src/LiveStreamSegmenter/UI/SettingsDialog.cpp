@@ -20,14 +20,20 @@
 
 #include "SettingsDialog.hpp"
 
+#include <algorithm>
+#include <map>
+#include <optional>
+
 #include <QAbstractItemView>
 #include <QComboBox>
+#include <QCoreApplication>
 #include <QDesktopServices>
 #include <QDialogButtonBox>
 #include <QFile>
 #include <QFontDatabase>
 #include <QFormLayout>
 #include <QGroupBox>
+#include <QHBoxLayout>
 #include <QHeaderView>
 #include <QHeaderView>
 #include <QInputDialog>
@@ -54,25 +60,29 @@
 #include <QVBoxLayout>
 #include <QWidget>
 
-#include <KaitoTokyo/CurlHelper/CurlHandle.hpp>
-#include <KaitoTokyo/GoogleAuth/GoogleAuthManager.hpp>
+#include <KaitoTokyo/CurlHelper/CurlConnectionPool.hpp>
 #include <KaitoTokyo/GoogleAuth/GoogleOAuth2ClientCredentials.hpp>
 #include <KaitoTokyo/GoogleAuth/GoogleTokenState.hpp>
-#include <KaitoTokyo/YouTubeApi/YouTubeApiClient.hpp>
+#include <KaitoTokyo/YouTubeApi/YouTubeTypes.hpp>
 
 #include <EventScriptingContext.hpp>
+#include <ScriptingLocalStorage.hpp>
 
 #include "fmt_qstring_formatter.hpp"
 
 namespace KaitoTokyo::LiveStreamSegmenter::UI {
 
 SettingsDialog::SettingsDialog(std::shared_ptr<Scripting::ScriptingRuntime> runtime,
+			       std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool,
 			       std::shared_ptr<Store::AuthStore> authStore,
 			       std::shared_ptr<Store::EventHandlerStore> eventHandlerStore,
 			       std::shared_ptr<Store::YouTubeStore> youTubeStore,
+			       std::shared_ptr<Store::LiveStreamCache> liveStreamCache,
 			       std::shared_ptr<const Logger::ILogger> logger, QWidget *parent)
 	: QDialog(parent),
 	  runtime_(runtime ? std::move(runtime) : throw std::invalid_argument("RuntimeIsNullError(SettingsDialog)")),
+	  curlPool_(curlPool ? std::move(curlPool)
+			     : throw std::invalid_argument("CurlPoolIsNullError(SettingsDialog)")),
 	  authStore_(authStore ? std::move(authStore)
 			       : throw std::invalid_argument("AuthStoreIsNullError(SettingsDialog)")),
 	  eventHandlerStore_(eventHandlerStore
@@ -80,11 +90,11 @@ SettingsDialog::SettingsDialog(std::shared_ptr<Scripting::ScriptingRuntime> runt
 				     : throw std::invalid_argument("EventHandlerStoreIsNullError(SettingsDialog)")),
 	  youTubeStore_(youTubeStore ? std::move(youTubeStore)
 				     : throw std::invalid_argument("YouTubeStoreIsNullError(SettingsDialog)")),
+	  liveStreamCache_(liveStreamCache
+				   ? std::move(liveStreamCache)
+				   : throw std::invalid_argument("LiveStreamCacheIsNullError(SettingsDialog)")),
 	  logger_(logger ? std::move(logger) : throw std::invalid_argument("LoggerIsNullError(SettingsDialog)")),
 
-	  curl_(std::make_shared<CurlHelper::CurlHandle>()),
-	  youTubeApiClient_(std::make_shared<YouTubeApi::YouTubeApiClient>(curl_)),
-
 	  // 1. Main Structure
 	  mainLayout_(new QVBoxLayout(this)),
 	  tabWidget_(new QTabWidget(this)),
@@ -115,10 +125,9 @@ SettingsDialog::SettingsDialog(std::shared_ptr<Scripting::ScriptingRuntime> runt
 	  // 6. Stream Settings Group
 	  keyGroup_(new QGroupBox(this)),
 	  keyLayout_(new QVBoxLayout(keyGroup_)),
-	  streamKeyLabelA_(new QLabel(this)),
-	  streamKeyComboA_(new QComboBox(this)),
-	  streamKeyLabelB_(new QLabel(this)),
-	  streamKeyComboB_(new QComboBox(this)),
+	  streamKeyFormLayout_(new QFormLayout()),
+	  addStreamKeyButton_(new QPushButton(this)),
+	  removeStreamKeyButton_(new QPushButton(this)),
 
 	  // 7. Script Tab
 	  scriptTab_(new QWidget(this)),
@@ -144,8 +153,6 @@ SettingsDialog::SettingsDialog(std::shared_ptr<Scripting::ScriptingRuntime> runt
 					  this)),
 	  applyButton_(buttonBox_->button(QDialogButtonBox::Apply))
 {
-	youTubeApiClient_->setLogger(logger_);
-
 	setupUi();
 
 	connect(dropArea_, &JsonDropArea::jsonFileDropped, this, &SettingsDialog::onCredentialsFileDropped);
@@ -156,6 +163,9 @@ SettingsDialog::SettingsDialog(std::shared_ptr<Scripting::ScriptingRuntime> runt
 	connect(authButton_, &QPushButton::clicked, this, &SettingsDialog::onAuthButtonClicked);
 	connect(clearAuthButton_, &QPushButton::clicked, this, &SettingsDialog::onClearAuthButtonClicked);
 
+	connect(addStreamKeyButton_, &QPushButton::clicked, this, &SettingsDialog::onAddStreamKeyClicked);
+	connect(removeStreamKeyButton_, &QPushButton::clicked, this, &SettingsDialog::onRemoveStreamKeyClicked);
+
 	connect(runScriptButton_, &QPushButton::clicked, this, &SettingsDialog::onRunScriptClicked);
 
 	connect(addLocalStorageButton_, &QPushButton::clicked, this, &SettingsDialog::onAddLocalStorageItem);
@@ -206,6 +216,7 @@ void SettingsDialog::onAuthButtonClicked()
 void SettingsDialog::onClearAuthButtonClicked()
 {
 	authStore_->setGoogleTokenState({});
+	liveStreamCache_->clear();
 	statusLabel_->setText(tr("Cleared to be Unauthorized"));
 	logger_->info("TokenCleared");
 }
@@ -245,20 +256,24 @@ void SettingsDialog::onRunScriptClicked()
 try {
 	const std::shared_ptr<const Logger::ILogger> logger = logger_;
 
-	std::shared_ptr<JSContext> ctx = runtime_->createContextRaw();
-	Scripting::EventScriptingContext context(runtime_, ctx, logger);
-	Scripting::ScriptingDatabase database(runtime_, ctx, logger, eventHandlerStore_->getEventHandlerDatabasePath(),
-					      true);
-	context.setupContext();
-	database.setupContext();
-	context.setupLocalStorage();
-
 	const std::string scriptContent = scriptEditor_->toPlainText().toStdString();
-	context.loadEventHandler(scriptContent.c_str());
-
 	QString selectedFunction = scriptFunctionCombo_->currentText();
 	std::string functionName = selectedFunction.toStdString();
-	std::string result = context.executeFunction(functionName.c_str(), R"({})");
+	const std::filesystem::path databasePath = eventHandlerStore_->getEventHandlerDatabasePath();
+
+	// Sessions may be using the runtime right now, so the script runs on its executor.
+	std::string result = Scripting::ScriptingExecutor::runBlocking(runtime_->getExecutor(), [&]() {
+		std::shared_ptr<JSContext> ctx = runtime_->createContextRaw();
+		Scripting::EventScriptingContext context(runtime_, ctx, logger);
+		Scripting::ScriptingDatabase database(runtime_, ctx, logger, databasePath, true);
+		context.setupContext();
+		database.setupContext();
+		context.setupLocalStorage(database);
+
+		context.loadEventHandler(scriptContent.c_str());
+
+		return context.executeFunction(functionName.c_str(), R"({})");
+	});
 
 	QMessageBox::information(this, tr("Script Result"), QString::fromStdString(result));
 
@@ -371,24 +386,27 @@ void SettingsDialog::setupUi()
 	// --- 3. Stream Settings Group ---
 	keyGroup_->setTitle(tr("3. Stream Settings"));
 
-	QFormLayout *streamKeyFormLayout = new QFormLayout();
-	streamKeyFormLayout->setFieldGrowthPolicy(QFormLayout::AllNonFixedFieldsGrow);
+	streamKeyFormLayout_->setFieldGrowthPolicy(QFormLayout::AllNonFixedFieldsGrow);
+
+	// Keys A, B, ... take turns in this order; a saved rotation may be longer than the minimum.
+	const std::size_t streamKeyCount =
+		std::clamp(youTubeStore_->getSnapshot()->liveStreamIds.size(), Store::YouTubeStore::kMinLiveStreams,
+			   Store::YouTubeStore::kMaxLiveStreams);
+	for (std::size_t i = 0; i < streamKeyCount; ++i) {
+		addStreamKeyRow();
+	}
 
-	// Key A
-	streamKeyLabelA_->setText(tr("Stream Key A"));
-	streamKeyComboA_->setPlaceholderText(tr("-"));
-	streamKeyComboA_->setEnabled(false);
-	streamKeyComboA_->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Fixed);
-	streamKeyFormLayout->addRow(streamKeyLabelA_, streamKeyComboA_);
+	keyLayout_->addLayout(streamKeyFormLayout_);
 
-	// Key B
-	streamKeyLabelB_->setText(tr("Stream Key B"));
-	streamKeyComboB_->setPlaceholderText(tr("-"));
-	streamKeyComboB_->setEnabled(false);
-	streamKeyComboB_->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Fixed);
-	streamKeyFormLayout->addRow(streamKeyLabelB_, streamKeyComboB_);
+	QHBoxLayout *streamKeyButtonsLayout = new QHBoxLayout();
+	addStreamKeyButton_->setText(tr("Add Stream Key"));
+	removeStreamKeyButton_->setText(tr("Remove Stream Key"));
+	streamKeyButtonsLayout->addWidget(addStreamKeyButton_);
+	streamKeyButtonsLayout->addWidget(removeStreamKeyButton_);
+	streamKeyButtonsLayout->addStretch();
+	keyLayout_->addLayout(streamKeyButtonsLayout);
+	updateStreamKeyButtons();
 
-	keyLayout_->addLayout(streamKeyFormLayout);
 	youTubeTabLayout_->addWidget(keyGroup_);
 
 	youTubeTabLayout_->addStretch();
@@ -488,19 +506,17 @@ void SettingsDialog::saveSettings()
 	eventHandlerStore_->save();
 
 	// Save YouTubeStore
-	int streamKeyAIndex = streamKeyComboA_->currentIndex();
-	if (streamKeyAIndex >= 0) {
-		youTubeStore_->setLiveStreamId(0, streamKeys_[streamKeyAIndex].id);
-	} else {
-		youTubeStore_->setLiveStreamId(0, {});
-	}
-
-	int streamKeyBIndex = streamKeyComboB_->currentIndex();
-	if (streamKeyBIndex >= 0) {
-		youTubeStore_->setLiveStreamId(1, streamKeys_[streamKeyBIndex].id);
-	} else {
-		youTubeStore_->setLiveStreamId(1, {});
+	std::vector<std::string> liveStreamIds;
+	for (std::size_t i = 0; i < streamKeyCombos_.size(); ++i) {
+		const int streamKeyIndex = streamKeyCombos_[i]->currentIndex();
+		if (streamKeyIndex >= 0) {
+			liveStreamIds.push_back(streamKeyCombos_[i]->itemData(streamKeyIndex).toString().toStdString());
+		} else {
+			// Keys not fetched in this dialog keep what was saved before.
+			liveStreamIds.push_back(youTubeStore_->getLiveStreamId(i));
+		}
 	}
+	youTubeStore_->setLiveStreamIds(std::move(liveStreamIds));
 
 	youTubeStore_->save();
 
@@ -563,10 +579,8 @@ void SettingsDialog::startGoogleOAuth2Flow()
 	clientCredentials.client_id = clientIdDisplay_->text().toStdString();
 	clientCredentials.client_secret = clientSecretDisplay_->text().toStdString();
 
-	auto curl = std::make_shared<CurlHelper::CurlHandle>();
-
 	auto googleOAuth2Flow = std::make_shared<GoogleAuth::GoogleOAuth2Flow>(
-		curl, clientCredentials, "https://www.googleapis.com/auth/youtube.force-ssl", logger_);
+		curlPool_, clientCredentials, "https://www.googleapis.com/auth/youtube.force-ssl", logger_);
 
 	auto callbackServer = new GoogleOAuth2FlowCallbackServer(this);
 	callbackServer->listen();
@@ -617,81 +631,142 @@ void SettingsDialog::onCodeReceived(const QString &code, const QUrl &redirectUri
 	statusLabel_->setText(tr("Authorized (Not Saved)"));
 	markDirty();
 
+	// The new token may belong to another channel.
+	liveStreamCache_->clear();
 	fetchStreamKeys();
 }
 
 void SettingsDialog::fetchStreamKeys()
 {
-	try {
-		auto curl = std::make_shared<CurlHelper::CurlHandle>();
-		GoogleAuth::GoogleOAuth2ClientCredentials clientCredentials =
-			authStore_->getGoogleOAuth2ClientCredentials();
-		const auto authManager =
-			std::make_shared<GoogleAuth::GoogleAuthManager>(curl, clientCredentials, logger_);
-		GoogleAuth::GoogleTokenState tokenState = authStore_->getGoogleTokenState();
-
-		std::string accessToken;
-		if (tokenState.isAuthorized()) {
-			if (tokenState.isAccessTokenFresh()) {
-				logger_->info("YouTubeAccessTokenFresh");
-				accessToken = tokenState.access_token;
-			} else {
-				logger_->info("YouTubeAccessTokenNotFresh");
-				GoogleAuth::GoogleAuthResponse freshAuthResponse =
-					authManager->fetchFreshAuthResponse(tokenState.refresh_token);
-				tokenState.loadAuthResponse(freshAuthResponse);
-				authStore_->setGoogleTokenState(tokenState);
-				accessToken = freshAuthResponse.access_token;
-				logger_->info("YouTubeAccessTokenFetched");
-			}
-		}
-
-		std::vector<YouTubeApi::YouTubeLiveStream> streamKeys = youTubeApiClient_->listLiveStreams(accessToken);
+	connect(scriptEditor_, &QPlainTextEdit::textChanged, this, &SettingsDialog::markDirty, Qt::UniqueConnection);
+
+	showStreamKeys(liveStreamCache_->getSnapshot());
+
+	// The callback runs on a network worker; the dialog may be closed by the time the list arrives.
+	QPointer<SettingsDialog> self(this);
+	liveStreamCache_->revalidate([self](std::shared_ptr<const Store::LiveStreamListSnapshot> liveStreams,
+					    std::optional<std::string> error) {
+		QMetaObject::invokeMethod(
+			QCoreApplication::instance(),
+			[self, liveStreams = std::move(liveStreams), error = std::move(error)]() {
+				if (!self) {
+					return;
+				}
+				if (error) {
+					// A failed first list leaves the combos disabled, so say why.
+					const QString message = QString::fromStdString(*error);
+					self->statusLabel_->setText(tr("Failed to list stream keys: %1").arg(message));
+				}
+				self->showStreamKeys(liveStreams);
+			},
+			Qt::QueuedConnection);
+	});
+}
 
-		streamKeyComboA_->clear();
-		streamKeyComboB_->clear();
+void SettingsDialog::showStreamKeys(std::shared_ptr<const Store::LiveStreamListSnapshot> liveStreams)
+{
+	if (!liveStreams->listedAt) {
+		// Nothing has been listed yet; the combos stay disabled until the first list arrives.
+		return;
+	}
+	if (streamKeys_ && streamKeys_->version == liveStreams->version) {
+		return;
+	}
+	streamKeys_ = std::move(liveStreams);
 
-		streamKeys_ = std::move(streamKeys);
+	for (const YouTubeApi::YouTubeLiveStream &key : streamKeys_->liveStreams) {
+		logger_->info("StreamKeyListed", {{"id", key.id},
+						  {"title", key.snippet.title},
+						  {"resolution", key.cdn.resolution},
+						  {"frameRate", key.cdn.frameRate}});
+	}
 
-		std::string currentStreamKeyAId = youTubeStore_->getLiveStreamId(0);
-		std::string currentStreamKeyBId = youTubeStore_->getLiveStreamId(1);
+	for (std::size_t i = 0; i < streamKeyCombos_.size(); ++i) {
+		const std::string currentLiveStreamId = youTubeStore_->getLiveStreamId(i);
+		logger_->info("CurrentStreamKey",
+			      {{"liveStreamIndex", std::to_string(i)}, {"id", currentLiveStreamId}});
+		fillStreamKeyCombo(streamKeyCombos_[i], currentLiveStreamId);
+	}
+}
 
-		logger_->info("CurrentStreamKeys",
-			      {{"streamKeyA_id", currentStreamKeyAId}, {"streamKeyB_id", currentStreamKeyBId}});
-		for (int i = 0; i < static_cast<int>(streamKeys_.size()); ++i) {
-			const YouTubeApi::YouTubeLiveStream &key = streamKeys_[i];
+void SettingsDialog::addStreamKeyRow()
+{
+	const std::size_t index = streamKeyCombos_.size();
 
-			QString displayText = QString::fromStdString(
-				fmt::format("{} ({} - {})", key.snippet.title, key.cdn.resolution, key.cdn.frameRate));
-			streamKeyComboA_->addItem(displayText, QString::fromStdString(key.id));
-			streamKeyComboB_->addItem(displayText, QString::fromStdString(key.id));
+	QComboBox *combo = new QComboBox(this);
+	combo->setPlaceholderText(tr("-"));
+	combo->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Fixed);
+	if (!streamKeys_) {
+		combo->setEnabled(false);
+	} else {
+		fillStreamKeyCombo(combo, youTubeStore_->getLiveStreamId(index));
+	}
 
-			logger_->info("StreamKeyListed", {{"id", key.id},
-							  {"title", key.snippet.title},
-							  {"resolution", key.cdn.resolution},
-							  {"frameRate", key.cdn.frameRate}});
-			if (key.id == currentStreamKeyAId) {
-				streamKeyComboA_->setCurrentIndex(i);
-			}
+	// Labelled A, B, C and so on; kMaxLiveStreams keeps this within the alphabet.
+	const QString label = tr("Stream Key %1").arg(QChar(u'A' + static_cast<char16_t>(index)));
+	streamKeyFormLayout_->addRow(label, combo);
+	streamKeyCombos_.push_back(combo);
+}
 
-			if (key.id == currentStreamKeyBId) {
-				streamKeyComboB_->setCurrentIndex(i);
+void SettingsDialog::fillStreamKeyCombo(QComboBox *combo, const std::string &selectedLiveStreamId)
+{
+	// Filling the combo must not mark the settings dirty; only the user's choice does.
+	disconnect(combo, &QComboBox::currentTextChanged, this, &SettingsDialog::markDirty);
+
+	// A choice made in this dialog wins over the saved one.
+	const QString selected = combo->currentIndex() >= 0 ? combo->currentData().toString()
+							     : QString::fromStdString(selectedLiveStreamId);
+
+	const std::vector<YouTubeApi::YouTubeLiveStream> &keys = streamKeys_->liveStreams;
+	for (int i = 0; i < static_cast<int>(keys.size()); ++i) {
+		const YouTubeApi::YouTubeLiveStream &key = keys[i];
+
+		const QString id = QString::fromStdString(key.id);
+		const QString displayText = QString::fromStdString(
+			fmt::format("{} ({} - {})", key.snippet.title, key.cdn.resolution, key.cdn.frameRate));
+		if (i < combo->count() && combo->itemData(i).toString() == id) {
+			if (combo->itemText(i) != displayText) {
+				combo->setItemText(i, displayText);
 			}
+		} else {
+			combo->insertItem(i, displayText, id);
 		}
+	}
+	// The first keys.size() items now match the list; whatever follows has gone away.
+	while (combo->count() > static_cast<int>(keys.size())) {
+		combo->removeItem(combo->count() - 1);
+	}
+	combo->setCurrentIndex(combo->findData(selected));
 
-		streamKeyComboA_->setEnabled(true);
-		streamKeyComboB_->setEnabled(true);
+	combo->setEnabled(true);
+	connect(combo, &QComboBox::currentTextChanged, this, &SettingsDialog::markDirty, Qt::UniqueConnection);
+}
 
-		connect(streamKeyComboA_, &QComboBox::currentTextChanged, this, &SettingsDialog::markDirty,
-			Qt::UniqueConnection);
-		connect(streamKeyComboB_, &QComboBox::currentTextChanged, this, &SettingsDialog::markDirty,
-			Qt::UniqueConnection);
+void SettingsDialog::updateStreamKeyButtons()
+{
+	addStreamKeyButton_->setEnabled(streamKeyCombos_.size() < Store::YouTubeStore::kMaxLiveStreams);
+	removeStreamKeyButton_->setEnabled(streamKeyCombos_.size() > Store::YouTubeStore::kMinLiveStreams);
+}
 
-		connect(scriptEditor_, &QPlainTextEdit::textChanged, this, &SettingsDialog::markDirty,
-			Qt::UniqueConnection);
-	} catch (const std::exception &e) {
-		logger_->error("FetchStreamKeysFailed", {{"exception", e.what()}});
+void SettingsDialog::onAddStreamKeyClicked()
+{
+	if (streamKeyCombos_.size() >= Store::YouTubeStore::kMaxLiveStreams) {
+		return;
+	}
+	addStreamKeyRow();
+	updateStreamKeyButtons();
+	markDirty();
+}
+
+void SettingsDialog::onRemoveStreamKeyClicked()
+{
+	if (streamKeyCombos_.size() <= Store::YouTubeStore::kMinLiveStreams) {
+		return;
 	}
+	streamKeyFormLayout_->removeRow(static_cast<int>(streamKeyCombos_.size()) - 1);
+	streamKeyCombos_.pop_back();
+	updateStreamKeyButtons();
+	markDirty();
 }
 
 void SettingsDialog::loadLocalStorageData()
@@ -708,62 +783,19 @@ try {
 		return;
 	}
 
-	std::shared_ptr<JSContext> ctx = runtime_->createContextRaw();
-	Scripting::ScriptingDatabase database(runtime_, ctx, logger_, dbPath, false);
-	database.setupContext();
-
-	// Get the db object from global scope
-	JSValue globalObj = JS_GetGlobalObject(ctx.get());
-	JSValue dbObj = JS_GetPropertyStr(ctx.get(), globalObj, "db");
-
-	// Query the localStorage table
-	JSValue sqlStr = JS_NewString(ctx.get(), "SELECT key, value FROM __sys_local_storage");
-	JSValue args[] = {sqlStr};
-	JSValue queryResultRaw = Scripting::ScriptingDatabase::query(ctx.get(), dbObj, 1, args);
-	Scripting::ScopedJSValue queryResult(ctx.get(), queryResultRaw);
-
-	JS_FreeValue(ctx.get(), sqlStr);
-	Scripting::ScopedJSValue scopedDbObj(ctx.get(), dbObj);
-	Scripting::ScopedJSValue scopedGlobalObj(ctx.get(), globalObj);
-
-	if (JS_IsException(queryResult.get())) {
-		logger_->warn("LocalStorageQueryFailed");
-		return;
-	}
+	// Read on a plain SQLite connection, so no JS context is created on the UI thread.
+	std::map<std::string, std::string> items = Scripting::ScriptingLocalStorage::readDatabaseFile(dbPath);
 
 	// Clear existing table data
 	localStorageTable_->setRowCount(0);
 
-	// Parse the result array
-	if (JS_IsArray(queryResult.get())) {
-		JSValue lengthVal = JS_GetPropertyStr(ctx.get(), queryResult.get(), "length");
-		int32_t length = 0;
-		JS_ToInt32(ctx.get(), &length, lengthVal);
-		JS_FreeValue(ctx.get(), lengthVal);
-
-		for (int32_t i = 0; i < length; ++i) {
-			JSValue rowVal = JS_GetPropertyUint32(ctx.get(), queryResult.get(), i);
-
-			JSValue keyVal = JS_GetPropertyStr(ctx.get(), rowVal, "key");
-			JSValue valueVal = JS_GetPropertyStr(ctx.get(), rowVal, "value");
-
-			Scripting::ScopedJSString keyStr(ctx.get(), JS_ToCString(ctx.get(), keyVal));
-			Scripting::ScopedJSString valueStr(ctx.get(), JS_ToCString(ctx.get(), valueVal));
-
-			if (keyStr && valueStr) {
-				int row = localStorageTable_->rowCount();
-				localStorageTable_->insertRow(row);
-				localStorageTable_->setItem(row, 0,
-							    new QTableWidgetItem(QString::fromUtf8(keyStr.get())));
-				localStorageTable_->setItem(row, 1,
-							    new QTableWidgetItem(QString::fromUtf8(valueStr.get())));
-			}
-
-			JS_FreeValue(ctx.get(), keyVal);
-			JS_FreeValue(ctx.get(), valueVal);
-			JS_FreeValue(ctx.get(), rowVal);
-		}
+	for (const auto &[key, value] : items) {
+		int row = localStorageTable_->rowCount();
+		localStorageTable_->insertRow(row);
+		localStorageTable_->setItem(row, 0, new QTableWidgetItem(QString::fromStdString(key)));
+		localStorageTable_->setItem(row, 1, new QTableWidgetItem(QString::fromStdString(value)));
 	}
+	loadedLocalStorageItems_ = std::move(items);
 } catch (const std::exception &e) {
 	logger_->error("LoadLocalStorageError", {{"exception", e.what()}});
 
@@ -786,74 +818,34 @@ try {
 		return;
 	}
 
-	std::shared_ptr<JSContext> ctx = runtime_->createContextRaw();
-	Scripting::ScriptingDatabase database(runtime_, ctx, logger_, dbPath, true);
-	database.setupContext();
-
-	// Get the db object from global scope
-	JSValue globalObj = JS_GetGlobalObject(ctx.get());
-	JSValue dbObj = JS_GetPropertyStr(ctx.get(), globalObj, "db");
-
-	// Ensure the localStorage table exists
-	JSValue createTableSql = JS_NewString(
-		ctx.get(), "CREATE TABLE IF NOT EXISTS __sys_local_storage (key TEXT PRIMARY KEY, value TEXT)");
-	JSValue createTableArgs[] = {createTableSql};
-	JSValue createTableResultRaw = Scripting::ScriptingDatabase::execute(ctx.get(), dbObj, 1, createTableArgs);
-	Scripting::ScopedJSValue createTableResult(ctx.get(), createTableResultRaw);
-
-	JS_FreeValue(ctx.get(), createTableSql);
-
-	if (JS_IsException(createTableResult.get())) {
-		JS_FreeValue(ctx.get(), dbObj);
-		JS_FreeValue(ctx.get(), globalObj);
-		logger_->error("LocalStorageCreateTableFailed");
-		throw std::runtime_error("Failed to create localStorage table");
-	}
-
-	// Clear existing localStorage table
-	JSValue deleteSql = JS_NewString(ctx.get(), "DELETE FROM __sys_local_storage");
-	JSValue deleteArgs[] = {deleteSql};
-	JSValue deleteResultRaw = Scripting::ScriptingDatabase::execute(ctx.get(), dbObj, 1, deleteArgs);
-	Scripting::ScopedJSValue deleteResult(ctx.get(), deleteResultRaw);
-
-	JS_FreeValue(ctx.get(), deleteSql);
-
-	if (JS_IsException(deleteResult.get())) {
-		JS_FreeValue(ctx.get(), dbObj);
-		JS_FreeValue(ctx.get(), globalObj);
-		logger_->error("LocalStorageDeleteFailed");
-		throw std::runtime_error("Failed to clear localStorage table");
-	}
-
-	// Insert all items from the table
+	std::map<std::string, std::string> items;
 	for (int row = 0; row < localStorageTable_->rowCount(); ++row) {
 		QTableWidgetItem *keyItem = localStorageTable_->item(row, 0);
 		QTableWidgetItem *valueItem = localStorageTable_->item(row, 1);
 
 		if (keyItem && valueItem) {
-			std::string key = keyItem->text().toStdString();
-			std::string value = valueItem->text().toStdString();
-
-			JSValue insertArgs[] = {
-				JS_NewString(ctx.get(), "INSERT INTO __sys_local_storage (key, value) VALUES (?, ?)"),
-				JS_NewString(ctx.get(), key.c_str()), JS_NewString(ctx.get(), value.c_str())};
-
-			JSValue insertResultRaw =
-				Scripting::ScriptingDatabase::execute(ctx.get(), dbObj, 3, insertArgs);
-			Scripting::ScopedJSValue insertResult(ctx.get(), insertResultRaw);
-
-			JS_FreeValue(ctx.get(), insertArgs[0]);
-			JS_FreeValue(ctx.get(), insertArgs[1]);
-			JS_FreeValue(ctx.get(), insertArgs[2]);
+			items.insert_or_assign(keyItem->text().toStdString(), valueItem->text().toStdString());
+		}
+	}
 
-			if (JS_IsException(insertResult.get())) {
-				logger_->error("LocalStorageInsertFailed", {{"key", key}});
-			}
+	// Only what the user changed is written, so values scripts stored since loading are kept for other keys.
+	std::map<std::string, std::optional<std::string>> changes;
+	for (const auto &[key, value] : loadedLocalStorageItems_) {
+		if (!items.contains(key)) {
+			changes.emplace(key, std::nullopt);
+		}
+	}
+	for (const auto &[key, value] : items) {
+		const auto it = loadedLocalStorageItems_.find(key);
+		if (it == loadedLocalStorageItems_.end() || it->second != value) {
+			changes.emplace(key, value);
 		}
 	}
 
-	JS_FreeValue(ctx.get(), dbObj);
-	JS_FreeValue(ctx.get(), globalObj);
+	if (!changes.empty()) {
+		Scripting::ScriptingLocalStorage::writeDatabaseFile(dbPath, changes);
+	}
+	loadedLocalStorageItems_ = std::move(items);
 
 	logger_->info("LocalStorageSaved");
 } catch (const std::exception &e) {
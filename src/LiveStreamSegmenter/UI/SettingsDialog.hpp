@@ -20,18 +20,21 @@
 
 #pragma once
 
+#include <map>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <QDialog>
 #include <QPointer>
 
 #include <KaitoTokyo/GoogleAuth/GoogleOAuth2Flow.hpp>
 #include <KaitoTokyo/Logger/ILogger.hpp>
-#include <KaitoTokyo/YouTubeApi/YouTubeApiClient.hpp>
 #include <KaitoTokyo/YouTubeApi/YouTubeTypes.hpp>
 
 #include <AuthStore.hpp>
 #include <EventHandlerStore.hpp>
+#include <LiveStreamCache.hpp>
 #include <ScriptingRuntime.hpp>
 #include <YouTubeStore.hpp>
 
@@ -41,6 +44,7 @@
 class QAbstractItemView;
 class QComboBox;
 class QDialogButtonBox;
+class QFormLayout;
 class QGroupBox;
 class QHeaderView;
 class QLabel;
@@ -65,13 +69,16 @@ class SettingsDialog : public QDialog {
 
 public:
 	SettingsDialog(std::shared_ptr<Scripting::ScriptingRuntime> runtime,
+		       std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool,
 		       std::shared_ptr<Store::AuthStore> authStore,
 		       std::shared_ptr<Store::EventHandlerStore> eventHandlerStore,
-		       std::shared_ptr<Store::YouTubeStore> youTubeStore, std::shared_ptr<const Logger::ILogger> logger,
-		       QWidget *parent = nullptr);
+		       std::shared_ptr<Store::YouTubeStore> youTubeStore,
+		       std::shared_ptr<Store::LiveStreamCache> liveStreamCache,
+		       std::shared_ptr<const Logger::ILogger> logger, QWidget *parent = nullptr);
 
 	~SettingsDialog() override;
 
+	// Shows the cached stream keys at once and revalidates them in the background; never blocks.
 	void fetchStreamKeys();
 
 	void loadLocalStorageData();
@@ -87,6 +94,8 @@ private slots:
 	void onClearAuthButtonClicked();
 	void onApply();
 	void onRunScriptClicked();
+	void onAddStreamKeyClicked();
+	void onRemoveStreamKeyClicked();
 	void onAddLocalStorageItem();
 	void onEditLocalStorageItem();
 	void onDeleteLocalStorageItem();
@@ -96,6 +105,14 @@ private slots:
 private:
 	void setupUi();
 
+	// Appends a row for the next live stream of the rotation, listing the fetched stream keys.
+	void addStreamKeyRow();
+	// Called on the UI thread; redraws the combos only if the snapshot differs from the one shown.
+	void showStreamKeys(std::shared_ptr<const Store::LiveStreamListSnapshot> liveStreams);
+	// Updates the items in place, so an unchanged list leaves the combo and its selection alone.
+	void fillStreamKeyCombo(QComboBox *combo, const std::string &selectedLiveStreamId);
+	void updateStreamKeyButtons();
+
 	void saveSettings();
 	void restoreSettings();
 
@@ -106,14 +123,13 @@ private:
 	void runAuthFlow();
 
 	const std::shared_ptr<Scripting::ScriptingRuntime> runtime_;
+	const std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool_;
 	const std::shared_ptr<Store::AuthStore> authStore_;
 	const std::shared_ptr<Store::EventHandlerStore> eventHandlerStore_;
 	const std::shared_ptr<Store::YouTubeStore> youTubeStore_;
+	const std::shared_ptr<Store::LiveStreamCache> liveStreamCache_;
 	const std::shared_ptr<const Logger::ILogger> logger_;
 
-	const std::shared_ptr<CurlHelper::CurlHandle> curl_;
-	const std::shared_ptr<YouTubeApi::YouTubeApiClient> youTubeApiClient_;
-
 	// --- UI Components ---
 
 	// 1. Main Structure
@@ -146,10 +162,11 @@ private:
 	// 6. Stream Settings Group (YouTube)
 	QGroupBox *keyGroup_;
 	QVBoxLayout *keyLayout_;
-	QLabel *streamKeyLabelA_;
-	QComboBox *streamKeyComboA_;
-	QLabel *streamKeyLabelB_;
-	QComboBox *streamKeyComboB_;
+	QFormLayout *streamKeyFormLayout_;
+	// One per live stream of the rotation, in the order they take turns.
+	std::vector<QComboBox *> streamKeyCombos_;
+	QPushButton *addStreamKeyButton_;
+	QPushButton *removeStreamKeyButton_;
 
 	// 7. Script Tab
 	QWidget *scriptTab_;
@@ -174,7 +191,11 @@ private:
 	QDialogButtonBox *buttonBox_;
 	QPushButton *applyButton_;
 
-	std::vector<YouTubeApi::YouTubeLiveStream> streamKeys_;
+	// The stream keys in the combos; empty until a list has been shown.
+	std::shared_ptr<const Store::LiveStreamListSnapshot> streamKeys_;
+
+	// The localStorage items as last loaded or saved; saving writes only what differs from them.
+	std::map<std::string, std::string> loadedLocalStorageItems_;
 
 	std::shared_ptr<GoogleAuth::GoogleOAuth2Flow> googleOAuth2Flow_;
 };
@@ -20,6 +20,10 @@
 
 #include "StreamSegmenterDock.hpp"
 
+#include <memory>
+#include <utility>
+
+#include <QColor>
 #include <QDesktopServices>
 #include <QFontDatabase>
 #include <QMessageBox>
@@ -29,9 +33,10 @@
 #include <QDateTime>
 #include <QGroupBox>
 #include <QHBoxLayout>
+#include <QHideEvent>
 #include <QLabel>
 #include <QPushButton>
-#include <QTextEdit>
+#include <QShowEvent>
 #include <QToolButton>
 
 #include "SettingsDialog.hpp"
@@ -42,10 +47,109 @@ using namespace KaitoTokyo::Logger;
 
 namespace KaitoTokyo::LiveStreamSegmenter::UI {
 
-StreamSegmenterDock::StreamSegmenterDock(std::shared_ptr<Scripting::ScriptingRuntime> runtime, QWidget *parent)
+StreamSegmenterDock::LoggerAdapter::~LoggerAdapter() noexcept
+{
+	Record *record = head_.exchange(nullptr, std::memory_order_acquire);
+	while (record) {
+		delete std::exchange(record, record->next);
+	}
+}
+
+void StreamSegmenterDock::LoggerAdapter::log(Logger::LogLevel level, std::string_view name, std::source_location,
+					     std::span<const Logger::LogField> bound,
+					     std::span<const Logger::LogField> context) const noexcept
+{
+	push(level, name, bound, context);
+	scheduleFlush(queued_.load(std::memory_order_relaxed));
+}
+
+void StreamSegmenterDock::LoggerAdapter::logBatch(std::span<const Logger::LogRecord> records) const noexcept
+{
+	for (const Logger::LogRecord &record : records) {
+		push(record.level, record.name, record.bound, record.context);
+	}
+	scheduleFlush(queued_.load(std::memory_order_relaxed));
+}
+
+void StreamSegmenterDock::LoggerAdapter::setVisible(bool visible) noexcept
+{
+	visible_.store(visible, std::memory_order_relaxed);
+}
+
+void StreamSegmenterDock::LoggerAdapter::drain(StreamSegmenterDock &dock) noexcept
+{
+	// Cleared first, so a record pushed during the drain schedules the next flush.
+	flushScheduled_.store(false, std::memory_order_seq_cst);
+	Record *newest = head_.exchange(nullptr, std::memory_order_acquire);
+
+	Record *oldest = nullptr;
+	std::size_t count = 0;
+	while (newest) {
+		Record *next = newest->next;
+		newest->next = oldest;
+		oldest = newest;
+		newest = next;
+		count++;
+	}
+	queued_.fetch_sub(count, std::memory_order_relaxed);
+
+	while (oldest) {
+		std::unique_ptr<Record> record(std::exchange(oldest, oldest->next));
+		try {
+			QMap<QString, QString> context;
+			for (const auto &[key, value] : record->fields) {
+				context.insert(QString::fromStdString(key), QString::fromStdString(value));
+			}
+			dock.logMessage(record->level, QString::fromStdString(record->name), context);
+		} catch (...) {
+			// A line the dock cannot show is not worth losing the rest of the batch.
+		}
+	}
+}
+
+void StreamSegmenterDock::LoggerAdapter::push(Logger::LogLevel level, std::string_view name,
+					      std::span<const Logger::LogField> bound,
+					      std::span<const Logger::LogField> context) const noexcept
+{
+	try {
+		auto record = std::make_unique<Record>();
+		record->level = static_cast<int>(level);
+		record->name = name;
+		record->fields.reserve(bound.size() + context.size());
+		for (std::span<const Logger::LogField> fields : {bound, context}) {
+			for (const Logger::LogField &field : fields) {
+				record->fields.emplace_back(field.key, field.value);
+			}
+		}
+
+		Record *node = record.release();
+		node->next = head_.load(std::memory_order_relaxed);
+		while (!head_.compare_exchange_weak(node->next, node, std::memory_order_release,
+						    std::memory_order_relaxed)) {
+		}
+		queued_.fetch_add(1, std::memory_order_relaxed);
+	} catch (...) {
+		// Out of memory: the dock misses this line.
+	}
+}
+
+void StreamSegmenterDock::LoggerAdapter::scheduleFlush(std::size_t queued) const noexcept
+{
+	if (!visible_.load(std::memory_order_relaxed) && queued < kMaxHiddenRecords) {
+		return;
+	}
+	if (flushScheduled_.exchange(true, std::memory_order_seq_cst)) {
+		return;
+	}
+
+	const QPointer<StreamSegmenterDock> dock = parent_;
+	if (dock) {
+		QMetaObject::invokeMethod(dock, [dock]() { dock->scheduleLogFlush(); }, Qt::QueuedConnection);
+	}
+}
+
+StreamSegmenterDock::StreamSegmenterDock(QWidget *parent)
 	: QWidget(parent),
-	  runtime_(runtime ? std::move(runtime)
-			   : throw std::invalid_argument("RuntimeIsNullError(StreamSegmenterDock)")),
 	  loggerAdapter_(std::make_shared<LoggerAdapter>(this)),
 	  mainLayout_(new QVBoxLayout(this)),
 
@@ -59,6 +163,9 @@ StreamSegmenterDock::StreamSegmenterDock(std::shared_ptr<Scripting::ScriptingRun
 	  statusLayout_(new QVBoxLayout(statusGroup_)),
 	  monitorLabel_(new QLabel(statusGroup_)),
 	  progressBar_(nullptr),
+	  cutoverTimingLabel_(new QLabel(statusGroup_)),
+	  eventHandlerProfileLabel_(new QLabel(statusGroup_)),
+	  liveStreamHealthLabel_(new QLabel(statusGroup_)),
 
 	  // Schedule
 	  scheduleGroup_(new QGroupBox(tr("Broadcast Schedule"), this)),
@@ -85,7 +192,12 @@ StreamSegmenterDock::StreamSegmenterDock(std::shared_ptr<Scripting::ScriptingRun
 	  // Log
 	  logGroup_(new QGroupBox(tr("Operation Log"), this)),
 	  logLayout_(new QVBoxLayout(logGroup_)),
-	  consoleView_(new QTextEdit(logGroup_)),
+	  logFilterLayout_(new QHBoxLayout()),
+	  logLevelFilter_(new QComboBox(logGroup_)),
+	  logSearchEdit_(new QLineEdit(logGroup_)),
+	  logView_(new QListView(logGroup_)),
+	  logModel_(new LogListModel(LogListModel::kDefaultCapacity, this)),
+	  logFlushTimer_(new QTimer(this)),
 
 	  // Bottom Controls
 	  bottomControlLayout_(new QVBoxLayout(this)),
@@ -110,6 +222,14 @@ StreamSegmenterDock::StreamSegmenterDock(std::shared_ptr<Scripting::ScriptingRun
 		emit segmentNowButtonClicked();
 	});
 	connect(settingsButton_, &QPushButton::clicked, this, &StreamSegmenterDock::onSettingsButtonClicked);
+
+	connect(logLevelFilter_, &QComboBox::currentIndexChanged, this,
+		[this]() { logModel_->setMinLevel(logLevelFilter_->currentData().toInt()); });
+	connect(logSearchEdit_, &QLineEdit::textChanged, logModel_, &LogListModel::setSearchText);
+
+	logFlushTimer_->setSingleShot(true);
+	logFlushTimer_->setInterval(16);
+	connect(logFlushTimer_, &QTimer::timeout, this, &StreamSegmenterDock::flushLogLines);
 }
 
 void StreamSegmenterDock::setupUi()
@@ -138,6 +258,20 @@ void StreamSegmenterDock::setupUi()
 	progressBar_->setFixedHeight(6);
 	progressBar_->setVisible(false);
 	statusLayout_->addWidget(progressBar_);
+	cutoverTimingLabel_->setFont(fixedFont);
+	cutoverTimingLabel_->setStyleSheet("color: #aaaaaa; font-size: 10px;");
+	cutoverTimingLabel_->setWordWrap(true);
+	cutoverTimingLabel_->setVisible(false);
+	statusLayout_->addWidget(cutoverTimingLabel_);
+	eventHandlerProfileLabel_->setFont(fixedFont);
+	eventHandlerProfileLabel_->setStyleSheet("color: #aaaaaa; font-size: 10px;");
+	eventHandlerProfileLabel_->setWordWrap(true);
+	eventHandlerProfileLabel_->setVisible(false);
+	statusLayout_->addWidget(eventHandlerProfileLabel_);
+	liveStreamHealthLabel_->setFont(fixedFont);
+	liveStreamHealthLabel_->setWordWrap(true);
+	liveStreamHealthLabel_->setVisible(false);
+	statusLayout_->addWidget(liveStreamHealthLabel_);
 	mainLayout_->addWidget(statusGroup_);
 
 	onMainLoopTimerTick(-1);
@@ -237,8 +371,23 @@ void StreamSegmenterDock::setupUi()
 
 	// --- 4. Log ---
 	logLayout_->setContentsMargins(0, 0, 0, 0);
-	consoleView_->setReadOnly(true);
-	consoleView_->setStyleSheet("QTextEdit {"
+
+	logLevelFilter_->addItem(tr("All"), static_cast<int>(Logger::LogLevel::Debug));
+	logLevelFilter_->addItem(tr("Info"), static_cast<int>(Logger::LogLevel::Info));
+	logLevelFilter_->addItem(tr("Warnings"), static_cast<int>(Logger::LogLevel::Warn));
+	logLevelFilter_->addItem(tr("Errors"), static_cast<int>(Logger::LogLevel::Error));
+	logSearchEdit_->setPlaceholderText(tr("Search"));
+	logSearchEdit_->setClearButtonEnabled(true);
+	logFilterLayout_->addWidget(logLevelFilter_);
+	logFilterLayout_->addWidget(logSearchEdit_, 1);
+	logLayout_->addLayout(logFilterLayout_);
+
+	// Uniform row heights let the view lay out only the visible rows.
+	logView_->setModel(logModel_);
+	logView_->setUniformItemSizes(true);
+	logView_->setWordWrap(false);
+	logView_->setSelectionMode(QAbstractItemView::ExtendedSelection);
+	logView_->setStyleSheet("QListView {"
 				    "   background-color: #1e1e1e;"
 				    "   color: #e0e0e0;"
 				    "   font-family: Consolas, 'Courier New', monospace;"
@@ -248,7 +397,7 @@ void StreamSegmenterDock::setupUi()
 				    "}");
 	logGroup_->setStyleSheet(
 		"QGroupBox { font-weight: bold; border: 1px solid #3c3c3c; margin-top: 6px; } QGroupBox::title { subcontrol-origin: margin; left: 10px; padding: 0 3px; }");
-	logLayout_->addWidget(consoleView_);
+	logLayout_->addWidget(logView_);
 	mainLayout_->addWidget(logGroup_, 1);
 
 	// --- 5. Bottom Controls ---
@@ -258,16 +407,56 @@ void StreamSegmenterDock::setupUi()
 	mainLayout_->addLayout(bottomControlLayout_);
 }
 
-void StreamSegmenterDock::logMessage([[maybe_unused]] int level, const QString &name,
-				     const QMap<QString, QString> &context)
+void StreamSegmenterDock::appendLogLine(int level, const QString &text, const QString &color)
 {
 	const QString timestamp = QDateTime::currentDateTime().toString("yyyy-MM-dd HH:mm:ss");
+	pendingLogLines_.push_back(LogListEntry{timestamp, level, text, QColor(color)});
+}
+
+void StreamSegmenterDock::showEvent(QShowEvent *event)
+{
+	QWidget::showEvent(event);
+	loggerAdapter_->setVisible(true);
+	// Catch up on what was logged while hidden.
+	scheduleLogFlush();
+
+	if (!shownOnce_) {
+		shownOnce_ = true;
+		emit firstShown();
+	}
+}
+
+void StreamSegmenterDock::hideEvent(QHideEvent *event)
+{
+	QWidget::hideEvent(event);
+	loggerAdapter_->setVisible(false);
+}
+
+void StreamSegmenterDock::scheduleLogFlush()
+{
+	if (!logFlushTimer_->isActive()) {
+		logFlushTimer_->start();
+	}
+}
+
+void StreamSegmenterDock::flushLogLines()
+{
+	loggerAdapter_->drain(*this);
+
+	// Follow the newest line only if the user has not scrolled up to read older ones.
+	QScrollBar *bar = logView_->verticalScrollBar();
+	const bool atBottom = !bar || bar->value() == bar->maximum();
+
+	logModel_->append(std::exchange(pendingLogLines_, {}));
+	if (atBottom) {
+		logView_->scrollToBottom();
+	}
+}
+
+void StreamSegmenterDock::logMessage(int level, const QString &name, const QMap<QString, QString> &context)
+{
 	auto logWithTimestamp = [&](const QString &msg, const QString &color = "#e0e0e0") {
-		consoleView_->append(QString("<span style=\"color:%1;\">[%2] %3</span>").arg(color, timestamp, msg));
-		QScrollBar *bar = consoleView_->verticalScrollBar();
-		if (bar) {
-			bar->setValue(bar->maximum());
-		}
+		appendLogLine(level, msg, color);
 	};
 
 	// --- Progress for startContinuousSessionTask ---
@@ -344,6 +533,60 @@ void StreamSegmenterDock::logMessage([[maybe_unused]] int level, const QString &
 		}
 	}
 
+	// --- Phase breakdown of the last session start or cutover ---
+	// The main loop records the timings right after the task finishes.
+	if (name == "ContinuousYouTubeSessionStarted" || name == "ContinuousYouTubeSessionSegmented") {
+		lastCutoverTimingLines_.clear();
+	} else if (name == "PhaseTimingRecorded" &&
+		   (context.value("runName") == "start" || context.value("runName") == "segment")) {
+		lastCutoverTimingLines_.append(tr("%1: %2 ms (p50 %3 / p95 %4 / max %5)")
+						       .arg(context.value("phase"),
+							    context.value("elapsedMilliseconds"),
+							    context.value("p50Milliseconds"),
+							    context.value("p95Milliseconds"),
+							    context.value("maxMilliseconds")));
+		cutoverTimingLabel_->setText(tr("Last %1:<br>%2")
+						     .arg(context.value("runName"),
+							  lastCutoverTimingLines_.join("<br>")));
+		cutoverTimingLabel_->setVisible(true);
+	}
+
+	// --- Cost of the last event handler call ---
+	if (name == "EventHandlerProfiled") {
+		const double elapsedMilliseconds = context.value("elapsedMicroseconds").toDouble() / 1000.0;
+		const double maxMilliseconds = context.value("maxMicroseconds").toDouble() / 1000.0;
+		const double heapMebibytes = context.value("mallocSize").toDouble() / (1024.0 * 1024.0);
+		QString text = tr("Last handler %1: %2 ms (max %3 ms, %4 calls), heap %5 MiB")
+				       .arg(context.value("functionName"))
+				       .arg(elapsedMilliseconds, 0, 'f', 1)
+				       .arg(maxMilliseconds, 0, 'f', 1)
+				       .arg(context.value("callCount"))
+				       .arg(heapMebibytes, 0, 'f', 1);
+		if (context.value("budgetExceeded") == "true") {
+			text += tr(" <span style='color: #F44747;'>(time budget exceeded)</span>");
+		}
+		eventHandlerProfileLabel_->setText(text);
+		eventHandlerProfileLabel_->setVisible(true);
+	}
+
+	// --- Health of the live stream that is live ---
+	// The monitor logs only changes, and checks a new live stream only a while after a cutover.
+	if (name == "YouTubeLiveStreamHealthChanged") {
+		const bool healthy = context.value("healthy") == "true";
+		QString text = tr("Ingest: %1 (%2)").arg(context.value("healthStatus"), context.value("streamStatus"));
+		if (context.value("configurationIssues") != "0") {
+			text += tr(", %1 issue(s): %2")
+					.arg(context.value("configurationIssues"), context.value("firstIssue"));
+		}
+		liveStreamHealthLabel_->setStyleSheet(healthy ? "color: #4EC9B0; font-size: 10px;"
+							      : "color: #F44747; font-size: 10px;");
+		liveStreamHealthLabel_->setText(text);
+		liveStreamHealthLabel_->setVisible(true);
+	} else if (name == "ContinuousYouTubeSessionStarting" || name == "ContinuousYouTubeSessionSegmented" ||
+		   name == "ContinuousYouTubeSessionStopped") {
+		liveStreamHealthLabel_->setVisible(false);
+	}
+
 	if (name == "YouTubeLiveBroadcastCreatedInitial" || name == "ContinuousYouTubeSessionSegmented") {
 		QString title = context.value("title");
 		QString broadcastId = context.value("broadcastId");
@@ -360,7 +603,7 @@ void StreamSegmenterDock::logMessage([[maybe_unused]] int level, const QString &
 		} else {
 			currentLinkButton_->hide();
 		}
-	} else if (name == "YouTubeLiveBroadcastCreatedNext") {
+	} else if (name == "YouTubeLiveBroadcastCreatedNext" || name == "YouTubeLiveBroadcastPromotedNext") {
 		QString title = context.value("title");
 		QString broadcastId = context.value("broadcastId");
 		nextTitleLabel_->setText(title.isEmpty() ? tr("(No title)") : title);
@@ -404,6 +647,8 @@ void StreamSegmenterDock::logMessage([[maybe_unused]] int level, const QString &
 		}
 	} else if (name == "YouTubeLiveStreamStartTimeout") {
 		logWithTimestamp(tr("Timeout: YouTube live stream did not become active in time."), "#F44747");
+	} else if (name == "ExecutionBudgetExceeded") {
+		logWithTimestamp(tr("The event handler ran past its time budget and was stopped."), "#F44747");
 	} else if (name == "YouTubeLiveBroadcastTransitioningToTesting") {
 		logWithTimestamp(tr("Transitioning YouTube live broadcast to 'testing' state..."), "#D7BA7D");
 	} else if (name == "YouTubeLiveBroadcastTransitionedToTesting") {
@@ -517,12 +762,18 @@ void StreamSegmenterDock::onMainLoopTimerTick(int segmentTimerRemainingTime)
 
 void StreamSegmenterDock::onSettingsButtonClicked()
 {
-	auto logger = [this]() {
+	auto [runtime, logger] = [this]() {
 		std::scoped_lock lock(mutex_);
-		return logger_;
+		return std::pair{runtime_, logger_};
 	}();
 
-	SettingsDialog settingsDialog(runtime_, authStore_, eventHandlerStore_, youTubeStore_, logger, this);
+	if (!runtime) {
+		// The plugin is still starting up; the stores arrive together with the runtime.
+		return;
+	}
+
+	SettingsDialog settingsDialog(runtime, curlPool_, authStore_, eventHandlerStore_, youTubeStore_,
+				      liveStreamCache_, logger, this);
 	settingsDialog.fetchStreamKeys();
 	settingsDialog.loadLocalStorageData();
 	settingsDialog.exec();
@@ -20,26 +20,37 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstddef>
 #include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include <QWidget>
 #include <QLabel>
 
-#include <KaitoTokyo/CurlHelper/CurlHandle.hpp>
+#include <KaitoTokyo/CurlHelper/CurlConnectionPool.hpp>
 #include <KaitoTokyo/Logger/ILogger.hpp>
 #include <KaitoTokyo/YouTubeApi/YouTubeApiClient.hpp>
 
 #include <AuthStore.hpp>
 #include <EventHandlerStore.hpp>
+#include <LiveStreamCache.hpp>
 #include <ScriptingRuntime.hpp>
 #include <YouTubeStore.hpp>
 
+#include "LogListModel.hpp"
+
+#include <QComboBox>
 #include <QGroupBox>
 #include <QHBoxLayout>
 #include <QLabel>
+#include <QLineEdit>
+#include <QListView>
 #include <QPointer>
 #include <QPushButton>
-#include <QTextEdit>
+#include <QTimer>
 #include <QToolButton>
 #include <QVBoxLayout>
 #include <QProgressBar>
@@ -51,39 +62,59 @@ namespace UI {
 class StreamSegmenterDock : public QWidget {
 	Q_OBJECT
 public:
+	/**
+	 * @brief Forwards log records to the dock from any thread.
+	 *
+	 * Producers copy a record into a lock-free list as UTF-8 and at most one UI flush is pending at a
+	 * time, so a burst of records costs one queued event instead of one per line. QString conversion
+	 * happens on the UI thread when the dock drains the list. While the dock is hidden no flush is
+	 * scheduled until kMaxHiddenRecords are waiting, which bounds memory.
+	 */
 	class LoggerAdapter : public Logger::ILogger {
 	public:
+		static constexpr std::size_t kMaxHiddenRecords = 4096;
+
 		explicit LoggerAdapter(QPointer<StreamSegmenterDock> parent) : parent_(parent) {}
+		~LoggerAdapter() noexcept override;
 
 		void log(Logger::LogLevel level, std::string_view name, std::source_location,
-			 std::span<const Logger::LogField> context) const noexcept override
-		{
-			const int logLevel = static_cast<int>(level);
-			const QString logName = QString::fromUtf8(name.data(), name.size());
-
-			QMap<QString, QString> contextMap;
-			for (const auto &field : context) {
-				contextMap.insert(QString::fromUtf8(field.key.data(), field.key.size()),
-						  QString::fromUtf8(field.value.data(), field.value.size()));
-			}
-
-			if (parent_) {
-				QMetaObject::invokeMethod(
-					parent_,
-					[=, this]() {
-						if (parent_)
-							parent_->logMessage(logLevel, logName, contextMap);
-					},
-					Qt::QueuedConnection);
-			}
-		}
+			 std::span<const Logger::LogField> bound,
+			 std::span<const Logger::LogField> context) const noexcept override;
+
+		void logBatch(std::span<const Logger::LogRecord> records) const noexcept override;
+
+		/**
+		 * @brief Tells whether the dock is shown. Called on the UI thread.
+		 */
+		void setVisible(bool visible) noexcept;
+
+		/**
+		 * @brief Hands every queued record to the dock, oldest first. Called on the UI thread.
+		 */
+		void drain(StreamSegmenterDock &dock) noexcept;
 
 	private:
+		struct Record {
+			Record *next = nullptr;
+			int level;
+			std::string name;
+			std::vector<std::pair<std::string, std::string>> fields;
+		};
+
+		void push(Logger::LogLevel level, std::string_view name, std::span<const Logger::LogField> bound,
+			  std::span<const Logger::LogField> context) const noexcept;
+		void scheduleFlush(std::size_t queued) const noexcept;
+
 		QPointer<StreamSegmenterDock> parent_;
+		// Newest first; the UI thread takes the whole list at once.
+		mutable std::atomic<Record *> head_ = nullptr;
+		mutable std::atomic<std::size_t> queued_ = 0;
+		mutable std::atomic<bool> flushScheduled_ = false;
+		std::atomic<bool> visible_ = true;
 	};
 
 public:
-	StreamSegmenterDock(std::shared_ptr<Scripting::ScriptingRuntime> runtime, QWidget *parent = nullptr);
+	explicit StreamSegmenterDock(QWidget *parent = nullptr);
 	~StreamSegmenterDock() override = default;
 
 	StreamSegmenterDock(const StreamSegmenterDock &) = delete;
@@ -99,6 +130,18 @@ public:
 		logger_ = std::move(logger);
 	}
 
+	void setScriptingRuntime(std::shared_ptr<Scripting::ScriptingRuntime> runtime)
+	{
+		std::scoped_lock lock(mutex_);
+		runtime_ = std::move(runtime);
+	}
+
+	void setCurlConnectionPool(std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool)
+	{
+		std::scoped_lock lock(mutex_);
+		curlPool_ = std::move(curlPool);
+	}
+
 	void setAuthStore(std::shared_ptr<Store::AuthStore> authStore)
 	{
 		std::scoped_lock lock(mutex_);
@@ -117,9 +160,19 @@ public:
 		youTubeStore_ = std::move(youTubeStore);
 	}
 
+	void setLiveStreamCache(std::shared_ptr<Store::LiveStreamCache> liveStreamCache)
+	{
+		std::scoped_lock lock(mutex_);
+		liveStreamCache_ = std::move(liveStreamCache);
+	}
+
 	void setSystemMonitorStatus(const QString &status) { monitorLabel_->setText(status); }
 
 signals:
+	/**
+	 * Emitted the first time the dock becomes visible; the plugin defers its heavy setup until then.
+	 */
+	void firstShown();
 	void startButtonClicked();
 	void stopButtonClicked();
 	void segmentNowButtonClicked();
@@ -131,8 +184,15 @@ public slots:
 private slots:
 	void onSettingsButtonClicked();
 
+protected:
+	void showEvent(QShowEvent *event) override;
+	void hideEvent(QHideEvent *event) override;
+
 private:
 	void setupUi();
+	void appendLogLine(int level, const QString &text, const QString &color);
+	void scheduleLogFlush();
+	void flushLogLines();
 
 	void setProgress(int value, bool visible = true)
 	{
@@ -142,14 +202,15 @@ private:
 		}
 	}
 
-	const std::shared_ptr<Scripting::ScriptingRuntime> runtime_;
-	const std::shared_ptr<const Logger::ILogger> loggerAdapter_;
+	const std::shared_ptr<LoggerAdapter> loggerAdapter_;
+	bool shownOnce_ = false;
 
 	// Data Cache
 	QString currentStatusText_;
 	QString currentStatusColor_;
 	QString currentNextTimeText_;
 	QString currentTimeRemainingText_;
+	QStringList lastCutoverTimingLines_;
 
 	// --- UI Components ---
 
@@ -165,6 +226,9 @@ private:
 	QVBoxLayout *const statusLayout_;
 	QLabel *const monitorLabel_;
 	QProgressBar *progressBar_ = nullptr;
+	QLabel *const cutoverTimingLabel_;
+	QLabel *const eventHandlerProfileLabel_;
+	QLabel *const liveStreamHealthLabel_;
 
 	// 3. Schedule Section
 	QGroupBox *const scheduleGroup_;
@@ -191,7 +255,14 @@ private:
 	// 4. Log Section
 	QGroupBox *const logGroup_;
 	QVBoxLayout *const logLayout_;
-	QTextEdit *const consoleView_;
+	QHBoxLayout *const logFilterLayout_;
+	QComboBox *const logLevelFilter_;
+	QLineEdit *const logSearchEdit_;
+	QListView *const logView_;
+	LogListModel *const logModel_;
+	// Coalesces the lines of one frame into a single model update.
+	QTimer *const logFlushTimer_;
+	std::vector<LogListEntry> pendingLogLines_;
 
 	// 5. Bottom Controls
 	QVBoxLayout *const bottomControlLayout_;
@@ -200,9 +271,12 @@ private:
 
 	mutable std::mutex mutex_;
 	std::shared_ptr<const Logger::ILogger> logger_;
+	std::shared_ptr<Scripting::ScriptingRuntime> runtime_;
+	std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool_;
 	std::shared_ptr<Store::AuthStore> authStore_;
 	std::shared_ptr<Store::EventHandlerStore> eventHandlerStore_;
 	std::shared_ptr<Store::YouTubeStore> youTubeStore_;
+	std::shared_ptr<Store::LiveStreamCache> liveStreamCache_;
 };
 
 } // namespace UI
@@ -0,0 +1,350 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * KaitoTokyo Logger Library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <source_location>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "ILogger.hpp"
+
+namespace KaitoTokyo::Logger {
+
+struct AsyncLoggerOptions {
+	// Number of records the ring holds. Rounded up to a power of two.
+	std::size_t capacity = 1024;
+	// Records the writer hands to the downstream logger per logBatch() call.
+	std::size_t maxBatchSize = 64;
+	// When the ring is full, records at or above this level are written on the calling thread instead of
+	// being dropped. They may then appear before older records still in the ring.
+	LogLevel synchronousLevel = LogLevel::Error;
+};
+
+/**
+ * @brief Counters of an AsyncLogger, taken at one point in time.
+ */
+struct AsyncLoggerStats {
+	// Records handed to the downstream logger by the writer thread.
+	std::uint64_t written = 0;
+	// Records written on the calling thread because the ring was full.
+	std::uint64_t writtenSynchronously = 0;
+	// Records dropped because the ring was full, by LogLevel.
+	std::array<std::uint64_t, 4> dropped{};
+	// Records whose name or fields did not fit into a slot and were cut short.
+	std::uint64_t truncated = 0;
+};
+
+/**
+ * @class AsyncLogger
+ * @brief Moves the cost of writing log lines off the calling thread.
+ *
+ * log() copies the record into a slot of a fixed-capacity ring and returns; it neither allocates nor
+ * takes a lock. A single writer thread drains the ring in batches into one downstream logger, so wrapping
+ * a MultiLogger makes all of its sinks share the same drain and see each batch through logBatch().
+ *
+ * When the ring is full, records below AsyncLoggerOptions::synchronousLevel are dropped and counted, and
+ * the writer reports the count with a LogRecordsDropped warning once it catches up. Records at or above
+ * that level are never dropped.
+ *
+ * The downstream logger is called from the writer thread and, on overflow, from producers, so it must be
+ * thread-safe like any other ILogger. Destroying the AsyncLogger writes out every queued record.
+ */
+class AsyncLogger final : public ILogger {
+public:
+	static constexpr std::size_t kMaxFields = 16;
+	static constexpr std::size_t kSlotTextBytes = 1024;
+
+	explicit AsyncLogger(std::shared_ptr<const ILogger> downstream, AsyncLoggerOptions options = {})
+		: downstream_(downstream ? std::move(downstream)
+					 : throw std::invalid_argument("DownstreamIsNullError(AsyncLogger)")),
+		  options_(normalize(options)),
+		  mask_(options_.capacity - 1),
+		  slots_(options_.capacity)
+	{
+		setMinLevel(downstream_->getMinLevel());
+		for (std::size_t i = 0; i < slots_.size(); ++i) {
+			slots_[i].sequence.store(i, std::memory_order_relaxed);
+		}
+		writer_ = std::thread([this]() noexcept { run(); });
+	}
+
+	~AsyncLogger() noexcept override
+	{
+		stopping_.store(true, std::memory_order_release);
+		wake();
+		if (writer_.joinable()) {
+			writer_.join();
+		}
+	}
+
+	AsyncLogger(const AsyncLogger &) = delete;
+	AsyncLogger &operator=(const AsyncLogger &) = delete;
+	AsyncLogger(AsyncLogger &&) = delete;
+	AsyncLogger &operator=(AsyncLogger &&) = delete;
+
+	void log(LogLevel level, std::string_view name, std::source_location loc,
+		 std::span<const LogField> bound, std::span<const LogField> context) const noexcept override
+	{
+		if (tryEnqueue(level, name, loc, bound, context)) {
+			wake();
+			return;
+		}
+
+		if (level >= options_.synchronousLevel) {
+			writtenSynchronously_.fetch_add(1, std::memory_order_relaxed);
+			downstream_->log(level, name, loc, bound, context);
+		} else {
+			dropped_[static_cast<std::size_t>(level)].fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	/**
+	 * @brief Blocks until every record queued before the call has been handed to the downstream logger.
+	 *
+	 * Returns immediately when called from the writer thread, i.e. from inside the downstream logger.
+	 */
+	void flush() const noexcept
+	{
+		if (std::this_thread::get_id() == writer_.get_id()) {
+			return;
+		}
+
+		const std::size_t target = enqueuePos_.load(std::memory_order_acquire);
+		std::size_t drained = drainedPos_.load(std::memory_order_acquire);
+		while (drained < target) {
+			drainedPos_.wait(drained, std::memory_order_acquire);
+			drained = drainedPos_.load(std::memory_order_acquire);
+		}
+	}
+
+	/**
+	 * @brief Returns the current counters.
+	 */
+	AsyncLoggerStats getStats() const noexcept
+	{
+		AsyncLoggerStats stats;
+		stats.written = written_.load(std::memory_order_relaxed);
+		stats.writtenSynchronously = writtenSynchronously_.load(std::memory_order_relaxed);
+		for (std::size_t i = 0; i < dropped_.size(); ++i) {
+			stats.dropped[i] = dropped_[i].load(std::memory_order_relaxed);
+		}
+		stats.truncated = truncated_.load(std::memory_order_relaxed);
+		return stats;
+	}
+
+private:
+	/**
+	 * @brief A preformatted record. Name, keys and values are packed back to back into text, bound
+	 * fields first.
+	 */
+	struct Slot {
+		std::atomic<std::size_t> sequence;
+		LogLevel level;
+		std::source_location loc;
+		std::uint16_t nameLength;
+		std::uint16_t boundCount;
+		std::uint16_t fieldCount;
+		std::array<std::uint16_t, kMaxFields * 2> fieldLengths;
+		std::array<char, kSlotTextBytes> text;
+	};
+
+	static AsyncLoggerOptions normalize(AsyncLoggerOptions options) noexcept
+	{
+		options.capacity = std::bit_ceil(std::max<std::size_t>(options.capacity, 2));
+		options.maxBatchSize = std::clamp<std::size_t>(options.maxBatchSize, 1, options.capacity);
+		return options;
+	}
+
+	// Producer side of a bounded MPMC ring (Vyukov); only the writer thread consumes.
+	bool tryEnqueue(LogLevel level, std::string_view name, std::source_location loc,
+			std::span<const LogField> bound, std::span<const LogField> context) const noexcept
+	{
+		std::size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+		Slot *slot;
+		for (;;) {
+			slot = &slots_[pos & mask_];
+			const std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+			const auto diff = static_cast<std::ptrdiff_t>(sequence - pos);
+			if (diff == 0) {
+				if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+					break;
+				}
+			} else if (diff < 0) {
+				return false;
+			} else {
+				pos = enqueuePos_.load(std::memory_order_relaxed);
+			}
+		}
+
+		bool truncated = bound.size() + context.size() > kMaxFields;
+		std::size_t offset = 0;
+		auto append = [&](std::string_view text) noexcept -> std::uint16_t {
+			const std::size_t length = std::min(text.size(), kSlotTextBytes - offset);
+			truncated = truncated || length < text.size();
+			std::copy_n(text.data(), length, slot->text.data() + offset);
+			offset += length;
+			return static_cast<std::uint16_t>(length);
+		};
+
+		slot->level = level;
+		slot->loc = loc;
+		slot->nameLength = append(name);
+		slot->boundCount = static_cast<std::uint16_t>(std::min(bound.size(), kMaxFields));
+		slot->fieldCount = static_cast<std::uint16_t>(std::min(bound.size() + context.size(), kMaxFields));
+		for (std::size_t i = 0; i < slot->fieldCount; ++i) {
+			const LogField &field = i < bound.size() ? bound[i] : context[i - bound.size()];
+			slot->fieldLengths[i * 2] = append(field.key);
+			slot->fieldLengths[i * 2 + 1] = append(field.value);
+		}
+		if (truncated) {
+			truncated_.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		slot->sequence.store(pos + 1, std::memory_order_release);
+		return true;
+	}
+
+	void wake() const noexcept
+	{
+		wakeups_.fetch_add(1, std::memory_order_release);
+		wakeups_.notify_one();
+	}
+
+	void run() noexcept
+	{
+		std::vector<LogRecord> records(options_.maxBatchSize);
+		std::vector<LogField> fields(options_.maxBatchSize * kMaxFields);
+
+		for (;;) {
+			const std::uint64_t seen = wakeups_.load(std::memory_order_acquire);
+			const bool stopping = stopping_.load(std::memory_order_acquire);
+			if (drainBatch(records, fields) > 0) {
+				continue;
+			}
+			reportDrops();
+			if (stopping) {
+				return;
+			}
+			wakeups_.wait(seen, std::memory_order_acquire);
+		}
+	}
+
+	std::size_t drainBatch(std::vector<LogRecord> &records, std::vector<LogField> &fields) noexcept
+	{
+		const std::size_t begin = dequeuePos_;
+		std::size_t count = 0;
+		while (count < records.size()) {
+			const std::size_t pos = begin + count;
+			Slot &slot = slots_[pos & mask_];
+			if (slot.sequence.load(std::memory_order_acquire) != pos + 1) {
+				break;
+			}
+
+			const char *text = slot.text.data();
+			const std::string_view name(text, slot.nameLength);
+			text += slot.nameLength;
+			const std::span<LogField> slotFields(fields.data() + count * kMaxFields, slot.fieldCount);
+			for (std::size_t i = 0; i < slot.fieldCount; ++i) {
+				const std::string_view key(text, slot.fieldLengths[i * 2]);
+				text += key.size();
+				const std::string_view value(text, slot.fieldLengths[i * 2 + 1]);
+				text += value.size();
+				slotFields[i] = LogField{key, value};
+			}
+			records[count] = LogRecord{slot.level, name, slot.loc, slotFields.first(slot.boundCount),
+						   slotFields.subspan(slot.boundCount)};
+			++count;
+		}
+		if (count == 0) {
+			return 0;
+		}
+
+		downstream_->logBatch(std::span<const LogRecord>(records.data(), count));
+
+		// Slots are handed back only after the downstream logger is done with the views into them.
+		for (std::size_t i = 0; i < count; ++i) {
+			const std::size_t pos = begin + i;
+			slots_[pos & mask_].sequence.store(pos + slots_.size(), std::memory_order_release);
+		}
+		dequeuePos_ = begin + count;
+		written_.fetch_add(count, std::memory_order_relaxed);
+		drainedPos_.store(dequeuePos_, std::memory_order_release);
+		drainedPos_.notify_all();
+		return count;
+	}
+
+	void reportDrops() noexcept
+	{
+		std::uint64_t dropped = 0;
+		for (const std::atomic<std::uint64_t> &counter : dropped_) {
+			dropped += counter.load(std::memory_order_relaxed);
+		}
+		if (dropped == reportedDrops_) {
+			return;
+		}
+
+		const std::uint64_t count = dropped - reportedDrops_;
+		reportedDrops_ = dropped;
+		std::array<char, 24> buffer;
+		const auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), count);
+		downstream_->warn("LogRecordsDropped",
+				  {{"count", std::string_view(buffer.data(), result.ptr - buffer.data())}});
+	}
+
+	const std::shared_ptr<const ILogger> downstream_;
+	const AsyncLoggerOptions options_;
+	const std::size_t mask_;
+	mutable std::vector<Slot> slots_;
+
+	// Producer side.
+	alignas(64) mutable std::atomic<std::size_t> enqueuePos_ = 0;
+	mutable std::atomic<std::uint64_t> wakeups_ = 0;
+	mutable std::atomic<std::uint64_t> writtenSynchronously_ = 0;
+	mutable std::array<std::atomic<std::uint64_t>, 4> dropped_{};
+	mutable std::atomic<std::uint64_t> truncated_ = 0;
+
+	// Writer side.
+	alignas(64) std::size_t dequeuePos_ = 0;
+	mutable std::atomic<std::size_t> drainedPos_ = 0;
+	std::atomic<std::uint64_t> written_ = 0;
+	std::uint64_t reportedDrops_ = 0;
+	std::atomic<bool> stopping_ = false;
+
+	std::thread writer_;
+};
+
+} // namespace KaitoTokyo::Logger
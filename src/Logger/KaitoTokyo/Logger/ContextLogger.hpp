@@ -0,0 +1,155 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * KaitoTokyo Logger Library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <source_location>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include "ILogger.hpp"
+
+namespace KaitoTokyo::Logger {
+
+/**
+ * @class ContextLogger
+ * @brief Attaches a fixed set of fields, such as a task name or session id, to every record.
+ *
+ * The fields are copied once into storage inside the logger and passed downstream as the bound span of
+ * ILogger::log, so logging through a ContextLogger allocates nothing. Wrapping another ContextLogger
+ * takes over its fields and its downstream logger, so nesting task, session and segment scopes still
+ * costs a single virtual call per record. The minimum level is taken over from downstream on construction.
+ */
+class ContextLogger final : public ILogger {
+public:
+	static constexpr std::size_t kMaxBoundFields = 8;
+	static constexpr std::size_t kBoundTextBytes = 256;
+
+	/**
+	 * @param downstream Logger that receives the records.
+	 * @param fields Fields to attach, after those of downstream if it is a ContextLogger itself.
+	 * @throws std::invalid_argument If downstream is null or the fields do not fit into the logger.
+	 */
+	ContextLogger(std::shared_ptr<const ILogger> downstream, std::initializer_list<LogField> fields)
+	{
+		if (!downstream) {
+			throw std::invalid_argument("DownstreamIsNullError(ContextLogger)");
+		}
+
+		if (auto parent = std::dynamic_pointer_cast<const ContextLogger>(downstream)) {
+			for (const LogField &field : parent->getBoundFields()) {
+				bind(field);
+			}
+			downstream_ = parent->downstream_;
+		} else {
+			downstream_ = std::move(downstream);
+		}
+		for (const LogField &field : fields) {
+			bind(field);
+		}
+		setMinLevel(downstream_->getMinLevel());
+	}
+
+	~ContextLogger() noexcept override = default;
+
+	/**
+	 * @brief Shorthand for std::make_shared, which cannot forward a braced field list.
+	 */
+	static std::shared_ptr<const ContextLogger> create(std::shared_ptr<const ILogger> downstream,
+							   std::initializer_list<LogField> fields)
+	{
+		return std::make_shared<const ContextLogger>(std::move(downstream), fields);
+	}
+
+	ContextLogger(const ContextLogger &) = delete;
+	ContextLogger &operator=(const ContextLogger &) = delete;
+	ContextLogger(ContextLogger &&) = delete;
+	ContextLogger &operator=(ContextLogger &&) = delete;
+
+	/**
+	 * @brief Returns the attached fields. The views are valid for the lifetime of this logger.
+	 */
+	std::span<const LogField> getBoundFields() const noexcept { return {fields_.data(), fieldCount_}; }
+
+	void log(LogLevel level, std::string_view name, std::source_location loc, std::span<const LogField> bound,
+		 std::span<const LogField> context) const noexcept override
+	{
+		if (bound.empty()) {
+			downstream_->log(level, name, loc, getBoundFields(), context);
+			return;
+		}
+
+		// Reached through another wrapper that binds fields of its own: ours come first.
+		constexpr std::size_t kStackFields = 32;
+		if (fieldCount_ + bound.size() <= kStackFields) {
+			std::array<LogField, kStackFields> merged;
+			const auto end = std::copy(bound.begin(), bound.end(),
+						   std::copy_n(fields_.begin(), fieldCount_, merged.begin()));
+			downstream_->log(level, name, loc, {merged.begin(), end}, context);
+			return;
+		}
+
+		try {
+			std::vector<LogField> merged(fields_.begin(), fields_.begin() + fieldCount_);
+			merged.insert(merged.end(), bound.begin(), bound.end());
+			downstream_->log(level, name, loc, merged, context);
+		} catch (...) {
+			downstream_->log(level, name, loc, bound, context);
+		}
+	}
+
+private:
+	void bind(const LogField &field)
+	{
+		const std::size_t size = field.key.size() + field.value.size();
+		if (fieldCount_ == kMaxBoundFields || size > kBoundTextBytes - textSize_) {
+			throw std::invalid_argument("BoundFieldsTooLargeError(ContextLogger)");
+		}
+		fields_[fieldCount_++] = LogField{store(field.key), store(field.value)};
+	}
+
+	std::string_view store(std::string_view text) noexcept
+	{
+		char *begin = text_.data() + textSize_;
+		std::copy(text.begin(), text.end(), begin);
+		textSize_ += text.size();
+		return {begin, text.size()};
+	}
+
+	std::shared_ptr<const ILogger> downstream_;
+	std::array<char, kBoundTextBytes> text_{};
+	std::size_t textSize_ = 0;
+	std::array<LogField, kMaxBoundFields> fields_{};
+	std::size_t fieldCount_ = 0;
+};
+
+} // namespace KaitoTokyo::Logger
@@ -25,10 +25,23 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <functional>
 #include <iterator>
 #include <source_location>
 #include <span>
+#include <string>
 #include <string_view>
+#include <tuple>
+#include <type_traits>
+
+// Lowest LogLevel, as an integer, whose calls are compiled in. Calls below it compile to nothing.
+#ifndef KAITOTOKYO_LOGGER_MIN_LEVEL
+#define KAITOTOKYO_LOGGER_MIN_LEVEL 0
+#endif
 
 namespace KaitoTokyo::Logger {
 
@@ -37,8 +50,42 @@ struct LogField {
 	std::string_view value;
 };
 
+/**
+ * @brief A field that owns its value, returned by the callables of the lazy logging overloads.
+ */
+struct OwnedLogField {
+	std::string_view key;
+	std::string value;
+};
+
 enum class LogLevel { Debug, Info, Warn, Error };
 
+inline constexpr LogLevel kCompiledMinLogLevel = static_cast<LogLevel>(KAITOTOKYO_LOGGER_MIN_LEVEL);
+
+/**
+ * @brief A callable that builds the fields of a record only when the record is emitted.
+ *
+ * It returns a std::array of OwnedLogField, most easily through std::to_array:
+ * `[&] { return std::to_array<OwnedLogField>({{"size", std::to_string(size)}}); }`.
+ */
+template<typename F>
+concept LazyLogFields = std::invocable<F &> && requires(std::invoke_result_t<F &> fields) {
+	std::tuple_size<std::invoke_result_t<F &>>::value;
+	{ fields[0].key } -> std::convertible_to<std::string_view>;
+	{ fields[0].value } -> std::convertible_to<std::string_view>;
+};
+
+/**
+ * @brief One log line passed to ILogger::logBatch. Views are valid only during the call.
+ */
+struct LogRecord {
+	LogLevel level;
+	std::string_view name;
+	std::source_location loc;
+	std::span<const LogField> bound;
+	std::span<const LogField> context;
+};
+
 class ILogger {
 public:
 	ILogger() = default;
@@ -53,29 +100,122 @@ public:
 	void debug(std::string_view name, std::initializer_list<LogField> context = {},
 		   std::source_location loc = std::source_location::current()) const noexcept
 	{
-		log(LogLevel::Debug, name, loc, context);
+		if (isEnabled(LogLevel::Debug)) {
+			log(LogLevel::Debug, name, loc, {}, context);
+		}
 	}
 
 	void info(std::string_view name, std::initializer_list<LogField> context = {},
 		  std::source_location loc = std::source_location::current()) const noexcept
 	{
-		log(LogLevel::Info, name, loc, context);
+		if (isEnabled(LogLevel::Info)) {
+			log(LogLevel::Info, name, loc, {}, context);
+		}
 	}
 
 	void warn(std::string_view name, std::initializer_list<LogField> context = {},
 		  std::source_location loc = std::source_location::current()) const noexcept
 	{
-		log(LogLevel::Warn, name, loc, context);
+		if (isEnabled(LogLevel::Warn)) {
+			log(LogLevel::Warn, name, loc, {}, context);
+		}
 	}
 
 	void error(std::string_view name, std::initializer_list<LogField> context = {},
 		   std::source_location loc = std::source_location::current()) const noexcept
 	{
-		log(LogLevel::Error, name, loc, context);
+		if (isEnabled(LogLevel::Error)) {
+			log(LogLevel::Error, name, loc, {}, context);
+		}
+	}
+
+	/**
+	 * @brief Returns whether records of the level pass both the compile-time and the runtime minimum.
+	 */
+	bool isEnabled(LogLevel level) const noexcept
+	{
+		return level >= kCompiledMinLogLevel && level >= minLevel_.load(std::memory_order_relaxed);
+	}
+
+	LogLevel getMinLevel() const noexcept { return minLevel_.load(std::memory_order_relaxed); }
+
+	/**
+	 * @brief Sets the lowest level the convenience methods pass on. Records below it are discarded
+	 * before their fields are built.
+	 */
+	void setMinLevel(LogLevel level) noexcept { minLevel_.store(level, std::memory_order_relaxed); }
+
+	// Lazy forms: makeFields runs only if the level is enabled.
+	template<LazyLogFields MakeFields>
+	void debug(std::string_view name, MakeFields &&makeFields,
+		   std::source_location loc = std::source_location::current()) const noexcept
+	{
+		logLazy(LogLevel::Debug, name, loc, makeFields);
+	}
+
+	template<LazyLogFields MakeFields>
+	void info(std::string_view name, MakeFields &&makeFields,
+		  std::source_location loc = std::source_location::current()) const noexcept
+	{
+		logLazy(LogLevel::Info, name, loc, makeFields);
 	}
 
+	template<LazyLogFields MakeFields>
+	void warn(std::string_view name, MakeFields &&makeFields,
+		  std::source_location loc = std::source_location::current()) const noexcept
+	{
+		logLazy(LogLevel::Warn, name, loc, makeFields);
+	}
+
+	template<LazyLogFields MakeFields>
+	void error(std::string_view name, MakeFields &&makeFields,
+		   std::source_location loc = std::source_location::current()) const noexcept
+	{
+		logLazy(LogLevel::Error, name, loc, makeFields);
+	}
+
+	/**
+	 * @brief Writes one record.
+	 *
+	 * @param bound Fields attached by a wrapping logger, such as ContextLogger, written before context.
+	 * @param context Fields given at the call site.
+	 */
 	virtual void log(LogLevel level, std::string_view name, std::source_location loc,
-			 std::span<const LogField> context) const noexcept = 0;
+			 std::span<const LogField> bound, std::span<const LogField> context) const noexcept = 0;
+
+	/**
+	 * @brief Writes several records at once. Sinks with a per-call cost, such as a queued UI update,
+	 * override this to pay it once per batch.
+	 */
+	virtual void logBatch(std::span<const LogRecord> records) const noexcept
+	{
+		for (const LogRecord &record : records) {
+			log(record.level, record.name, record.loc, record.bound, record.context);
+		}
+	}
+
+private:
+	template<typename MakeFields>
+	void logLazy(LogLevel level, std::string_view name, std::source_location loc,
+		     MakeFields &makeFields) const noexcept
+	{
+		if (!isEnabled(level)) {
+			return;
+		}
+
+		try {
+			const auto fields = std::invoke(makeFields);
+			std::array<LogField, std::tuple_size_v<std::remove_cvref_t<decltype(fields)>>> context;
+			for (std::size_t i = 0; i < context.size(); ++i) {
+				context[i] = LogField{fields[i].key, fields[i].value};
+			}
+			log(level, name, loc, {}, context);
+		} catch (...) {
+			log(level, name, loc, {}, std::array{LogField{"logFieldsError", "EvaluationFailed"}});
+		}
+	}
+
+	std::atomic<LogLevel> minLevel_ = LogLevel::Debug;
 };
 
 } // namespace KaitoTokyo::Logger
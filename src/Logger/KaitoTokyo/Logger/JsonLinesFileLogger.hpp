@@ -0,0 +1,451 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * KaitoTokyo Logger Library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <source_location>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "ILogger.hpp"
+
+namespace KaitoTokyo::Logger {
+
+struct JsonLinesFileLoggerOptions {
+	// Directory the log files are created in. Created if missing.
+	std::filesystem::path directory;
+	// Files are named <baseName>_<UTC time>_<sequence>.jsonl.
+	std::string baseName = "session";
+	// A new file is started once the current one reaches this size or age.
+	std::uintmax_t maxFileBytes = 64 * 1024 * 1024;
+	std::chrono::seconds maxFileAge = std::chrono::hours{6};
+	// Oldest files beyond this count are deleted on rotation.
+	std::size_t maxFiles = 16;
+	// The writer thread is woken early once this much is buffered.
+	std::size_t bufferBytes = 64 * 1024;
+	// Records arriving while this much is still unwritten are dropped.
+	std::size_t maxBufferedBytes = 4 * 1024 * 1024;
+	// How often buffered records are handed to the OS, and how often the file is synced to disk.
+	std::chrono::milliseconds flushInterval{1000};
+	std::chrono::milliseconds syncInterval{10000};
+};
+
+/**
+ * @brief Counters of a JsonLinesFileLogger, taken at one point in time.
+ */
+struct JsonLinesFileLoggerStats {
+	std::uint64_t records = 0;
+	// Records dropped because the writer fell behind by maxBufferedBytes.
+	std::uint64_t dropped = 0;
+	std::uint64_t bytesWritten = 0;
+	std::uint64_t rotations = 0;
+	// Failed writes, syncs and file creations. The affected records are lost.
+	std::uint64_t writeErrors = 0;
+};
+
+/**
+ * @class JsonLinesFileLogger
+ * @brief Writes every record as one JSON object per line into rotating files.
+ *
+ * Each line holds the time in Unix milliseconds, the level, the name, the source file and line, and the
+ * bound and call-site fields as one object, so a long session can be reconstructed with any JSON tool:
+ * `{"time":1760500000000,"level":"info","name":"StreamingStarted","file":"MainLoop.cpp","line":42,
+ * "fields":{"taskName":"..."}}`.
+ *
+ * log() only appends to an in-memory buffer. A writer thread hands the buffer to the OS every
+ * flushInterval, or earlier once bufferBytes are pending, syncs the file to disk every syncInterval
+ * rather than once per line, and rotates files by size and age.
+ */
+class JsonLinesFileLogger final : public ILogger {
+public:
+	/**
+	 * @throws std::invalid_argument If no directory is given.
+	 * @throws std::runtime_error If the first log file cannot be created.
+	 */
+	explicit JsonLinesFileLogger(JsonLinesFileLoggerOptions options) : options_(std::move(options))
+	{
+		if (options_.directory.empty()) {
+			throw std::invalid_argument("DirectoryIsEmptyError(JsonLinesFileLogger)");
+		}
+		std::error_code ec;
+		std::filesystem::create_directories(options_.directory, ec);
+		if (!openNextFile()) {
+			throw std::runtime_error("FileOpenError(JsonLinesFileLogger)");
+		}
+		writer_ = std::thread([this]() noexcept { run(); });
+	}
+
+	~JsonLinesFileLogger() noexcept override
+	{
+		{
+			std::scoped_lock lock(mutex_);
+			stopping_ = true;
+		}
+		cv_.notify_one();
+		writer_.join();
+	}
+
+	JsonLinesFileLogger(const JsonLinesFileLogger &) = delete;
+	JsonLinesFileLogger &operator=(const JsonLinesFileLogger &) = delete;
+	JsonLinesFileLogger(JsonLinesFileLogger &&) = delete;
+	JsonLinesFileLogger &operator=(JsonLinesFileLogger &&) = delete;
+
+	void log(LogLevel level, std::string_view name, std::source_location loc, std::span<const LogField> bound,
+		 std::span<const LogField> context) const noexcept override
+	{
+		const std::int64_t time = nowMilliseconds();
+		bool wake;
+		{
+			std::scoped_lock lock(mutex_);
+			wake = append(time, level, name, loc, bound, context);
+		}
+		if (wake) {
+			cv_.notify_one();
+		}
+	}
+
+	void logBatch(std::span<const LogRecord> records) const noexcept override
+	{
+		const std::int64_t time = nowMilliseconds();
+		bool wake = false;
+		{
+			std::scoped_lock lock(mutex_);
+			for (const LogRecord &record : records) {
+				if (append(time, record.level, record.name, record.loc, record.bound, record.context)) {
+					wake = true;
+				}
+			}
+		}
+		if (wake) {
+			cv_.notify_one();
+		}
+	}
+
+	/**
+	 * @brief Returns the file currently written to.
+	 */
+	std::filesystem::path getCurrentPath() const
+	{
+		std::scoped_lock lock(mutex_);
+		return currentPath_;
+	}
+
+	/**
+	 * @brief Returns the current counters.
+	 */
+	JsonLinesFileLoggerStats getStats() const
+	{
+		std::scoped_lock lock(mutex_);
+		return stats_;
+	}
+
+private:
+	struct FileCloser {
+		void operator()(std::FILE *file) const noexcept { std::fclose(file); }
+	};
+
+	using unique_file_t = std::unique_ptr<std::FILE, FileCloser>;
+
+	static std::int64_t nowMilliseconds() noexcept
+	{
+		return std::chrono::duration_cast<std::chrono::milliseconds>(
+			       std::chrono::system_clock::now().time_since_epoch())
+			.count();
+	}
+
+	static void appendJsonString(std::string &out, std::string_view text)
+	{
+		static constexpr char kHex[] = "0123456789abcdef";
+		out += '"';
+		for (const char c : text) {
+			switch (c) {
+			case '"':
+				out += "\\\"";
+				break;
+			case '\\':
+				out += "\\\\";
+				break;
+			case '\n':
+				out += "\\n";
+				break;
+			case '\r':
+				out += "\\r";
+				break;
+			case '\t':
+				out += "\\t";
+				break;
+			default:
+				if (static_cast<unsigned char>(c) < 0x20) {
+					out += "\\u00";
+					out += kHex[(c >> 4) & 0xf];
+					out += kHex[c & 0xf];
+				} else {
+					out += c;
+				}
+			}
+		}
+		out += '"';
+	}
+
+	static std::string_view levelName(LogLevel level) noexcept
+	{
+		switch (level) {
+		case LogLevel::Debug:
+			return "debug";
+		case LogLevel::Info:
+			return "info";
+		case LogLevel::Warn:
+			return "warn";
+		case LogLevel::Error:
+			return "error";
+		}
+		return "unknown";
+	}
+
+	// Called with mutex_ held. Returns whether the writer should be woken early.
+	bool append(std::int64_t time, LogLevel level, std::string_view name, std::source_location loc,
+		    std::span<const LogField> bound, std::span<const LogField> context) const noexcept
+	{
+		if (pending_.size() >= options_.maxBufferedBytes) {
+			stats_.dropped++;
+			return true;
+		}
+
+		const std::size_t rollback = pending_.size();
+		try {
+			std::string_view file = loc.file_name();
+			file = file.substr(file.find_last_of("/\\") + 1);
+
+			pending_ += "{\"time\":";
+			pending_ += std::to_string(time);
+			pending_ += ",\"level\":\"";
+			pending_ += levelName(level);
+			pending_ += "\",\"name\":";
+			appendJsonString(pending_, name);
+			pending_ += ",\"file\":";
+			appendJsonString(pending_, file);
+			pending_ += ",\"line\":";
+			pending_ += std::to_string(loc.line());
+			pending_ += ",\"fields\":{";
+			bool first = true;
+			for (std::span<const LogField> fields : {bound, context}) {
+				for (const LogField &field : fields) {
+					if (!first) {
+						pending_ += ',';
+					}
+					first = false;
+					appendJsonString(pending_, field.key);
+					pending_ += ':';
+					appendJsonString(pending_, field.value);
+				}
+			}
+			pending_ += "}}\n";
+			stats_.records++;
+		} catch (...) {
+			pending_.resize(rollback);
+			stats_.dropped++;
+		}
+		return pending_.size() >= options_.bufferBytes;
+	}
+
+	void run() noexcept
+	{
+		using Clock = std::chrono::steady_clock;
+		std::string writing;
+		Clock::time_point lastSync = Clock::now();
+		bool stopping = false;
+
+		while (!stopping) {
+			{
+				std::unique_lock lock(mutex_);
+				cv_.wait_for(lock, options_.flushInterval, [this] {
+					return stopping_ || pending_.size() >= options_.bufferBytes;
+				});
+				stopping = stopping_;
+				writing.swap(pending_);
+			}
+
+			if (!writing.empty()) {
+				write(writing);
+				writing.clear();
+			}
+			if (stopping || Clock::now() - lastSync >= options_.syncInterval) {
+				sync();
+				lastSync = Clock::now();
+			}
+		}
+		file_.reset();
+	}
+
+	// Writer thread only, apart from the first call from the constructor.
+	bool openNextFile() noexcept
+	{
+		try {
+			const std::time_t now = std::time(nullptr);
+			std::tm utc{};
+#ifdef _WIN32
+			gmtime_s(&utc, &now);
+#else
+			gmtime_r(&now, &utc);
+#endif
+			char stamp[32];
+			std::strftime(stamp, sizeof(stamp), "%Y%m%dT%H%M%SZ", &utc);
+			char sequence[16];
+			std::snprintf(sequence, sizeof(sequence), "%04u", static_cast<unsigned>(sequence_++ % 10000));
+			const std::filesystem::path path =
+				options_.directory / (options_.baseName + "_" + stamp + "_" + sequence + ".jsonl");
+
+#ifdef _WIN32
+			unique_file_t file(_wfopen(path.c_str(), L"ab"));
+#else
+			unique_file_t file(std::fopen(path.c_str(), "ab"));
+#endif
+			if (!file) {
+				return false;
+			}
+
+			file_ = std::move(file);
+			fileBytes_ = 0;
+			openedAt_ = std::chrono::steady_clock::now();
+			{
+				std::scoped_lock lock(mutex_);
+				currentPath_ = path;
+			}
+			removeOldFiles();
+			return true;
+		} catch (...) {
+			return false;
+		}
+	}
+
+	void removeOldFiles()
+	{
+		std::error_code ec;
+		std::vector<std::filesystem::path> files;
+		const std::string prefix = options_.baseName + "_";
+		for (const auto &entry : std::filesystem::directory_iterator(options_.directory, ec)) {
+			const std::string fileName = entry.path().filename().string();
+			if (entry.path().extension() == ".jsonl" && fileName.starts_with(prefix)) {
+				files.push_back(entry.path());
+			}
+		}
+		// The current file always stays.
+		const std::size_t keep = std::max<std::size_t>(options_.maxFiles, 1);
+		if (files.size() <= keep) {
+			return;
+		}
+
+		// The UTC stamp leads the name, so name order is creation order.
+		std::sort(files.begin(), files.end());
+		for (std::size_t i = 0; i < files.size() - keep; ++i) {
+			std::filesystem::remove(files[i], ec);
+		}
+	}
+
+	void write(const std::string &chunk) noexcept
+	{
+		const bool tooLarge = fileBytes_ > 0 && fileBytes_ + chunk.size() > options_.maxFileBytes;
+		const bool tooOld = std::chrono::steady_clock::now() - openedAt_ >= options_.maxFileAge;
+		if (!file_ || tooLarge || tooOld) {
+			if (file_) {
+				sync();
+			}
+			file_.reset();
+			const bool opened = openNextFile();
+			std::scoped_lock lock(mutex_);
+			if (!opened) {
+				stats_.writeErrors++;
+				return;
+			}
+			stats_.rotations++;
+		}
+
+		const std::size_t written = std::fwrite(chunk.data(), 1, chunk.size(), file_.get());
+		const bool flushed = std::fflush(file_.get()) == 0;
+		fileBytes_ += written;
+
+		std::scoped_lock lock(mutex_);
+		stats_.bytesWritten += written;
+		if (written != chunk.size() || !flushed) {
+			stats_.writeErrors++;
+		}
+	}
+
+	void sync() noexcept
+	{
+		if (!file_) {
+			return;
+		}
+#ifdef _WIN32
+		const bool synced = _commit(_fileno(file_.get())) == 0;
+#else
+		const bool synced = fsync(fileno(file_.get())) == 0;
+#endif
+		if (!synced) {
+			std::scoped_lock lock(mutex_);
+			stats_.writeErrors++;
+		}
+	}
+
+	const JsonLinesFileLoggerOptions options_;
+
+	mutable std::mutex mutex_;
+	mutable std::condition_variable cv_;
+	// Guarded by mutex_.
+	mutable std::string pending_;
+	mutable JsonLinesFileLoggerStats stats_;
+	std::filesystem::path currentPath_;
+	bool stopping_ = false;
+
+	// Writer thread only.
+	unique_file_t file_;
+	std::uintmax_t fileBytes_ = 0;
+	std::chrono::steady_clock::time_point openedAt_;
+	unsigned sequence_ = 0;
+
+	std::thread writer_;
+};
+
+} // namespace KaitoTokyo::Logger
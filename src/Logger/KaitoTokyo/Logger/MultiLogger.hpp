@@ -25,6 +25,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <iterator>
 #include <source_location>
 #include <span>
@@ -38,7 +39,15 @@ namespace KaitoTokyo::Logger {
 
 class MultiLogger : public ILogger {
 public:
-	explicit MultiLogger(std::vector<std::shared_ptr<const ILogger>> loggers) : loggers_(std::move(loggers)) {}
+	explicit MultiLogger(std::vector<std::shared_ptr<const ILogger>> loggers) : loggers_(std::move(loggers))
+	{
+		// Let through whatever at least one sink wants; each sink then filters for itself.
+		LogLevel minLevel = LogLevel::Error;
+		for (const std::shared_ptr<const ILogger> &logger : loggers_) {
+			minLevel = std::min(minLevel, logger->getMinLevel());
+		}
+		setMinLevel(minLevel);
+	}
 
 	virtual ~MultiLogger() noexcept = default;
 
@@ -48,10 +57,19 @@ public:
 	MultiLogger &operator=(MultiLogger &&) = delete;
 
 	void log(LogLevel level, std::string_view name, std::source_location loc,
-		 std::span<const LogField> context) const noexcept override
+		 std::span<const LogField> bound, std::span<const LogField> context) const noexcept override
+	{
+		for (const std::shared_ptr<const ILogger> &logger : loggers_) {
+			if (logger->isEnabled(level)) {
+				logger->log(level, name, loc, bound, context);
+			}
+		}
+	}
+
+	void logBatch(std::span<const LogRecord> records) const noexcept override
 	{
 		for (const std::shared_ptr<const ILogger> &logger : loggers_) {
-			logger->log(level, name, loc, context);
+			logger->logBatch(records);
 		}
 	}
 
@@ -40,7 +40,8 @@ public:
 
 	~NullLogger() override = default;
 
-	void log(LogLevel, std::string_view, std::source_location, std::span<const LogField>) const noexcept override
+	void log(LogLevel, std::string_view, std::source_location, std::span<const LogField>,
+		 std::span<const LogField>) const noexcept override
 	{
 		// No-op
 	}
@@ -42,7 +42,7 @@ public:
 	~PrintLogger() override = default;
 
 	void log(LogLevel level, std::string_view name, std::source_location loc,
-		 std::span<const LogField> context) const noexcept override
+		 std::span<const LogField> bound, std::span<const LogField> context) const noexcept override
 	{
 		switch (level) {
 		case LogLevel::Debug:
@@ -63,6 +63,9 @@ public:
 		}
 
 		std::cout << "\tname=" << name << "\tlocation=" << loc.file_name() << ":" << loc.line();
+		for (const auto &field : bound) {
+			std::cout << "\t" << field.key << "=" << field.value;
+		}
 		for (const auto &field : context) {
 			std::cout << "\t" << field.key << "=" << field.value;
 		}
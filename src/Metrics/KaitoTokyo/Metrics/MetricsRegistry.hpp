@@ -0,0 +1,404 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * KaitoTokyo Metrics Library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace KaitoTokyo::Metrics {
+
+/**
+ * @brief Label names and values of one series, in the order they are rendered.
+ */
+using MetricLabels = std::vector<std::pair<std::string, std::string>>;
+
+/**
+ * @brief Upper bounds in seconds for request and handler latencies.
+ */
+inline constexpr double kDefaultDurationBuckets[] = {0.005, 0.01, 0.025, 0.05, 0.1, 0.25,
+						     0.5,   1.0,  2.5,   5.0,  10.0, 30.0};
+
+/**
+ * @brief A monotonically increasing count.
+ */
+class Counter final {
+public:
+	void inc(std::uint64_t amount = 1) noexcept { value_.fetch_add(amount, std::memory_order_relaxed); }
+
+	std::uint64_t getValue() const noexcept { return value_.load(std::memory_order_relaxed); }
+
+private:
+	std::atomic<std::uint64_t> value_ = 0;
+};
+
+/**
+ * @brief A value that can go up and down.
+ */
+class Gauge final {
+public:
+	void set(double value) noexcept { value_.store(value, std::memory_order_relaxed); }
+
+	void add(double amount) noexcept
+	{
+		double current = value_.load(std::memory_order_relaxed);
+		while (!value_.compare_exchange_weak(current, current + amount, std::memory_order_relaxed)) {
+		}
+	}
+
+	double getValue() const noexcept { return value_.load(std::memory_order_relaxed); }
+
+private:
+	std::atomic<double> value_ = 0.0;
+};
+
+/**
+ * @brief Bucket counts of a Histogram, taken at one point in time.
+ */
+struct HistogramSnapshot {
+	std::vector<double> upperBounds;
+	// Cumulative counts per upper bound, followed by the +Inf bucket.
+	std::vector<std::uint64_t> cumulativeCounts;
+	double sum = 0.0;
+	std::uint64_t count = 0;
+};
+
+/**
+ * @brief Counts observations into fixed buckets.
+ *
+ * observe() is two relaxed atomic increments and a compare-and-swap on the sum, so it can be called on
+ * hot paths from any thread. A snapshot taken while observations are in flight may have a sum that is
+ * one observation ahead of or behind the counts.
+ */
+class Histogram final {
+public:
+	/**
+	 * @param upperBounds Strictly increasing finite bucket bounds; the +Inf bucket is implicit.
+	 * @throws std::invalid_argument If the bounds are empty, not finite or not increasing.
+	 */
+	explicit Histogram(std::span<const double> upperBounds)
+		: upperBounds_(upperBounds.begin(), upperBounds.end()),
+		  counts_(std::make_unique<std::atomic<std::uint64_t>[]>(upperBounds.size() + 1))
+	{
+		if (upperBounds_.empty()) {
+			throw std::invalid_argument("UpperBoundsIsEmptyError(Histogram)");
+		}
+		for (std::size_t i = 0; i < upperBounds_.size(); i++) {
+			if (!std::isfinite(upperBounds_[i]) || (i > 0 && upperBounds_[i] <= upperBounds_[i - 1])) {
+				throw std::invalid_argument("UpperBoundsNotIncreasingError(Histogram)");
+			}
+		}
+	}
+
+	void observe(double value) noexcept
+	{
+		const auto it = std::lower_bound(upperBounds_.begin(), upperBounds_.end(), value);
+		counts_[static_cast<std::size_t>(std::distance(upperBounds_.begin(), it))].fetch_add(
+			1, std::memory_order_relaxed);
+
+		double current = sum_.load(std::memory_order_relaxed);
+		while (!sum_.compare_exchange_weak(current, current + value, std::memory_order_relaxed)) {
+		}
+	}
+
+	/**
+	 * @brief Observes a duration in seconds.
+	 */
+	template<typename Rep, typename Period> void observe(std::chrono::duration<Rep, Period> duration) noexcept
+	{
+		observe(std::chrono::duration<double>(duration).count());
+	}
+
+	const std::vector<double> &getUpperBounds() const noexcept { return upperBounds_; }
+
+	HistogramSnapshot snapshot() const
+	{
+		HistogramSnapshot snapshot;
+		snapshot.upperBounds = upperBounds_;
+		snapshot.cumulativeCounts.reserve(upperBounds_.size() + 1);
+		std::uint64_t cumulative = 0;
+		for (std::size_t i = 0; i <= upperBounds_.size(); i++) {
+			cumulative += counts_[i].load(std::memory_order_relaxed);
+			snapshot.cumulativeCounts.push_back(cumulative);
+		}
+		// Derived from the buckets so that _count always equals the +Inf bucket.
+		snapshot.count = cumulative;
+		snapshot.sum = sum_.load(std::memory_order_relaxed);
+		return snapshot;
+	}
+
+private:
+	const std::vector<double> upperBounds_;
+	const std::unique_ptr<std::atomic<std::uint64_t>[]> counts_;
+	std::atomic<double> sum_ = 0.0;
+};
+
+/**
+ * @class MetricsRegistry
+ * @brief Owns named metrics and renders them in the Prometheus text exposition format.
+ *
+ * Looking a metric up takes a lock, so callers on hot paths keep the returned reference, which stays
+ * valid for the lifetime of the registry. Recording into a metric never locks. Asking again for the
+ * same name and labels returns the same metric.
+ */
+class MetricsRegistry final {
+public:
+	MetricsRegistry() = default;
+
+	MetricsRegistry(const MetricsRegistry &) = delete;
+	MetricsRegistry &operator=(const MetricsRegistry &) = delete;
+	MetricsRegistry(MetricsRegistry &&) = delete;
+	MetricsRegistry &operator=(MetricsRegistry &&) = delete;
+
+	/**
+	 * @brief The process-wide registry that the plugin records into and serves.
+	 */
+	static MetricsRegistry &global()
+	{
+		static MetricsRegistry registry;
+		return registry;
+	}
+
+	/**
+	 * @throws std::invalid_argument If a name is invalid or the name is registered with another type.
+	 */
+	Counter &counter(std::string_view name, std::string_view help, const MetricLabels &labels = {})
+	{
+		std::scoped_lock lock(mutex_);
+		Family &family = findOrAddFamily(name, help, Type::Counter, {});
+		std::unique_ptr<Counter> &counter = family.counters[renderLabels(labels)];
+		if (!counter) {
+			counter = std::make_unique<Counter>();
+		}
+		return *counter;
+	}
+
+	/**
+	 * @throws std::invalid_argument If a name is invalid or the name is registered with another type.
+	 */
+	Gauge &gauge(std::string_view name, std::string_view help, const MetricLabels &labels = {})
+	{
+		std::scoped_lock lock(mutex_);
+		Family &family = findOrAddFamily(name, help, Type::Gauge, {});
+		std::unique_ptr<Gauge> &gauge = family.gauges[renderLabels(labels)];
+		if (!gauge) {
+			gauge = std::make_unique<Gauge>();
+		}
+		return *gauge;
+	}
+
+	/**
+	 * @throws std::invalid_argument If a name or the bounds are invalid, the name is registered with
+	 * another type or other bounds, or a label is named "le".
+	 */
+	Histogram &histogram(std::string_view name, std::string_view help, std::span<const double> upperBounds,
+			     const MetricLabels &labels = {})
+	{
+		for (const auto &[key, value] : labels) {
+			if (key == "le") {
+				throw std::invalid_argument("ReservedLabelNameError(MetricsRegistry)");
+			}
+		}
+
+		std::scoped_lock lock(mutex_);
+		Family &family = findOrAddFamily(name, help, Type::Histogram, upperBounds);
+		std::unique_ptr<Histogram> &histogram = family.histograms[renderLabels(labels)];
+		if (!histogram) {
+			histogram = std::make_unique<Histogram>(upperBounds);
+		}
+		return *histogram;
+	}
+
+	/**
+	 * @brief Renders every metric in the Prometheus text exposition format, version 0.0.4.
+	 */
+	std::string render() const
+	{
+		std::string out;
+		auto inserter = std::back_inserter(out);
+
+		std::scoped_lock lock(mutex_);
+		for (const auto &[name, family] : families_) {
+			fmt::format_to(inserter, "# HELP {} ", name);
+			appendEscaped(out, family.help, false);
+			fmt::format_to(inserter, "\n# TYPE {} {}\n", name, typeName(family.type));
+
+			for (const auto &[labels, counter] : family.counters) {
+				fmt::format_to(inserter, "{}{} {}\n", name, labels, counter->getValue());
+			}
+			for (const auto &[labels, gauge] : family.gauges) {
+				fmt::format_to(inserter, "{}{} {}\n", name, labels, formatValue(gauge->getValue()));
+			}
+			for (const auto &[labels, histogram] : family.histograms) {
+				const HistogramSnapshot snapshot = histogram->snapshot();
+				// The le label goes last, inside the braces of the series labels if there are any.
+				const std::string_view prefix =
+					labels.empty() ? std::string_view("{")
+						       : std::string_view(labels).substr(0, labels.size() - 1);
+				const std::string_view separator = labels.empty() ? "" : ",";
+				for (std::size_t i = 0; i < snapshot.upperBounds.size(); i++) {
+					fmt::format_to(inserter, "{}_bucket{}{}le=\"{}\"}} {}\n", name, prefix,
+						       separator, formatValue(snapshot.upperBounds[i]),
+						       snapshot.cumulativeCounts[i]);
+				}
+				fmt::format_to(inserter, "{}_bucket{}{}le=\"+Inf\"}} {}\n", name, prefix, separator,
+					       snapshot.count);
+				fmt::format_to(inserter, "{}_sum{} {}\n", name, labels, formatValue(snapshot.sum));
+				fmt::format_to(inserter, "{}_count{} {}\n", name, labels, snapshot.count);
+			}
+		}
+		return out;
+	}
+
+private:
+	enum class Type { Counter, Gauge, Histogram };
+
+	struct Family {
+		Type type;
+		std::string help;
+		std::vector<double> upperBounds;
+		// Keyed by the rendered label set, which is also the output order.
+		std::map<std::string, std::unique_ptr<Counter>, std::less<>> counters;
+		std::map<std::string, std::unique_ptr<Gauge>, std::less<>> gauges;
+		std::map<std::string, std::unique_ptr<Histogram>, std::less<>> histograms;
+	};
+
+	static std::string_view typeName(Type type) noexcept
+	{
+		switch (type) {
+		case Type::Counter:
+			return "counter";
+		case Type::Gauge:
+			return "gauge";
+		case Type::Histogram:
+			return "histogram";
+		}
+		return "untyped";
+	}
+
+	static bool isValidName(std::string_view name, bool allowColon) noexcept
+	{
+		if (name.empty()) {
+			return false;
+		}
+		for (std::size_t i = 0; i < name.size(); i++) {
+			const char c = name[i];
+			const bool valid = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' ||
+					   (allowColon && c == ':') || (i > 0 && c >= '0' && c <= '9');
+			if (!valid) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	static void appendEscaped(std::string &out, std::string_view text, bool escapeQuote)
+	{
+		for (const char c : text) {
+			if (c == '\\') {
+				out += "\\\\";
+			} else if (c == '\n') {
+				out += "\\n";
+			} else if (c == '"' && escapeQuote) {
+				out += "\\\"";
+			} else {
+				out += c;
+			}
+		}
+	}
+
+	static std::string renderLabels(const MetricLabels &labels)
+	{
+		if (labels.empty()) {
+			return {};
+		}
+		std::string out = "{";
+		for (const auto &[key, value] : labels) {
+			if (!isValidName(key, false) || key.starts_with("__")) {
+				throw std::invalid_argument("InvalidLabelNameError(MetricsRegistry)");
+			}
+			if (out.size() > 1) {
+				out += ',';
+			}
+			out += key;
+			out += "=\"";
+			appendEscaped(out, value, true);
+			out += '"';
+		}
+		out += '}';
+		return out;
+	}
+
+	static std::string formatValue(double value)
+	{
+		if (std::isnan(value)) {
+			return "NaN";
+		}
+		if (std::isinf(value)) {
+			return value > 0 ? "+Inf" : "-Inf";
+		}
+		// fmt ignores the locale, which Qt may have switched to one with a decimal comma.
+		return fmt::format("{}", value);
+	}
+
+	Family &findOrAddFamily(std::string_view name, std::string_view help, Type type,
+				std::span<const double> upperBounds)
+	{
+		auto it = families_.find(name);
+		if (it == families_.end()) {
+			if (!isValidName(name, true)) {
+				throw std::invalid_argument("InvalidMetricNameError(MetricsRegistry)");
+			}
+			Family family{type, std::string(help), {upperBounds.begin(), upperBounds.end()}, {}, {}, {}};
+			it = families_.emplace(std::string(name), std::move(family)).first;
+		} else if (it->second.type != type) {
+			throw std::invalid_argument("MetricTypeMismatchError(MetricsRegistry)");
+		} else if (!std::ranges::equal(it->second.upperBounds, upperBounds)) {
+			throw std::invalid_argument("UpperBoundsMismatchError(MetricsRegistry)");
+		}
+		return it->second;
+	}
+
+	mutable std::mutex mutex_;
+	std::map<std::string, Family, std::less<>> families_;
+};
+
+} // namespace KaitoTokyo::Metrics
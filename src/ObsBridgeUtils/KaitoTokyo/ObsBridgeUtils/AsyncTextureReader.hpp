@@ -26,116 +26,140 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <memory>
 #include <mutex>
+#include <optional>
 #include <stdexcept>
+#include <utility>
 #include <vector>
 
+#include "GsResourcePool.hpp"
 #include "GsUnique.hpp"
 
 namespace KaitoTokyo {
 namespace ObsBridgeUtils {
 
 /**
- * @brief Internal implementation details for AsyncTextureReader.
- */
-namespace AsyncTextureReaderDetail {
-
-/**
- * @class ScopedStageSurfMap
- * @brief RAII helper for mapping and unmapping a gs_stagesurf_t.
+ * @class AsyncTextureReader
+ * @brief A ring of staging surfaces for reading GPU textures to the CPU without stalling.
  *
- * Ensures that a mapped staging surface is automatically unmapped
- * when this object goes out of scope.
+ * stage() copies a texture into the next free staging surface on the render thread. A surface
+ * becomes ready once a later frame has been rendered, which poll() (and stage() itself) detects from
+ * the video frame time, so mapping it does not wait for the GPU. tryLease() maps the newest ready
+ * surface and exposes its memory directly, with no copy, until the lease is released; the ring skips
+ * leased surfaces, so up to depth - 1 leases can be held while staging continues.
+ *
+ * sync() and getBuffer() remain for callers that want a copy in CPU memory. The buffer returned by
+ * getBuffer() is only stable until the sync() after next, which a lease does not have to worry about.
  */
-class ScopedStageSurfMap final {
-public:
-	/**
-	 * @brief Maps a staging surface for reading and automatically unmaps on destruction.
-	 *
-	 * @param surf Pointer to the staging surface to map.
-	 * @throws std::invalid_argument If surf is null.
-	 * @throws std::runtime_error If mapping fails or returns null data.
-	 */
-	explicit ScopedStageSurfMap(gs_stagesurf_t *surf)
-		: surf_{surf},
-		  mappedData_{[this]() {
-			  if (!surf_) {
-				  throw std::invalid_argument("Target surface cannot be null.");
-			  }
-
-			  MappedData mappedData;
-			  if (!gs_stagesurface_map(surf_, &mappedData.data, &mappedData.linesize)) {
-				  throw std::runtime_error("gs_stagesurface_map failed");
-			  }
-
-			  if (mappedData.data == nullptr) {
-				  throw std::runtime_error("gs_stagesurface_map returned null data");
-			  }
-
-			  return mappedData;
-		  }()}
-	{
-	}
-
+class AsyncTextureReader final {
+private:
 	/**
-	 * @brief Unmaps the staging surface on destruction.
+	 * @brief Lifecycle of a staging surface in the ring.
 	 */
-	~ScopedStageSurfMap() noexcept
-	{
-		if (surf_) {
-			gs_stagesurface_unmap(surf_);
-		}
-	}
-
-	ScopedStageSurfMap(const ScopedStageSurfMap &) = delete;
-	ScopedStageSurfMap &operator=(const ScopedStageSurfMap &) = delete;
-	ScopedStageSurfMap(ScopedStageSurfMap &&) = delete;
-	ScopedStageSurfMap &operator=(ScopedStageSurfMap &&) = delete;
+	enum class SlotState {
+		Empty,
+		Staged,
+		Ready,
+		Leased,
+	};
 
 	/**
-	 * @brief Returns a pointer to the mapped pixel data.
-	 * @return Pointer to the mapped data.
+	 * @brief A staging surface and what it currently holds.
 	 */
-	const std::uint8_t *getData() const noexcept { return mappedData_.data; }
+	struct Slot {
+		pooled_gs_stagesurf_t stagesurf;
+		SlotState state = SlotState::Empty;
+		// Video frame time when the copy was issued; the copy has finished once the frame time moves on.
+		std::uint64_t stagedFrameTime = 0;
+		// Increases with every stage() so the newest ready surface can be told apart.
+		std::uint64_t sequence = 0;
+	};
 
+public:
 	/**
-	 * @brief Returns the line size (stride) of the mapped surface.
-	 * @return Line size in bytes.
+	 * @class Lease
+	 * @brief Read access to a mapped staging surface, valid until the lease is destroyed.
+	 *
+	 * Mapping and unmapping enter the graphics context themselves, so a lease can be taken and
+	 * released on any thread. It must not outlive the AsyncTextureReader it came from.
 	 */
-	std::uint32_t getLinesize() const noexcept { return mappedData_.linesize; }
+	class Lease final {
+	public:
+		~Lease() noexcept { release(); }
+
+		Lease(const Lease &) = delete;
+		Lease &operator=(const Lease &) = delete;
+
+		Lease(Lease &&other) noexcept
+			: reader_(std::exchange(other.reader_, nullptr)),
+			  slotIndex_(other.slotIndex_),
+			  data_(other.data_),
+			  linesize_(other.linesize_)
+		{
+		}
 
-private:
-	/**
-	 * @brief Structure holding mapped data pointer and line size.
-	 */
-	struct MappedData {
-		std::uint8_t *data;
-		std::uint32_t linesize;
-	};
+		Lease &operator=(Lease &&other) noexcept
+		{
+			if (this != &other) {
+				release();
+				reader_ = std::exchange(other.reader_, nullptr);
+				slotIndex_ = other.slotIndex_;
+				data_ = other.data_;
+				linesize_ = other.linesize_;
+			}
+			return *this;
+		}
 
-	/**
-	 * @brief The staging surface being managed.
-	 */
-	gs_stagesurf_t *const surf_;
+		/**
+		 * @brief Returns a pointer to the mapped pixel data.
+		 * @return Pointer to the first row of the surface.
+		 */
+		const std::uint8_t *getData() const noexcept { return data_; }
+
+		/**
+		 * @brief Returns the line size (stride) of the mapped surface, which may exceed width * bpp.
+		 * @return Line size in bytes.
+		 */
+		std::uint32_t getLinesize() const noexcept { return linesize_; }
+
+		/**
+		 * @brief Returns the width of the mapped surface.
+		 * @return Width in pixels.
+		 */
+		std::uint32_t getWidth() const noexcept { return reader_->width_; }
+
+		/**
+		 * @brief Returns the height of the mapped surface.
+		 * @return Height in pixels.
+		 */
+		std::uint32_t getHeight() const noexcept { return reader_->height_; }
+
+	private:
+		friend class AsyncTextureReader;
+
+		Lease(AsyncTextureReader *reader, std::size_t slotIndex, const std::uint8_t *data,
+		      std::uint32_t linesize) noexcept
+			: reader_(reader),
+			  slotIndex_(slotIndex),
+			  data_(data),
+			  linesize_(linesize)
+		{
+		}
 
-	/**
-	 * @brief The mapped data from the surface.
-	 */
-	const MappedData mappedData_;
-};
+		void release() noexcept
+		{
+			if (reader_) {
+				std::exchange(reader_, nullptr)->unmapSlot(slotIndex_);
+			}
+		}
 
-} // namespace AsyncTextureReaderDetail
+		AsyncTextureReader *reader_;
+		std::size_t slotIndex_;
+		const std::uint8_t *data_;
+		std::uint32_t linesize_;
+	};
 
-/**
- * @class AsyncTextureReader
- * @brief A double-buffering pipeline for asynchronously reading GPU textures to the CPU.
- *
- * Efficiently copies GPU texture contents to CPU memory without blocking the render thread.
- * Provides thread-safe data access by calling stage() from a render/GPU thread
- * and sync()/getBuffer() from a CPU thread.
- */
-class AsyncTextureReader final {
-public:
 	/**
 	 * @brief Returns the number of bytes per pixel for a given color format.
 	 *
@@ -189,30 +213,49 @@ public:
 	 * @param width Width of the texture to read.
 	 * @param height Height of the texture to read.
 	 * @param format Color format of the texture.
+	 * @param depth Number of staging surfaces in the ring, at least 2.
+	 * @param pool Pool to take the staging surfaces from and return them to, or null to create them.
+	 * @throws std::invalid_argument If depth is less than 2.
 	 * @throws std::runtime_error If staging surfaces cannot be created.
 	 */
-	AsyncTextureReader(const std::uint32_t width, const std::uint32_t height, const gs_color_format format)
+	AsyncTextureReader(const std::uint32_t width, const std::uint32_t height, const gs_color_format format,
+			   const std::size_t depth = 2, const std::shared_ptr<GsStagesurfPool> &pool = nullptr)
 		: width_(width),
 		  height_(height),
 		  bufferLinesize_(width_ * getBytesPerPixel(format)),
 		  cpuBuffers_{std::vector<std::uint8_t>(static_cast<std::size_t>(height_) * bufferLinesize_),
 			      std::vector<std::uint8_t>(static_cast<std::size_t>(height_) * bufferLinesize_)},
-		  stagesurfs_{ObsBridgeUtils::make_unique_gs_stagesurf(width, height, format),
-			      ObsBridgeUtils::make_unique_gs_stagesurf(width, height, format)}
+		  slots_([&]() {
+			  if (depth < 2) {
+				  throw std::invalid_argument("InvalidDepthError(AsyncTextureReader)");
+			  }
+			  std::vector<Slot> slots(depth);
+			  for (Slot &slot : slots) {
+				  if (pool) {
+					  slot.stagesurf = pool->acquire(GsStagesurfKey{width, height, format});
+				  } else {
+					  slot.stagesurf = pooled_gs_stagesurf_t(
+						  make_unique_gs_stagesurf(width, height, format));
+				  }
+			  }
+			  return slots;
+		  }())
 	{
-		if (!stagesurfs_[0] || !stagesurfs_[1]) {
-			throw std::runtime_error("Failed to create staging surfaces");
-		}
 	}
 
 	/**
 	 * @brief Destroys the AsyncTextureReader and releases all allocated resources.
 	 *
-	 * Automatically cleans up the GPU staging surfaces (via unique_ptr)
-	 * and the CPU-side pixel buffers (via std::vector).
+	 * Returns the GPU staging surfaces to the pool or destroys them
+	 * and cleans up the CPU-side pixel buffers (via std::vector). All leases must have been released.
 	 */
 	~AsyncTextureReader() noexcept = default;
 
+	AsyncTextureReader(const AsyncTextureReader &) = delete;
+	AsyncTextureReader &operator=(const AsyncTextureReader &) = delete;
+	AsyncTextureReader(AsyncTextureReader &&) = delete;
+	AsyncTextureReader &operator=(AsyncTextureReader &&) = delete;
+
 	/**
 	 * @brief Schedules a GPU texture copy. Call from the render/GPU thread.
 	 *
@@ -223,6 +266,9 @@ public:
 	/**
 	 * @brief Schedules a GPU texture copy. Call from the render/GPU thread.
 	 *
+	 * The copy goes to the next surface in the ring that is not leased. When every other surface is
+	 * leased the frame is dropped.
+	 *
 	 * @param sourceTexture The source GPU texture to copy.
 	 */
 	void stage(gs_texture_t *sourceTexture) noexcept
@@ -231,47 +277,100 @@ public:
 			return;
 		}
 
-		std::scoped_lock lock(gpuMutex_);
-		gs_stage_texture(stagesurfs_[gpuWriteIndex_].get(), sourceTexture);
-		gpuWriteIndex_ = 1 - gpuWriteIndex_;
+		const std::uint64_t frameTime = obs_get_video_frame_time();
+
+		std::scoped_lock lock(mutex_);
+		markReady(frameTime);
+
+		for (std::size_t i = 0; i < slots_.size(); i++) {
+			const std::size_t index = (nextWriteIndex_ + i) % slots_.size();
+			Slot &slot = slots_[index];
+			if (slot.state == SlotState::Leased) {
+				continue;
+			}
+
+			gs_stage_texture(slot.stagesurf.get(), sourceTexture);
+			slot.state = SlotState::Staged;
+			slot.stagedFrameTime = frameTime;
+			slot.sequence = ++sequence_;
+			nextWriteIndex_ = (index + 1) % slots_.size();
+			return;
+		}
 	}
 
 	/**
-	 * @brief Synchronizes the latest texture data to the CPU buffer. Call from a CPU thread.
+	 * @brief Marks surfaces staged in earlier frames as ready. Call from the render/GPU thread.
 	 *
-	 * This operation may be expensive due to GPU-to-CPU data transfer.
-	 * @throws std::runtime_error If mapping the staging surface fails.
+	 * stage() does this already; callers that stop staging call it once per frame instead, so the last
+	 * staged surface becomes available to tryLease().
 	 */
-	void sync()
+	void poll() noexcept
 	{
-		using namespace AsyncTextureReaderDetail;
+		const std::uint64_t frameTime = obs_get_video_frame_time();
+		std::scoped_lock lock(mutex_);
+		markReady(frameTime);
+	}
 
-		std::size_t gpuReadIndex;
+	/**
+	 * @brief Maps the newest ready surface without copying it. Call from any thread.
+	 *
+	 * @return A lease on the mapped surface, or std::nullopt if no surface is ready yet.
+	 * @throws std::runtime_error If mapping the staging surface fails.
+	 */
+	[[nodiscard]]
+	std::optional<Lease> tryLease()
+	{
+		std::size_t index;
 		{
-			std::scoped_lock lock(gpuMutex_);
-			gpuReadIndex = 1 - gpuWriteIndex_;
+			std::scoped_lock lock(mutex_);
+			const auto newest = std::max_element(slots_.begin(), slots_.end(),
+							     [](const Slot &a, const Slot &b) {
+								     return readySequence(a) < readySequence(b);
+							     });
+			if (readySequence(*newest) == 0) {
+				return std::nullopt;
+			}
+			newest->state = SlotState::Leased;
+			index = static_cast<std::size_t>(newest - slots_.begin());
 		}
-		gs_stagesurf_t *const stagesurf = stagesurfs_[gpuReadIndex].get();
 
-		if (!stagesurf) {
-			return;
+		const GraphicsContextGuard graphicsContextGuard;
+		std::uint8_t *data = nullptr;
+		std::uint32_t linesize = 0;
+		if (!gs_stagesurface_map(slots_[index].stagesurf.get(), &data, &linesize) || data == nullptr) {
+			std::scoped_lock lock(mutex_);
+			slots_[index].state = SlotState::Ready;
+			throw std::runtime_error("gs_stagesurface_map failed");
 		}
+		return Lease(this, index, data, linesize);
+	}
 
-		const ScopedStageSurfMap mappedSurf(stagesurf);
+	/**
+	 * @brief Copies the newest ready surface to the CPU buffer. Call from a CPU thread.
+	 *
+	 * Does nothing if no surface is ready yet. This operation may be expensive due to the copy; use
+	 * tryLease() to read the mapped surface in place.
+	 * @throws std::runtime_error If mapping the staging surface fails.
+	 */
+	void sync()
+	{
+		const std::optional<Lease> lease = tryLease();
+		if (!lease) {
+			return;
+		}
 
 		const std::size_t backBufferIndex = 1 - activeCpuBufferIndex_.load(std::memory_order_acquire);
 
 		auto &backBuffer = cpuBuffers_[backBufferIndex];
 
-		if (bufferLinesize_ == mappedSurf.getLinesize()) {
-			std::memcpy(backBuffer.data(), mappedSurf.getData(),
+		if (bufferLinesize_ == lease->getLinesize()) {
+			std::memcpy(backBuffer.data(), lease->getData(),
 				    static_cast<std::size_t>(height_) * bufferLinesize_);
 		} else {
 			for (std::uint32_t y = 0; y < height_; y++) {
-				const std::uint8_t *srcRow = mappedSurf.getData() + (y * mappedSurf.getLinesize());
+				const std::uint8_t *srcRow = lease->getData() + (y * lease->getLinesize());
 				std::uint8_t *dstRow = backBuffer.data() + (y * bufferLinesize_);
-				std::size_t copyBytes =
-					std::min<std::size_t>(bufferLinesize_, mappedSurf.getLinesize());
+				std::size_t copyBytes = std::min<std::size_t>(bufferLinesize_, lease->getLinesize());
 				std::memcpy(dstRow, srcRow, copyBytes);
 			}
 		}
@@ -308,7 +407,44 @@ public:
 	 */
 	std::uint32_t getBufferLinesize() const noexcept { return bufferLinesize_; }
 
+	/**
+	 * @brief Returns the number of staging surfaces in the ring.
+	 * @return Ring depth.
+	 */
+	std::size_t getDepth() const noexcept { return slots_.size(); }
+
 private:
+	/**
+	 * @brief Returns the sequence of a ready slot, or 0 if it cannot be leased.
+	 */
+	static std::uint64_t readySequence(const Slot &slot) noexcept
+	{
+		return slot.state == SlotState::Ready ? slot.sequence : 0;
+	}
+
+	/**
+	 * @brief Promotes surfaces staged before frameTime to ready. Call with mutex_ held.
+	 */
+	void markReady(const std::uint64_t frameTime) noexcept
+	{
+		for (Slot &slot : slots_) {
+			if (slot.state == SlotState::Staged && slot.stagedFrameTime != frameTime) {
+				slot.state = SlotState::Ready;
+			}
+		}
+	}
+
+	/**
+	 * @brief Unmaps a leased surface and returns it to the ring, where it stays ready.
+	 */
+	void unmapSlot(const std::size_t index) noexcept
+	{
+		const GraphicsContextGuard graphicsContextGuard;
+		gs_stagesurface_unmap(slots_[index].stagesurf.get());
+		std::scoped_lock lock(mutex_);
+		slots_[index].state = SlotState::Ready;
+	}
+
 	/**
 	 * @brief Texture width in pixels.
 	 */
@@ -325,7 +461,7 @@ private:
 	const std::uint32_t bufferLinesize_;
 
 	/**
-	 * @brief Double-buffered CPU pixel data.
+	 * @brief Double-buffered CPU pixel data for sync().
 	 */
 	std::array<std::vector<std::uint8_t>, 2> cpuBuffers_;
 
@@ -335,19 +471,24 @@ private:
 	std::atomic<std::size_t> activeCpuBufferIndex_ = {0};
 
 	/**
-	 * @brief Double-buffered GPU staging surfaces.
+	 * @brief Ring of GPU staging surfaces.
+	 */
+	std::vector<Slot> slots_;
+
+	/**
+	 * @brief Index where stage() starts looking for a surface that is not leased.
 	 */
-	const std::array<ObsBridgeUtils::unique_gs_stagesurf_t, 2> stagesurfs_;
+	std::size_t nextWriteIndex_ = 0;
 
 	/**
-	 * @brief Index of the GPU write buffer.
+	 * @brief Sequence number given to the last staged surface.
 	 */
-	std::size_t gpuWriteIndex_ = 0;
+	std::uint64_t sequence_ = 0;
 
 	/**
-	 * @brief Mutex for synchronizing GPU buffer access.
+	 * @brief Mutex for synchronizing slot states between the render thread and readers.
 	 */
-	std::mutex gpuMutex_;
+	std::mutex mutex_;
 };
 
 } // namespace ObsBridgeUtils
@@ -0,0 +1,347 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * KaitoTokyo ObsBridgeUtils Library
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "GsUnique.hpp"
+
+namespace KaitoTokyo {
+namespace ObsBridgeUtils {
+
+/**
+ * @brief Pool key of a staging surface.
+ */
+struct GsStagesurfKey {
+	std::uint32_t width;
+	std::uint32_t height;
+	gs_color_format format;
+
+	bool operator<(const GsStagesurfKey &other) const noexcept
+	{
+		return std::tie(width, height, format) < std::tie(other.width, other.height, other.format);
+	}
+};
+
+/**
+ * @brief Pool key of a texture. Textures are created without initial data.
+ */
+struct GsTextureKey {
+	std::uint32_t width;
+	std::uint32_t height;
+	gs_color_format format;
+	std::uint32_t levels;
+	std::uint32_t flags;
+
+	bool operator<(const GsTextureKey &other) const noexcept
+	{
+		return std::tie(width, height, format, levels, flags) <
+		       std::tie(other.width, other.height, other.format, other.levels, other.flags);
+	}
+};
+
+/**
+ * @brief Creates the staging surface described by a pool key.
+ * @throws std::runtime_error If creation fails.
+ */
+[[nodiscard]]
+inline unique_gs_stagesurf_t makePooledGsResource(const GsStagesurfKey &key)
+{
+	return make_unique_gs_stagesurf(key.width, key.height, key.format);
+}
+
+/**
+ * @brief Creates the texture described by a pool key.
+ * @throws std::runtime_error If creation fails.
+ */
+[[nodiscard]]
+inline unique_gs_texture_t makePooledGsResource(const GsTextureKey &key)
+{
+	return make_unique_gs_texture(key.width, key.height, key.format, key.levels, nullptr, key.flags);
+}
+
+/**
+ * @brief Counters of a GsResourcePool, taken at one point in time.
+ */
+struct GsResourcePoolStats {
+	// Acquisitions served from the idle list.
+	std::size_t hits = 0;
+	// Acquisitions that created a new resource.
+	std::size_t misses = 0;
+	// Idle resources destroyed by evictIdle() or clear().
+	std::size_t evictions = 0;
+	// Resources waiting in the pool.
+	std::size_t idle = 0;
+	// Resources handed out and not yet returned.
+	std::size_t inUse = 0;
+};
+
+template<typename Key, typename UniquePtr> class GsResourcePool;
+
+/**
+ * @class GsPooledResource
+ * @brief Owns a GS resource and returns it to its pool on destruction.
+ *
+ * A handle built from a plain unique pointer has no pool and destroys the resource as usual, so code
+ * can take a pool optionally without two code paths.
+ */
+template<typename Key, typename UniquePtr> class GsPooledResource final {
+public:
+	using pointer = typename UniquePtr::pointer;
+
+	GsPooledResource() noexcept = default;
+
+	/**
+	 * @brief Adopts a resource that does not belong to any pool.
+	 */
+	explicit GsPooledResource(UniquePtr resource) noexcept : resource_(std::move(resource)) {}
+
+	~GsPooledResource() noexcept { reset(); }
+
+	GsPooledResource(const GsPooledResource &) = delete;
+	GsPooledResource &operator=(const GsPooledResource &) = delete;
+
+	GsPooledResource(GsPooledResource &&other) noexcept = default;
+
+	GsPooledResource &operator=(GsPooledResource &&other) noexcept
+	{
+		if (this != &other) {
+			reset();
+			resource_ = std::move(other.resource_);
+			key_ = other.key_;
+			pool_ = std::move(other.pool_);
+		}
+		return *this;
+	}
+
+	/**
+	 * @brief Returns the raw resource pointer.
+	 */
+	pointer get() const noexcept { return resource_.get(); }
+
+	explicit operator bool() const noexcept { return static_cast<bool>(resource_); }
+
+	/**
+	 * @brief Returns the resource to its pool now, or destroys it if there is no pool.
+	 */
+	void reset() noexcept
+	{
+		if (pool_ && resource_) {
+			pool_->giveBack(key_, std::move(resource_));
+		}
+		resource_.reset();
+		pool_.reset();
+	}
+
+private:
+	friend class GsResourcePool<Key, UniquePtr>;
+
+	GsPooledResource(UniquePtr resource, const Key &key,
+			 std::shared_ptr<GsResourcePool<Key, UniquePtr>> pool) noexcept
+		: resource_(std::move(resource)),
+		  key_(key),
+		  pool_(std::move(pool))
+	{
+	}
+
+	UniquePtr resource_;
+	Key key_{};
+	std::shared_ptr<GsResourcePool<Key, UniquePtr>> pool_;
+};
+
+/**
+ * @class GsResourcePool
+ * @brief A keyed pool of GS resources, so readers and render targets can be recycled.
+ *
+ * Creating staging surfaces and textures inside the graphics context is expensive and fragments VRAM,
+ * which shows when a reader is rebuilt on every resolution change. acquire() hands out an idle
+ * resource with the same key when there is one, and the handle returns it on destruction. Resources
+ * that stay idle longer than the age passed to evictIdle() are destroyed through the deferred deletion
+ * queue of GsUnique, so the pool can be used from any thread as long as the queue is drained on the
+ * render thread.
+ *
+ * Handles keep the pool alive, so it must be owned by a std::shared_ptr.
+ */
+template<typename Key, typename UniquePtr>
+class GsResourcePool final : public std::enable_shared_from_this<GsResourcePool<Key, UniquePtr>> {
+public:
+	using Handle = GsPooledResource<Key, UniquePtr>;
+	using Clock = std::chrono::steady_clock;
+
+	GsResourcePool() = default;
+
+	GsResourcePool(const GsResourcePool &) = delete;
+	GsResourcePool &operator=(const GsResourcePool &) = delete;
+	GsResourcePool(GsResourcePool &&) = delete;
+	GsResourcePool &operator=(GsResourcePool &&) = delete;
+
+	/**
+	 * @brief Hands out an idle resource with the given key or creates one.
+	 *
+	 * Call inside the graphics context, which creation needs.
+	 *
+	 * @param key Description of the resource.
+	 * @return A valid handle that returns the resource to this pool.
+	 * @throws std::runtime_error If a new resource cannot be created.
+	 */
+	[[nodiscard]]
+	Handle acquire(const Key &key)
+	{
+		{
+			std::scoped_lock lock(mutex_);
+			auto it = idle_.find(key);
+			if (it != idle_.end() && !it->second.empty()) {
+				// The most recently returned resource is the likeliest to be resident.
+				UniquePtr resource = std::move(it->second.back().resource);
+				it->second.pop_back();
+				stats_.hits++;
+				stats_.idle--;
+				stats_.inUse++;
+				return Handle(std::move(resource), key, this->shared_from_this());
+			}
+		}
+
+		UniquePtr resource = makePooledGsResource(key);
+		std::scoped_lock lock(mutex_);
+		stats_.misses++;
+		stats_.inUse++;
+		return Handle(std::move(resource), key, this->shared_from_this());
+	}
+
+	/**
+	 * @brief Destroys the resources that have been idle for longer than maxIdle.
+	 *
+	 * @param maxIdle How long a resource may wait in the pool.
+	 * @return Number of resources destroyed.
+	 */
+	std::size_t evictIdle(const Clock::duration maxIdle) noexcept
+	{
+		const Clock::time_point deadline = Clock::now() - maxIdle;
+		std::size_t evicted = 0;
+
+		std::scoped_lock lock(mutex_);
+		for (auto it = idle_.begin(); it != idle_.end();) {
+			auto &entries = it->second;
+			// Entries are appended as they come back, so the oldest are at the front.
+			std::size_t expired = 0;
+			while (expired < entries.size() && entries[expired].returnedAt < deadline) {
+				expired++;
+			}
+			entries.erase(entries.begin(), entries.begin() + static_cast<std::ptrdiff_t>(expired));
+			evicted += expired;
+			it = entries.empty() ? idle_.erase(it) : std::next(it);
+		}
+
+		stats_.evictions += evicted;
+		stats_.idle -= evicted;
+		return evicted;
+	}
+
+	/**
+	 * @brief Destroys every idle resource. Handed out resources still come back later.
+	 */
+	void clear() noexcept
+	{
+		std::scoped_lock lock(mutex_);
+		stats_.evictions += stats_.idle;
+		stats_.idle = 0;
+		idle_.clear();
+	}
+
+	/**
+	 * @brief Returns the current counters.
+	 */
+	GsResourcePoolStats getStats() const
+	{
+		std::scoped_lock lock(mutex_);
+		return stats_;
+	}
+
+private:
+	friend class GsPooledResource<Key, UniquePtr>;
+
+	/**
+	 * @brief An idle resource and when it came back.
+	 */
+	struct IdleEntry {
+		UniquePtr resource;
+		Clock::time_point returnedAt;
+	};
+
+	void giveBack(const Key &key, UniquePtr resource) noexcept
+	{
+		std::scoped_lock lock(mutex_);
+		try {
+			idle_[key].push_back(IdleEntry{std::move(resource), Clock::now()});
+			stats_.idle++;
+		} catch (...) {
+			// Out of memory for the bookkeeping: the resource is destroyed instead of pooled.
+			stats_.evictions++;
+		}
+		stats_.inUse--;
+	}
+
+	/**
+	 * @brief Mutex protecting idle_ and stats_.
+	 */
+	mutable std::mutex mutex_;
+
+	/**
+	 * @brief Idle resources by key, oldest first.
+	 */
+	std::map<Key, std::vector<IdleEntry>> idle_;
+
+	/**
+	 * @brief Counters reported by getStats().
+	 */
+	GsResourcePoolStats stats_;
+};
+
+/**
+ * @brief A pool of staging surfaces.
+ */
+using GsStagesurfPool = GsResourcePool<GsStagesurfKey, unique_gs_stagesurf_t>;
+
+/**
+ * @brief A staging surface that returns to a GsStagesurfPool, or is destroyed if it has none.
+ */
+using pooled_gs_stagesurf_t = GsPooledResource<GsStagesurfKey, unique_gs_stagesurf_t>;
+
+/**
+ * @brief A pool of textures.
+ */
+using GsTexturePool = GsResourcePool<GsTextureKey, unique_gs_texture_t>;
+
+/**
+ * @brief A texture that returns to a GsTexturePool, or is destroyed if it has none.
+ */
+using pooled_gs_texture_t = GsPooledResource<GsTextureKey, unique_gs_texture_t>;
+
+} // namespace ObsBridgeUtils
+} // namespace KaitoTokyo
@@ -145,6 +145,18 @@ struct GsStagesurfDeleter {
 	}
 };
 
+/**
+ * @brief Custom deleter for unique_gs_texrender_t.
+ * Schedules the gs_texrender_t for deferred deletion.
+ */
+struct GsTexrenderDeleter {
+	void operator()(gs_texrender_t *texrender) const noexcept
+	{
+		scheduleResourceToDelete(texrender,
+					 [](void *p) { gs_texrender_destroy(static_cast<gs_texrender_t *>(p)); });
+	}
+};
+
 } // namespace GsUnique
 
 /**
@@ -162,6 +174,11 @@ using unique_gs_texture_t = std::unique_ptr<gs_texture_t, GsUnique::GsTextureDel
  */
 using unique_gs_stagesurf_t = std::unique_ptr<gs_stagesurf_t, GsUnique::GsStagesurfDeleter>;
 
+/**
+ * @brief A std::unique_ptr for a gs_texrender_t that uses deferred deletion.
+ */
+using unique_gs_texrender_t = std::unique_ptr<gs_texrender_t, GsUnique::GsTexrenderDeleter>;
+
 /**
  * @class GraphicsContextGuard
  * @brief An RAII helper to ensure obs_enter_graphics() and obs_leave_graphics()
@@ -257,5 +274,25 @@ inline unique_gs_stagesurf_t make_unique_gs_stagesurf(std::uint32_t width, std::
 	return unique_gs_stagesurf_t(rawSurface);
 }
 
+/**
+ * @brief Factory function to create a unique_gs_texrender_t (render target).
+ *
+ * @param color_format Color format of the render target.
+ * @param zstencil_format Depth-stencil format, GS_ZS_NONE for 2D drawing.
+ * @return A valid (non-null) unique_gs_texrender_t managing the created render target.
+ * @throws std::runtime_error If render target creation fails.
+ * This function throws on failure and **never returns an empty (null) pointer.**
+ */
+[[nodiscard]]
+inline unique_gs_texrender_t make_unique_gs_texrender(enum gs_color_format color_format,
+						      enum gs_zstencil_format zstencil_format = GS_ZS_NONE)
+{
+	gs_texrender_t *rawTexrender = gs_texrender_create(color_format, zstencil_format);
+	if (!rawTexrender) {
+		throw std::runtime_error("gs_texrender_create failed");
+	}
+	return unique_gs_texrender_t(rawTexrender);
+}
+
 } // namespace ObsBridgeUtils
 } // namespace KaitoTokyo
@@ -41,6 +41,7 @@ public:
 
 protected:
 	void log(Logger::LogLevel level, std::string_view name, std::source_location loc,
+		 std::span<const Logger::LogField> bound,
 		 std::span<const Logger::LogField> context) const noexcept override
 	{
 		int blogLevel;
@@ -67,6 +68,9 @@ protected:
 			fmt::basic_memory_buffer<char, 4096> buffer;
 
 			fmt::format_to(std::back_inserter(buffer), "{} name={}", prefix_, name);
+			for (const Logger::LogField &field : bound) {
+				fmt::format_to(std::back_inserter(buffer), "\t{}={}", field.key, field.value);
+			}
 			for (const Logger::LogField &field : context) {
 				fmt::format_to(std::back_inserter(buffer), "\t{}={}", field.key, field.value);
 			}
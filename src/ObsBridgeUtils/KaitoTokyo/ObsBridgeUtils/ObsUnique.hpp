@@ -83,6 +83,38 @@ struct ObsDataArrayDeleter {
 	}
 };
 
+/**
+ * @brief Deleter for std::unique_ptr that calls obs_output_release()
+ * on an obs_output_t pointer.
+ */
+struct ObsOutputDeleter {
+	/**
+	 * @brief Releases the obs_output_t object.
+	 * @param output Pointer to the OBS output object.
+	 */
+	void operator()(obs_output_t *output) const noexcept
+	{
+		// obs_output_release is a C function, safe to assume it doesn't throw.
+		obs_output_release(output);
+	}
+};
+
+/**
+ * @brief Deleter for std::unique_ptr that calls obs_service_release()
+ * on an obs_service_t pointer.
+ */
+struct ObsServiceDeleter {
+	/**
+	 * @brief Releases the obs_service_t object.
+	 * @param service Pointer to the OBS service object.
+	 */
+	void operator()(obs_service_t *service) const noexcept
+	{
+		// obs_service_release is a C function, safe to assume it doesn't throw.
+		obs_service_release(service);
+	}
+};
+
 } // namespace ObsUnique
 
 /**
@@ -100,6 +132,16 @@ using unique_obs_data_t = std::unique_ptr<obs_data_t, ObsUnique::ObsDataDeleter>
  */
 using unique_obs_data_array_t = std::unique_ptr<obs_data_array_t, ObsUnique::ObsDataArrayDeleter>;
 
+/**
+ * @brief A std::unique_ptr for an obs_output_t object.
+ */
+using unique_obs_output_t = std::unique_ptr<obs_output_t, ObsUnique::ObsOutputDeleter>;
+
+/**
+ * @brief A std::unique_ptr for an obs_service_t object.
+ */
+using unique_obs_service_t = std::unique_ptr<obs_service_t, ObsUnique::ObsServiceDeleter>;
+
 /**
  * @brief Factory function to create a unique_bfree_char_t for a module file path.
  * Wraps obs_module_file.
@@ -0,0 +1,150 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * KaitoTokyo ObsBridgeUtils Library
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <stdexcept>
+
+#include <obs.h>
+#include <graphics/vec2.h>
+#include <graphics/vec4.h>
+
+#include "GsUnique.hpp"
+
+namespace KaitoTokyo {
+namespace ObsBridgeUtils {
+
+/**
+ * @class TextureDownscaler
+ * @brief Draws a texture into a smaller render target on the GPU, so only the reduced image is read back.
+ *
+ * Put in front of AsyncTextureReader::stage(): a 4K BGRA frame is 33 MB per readback, the same frame
+ * drawn at 720p is 3.7 MB. The render target also converts the pixels to its own format, so float
+ * canvases can be read back as 8-bit BGRA; values outside [0, 1] are clipped, not tone mapped.
+ *
+ * Reductions of more than 2x use OBS's low-resolution bilinear effect, which samples enough texels
+ * to average the whole footprint of a target pixel. Call everything from the render thread.
+ */
+class TextureDownscaler final {
+public:
+	/**
+	 * @brief Creates the render target. Call inside the graphics context.
+	 *
+	 * @param format Color format of the downscaled texture.
+	 * @throws std::runtime_error If the render target cannot be created.
+	 */
+	explicit TextureDownscaler(gs_color_format format = GS_BGRA)
+		: format_(format),
+		  texrender_(make_unique_gs_texrender(format))
+	{
+	}
+
+	~TextureDownscaler() noexcept = default;
+
+	TextureDownscaler(const TextureDownscaler &) = delete;
+	TextureDownscaler &operator=(const TextureDownscaler &) = delete;
+	TextureDownscaler(TextureDownscaler &&) = delete;
+	TextureDownscaler &operator=(TextureDownscaler &&) = delete;
+
+	/**
+	 * @brief Draws sourceTexture scaled to width x height. Call from the render thread.
+	 *
+	 * @param sourceTexture The texture to downscale.
+	 * @param width Width of the downscaled texture.
+	 * @param height Height of the downscaled texture.
+	 * @return The downscaled texture, owned by this object and valid until the next call.
+	 * @throws std::invalid_argument If sourceTexture is null or the size is zero.
+	 * @throws std::runtime_error If the render target cannot be bound or no effect is available.
+	 */
+	gs_texture_t *render(gs_texture_t *sourceTexture, const std::uint32_t width, const std::uint32_t height)
+	{
+		if (!sourceTexture) {
+			throw std::invalid_argument("SourceTextureIsNullError(TextureDownscaler::render)");
+		}
+		if (width == 0 || height == 0) {
+			throw std::invalid_argument("InvalidSizeError(TextureDownscaler::render)");
+		}
+
+		const std::uint32_t sourceWidth = gs_texture_get_width(sourceTexture);
+		const std::uint32_t sourceHeight = gs_texture_get_height(sourceTexture);
+		const bool lowres = sourceWidth > 2 * width || sourceHeight > 2 * height;
+		gs_effect_t *effect = obs_get_base_effect(lowres ? OBS_EFFECT_BILINEAR_LOWRES : OBS_EFFECT_DEFAULT);
+		if (!effect) {
+			throw std::runtime_error("EffectUnavailableError(TextureDownscaler::render)");
+		}
+
+		gs_texrender_reset(texrender_.get());
+		if (!gs_texrender_begin(texrender_.get(), width, height)) {
+			throw std::runtime_error("TexrenderBeginError(TextureDownscaler::render)");
+		}
+
+		struct vec4 clearColor;
+		vec4_zero(&clearColor);
+		gs_clear(GS_CLEAR_COLOR, &clearColor, 0.0f, 0);
+		// The sprite is drawn at the source size, so the projection maps it onto the whole target.
+		gs_ortho(0.0f, static_cast<float>(sourceWidth), 0.0f, static_cast<float>(sourceHeight), -100.0f,
+			 100.0f);
+
+		if (gs_eparam_t *baseDimension = gs_effect_get_param_by_name(effect, "base_dimension")) {
+			struct vec2 dimension;
+			vec2_set(&dimension, static_cast<float>(sourceWidth), static_cast<float>(sourceHeight));
+			gs_effect_set_vec2(baseDimension, &dimension);
+		}
+		if (gs_eparam_t *baseDimensionInverse = gs_effect_get_param_by_name(effect, "base_dimension_i")) {
+			struct vec2 dimensionInverse;
+			vec2_set(&dimensionInverse, 1.0f / static_cast<float>(sourceWidth),
+				 1.0f / static_cast<float>(sourceHeight));
+			gs_effect_set_vec2(baseDimensionInverse, &dimensionInverse);
+		}
+		gs_effect_set_texture(gs_effect_get_param_by_name(effect, "image"), sourceTexture);
+
+		// Alpha is copied as is rather than blended over the cleared target.
+		gs_blend_state_push();
+		gs_blend_function(GS_BLEND_ONE, GS_BLEND_ZERO);
+		while (gs_effect_loop(effect, "Draw")) {
+			gs_draw_sprite(sourceTexture, 0, sourceWidth, sourceHeight);
+		}
+		gs_blend_state_pop();
+
+		gs_texrender_end(texrender_.get());
+		return gs_texrender_get_texture(texrender_.get());
+	}
+
+	/**
+	 * @brief Returns the color format of the downscaled texture.
+	 * @return Render target color format.
+	 */
+	gs_color_format getFormat() const noexcept { return format_; }
+
+private:
+	/**
+	 * @brief Color format of the render target.
+	 */
+	const gs_color_format format_;
+
+	/**
+	 * @brief Render target, resized by gs_texrender_begin() when the size changes.
+	 */
+	const unique_gs_texrender_t texrender_;
+};
+
+} // namespace ObsBridgeUtils
+} // namespace KaitoTokyo
@@ -27,30 +27,100 @@
 
 #include <cassert>
 #include <cctype>
-#include <fstream>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <optional>
+#include <span>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <fmt/format.h>
-#include <fmt/ranges.h>
 #include <nlohmann/json.hpp>
 
-#include <KaitoTokyo/CurlHelper/CurlReadCallback.hpp>
+#include <KaitoTokyo/CurlHelper/CurlHeaderCallback.hpp>
 #include <KaitoTokyo/CurlHelper/CurlSlistHandle.hpp>
-#include <KaitoTokyo/CurlHelper/CurlUrlHandle.hpp>
-#include <KaitoTokyo/CurlHelper/CurlUrlSearchParams.hpp>
+#include <KaitoTokyo/CurlHelper/CurlTransferAwaiter.hpp>
 #include <KaitoTokyo/CurlHelper/CurlWriteCallback.hpp>
+#include <KaitoTokyo/CurlHelper/CurlXferInfoCallback.hpp>
 #include <KaitoTokyo/Logger/ILogger.hpp>
 #include <KaitoTokyo/Logger/NullLogger.hpp>
+#include <KaitoTokyo/Metrics/MetricsRegistry.hpp>
+
+#include "YouTubeListPageDecoder.hpp"
+#include "YouTubeRequestBuilder.hpp"
 
 namespace KaitoTokyo::YouTubeApi {
 
 namespace {
 
-std::vector<char> doGet(CURL *curl, const char *url, std::shared_ptr<const Logger::ILogger> logger,
-			curl_slist *headers = nullptr)
+// Aborts the transfer once shouldAbort returns true; an empty shouldAbort never aborts.
+void setAbortPredicate(CURL *curl, const std::function<bool()> &shouldAbort)
+{
+	if (!shouldAbort) {
+		return;
+	}
+	curl_easy_setopt(curl, CURLOPT_XFERINFOFUNCTION, CurlHelper::CurlAbortPredicateXferInfoCallback);
+	curl_easy_setopt(curl, CURLOPT_XFERINFODATA, &shouldAbort);
+	curl_easy_setopt(curl, CURLOPT_NOPROGRESS, 0L);
+}
+
+// Failures that may go away when the request is sent again are thrown as YouTubeRetryableError.
+[[noreturn]] void throwCurlPerformError(CURLcode res, const char *message)
+{
+	switch (res) {
+	case CURLE_COULDNT_RESOLVE_PROXY:
+	case CURLE_COULDNT_RESOLVE_HOST:
+	case CURLE_COULDNT_CONNECT:
+	case CURLE_SSL_CONNECT_ERROR:
+		throw YouTubeRetryableError(message, YouTubeRequestFailure::NotSent);
+	case CURLE_OPERATION_TIMEDOUT:
+	case CURLE_SEND_ERROR:
+	case CURLE_RECV_ERROR:
+	case CURLE_GOT_NOTHING:
+	case CURLE_PARTIAL_FILE:
+	case CURLE_HTTP2:
+	case CURLE_HTTP2_STREAM:
+		throw YouTubeRetryableError(message, YouTubeRequestFailure::Interrupted);
+	default:
+		throw std::runtime_error(message);
+	}
+}
+
+// Other error responses are left to the caller, which reports the error object in the body.
+void throwIfRetryableStatus(long responseCode, const std::vector<char> &responseBody,
+			    const std::shared_ptr<const Logger::ILogger> &logger, const char *message)
+{
+	std::optional<YouTubeRequestFailure> failure;
+	if (responseCode == 429) {
+		failure = YouTubeRequestFailure::Throttled;
+	} else if (responseCode == 403) {
+		// YouTube reports short-term rate limits as 403 with these reasons, unlike quotaExceeded.
+		const std::string_view body(responseBody.data(), responseBody.size());
+		if (body.find("\"rateLimitExceeded\"") != std::string_view::npos ||
+		    body.find("\"userRateLimitExceeded\"") != std::string_view::npos) {
+			failure = YouTubeRequestFailure::Throttled;
+		}
+	} else if (responseCode == 500 || responseCode == 502 || responseCode == 503 || responseCode == 504) {
+		failure = YouTubeRequestFailure::ServerError;
+	}
+
+	if (failure) {
+		logger->warn("YouTubeApiRetryableStatus", {{"responseCode", std::to_string(responseCode)}});
+		throw YouTubeRetryableError(message, *failure);
+	}
+}
+
+// The do* helpers write the response body into readBuffer, which callers usually take from their lease so that
+// its capacity is reused across requests, and return the response code. Transfers go through the transfer tape
+// of the handle's pool, so the response code must not be read from the handle.
+Async::Task<long> doGet(CURL *curl, CurlHelper::CurlMultiExecutor *curlExecutor, std::vector<char> &readBuffer,
+			const char *url, const std::function<bool()> &shouldAbort,
+			std::shared_ptr<const Logger::ILogger> logger, curl_slist *headers = nullptr)
 {
 	if (!logger) {
 		logger = Logger::NullLogger::instance();
@@ -64,33 +134,43 @@ std::vector<char> doGet(CURL *curl, const char *url, std::shared_ptr<const Logge
 		throw std::invalid_argument("UrlIsNullError(YouTubeApiClient::doGet)");
 	}
 
-	std::vector<char> readBuffer;
-
-	curl_easy_reset(curl);
+	readBuffer.clear();
 
-	curl_easy_setopt(curl, CURLOPT_URL, url);
-	curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
+	const CurlHelper::CurlTransfer transfer{
+		.url = url,
+		.headers = headers,
+		.writeFunction = CurlHelper::CurlCharVectorWriteCallback,
+		.writeData = &readBuffer,
+		.headerFunction = CurlHelper::CurlContentLengthReserveHeaderCallback,
+		.headerData = &readBuffer,
+	};
 	curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 2L);
 
-	curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, CurlHelper::CurlCharVectorWriteCallback);
-	curl_easy_setopt(curl, CURLOPT_WRITEDATA, &readBuffer);
-
 	curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, 10L);
 	curl_easy_setopt(curl, CURLOPT_TIMEOUT, 60L);
 	curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+	setAbortPredicate(curl, shouldAbort);
 
-	CURLcode res = curl_easy_perform(curl);
+	const CurlHelper::CurlTransferResult res =
+		co_await CurlHelper::CurlTransferAwaiter(curlExecutor, curl, transfer);
+
+	if (res.code == CURLE_ABORTED_BY_CALLBACK) {
+		logger->warn("CurlPerformAborted");
+		throw std::runtime_error("CurlPerformAborted(YouTubeApiClient::doGet)");
+	}
 
-	if (res != CURLE_OK) {
-		logger->error("CurlPerformError", {{"error", curl_easy_strerror(res)}});
-		throw std::runtime_error("CurlPerformError(YouTubeApiClient::doGet)");
+	if (res.code != CURLE_OK) {
+		logger->error("CurlPerformError", {{"error", curl_easy_strerror(res.code)}});
+		throwCurlPerformError(res.code, "CurlPerformError(YouTubeApiClient::doGet)");
 	}
 
-	return readBuffer;
+	throwIfRetryableStatus(res.responseCode, readBuffer, logger, "RetryableStatusError(YouTubeApiClient::doGet)");
+	co_return res.responseCode;
 }
 
-std::vector<char> doPost(CURL *curl, const char *url, std::shared_ptr<const Logger::ILogger> logger,
-			 curl_slist *headers = nullptr)
+Async::Task<long> doPost(CURL *curl, CurlHelper::CurlMultiExecutor *curlExecutor, std::vector<char> &readBuffer,
+			 const char *url, const std::function<bool()> &shouldAbort,
+			 std::shared_ptr<const Logger::ILogger> logger, curl_slist *headers = nullptr)
 {
 	if (!logger) {
 		logger = Logger::NullLogger::instance();
@@ -104,35 +184,45 @@ std::vector<char> doPost(CURL *curl, const char *url, std::shared_ptr<const Logg
 		throw std::invalid_argument("UrlIsNullError(YouTubeApiClient::doPost)");
 	}
 
-	std::vector<char> readBuffer;
+	readBuffer.clear();
 
-	curl_easy_reset(curl);
-
-	curl_easy_setopt(curl, CURLOPT_URL, url);
-	curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
-	curl_easy_setopt(curl, CURLOPT_POST, 1L);
-	curl_easy_setopt(curl, CURLOPT_POSTFIELDS, "");
-	curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, 0L);
-
-	curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, CurlHelper::CurlCharVectorWriteCallback);
-	curl_easy_setopt(curl, CURLOPT_WRITEDATA, &readBuffer);
+	const CurlHelper::CurlTransfer transfer{
+		.method = "POST",
+		.url = url,
+		.headers = headers,
+		.writeFunction = CurlHelper::CurlCharVectorWriteCallback,
+		.writeData = &readBuffer,
+		.headerFunction = CurlHelper::CurlContentLengthReserveHeaderCallback,
+		.headerData = &readBuffer,
+	};
 
 	curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, 10L);
 	curl_easy_setopt(curl, CURLOPT_TIMEOUT, 60L);
 	curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+	setAbortPredicate(curl, shouldAbort);
 
-	CURLcode res = curl_easy_perform(curl);
+	const CurlHelper::CurlTransferResult res =
+		co_await CurlHelper::CurlTransferAwaiter(curlExecutor, curl, transfer);
 
-	if (res != CURLE_OK) {
-		logger->error("CurlPerformError", {{"error", curl_easy_strerror(res)}});
-		throw std::runtime_error("CurlPerformError(YouTubeApiClient::doPost)");
+	if (res.code == CURLE_ABORTED_BY_CALLBACK) {
+		logger->warn("CurlPerformAborted");
+		throw std::runtime_error("CurlPerformAborted(YouTubeApiClient::doPost)");
 	}
 
-	return readBuffer;
+	if (res.code != CURLE_OK) {
+		logger->error("CurlPerformError", {{"error", curl_easy_strerror(res.code)}});
+		throwCurlPerformError(res.code, "CurlPerformError(YouTubeApiClient::doPost)");
+	}
+
+	throwIfRetryableStatus(res.responseCode, readBuffer, logger, "RetryableStatusError(YouTubeApiClient::doPost)");
+	co_return res.responseCode;
 }
 
-std::vector<char> doPostWithString(CURL *curl, const char *url, std::string_view body,
-				   std::shared_ptr<const Logger::ILogger> logger, curl_slist *headers = nullptr)
+Async::Task<long> doPostWithString(CURL *curl, CurlHelper::CurlMultiExecutor *curlExecutor,
+				   std::vector<char> &readBuffer, const char *url, std::string_view body,
+				   const std::function<bool()> &shouldAbort,
+				   std::shared_ptr<const Logger::ILogger> logger,
+				   curl_slist *headers = nullptr)
 {
 	if (!logger) {
 		logger = Logger::NullLogger::instance();
@@ -150,168 +240,544 @@ std::vector<char> doPostWithString(CURL *curl, const char *url, std::string_view
 		throw std::invalid_argument("BodyIsEmptyError(YouTubeApiClient::doPostWithString)");
 	}
 
-	std::vector<char> readBuffer;
-
-	curl_easy_reset(curl);
+	readBuffer.clear();
 
-	curl_easy_setopt(curl, CURLOPT_URL, url);
-	curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
-	curl_easy_setopt(curl, CURLOPT_POST, 1L);
-	curl_easy_setopt(curl, CURLOPT_POSTFIELDS, body.data());
-	curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, static_cast<long>(body.size()));
-
-	curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, CurlHelper::CurlCharVectorWriteCallback);
-	curl_easy_setopt(curl, CURLOPT_WRITEDATA, &readBuffer);
+	const CurlHelper::CurlTransfer transfer{
+		.method = "POST",
+		.url = url,
+		.headers = headers,
+		.body = body,
+		.writeFunction = CurlHelper::CurlCharVectorWriteCallback,
+		.writeData = &readBuffer,
+		.headerFunction = CurlHelper::CurlContentLengthReserveHeaderCallback,
+		.headerData = &readBuffer,
+	};
 
 	curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, 10L);
 	curl_easy_setopt(curl, CURLOPT_TIMEOUT, 60L);
 	curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+	setAbortPredicate(curl, shouldAbort);
+
+	const CurlHelper::CurlTransferResult res =
+		co_await CurlHelper::CurlTransferAwaiter(curlExecutor, curl, transfer);
 
-	CURLcode res = curl_easy_perform(curl);
+	if (res.code == CURLE_ABORTED_BY_CALLBACK) {
+		logger->warn("CurlPerformAborted");
+		throw std::runtime_error("CurlPerformAborted(YouTubeApiClient::doPostWithString)");
+	}
 
-	if (res != CURLE_OK) {
-		logger->error("CurlPerformError", {{"error", curl_easy_strerror(res)}});
-		throw std::runtime_error("CurlPerformError(YouTubeApiClient::doPostWithString)");
+	if (res.code != CURLE_OK) {
+		logger->error("CurlPerformError", {{"error", curl_easy_strerror(res.code)}});
+		throwCurlPerformError(res.code, "CurlPerformError(YouTubeApiClient::doPostWithString)");
 	}
 
-	return readBuffer;
+	throwIfRetryableStatus(res.responseCode, readBuffer, logger,
+			       "RetryableStatusError(YouTubeApiClient::doPostWithString)");
+	co_return res.responseCode;
 }
 
-std::vector<char> doPostWithIfstream(CURL *curl, const char *url, std::ifstream &ifs, std::uintmax_t ifsSize,
-				     std::shared_ptr<const Logger::ILogger> logger, curl_slist *headers = nullptr)
+Async::Task<long> doPutWithString(CURL *curl, CurlHelper::CurlMultiExecutor *curlExecutor,
+				  std::vector<char> &readBuffer, const char *url, std::string_view body,
+				  const std::function<bool()> &shouldAbort,
+				  std::shared_ptr<const Logger::ILogger> logger, curl_slist *headers = nullptr)
 {
 	if (!logger) {
 		logger = Logger::NullLogger::instance();
 	}
+
 	if (!curl) {
 		logger->error("CurlIsNullError");
-		throw std::invalid_argument("CurlIsNullError(YouTubeApiClient::doPostWithIfstream)");
+		throw std::invalid_argument("CurlIsNullError(YouTubeApiClient::doPutWithString)");
 	}
 	if (!url) {
 		logger->error("UrlIsNullError");
-		throw std::invalid_argument("UrlIsNullError(YouTubeApiClient::doPostWithIfstream)");
+		throw std::invalid_argument("UrlIsNullError(YouTubeApiClient::doPutWithString)");
+	}
+	if (body.empty()) {
+		logger->error("BodyIsEmptyError");
+		throw std::invalid_argument("BodyIsEmptyError(YouTubeApiClient::doPutWithString)");
+	}
+
+	readBuffer.clear();
+
+	const CurlHelper::CurlTransfer transfer{
+		.method = "PUT",
+		.url = url,
+		.headers = headers,
+		.body = body,
+		.writeFunction = CurlHelper::CurlCharVectorWriteCallback,
+		.writeData = &readBuffer,
+		.headerFunction = CurlHelper::CurlContentLengthReserveHeaderCallback,
+		.headerData = &readBuffer,
+	};
+
+	curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, 10L);
+	curl_easy_setopt(curl, CURLOPT_TIMEOUT, 60L);
+	curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+	setAbortPredicate(curl, shouldAbort);
+
+	const CurlHelper::CurlTransferResult res =
+		co_await CurlHelper::CurlTransferAwaiter(curlExecutor, curl, transfer);
+
+	if (res.code == CURLE_ABORTED_BY_CALLBACK) {
+		logger->warn("CurlPerformAborted");
+		throw std::runtime_error("CurlPerformAborted(YouTubeApiClient::doPutWithString)");
 	}
-	if (!ifs.is_open()) {
-		logger->error("IfstreamIsNotOpenError");
-		throw std::invalid_argument("IfstreamIsNotOpenError(YouTubeApiClient::doPostWithIfstream)");
+
+	if (res.code != CURLE_OK) {
+		logger->error("CurlPerformError", {{"error", curl_easy_strerror(res.code)}});
+		throwCurlPerformError(res.code, "CurlPerformError(YouTubeApiClient::doPutWithString)");
 	}
-	if (ifsSize == 0) {
-		logger->error("IfstreamSizeIsZeroError");
-		throw std::invalid_argument("IfstreamSizeIsZeroError(YouTubeApiClient::doPostWithIfstream)");
+
+	throwIfRetryableStatus(res.responseCode, readBuffer, logger,
+			       "RetryableStatusError(YouTubeApiClient::doPutWithString)");
+	co_return res.responseCode;
+}
+
+// Response headers that drive the resumable upload protocol.
+struct ResumableUploadResponseHeaders {
+	std::vector<char> *readBuffer;
+	// The session URI returned when the upload is started.
+	std::string location;
+	// The last byte YouTube has stored, from the Range header of a 308 response.
+	std::optional<std::uint64_t> lastStoredByte;
+};
+
+std::size_t ResumableUploadHeaderCallback(char *buffer, std::size_t size, std::size_t nitems, void *userp) noexcept
+{
+	constexpr std::string_view kLocation = "location:";
+	constexpr std::string_view kRange = "range:";
+
+	auto *headers = static_cast<ResumableUploadResponseHeaders *>(userp);
+	const std::size_t totalSize =
+		CurlHelper::CurlContentLengthReserveHeaderCallback(buffer, size, nitems, headers->readBuffer);
+
+	std::string_view header(buffer, totalSize);
+	while (!header.empty() && (header.back() == '\r' || header.back() == '\n')) {
+		header.remove_suffix(1);
 	}
 
-	std::vector<char> readBuffer;
+	const auto valueAfter = [&](std::string_view name) {
+		std::string_view value = header.substr(name.size());
+		value.remove_prefix(std::min(value.find_first_not_of(" \t"), value.size()));
+		return value;
+	};
+
+	if (CurlHelper::CurlHeaderCallbackDetail::startsWithIgnoringAsciiCase(header, kLocation)) {
+		try {
+			headers->location = valueAfter(kLocation);
+		} catch (...) {
+			return 0;
+		}
+	} else if (CurlHelper::CurlHeaderCallbackDetail::startsWithIgnoringAsciiCase(header, kRange)) {
+		// The stored range always starts at zero: "bytes=0-<last>".
+		const std::string_view value = valueAfter(kRange);
+		const std::size_t dash = value.find('-');
+		std::uint64_t lastStoredByte = 0;
+		if (dash != std::string_view::npos) {
+			const auto [end, ec] =
+				std::from_chars(value.data() + dash + 1, value.data() + value.size(), lastStoredByte);
+			if (ec == std::errc() && end != value.data() + dash + 1) {
+				headers->lastStoredByte = lastStoredByte;
+			}
+		}
+	}
 
-	curl_easy_reset(curl);
+	return totalSize;
+}
 
-	curl_easy_setopt(curl, CURLOPT_URL, url);
-	curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
-	curl_easy_setopt(curl, CURLOPT_POST, 1L);
-	curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, static_cast<long>(ifsSize));
+// Opens a resumable upload session for contentLength bytes of contentType. sessionUrl is left empty when
+// YouTube does not return one; readBuffer then holds the error response.
+Async::Task<long> doStartResumableUpload(CURL *curl, CurlHelper::CurlMultiExecutor *curlExecutor,
+					 std::vector<char> &readBuffer, std::string &sessionUrl, const char *url,
+					 std::size_t contentLength, std::string_view contentType,
+					 const std::function<bool()> &shouldAbort,
+					 std::shared_ptr<const Logger::ILogger> logger, curl_slist *headers = nullptr)
+{
+	if (!logger) {
+		logger = Logger::NullLogger::instance();
+	}
+	if (!curl) {
+		logger->error("CurlIsNullError");
+		throw std::invalid_argument("CurlIsNullError(YouTubeApiClient::doStartResumableUpload)");
+	}
+	if (!url) {
+		logger->error("UrlIsNullError");
+		throw std::invalid_argument("UrlIsNullError(YouTubeApiClient::doStartResumableUpload)");
+	}
 
-	curl_easy_setopt(curl, CURLOPT_READFUNCTION, CurlHelper::CurlIfstreamReadCallback);
-	curl_easy_setopt(curl, CURLOPT_READDATA, &ifs);
-	curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, CurlHelper::CurlCharVectorWriteCallback);
-	curl_easy_setopt(curl, CURLOPT_WRITEDATA, &readBuffer);
+	readBuffer.clear();
+	sessionUrl.clear();
+
+	CurlHelper::CurlSlistHandle requestHeaders;
+	for (curl_slist *header = headers; header; header = header->next) {
+		requestHeaders.append(header->data);
+	}
+	const std::string uploadContentTypeHeader = fmt::format("X-Upload-Content-Type: {}", contentType);
+	const std::string uploadContentLengthHeader = fmt::format("X-Upload-Content-Length: {}", contentLength);
+	requestHeaders.append(uploadContentTypeHeader.c_str());
+	requestHeaders.append(uploadContentLengthHeader.c_str());
+
+	ResumableUploadResponseHeaders responseHeaders{&readBuffer, {}, std::nullopt};
+
+	const CurlHelper::CurlTransfer transfer{
+		.method = "POST",
+		.url = url,
+		.headers = requestHeaders.getRaw(),
+		.writeFunction = CurlHelper::CurlCharVectorWriteCallback,
+		.writeData = &readBuffer,
+		.headerFunction = ResumableUploadHeaderCallback,
+		.headerData = &responseHeaders,
+	};
 
 	curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, 10L);
 	curl_easy_setopt(curl, CURLOPT_TIMEOUT, 60L);
 	curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+	setAbortPredicate(curl, shouldAbort);
 
-	CURLcode res = curl_easy_perform(curl);
+	const CurlHelper::CurlTransferResult res =
+		co_await CurlHelper::CurlTransferAwaiter(curlExecutor, curl, transfer);
 
-	if (res != CURLE_OK) {
-		logger->error("CurlPerformError", {{"error", curl_easy_strerror(res)}});
-		throw std::runtime_error("CurlPerformError(YouTubeApiClient::doPostWithIfstream)");
+	if (res.code == CURLE_ABORTED_BY_CALLBACK) {
+		logger->warn("CurlPerformAborted");
+		throw std::runtime_error("CurlPerformAborted(YouTubeApiClient::doStartResumableUpload)");
 	}
 
-	return readBuffer;
+	if (res.code != CURLE_OK) {
+		logger->error("CurlPerformError", {{"error", curl_easy_strerror(res.code)}});
+		throwCurlPerformError(res.code, "CurlPerformError(YouTubeApiClient::doStartResumableUpload)");
+	}
+
+	throwIfRetryableStatus(res.responseCode, readBuffer, logger,
+			       "RetryableStatusError(YouTubeApiClient::doStartResumableUpload)");
+
+	if (res.responseCode == 200) {
+		sessionUrl = std::move(responseHeaders.location);
+	}
+	co_return res.responseCode;
 }
 
-std::vector<char> doPutWithString(CURL *curl, const char *url, std::string_view body,
-				  std::shared_ptr<const Logger::ILogger> logger, curl_slist *headers = nullptr)
+// Sends the bytes of body that YouTube has not stored yet to a resumable upload session. With queryFirst,
+// as after an interrupted attempt, the session is asked how much it has stored before anything is sent.
+// On return readBuffer holds the final response of the upload.
+Async::Task<void> doPutResumableUpload(CURL *curl, CurlHelper::CurlMultiExecutor *curlExecutor,
+				       std::vector<char> &readBuffer, const char *sessionUrl,
+				       std::span<const char> body, std::string_view contentType, bool queryFirst,
+				       const std::function<bool()> &shouldAbort,
+				       std::shared_ptr<const Logger::ILogger> logger, curl_slist *headers = nullptr)
 {
 	if (!logger) {
 		logger = Logger::NullLogger::instance();
 	}
-
 	if (!curl) {
 		logger->error("CurlIsNullError");
-		throw std::invalid_argument("CurlIsNullError(YouTubeApiClient::doPutWithString)");
+		throw std::invalid_argument("CurlIsNullError(YouTubeApiClient::doPutResumableUpload)");
 	}
-	if (!url) {
+	if (!sessionUrl) {
 		logger->error("UrlIsNullError");
-		throw std::invalid_argument("UrlIsNullError(YouTubeApiClient::doPutWithString)");
+		throw std::invalid_argument("UrlIsNullError(YouTubeApiClient::doPutResumableUpload)");
 	}
 	if (body.empty()) {
 		logger->error("BodyIsEmptyError");
-		throw std::invalid_argument("BodyIsEmptyError(YouTubeApiClient::doPutWithString)");
+		throw std::invalid_argument("BodyIsEmptyError(YouTubeApiClient::doPutResumableUpload)");
 	}
 
-	std::vector<char> readBuffer;
-
-	curl_easy_reset(curl);
-
-	curl_easy_setopt(curl, CURLOPT_URL, url);
-	curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
-	curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, "PUT");
-	curl_easy_setopt(curl, CURLOPT_POSTFIELDS, body.data());
-	curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, static_cast<long>(body.size()));
+	// Returns the response code; 308 means that the session still waits for more bytes.
+	const auto put = [&](std::span<const char> part, const std::string &contentRangeHeader,
+			     ResumableUploadResponseHeaders &responseHeaders) -> Async::Task<long> {
+		readBuffer.clear();
 
-	curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, CurlHelper::CurlCharVectorWriteCallback);
-	curl_easy_setopt(curl, CURLOPT_WRITEDATA, &readBuffer);
+		CurlHelper::CurlSlistHandle requestHeaders;
+		for (curl_slist *header = headers; header; header = header->next) {
+			requestHeaders.append(header->data);
+		}
+		const std::string contentTypeHeader = fmt::format("Content-Type: {}", contentType);
+		requestHeaders.append(contentTypeHeader.c_str());
+		requestHeaders.append(contentRangeHeader.c_str());
+
+		// The body is sent straight from the mapping or buffer, without a copy.
+		const CurlHelper::CurlTransfer transfer{
+			.method = "PUT",
+			.url = sessionUrl,
+			.headers = requestHeaders.getRaw(),
+			.body = part,
+			.writeFunction = CurlHelper::CurlCharVectorWriteCallback,
+			.writeData = &readBuffer,
+			.headerFunction = ResumableUploadHeaderCallback,
+			.headerData = &responseHeaders,
+		};
+
+		curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, 10L);
+		curl_easy_setopt(curl, CURLOPT_TIMEOUT, 60L);
+		curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+		setAbortPredicate(curl, shouldAbort);
+
+		const CurlHelper::CurlTransferResult res =
+			co_await CurlHelper::CurlTransferAwaiter(curlExecutor, curl, transfer);
+
+		if (res.code == CURLE_ABORTED_BY_CALLBACK) {
+			logger->warn("CurlPerformAborted");
+			throw std::runtime_error("CurlPerformAborted(YouTubeApiClient::doPutResumableUpload)");
+		}
 
-	curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, 10L);
-	curl_easy_setopt(curl, CURLOPT_TIMEOUT, 60L);
-	curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+		if (res.code != CURLE_OK) {
+			logger->error("CurlPerformError", {{"error", curl_easy_strerror(res.code)}});
+			throwCurlPerformError(res.code, "CurlPerformError(YouTubeApiClient::doPutResumableUpload)");
+		}
 
-	CURLcode res = curl_easy_perform(curl);
+		throwIfRetryableStatus(res.responseCode, readBuffer, logger,
+				       "RetryableStatusError(YouTubeApiClient::doPutResumableUpload)");
+		co_return res.responseCode;
+	};
+
+	std::size_t offset = 0;
+	if (queryFirst) {
+		ResumableUploadResponseHeaders responseHeaders{&readBuffer, {}, std::nullopt};
+		const long responseCode =
+			co_await put({}, fmt::format("Content-Range: bytes */{}", body.size()), responseHeaders);
+		if (responseCode != 308) {
+			// The earlier attempt completed after all, or the session is gone; the response tells which.
+			co_return;
+		}
+		if (responseHeaders.lastStoredByte) {
+			offset = static_cast<std::size_t>(std::min<std::uint64_t>(*responseHeaders.lastStoredByte + 1,
+										   body.size() - 1));
+		}
+		logger->info("YouTubeResumableUploadResuming",
+			     {{"offset", std::to_string(offset)}, {"size", std::to_string(body.size())}});
+	}
 
-	if (res != CURLE_OK) {
-		logger->error("CurlPerformError", {{"error", curl_easy_strerror(res)}});
-		throw std::runtime_error("CurlPerformError(YouTubeApiClient::doPutWithString)");
+	ResumableUploadResponseHeaders responseHeaders{&readBuffer, {}, std::nullopt};
+	const long responseCode =
+		co_await put(body.subspan(offset),
+			     fmt::format("Content-Range: bytes {}-{}/{}", offset, body.size() - 1, body.size()),
+			     responseHeaders);
+	if (responseCode == 308) {
+		logger->warn("YouTubeResumableUploadIncomplete");
+		throw YouTubeRetryableError("ResumableUploadIncomplete(YouTubeApiClient::doPutResumableUpload)",
+					    YouTubeRequestFailure::Interrupted);
 	}
+}
 
-	return readBuffer;
+struct ScheduledRequest {
+	YouTubeRequestScheduler &scheduler;
+	YouTubeApiMethod method;
+	YouTubeRequestPriority priority;
+};
+
+// Runs attempt once the scheduler admits it, and again after a backoff while it fails in a way the method
+// can safely repeat. attempt returns the task of a single request.
+template<typename F>
+Async::Task<void> performScheduled(const ScheduledRequest &request, CurlHelper::CurlMultiExecutor *curlExecutor,
+				   const std::function<bool()> &shouldAbort,
+				   std::shared_ptr<const Logger::ILogger> logger, F attempt)
+{
+	const YouTubeApiMethodPolicy policy = getYouTubeApiMethodPolicy(request.method);
+	Metrics::MetricsRegistry &metrics = Metrics::MetricsRegistry::global();
+	const Metrics::MetricLabels methodLabels{{"method", std::string(policy.name)}};
+	Metrics::Counter &quotaUnits = metrics.counter(
+		"youtube_api_quota_units_total", "Estimated YouTube Data API quota units spent.", methodLabels);
+	Metrics::Histogram &duration = metrics.histogram("youtube_api_request_duration_seconds",
+							 "Duration of each YouTube Data API request attempt.",
+							 Metrics::kDefaultDurationBuckets, methodLabels);
+	const auto countRequest = [&](const char *result) {
+		metrics.counter("youtube_api_requests_total", "YouTube Data API requests by method and result.",
+				{{"method", std::string(policy.name)}, {"result", result}})
+			.inc();
+	};
+
+	YouTubeRequestScheduler::Clock::time_point notBefore{};
+	for (int attempts = 1;; ++attempts) {
+		co_await request.scheduler.acquire(request.method, request.priority, notBefore, shouldAbort,
+						   curlExecutor == nullptr);
+		quotaUnits.inc(static_cast<std::uint64_t>(policy.quotaCost));
+		const auto startTime = std::chrono::steady_clock::now();
+		try {
+			co_await attempt();
+			duration.observe(std::chrono::steady_clock::now() - startTime);
+			countRequest("success");
+			co_return;
+		} catch (const YouTubeRetryableError &e) {
+			duration.observe(std::chrono::steady_clock::now() - startTime);
+			if (!request.scheduler.shouldRetry(request.method, e.getFailure(), attempts)) {
+				countRequest("failure");
+				throw;
+			}
+			countRequest("retry");
+
+			const std::chrono::milliseconds delay = request.scheduler.nextBackoff(attempts);
+			logger->warn("YouTubeApiRequestRetrying",
+				     {{"method", policy.name},
+				      {"attempts", std::to_string(attempts)},
+				      {"delayMilliseconds", std::to_string(delay.count())},
+				      {"exception", e.what()}});
+			notBefore = YouTubeRequestScheduler::Clock::now() + delay;
+		} catch (...) {
+			duration.observe(std::chrono::steady_clock::now() - startTime);
+			countRequest("failure");
+			throw;
+		}
+	}
 }
 
-std::vector<nlohmann::json> performList(CURL *curl, const char *url, std::shared_ptr<const Logger::ILogger> logger,
-					curl_slist *headers = nullptr, int maxIterations = 20)
+template<typename T> struct ListResponse {
+	bool notModified = false;
+	// Set only for single-page responses; those are the ones a conditional request can revalidate.
+	std::string etag;
+	std::vector<T> items;
+};
+
+// ifNoneMatchHeader, when set, is sent with the first page only and a 304 reply ends the listing.
+// Pages are decoded straight into T; see decodeYouTubeListPage(). The page token of each page is appended
+// to url in place.
+template<typename T>
+Async::Task<ListResponse<T>> performList(const ScheduledRequest &request, CURL *curl,
+					 CurlHelper::CurlMultiExecutor *curlExecutor, std::vector<char> &responseBody,
+					 YouTubeRequestUrl &url, const std::function<bool()> &shouldAbort,
+					 std::shared_ptr<const Logger::ILogger> logger, curl_slist *headers = nullptr,
+					 const char *ifNoneMatchHeader = nullptr, int maxIterations = 20)
 {
-	std::vector<nlohmann::json> items;
+	ListResponse<T> response;
+	const std::size_t firstPageUrlSize = url.size();
 	std::string nextPageToken;
+	int pageCount = 0;
 	do {
-		CurlHelper::CurlUrlHandle urlHandle;
-		urlHandle.setUrl(url);
-
+		url.truncate(firstPageUrlSize);
 		if (!nextPageToken.empty()) {
-			CurlHelper::CurlUrlSearchParams params(curl);
-			params.append("pageToken", nextPageToken);
-			std::string qs = params.toString();
-			urlHandle.appendQuery(qs.c_str());
+			url.append("pageToken", nextPageToken);
 		}
 
-		auto url = urlHandle.c_str();
-		std::vector<char> responseBody = doGet(curl, url.get(), logger, headers);
-		nlohmann::json j = nlohmann::json::parse(responseBody);
+		CurlHelper::CurlSlistHandle conditionalHeaders;
+		curl_slist *pageHeaders = headers;
+		if (ifNoneMatchHeader && pageCount == 0) {
+			for (curl_slist *header = headers; header; header = header->next) {
+				conditionalHeaders.append(header->data);
+			}
+			conditionalHeaders.append(ifNoneMatchHeader);
+			pageHeaders = conditionalHeaders.getRaw();
+		}
 
-		if (j.contains("error")) {
-			logger->error("YouTubeApiError", {{"error", j["error"].dump()}});
+		long responseCode = 0;
+		co_await performScheduled(request, curlExecutor, shouldAbort, logger, [&]() -> Async::Task<void> {
+			responseCode = co_await doGet(curl, curlExecutor, responseBody, url.c_str(), shouldAbort,
+						      logger, pageHeaders);
+		});
+
+		if (responseCode == 304 && pageCount == 0) {
+			response.notModified = true;
+			co_return response;
+		}
+
+		const std::string_view body(responseBody.data(), responseBody.size());
+		YouTubeListPageInfo page = decodeYouTubeListPage(body, response.items);
+
+		if (page.error) {
+			logger->error("YouTubeApiError", {{"error", page.error->dump()}});
 			throw std::runtime_error("APIError(YouTubeApiClient::performList)");
 		}
 
-		nlohmann::json jItems = std::move(j["items"]);
-		for (auto &x : jItems) {
-			items.push_back(std::move(x));
+		if (pageCount == 0) {
+			response.etag = std::move(page.etag);
 		}
+		++pageCount;
 
-		if (!j.contains("nextPageToken"))
+		if (page.nextPageToken.empty())
 			break;
 
-		nextPageToken = j["nextPageToken"].get<std::string>();
+		nextPageToken = std::move(page.nextPageToken);
 	} while (--maxIterations > 0);
 
-	return items;
+	if (pageCount > 1) {
+		response.etag.clear();
+	}
+
+	co_return response;
+}
+
+// Lists through the cache: fresh entries skip the request and 304 replies reuse the decoded items.
+template<typename T>
+Async::Task<std::vector<T>> performCachedList(const ScheduledRequest &request, CURL *curl,
+					      CurlHelper::CurlMultiExecutor *curlExecutor,
+					      std::vector<char> &responseBody, YouTubeRequestUrl &url,
+					      const std::string &accessToken, YouTubeListCache<T> &cache,
+					      std::chrono::milliseconds maxStaleness,
+					      const std::function<bool()> &shouldAbort,
+					      std::shared_ptr<const Logger::ILogger> logger, curl_slist *headers)
+{
+	const std::string cacheKey = YouTubeListCache<T>::makeKey(url.view(), accessToken);
+	const std::optional<typename YouTubeListCache<T>::Entry> cached = cache.find(cacheKey);
+
+	if (cached && maxStaleness.count() > 0 &&
+	    YouTubeListCache<T>::Clock::now() - cached->validatedAt <= maxStaleness) {
+		logger->debug("YouTubeListCacheHit");
+		co_return *cached->items;
+	}
+
+	const std::string ifNoneMatchHeader = cached ? fmt::format("If-None-Match: {}", cached->etag) : std::string();
+	ListResponse<T> response = co_await performList<T>(request, curl, curlExecutor, responseBody, url, shouldAbort,
+							   logger, headers,
+							   cached ? ifNoneMatchHeader.c_str() : nullptr);
+
+	if (response.notModified) {
+		logger->debug("YouTubeListCacheNotModified");
+		cache.revalidate(cacheKey);
+		co_return *cached->items;
+	}
+
+	if (response.etag.empty()) {
+		cache.erase(cacheKey);
+	} else {
+		cache.store(cacheKey, std::move(response.etag), response.items);
+	}
+
+	co_return std::move(response.items);
+}
+
+// Yields the items of a list request, downloading each page only once the previous one is consumed.
+// The URL of the first page is taken from the URL buffer of curl. Owns everything it uses, so it does not
+// depend on the client that created it.
+template<typename T>
+Async::Generator<T> iterateList(std::shared_ptr<YouTubeRequestScheduler> scheduler, YouTubeApiMethod method,
+				YouTubeRequestPriority priority, CurlHelper::CurlConnectionPool::Lease curl,
+				CurlHelper::CurlMultiExecutor *curlExecutor,
+				std::shared_ptr<const YouTubeAuthHeaders> headers, std::function<bool()> shouldAbort,
+				std::shared_ptr<const Logger::ILogger> logger, int maxIterations = 20)
+{
+	const ScheduledRequest request{*scheduler, method, priority};
+
+	YouTubeRequestUrl url(curl.getUrlBuffer());
+	const std::size_t firstPageUrlSize = url.size();
+	std::string nextPageToken;
+	do {
+		url.truncate(firstPageUrlSize);
+		if (!nextPageToken.empty()) {
+			url.append("pageToken", nextPageToken);
+		}
+
+		std::vector<char> &responseBody = curl.getResponseBuffer();
+		co_await performScheduled(request, curlExecutor, shouldAbort, logger, [&]() {
+			return doGet(curl.getRaw(), curlExecutor, responseBody, url.c_str(), shouldAbort, logger,
+				     headers->getAuthorization());
+		});
+
+		std::vector<T> items;
+		const std::string_view body(responseBody.data(), responseBody.size());
+		YouTubeListPageInfo page = decodeYouTubeListPage(body, items);
+
+		if (page.error) {
+			logger->error("YouTubeApiError", {{"error", page.error->dump()}});
+			throw std::runtime_error("APIError(YouTubeApiClient::iterateList)");
+		}
+
+		for (T &item : items) {
+			co_yield std::move(item);
+		}
+
+		if (page.nextPageToken.empty())
+			break;
+
+		nextPageToken = std::move(page.nextPageToken);
+	} while (--maxIterations > 0);
 }
 
 char toLowerAscii(char c)
@@ -331,53 +797,113 @@ std::string getLowercaseExtension(const std::filesystem::path &p)
 	return toLowercase(ext);
 }
 
+// Resource-level fields selector, e.g. for insert, update, bind and transition responses.
+void appendFieldMask(YouTubeRequestUrl &url, std::string_view defaultParts, const YouTubeFieldMask &mask)
+{
+	url.append("part", mask.parts.empty() ? defaultParts : mask.parts);
+	if (!mask.fields.empty()) {
+		url.append("fields", mask.fields);
+	}
+}
+
+// List responses nest resources under items; etag and nextPageToken must stay selected for caching and paging.
+void appendListFieldMask(YouTubeRequestUrl &url, std::string_view defaultParts, const YouTubeFieldMask &mask)
+{
+	url.append("part", mask.parts.empty() ? defaultParts : mask.parts);
+	if (!mask.fields.empty()) {
+		url.append("fields", "etag,nextPageToken,items(").appendToValue(mask.fields).appendToValue(")");
+	}
+}
+
+// Appends values as one comma-separated parameter; values must not be empty.
+void appendList(YouTubeRequestUrl &url, std::string_view name, std::span<const std::string> values)
+{
+	url.append(name, values.front());
+	for (std::size_t i = 1; i < values.size(); ++i) {
+		url.appendToValue(",").appendToValue(values[i]);
+	}
+}
+
+// Without a multi executor every transfer is performed inline, so the task is done once started.
+template<typename T> T runSynchronously(Async::Task<T> task)
+{
+	task.start();
+	return task.await_resume();
+}
+
 } // anonymous namespace
 
-YouTubeApiClient::YouTubeApiClient(std::shared_ptr<CurlHelper::CurlHandle> curl)
-	: curl_(curl ? curl : throw std::invalid_argument("CurlIsNullError(YouTubeApiClient::YouTubeApiClient)"))
+YouTubeApiClient::YouTubeApiClient(std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool)
+	: curlPool_(curlPool ? std::move(curlPool)
+			     : throw std::invalid_argument("CurlPoolIsNullError(YouTubeApiClient::YouTubeApiClient)")),
+	  requestScheduler_(std::make_shared<YouTubeRequestScheduler>())
 {
 }
 
 YouTubeApiClient::~YouTubeApiClient() noexcept = default;
 
-std::vector<YouTubeLiveStream> YouTubeApiClient::listLiveStreams(const std::string &accessToken,
-								 std::span<const std::string> ids)
+Async::Task<std::vector<YouTubeLiveStream>>
+YouTubeApiClient::listLiveStreamsTask(CurlHelper::CurlMultiExecutor *curlExecutor, const std::string &accessToken,
+				      std::span<const std::string> ids, const YouTubeFieldMask &mask)
 {
 	if (accessToken.empty()) {
 		logger_->error("AccessTokenIsEmptyError");
 		throw std::invalid_argument("AccessTokenIsEmptyError(YouTubeApiClient::listLiveStreams)");
 	}
 
-	CurlHelper::CurlUrlSearchParams params(curl_->getRaw());
-	params.append("part", "id,snippet,cdn,status");
+	CurlHelper::CurlConnectionPool::Lease curl = curlPool_->checkout();
+
+	YouTubeRequestUrl url(curl.getUrlBuffer());
+	url.reset(YouTubeEndpoint::kLiveStreams);
+	appendListFieldMask(url, "id,snippet,cdn,status", mask);
 	if (ids.empty()) {
-		params.append("mine", "true");
+		url.append("mine", "true");
 	} else {
-		params.append("id", fmt::format("{}", fmt::join(ids, ",")));
+		appendList(url, "id", ids);
 	}
-	std::string qs = params.toString();
 
-	CurlHelper::CurlUrlHandle urlHandle;
-	urlHandle.setUrl("https://www.googleapis.com/youtube/v3/liveStreams");
-	urlHandle.appendQuery(qs.c_str());
-	auto url = urlHandle.c_str();
+	const std::shared_ptr<const YouTubeAuthHeaders> headers = authHeaders_.get(accessToken);
 
-	CurlHelper::CurlSlistHandle headers;
-	std::string authHeader = fmt::format("Authorization: Bearer {}", accessToken);
-	headers.append(authHeader.c_str());
+	const ScheduledRequest request{*requestScheduler_, YouTubeApiMethod::LiveStreamsList, requestPriority_};
 
-	std::vector<nlohmann::json> items = performList(curl_->getRaw(), url.get(), logger_, headers.getRaw());
+	co_return co_await performCachedList(request, curl.getRaw(), curlExecutor, curl.getResponseBuffer(), url,
+					     accessToken, liveStreamCache_, listCacheMaxStaleness_, shouldAbort_,
+					     logger_, headers->getAuthorization());
+}
 
-	std::vector<YouTubeLiveStream> liveStreams;
-	for (const nlohmann::json &item : items) {
-		liveStreams.push_back(item.get<YouTubeLiveStream>());
+Async::Task<std::vector<YouTubeLiveBroadcast>>
+YouTubeApiClient::listLiveBroadcastsTask(CurlHelper::CurlMultiExecutor *curlExecutor, const std::string &accessToken,
+					 std::span<const std::string> ids, const YouTubeFieldMask &mask)
+{
+	if (accessToken.empty()) {
+		logger_->error("AccessTokenIsEmptyError");
+		throw std::invalid_argument("AccessTokenIsEmptyError(YouTubeApiClient::listLiveBroadcasts)");
 	}
+	if (ids.empty()) {
+		logger_->error("IdsIsEmptyError");
+		throw std::invalid_argument("IdsIsEmptyError(YouTubeApiClient::listLiveBroadcasts)");
+	}
+
+	CurlHelper::CurlConnectionPool::Lease curl = curlPool_->checkout();
+
+	YouTubeRequestUrl url(curl.getUrlBuffer());
+	url.reset(YouTubeEndpoint::kLiveBroadcasts);
+	appendListFieldMask(url, "id,snippet,contentDetails,status", mask);
+	appendList(url, "id", ids);
+
+	const std::shared_ptr<const YouTubeAuthHeaders> headers = authHeaders_.get(accessToken);
+
+	const ScheduledRequest request{*requestScheduler_, YouTubeApiMethod::LiveBroadcastsList, requestPriority_};
 
-	return liveStreams;
+	co_return co_await performCachedList(request, curl.getRaw(), curlExecutor, curl.getResponseBuffer(), url,
+					     accessToken, liveBroadcastCache_, listCacheMaxStaleness_, shouldAbort_,
+					     logger_, headers->getAuthorization());
 }
 
-std::vector<YouTubeLiveBroadcast> YouTubeApiClient::listLiveBroadcastsByStatus(const std::string &accessToken,
-									       const std::string &broadcastStatus)
+Async::Task<std::vector<YouTubeLiveBroadcast>>
+YouTubeApiClient::listLiveBroadcastsByStatusTask(CurlHelper::CurlMultiExecutor *curlExecutor,
+						 const std::string &accessToken, const std::string &broadcastStatus,
+						 const YouTubeFieldMask &mask)
 {
 	if (accessToken.empty()) {
 		logger_->error("AccessTokenIsEmptyError");
@@ -389,57 +915,49 @@ std::vector<YouTubeLiveBroadcast> YouTubeApiClient::listLiveBroadcastsByStatus(c
 			"BroadcastStatusIsEmptyError(YouTubeApiClient::listLiveBroadcastsByStatus)");
 	}
 
-	CurlHelper::CurlUrlSearchParams params(curl_->getRaw());
-	params.append("part", "id,snippet,contentDetails,status");
-	params.append("broadcastStatus", broadcastStatus);
-	std::string qs = params.toString();
-
-	CurlHelper::CurlUrlHandle urlHandle;
-	urlHandle.setUrl("https://www.googleapis.com/youtube/v3/liveBroadcasts");
-	urlHandle.appendQuery(qs.c_str());
+	CurlHelper::CurlConnectionPool::Lease curl = curlPool_->checkout();
 
-	CurlHelper::CurlSlistHandle headers;
-	std::string authHeader = fmt::format("Authorization: Bearer {}", accessToken);
-	headers.append(authHeader.c_str());
+	YouTubeRequestUrl url(curl.getUrlBuffer());
+	url.reset(YouTubeEndpoint::kLiveBroadcasts);
+	appendListFieldMask(url, "id,snippet,contentDetails,status", mask);
+	url.append("broadcastStatus", broadcastStatus);
 
-	auto url = urlHandle.c_str();
-	std::vector<nlohmann::json> items = performList(curl_->getRaw(), url.get(), logger_, headers.getRaw());
+	const std::shared_ptr<const YouTubeAuthHeaders> headers = authHeaders_.get(accessToken);
 
-	std::vector<YouTubeLiveBroadcast> broadcasts;
-	for (const nlohmann::json &item : items) {
-		broadcasts.push_back(item.get<YouTubeLiveBroadcast>());
-	}
+	const ScheduledRequest request{*requestScheduler_, YouTubeApiMethod::LiveBroadcastsList, requestPriority_};
 
-	return broadcasts;
+	co_return co_await performCachedList(request, curl.getRaw(), curlExecutor, curl.getResponseBuffer(), url,
+					     accessToken, liveBroadcastCache_, listCacheMaxStaleness_, shouldAbort_,
+					     logger_, headers->getAuthorization());
 }
 
-YouTubeLiveBroadcast YouTubeApiClient::insertLiveBroadcast(const std::string &accessToken,
-							   const InsertingYouTubeLiveBroadcast &insertingLiveBroadcast)
+Async::Task<YouTubeLiveBroadcast>
+YouTubeApiClient::insertLiveBroadcastTask(CurlHelper::CurlMultiExecutor *curlExecutor, const std::string &accessToken,
+					  const InsertingYouTubeLiveBroadcast &insertingLiveBroadcast,
+					  const YouTubeFieldMask &mask)
 {
 	if (accessToken.empty()) {
 		logger_->error("AccessTokenIsEmptyError");
 		throw std::invalid_argument("AccessTokenIsEmptyError(insertLiveBroadcast)");
 	}
 
-	CurlHelper::CurlUrlSearchParams params(curl_->getRaw());
-	params.append("part", "id,snippet,contentDetails,status");
-	std::string qs = params.toString();
+	CurlHelper::CurlConnectionPool::Lease curl = curlPool_->checkout();
 
-	CurlHelper::CurlUrlHandle urlHandle;
-	urlHandle.setUrl("https://www.googleapis.com/youtube/v3/liveBroadcasts");
-	urlHandle.appendQuery(qs.c_str());
-	auto url = urlHandle.c_str();
+	YouTubeRequestUrl url(curl.getUrlBuffer());
+	url.reset(YouTubeEndpoint::kLiveBroadcasts);
+	appendFieldMask(url, "id,snippet,contentDetails,status", YouTubeFieldMask{{}, mask.fields});
 
-	CurlHelper::CurlSlistHandle headers;
-	std::string authHeader = fmt::format("Authorization: Bearer {}", accessToken);
-	headers.append(authHeader.c_str());
-	headers.append("Content-Type: application/json");
+	const std::shared_ptr<const YouTubeAuthHeaders> headers = authHeaders_.get(accessToken);
 
 	nlohmann::json requestBody = insertingLiveBroadcast;
 	std::string bodyStr = requestBody.dump();
 
-	std::vector<char> responseBody =
-		doPostWithString(curl_->getRaw(), url.get(), bodyStr, logger_, headers.getRaw());
+	std::vector<char> &responseBody = curl.getResponseBuffer();
+	const ScheduledRequest request{*requestScheduler_, YouTubeApiMethod::LiveBroadcastsInsert, requestPriority_};
+	co_await performScheduled(request, curlExecutor, shouldAbort_, logger_, [&]() {
+		return doPostWithString(curl.getRaw(), curlExecutor, responseBody, url.c_str(), bodyStr, shouldAbort_,
+					logger_, headers->getJson());
+	});
 
 	nlohmann::json j = nlohmann::json::parse(responseBody);
 
@@ -448,36 +966,36 @@ YouTubeLiveBroadcast YouTubeApiClient::insertLiveBroadcast(const std::string &ac
 		throw std::runtime_error("APIError(YouTubeApiClient::insertLiveBroadcast)");
 	}
 
-	return j.get<YouTubeLiveBroadcast>();
+	co_return j.get<YouTubeLiveBroadcast>();
 }
 
-YouTubeLiveBroadcast YouTubeApiClient::updateLiveBroadcast(const std::string &accessToken,
-							   const UpdatingYouTubeLiveBroadcast &updatingLiveBroadcast)
+Async::Task<YouTubeLiveBroadcast>
+YouTubeApiClient::updateLiveBroadcastTask(CurlHelper::CurlMultiExecutor *curlExecutor, const std::string &accessToken,
+					  const UpdatingYouTubeLiveBroadcast &updatingLiveBroadcast,
+					  const YouTubeFieldMask &mask)
 {
 	if (accessToken.empty()) {
 		logger_->error("AccessTokenIsEmptyError");
 		throw std::invalid_argument("AccessTokenIsEmptyError(updateLiveBroadcast)");
 	}
 
-	CurlHelper::CurlUrlSearchParams params(curl_->getRaw());
-	params.append("part", "id,snippet,contentDetails,status");
-	std::string qs = params.toString();
+	CurlHelper::CurlConnectionPool::Lease curl = curlPool_->checkout();
 
-	CurlHelper::CurlUrlHandle urlHandle;
-	urlHandle.setUrl("https://www.googleapis.com/youtube/v3/liveBroadcasts");
-	urlHandle.appendQuery(qs.c_str());
-	auto url = urlHandle.c_str();
+	YouTubeRequestUrl url(curl.getUrlBuffer());
+	url.reset(YouTubeEndpoint::kLiveBroadcasts);
+	appendFieldMask(url, "id,snippet,contentDetails,status", YouTubeFieldMask{{}, mask.fields});
 
-	CurlHelper::CurlSlistHandle headers;
-	std::string authHeader = fmt::format("Authorization: Bearer {}", accessToken);
-	headers.append(authHeader.c_str());
-	headers.append("Content-Type: application/json");
+	const std::shared_ptr<const YouTubeAuthHeaders> headers = authHeaders_.get(accessToken);
 
 	nlohmann::json requestBody = updatingLiveBroadcast;
 	std::string bodyStr = requestBody.dump();
 
-	std::vector<char> responseBody =
-		doPutWithString(curl_->getRaw(), url.get(), bodyStr, logger_, headers.getRaw());
+	std::vector<char> &responseBody = curl.getResponseBuffer();
+	const ScheduledRequest request{*requestScheduler_, YouTubeApiMethod::LiveBroadcastsUpdate, requestPriority_};
+	co_await performScheduled(request, curlExecutor, shouldAbort_, logger_, [&]() {
+		return doPutWithString(curl.getRaw(), curlExecutor, responseBody, url.c_str(), bodyStr, shouldAbort_,
+				       logger_, headers->getJson());
+	});
 
 	nlohmann::json j = nlohmann::json::parse(responseBody);
 	if (j.contains("error")) {
@@ -485,11 +1003,14 @@ YouTubeLiveBroadcast YouTubeApiClient::updateLiveBroadcast(const std::string &ac
 		throw std::runtime_error("APIError(YouTubeApiClient::updateLiveBroadcast)");
 	}
 
-	return j.get<YouTubeLiveBroadcast>();
+	co_return j.get<YouTubeLiveBroadcast>();
 }
 
-YouTubeLiveBroadcast YouTubeApiClient::bindLiveBroadcast(const std::string &accessToken, const std::string &broadcastId,
-							 const std::optional<std::string> &streamId)
+Async::Task<YouTubeLiveBroadcast> YouTubeApiClient::bindLiveBroadcastTask(CurlHelper::CurlMultiExecutor *curlExecutor,
+									  const std::string &accessToken,
+									  const std::string &broadcastId,
+									  const std::optional<std::string> &streamId,
+									  const YouTubeFieldMask &mask)
 {
 	if (accessToken.empty()) {
 		logger_->error("AccessTokenIsEmptyError");
@@ -500,24 +1021,24 @@ YouTubeLiveBroadcast YouTubeApiClient::bindLiveBroadcast(const std::string &acce
 		throw std::invalid_argument("BroadcastIdIsEmptyError(YouTubeApiClient::bindLiveBroadcast)");
 	}
 
-	CurlHelper::CurlUrlSearchParams params(curl_->getRaw());
-	params.append("id", broadcastId);
-	params.append("part", "id,snippet,contentDetails,status");
+	CurlHelper::CurlConnectionPool::Lease curl = curlPool_->checkout();
+
+	YouTubeRequestUrl url(curl.getUrlBuffer());
+	url.reset(YouTubeEndpoint::kLiveBroadcastsBind);
+	url.append("id", broadcastId);
+	appendFieldMask(url, "id,snippet,contentDetails,status", mask);
 	if (streamId.has_value()) {
-		params.append("streamId", streamId.value());
+		url.append("streamId", streamId.value());
 	}
 
-	CurlHelper::CurlUrlHandle urlHandle;
-	urlHandle.setUrl("https://www.googleapis.com/youtube/v3/liveBroadcasts/bind");
-	std::string qs = params.toString();
-	urlHandle.appendQuery(qs.c_str());
-	auto url = urlHandle.c_str();
-
-	CurlHelper::CurlSlistHandle headers;
-	std::string authHeader = fmt::format("Authorization: Bearer {}", accessToken);
-	headers.append(authHeader.c_str());
+	const std::shared_ptr<const YouTubeAuthHeaders> headers = authHeaders_.get(accessToken);
 
-	std::vector<char> responseBody = doPost(curl_->getRaw(), url.get(), logger_, headers.getRaw());
+	std::vector<char> &responseBody = curl.getResponseBuffer();
+	const ScheduledRequest request{*requestScheduler_, YouTubeApiMethod::LiveBroadcastsBind, requestPriority_};
+	co_await performScheduled(request, curlExecutor, shouldAbort_, logger_, [&]() {
+		return doPost(curl.getRaw(), curlExecutor, responseBody, url.c_str(), shouldAbort_, logger_,
+			      headers->getAuthorization());
+	});
 
 	nlohmann::json j = nlohmann::json::parse(responseBody);
 
@@ -526,12 +1047,13 @@ YouTubeLiveBroadcast YouTubeApiClient::bindLiveBroadcast(const std::string &acce
 		throw std::runtime_error("APIError(YouTubeApiClient::bindLiveBroadcast)");
 	}
 
-	return j.get<YouTubeLiveBroadcast>();
+	co_return j.get<YouTubeLiveBroadcast>();
 }
 
-YouTubeLiveBroadcast YouTubeApiClient::transitionLiveBroadcast(const std::string &accessToken,
-							       const std::string &broadcastId,
-							       const std::string &broadcastStatus)
+Async::Task<YouTubeLiveBroadcast>
+YouTubeApiClient::transitionLiveBroadcastTask(CurlHelper::CurlMultiExecutor *curlExecutor,
+					      const std::string &accessToken, const std::string &broadcastId,
+					      const std::string &broadcastStatus, const YouTubeFieldMask &mask)
 {
 	if (accessToken.empty()) {
 		logger_->error("AccessTokenIsEmptyError");
@@ -546,24 +1068,25 @@ YouTubeLiveBroadcast YouTubeApiClient::transitionLiveBroadcast(const std::string
 		throw std::invalid_argument("BroadcastStatusIsEmptyError(YouTubeApiClient::transitionLiveBroadcast)");
 	}
 
-	CurlHelper::CurlUrlSearchParams params(curl_->getRaw());
-	params.append("id", broadcastId);
-	params.append("broadcastStatus", broadcastStatus);
-	params.append("part", "id,snippet,contentDetails,status");
-	std::string qs = params.toString();
+	CurlHelper::CurlConnectionPool::Lease curl = curlPool_->checkout();
 
-	CurlHelper::CurlUrlHandle urlHandle;
-	urlHandle.setUrl("https://www.googleapis.com/youtube/v3/liveBroadcasts/transition");
-	urlHandle.appendQuery(qs.c_str());
-	auto url = urlHandle.c_str();
+	YouTubeRequestUrl url(curl.getUrlBuffer());
+	url.reset(YouTubeEndpoint::kLiveBroadcastsTransition);
+	url.append("id", broadcastId);
+	url.append("broadcastStatus", broadcastStatus);
+	appendFieldMask(url, "id,snippet,contentDetails,status", mask);
 
-	CurlHelper::CurlSlistHandle headers;
-	std::string authHeader = fmt::format("Authorization: Bearer {}", accessToken);
-	headers.append(authHeader.c_str());
+	const std::shared_ptr<const YouTubeAuthHeaders> headers = authHeaders_.get(accessToken);
 
 	logger_->info("TransitioningLiveBroadcast",
 		      {{"broadcastId", broadcastId}, {"broadcastStatus", broadcastStatus}});
-	std::vector<char> responseBody = doPost(curl_->getRaw(), url.get(), logger_, headers.getRaw());
+	std::vector<char> &responseBody = curl.getResponseBuffer();
+	const ScheduledRequest request{*requestScheduler_, YouTubeApiMethod::LiveBroadcastsTransition,
+				       requestPriority_};
+	co_await performScheduled(request, curlExecutor, shouldAbort_, logger_, [&]() {
+		return doPost(curl.getRaw(), curlExecutor, responseBody, url.c_str(), shouldAbort_, logger_,
+			      headers->getAuthorization());
+	});
 
 	nlohmann::json j = nlohmann::json::parse(responseBody);
 
@@ -572,22 +1095,16 @@ YouTubeLiveBroadcast YouTubeApiClient::transitionLiveBroadcast(const std::string
 		throw std::runtime_error("APIError(YouTubeApiClient::transitionLiveBroadcast)");
 	}
 
-	return j.get<YouTubeLiveBroadcast>();
+	co_return j.get<YouTubeLiveBroadcast>();
 }
 
-void YouTubeApiClient::setThumbnail(const std::string &accessToken, const std::string &videoId,
-				    const std::filesystem::path &thumbnailPath)
+Async::Task<void> YouTubeApiClient::setThumbnailTask(CurlHelper::CurlMultiExecutor *curlExecutor,
+						     const std::string &accessToken, const std::string &videoId,
+						     const std::filesystem::path &thumbnailPath,
+						     const YouTubeFieldMask &mask)
 {
 	constexpr std::uintmax_t kMaxThumbnailBytes = 2 * 1024 * 1024;
 
-	if (accessToken.empty()) {
-		logger_->error("AccessTokenIsEmptyError");
-		throw std::invalid_argument("AccessTokenIsEmptyError(YouTubeApiClient::setThumbnail)");
-	}
-	if (videoId.empty()) {
-		logger_->error("VideoIdIsEmptyError");
-		throw std::invalid_argument("VideoIdIsEmptyError(YouTubeApiClient::setThumbnail)");
-	}
 	if (thumbnailPath.empty()) {
 		logger_->error("ThumbnailPathIsEmptyError");
 		throw std::invalid_argument("ThumbnailPathIsEmptyError(YouTubeApiClient::setThumbnail)");
@@ -611,38 +1128,93 @@ void YouTubeApiClient::setThumbnail(const std::string &accessToken, const std::s
 	}
 	// FIXME: Path whitelist will be implemented later.
 
-	CurlHelper::CurlUrlSearchParams params(curl_->getRaw());
-	params.append("videoId", videoId);
-	std::string qs = params.toString();
-
-	CurlHelper::CurlUrlHandle urlHandle;
-	urlHandle.setUrl("https://www.googleapis.com/upload/youtube/v3/thumbnails/set");
-	urlHandle.appendQuery(qs.c_str());
-	auto url = urlHandle.c_str();
-
-	CurlHelper::CurlSlistHandle headers;
-
-	const std::string authHeader = fmt::format("Authorization: Bearer {}", accessToken);
-	headers.append(authHeader.c_str());
-
 	const std::string ext = getLowercaseExtension(thumbnailPath);
+	std::string contentType = "application/octet-stream";
 	if (ext == ".png") {
-		headers.append("Content-Type: image/png");
+		contentType = "image/png";
 	} else if (ext == ".jpg" || ext == ".jpeg") {
-		headers.append("Content-Type: image/jpeg");
-	} else {
-		headers.append("Content-Type: application/octet-stream");
+		contentType = "image/jpeg";
 	}
 
-	std::ifstream ifs(thumbnailPath, std::ios::binary);
-	if (!ifs.is_open()) {
-		logger_->error("ThumbnailFileOpenError", {{"path", thumbnailPath.string()}});
+	std::optional<YouTubeUploadSource> thumbnail;
+	try {
+		thumbnail.emplace(YouTubeUploadSource::mapFile(thumbnailPath, contentType));
+	} catch (const std::exception &e) {
+		logger_->error("ThumbnailFileOpenError", {{"path", thumbnailPath.string()}, {"exception", e.what()}});
 		throw std::runtime_error("ThumbnailFileOpenError(YouTubeApiClient::setThumbnail)");
 	}
 
-	std::vector<char> responseBody =
-		doPostWithIfstream(curl_->getRaw(), url.get(), ifs, size, logger_, headers.getRaw());
-	ifs.close();
+	co_await uploadThumbnailTask(curlExecutor, accessToken, videoId, *thumbnail, mask);
+}
+
+Async::Task<void> YouTubeApiClient::uploadThumbnailTask(CurlHelper::CurlMultiExecutor *curlExecutor,
+							const std::string &accessToken, const std::string &videoId,
+							const YouTubeUploadSource &thumbnail,
+							const YouTubeFieldMask &mask)
+{
+	constexpr std::size_t kMaxThumbnailBytes = 2 * 1024 * 1024;
+
+	if (accessToken.empty()) {
+		logger_->error("AccessTokenIsEmptyError");
+		throw std::invalid_argument("AccessTokenIsEmptyError(YouTubeApiClient::setThumbnail)");
+	}
+	if (videoId.empty()) {
+		logger_->error("VideoIdIsEmptyError");
+		throw std::invalid_argument("VideoIdIsEmptyError(YouTubeApiClient::setThumbnail)");
+	}
+
+	const std::span<const char> bytes = thumbnail.getBytes();
+	if (bytes.empty()) {
+		logger_->error("ThumbnailIsEmptyError");
+		throw std::invalid_argument("ThumbnailIsEmptyError(YouTubeApiClient::setThumbnail)");
+	}
+	if (bytes.size() > kMaxThumbnailBytes) {
+		logger_->error("ThumbnailSizeExceedsLimitError", {{"size", std::to_string(bytes.size())},
+								  {"maxSize", std::to_string(kMaxThumbnailBytes)}});
+		throw std::invalid_argument("ThumbnailSizeExceedsLimitError(YouTubeApiClient::setThumbnail)");
+	}
+
+	CurlHelper::CurlConnectionPool::Lease curl = curlPool_->checkout();
+
+	YouTubeRequestUrl url(curl.getUrlBuffer());
+	url.reset(YouTubeEndpoint::kThumbnailsSet);
+	url.append("videoId", videoId);
+	url.append("uploadType", "resumable");
+	if (!mask.fields.empty()) {
+		url.append("fields", mask.fields);
+	}
+
+	const std::shared_ptr<const YouTubeAuthHeaders> headers = authHeaders_.get(accessToken);
+
+	std::vector<char> &responseBody = curl.getResponseBuffer();
+
+	// --- Open the upload session; this is the request that is charged ---
+	std::string sessionUrl;
+	const ScheduledRequest startRequest{*requestScheduler_, YouTubeApiMethod::ThumbnailsSet, requestPriority_};
+	co_await performScheduled(startRequest, curlExecutor, shouldAbort_, logger_, [&]() {
+		return doStartResumableUpload(curl.getRaw(), curlExecutor, responseBody, sessionUrl, url.c_str(),
+					      bytes.size(), thumbnail.getContentType(), shouldAbort_, logger_,
+					      headers->getAuthorization());
+	});
+
+	if (sessionUrl.empty()) {
+		nlohmann::json j = nlohmann::json::parse(responseBody);
+		if (j.contains("error")) {
+			logger_->error("YouTubeApiError", {{"error", j["error"].dump()}});
+			throw std::runtime_error("APIError(YouTubeApiClient::setThumbnail)");
+		}
+		logger_->error("ResumableUploadSessionUrlMissingError");
+		throw std::runtime_error("ResumableUploadSessionUrlMissingError(YouTubeApiClient::setThumbnail)");
+	}
+
+	// --- Send the bytes; every retry resumes from the last byte YouTube has stored ---
+	bool resuming = false;
+	const ScheduledRequest putRequest{*requestScheduler_, YouTubeApiMethod::ResumableUploadPut, requestPriority_};
+	co_await performScheduled(putRequest, curlExecutor, shouldAbort_, logger_, [&]() {
+		return doPutResumableUpload(curl.getRaw(), curlExecutor, responseBody, sessionUrl.c_str(), bytes,
+					    thumbnail.getContentType(), std::exchange(resuming, true), shouldAbort_,
+					    logger_, headers->getAuthorization());
+	});
 
 	nlohmann::json j = nlohmann::json::parse(responseBody);
 	if (j.contains("error")) {
@@ -651,4 +1223,210 @@ void YouTubeApiClient::setThumbnail(const std::string &accessToken, const std::s
 	}
 }
 
+std::vector<YouTubeLiveStream> YouTubeApiClient::listLiveStreams(const std::string &accessToken,
+								 std::span<const std::string> ids,
+								 const YouTubeFieldMask &mask)
+{
+	return runSynchronously(listLiveStreamsTask(nullptr, accessToken, ids, mask));
+}
+
+std::vector<YouTubeLiveBroadcast> YouTubeApiClient::listLiveBroadcasts(const std::string &accessToken,
+								       std::span<const std::string> ids,
+								       const YouTubeFieldMask &mask)
+{
+	return runSynchronously(listLiveBroadcastsTask(nullptr, accessToken, ids, mask));
+}
+
+std::vector<YouTubeLiveBroadcast> YouTubeApiClient::listLiveBroadcastsByStatus(const std::string &accessToken,
+									       const std::string &broadcastStatus,
+									       const YouTubeFieldMask &mask)
+{
+	return runSynchronously(listLiveBroadcastsByStatusTask(nullptr, accessToken, broadcastStatus, mask));
+}
+
+YouTubeLiveBroadcast YouTubeApiClient::insertLiveBroadcast(const std::string &accessToken,
+							   const InsertingYouTubeLiveBroadcast &insertingLiveBroadcast,
+							   const YouTubeFieldMask &mask)
+{
+	return runSynchronously(insertLiveBroadcastTask(nullptr, accessToken, insertingLiveBroadcast, mask));
+}
+
+YouTubeLiveBroadcast YouTubeApiClient::updateLiveBroadcast(const std::string &accessToken,
+							   const UpdatingYouTubeLiveBroadcast &updatingLiveBroadcast,
+							   const YouTubeFieldMask &mask)
+{
+	return runSynchronously(updateLiveBroadcastTask(nullptr, accessToken, updatingLiveBroadcast, mask));
+}
+
+YouTubeLiveBroadcast YouTubeApiClient::bindLiveBroadcast(const std::string &accessToken, const std::string &broadcastId,
+							 const std::optional<std::string> &streamId,
+							 const YouTubeFieldMask &mask)
+{
+	return runSynchronously(bindLiveBroadcastTask(nullptr, accessToken, broadcastId, streamId, mask));
+}
+
+YouTubeLiveBroadcast YouTubeApiClient::transitionLiveBroadcast(const std::string &accessToken,
+							       const std::string &broadcastId,
+							       const std::string &broadcastStatus,
+							       const YouTubeFieldMask &mask)
+{
+	return runSynchronously(transitionLiveBroadcastTask(nullptr, accessToken, broadcastId, broadcastStatus, mask));
+}
+
+void YouTubeApiClient::setThumbnail(const std::string &accessToken, const std::string &videoId,
+				    const std::filesystem::path &thumbnailPath, const YouTubeFieldMask &mask)
+{
+	runSynchronously(setThumbnailTask(nullptr, accessToken, videoId, thumbnailPath, mask));
+}
+
+void YouTubeApiClient::setThumbnail(const std::string &accessToken, const std::string &videoId,
+				    const YouTubeUploadSource &thumbnail, const YouTubeFieldMask &mask)
+{
+	runSynchronously(uploadThumbnailTask(nullptr, accessToken, videoId, thumbnail, mask));
+}
+
+Async::Task<std::vector<YouTubeLiveStream>> YouTubeApiClient::listLiveStreamsAsync(std::string accessToken,
+										   std::vector<std::string> ids,
+										   YouTubeFieldMask mask)
+{
+	co_return co_await listLiveStreamsTask(curlExecutor_.get(), accessToken, ids, mask);
+}
+
+Async::Task<std::vector<YouTubeLiveBroadcast>> YouTubeApiClient::listLiveBroadcastsAsync(std::string accessToken,
+											 std::vector<std::string> ids,
+											 YouTubeFieldMask mask)
+{
+	co_return co_await listLiveBroadcastsTask(curlExecutor_.get(), accessToken, ids, mask);
+}
+
+Async::Task<std::vector<YouTubeLiveBroadcast>>
+YouTubeApiClient::listLiveBroadcastsByStatusAsync(std::string accessToken, std::string broadcastStatus,
+						  YouTubeFieldMask mask)
+{
+	co_return co_await listLiveBroadcastsByStatusTask(curlExecutor_.get(), accessToken, broadcastStatus, mask);
+}
+
+Async::Task<YouTubeLiveBroadcast>
+YouTubeApiClient::insertLiveBroadcastAsync(std::string accessToken,
+					   InsertingYouTubeLiveBroadcast insertingLiveBroadcast, YouTubeFieldMask mask)
+{
+	co_return co_await insertLiveBroadcastTask(curlExecutor_.get(), accessToken, insertingLiveBroadcast, mask);
+}
+
+Async::Task<YouTubeLiveBroadcast>
+YouTubeApiClient::updateLiveBroadcastAsync(std::string accessToken, UpdatingYouTubeLiveBroadcast updatingLiveBroadcast,
+					   YouTubeFieldMask mask)
+{
+	co_return co_await updateLiveBroadcastTask(curlExecutor_.get(), accessToken, updatingLiveBroadcast, mask);
+}
+
+Async::Task<YouTubeLiveBroadcast> YouTubeApiClient::bindLiveBroadcastAsync(std::string accessToken,
+									   std::string broadcastId,
+									   std::optional<std::string> streamId,
+									   YouTubeFieldMask mask)
+{
+	co_return co_await bindLiveBroadcastTask(curlExecutor_.get(), accessToken, broadcastId, streamId, mask);
+}
+
+Async::Task<YouTubeLiveBroadcast> YouTubeApiClient::transitionLiveBroadcastAsync(std::string accessToken,
+										 std::string broadcastId,
+										 std::string broadcastStatus,
+										 YouTubeFieldMask mask)
+{
+	co_return co_await transitionLiveBroadcastTask(curlExecutor_.get(), accessToken, broadcastId,
+						       broadcastStatus, mask);
+}
+
+Async::Task<void> YouTubeApiClient::setThumbnailAsync(std::string accessToken, std::string videoId,
+						      std::filesystem::path thumbnailPath, YouTubeFieldMask mask)
+{
+	co_await setThumbnailTask(curlExecutor_.get(), accessToken, videoId, thumbnailPath, mask);
+}
+
+Async::Task<void> YouTubeApiClient::setThumbnailAsync(std::string accessToken, std::string videoId,
+						      std::shared_ptr<const YouTubeUploadSource> thumbnail,
+						      YouTubeFieldMask mask)
+{
+	if (!thumbnail) {
+		logger_->error("ThumbnailIsNullError");
+		throw std::invalid_argument("ThumbnailIsNullError(YouTubeApiClient::setThumbnailAsync)");
+	}
+	co_await uploadThumbnailTask(curlExecutor_.get(), accessToken, videoId, *thumbnail, mask);
+}
+
+Async::Generator<YouTubeLiveStream> YouTubeApiClient::iterateLiveStreamsOn(CurlHelper::CurlMultiExecutor *curlExecutor,
+									    const std::string &accessToken,
+									    const YouTubeFieldMask &mask)
+{
+	if (accessToken.empty()) {
+		logger_->error("AccessTokenIsEmptyError");
+		throw std::invalid_argument("AccessTokenIsEmptyError(YouTubeApiClient::iterateLiveStreams)");
+	}
+
+	CurlHelper::CurlConnectionPool::Lease curl = curlPool_->checkout();
+
+	YouTubeRequestUrl url(curl.getUrlBuffer());
+	url.reset(YouTubeEndpoint::kLiveStreams);
+	appendListFieldMask(url, "id,snippet,cdn,status", mask);
+	url.append("mine", "true");
+
+	return iterateList<YouTubeLiveStream>(requestScheduler_, YouTubeApiMethod::LiveStreamsList, requestPriority_,
+					      std::move(curl), curlExecutor, authHeaders_.get(accessToken),
+					      shouldAbort_, logger_);
+}
+
+Async::Generator<YouTubeLiveBroadcast>
+YouTubeApiClient::iterateLiveBroadcastsByStatusOn(CurlHelper::CurlMultiExecutor *curlExecutor,
+						  const std::string &accessToken, const std::string &broadcastStatus,
+						  const YouTubeFieldMask &mask)
+{
+	if (accessToken.empty()) {
+		logger_->error("AccessTokenIsEmptyError");
+		throw std::invalid_argument(
+			"AccessTokenIsEmptyError(YouTubeApiClient::iterateLiveBroadcastsByStatus)");
+	}
+	if (broadcastStatus.empty()) {
+		logger_->error("BroadcastStatusIsEmptyError");
+		throw std::invalid_argument(
+			"BroadcastStatusIsEmptyError(YouTubeApiClient::iterateLiveBroadcastsByStatus)");
+	}
+
+	CurlHelper::CurlConnectionPool::Lease curl = curlPool_->checkout();
+
+	YouTubeRequestUrl url(curl.getUrlBuffer());
+	url.reset(YouTubeEndpoint::kLiveBroadcasts);
+	appendListFieldMask(url, "id,snippet,contentDetails,status", mask);
+	url.append("broadcastStatus", broadcastStatus);
+
+	return iterateList<YouTubeLiveBroadcast>(requestScheduler_, YouTubeApiMethod::LiveBroadcastsList,
+						 requestPriority_, std::move(curl), curlExecutor,
+						 authHeaders_.get(accessToken), shouldAbort_, logger_);
+}
+
+Async::Generator<YouTubeLiveStream> YouTubeApiClient::iterateLiveStreams(const std::string &accessToken,
+									 const YouTubeFieldMask &mask)
+{
+	return iterateLiveStreamsOn(nullptr, accessToken, mask);
+}
+
+Async::Generator<YouTubeLiveBroadcast>
+YouTubeApiClient::iterateLiveBroadcastsByStatus(const std::string &accessToken, const std::string &broadcastStatus,
+						const YouTubeFieldMask &mask)
+{
+	return iterateLiveBroadcastsByStatusOn(nullptr, accessToken, broadcastStatus, mask);
+}
+
+Async::Generator<YouTubeLiveStream> YouTubeApiClient::iterateLiveStreamsAsync(const std::string &accessToken,
+									      const YouTubeFieldMask &mask)
+{
+	return iterateLiveStreamsOn(curlExecutor_.get(), accessToken, mask);
+}
+
+Async::Generator<YouTubeLiveBroadcast>
+YouTubeApiClient::iterateLiveBroadcastsByStatusAsync(const std::string &accessToken, const std::string &broadcastStatus,
+						     const YouTubeFieldMask &mask)
+{
+	return iterateLiveBroadcastsByStatusOn(curlExecutor_.get(), accessToken, broadcastStatus, mask);
+}
+
 } // namespace KaitoTokyo::YouTubeApi
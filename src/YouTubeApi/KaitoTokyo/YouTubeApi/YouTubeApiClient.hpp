@@ -25,53 +25,250 @@
 
 #pragma once
 
+#include <chrono>
 #include <filesystem>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <span>
+#include <stdexcept>
 #include <string_view>
 #include <string>
 #include <vector>
 
-#include <KaitoTokyo/CurlHelper/CurlHandle.hpp>
+#include <KaitoTokyo/Async/Generator.hpp>
+#include <KaitoTokyo/Async/Task.hpp>
+#include <KaitoTokyo/CurlHelper/CurlConnectionPool.hpp>
+#include <KaitoTokyo/CurlHelper/CurlMultiExecutor.hpp>
 #include <KaitoTokyo/Logger/ILogger.hpp>
 
+#include "YouTubeListCache.hpp"
+#include "YouTubeRequestBuilder.hpp"
+#include "YouTubeRequestScheduler.hpp"
 #include "YouTubeTypes.hpp"
+#include "YouTubeUploadSource.hpp"
 
 namespace KaitoTokyo::YouTubeApi {
 
 class YouTubeApiClient {
 public:
-	YouTubeApiClient(std::shared_ptr<CurlHelper::CurlHandle> curl);
+	/**
+	 * Every request checks out its own handle from curlPool, so connections to the API are reused.
+	 */
+	YouTubeApiClient(std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool);
 
 	~YouTubeApiClient() noexcept;
 
 	void setLogger(std::shared_ptr<const Logger::ILogger> logger) { logger_ = std::move(logger); }
 
+	/**
+	 * Makes in-flight requests fail with CurlPerformAborted once shouldAbort returns true.
+	 * shouldAbort is polled from the calling thread while a request is running.
+	 */
+	void setAbortPredicate(std::function<bool()> shouldAbort) { shouldAbort_ = std::move(shouldAbort); }
+
+	/**
+	 * Runs the transfers of the *Async variants on curlExecutor instead of the awaiting thread.
+	 * Without one, the *Async variants block the awaiting thread like the plain methods do.
+	 */
+	void setMultiExecutor(std::shared_ptr<CurlHelper::CurlMultiExecutor> curlExecutor)
+	{
+		curlExecutor_ = std::move(curlExecutor);
+	}
+
+	/**
+	 * List responses are cached with their ETags and revalidated with If-None-Match on every call.
+	 * Within maxStaleness of the last validation, a cached response is returned without a request.
+	 */
+	void setListCacheMaxStaleness(std::chrono::milliseconds maxStaleness) { listCacheMaxStaleness_ = maxStaleness; }
+
+	/**
+	 * Every request waits for a permit from requestScheduler and is retried through it after retryable
+	 * failures. Share one scheduler between the clients that spend the same quota; by default each
+	 * client has its own.
+	 */
+	void setRequestScheduler(std::shared_ptr<YouTubeRequestScheduler> requestScheduler)
+	{
+		if (!requestScheduler) {
+			throw std::invalid_argument(
+				"RequestSchedulerIsNullError(YouTubeApiClient::setRequestScheduler)");
+		}
+		requestScheduler_ = std::move(requestScheduler);
+	}
+
+	const std::shared_ptr<YouTubeRequestScheduler> &getRequestScheduler() const noexcept
+	{
+		return requestScheduler_;
+	}
+
+	/**
+	 * Priority of the requests made through this client while they wait for the scheduler.
+	 */
+	void setRequestPriority(YouTubeRequestPriority priority) { requestPriority_ = priority; }
+
 	std::vector<YouTubeLiveStream> listLiveStreams(const std::string &accessToken,
-						       std::span<const std::string> ids = {});
+						       std::span<const std::string> ids = {},
+						       const YouTubeFieldMask &mask = {});
+
+	std::vector<YouTubeLiveBroadcast> listLiveBroadcasts(const std::string &accessToken,
+							     std::span<const std::string> ids,
+							     const YouTubeFieldMask &mask = {});
 
 	std::vector<YouTubeLiveBroadcast> listLiveBroadcastsByStatus(const std::string &accessToken,
-								     const std::string &broadcastStatus);
+								     const std::string &broadcastStatus,
+								     const YouTubeFieldMask &mask = {});
 
 	YouTubeLiveBroadcast insertLiveBroadcast(const std::string &accessToken,
-						 const InsertingYouTubeLiveBroadcast &insertingLiveBroadcast);
+						 const InsertingYouTubeLiveBroadcast &insertingLiveBroadcast,
+						 const YouTubeFieldMask &mask = {});
 
 	YouTubeLiveBroadcast updateLiveBroadcast(const std::string &accessToken,
-						 const UpdatingYouTubeLiveBroadcast &updatingLiveBroadcast);
+						 const UpdatingYouTubeLiveBroadcast &updatingLiveBroadcast,
+						 const YouTubeFieldMask &mask = {});
 
 	YouTubeLiveBroadcast bindLiveBroadcast(const std::string &accessToken, const std::string &broadcastId,
-					       const std::optional<std::string> &streamId);
+					       const std::optional<std::string> &streamId,
+					       const YouTubeFieldMask &mask = {});
 
 	YouTubeLiveBroadcast transitionLiveBroadcast(const std::string &accessToken, const std::string &broadcastId,
-						     const std::string &broadcastStatus);
+						     const std::string &broadcastStatus,
+						     const YouTubeFieldMask &mask = {});
+
+	/**
+	 * Thumbnails are sent with the resumable upload protocol, so a retry after a dropped connection
+	 * only sends the bytes YouTube has not acknowledged. A file is memory-mapped rather than read.
+	 */
+	void setThumbnail(const std::string &accessToken, const std::string &videoId,
+			  const std::filesystem::path &thumbnailPath, const YouTubeFieldMask &mask = {});
+
 	void setThumbnail(const std::string &accessToken, const std::string &videoId,
-			  const std::filesystem::path &thumbnailPath);
+			  const YouTubeUploadSource &thumbnail, const YouTubeFieldMask &mask = {});
+
+	// Coroutine variants of the methods above. With a multi executor set they resume on its poll
+	// thread once the response has arrived. The client, and whatever a field mask points at, must
+	// outlive the returned tasks; masks are normally string literals.
+
+	Async::Task<std::vector<YouTubeLiveStream>> listLiveStreamsAsync(std::string accessToken,
+									 std::vector<std::string> ids = {},
+									 YouTubeFieldMask mask = {});
+
+	Async::Task<std::vector<YouTubeLiveBroadcast>> listLiveBroadcastsAsync(std::string accessToken,
+									       std::vector<std::string> ids,
+									       YouTubeFieldMask mask = {});
+
+	Async::Task<std::vector<YouTubeLiveBroadcast>> listLiveBroadcastsByStatusAsync(std::string accessToken,
+										       std::string broadcastStatus,
+										       YouTubeFieldMask mask = {});
+
+	Async::Task<YouTubeLiveBroadcast>
+	insertLiveBroadcastAsync(std::string accessToken, InsertingYouTubeLiveBroadcast insertingLiveBroadcast,
+				 YouTubeFieldMask mask = {});
+
+	Async::Task<YouTubeLiveBroadcast>
+	updateLiveBroadcastAsync(std::string accessToken, UpdatingYouTubeLiveBroadcast updatingLiveBroadcast,
+				 YouTubeFieldMask mask = {});
+
+	Async::Task<YouTubeLiveBroadcast> bindLiveBroadcastAsync(std::string accessToken, std::string broadcastId,
+								 std::optional<std::string> streamId,
+								 YouTubeFieldMask mask = {});
+
+	Async::Task<YouTubeLiveBroadcast> transitionLiveBroadcastAsync(std::string accessToken, std::string broadcastId,
+								       std::string broadcastStatus,
+								       YouTubeFieldMask mask = {});
+
+	Async::Task<void> setThumbnailAsync(std::string accessToken, std::string videoId,
+					    std::filesystem::path thumbnailPath, YouTubeFieldMask mask = {});
+
+	Async::Task<void> setThumbnailAsync(std::string accessToken, std::string videoId,
+					    std::shared_ptr<const YouTubeUploadSource> thumbnail,
+					    YouTubeFieldMask mask = {});
+
+	// Lazy variants that request the next page only once the previous one has been consumed, so a
+	// caller can stop as soon as it has found what it needs. Without the Async suffix transfers run
+	// inline and nextInline() can be used; with it they run on the multi executor if one is set.
+	// These bypass the list cache and stay valid after the client is destroyed.
+
+	Async::Generator<YouTubeLiveStream> iterateLiveStreams(const std::string &accessToken,
+							       const YouTubeFieldMask &mask = {});
+
+	Async::Generator<YouTubeLiveBroadcast> iterateLiveBroadcastsByStatus(const std::string &accessToken,
+									     const std::string &broadcastStatus,
+									     const YouTubeFieldMask &mask = {});
+
+	Async::Generator<YouTubeLiveStream> iterateLiveStreamsAsync(const std::string &accessToken,
+								    const YouTubeFieldMask &mask = {});
+
+	Async::Generator<YouTubeLiveBroadcast> iterateLiveBroadcastsByStatusAsync(const std::string &accessToken,
+										  const std::string &broadcastStatus,
+										  const YouTubeFieldMask &mask = {});
 
 private:
-	std::shared_ptr<CurlHelper::CurlHandle> curl_;
+	// Shared implementations; a null curlExecutor performs every transfer inline.
+
+	Async::Task<std::vector<YouTubeLiveStream>> listLiveStreamsTask(CurlHelper::CurlMultiExecutor *curlExecutor,
+									const std::string &accessToken,
+									std::span<const std::string> ids,
+									const YouTubeFieldMask &mask);
+
+	Async::Task<std::vector<YouTubeLiveBroadcast>>
+	listLiveBroadcastsTask(CurlHelper::CurlMultiExecutor *curlExecutor, const std::string &accessToken,
+			       std::span<const std::string> ids, const YouTubeFieldMask &mask);
+
+	Async::Task<std::vector<YouTubeLiveBroadcast>>
+	listLiveBroadcastsByStatusTask(CurlHelper::CurlMultiExecutor *curlExecutor, const std::string &accessToken,
+				       const std::string &broadcastStatus, const YouTubeFieldMask &mask);
+
+	Async::Task<YouTubeLiveBroadcast>
+	insertLiveBroadcastTask(CurlHelper::CurlMultiExecutor *curlExecutor, const std::string &accessToken,
+				const InsertingYouTubeLiveBroadcast &insertingLiveBroadcast,
+				const YouTubeFieldMask &mask);
+
+	Async::Task<YouTubeLiveBroadcast>
+	updateLiveBroadcastTask(CurlHelper::CurlMultiExecutor *curlExecutor, const std::string &accessToken,
+				const UpdatingYouTubeLiveBroadcast &updatingLiveBroadcast,
+				const YouTubeFieldMask &mask);
+
+	Async::Task<YouTubeLiveBroadcast> bindLiveBroadcastTask(CurlHelper::CurlMultiExecutor *curlExecutor,
+								const std::string &accessToken,
+								const std::string &broadcastId,
+								const std::optional<std::string> &streamId,
+								const YouTubeFieldMask &mask);
+
+	Async::Task<YouTubeLiveBroadcast> transitionLiveBroadcastTask(CurlHelper::CurlMultiExecutor *curlExecutor,
+								      const std::string &accessToken,
+								      const std::string &broadcastId,
+								      const std::string &broadcastStatus,
+								      const YouTubeFieldMask &mask);
+
+	Async::Task<void> setThumbnailTask(CurlHelper::CurlMultiExecutor *curlExecutor, const std::string &accessToken,
+					   const std::string &videoId, const std::filesystem::path &thumbnailPath,
+					   const YouTubeFieldMask &mask);
+
+	Async::Task<void> uploadThumbnailTask(CurlHelper::CurlMultiExecutor *curlExecutor,
+					      const std::string &accessToken, const std::string &videoId,
+					      const YouTubeUploadSource &thumbnail, const YouTubeFieldMask &mask);
+
+	Async::Generator<YouTubeLiveStream> iterateLiveStreamsOn(CurlHelper::CurlMultiExecutor *curlExecutor,
+								 const std::string &accessToken,
+								 const YouTubeFieldMask &mask);
+
+	Async::Generator<YouTubeLiveBroadcast>
+	iterateLiveBroadcastsByStatusOn(CurlHelper::CurlMultiExecutor *curlExecutor, const std::string &accessToken,
+					const std::string &broadcastStatus, const YouTubeFieldMask &mask);
+
+	std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool_;
+	std::shared_ptr<CurlHelper::CurlMultiExecutor> curlExecutor_;
+	YouTubeAuthHeaderCache authHeaders_;
+
+	YouTubeListCache<YouTubeLiveStream> liveStreamCache_;
+	YouTubeListCache<YouTubeLiveBroadcast> liveBroadcastCache_;
+	std::chrono::milliseconds listCacheMaxStaleness_{0};
+
+	std::shared_ptr<YouTubeRequestScheduler> requestScheduler_;
+	YouTubeRequestPriority requestPriority_ = YouTubeRequestPriority::Normal;
 
 	std::shared_ptr<const Logger::ILogger> logger_;
+	std::function<bool()> shouldAbort_;
 };
 
 } // namespace KaitoTokyo::YouTubeApi
@@ -25,12 +25,103 @@
 
 #include "YouTubeApiClient.hpp"
 
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
 #include <utility>
+#include <vector>
+
+#include <KaitoTokyo/Async/Join.hpp>
+
+#include "YouTubeMockProfile.hpp"
 
 namespace KaitoTokyo::YouTubeApi {
 
-YouTubeApiClient::YouTubeApiClient(std::shared_ptr<CurlHelper::CurlHandle> curl)
-	: curl_(std::move(curl)),
+namespace {
+
+template<typename T> Async::Generator<T> yieldAll(std::vector<T> items)
+{
+	for (T &item : items) {
+		co_yield std::move(item);
+	}
+}
+
+Async::Task<void> acquirePermit(YouTubeRequestScheduler &scheduler, YouTubeApiMethod method,
+				YouTubeRequestPriority priority, YouTubeRequestScheduler::Clock::time_point notBefore,
+				const std::function<bool()> &shouldAbort)
+{
+	co_await scheduler.acquire(method, priority, notBefore, shouldAbort, true);
+}
+
+// Admits, delays, fails and retries the call the way a real request would be, following the installed
+// YouTubeMockProfile, and then answers it with respond().
+template<typename F>
+std::invoke_result_t<F> performMocked(YouTubeRequestScheduler &scheduler, YouTubeApiMethod method,
+				      YouTubeRequestPriority priority, const std::function<bool()> &shouldAbort,
+				      const std::shared_ptr<const Logger::ILogger> &logger, F respond)
+{
+	YouTubeRequestScheduler::Clock::time_point notBefore{};
+	for (int attempts = 1;; ++attempts) {
+		Async::join(acquirePermit(scheduler, method, priority, notBefore, shouldAbort));
+		try {
+			simulateYouTubeMockCall(method, shouldAbort);
+			return respond();
+		} catch (const YouTubeRetryableError &e) {
+			if (!scheduler.shouldRetry(method, e.getFailure(), attempts)) {
+				throw;
+			}
+
+			const std::chrono::milliseconds delay = scheduler.nextBackoff(attempts);
+			if (logger) {
+				logger->warn("YouTubeApiRequestRetrying",
+					     {{"method", getYouTubeApiMethodPolicy(method).name},
+					      {"attempts", std::to_string(attempts)},
+					      {"delayMilliseconds", std::to_string(delay.count())},
+					      {"exception", e.what()}});
+			}
+			notBefore = YouTubeRequestScheduler::Clock::now() + delay;
+		}
+	}
+}
+
+// Every live stream is an RTMP stream whose key is derived from its id.
+YouTubeLiveStream makeMockedLiveStream(const std::string &id)
+{
+	const std::shared_ptr<const YouTubeMockProfile> profile = getYouTubeMockProfile();
+
+	YouTubeLiveStream stream;
+	stream.id = id;
+	stream.snippet.title = "Mocked Stream";
+	stream.cdn.ingestionType = "rtmp";
+	stream.cdn.ingestionInfo.streamName = id + "-key";
+	stream.status.emplace();
+	stream.status->streamStatus =
+		!profile->isLiveStreamActive || profile->isLiveStreamActive(id) ? "active" : "ready";
+	return stream;
+}
+
+YouTubeLiveBroadcast makeMockedLiveBroadcast(std::string id, std::string title, std::string lifeCycleStatus)
+{
+	YouTubeLiveBroadcast broadcast;
+	broadcast.id = std::move(id);
+	broadcast.snippet.emplace();
+	broadcast.snippet->title = std::move(title);
+	broadcast.status.emplace();
+	broadcast.status->lifeCycleStatus = std::move(lifeCycleStatus);
+	return broadcast;
+}
+
+// Inserted broadcasts get distinct ids, so a session can tell its segments apart.
+std::atomic<std::uint64_t> insertedLiveBroadcastCount{0};
+
+} // anonymous namespace
+
+YouTubeApiClient::YouTubeApiClient(std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool)
+	: curlPool_(std::move(curlPool)),
+	  requestScheduler_(std::make_shared<YouTubeRequestScheduler>()),
 	  logger_(nullptr)
 {
 }
@@ -38,80 +129,221 @@ YouTubeApiClient::YouTubeApiClient(std::shared_ptr<CurlHelper::CurlHandle> curl)
 YouTubeApiClient::~YouTubeApiClient() noexcept = default;
 
 std::vector<YouTubeLiveStream> YouTubeApiClient::listLiveStreams([[maybe_unused]] const std::string &accessToken,
-								 [[maybe_unused]] std::span<const std::string> ids)
+								 std::span<const std::string> ids,
+								 [[maybe_unused]] const YouTubeFieldMask &mask)
 {
-	YouTubeLiveStream stream;
-	stream.id = "mocked_stream_id";
-	stream.snippet.title = "Mocked Stream";
-	return {stream};
+	const auto respond = [ids]() {
+		if (ids.empty()) {
+			return std::vector<YouTubeLiveStream>{makeMockedLiveStream("mocked_stream_id")};
+		}
+		std::vector<YouTubeLiveStream> streams;
+		for (const std::string &id : ids) {
+			streams.push_back(makeMockedLiveStream(id));
+		}
+		return streams;
+	};
+	return performMocked(*requestScheduler_, YouTubeApiMethod::LiveStreamsList, requestPriority_, shouldAbort_,
+			     logger_, respond);
+}
+
+std::vector<YouTubeLiveBroadcast> YouTubeApiClient::listLiveBroadcasts([[maybe_unused]] const std::string &accessToken,
+								       std::span<const std::string> ids,
+								       [[maybe_unused]] const YouTubeFieldMask &mask)
+{
+	const auto respond = [ids]() {
+		std::vector<YouTubeLiveBroadcast> broadcasts;
+		for (const std::string &id : ids) {
+			broadcasts.push_back(makeMockedLiveBroadcast(id, "Mocked Broadcast", "testing"));
+		}
+		return broadcasts;
+	};
+	return performMocked(*requestScheduler_, YouTubeApiMethod::LiveBroadcastsList, requestPriority_, shouldAbort_,
+			     logger_, respond);
 }
 
 std::vector<YouTubeLiveBroadcast>
 YouTubeApiClient::listLiveBroadcastsByStatus([[maybe_unused]] const std::string &accessToken,
-					     [[maybe_unused]] const std::string &broadcastStatus)
+					     [[maybe_unused]] const std::string &broadcastStatus,
+					     [[maybe_unused]] const YouTubeFieldMask &mask)
 {
-	YouTubeLiveBroadcast broadcast;
-	broadcast.id = "mocked_broadcast_id";
-	if (!broadcast.snippet)
+	const auto respond = []() {
+		YouTubeLiveBroadcast broadcast;
+		broadcast.id = "mocked_broadcast_id";
 		broadcast.snippet.emplace();
-	broadcast.snippet->title = "Mocked Broadcast";
-	return {broadcast};
+		broadcast.snippet->title = "Mocked Broadcast";
+		return std::vector<YouTubeLiveBroadcast>{broadcast};
+	};
+	return performMocked(*requestScheduler_, YouTubeApiMethod::LiveBroadcastsList, requestPriority_, shouldAbort_,
+			     logger_, respond);
 }
 
 YouTubeLiveBroadcast
 YouTubeApiClient::insertLiveBroadcast([[maybe_unused]] const std::string &accessToken,
-				      [[maybe_unused]] const InsertingYouTubeLiveBroadcast &insertingLiveBroadcast)
+				      const InsertingYouTubeLiveBroadcast &insertingLiveBroadcast,
+				      [[maybe_unused]] const YouTubeFieldMask &mask)
 {
-	YouTubeLiveBroadcast broadcast;
-	broadcast.id = "mocked_inserted_broadcast_id";
-	if (!broadcast.snippet)
-		broadcast.snippet.emplace();
-	broadcast.snippet->title = insertingLiveBroadcast.snippet.title;
-	return broadcast;
+	const auto respond = [&insertingLiveBroadcast]() {
+		const std::uint64_t index = insertedLiveBroadcastCount.fetch_add(1) + 1;
+		return makeMockedLiveBroadcast("mocked_inserted_broadcast_id_" + std::to_string(index),
+					       insertingLiveBroadcast.snippet.title, "created");
+	};
+	return performMocked(*requestScheduler_, YouTubeApiMethod::LiveBroadcastsInsert, requestPriority_,
+			     shouldAbort_, logger_, respond);
 }
 
-YouTubeLiveBroadcast
-YouTubeApiClient::updateLiveBroadcast([[maybe_unused]] const std::string &accessToken,
-				      [[maybe_unused]] const UpdatingYouTubeLiveBroadcast &updatingLiveBroadcast)
+YouTubeLiveBroadcast YouTubeApiClient::updateLiveBroadcast([[maybe_unused]] const std::string &accessToken,
+							   const UpdatingYouTubeLiveBroadcast &updatingLiveBroadcast,
+							   [[maybe_unused]] const YouTubeFieldMask &mask)
 {
-	YouTubeLiveBroadcast broadcast;
-	broadcast.id = updatingLiveBroadcast.id;
-	if (!broadcast.snippet)
+	const auto respond = [&updatingLiveBroadcast]() {
+		YouTubeLiveBroadcast broadcast;
+		broadcast.id = updatingLiveBroadcast.id;
 		broadcast.snippet.emplace();
-	if (updatingLiveBroadcast.snippet.title)
-		broadcast.snippet->title = *updatingLiveBroadcast.snippet.title;
-	return broadcast;
+		if (updatingLiveBroadcast.snippet.title)
+			broadcast.snippet->title = *updatingLiveBroadcast.snippet.title;
+		return broadcast;
+	};
+	return performMocked(*requestScheduler_, YouTubeApiMethod::LiveBroadcastsUpdate, requestPriority_,
+			     shouldAbort_, logger_, respond);
 }
 
 YouTubeLiveBroadcast YouTubeApiClient::bindLiveBroadcast([[maybe_unused]] const std::string &accessToken,
 							 const std::string &broadcastId,
-							 [[maybe_unused]] const std::optional<std::string> &streamId)
+							 const std::optional<std::string> &streamId,
+							 [[maybe_unused]] const YouTubeFieldMask &mask)
 {
-	YouTubeLiveBroadcast broadcast;
-	broadcast.id = broadcastId;
-	if (!broadcast.snippet)
-		broadcast.snippet.emplace();
-	broadcast.snippet->title = "Bound Broadcast";
-	return broadcast;
+	const auto respond = [&broadcastId, &streamId]() {
+		YouTubeLiveBroadcast broadcast = makeMockedLiveBroadcast(broadcastId, "Bound Broadcast", "ready");
+		broadcast.contentDetails.emplace();
+		broadcast.contentDetails->boundStreamId = streamId;
+		return broadcast;
+	};
+	return performMocked(*requestScheduler_, YouTubeApiMethod::LiveBroadcastsBind, requestPriority_, shouldAbort_,
+			     logger_, respond);
 }
 
 YouTubeLiveBroadcast YouTubeApiClient::transitionLiveBroadcast([[maybe_unused]] const std::string &accessToken,
-							       [[maybe_unused]] const std::string &broadcastId,
-							       [[maybe_unused]] const std::string &broadcastStatus)
+							       const std::string &broadcastId,
+							       const std::string &broadcastStatus,
+							       [[maybe_unused]] const YouTubeFieldMask &mask)
 {
-	YouTubeLiveBroadcast broadcast;
-	broadcast.id = broadcastId;
-	if (!broadcast.snippet)
-		broadcast.snippet.emplace();
-	broadcast.snippet->title = "Transitioned Broadcast";
-	return broadcast;
+	const auto respond = [&broadcastId, &broadcastStatus]() {
+		return makeMockedLiveBroadcast(broadcastId, "Transitioned Broadcast", broadcastStatus);
+	};
+	return performMocked(*requestScheduler_, YouTubeApiMethod::LiveBroadcastsTransition, requestPriority_,
+			     shouldAbort_, logger_, respond);
 }
 
 void YouTubeApiClient::setThumbnail([[maybe_unused]] const std::string &accessToken,
 				    [[maybe_unused]] const std::string &videoId,
-				    [[maybe_unused]] const std::filesystem::path &thumbnailPath)
+				    [[maybe_unused]] const std::filesystem::path &thumbnailPath,
+				    [[maybe_unused]] const YouTubeFieldMask &mask)
+{
+	performMocked(*requestScheduler_, YouTubeApiMethod::ThumbnailsSet, requestPriority_, shouldAbort_, logger_,
+		      []() {});
+}
+
+void YouTubeApiClient::setThumbnail([[maybe_unused]] const std::string &accessToken,
+				    [[maybe_unused]] const std::string &videoId,
+				    [[maybe_unused]] const YouTubeUploadSource &thumbnail,
+				    [[maybe_unused]] const YouTubeFieldMask &mask)
+{
+	performMocked(*requestScheduler_, YouTubeApiMethod::ThumbnailsSet, requestPriority_, shouldAbort_, logger_,
+		      []() {});
+}
+
+// The coroutine variants answer on the awaiting thread, which also sleeps through the simulated latency.
+
+Async::Task<std::vector<YouTubeLiveStream>> YouTubeApiClient::listLiveStreamsAsync(std::string accessToken,
+										   std::vector<std::string> ids,
+										   YouTubeFieldMask mask)
+{
+	co_return listLiveStreams(accessToken, ids, mask);
+}
+
+Async::Task<std::vector<YouTubeLiveBroadcast>> YouTubeApiClient::listLiveBroadcastsAsync(std::string accessToken,
+											 std::vector<std::string> ids,
+											 YouTubeFieldMask mask)
+{
+	co_return listLiveBroadcasts(accessToken, ids, mask);
+}
+
+Async::Task<std::vector<YouTubeLiveBroadcast>>
+YouTubeApiClient::listLiveBroadcastsByStatusAsync(std::string accessToken, std::string broadcastStatus,
+						  YouTubeFieldMask mask)
+{
+	co_return listLiveBroadcastsByStatus(accessToken, broadcastStatus, mask);
+}
+
+Async::Task<YouTubeLiveBroadcast>
+YouTubeApiClient::insertLiveBroadcastAsync(std::string accessToken,
+					   InsertingYouTubeLiveBroadcast insertingLiveBroadcast, YouTubeFieldMask mask)
+{
+	co_return insertLiveBroadcast(accessToken, insertingLiveBroadcast, mask);
+}
+
+Async::Task<YouTubeLiveBroadcast>
+YouTubeApiClient::updateLiveBroadcastAsync(std::string accessToken,
+					   UpdatingYouTubeLiveBroadcast updatingLiveBroadcast, YouTubeFieldMask mask)
+{
+	co_return updateLiveBroadcast(accessToken, updatingLiveBroadcast, mask);
+}
+
+Async::Task<YouTubeLiveBroadcast> YouTubeApiClient::bindLiveBroadcastAsync(std::string accessToken,
+									   std::string broadcastId,
+									   std::optional<std::string> streamId,
+									   YouTubeFieldMask mask)
+{
+	co_return bindLiveBroadcast(accessToken, broadcastId, streamId, mask);
+}
+
+Async::Task<YouTubeLiveBroadcast> YouTubeApiClient::transitionLiveBroadcastAsync(std::string accessToken,
+										 std::string broadcastId,
+										 std::string broadcastStatus,
+										 YouTubeFieldMask mask)
+{
+	co_return transitionLiveBroadcast(accessToken, broadcastId, broadcastStatus, mask);
+}
+
+Async::Task<void> YouTubeApiClient::setThumbnailAsync(std::string accessToken, std::string videoId,
+						      std::filesystem::path thumbnailPath, YouTubeFieldMask mask)
+{
+	setThumbnail(accessToken, videoId, thumbnailPath, mask);
+	co_return;
+}
+
+Async::Task<void> YouTubeApiClient::setThumbnailAsync(std::string accessToken, std::string videoId,
+						      std::shared_ptr<const YouTubeUploadSource> thumbnail,
+						      YouTubeFieldMask mask)
+{
+	setThumbnail(accessToken, videoId, *thumbnail, mask);
+	co_return;
+}
+
+Async::Generator<YouTubeLiveStream> YouTubeApiClient::iterateLiveStreams(const std::string &accessToken,
+									 const YouTubeFieldMask &mask)
+{
+	return yieldAll(listLiveStreams(accessToken, {}, mask));
+}
+
+Async::Generator<YouTubeLiveBroadcast>
+YouTubeApiClient::iterateLiveBroadcastsByStatus(const std::string &accessToken, const std::string &broadcastStatus,
+						const YouTubeFieldMask &mask)
+{
+	return yieldAll(listLiveBroadcastsByStatus(accessToken, broadcastStatus, mask));
+}
+
+Async::Generator<YouTubeLiveStream> YouTubeApiClient::iterateLiveStreamsAsync(const std::string &accessToken,
+									      const YouTubeFieldMask &mask)
+{
+	return iterateLiveStreams(accessToken, mask);
+}
+
+Async::Generator<YouTubeLiveBroadcast>
+YouTubeApiClient::iterateLiveBroadcastsByStatusAsync(const std::string &accessToken, const std::string &broadcastStatus,
+						     const YouTubeFieldMask &mask)
 {
-	// Mock implementation does nothing
+	return iterateLiveBroadcastsByStatus(accessToken, broadcastStatus, mask);
 }
 
 } // namespace KaitoTokyo::YouTubeApi
@@ -0,0 +1,497 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * KaitoTokyo YouTubeApi Library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "YouTubeFieldTable.hpp"
+
+namespace KaitoTokyo::YouTubeApi {
+
+namespace YouTubeFieldCodecDetail {
+
+template<typename T> struct IsOptional : std::false_type {};
+template<typename T> struct IsOptional<std::optional<T>> : std::true_type {};
+
+template<typename T> struct IsVector : std::false_type {};
+template<typename T> struct IsVector<std::vector<T>> : std::true_type {};
+
+template<typename T> struct IsStringMap : std::false_type {};
+template<typename T> struct IsStringMap<std::unordered_map<std::string, T>> : std::true_type {};
+
+template<typename T> constexpr std::size_t kFieldCount = std::tuple_size_v<decltype(YouTubeFieldTable<T>::fields)>;
+
+// Calls f with every field of T in table order.
+template<typename T, typename F> constexpr void forEachField(F &&f)
+{
+	std::apply([&](const auto &...field) { (f(field), ...); }, YouTubeFieldTable<T>::fields);
+}
+
+// Calls f with the index and descriptor of the field named key. Returns false when T has no such field.
+template<typename T, typename F> bool visitField(std::string_view key, F &&f)
+{
+	return std::apply(
+		[&](const auto &...field) {
+			std::size_t index = 0;
+			return ((field.name == key ? (f(index, field), true) : (++index, false)) || ...);
+		},
+		YouTubeFieldTable<T>::fields);
+}
+
+template<typename T> constexpr std::uint64_t requiredFieldMask()
+{
+	static_assert(kFieldCount<T> <= 64, "A field table is limited to 64 fields");
+	std::uint64_t mask = 0;
+	std::size_t index = 0;
+	forEachField<T>([&](const auto &field) {
+		if (field.policy & YouTubeFieldRequired) {
+			mask |= std::uint64_t{1} << index;
+		}
+		++index;
+	});
+	return mask;
+}
+
+// Throws for the first required field of T whose bit is not in seen.
+template<typename T> void checkRequiredFields(std::uint64_t seen)
+{
+	constexpr std::uint64_t required = requiredFieldMask<T>();
+	if ((seen & required) == required) {
+		return;
+	}
+	std::size_t index = 0;
+	forEachField<T>([&](const auto &field) {
+		if ((required & ~seen) & (std::uint64_t{1} << index++)) {
+			throw std::runtime_error("MissingFieldError(YouTubeFieldCodec):" + std::string(field.name));
+		}
+	});
+}
+
+[[noreturn]] inline void throwTypeMismatch(const char *expected)
+{
+	throw std::runtime_error(std::string("TypeMismatchError(YouTubeFieldCodec):expected ") + expected);
+}
+
+} // namespace YouTubeFieldCodecDetail
+
+/**
+ * Compares two values field by field through their tables.
+ */
+template<typename T> bool youTubeValuesEqual(const T &a, const T &b)
+{
+	using namespace YouTubeFieldCodecDetail;
+	if constexpr (YouTubeTableDriven<T>) {
+		bool equal = true;
+		forEachField<T>([&](const auto &field) {
+			equal = equal && youTubeValuesEqual(a.*field.member, b.*field.member);
+		});
+		return equal;
+	} else if constexpr (IsOptional<T>::value) {
+		return a.has_value() == b.has_value() && (!a || youTubeValuesEqual(*a, *b));
+	} else if constexpr (IsVector<T>::value) {
+		if (a.size() != b.size()) {
+			return false;
+		}
+		for (std::size_t i = 0; i < a.size(); ++i) {
+			if (!youTubeValuesEqual(a[i], b[i])) {
+				return false;
+			}
+		}
+		return true;
+	} else if constexpr (IsStringMap<T>::value) {
+		if (a.size() != b.size()) {
+			return false;
+		}
+		for (const auto &[key, value] : a) {
+			const auto it = b.find(key);
+			if (it == b.end() || !youTubeValuesEqual(value, it->second)) {
+				return false;
+			}
+		}
+		return true;
+	} else {
+		return a == b;
+	}
+}
+
+template<typename T> void encodeYouTubeValue(nlohmann::json &j, const T &value);
+
+/**
+ * Writes one field of owner into the object j, following its policy.
+ */
+template<typename Owner, typename Member>
+void encodeYouTubeField(nlohmann::json &j, const Owner &owner, const YouTubeField<Owner, Member> &field)
+{
+	const Member &value = owner.*field.member;
+	if constexpr (YouTubeFieldCodecDetail::IsOptional<Member>::value) {
+		if (!value || ((field.policy & YouTubeFieldOmitDefault) &&
+			       youTubeValuesEqual(*value, typename Member::value_type{}))) {
+			return;
+		}
+		encodeYouTubeValue(j[std::string(field.name)], *value);
+	} else {
+		if ((field.policy & YouTubeFieldOmitDefault) && youTubeValuesEqual(value, Member{})) {
+			return;
+		}
+		encodeYouTubeValue(j[std::string(field.name)], value);
+	}
+}
+
+/**
+ * Encodes a value whose type has a field table, or a vector, string map or scalar of such values.
+ */
+template<typename T> void encodeYouTubeValue(nlohmann::json &j, const T &value)
+{
+	using namespace YouTubeFieldCodecDetail;
+	if constexpr (YouTubeTableDriven<T>) {
+		j = nlohmann::json::object();
+		forEachField<T>([&](const auto &field) { encodeYouTubeField(j, value, field); });
+	} else if constexpr (IsVector<T>::value) {
+		j = nlohmann::json::array();
+		for (const auto &element : value) {
+			encodeYouTubeValue(j.emplace_back(), element);
+		}
+	} else if constexpr (IsStringMap<T>::value) {
+		j = nlohmann::json::object();
+		for (const auto &[key, element] : value) {
+			encodeYouTubeValue(j[key], element);
+		}
+	} else {
+		j = value;
+	}
+}
+
+/**
+ * Decodes into out, which should be default-constructed. Keys without a field are ignored; null
+ * stands for an empty object. Throws when a required field is missing or a value has the wrong type.
+ */
+template<typename T> void decodeYouTubeValue(const nlohmann::json &j, T &out)
+{
+	using namespace YouTubeFieldCodecDetail;
+	if constexpr (YouTubeTableDriven<T>) {
+		if (!j.is_object() && !j.is_null()) {
+			throwTypeMismatch("object");
+		}
+		std::uint64_t seen = 0;
+		for (auto it = j.begin(); !j.is_null() && it != j.end(); ++it) {
+			visitField<T>(it.key(), [&](std::size_t index, const auto &field) {
+				seen |= std::uint64_t{1} << index;
+				decodeYouTubeValue(it.value(), out.*field.member);
+			});
+		}
+		checkRequiredFields<T>(seen);
+	} else if constexpr (IsOptional<T>::value) {
+		decodeYouTubeValue(j, out.emplace());
+	} else if constexpr (IsVector<T>::value) {
+		if (!j.is_array()) {
+			throwTypeMismatch("array");
+		}
+		out.clear();
+		out.reserve(j.size());
+		for (const nlohmann::json &element : j) {
+			decodeYouTubeValue(element, out.emplace_back());
+		}
+	} else if constexpr (IsStringMap<T>::value) {
+		if (!j.is_object()) {
+			throwTypeMismatch("object");
+		}
+		for (auto it = j.begin(); it != j.end(); ++it) {
+			decodeYouTubeValue(it.value(), out[it.key()]);
+		}
+	} else {
+		j.get_to(out);
+	}
+}
+
+/**
+ * A JSON scalar as reported by a SAX parser. Strings are passed by pointer so they can be moved.
+ */
+using YouTubeSaxScalar = std::variant<std::nullptr_t, bool, std::int64_t, std::uint64_t, double, std::string *>;
+
+struct YouTubeContainerOps;
+struct YouTubeValueOps;
+
+/**
+ * Where the next SAX value goes. A null target skips the value.
+ */
+struct YouTubeValueSink {
+	void *target = nullptr;
+	const YouTubeValueOps *ops = nullptr;
+};
+
+/**
+ * An object or array being filled from SAX events.
+ */
+struct YouTubeSaxContainer {
+	void *target = nullptr;
+	const YouTubeContainerOps *ops = nullptr;
+};
+
+struct YouTubeValueOps {
+	void (*scalar)(void *target, YouTubeSaxScalar value);
+	YouTubeSaxContainer (*startObject)(void *target);
+	YouTubeSaxContainer (*startArray)(void *target);
+};
+
+struct YouTubeContainerOps {
+	// Objects only. Sets the bit of the field in seen.
+	YouTubeValueSink (*member)(void *target, std::string_view key, std::uint64_t &seen);
+	// Arrays only. Appends an element and returns it.
+	YouTubeValueSink (*element)(void *target);
+	void (*end)(void *target, std::uint64_t seen);
+};
+
+namespace YouTubeFieldCodecDetail {
+
+template<typename T> struct SaxOps {
+	static void scalar(void *target, YouTubeSaxScalar value)
+	{
+		T &out = *static_cast<T *>(target);
+		if constexpr (YouTubeTableDriven<T>) {
+			if (!std::holds_alternative<std::nullptr_t>(value)) {
+				throwTypeMismatch("object");
+			}
+			checkRequiredFields<T>(0);
+		} else if constexpr (IsOptional<T>::value) {
+			// As in decodeYouTubeValue, null makes an empty object but is not a string or number.
+			SaxOps<typename T::value_type>::scalar(&out.emplace(), value);
+		} else if constexpr (std::is_same_v<T, std::string>) {
+			if (std::string *const *text = std::get_if<std::string *>(&value)) {
+				out = std::move(**text);
+			} else {
+				throwTypeMismatch("string");
+			}
+		} else if constexpr (std::is_same_v<T, bool>) {
+			if (const bool *flag = std::get_if<bool>(&value)) {
+				out = *flag;
+			} else {
+				throwTypeMismatch("boolean");
+			}
+		} else if constexpr (std::is_arithmetic_v<T>) {
+			if (const auto *number = std::get_if<std::int64_t>(&value)) {
+				out = static_cast<T>(*number);
+			} else if (const auto *number = std::get_if<std::uint64_t>(&value)) {
+				out = static_cast<T>(*number);
+			} else if (const auto *number = std::get_if<double>(&value)) {
+				out = static_cast<T>(*number);
+			} else {
+				throwTypeMismatch("number");
+			}
+		} else {
+			throwTypeMismatch("container");
+		}
+	}
+
+	static YouTubeSaxContainer startObject(void *target)
+	{
+		T &out = *static_cast<T *>(target);
+		if constexpr (YouTubeTableDriven<T> || IsStringMap<T>::value) {
+			return {&out, &kContainerOps};
+		} else if constexpr (IsOptional<T>::value) {
+			return SaxOps<typename T::value_type>::startObject(&out.emplace());
+		} else {
+			throwTypeMismatch("scalar or array");
+		}
+	}
+
+	static YouTubeSaxContainer startArray(void *target)
+	{
+		T &out = *static_cast<T *>(target);
+		if constexpr (IsVector<T>::value) {
+			out.clear();
+			return {&out, &kContainerOps};
+		} else if constexpr (IsOptional<T>::value) {
+			return SaxOps<typename T::value_type>::startArray(&out.emplace());
+		} else {
+			throwTypeMismatch("scalar or object");
+		}
+	}
+
+	static YouTubeValueSink member(void *target, std::string_view key, std::uint64_t &seen)
+	{
+		T &out = *static_cast<T *>(target);
+		if constexpr (YouTubeTableDriven<T>) {
+			YouTubeValueSink sink;
+			visitField<T>(key, [&](std::size_t index, const auto &field) {
+				using Member = typename std::remove_cvref_t<decltype(field)>::MemberType;
+				seen |= std::uint64_t{1} << index;
+				sink = {&(out.*field.member), &SaxOps<Member>::kValueOps};
+			});
+			return sink;
+		} else if constexpr (IsStringMap<T>::value) {
+			return {&out[std::string(key)], &SaxOps<typename T::mapped_type>::kValueOps};
+		} else {
+			return {};
+		}
+	}
+
+	static YouTubeValueSink element(void *target)
+	{
+		if constexpr (IsVector<T>::value) {
+			T &out = *static_cast<T *>(target);
+			return {&out.emplace_back(), &SaxOps<typename T::value_type>::kValueOps};
+		} else {
+			return {};
+		}
+	}
+
+	static void end([[maybe_unused]] void *target, [[maybe_unused]] std::uint64_t seen)
+	{
+		if constexpr (YouTubeTableDriven<T>) {
+			checkRequiredFields<T>(seen);
+		}
+	}
+
+	static constexpr YouTubeValueOps kValueOps{&scalar, &startObject, &startArray};
+	static constexpr YouTubeContainerOps kContainerOps{&member, &element, &end};
+};
+
+} // namespace YouTubeFieldCodecDetail
+
+/**
+ * Points a YouTubeFieldSaxDecoder at value, which should be default-constructed.
+ */
+template<typename T> YouTubeValueSink makeYouTubeValueSink(T &value)
+{
+	return {&value, &YouTubeFieldCodecDetail::SaxOps<T>::kValueOps};
+}
+
+/**
+ * Decodes one JSON value straight from SAX events into a C++ value, without building a JSON DOM.
+ *
+ * Keys are matched against the field tables as string_views and string values are moved out of the
+ * parser, so each string field costs only the allocation its std::string needs. Keys without a
+ * field are skipped together with everything nested under them.
+ */
+class YouTubeFieldSaxDecoder {
+public:
+	void begin(YouTubeValueSink root)
+	{
+		next_ = root;
+		frames_.clear();
+		skipDepth_ = 0;
+		done_ = false;
+	}
+
+	// Whether the value given to begin() has been closed.
+	bool done() const noexcept { return done_; }
+
+	void scalar(YouTubeSaxScalar value)
+	{
+		if (skipDepth_ > 0) {
+			return;
+		}
+		if (const YouTubeValueSink sink = takeSink(); sink.target) {
+			sink.ops->scalar(sink.target, value);
+		}
+		finishValue();
+	}
+
+	void key(std::string_view key)
+	{
+		if (skipDepth_ > 0) {
+			return;
+		}
+		Frame &frame = frames_.back();
+		next_ = frame.container.ops->member(frame.container.target, key, frame.seen);
+	}
+
+	void startObject() { start(false); }
+
+	void startArray() { start(true); }
+
+	void end()
+	{
+		if (skipDepth_ > 0) {
+			if (--skipDepth_ == 0) {
+				finishValue();
+			}
+			return;
+		}
+		const Frame frame = frames_.back();
+		frames_.pop_back();
+		frame.container.ops->end(frame.container.target, frame.seen);
+		finishValue();
+	}
+
+private:
+	struct Frame {
+		YouTubeSaxContainer container;
+		bool isArray;
+		std::uint64_t seen;
+	};
+
+	YouTubeValueSink takeSink()
+	{
+		if (!frames_.empty() && frames_.back().isArray) {
+			const Frame &frame = frames_.back();
+			return frame.container.ops->element(frame.container.target);
+		}
+		return std::exchange(next_, YouTubeValueSink{});
+	}
+
+	void start(bool isArray)
+	{
+		if (skipDepth_ > 0) {
+			++skipDepth_;
+			return;
+		}
+		const YouTubeValueSink sink = takeSink();
+		if (!sink.target) {
+			skipDepth_ = 1;
+			return;
+		}
+		frames_.push_back({isArray ? sink.ops->startArray(sink.target) : sink.ops->startObject(sink.target),
+				   isArray, 0});
+	}
+
+	void finishValue() noexcept
+	{
+		if (frames_.empty()) {
+			done_ = true;
+		}
+	}
+
+	YouTubeValueSink next_;
+	std::vector<Frame> frames_;
+	int skipDepth_ = 0;
+	bool done_ = false;
+};
+
+} // namespace KaitoTokyo::YouTubeApi
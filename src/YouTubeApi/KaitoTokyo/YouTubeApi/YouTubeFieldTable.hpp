@@ -0,0 +1,73 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * KaitoTokyo YouTubeApi Library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <string_view>
+
+namespace KaitoTokyo::YouTubeApi {
+
+/**
+ * How a field is read and written. Combine with |.
+ */
+enum YouTubeFieldPolicy : unsigned {
+	YouTubeFieldOptional = 0,
+	// Decoding throws when the key is missing.
+	YouTubeFieldRequired = 1u << 0,
+	// Encoding leaves the field out while it holds a default-constructed value.
+	YouTubeFieldOmitDefault = 1u << 1,
+};
+
+/**
+ * Describes one member of a resource: its JSON key and where it lives.
+ */
+template<typename Owner, typename Member> struct YouTubeField {
+	using OwnerType = Owner;
+	using MemberType = Member;
+
+	std::string_view name;
+	Member Owner::*member;
+	unsigned policy;
+};
+
+template<typename Owner, typename Member>
+constexpr YouTubeField<Owner, Member> makeYouTubeField(std::string_view name, Member Owner::*member,
+							 unsigned policy = YouTubeFieldOptional)
+{
+	return {name, member, policy};
+}
+
+/**
+ * The fields of T as a constexpr tuple of YouTubeField, in a static member named fields.
+ *
+ * Specializations live next to the resource types, so every translation unit that decodes T sees the
+ * same table. YouTubeFieldCodec.hpp encodes, decodes and compares through them.
+ */
+template<typename T> struct YouTubeFieldTable;
+
+template<typename T>
+concept YouTubeTableDriven = requires { YouTubeFieldTable<T>::fields; };
+
+} // namespace KaitoTokyo::YouTubeApi
@@ -0,0 +1,129 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * KaitoTokyo YouTubeApi Library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace KaitoTokyo::YouTubeApi {
+
+/**
+ * Decoded list responses keyed by request URL and access token, for conditional requests.
+ *
+ * Entries keep the response ETag so the next request can send If-None-Match and reuse the decoded
+ * items on 304 Not Modified. Keys hold a hash of the access token, never the token itself. When the
+ * capacity is reached the entry validated longest ago is evicted. Thread-safe.
+ */
+template<typename T> class YouTubeListCache {
+public:
+	using Clock = std::chrono::steady_clock;
+
+	struct Entry {
+		std::string etag;
+		std::shared_ptr<const std::vector<T>> items;
+		Clock::time_point validatedAt;
+	};
+
+	explicit YouTubeListCache(std::size_t capacity = 64) : capacity_(capacity) {}
+
+	[[nodiscard]]
+	static std::string makeKey(std::string_view url, std::string_view accessToken)
+	{
+		return std::to_string(std::hash<std::string_view>{}(accessToken)) + ' ' + std::string(url);
+	}
+
+	[[nodiscard]]
+	std::optional<Entry> find(const std::string &key) const
+	{
+		std::scoped_lock lock(mutex_);
+		if (auto it = entries_.find(key); it != entries_.end()) {
+			return it->second;
+		}
+		return std::nullopt;
+	}
+
+	void store(const std::string &key, std::string etag, std::vector<T> items)
+	{
+		auto sharedItems = std::make_shared<const std::vector<T>>(std::move(items));
+
+		std::scoped_lock lock(mutex_);
+		if (!entries_.contains(key) && entries_.size() >= capacity_) {
+			evictOldest();
+		}
+		entries_.insert_or_assign(key, Entry{std::move(etag), std::move(sharedItems), Clock::now()});
+	}
+
+	// Marks the entry as fresh again after the server answered 304 Not Modified.
+	void revalidate(const std::string &key)
+	{
+		std::scoped_lock lock(mutex_);
+		if (auto it = entries_.find(key); it != entries_.end()) {
+			it->second.validatedAt = Clock::now();
+		}
+	}
+
+	void erase(const std::string &key)
+	{
+		std::scoped_lock lock(mutex_);
+		entries_.erase(key);
+	}
+
+	void clear()
+	{
+		std::scoped_lock lock(mutex_);
+		entries_.clear();
+	}
+
+private:
+	void evictOldest()
+	{
+		auto oldest = entries_.begin();
+		for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+			if (it->second.validatedAt < oldest->second.validatedAt) {
+				oldest = it;
+			}
+		}
+		if (oldest != entries_.end()) {
+			entries_.erase(oldest);
+		}
+	}
+
+	const std::size_t capacity_;
+
+	mutable std::mutex mutex_;
+	std::unordered_map<std::string, Entry> entries_;
+};
+
+} // namespace KaitoTokyo::YouTubeApi
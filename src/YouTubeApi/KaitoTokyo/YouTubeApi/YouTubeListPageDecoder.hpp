@@ -0,0 +1,255 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * KaitoTokyo YouTubeApi Library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "YouTubeFieldCodec.hpp"
+
+namespace KaitoTokyo::YouTubeApi {
+
+struct YouTubeListPageInfo {
+	std::string etag;
+	std::string nextPageToken;
+	std::optional<nlohmann::json> error;
+};
+
+namespace YouTubeListPageDecoderDetail {
+
+// Builds one JSON value per element of items and converts it to T as soon as the element closes. When T
+// has a field table, elements are decoded straight into T instead, without the intermediate JSON value.
+// Everything else at the top level except etag, nextPageToken and error is skipped.
+template<typename T> class YouTubeListPageSaxHandler final : public nlohmann::json_sax<nlohmann::json> {
+public:
+	explicit YouTubeListPageSaxHandler(std::vector<T> &items) : items_(items) {}
+
+	bool null() override { return value(nullptr); }
+
+	bool boolean(bool val) override { return value(val); }
+
+	bool number_integer(number_integer_t val) override { return value(val); }
+
+	bool number_unsigned(number_unsigned_t val) override { return value(val); }
+
+	bool number_float(number_float_t val, [[maybe_unused]] const string_t &s) override { return value(val); }
+
+	bool string(string_t &val) override
+	{
+		if (capture_ == Capture::Direct) {
+			decoder_.scalar(&val);
+			return true;
+		}
+		if (capture_ != Capture::None) {
+			return value(std::move(val));
+		}
+		if (depth_ == 1 && key_ == "etag") {
+			info_.etag = std::move(val);
+		} else if (depth_ == 1 && key_ == "nextPageToken") {
+			info_.nextPageToken = std::move(val);
+		}
+		return true;
+	}
+
+	bool binary(binary_t &val) override { return value(nlohmann::json::binary(std::move(val))); }
+
+	bool start_object([[maybe_unused]] std::size_t elements) override
+	{
+		if (capture_ == Capture::Direct) {
+			decoder_.startObject();
+			return true;
+		}
+		if (capture_ == Capture::None) {
+			if (depth_ == 0) {
+				++depth_;
+				return true;
+			}
+			if constexpr (YouTubeTableDriven<T>) {
+				if (depth_ == 2) {
+					capture_ = Capture::Direct;
+					decoder_.begin(makeYouTubeValueSink(items_.emplace_back()));
+					decoder_.startObject();
+					return true;
+				}
+			}
+			capture_ = depth_ == 2 ? Capture::Item : key_ == "error" ? Capture::Error : Capture::Ignored;
+		}
+		open(nlohmann::json::object());
+		return true;
+	}
+
+	bool key(string_t &val) override
+	{
+		if (capture_ == Capture::Direct) {
+			decoder_.key(val);
+		} else if (capture_ != Capture::None) {
+			captureKey_ = std::move(val);
+		} else {
+			key_ = std::move(val);
+		}
+		return true;
+	}
+
+	bool end_object() override { return close(); }
+
+	bool start_array([[maybe_unused]] std::size_t elements) override
+	{
+		if (capture_ == Capture::Direct) {
+			decoder_.startArray();
+			return true;
+		}
+		if (capture_ == Capture::None) {
+			if (depth_ == 1 && key_ == "items") {
+				++depth_;
+				return true;
+			}
+			capture_ = depth_ == 1 && key_ == "error" ? Capture::Error : Capture::Ignored;
+		}
+		open(nlohmann::json::array());
+		return true;
+	}
+
+	bool end_array() override { return close(); }
+
+	bool parse_error([[maybe_unused]] std::size_t position, [[maybe_unused]] const std::string &last_token,
+			 [[maybe_unused]] const nlohmann::detail::exception &ex) override
+	{
+		return false;
+	}
+
+	YouTubeListPageInfo takeInfo() noexcept { return std::move(info_); }
+
+private:
+	enum class Capture { None, Item, Direct, Error, Ignored };
+
+	nlohmann::json &insert(nlohmann::json &parent, nlohmann::json val)
+	{
+		if (parent.is_object()) {
+			return parent[captureKey_] = std::move(val);
+		}
+		parent.push_back(std::move(val));
+		return parent.back();
+	}
+
+	template<typename V> bool value(V &&val)
+	{
+		if constexpr (std::is_constructible_v<YouTubeSaxScalar, V>) {
+			if (capture_ == Capture::Direct) {
+				decoder_.scalar(std::forward<V>(val));
+				return true;
+			}
+		} else if (capture_ == Capture::Direct) {
+			// Binary values never come out of JSON text.
+			return false;
+		}
+		if (capture_ == Capture::None) {
+			return true;
+		}
+		insert(*stack_.back(), nlohmann::json(std::forward<V>(val)));
+		return true;
+	}
+
+	// Containers only ever gain children through the innermost one, so the parent pointers stay valid.
+	void open(nlohmann::json container)
+	{
+		if (stack_.empty()) {
+			captured_ = std::move(container);
+			stack_.push_back(&captured_);
+		} else {
+			stack_.push_back(&insert(*stack_.back(), std::move(container)));
+		}
+	}
+
+	bool close()
+	{
+		if (capture_ == Capture::Direct) {
+			decoder_.end();
+			if (decoder_.done()) {
+				capture_ = Capture::None;
+			}
+			return true;
+		}
+		if (capture_ == Capture::None) {
+			--depth_;
+			return true;
+		}
+
+		stack_.pop_back();
+		if (!stack_.empty()) {
+			return true;
+		}
+
+		if (capture_ == Capture::Item) {
+			items_.push_back(captured_.template get<T>());
+		} else if (capture_ == Capture::Error) {
+			info_.error = std::move(captured_);
+		}
+		captured_ = nullptr;
+		capture_ = Capture::None;
+		return true;
+	}
+
+	std::vector<T> &items_;
+	YouTubeListPageInfo info_;
+
+	int depth_ = 0;
+	std::string key_;
+
+	Capture capture_ = Capture::None;
+	nlohmann::json captured_;
+	std::vector<nlohmann::json *> stack_;
+	std::string captureKey_;
+
+	YouTubeFieldSaxDecoder decoder_;
+};
+
+} // namespace YouTubeListPageDecoderDetail
+
+/**
+ * Decodes one page of a YouTube list response in a single SAX pass, appending its items to items.
+ *
+ * Only one element of items is held as JSON at a time, so a page is never materialized as a whole
+ * document before the conversion to T. Types with a YouTubeFieldTable skip even that and are filled
+ * directly from the parser. Throws on malformed JSON and on items T cannot be read from.
+ */
+template<typename T> YouTubeListPageInfo decodeYouTubeListPage(std::string_view body, std::vector<T> &items)
+{
+	YouTubeListPageDecoderDetail::YouTubeListPageSaxHandler<T> handler(items);
+	if (!nlohmann::json::sax_parse(body.begin(), body.end(), &handler)) {
+		throw std::runtime_error("JsonParseError(decodeYouTubeListPage)");
+	}
+	return handler.takeInfo();
+}
+
+} // namespace KaitoTokyo::YouTubeApi
@@ -0,0 +1,159 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * KaitoTokyo YouTubeApi Library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "YouTubeMockProfile.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+#include <utility>
+
+#include <nlohmann/json.hpp>
+
+namespace KaitoTokyo::YouTubeApi {
+
+namespace {
+
+constexpr YouTubeApiMethod kYouTubeApiMethods[] = {
+	YouTubeApiMethod::LiveStreamsList,      YouTubeApiMethod::LiveBroadcastsList,
+	YouTubeApiMethod::LiveBroadcastsInsert, YouTubeApiMethod::LiveBroadcastsUpdate,
+	YouTubeApiMethod::LiveBroadcastsBind,   YouTubeApiMethod::LiveBroadcastsTransition,
+	YouTubeApiMethod::ThumbnailsSet,        YouTubeApiMethod::ResumableUploadPut,
+};
+
+// Abort predicates are polled this often while a simulated call is waiting.
+constexpr std::chrono::milliseconds kAbortPollInterval{10};
+
+std::chrono::milliseconds getMilliseconds(const nlohmann::json &j, const char *key, std::chrono::milliseconds fallback)
+{
+	return j.contains(key) ? std::chrono::milliseconds{j.at(key).get<std::int64_t>()} : fallback;
+}
+
+YouTubeMockMethodProfile parseMethodProfile(const nlohmann::json &j, const YouTubeMockMethodProfile &fallback)
+{
+	YouTubeMockMethodProfile p = fallback;
+	p.minLatency = getMilliseconds(j, "minLatencyMilliseconds", p.minLatency);
+	p.maxLatency = getMilliseconds(j, "maxLatencyMilliseconds", std::max(p.maxLatency, p.minLatency));
+	p.tailLatency = getMilliseconds(j, "tailLatencyMilliseconds", p.tailLatency);
+	p.tailProbability = j.value("tailProbability", p.tailProbability);
+	p.errorRate = j.value("errorRate", p.errorRate);
+	if (p.maxLatency < p.minLatency) {
+		throw std::invalid_argument("MockLatencyRangeInvalidError(YouTubeMockProfile::from_json)");
+	}
+	return p;
+}
+
+struct MockState {
+	std::mutex mutex;
+	std::shared_ptr<const YouTubeMockProfile> profile = std::make_shared<const YouTubeMockProfile>();
+	std::mt19937_64 generator;
+};
+
+MockState &getMockState()
+{
+	static MockState state;
+	return state;
+}
+
+} // anonymous namespace
+
+void from_json(const nlohmann::json &j, YouTubeMockProfile &p)
+{
+	p.seed = j.value("seed", p.seed);
+	if (j.contains("default")) {
+		p.defaultMethod = parseMethodProfile(j.at("default"), p.defaultMethod);
+	}
+	if (!j.contains("methods")) {
+		return;
+	}
+
+	for (const auto &[name, jMethod] : j.at("methods").items()) {
+		const auto it = std::ranges::find(kYouTubeApiMethods, std::string_view(name),
+						  [](YouTubeApiMethod method) {
+							  return getYouTubeApiMethodPolicy(method).name;
+						  });
+		if (it == std::end(kYouTubeApiMethods)) {
+			throw std::invalid_argument("MockMethodUnknownError(YouTubeMockProfile::from_json)");
+		}
+		p.methods[*it] = parseMethodProfile(jMethod, p.defaultMethod);
+	}
+}
+
+void setYouTubeMockProfile(std::shared_ptr<const YouTubeMockProfile> profile)
+{
+	MockState &state = getMockState();
+	std::scoped_lock lock(state.mutex);
+	state.profile = profile ? std::move(profile) : std::make_shared<const YouTubeMockProfile>();
+	state.generator.seed(state.profile->seed);
+}
+
+std::shared_ptr<const YouTubeMockProfile> getYouTubeMockProfile()
+{
+	MockState &state = getMockState();
+	std::scoped_lock lock(state.mutex);
+	return state.profile;
+}
+
+void simulateYouTubeMockCall(YouTubeApiMethod method, const std::function<bool()> &shouldAbort)
+{
+	std::chrono::milliseconds latency{0};
+	bool fails = false;
+	{
+		// One generator for the whole process keeps a run reproducible for a given order of calls.
+		MockState &state = getMockState();
+		std::scoped_lock lock(state.mutex);
+		const YouTubeMockMethodProfile &p = state.profile->getMethodProfile(method);
+
+		std::uniform_real_distribution<double> unit(0.0, 1.0);
+		if (p.tailProbability > 0.0 && unit(state.generator) < p.tailProbability) {
+			latency = p.tailLatency;
+		} else if (p.maxLatency > p.minLatency) {
+			std::uniform_int_distribution<std::int64_t> range(p.minLatency.count(), p.maxLatency.count());
+			latency = std::chrono::milliseconds{range(state.generator)};
+		} else {
+			latency = p.minLatency;
+		}
+		fails = p.errorRate > 0.0 && unit(state.generator) < p.errorRate;
+	}
+
+	using Clock = std::chrono::steady_clock;
+	const Clock::time_point deadline = Clock::now() + latency;
+	while (Clock::now() < deadline) {
+		if (shouldAbort && shouldAbort()) {
+			throw std::runtime_error("CurlPerformAborted(simulateYouTubeMockCall)");
+		}
+		std::this_thread::sleep_until(std::min(deadline, Clock::now() + kAbortPollInterval));
+	}
+
+	if (fails) {
+		throw YouTubeRetryableError("YouTubeMockInjectedError(simulateYouTubeMockCall)",
+					    YouTubeRequestFailure::ServerError);
+	}
+}
+
+} // namespace KaitoTokyo::YouTubeApi
@@ -0,0 +1,97 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * KaitoTokyo YouTubeApi Library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+
+#include <nlohmann/json_fwd.hpp>
+
+#include "YouTubeRequestScheduler.hpp"
+
+namespace KaitoTokyo::YouTubeApi {
+
+/**
+ * How one API method of the mock client behaves. A call takes a uniformly distributed time between
+ * minLatency and maxLatency, or tailLatency with tailProbability, and then fails with errorRate.
+ */
+struct YouTubeMockMethodProfile {
+	std::chrono::milliseconds minLatency{0};
+	std::chrono::milliseconds maxLatency{0};
+	double tailProbability = 0.0;
+	std::chrono::milliseconds tailLatency{0};
+	// Failures are YouTubeRetryableError server errors, so the request scheduler may retry them.
+	double errorRate = 0.0;
+};
+
+/**
+ * Latency and failure profile of the mock YouTubeApiClient, for measuring the session flow without a live channel.
+ */
+struct YouTubeMockProfile {
+	YouTubeMockMethodProfile defaultMethod;
+	std::map<YouTubeApiMethod, YouTubeMockMethodProfile> methods;
+	// Seeds the generator that draws latencies and failures, so runs with the same profile are comparable.
+	std::uint64_t seed = 0;
+	// Decides the streamStatus liveStreams.list reports; without it every live stream is active.
+	std::function<bool(const std::string &liveStreamId)> isLiveStreamActive;
+
+	[[nodiscard]]
+	const YouTubeMockMethodProfile &getMethodProfile(YouTubeApiMethod method) const noexcept
+	{
+		const auto it = methods.find(method);
+		return it != methods.end() ? it->second : defaultMethod;
+	}
+};
+
+/**
+ * Reads a profile such as
+ * {"seed": 1, "default": {"minLatencyMilliseconds": 80, "maxLatencyMilliseconds": 200},
+ *  "methods": {"liveBroadcasts.transition": {"tailProbability": 0.1, "tailLatencyMilliseconds": 3000,
+ *  "errorRate": 0.02}}}
+ * where methods are keyed by their names in getYouTubeApiMethodPolicy().
+ */
+void from_json(const nlohmann::json &j, YouTubeMockProfile &p);
+
+/**
+ * Installs the profile every mock client in the process follows from now on and reseeds its generator.
+ * Null restores the default of answering immediately and never failing. Thread-safe.
+ */
+void setYouTubeMockProfile(std::shared_ptr<const YouTubeMockProfile> profile);
+
+[[nodiscard]]
+std::shared_ptr<const YouTubeMockProfile> getYouTubeMockProfile();
+
+/**
+ * Blocks for a latency drawn from the installed profile and throws YouTubeRetryableError when the call is
+ * drawn to fail. Throws CurlPerformAborted early once shouldAbort returns true, like a real transfer.
+ */
+void simulateYouTubeMockCall(YouTubeApiMethod method, const std::function<bool()> &shouldAbort);
+
+} // namespace KaitoTokyo::YouTubeApi
@@ -0,0 +1,231 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * KaitoTokyo YouTubeApi Library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <curl/curl.h>
+
+#include <KaitoTokyo/CurlHelper/CurlSlistHandle.hpp>
+
+namespace KaitoTokyo::YouTubeApi {
+
+// Base URLs of the endpoints YouTubeApiClient calls. They are already in the form libcurl would normalize them
+// to, so query parameters can be appended to them as text.
+namespace YouTubeEndpoint {
+
+inline constexpr std::string_view kLiveStreams = "https://www.googleapis.com/youtube/v3/liveStreams";
+inline constexpr std::string_view kLiveBroadcasts = "https://www.googleapis.com/youtube/v3/liveBroadcasts";
+inline constexpr std::string_view kLiveBroadcastsBind = "https://www.googleapis.com/youtube/v3/liveBroadcasts/bind";
+inline constexpr std::string_view kLiveBroadcastsTransition =
+	"https://www.googleapis.com/youtube/v3/liveBroadcasts/transition";
+inline constexpr std::string_view kThumbnailsSet = "https://www.googleapis.com/upload/youtube/v3/thumbnails/set";
+
+} // namespace YouTubeEndpoint
+
+/**
+ * Builds a request URL in a caller-owned buffer, normally the URL buffer of a connection pool lease, so
+ * building one reuses the capacity of earlier requests and involves no URL parsing.
+ *
+ * Parameters are percent-encoded like curl_easy_escape does: everything but ASCII letters, digits and "-._~"
+ * is escaped. The hex digits are lowercase, as libcurl writes them when it normalizes a URL, so the URLs are
+ * the same as the ones built with CurlUrlHandle before and recorded transfer tapes still match them.
+ */
+class YouTubeRequestUrl {
+public:
+	/**
+	 * Continues with whatever buffer holds; call reset() to start from an endpoint.
+	 */
+	explicit YouTubeRequestUrl(std::string &buffer) noexcept
+		: buffer_(buffer),
+		  hasQuery_(buffer.find('?') != std::string::npos)
+	{
+	}
+
+	YouTubeRequestUrl(const YouTubeRequestUrl &) = delete;
+	YouTubeRequestUrl &operator=(const YouTubeRequestUrl &) = delete;
+	YouTubeRequestUrl(YouTubeRequestUrl &&) = delete;
+	YouTubeRequestUrl &operator=(YouTubeRequestUrl &&) = delete;
+
+	YouTubeRequestUrl &reset(std::string_view endpoint)
+	{
+		buffer_.assign(endpoint);
+		hasQuery_ = endpoint.find('?') != std::string_view::npos;
+		return *this;
+	}
+
+	YouTubeRequestUrl &append(std::string_view name, std::string_view value)
+	{
+		buffer_.push_back(hasQuery_ ? '&' : '?');
+		hasQuery_ = true;
+		appendEscaped(name);
+		buffer_.push_back('=');
+		appendEscaped(value);
+		return *this;
+	}
+
+	/**
+	 * Extends the value of the parameter appended last, e.g. to join a list without a temporary string.
+	 */
+	YouTubeRequestUrl &appendToValue(std::string_view value)
+	{
+		appendEscaped(value);
+		return *this;
+	}
+
+	/**
+	 * Drops everything after the first size characters, e.g. the page token of the previous page.
+	 */
+	void truncate(std::size_t size)
+	{
+		buffer_.resize(std::min(size, buffer_.size()));
+		hasQuery_ = buffer_.find('?') != std::string::npos;
+	}
+
+	[[nodiscard]]
+	std::size_t size() const noexcept
+	{
+		return buffer_.size();
+	}
+
+	[[nodiscard]]
+	std::string_view view() const noexcept
+	{
+		return buffer_;
+	}
+
+	[[nodiscard]]
+	const char *c_str() const noexcept
+	{
+		return buffer_.c_str();
+	}
+
+private:
+	void appendEscaped(std::string_view str)
+	{
+		static constexpr char kHexDigits[] = "0123456789abcdef";
+
+		for (const char c : str) {
+			const auto byte = static_cast<unsigned char>(c);
+			const bool unreserved = (byte >= 'a' && byte <= 'z') || (byte >= 'A' && byte <= 'Z') ||
+						(byte >= '0' && byte <= '9') || byte == '-' || byte == '.' ||
+						byte == '_' || byte == '~';
+			if (unreserved) {
+				buffer_.push_back(c);
+			} else {
+				buffer_.push_back('%');
+				buffer_.push_back(kHexDigits[byte >> 4]);
+				buffer_.push_back(kHexDigits[byte & 0x0F]);
+			}
+		}
+	}
+
+	std::string &buffer_;
+	bool hasQuery_;
+};
+
+/**
+ * Header lists carrying the Authorization header for one access token.
+ */
+class YouTubeAuthHeaders {
+public:
+	explicit YouTubeAuthHeaders(std::string accessToken) : accessToken_(std::move(accessToken))
+	{
+		std::string authHeader;
+		authHeader.reserve(kBearerPrefix.size() + accessToken_.size());
+		authHeader.append(kBearerPrefix).append(accessToken_);
+
+		authorization_.append(authHeader.c_str());
+		json_.append(authHeader.c_str());
+		json_.append("Content-Type: application/json");
+	}
+
+	YouTubeAuthHeaders(const YouTubeAuthHeaders &) = delete;
+	YouTubeAuthHeaders &operator=(const YouTubeAuthHeaders &) = delete;
+	YouTubeAuthHeaders(YouTubeAuthHeaders &&) = delete;
+	YouTubeAuthHeaders &operator=(YouTubeAuthHeaders &&) = delete;
+
+	[[nodiscard]]
+	const std::string &getAccessToken() const noexcept
+	{
+		return accessToken_;
+	}
+
+	/**
+	 * Authorization only.
+	 */
+	[[nodiscard]]
+	curl_slist *getAuthorization() const noexcept
+	{
+		return authorization_.getRaw();
+	}
+
+	/**
+	 * Authorization and "Content-Type: application/json", for requests with a JSON body.
+	 */
+	[[nodiscard]]
+	curl_slist *getJson() const noexcept
+	{
+		return json_.getRaw();
+	}
+
+private:
+	static constexpr std::string_view kBearerPrefix = "Authorization: Bearer ";
+
+	const std::string accessToken_;
+	CurlHelper::CurlSlistHandle authorization_;
+	CurlHelper::CurlSlistHandle json_;
+};
+
+/**
+ * Hands out the header lists of the latest access token, building them again only when the token changes.
+ * Lists already handed out stay valid while their holder keeps them, so requests in flight are not affected
+ * by a refresh. Safe to use from several threads.
+ */
+class YouTubeAuthHeaderCache {
+public:
+	[[nodiscard]]
+	std::shared_ptr<const YouTubeAuthHeaders> get(const std::string &accessToken)
+	{
+		std::scoped_lock lock(mutex_);
+		if (!current_ || current_->getAccessToken() != accessToken) {
+			current_ = std::make_shared<const YouTubeAuthHeaders>(accessToken);
+		}
+		return current_;
+	}
+
+private:
+	std::mutex mutex_;
+	std::shared_ptr<const YouTubeAuthHeaders> current_;
+};
+
+} // namespace KaitoTokyo::YouTubeApi
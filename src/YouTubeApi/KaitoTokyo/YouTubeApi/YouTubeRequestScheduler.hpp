@@ -0,0 +1,531 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * KaitoTokyo YouTubeApi Library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace KaitoTokyo::YouTubeApi {
+
+enum class YouTubeApiMethod {
+	LiveStreamsList,
+	LiveBroadcastsList,
+	LiveBroadcastsInsert,
+	LiveBroadcastsUpdate,
+	LiveBroadcastsBind,
+	LiveBroadcastsTransition,
+	ThumbnailsSet,
+	// Sends bytes to, or queries, a resumable upload session; the quota is charged when the session is opened.
+	ResumableUploadPut,
+};
+
+struct YouTubeApiMethodPolicy {
+	std::string_view name;
+	// Units charged against the daily quota for every request, including failed ones.
+	int quotaCost;
+	// Whether sending the request again after it may have reached YouTube leaves the same state behind.
+	bool idempotent;
+};
+
+constexpr YouTubeApiMethodPolicy getYouTubeApiMethodPolicy(YouTubeApiMethod method) noexcept
+{
+	switch (method) {
+	case YouTubeApiMethod::LiveStreamsList:
+		return {"liveStreams.list", 1, true};
+	case YouTubeApiMethod::LiveBroadcastsList:
+		return {"liveBroadcasts.list", 1, true};
+	case YouTubeApiMethod::LiveBroadcastsInsert:
+		return {"liveBroadcasts.insert", 50, false};
+	case YouTubeApiMethod::LiveBroadcastsUpdate:
+		return {"liveBroadcasts.update", 50, true};
+	case YouTubeApiMethod::LiveBroadcastsBind:
+		return {"liveBroadcasts.bind", 50, true};
+	case YouTubeApiMethod::LiveBroadcastsTransition:
+		return {"liveBroadcasts.transition", 50, false};
+	case YouTubeApiMethod::ThumbnailsSet:
+		return {"thumbnails.set", 50, true};
+	case YouTubeApiMethod::ResumableUploadPut:
+		return {"resumableUpload.put", 0, true};
+	}
+	return {"unknown", 1, false};
+}
+
+/**
+ * Higher priorities are granted first whenever requests are waiting for the rate limiter.
+ */
+enum class YouTubeRequestPriority {
+	Background,
+	Normal,
+	Cutover,
+};
+
+enum class YouTubeRequestFailure {
+	// The request never reached YouTube, e.g. DNS, connect or TLS handshake errors.
+	NotSent,
+	// The connection broke after the request may have been processed.
+	Interrupted,
+	// YouTube rejected the request unprocessed with 429 or a rate limit reason.
+	Throttled,
+	// 5xx responses; the request may or may not have been applied.
+	ServerError,
+};
+
+/**
+ * Thrown for failures that may go away when the request is sent again.
+ */
+class YouTubeRetryableError : public std::runtime_error {
+public:
+	YouTubeRetryableError(const std::string &message, YouTubeRequestFailure failure)
+		: std::runtime_error(message),
+		  failure_(failure)
+	{
+	}
+
+	[[nodiscard]]
+	YouTubeRequestFailure getFailure() const noexcept
+	{
+		return failure_;
+	}
+
+private:
+	YouTubeRequestFailure failure_;
+};
+
+struct YouTubeRequestSchedulerOptions {
+	double requestsPerSecond = 5.0;
+	double burst = 10.0;
+	std::int64_t dailyQuotaUnits = 10000;
+	// Background requests fail instead of spending the last units of the daily quota.
+	std::int64_t cutoverReserveUnits = 1000;
+	int maxAttempts = 5;
+	std::chrono::milliseconds initialBackoff{500};
+	std::chrono::milliseconds maxBackoff{30000};
+};
+
+struct YouTubeQuotaStatistics {
+	// Estimated units spent since the quota was last reset, at midnight Pacific Time.
+	std::int64_t unitsUsed;
+	std::int64_t dailyQuotaUnits;
+	std::uint64_t requests;
+	std::uint64_t retries;
+	std::uint64_t throttledRequests;
+};
+
+/**
+ * Admits YouTube API requests through a token bucket and keeps track of the daily quota.
+ *
+ * Share one scheduler between every client that spends the same quota. Requests that cannot
+ * be sent right away wait in priority order, so cutover calls overtake background polling.
+ * Waits are served by a thread the scheduler starts on first use; coroutines awaiting a
+ * permit are resumed there, while inline waits block the calling thread. Thread-safe.
+ */
+class YouTubeRequestScheduler {
+public:
+	using Clock = std::chrono::steady_clock;
+
+private:
+	struct Waiter {
+		YouTubeRequestPriority priority = YouTubeRequestPriority::Normal;
+		Clock::time_point notBefore;
+		int quotaCost = 1;
+		std::uint64_t sequence = 0;
+		const std::function<bool()> *shouldAbort = nullptr;
+		// Null for inline waiters, which wait on granted_ instead.
+		std::coroutine_handle<> handle;
+		bool done = false;
+		bool aborted = false;
+	};
+
+public:
+	class PermitAwaiter {
+	public:
+		bool await_ready() { return scheduler_->admit(waiter_, inlineWait_); }
+
+		bool await_suspend(std::coroutine_handle<> handle)
+		{
+			waiter_.handle = handle;
+			return scheduler_->enqueue(waiter_);
+		}
+
+		void await_resume() const
+		{
+			if (waiter_.aborted) {
+				throw std::runtime_error("YouTubeRequestAborted(YouTubeRequestScheduler::acquire)");
+			}
+		}
+
+	private:
+		friend class YouTubeRequestScheduler;
+
+		PermitAwaiter(YouTubeRequestScheduler *scheduler, YouTubeRequestPriority priority,
+			      Clock::time_point notBefore, const std::function<bool()> &shouldAbort,
+			      bool inlineWait) noexcept
+			: scheduler_(scheduler),
+			  inlineWait_(inlineWait)
+		{
+			waiter_.priority = priority;
+			waiter_.notBefore = notBefore;
+			waiter_.shouldAbort = &shouldAbort;
+		}
+
+		YouTubeRequestScheduler *const scheduler_;
+		const bool inlineWait_;
+		Waiter waiter_;
+	};
+
+	explicit YouTubeRequestScheduler(YouTubeRequestSchedulerOptions options = {})
+		: options_(options),
+		  tokens_(options.burst),
+		  lastRefill_(Clock::now()),
+		  quotaDay_(currentQuotaDay())
+	{
+	}
+
+	~YouTubeRequestScheduler() noexcept
+	{
+		std::vector<std::coroutine_handle<>> abandoned;
+		{
+			std::scoped_lock lock(mutex_);
+			stopping_ = true;
+			for (Waiter *waiter : waiters_) {
+				finishLocked(*waiter, true, abandoned);
+			}
+			waiters_.clear();
+		}
+		wakeup_.notify_all();
+		granted_.notify_all();
+		if (dispatcher_.joinable()) {
+			if (dispatcher_.get_id() == std::this_thread::get_id()) {
+				// Destroyed from a coroutine the dispatcher resumed, which then exits on its own.
+				alive_->store(false, std::memory_order_release);
+				dispatcher_.detach();
+			} else {
+				dispatcher_.join();
+			}
+		}
+		resumeAll(abandoned);
+	}
+
+	YouTubeRequestScheduler(const YouTubeRequestScheduler &) = delete;
+	YouTubeRequestScheduler &operator=(const YouTubeRequestScheduler &) = delete;
+	YouTubeRequestScheduler(YouTubeRequestScheduler &&) = delete;
+	YouTubeRequestScheduler &operator=(YouTubeRequestScheduler &&) = delete;
+
+	/**
+	 * Returns an awaitable that completes once a request of method may be sent, not before notBefore,
+	 * and charges its quota cost. Throws if shouldAbort returns true while waiting, and throws right
+	 * away for background requests once only the cutover reserve of the daily quota is left.
+	 * With inlineWait the awaiting thread blocks instead of suspending.
+	 */
+	[[nodiscard]]
+	PermitAwaiter acquire(YouTubeApiMethod method, YouTubeRequestPriority priority, Clock::time_point notBefore,
+			      const std::function<bool()> &shouldAbort, bool inlineWait)
+	{
+		const YouTubeApiMethodPolicy policy = getYouTubeApiMethodPolicy(method);
+		if (priority == YouTubeRequestPriority::Background) {
+			std::scoped_lock lock(mutex_);
+			rollQuotaDayLocked();
+			if (unitsUsed_ + policy.quotaCost > options_.dailyQuotaUnits - options_.cutoverReserveUnits) {
+				throw std::runtime_error(
+					"YouTubeQuotaReservedForCutover(YouTubeRequestScheduler::acquire)");
+			}
+		}
+
+		PermitAwaiter awaiter(this, priority, notBefore, shouldAbort, inlineWait);
+		awaiter.waiter_.quotaCost = policy.quotaCost;
+		return awaiter;
+	}
+
+	/**
+	 * attempts counts the attempts made so far, including the one that just failed.
+	 */
+	[[nodiscard]]
+	bool shouldRetry(YouTubeApiMethod method, YouTubeRequestFailure failure, int attempts) const noexcept
+	{
+		if (attempts >= options_.maxAttempts) {
+			return false;
+		}
+
+		switch (failure) {
+		case YouTubeRequestFailure::NotSent:
+		case YouTubeRequestFailure::Throttled:
+			return true;
+		case YouTubeRequestFailure::Interrupted:
+		case YouTubeRequestFailure::ServerError:
+			return getYouTubeApiMethodPolicy(method).idempotent;
+		}
+		return false;
+	}
+
+	/**
+	 * Exponential backoff with jitter for the retry after the given number of failed attempts.
+	 */
+	[[nodiscard]]
+	std::chrono::milliseconds nextBackoff(int attempts)
+	{
+		const int exponent = std::clamp(attempts - 1, 0, 20);
+		const std::chrono::milliseconds ceiling =
+			std::min(options_.maxBackoff, options_.initialBackoff * (std::int64_t{1} << exponent));
+		const std::int64_t half = ceiling.count() / 2;
+
+		std::scoped_lock lock(mutex_);
+		++retries_;
+		std::uniform_int_distribution<std::int64_t> jitter(0, half);
+		return std::chrono::milliseconds(ceiling.count() - half + jitter(random_));
+	}
+
+	[[nodiscard]]
+	YouTubeQuotaStatistics getStatistics() noexcept
+	{
+		std::scoped_lock lock(mutex_);
+		rollQuotaDayLocked();
+		return {
+			.unitsUsed = unitsUsed_,
+			.dailyQuotaUnits = options_.dailyQuotaUnits,
+			.requests = requests_,
+			.retries = retries_,
+			.throttledRequests = throttledRequests_,
+		};
+	}
+
+private:
+	// How often queued waiters are checked for aborts while nothing else wakes the dispatcher.
+	static constexpr std::chrono::milliseconds kAbortPollInterval{100};
+
+	// YouTube resets the quota at midnight Pacific Time; daylight saving time is ignored.
+	static std::chrono::sys_days currentQuotaDay() noexcept
+	{
+		return std::chrono::floor<std::chrono::days>(std::chrono::system_clock::now() - std::chrono::hours(8));
+	}
+
+	// Returns true when the permit was granted without waiting.
+	bool admit(Waiter &waiter, bool inlineWait)
+	{
+		std::unique_lock lock(mutex_);
+		const Clock::time_point now = Clock::now();
+		refillLocked(now);
+		if (waiters_.empty() && waiter.notBefore <= now && tokens_ >= 1.0) {
+			grantLocked(waiter);
+			waiter.done = true;
+			return true;
+		}
+		if (!inlineWait) {
+			return false;
+		}
+
+		enqueueLocked(waiter);
+		granted_.wait(lock, [&waiter]() { return waiter.done; });
+		if (waiter.aborted) {
+			throw std::runtime_error("YouTubeRequestAborted(YouTubeRequestScheduler::acquire)");
+		}
+		return true;
+	}
+
+	bool enqueue(Waiter &waiter)
+	{
+		std::scoped_lock lock(mutex_);
+		if (stopping_) {
+			waiter.aborted = true;
+			return false;
+		}
+		enqueueLocked(waiter);
+		return true;
+	}
+
+	void enqueueLocked(Waiter &waiter)
+	{
+		if (stopping_) {
+			waiter.aborted = true;
+			waiter.done = true;
+			return;
+		}
+
+		waiter.sequence = nextSequence_++;
+		waiters_.push_back(&waiter);
+		++throttledRequests_;
+		if (!dispatcher_.joinable()) {
+			dispatcher_ = std::thread([this, alive = alive_]() { dispatch(*alive); });
+		}
+		wakeup_.notify_one();
+	}
+
+	void grantLocked(Waiter &waiter) noexcept
+	{
+		rollQuotaDayLocked();
+		tokens_ -= 1.0;
+		unitsUsed_ += waiter.quotaCost;
+		++requests_;
+	}
+
+	void refillLocked(Clock::time_point now) noexcept
+	{
+		const std::chrono::duration<double> elapsed = now - lastRefill_;
+		tokens_ = std::min(options_.burst, tokens_ + elapsed.count() * options_.requestsPerSecond);
+		lastRefill_ = now;
+	}
+
+	void rollQuotaDayLocked() noexcept
+	{
+		const std::chrono::sys_days today = currentQuotaDay();
+		if (today != quotaDay_) {
+			quotaDay_ = today;
+			unitsUsed_ = 0;
+		}
+	}
+
+	// Inline waiters may return as soon as done is set, so only coroutine handles are kept for resuming.
+	static void finishLocked(Waiter &waiter, bool aborted, std::vector<std::coroutine_handle<>> &resumable) noexcept
+	{
+		waiter.aborted = aborted;
+		waiter.done = true;
+		if (waiter.handle) {
+			resumable.push_back(waiter.handle);
+		}
+	}
+
+	// Grants or aborts whatever waiters it can and returns when to look again.
+	Clock::time_point serveLocked(std::vector<std::coroutine_handle<>> &resumable, bool &finishedAny)
+	{
+		const Clock::time_point now = Clock::now();
+		refillLocked(now);
+
+		std::erase_if(waiters_, [&resumable, &finishedAny](Waiter *waiter) {
+			if (*waiter->shouldAbort && (*waiter->shouldAbort)()) {
+				finishLocked(*waiter, true, resumable);
+				finishedAny = true;
+				return true;
+			}
+			return false;
+		});
+
+		Clock::time_point nextWake = now + kAbortPollInterval;
+		while (!waiters_.empty()) {
+			auto best = waiters_.end();
+			for (auto it = waiters_.begin(); it != waiters_.end(); ++it) {
+				Waiter *waiter = *it;
+				if (waiter->notBefore > now) {
+					nextWake = std::min(nextWake, waiter->notBefore);
+					continue;
+				}
+				if (best == waiters_.end() || waiter->priority > (*best)->priority ||
+				    (waiter->priority == (*best)->priority && waiter->sequence < (*best)->sequence)) {
+					best = it;
+				}
+			}
+
+			if (best == waiters_.end()) {
+				break;
+			}
+			if (tokens_ < 1.0) {
+				const std::chrono::duration<double> untilToken((1.0 - tokens_) /
+									       options_.requestsPerSecond);
+				nextWake = std::min(nextWake,
+						    now + std::chrono::ceil<Clock::duration>(untilToken));
+				break;
+			}
+
+			grantLocked(**best);
+			finishLocked(**best, false, resumable);
+			finishedAny = true;
+			waiters_.erase(best);
+		}
+		return nextWake;
+	}
+
+	void dispatch(const std::atomic<bool> &alive) noexcept
+	{
+		std::unique_lock lock(mutex_);
+		while (!stopping_) {
+			if (waiters_.empty()) {
+				wakeup_.wait(lock);
+				continue;
+			}
+
+			std::vector<std::coroutine_handle<>> resumable;
+			bool finishedAny = false;
+			const Clock::time_point nextWake = serveLocked(resumable, finishedAny);
+			if (finishedAny) {
+				granted_.notify_all();
+				lock.unlock();
+				resumeAll(resumable);
+				if (!alive.load(std::memory_order_acquire)) {
+					return;
+				}
+				lock.lock();
+				continue;
+			}
+
+			wakeup_.wait_until(lock, nextWake);
+		}
+	}
+
+	// Must be called without the lock; aborted coroutines throw from await_resume.
+	static void resumeAll(const std::vector<std::coroutine_handle<>> &handles) noexcept
+	{
+		for (std::coroutine_handle<> handle : handles) {
+			handle.resume();
+		}
+	}
+
+	const YouTubeRequestSchedulerOptions options_;
+
+	std::mutex mutex_;
+	std::condition_variable wakeup_;
+	std::condition_variable granted_;
+	std::thread dispatcher_;
+	const std::shared_ptr<std::atomic<bool>> alive_ = std::make_shared<std::atomic<bool>>(true);
+	bool stopping_ = false;
+
+	std::vector<Waiter *> waiters_;
+	std::uint64_t nextSequence_ = 0;
+
+	double tokens_;
+	Clock::time_point lastRefill_;
+
+	std::chrono::sys_days quotaDay_;
+	std::int64_t unitsUsed_ = 0;
+	std::uint64_t requests_ = 0;
+	std::uint64_t retries_ = 0;
+	std::uint64_t throttledRequests_ = 0;
+
+	std::mt19937 random_{std::random_device{}()};
+};
+
+} // namespace KaitoTokyo::YouTubeApi
@@ -28,12 +28,29 @@
 #include <cstdint>
 #include <optional>
 #include <string>
+#include <string_view>
+#include <tuple>
 #include <unordered_map>
+#include <vector>
 
 #include <nlohmann/json_fwd.hpp>
 
+#include "YouTubeFieldTable.hpp"
+
 namespace KaitoTokyo::YouTubeApi {
 
+/**
+ * Partial-response selector for YouTubeApiClient requests. Empty members keep the defaults.
+ *
+ * parts replaces the part= parameter, e.g. "id,status". Insert and update ignore it because
+ * their part= also selects what is written. fields is a fields= selector relative to one
+ * resource, e.g. "id,status/streamStatus"; list requests wrap it in items(...) themselves.
+ */
+struct YouTubeFieldMask {
+	std::string_view parts;
+	std::string_view fields;
+};
+
 struct YouTubeLiveStream {
 	std::string kind;
 	std::string etag;
@@ -228,4 +245,251 @@ struct UpdatingYouTubeLiveBroadcast {
 void to_json(nlohmann::json &j, const UpdatingYouTubeLiveBroadcast &p);
 void from_json(const nlohmann::json &j, UpdatingYouTubeLiveBroadcast &p);
 
+// --- Field tables ---
+// One per struct above, driving to_json, from_json and the direct list decoding in YouTubeFieldCodec.hpp.
+
+template<> struct YouTubeFieldTable<YouTubeLiveStream::Snippet> {
+	using S = YouTubeLiveStream::Snippet;
+	static constexpr auto fields = std::make_tuple(
+		makeYouTubeField("publishedAt", &S::publishedAt), makeYouTubeField("channelId", &S::channelId),
+		makeYouTubeField("title", &S::title), makeYouTubeField("description", &S::description),
+		makeYouTubeField("isDefaultStream", &S::isDefaultStream));
+};
+
+template<> struct YouTubeFieldTable<YouTubeLiveStream::Cdn::IngestionInfo> {
+	using S = YouTubeLiveStream::Cdn::IngestionInfo;
+	static constexpr auto fields = std::make_tuple(makeYouTubeField("streamName", &S::streamName),
+						       makeYouTubeField("ingestionAddress", &S::ingestionAddress),
+						       makeYouTubeField("backupIngestionAddress",
+									&S::backupIngestionAddress));
+};
+
+template<> struct YouTubeFieldTable<YouTubeLiveStream::Cdn> {
+	using S = YouTubeLiveStream::Cdn;
+	static constexpr auto fields = std::make_tuple(makeYouTubeField("ingestionType", &S::ingestionType),
+						       makeYouTubeField("ingestionInfo", &S::ingestionInfo),
+						       makeYouTubeField("resolution", &S::resolution),
+						       makeYouTubeField("frameRate", &S::frameRate));
+};
+
+template<> struct YouTubeFieldTable<YouTubeLiveStream::Status::HealthStatus::ConfigurationIssue> {
+	using S = YouTubeLiveStream::Status::HealthStatus::ConfigurationIssue;
+	static constexpr auto fields = std::make_tuple(makeYouTubeField("type", &S::type, YouTubeFieldRequired),
+						       makeYouTubeField("severity", &S::severity, YouTubeFieldRequired),
+						       makeYouTubeField("reason", &S::reason, YouTubeFieldRequired),
+						       makeYouTubeField("description", &S::description,
+									YouTubeFieldRequired));
+};
+
+template<> struct YouTubeFieldTable<YouTubeLiveStream::Status::HealthStatus> {
+	using S = YouTubeLiveStream::Status::HealthStatus;
+	static constexpr auto fields = std::make_tuple(makeYouTubeField("status", &S::status),
+						       makeYouTubeField("lastUpdateTimeSeconds",
+									&S::lastUpdateTimeSeconds),
+						       makeYouTubeField("configurationIssues",
+									&S::configurationIssues));
+};
+
+template<> struct YouTubeFieldTable<YouTubeLiveStream::Status> {
+	using S = YouTubeLiveStream::Status;
+	static constexpr auto fields = std::make_tuple(makeYouTubeField("streamStatus", &S::streamStatus),
+						       makeYouTubeField("healthStatus", &S::healthStatus));
+};
+
+template<> struct YouTubeFieldTable<YouTubeLiveStream::ContentDetails> {
+	using S = YouTubeLiveStream::ContentDetails;
+	static constexpr auto fields =
+		std::make_tuple(makeYouTubeField("closedCaptionsIngestionUrl", &S::closedCaptionsIngestionUrl),
+				makeYouTubeField("isReusable", &S::isReusable));
+};
+
+template<> struct YouTubeFieldTable<YouTubeLiveStream> {
+	using S = YouTubeLiveStream;
+	// Only id is required; everything else may be left out by a field mask.
+	static constexpr auto fields = std::make_tuple(
+		makeYouTubeField("kind", &S::kind), makeYouTubeField("etag", &S::etag),
+		makeYouTubeField("id", &S::id, YouTubeFieldRequired), makeYouTubeField("snippet", &S::snippet),
+		makeYouTubeField("cdn", &S::cdn), makeYouTubeField("status", &S::status, YouTubeFieldOmitDefault),
+		makeYouTubeField("contentDetails", &S::contentDetails, YouTubeFieldOmitDefault));
+};
+
+template<> struct YouTubeFieldTable<YouTubeLiveBroadcastThumbnail> {
+	using S = YouTubeLiveBroadcastThumbnail;
+	static constexpr auto fields = std::make_tuple(makeYouTubeField("url", &S::url, YouTubeFieldRequired),
+						       makeYouTubeField("width", &S::width),
+						       makeYouTubeField("height", &S::height));
+};
+
+template<> struct YouTubeFieldTable<YouTubeLiveBroadcast::Snippet> {
+	using S = YouTubeLiveBroadcast::Snippet;
+	static constexpr auto fields = std::make_tuple(
+		makeYouTubeField("publishedAt", &S::publishedAt), makeYouTubeField("channelId", &S::channelId),
+		makeYouTubeField("title", &S::title), makeYouTubeField("description", &S::description),
+		makeYouTubeField("thumbnails", &S::thumbnails),
+		makeYouTubeField("scheduledStartTime", &S::scheduledStartTime),
+		makeYouTubeField("scheduledEndTime", &S::scheduledEndTime),
+		makeYouTubeField("actualStartTime", &S::actualStartTime),
+		makeYouTubeField("actualEndTime", &S::actualEndTime),
+		makeYouTubeField("isDefaultBroadcast", &S::isDefaultBroadcast),
+		makeYouTubeField("liveChatId", &S::liveChatId));
+};
+
+template<> struct YouTubeFieldTable<YouTubeLiveBroadcast::Status> {
+	using S = YouTubeLiveBroadcast::Status;
+	static constexpr auto fields = std::make_tuple(
+		makeYouTubeField("lifeCycleStatus", &S::lifeCycleStatus),
+		makeYouTubeField("privacyStatus", &S::privacyStatus),
+		makeYouTubeField("recordingStatus", &S::recordingStatus),
+		makeYouTubeField("madeForKids", &S::madeForKids),
+		makeYouTubeField("selfDeclaredMadeForKids", &S::selfDeclaredMadeForKids));
+};
+
+template<> struct YouTubeFieldTable<YouTubeLiveBroadcast::ContentDetails::MonitorStream> {
+	using S = YouTubeLiveBroadcast::ContentDetails::MonitorStream;
+	static constexpr auto fields =
+		std::make_tuple(makeYouTubeField("enableMonitorStream", &S::enableMonitorStream),
+				makeYouTubeField("broadcastStreamDelayMs", &S::broadcastStreamDelayMs),
+				makeYouTubeField("embedHtml", &S::embedHtml));
+};
+
+template<> struct YouTubeFieldTable<YouTubeLiveBroadcast::ContentDetails> {
+	using S = YouTubeLiveBroadcast::ContentDetails;
+	static constexpr auto fields = std::make_tuple(
+		makeYouTubeField("boundStreamId", &S::boundStreamId),
+		makeYouTubeField("boundStreamLastUpdateTimeMs", &S::boundStreamLastUpdateTimeMs),
+		makeYouTubeField("monitorStream", &S::monitorStream, YouTubeFieldOmitDefault),
+		makeYouTubeField("enableEmbed", &S::enableEmbed), makeYouTubeField("enableDvr", &S::enableDvr),
+		makeYouTubeField("recordFromStart", &S::recordFromStart),
+		makeYouTubeField("enableClosedCaptions", &S::enableClosedCaptions),
+		makeYouTubeField("closedCaptionsType", &S::closedCaptionsType),
+		makeYouTubeField("projection", &S::projection),
+		makeYouTubeField("enableLowLatency", &S::enableLowLatency),
+		makeYouTubeField("latencyPreference", &S::latencyPreference),
+		makeYouTubeField("enableAutoStart", &S::enableAutoStart),
+		makeYouTubeField("enableAutoStop", &S::enableAutoStop));
+};
+
+template<> struct YouTubeFieldTable<YouTubeLiveBroadcast::Statistics> {
+	using S = YouTubeLiveBroadcast::Statistics;
+	static constexpr auto fields = std::make_tuple(makeYouTubeField("totalChatCount", &S::totalChatCount));
+};
+
+template<> struct YouTubeFieldTable<YouTubeLiveBroadcast::MonetizationDetails::CuepointSchedule> {
+	using S = YouTubeLiveBroadcast::MonetizationDetails::CuepointSchedule;
+	static constexpr auto fields =
+		std::make_tuple(makeYouTubeField("enabled", &S::enabled),
+				makeYouTubeField("pauseAdsUntil", &S::pauseAdsUntil),
+				makeYouTubeField("scheduleStrategy", &S::scheduleStrategy),
+				makeYouTubeField("repeatIntervalSecs", &S::repeatIntervalSecs));
+};
+
+template<> struct YouTubeFieldTable<YouTubeLiveBroadcast::MonetizationDetails> {
+	using S = YouTubeLiveBroadcast::MonetizationDetails;
+	static constexpr auto fields =
+		std::make_tuple(makeYouTubeField("cuepointSchedule", &S::cuepointSchedule, YouTubeFieldOmitDefault));
+};
+
+template<> struct YouTubeFieldTable<YouTubeLiveBroadcast> {
+	using S = YouTubeLiveBroadcast;
+	static constexpr auto fields = std::make_tuple(
+		makeYouTubeField("kind", &S::kind), makeYouTubeField("etag", &S::etag), makeYouTubeField("id", &S::id),
+		makeYouTubeField("snippet", &S::snippet), makeYouTubeField("status", &S::status),
+		makeYouTubeField("contentDetails", &S::contentDetails), makeYouTubeField("statistics", &S::statistics),
+		makeYouTubeField("monetizationDetails", &S::monetizationDetails));
+};
+
+template<> struct YouTubeFieldTable<InsertingYouTubeLiveBroadcast::Snippet> {
+	using S = InsertingYouTubeLiveBroadcast::Snippet;
+	static constexpr auto fields = std::make_tuple(
+		makeYouTubeField("title", &S::title, YouTubeFieldRequired),
+		makeYouTubeField("description", &S::description),
+		makeYouTubeField("scheduledStartTime", &S::scheduledStartTime, YouTubeFieldRequired),
+		makeYouTubeField("scheduledEndTime", &S::scheduledEndTime));
+};
+
+template<> struct YouTubeFieldTable<InsertingYouTubeLiveBroadcast::Status> {
+	using S = InsertingYouTubeLiveBroadcast::Status;
+	static constexpr auto fields =
+		std::make_tuple(makeYouTubeField("privacyStatus", &S::privacyStatus, YouTubeFieldRequired),
+				makeYouTubeField("selfDeclaredMadeForKids", &S::selfDeclaredMadeForKids));
+};
+
+template<> struct YouTubeFieldTable<InsertingYouTubeLiveBroadcast::ContentDetails::MonitorStream> {
+	using S = InsertingYouTubeLiveBroadcast::ContentDetails::MonitorStream;
+	static constexpr auto fields =
+		std::make_tuple(makeYouTubeField("enableMonitorStream", &S::enableMonitorStream),
+				makeYouTubeField("broadcastStreamDelayMs", &S::broadcastStreamDelayMs));
+};
+
+template<> struct YouTubeFieldTable<InsertingYouTubeLiveBroadcast::ContentDetails> {
+	using S = InsertingYouTubeLiveBroadcast::ContentDetails;
+	static constexpr auto fields = std::make_tuple(
+		makeYouTubeField("enableAutoStart", &S::enableAutoStart),
+		makeYouTubeField("enableAutoStop", &S::enableAutoStop),
+		makeYouTubeField("enableClosedCaptions", &S::enableClosedCaptions),
+		makeYouTubeField("enableDvr", &S::enableDvr), makeYouTubeField("enableEmbed", &S::enableEmbed),
+		makeYouTubeField("recordFromStart", &S::recordFromStart),
+		makeYouTubeField("latencyPreference", &S::latencyPreference),
+		makeYouTubeField("monitorStream", &S::monitorStream, YouTubeFieldOmitDefault));
+};
+
+template<> struct YouTubeFieldTable<InsertingYouTubeLiveBroadcast> {
+	using S = InsertingYouTubeLiveBroadcast;
+	static constexpr auto fields = std::make_tuple(
+		makeYouTubeField("snippet", &S::snippet, YouTubeFieldRequired),
+		makeYouTubeField("status", &S::status, YouTubeFieldRequired),
+		makeYouTubeField("contentDetails", &S::contentDetails, YouTubeFieldRequired | YouTubeFieldOmitDefault));
+};
+
+template<> struct YouTubeFieldTable<UpdatingYouTubeLiveBroadcast::Snippet> {
+	using S = UpdatingYouTubeLiveBroadcast::Snippet;
+	static constexpr auto fields = std::make_tuple(
+		makeYouTubeField("title", &S::title), makeYouTubeField("description", &S::description),
+		makeYouTubeField("scheduledStartTime", &S::scheduledStartTime, YouTubeFieldRequired),
+		makeYouTubeField("scheduledEndTime", &S::scheduledEndTime));
+};
+
+template<> struct YouTubeFieldTable<UpdatingYouTubeLiveBroadcast::Status> {
+	using S = UpdatingYouTubeLiveBroadcast::Status;
+	static constexpr auto fields = std::make_tuple(makeYouTubeField("privacyStatus", &S::privacyStatus));
+};
+
+template<> struct YouTubeFieldTable<UpdatingYouTubeLiveBroadcast::ContentDetails::MonitorStream> {
+	using S = UpdatingYouTubeLiveBroadcast::ContentDetails::MonitorStream;
+	static constexpr auto fields = std::make_tuple(
+		makeYouTubeField("enableMonitorStream", &S::enableMonitorStream, YouTubeFieldRequired),
+		makeYouTubeField("broadcastStreamDelayMs", &S::broadcastStreamDelayMs));
+};
+
+template<> struct YouTubeFieldTable<UpdatingYouTubeLiveBroadcast::ContentDetails> {
+	using S = UpdatingYouTubeLiveBroadcast::ContentDetails;
+	static constexpr auto fields = std::make_tuple(
+		makeYouTubeField("monitorStream", &S::monitorStream),
+		makeYouTubeField("enableAutoStart", &S::enableAutoStart),
+		makeYouTubeField("enableAutoStop", &S::enableAutoStop),
+		makeYouTubeField("enableClosedCaptions", &S::enableClosedCaptions),
+		makeYouTubeField("enableDvr", &S::enableDvr), makeYouTubeField("enableEmbed", &S::enableEmbed),
+		makeYouTubeField("recordFromStart", &S::recordFromStart));
+};
+
+template<> struct YouTubeFieldTable<UpdatingYouTubeLiveBroadcast::MonetizationDetails::CuepointSchedule> {
+	using S = UpdatingYouTubeLiveBroadcast::MonetizationDetails::CuepointSchedule;
+	static constexpr auto fields = std::make_tuple(makeYouTubeField("pauseAdsUntil", &S::pauseAdsUntil));
+};
+
+template<> struct YouTubeFieldTable<UpdatingYouTubeLiveBroadcast::MonetizationDetails> {
+	using S = UpdatingYouTubeLiveBroadcast::MonetizationDetails;
+	static constexpr auto fields =
+		std::make_tuple(makeYouTubeField("cuepointSchedule", &S::cuepointSchedule, YouTubeFieldOmitDefault));
+};
+
+template<> struct YouTubeFieldTable<UpdatingYouTubeLiveBroadcast> {
+	using S = UpdatingYouTubeLiveBroadcast;
+	static constexpr auto fields = std::make_tuple(
+		makeYouTubeField("id", &S::id), makeYouTubeField("snippet", &S::snippet),
+		makeYouTubeField("status", &S::status, YouTubeFieldOmitDefault),
+		makeYouTubeField("contentDetails", &S::contentDetails),
+		makeYouTubeField("monetizationDetails", &S::monetizationDetails, YouTubeFieldOmitDefault));
+};
+
 } // namespace KaitoTokyo::YouTubeApi
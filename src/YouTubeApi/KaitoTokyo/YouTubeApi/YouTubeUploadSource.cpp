@@ -0,0 +1,157 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * KaitoTokyo YouTubeApi Library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "YouTubeUploadSource.hpp"
+
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace KaitoTokyo::YouTubeApi {
+
+YouTubeUploadSource YouTubeUploadSource::mapFile(const std::filesystem::path &path, std::string contentType)
+{
+	YouTubeUploadSource source(std::move(contentType));
+
+#ifdef _WIN32
+	HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+				  FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE) {
+		throw std::runtime_error("FileOpenError(YouTubeUploadSource::mapFile)");
+	}
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize)) {
+		CloseHandle(file);
+		throw std::runtime_error("FileStatError(YouTubeUploadSource::mapFile)");
+	}
+	if (fileSize.QuadPart == 0) {
+		CloseHandle(file);
+		throw std::runtime_error("FileIsEmptyError(YouTubeUploadSource::mapFile)");
+	}
+
+	// The view keeps the mapping, and the mapping the file, open once the handles are closed.
+	HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle(file);
+	if (!mapping) {
+		throw std::runtime_error("FileMapError(YouTubeUploadSource::mapFile)");
+	}
+
+	void *address = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+	if (!address) {
+		throw std::runtime_error("FileMapError(YouTubeUploadSource::mapFile)");
+	}
+
+	source.mappedSize_ = static_cast<std::size_t>(fileSize.QuadPart);
+#else
+	const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+	if (fd < 0) {
+		throw std::runtime_error("FileOpenError(YouTubeUploadSource::mapFile)");
+	}
+
+	struct stat st;
+	if (fstat(fd, &st) != 0) {
+		close(fd);
+		throw std::runtime_error("FileStatError(YouTubeUploadSource::mapFile)");
+	}
+	if (st.st_size == 0) {
+		close(fd);
+		throw std::runtime_error("FileIsEmptyError(YouTubeUploadSource::mapFile)");
+	}
+
+	// The mapping keeps the file open once the descriptor is closed.
+	void *address = mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (address == MAP_FAILED) {
+		throw std::runtime_error("FileMapError(YouTubeUploadSource::mapFile)");
+	}
+
+	source.mappedSize_ = static_cast<std::size_t>(st.st_size);
+#endif
+
+	source.mappedAddress_ = address;
+	source.bytes_ = std::span<const char>(static_cast<const char *>(address), source.mappedSize_);
+	return source;
+}
+
+YouTubeUploadSource YouTubeUploadSource::fromBuffer(std::vector<char> buffer, std::string contentType)
+{
+	YouTubeUploadSource source(std::move(contentType));
+	source.buffer_ = std::move(buffer);
+	source.bytes_ = source.buffer_;
+	return source;
+}
+
+YouTubeUploadSource::~YouTubeUploadSource() noexcept
+{
+	unmap();
+}
+
+YouTubeUploadSource::YouTubeUploadSource(YouTubeUploadSource &&other) noexcept
+	: mappedAddress_(std::exchange(other.mappedAddress_, nullptr)),
+	  mappedSize_(std::exchange(other.mappedSize_, 0)),
+	  buffer_(std::move(other.buffer_)),
+	  bytes_(std::exchange(other.bytes_, {})),
+	  contentType_(std::move(other.contentType_))
+{
+}
+
+YouTubeUploadSource &YouTubeUploadSource::operator=(YouTubeUploadSource &&other) noexcept
+{
+	if (this != &other) {
+		unmap();
+		mappedAddress_ = std::exchange(other.mappedAddress_, nullptr);
+		mappedSize_ = std::exchange(other.mappedSize_, 0);
+		buffer_ = std::move(other.buffer_);
+		bytes_ = std::exchange(other.bytes_, {});
+		contentType_ = std::move(other.contentType_);
+	}
+	return *this;
+}
+
+void YouTubeUploadSource::unmap() noexcept
+{
+	if (!mappedAddress_) {
+		return;
+	}
+#ifdef _WIN32
+	UnmapViewOfFile(mappedAddress_);
+#else
+	munmap(mappedAddress_, mappedSize_);
+#endif
+	mappedAddress_ = nullptr;
+	mappedSize_ = 0;
+}
+
+} // namespace KaitoTokyo::YouTubeApi
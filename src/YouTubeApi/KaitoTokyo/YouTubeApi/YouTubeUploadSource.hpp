@@ -0,0 +1,75 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: MIT
+ *
+ * KaitoTokyo YouTubeApi Library
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace KaitoTokyo::YouTubeApi {
+
+/**
+ * The bytes of a media upload, read straight from a read-only memory map of a file or from a
+ * buffer held in memory, so generated media never has to be written to disk first.
+ *
+ * A mapped file must not be truncated while the source is alive.
+ */
+class YouTubeUploadSource {
+public:
+	/**
+	 * Throws if the file cannot be opened or mapped, or is empty.
+	 */
+	static YouTubeUploadSource mapFile(const std::filesystem::path &path, std::string contentType);
+
+	static YouTubeUploadSource fromBuffer(std::vector<char> buffer, std::string contentType);
+
+	~YouTubeUploadSource() noexcept;
+
+	YouTubeUploadSource(const YouTubeUploadSource &) = delete;
+	YouTubeUploadSource &operator=(const YouTubeUploadSource &) = delete;
+	YouTubeUploadSource(YouTubeUploadSource &&other) noexcept;
+	YouTubeUploadSource &operator=(YouTubeUploadSource &&other) noexcept;
+
+	std::span<const char> getBytes() const noexcept { return bytes_; }
+
+	const std::string &getContentType() const noexcept { return contentType_; }
+
+private:
+	YouTubeUploadSource(std::string contentType) noexcept : contentType_(std::move(contentType)) {}
+
+	void unmap() noexcept;
+
+	void *mappedAddress_ = nullptr;
+	std::size_t mappedSize_ = 0;
+	std::vector<char> buffer_;
+	std::span<const char> bytes_;
+	std::string contentType_;
+};
+
+} // namespace KaitoTokyo::YouTubeApi
@@ -0,0 +1,101 @@
+/*
+ * KaitoTokyo Async Library Tests
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <optional>
+
+#include <KaitoTokyo/Async/Cancellation.hpp>
+
+using namespace KaitoTokyo;
+
+TEST(CancellationTest, DefaultTokenIsNeverCancelled)
+{
+	Async::CancellationToken token;
+
+	EXPECT_FALSE(token.canBeCancelled());
+	EXPECT_FALSE(token.isCancellationRequested());
+	EXPECT_NO_THROW(token.throwIfCancellationRequested());
+}
+
+TEST(CancellationTest, CancelIsObservedByTokens)
+{
+	Async::CancellationSource source;
+	Async::CancellationToken token = source.token();
+
+	EXPECT_TRUE(token.canBeCancelled());
+	EXPECT_FALSE(token.isCancellationRequested());
+
+	EXPECT_TRUE(source.cancel());
+	EXPECT_FALSE(source.cancel());
+
+	EXPECT_TRUE(source.isCancellationRequested());
+	EXPECT_TRUE(token.isCancellationRequested());
+	EXPECT_THROW(token.throwIfCancellationRequested(), Async::OperationCancelledError);
+}
+
+TEST(CancellationTest, TokensCompareBySource)
+{
+	Async::CancellationSource source;
+	Async::CancellationSource otherSource;
+
+	EXPECT_EQ(source.token(), source.token());
+	EXPECT_NE(source.token(), otherSource.token());
+	EXPECT_EQ(Async::CancellationToken(), Async::CancellationToken());
+}
+
+TEST(CancellationTest, CallbackRunsOnceOnCancel)
+{
+	Async::CancellationSource source;
+	int calls = 0;
+
+	Async::CancellationCallback callback(source.token(), [&]() { ++calls; });
+	EXPECT_EQ(calls, 0);
+
+	source.cancel();
+	source.cancel();
+	EXPECT_EQ(calls, 1);
+}
+
+TEST(CancellationTest, CallbackRunsImmediatelyWhenAlreadyCancelled)
+{
+	Async::CancellationSource source;
+	source.cancel();
+	int calls = 0;
+
+	Async::CancellationCallback callback(source.token(), [&]() { ++calls; });
+	EXPECT_EQ(calls, 1);
+}
+
+TEST(CancellationTest, DestroyedCallbackIsNotRun)
+{
+	Async::CancellationSource source;
+	int calls = 0;
+
+	std::optional<Async::CancellationCallback> callback;
+	callback.emplace(source.token(), [&]() { ++calls; });
+	callback.reset();
+
+	source.cancel();
+	EXPECT_EQ(calls, 0);
+}
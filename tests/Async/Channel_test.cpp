@@ -0,0 +1,201 @@
+/*
+ * KaitoTokyo Async Library Tests
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include <KaitoTokyo/Async/Channel.hpp>
+#include <KaitoTokyo/Async/Join.hpp>
+#include <KaitoTokyo/Async/Task.hpp>
+
+using namespace KaitoTokyo;
+
+namespace {
+
+std::vector<int> drain(Async::Channel<int> &channel)
+{
+	std::vector<int> received;
+	channel.close();
+	Async::join([&]() -> Async::Task<void> {
+		while (std::optional<int> value = co_await channel.receive()) {
+			received.push_back(*value);
+		}
+	}());
+	return received;
+}
+
+} // namespace
+
+TEST(ChannelTest, PreservesFifoOrder)
+{
+	Async::Channel<int> channel;
+	channel.send(1);
+	channel.send(2);
+	channel.send(3);
+
+	EXPECT_EQ(drain(channel), (std::vector<int>{1, 2, 3}));
+}
+
+TEST(ChannelTest, HigherPriorityJumpsAhead)
+{
+	Async::Channel<int> channel;
+	channel.send(1);
+	channel.send(2);
+	channel.send(9, {.priority = 1});
+	channel.send(8, {.priority = 1});
+	channel.send(3);
+
+	EXPECT_EQ(drain(channel), (std::vector<int>{9, 8, 1, 2, 3}));
+}
+
+TEST(ChannelTest, CoalescesEqualPendingItems)
+{
+	Async::Channel<int> channel;
+	EXPECT_TRUE(channel.send(1, {.coalesce = true}));
+	EXPECT_TRUE(channel.send(2, {.coalesce = true}));
+	EXPECT_TRUE(channel.send(1, {.coalesce = true}));
+	EXPECT_TRUE(channel.send(1, {.coalesce = true}));
+
+	EXPECT_EQ(channel.size(), 2u);
+	EXPECT_EQ(channel.coalescedCount(), 2u);
+	EXPECT_EQ(drain(channel), (std::vector<int>{1, 2}));
+}
+
+TEST(ChannelTest, CoalescesOnlyPendingItems)
+{
+	Async::Channel<int> channel;
+	channel.send(1, {.coalesce = true});
+
+	std::optional<int> first;
+	Async::join([&]() -> Async::Task<void> { first = co_await channel.receive(); }());
+	EXPECT_EQ(first, 1);
+
+	channel.send(1, {.coalesce = true});
+	EXPECT_EQ(channel.coalescedCount(), 0u);
+	EXPECT_EQ(drain(channel), (std::vector<int>{1}));
+}
+
+TEST(ChannelTest, SendFailsAfterClose)
+{
+	Async::Channel<int> channel;
+	channel.close();
+
+	EXPECT_FALSE(channel.send(1));
+	EXPECT_FALSE(channel.send(1, {.coalesce = true}));
+	EXPECT_EQ(channel.size(), 0u);
+}
+
+TEST(ChannelTest, TrySendFailsWhenFull)
+{
+	Async::Channel<int> channel(2);
+	int value = 1;
+	EXPECT_EQ(channel.trySend(std::move(value)), Async::ChannelTrySendResult::Sent);
+	value = 2;
+	EXPECT_EQ(channel.trySend(std::move(value)), Async::ChannelTrySendResult::Sent);
+	value = 3;
+	EXPECT_EQ(channel.trySend(std::move(value)), Async::ChannelTrySendResult::Full);
+	EXPECT_EQ(channel.size(), 2u);
+
+	// send() ignores the capacity so control messages always get through.
+	EXPECT_TRUE(channel.send(4));
+	EXPECT_EQ(drain(channel), (std::vector<int>{1, 2, 4}));
+
+	value = 5;
+	EXPECT_EQ(channel.trySend(std::move(value)), Async::ChannelTrySendResult::Closed);
+}
+
+TEST(ChannelTest, SendAsyncWaitsForRoom)
+{
+	Async::Channel<int> channel(1);
+	std::vector<bool> results;
+	Async::Task<void> producer = [](Async::Channel<int> &ch, std::vector<bool> &out) -> Async::Task<void> {
+		for (int i = 1; i <= 3; ++i) {
+			out.push_back(co_await ch.sendAsync(i));
+		}
+	}(channel, results);
+	producer.start();
+
+	// The first send fits, the second waits for the receiver.
+	EXPECT_EQ(results, (std::vector<bool>{true}));
+	EXPECT_EQ(channel.size(), 1u);
+
+	std::optional<int> first;
+	Async::join([&]() -> Async::Task<void> { first = co_await channel.receive(); }());
+	EXPECT_EQ(first, 1);
+	// Taking an item admitted the blocked send, which resumed the producer into the third one.
+	EXPECT_EQ(results, (std::vector<bool>{true, true}));
+	EXPECT_EQ(channel.size(), 1u);
+
+	channel.close();
+	EXPECT_EQ(results, (std::vector<bool>{true, true, false}));
+	EXPECT_EQ(drain(channel), (std::vector<int>{2}));
+}
+
+TEST(ChannelTest, ReceiveManyDrainsABatch)
+{
+	Async::Channel<int> channel;
+	for (int i = 1; i <= 5; ++i) {
+		channel.send(i);
+	}
+
+	std::vector<int> firstBatch;
+	Async::join([&]() -> Async::Task<void> { firstBatch = co_await channel.receiveMany(3); }());
+	EXPECT_EQ(firstBatch, (std::vector<int>{1, 2, 3}));
+
+	channel.close();
+	std::vector<std::vector<int>> batches;
+	Async::join([&]() -> Async::Task<void> {
+		for (;;) {
+			std::vector<int> batch = co_await channel.receiveMany(3);
+			if (batch.empty()) {
+				break;
+			}
+			batches.push_back(std::move(batch));
+		}
+	}());
+	EXPECT_EQ(batches, (std::vector<std::vector<int>>{{4, 5}}));
+}
+
+TEST(ChannelTest, ReceiveManyAdmitsBlockedSenders)
+{
+	Async::Channel<int> channel(2);
+	std::size_t sentCount = 0;
+	Async::Task<void> producer = [](Async::Channel<int> &ch, std::size_t &count) -> Async::Task<void> {
+		for (int i = 1; i <= 4; ++i) {
+			if (co_await ch.sendAsync(i)) {
+				++count;
+			}
+		}
+	}(channel, sentCount);
+	producer.start();
+	EXPECT_EQ(sentCount, 2u);
+
+	std::vector<int> batch;
+	Async::join([&]() -> Async::Task<void> { batch = co_await channel.receiveMany(8); }());
+	EXPECT_EQ(batch, (std::vector<int>{1, 2}));
+	EXPECT_EQ(sentCount, 4u);
+	EXPECT_EQ(drain(channel), (std::vector<int>{3, 4}));
+}
@@ -0,0 +1,113 @@
+/*
+ * KaitoTokyo Async Library Tests
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include <KaitoTokyo/Async/FrameAllocator.hpp>
+#include <KaitoTokyo/Async/Join.hpp>
+#include <KaitoTokyo/Async/Task.hpp>
+
+using namespace KaitoTokyo;
+
+namespace {
+
+Async::Task<int> addOne(int value)
+{
+	co_return value + 1;
+}
+
+Async::Task<void> sumOfChain(int count, int &sum)
+{
+	for (int i = 0; i < count; ++i) {
+		sum += co_await addOne(i);
+	}
+}
+
+} // namespace
+
+TEST(FrameAllocatorTest, TaskChurnReusesFrames)
+{
+	// Warm the free list of this thread.
+	int warmup = 0;
+	Async::join(sumOfChain(1, warmup));
+
+	int sum = 0;
+	const Async::FrameAllocatorStats before = Async::FrameAllocator::stats();
+	Async::join(sumOfChain(1000, sum));
+	const Async::FrameAllocatorStats after = Async::FrameAllocator::stats();
+
+	EXPECT_EQ(sum, 500500);
+
+	EXPECT_EQ(after.allocated, before.allocated);
+	EXPECT_GE(after.recycled - before.recycled, 1000u);
+}
+
+TEST(FrameAllocatorTest, RecyclesBlocksOfTheSameSizeClass)
+{
+	void *first = Async::FrameAllocator::allocate(100);
+	Async::FrameAllocator::deallocate(first, 100);
+
+	// 100 and 110 bytes both round up to 112.
+	const Async::FrameAllocatorStats before = Async::FrameAllocator::stats();
+	void *second = Async::FrameAllocator::allocate(110);
+	EXPECT_EQ(second, first);
+	EXPECT_EQ(Async::FrameAllocator::stats().recycled, before.recycled + 1);
+	Async::FrameAllocator::deallocate(second, 110);
+}
+
+TEST(FrameAllocatorTest, LargeFramesBypassTheFreeLists)
+{
+	const Async::FrameAllocatorStats before = Async::FrameAllocator::stats();
+	void *frame = Async::FrameAllocator::allocate(4096);
+	Async::FrameAllocator::deallocate(frame, 4096);
+	const Async::FrameAllocatorStats after = Async::FrameAllocator::stats();
+
+	EXPECT_EQ(after.allocated, before.allocated + 1);
+	EXPECT_EQ(after.released, before.released + 1);
+	EXPECT_EQ(after.recycled, before.recycled);
+}
+
+TEST(FrameAllocatorTest, OptOutReleasesFramesToTheGlobalAllocator)
+{
+	Async::FrameAllocator::setRecyclingEnabled(false);
+	const Async::FrameAllocatorStats before = Async::FrameAllocator::stats();
+	void *frame = Async::FrameAllocator::allocate(900);
+	Async::FrameAllocator::deallocate(frame, 900);
+	const Async::FrameAllocatorStats after = Async::FrameAllocator::stats();
+	Async::FrameAllocator::setRecyclingEnabled(true);
+
+	EXPECT_EQ(after.released, before.released + 1);
+}
+
+TEST(FrameAllocatorTest, FramesFreedOnAnotherThreadAreReusedThere)
+{
+	void *frame = Async::FrameAllocator::allocate(200);
+
+	std::thread([frame]() {
+		Async::FrameAllocator::deallocate(frame, 200);
+		EXPECT_EQ(Async::FrameAllocator::allocate(200), frame);
+		Async::FrameAllocator::deallocate(frame, 200);
+	}).join();
+}
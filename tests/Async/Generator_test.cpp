@@ -0,0 +1,155 @@
+/*
+ * KaitoTokyo Async Library Tests
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <coroutine>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+#include <KaitoTokyo/Async/Generator.hpp>
+#include <KaitoTokyo/Async/Task.hpp>
+
+using namespace KaitoTokyo;
+
+namespace {
+
+// Suspends until resumed by hand, standing in for an await that completes later.
+struct ManualEvent {
+	std::coroutine_handle<> waiter = nullptr;
+
+	auto operator co_await()
+	{
+		struct Awaiter {
+			ManualEvent &event;
+			bool await_ready() const noexcept { return false; }
+			void await_suspend(std::coroutine_handle<> h) noexcept { event.waiter = h; }
+			void await_resume() const noexcept {}
+		};
+		return Awaiter{*this};
+	}
+
+	void fire() { std::exchange(waiter, nullptr).resume(); }
+};
+
+Async::Generator<int> countTo(int n, int &produced)
+{
+	for (int i = 1; i <= n; ++i) {
+		++produced;
+		co_yield i;
+	}
+}
+
+Async::Generator<int> waitThenYield(ManualEvent &event, int n)
+{
+	for (int i = 1; i <= n; ++i) {
+		co_await event;
+		co_yield i;
+	}
+}
+
+Async::Generator<int> throwAfterOne()
+{
+	co_yield 1;
+	throw std::runtime_error("boom");
+}
+
+Async::Task<void> collect(Async::Generator<int> &generator, std::vector<int> &values)
+{
+	while (std::optional<int> value = co_await generator.next()) {
+		values.push_back(*value);
+	}
+}
+
+} // anonymous namespace
+
+TEST(GeneratorTest, YieldsAllValuesInOrder)
+{
+	int produced = 0;
+	Async::Generator<int> generator = countTo(3, produced);
+	std::vector<int> values;
+
+	Async::Task<void> task = collect(generator, values);
+	task.start();
+
+	EXPECT_TRUE(task.await_ready());
+	EXPECT_EQ(values, (std::vector<int>{1, 2, 3}));
+}
+
+TEST(GeneratorTest, IsLazyAndStopsEarly)
+{
+	int produced = 0;
+	Async::Generator<int> generator = countTo(100, produced);
+	EXPECT_EQ(produced, 0);
+
+	EXPECT_EQ(generator.nextInline(), 1);
+	EXPECT_EQ(generator.nextInline(), 2);
+	EXPECT_EQ(produced, 2);
+}
+
+TEST(GeneratorTest, ResumesConsumerAfterBodySuspends)
+{
+	ManualEvent event;
+	Async::Generator<int> generator = waitThenYield(event, 2);
+	std::vector<int> values;
+
+	Async::Task<void> task = collect(generator, values);
+	task.start();
+	EXPECT_TRUE(values.empty());
+
+	event.fire();
+	EXPECT_EQ(values, (std::vector<int>{1}));
+
+	event.fire();
+	EXPECT_TRUE(task.await_ready());
+	EXPECT_EQ(values, (std::vector<int>{1, 2}));
+}
+
+TEST(GeneratorTest, RethrowsExceptionFromBody)
+{
+	Async::Generator<int> generator = throwAfterOne();
+
+	EXPECT_EQ(generator.nextInline(), 1);
+	EXPECT_THROW(generator.nextInline(), std::runtime_error);
+	EXPECT_EQ(generator.nextInline(), std::nullopt);
+}
+
+TEST(GeneratorTest, NextInlineRejectsBodiesThatSuspend)
+{
+	ManualEvent event;
+	Async::Generator<int> generator = waitThenYield(event, 1);
+
+	EXPECT_THROW(generator.nextInline(), std::logic_error);
+
+	event.fire();
+	EXPECT_EQ(generator.nextInline(), 1);
+	EXPECT_EQ(generator.nextInline(), std::nullopt);
+}
+
+TEST(GeneratorTest, EmptyGeneratorYieldsNothing)
+{
+	Async::Generator<int> generator;
+	EXPECT_FALSE(generator);
+	EXPECT_EQ(generator.nextInline(), std::nullopt);
+}
@@ -0,0 +1,147 @@
+/*
+ * KaitoTokyo Async Library Tests
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include <KaitoTokyo/Async/Join.hpp>
+#include <KaitoTokyo/Async/MpscChannel.hpp>
+#include <KaitoTokyo/Async/Task.hpp>
+
+using namespace KaitoTokyo;
+
+namespace {
+
+std::vector<int> drain(Async::MpscChannel<int> &channel)
+{
+	std::vector<int> received;
+	channel.close();
+	Async::join([&]() -> Async::Task<void> {
+		while (std::optional<int> value = co_await channel.receive()) {
+			received.push_back(*value);
+		}
+	}());
+	return received;
+}
+
+Async::Task<void> collect(Async::MpscChannel<std::int64_t> &channel, std::vector<std::int64_t> &received)
+{
+	while (std::optional<std::int64_t> value = co_await channel.receive()) {
+		received.push_back(*value);
+	}
+}
+
+} // namespace
+
+TEST(MpscChannelTest, PreservesFifoOrder)
+{
+	Async::MpscChannel<int> channel;
+	channel.send(1);
+	channel.send(2);
+	channel.send(3);
+
+	EXPECT_EQ(channel.size(), 3u);
+	EXPECT_EQ(drain(channel), (std::vector<int>{1, 2, 3}));
+	EXPECT_EQ(channel.size(), 0u);
+}
+
+TEST(MpscChannelTest, SendFailsAfterClose)
+{
+	Async::MpscChannel<int> channel;
+	channel.send(1);
+	channel.close();
+
+	EXPECT_FALSE(channel.send(2));
+	EXPECT_EQ(drain(channel), (std::vector<int>{1}));
+}
+
+TEST(MpscChannelTest, SendResumesWaitingReceiver)
+{
+	Async::MpscChannel<int> channel;
+	std::vector<int> received;
+	Async::Task<void> receiver = [](Async::MpscChannel<int> &ch, std::vector<int> &out) -> Async::Task<void> {
+		while (std::optional<int> value = co_await ch.receive()) {
+			out.push_back(*value);
+		}
+	}(channel, received);
+	receiver.start();
+
+	EXPECT_TRUE(received.empty());
+	channel.send(1);
+	EXPECT_EQ(received, (std::vector<int>{1}));
+	channel.send(2);
+	EXPECT_EQ(received, (std::vector<int>{1, 2}));
+	channel.close();
+}
+
+TEST(MpscChannelTest, MovesOnlyMessages)
+{
+	Async::MpscChannel<std::unique_ptr<int>> channel;
+	channel.send(std::make_unique<int>(7));
+	channel.close();
+
+	std::optional<std::unique_ptr<int>> received;
+	Async::join([&]() -> Async::Task<void> { received = co_await channel.receive(); }());
+	ASSERT_TRUE(received && *received);
+	EXPECT_EQ(**received, 7);
+}
+
+TEST(MpscChannelTest, DeliversEveryMessageFromConcurrentProducers)
+{
+	constexpr int kProducers = 4;
+	constexpr std::int64_t kMessagesPerProducer = 20000;
+
+	Async::MpscChannel<std::int64_t> channel;
+	std::vector<std::int64_t> received;
+	Async::Task<void> consumer = collect(channel, received);
+	consumer.start();
+
+	std::vector<std::thread> producers;
+	for (int p = 0; p < kProducers; ++p) {
+		producers.emplace_back([&channel, p]() {
+			for (std::int64_t i = 0; i < kMessagesPerProducer; ++i) {
+				channel.send(p * kMessagesPerProducer + i);
+			}
+		});
+	}
+	for (std::thread &producer : producers) {
+		producer.join();
+	}
+	channel.close();
+
+	// The consumer runs inline on whichever thread wakes it, so it has finished once close() returns.
+	ASSERT_EQ(received.size(), static_cast<std::size_t>(kProducers * kMessagesPerProducer));
+
+	// Messages of one producer arrive in the order it sent them.
+	std::vector<std::int64_t> next(kProducers, 0);
+	for (const std::int64_t value : received) {
+		const auto producer = static_cast<std::size_t>(value / kMessagesPerProducer);
+		EXPECT_EQ(value % kMessagesPerProducer, next[producer]);
+		next[producer] = value % kMessagesPerProducer + 1;
+	}
+}
@@ -0,0 +1,118 @@
+/*
+ * KaitoTokyo Async Library Tests
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <KaitoTokyo/Async/Join.hpp>
+#include <KaitoTokyo/Async/OneShotEvent.hpp>
+#include <KaitoTokyo/Async/Task.hpp>
+#include <KaitoTokyo/Async/TaskScope.hpp>
+
+using namespace KaitoTokyo;
+
+namespace {
+
+Async::Task<void> recordResumingThread(Async::OneShotEvent &event, std::vector<std::thread::id> &resumedOn)
+{
+	co_await event.wait();
+	resumedOn.push_back(std::this_thread::get_id());
+}
+
+Async::Task<void> countResumes(Async::OneShotEvent &event, std::atomic<int> &resumed)
+{
+	co_await event.wait();
+	++resumed;
+}
+
+} // namespace
+
+TEST(OneShotEventTest, WaitCompletesImmediatelyOnceSet)
+{
+	Async::OneShotEvent event;
+	event.set();
+	EXPECT_TRUE(event.isSet());
+
+	bool resumed = false;
+	Async::join([&]() -> Async::Task<void> {
+		co_await event.wait();
+		resumed = true;
+	}());
+	EXPECT_TRUE(resumed);
+}
+
+TEST(OneShotEventTest, SetResumesEveryWaiterOnTheCallingThread)
+{
+	Async::OneShotEvent event;
+	std::vector<std::thread::id> resumedOn;
+	Async::TaskScope scope;
+	for (int i = 0; i < 3; ++i) {
+		scope.spawn(recordResumingThread(event, resumedOn));
+	}
+	EXPECT_TRUE(resumedOn.empty());
+
+	std::thread::id setterId;
+	std::thread setter([&]() {
+		setterId = std::this_thread::get_id();
+		event.set();
+	});
+	setter.join();
+	scope.join();
+
+	ASSERT_EQ(resumedOn.size(), 3u);
+	for (std::thread::id id : resumedOn) {
+		EXPECT_EQ(id, setterId);
+	}
+}
+
+TEST(OneShotEventTest, SecondSetDoesNothing)
+{
+	Async::OneShotEvent event;
+	std::atomic<int> resumed = 0;
+	Async::TaskScope scope;
+	scope.spawn(countResumes(event, resumed));
+
+	event.set();
+	event.set();
+	scope.join();
+	EXPECT_EQ(resumed.load(), 1);
+}
+
+TEST(OneShotEventTest, RacingWaitersAndSetAllResume)
+{
+	for (int round = 0; round < 100; ++round) {
+		Async::OneShotEvent event;
+		std::atomic<int> resumed = 0;
+		Async::TaskScope scope;
+		std::thread setter([&]() { event.set(); });
+		for (int i = 0; i < 4; ++i) {
+			scope.spawn(countResumes(event, resumed));
+		}
+		setter.join();
+		scope.join();
+		EXPECT_EQ(resumed.load(), 4);
+	}
+}
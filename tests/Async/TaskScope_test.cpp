@@ -0,0 +1,148 @@
+/*
+ * KaitoTokyo Async Library Tests
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <latch>
+#include <stdexcept>
+#include <thread>
+
+#include <KaitoTokyo/Async/Cancellation.hpp>
+#include <KaitoTokyo/Async/Join.hpp>
+#include <KaitoTokyo/Async/Task.hpp>
+#include <KaitoTokyo/Async/TaskScope.hpp>
+
+using namespace KaitoTokyo;
+
+namespace {
+
+struct ResumeOnNewThread {
+	bool await_ready() const noexcept { return false; }
+	void await_suspend(std::coroutine_handle<> h) const
+	{
+		std::thread([h]() { h.resume(); }).detach();
+	}
+	void await_resume() const noexcept {}
+};
+
+// Polls the token from a worker thread until it is cancelled.
+Async::Task<void> untilCancelled(Async::CancellationToken token, std::atomic<int> &stopped)
+{
+	co_await ResumeOnNewThread{};
+	while (!token.isCancellationRequested()) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	++stopped;
+	throw Async::OperationCancelledError();
+}
+
+} // namespace
+
+TEST(TaskScopeTest, JoinWaitsForEveryChild)
+{
+	std::atomic<int> finished = 0;
+	Async::TaskScope scope;
+	for (int i = 0; i < 8; ++i) {
+		scope.spawn([](std::atomic<int> &count) -> Async::Task<void> {
+			co_await ResumeOnNewThread{};
+			std::this_thread::sleep_for(std::chrono::milliseconds(5));
+			++count;
+		}(finished));
+	}
+
+	scope.join();
+	EXPECT_EQ(finished.load(), 8);
+	EXPECT_EQ(scope.size(), 0u);
+}
+
+TEST(TaskScopeTest, FirstExceptionCancelsSiblingsAndIsRethrown)
+{
+	std::atomic<int> stopped = 0;
+	Async::TaskScope scope;
+	scope.spawn(untilCancelled(scope.token(), stopped));
+	scope.spawn(untilCancelled(scope.token(), stopped));
+	scope.spawn([]() -> Async::Task<void> {
+		co_await ResumeOnNewThread{};
+		throw std::runtime_error("TaskScopeTestError");
+	}());
+
+	EXPECT_THROW(scope.join(), std::runtime_error);
+	EXPECT_TRUE(scope.token().isCancellationRequested());
+	EXPECT_EQ(stopped.load(), 2);
+}
+
+TEST(TaskScopeTest, JoinAsyncResumesAfterTheLastChild)
+{
+	std::atomic<int> stopped = 0;
+	bool joined = false;
+	Async::join([&]() -> Async::Task<void> {
+		Async::TaskScope scope;
+		scope.spawn(untilCancelled(scope.token(), stopped));
+		scope.spawn([](Async::TaskScope &s) -> Async::Task<void> {
+			co_await ResumeOnNewThread{};
+			s.cancel();
+		}(scope));
+
+		// Cancellation the scope asked for is not reported as a failure.
+		co_await scope.joinAsync();
+		joined = true;
+	}());
+
+	EXPECT_TRUE(joined);
+	EXPECT_EQ(stopped.load(), 1);
+}
+
+TEST(TaskScopeTest, JoinForCancelsChildrenThatMissTheDeadline)
+{
+	std::latch childStopped(1);
+	{
+		Async::TaskScope scope;
+		scope.spawn([](Async::CancellationToken token, std::latch &done) -> Async::Task<void> {
+			co_await ResumeOnNewThread{};
+			while (!token.isCancellationRequested()) {
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+			done.count_down();
+		}(scope.token(), childStopped));
+
+		EXPECT_FALSE(scope.joinFor(std::chrono::milliseconds(20)));
+		EXPECT_TRUE(scope.token().isCancellationRequested());
+	}
+	// The child outlives the scope and still finishes cleanly.
+	childStopped.wait();
+}
+
+TEST(TaskScopeTest, ParentTokenCancelsTheScope)
+{
+	Async::CancellationSource parent;
+	Async::TaskScope scope(parent.token());
+	std::atomic<int> stopped = 0;
+	scope.spawn(untilCancelled(scope.token(), stopped));
+
+	parent.cancel();
+	EXPECT_TRUE(scope.joinFor(std::chrono::seconds(10)));
+	EXPECT_EQ(stopped.load(), 1);
+}
@@ -0,0 +1,156 @@
+/*
+ * KaitoTokyo Async Library Tests
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <latch>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <KaitoTokyo/Async/Join.hpp>
+#include <KaitoTokyo/Async/Task.hpp>
+#include <KaitoTokyo/Async/ThreadPoolExecutor.hpp>
+#include <KaitoTokyo/Async/WhenAll.hpp>
+
+using namespace KaitoTokyo;
+using namespace std::chrono_literals;
+
+TEST(ThreadPoolExecutorTest, ResumeOnMovesTheCoroutineToAWorker)
+{
+	Async::ThreadPoolExecutor executor({.name = "test", .threadCount = 2});
+	Async::ThreadPoolExecutor *before = &executor;
+	Async::ThreadPoolExecutor *after = nullptr;
+
+	Async::join([&]() -> Async::Task<void> {
+		before = Async::ThreadPoolExecutor::current();
+		co_await Async::ResumeOn{executor};
+		after = Async::ThreadPoolExecutor::current();
+	}());
+
+	EXPECT_EQ(before, nullptr);
+	EXPECT_EQ(after, &executor);
+	EXPECT_EQ(executor.getName(), "test");
+}
+
+TEST(ThreadPoolExecutorTest, ConcurrencyIsLimitedToTheThreadCount)
+{
+	Async::ThreadPoolExecutor executor({.name = "limited", .threadCount = 2});
+	std::atomic<int> running = 0;
+	std::atomic<int> maxRunning = 0;
+
+	std::vector<Async::Task<void>> tasks;
+	for (int i = 0; i < 8; ++i) {
+		tasks.push_back([](Async::ThreadPoolExecutor &e, std::atomic<int> &r,
+				   std::atomic<int> &m) -> Async::Task<void> {
+			co_await Async::ResumeOn{e};
+			const int now = ++r;
+			int expected = m.load();
+			while (expected < now && !m.compare_exchange_weak(expected, now)) {
+			}
+			std::this_thread::sleep_for(5ms);
+			--r;
+		}(executor, running, maxRunning));
+	}
+	Async::join([&]() -> Async::Task<void> { co_await Async::whenAll(std::move(tasks)); }());
+
+	EXPECT_EQ(maxRunning.load(), 2);
+	// The last item is counted once it has resumed join(), so give its worker a moment.
+	for (int i = 0; i < 1000 && executor.getStats().completed < 8; ++i) {
+		std::this_thread::sleep_for(1ms);
+	}
+	const Async::ThreadPoolExecutorStats stats = executor.getStats();
+	EXPECT_EQ(stats.submitted, 8u);
+	EXPECT_EQ(stats.completed, 8u);
+	EXPECT_EQ(stats.queueDepth, 0u);
+	EXPECT_GE(stats.maxQueueDepth, 1u);
+	EXPECT_GE(stats.busyTime, 40ms);
+}
+
+TEST(ThreadPoolExecutorTest, ThreadHooksRunOnEveryWorker)
+{
+	std::mutex mutex;
+	std::set<std::size_t> started;
+	std::set<std::size_t> stopped;
+	{
+		std::latch allStarted(3);
+		Async::ThreadPoolExecutor executor({
+			.name = "hooks",
+			.threadCount = 3,
+			.onThreadStart =
+				[&](std::size_t index) {
+					EXPECT_EQ(Async::ThreadPoolExecutor::currentThreadIndex(), index);
+					std::scoped_lock lock(mutex);
+					started.insert(index);
+					allStarted.count_down();
+				},
+			.onThreadStop =
+				[&](std::size_t index) {
+					std::scoped_lock lock(mutex);
+					stopped.insert(index);
+				},
+		});
+		allStarted.wait();
+	}
+
+	EXPECT_EQ(started, (std::set<std::size_t>{0, 1, 2}));
+	EXPECT_EQ(stopped, (std::set<std::size_t>{0, 1, 2}));
+}
+
+TEST(ThreadPoolExecutorTest, DestructorRunsQueuedWork)
+{
+	std::atomic<int> ran = 0;
+	{
+		Async::ThreadPoolExecutor executor({.name = "drain", .threadCount = 1});
+		for (int i = 0; i < 16; ++i) {
+			executor.post([&ran]() {
+				std::this_thread::sleep_for(1ms);
+				++ran;
+			});
+		}
+	}
+	EXPECT_EQ(ran.load(), 16);
+}
+
+TEST(ThreadPoolExecutorTest, ZeroThreadsIsRejected)
+{
+	EXPECT_THROW(Async::ThreadPoolExecutor({.name = "empty", .threadCount = 0}), std::invalid_argument);
+}
+
+TEST(ThreadPoolExecutorTest, CanBeDestroyedFromItsOwnWorker)
+{
+	auto executor = std::make_shared<Async::ThreadPoolExecutor>(
+		Async::ThreadPoolExecutorOptions{.name = "self", .threadCount = 2});
+	std::latch destroyed(1);
+
+	executor->post([owner = executor, &destroyed]() mutable {
+		owner.reset();
+		destroyed.count_down();
+	});
+	executor.reset();
+	destroyed.wait();
+}
@@ -0,0 +1,121 @@
+/*
+ * KaitoTokyo Async Library Tests
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <KaitoTokyo/Async/Cancellation.hpp>
+#include <KaitoTokyo/Async/Join.hpp>
+#include <KaitoTokyo/Async/Task.hpp>
+#include <KaitoTokyo/Async/TimerService.hpp>
+#include <KaitoTokyo/Async/WhenAll.hpp>
+
+using namespace KaitoTokyo;
+using namespace std::chrono_literals;
+
+TEST(TimerServiceTest, SleepForWaitsAtLeastTheDuration)
+{
+	Async::TimerService service;
+	const auto start = std::chrono::steady_clock::now();
+	std::thread::id resumedOn;
+
+	Async::join([&]() -> Async::Task<void> {
+		co_await service.sleepFor(20ms);
+		resumedOn = std::this_thread::get_id();
+	}());
+
+	EXPECT_GE(std::chrono::steady_clock::now() - start, 20ms);
+	EXPECT_NE(resumedOn, std::this_thread::get_id());
+	EXPECT_EQ(service.pendingCount(), 0u);
+}
+
+TEST(TimerServiceTest, ManyTimersAllFireInDeadlineOrder)
+{
+	Async::TimerService service;
+	std::vector<Async::Task<int>> sleepers;
+	std::atomic<int> order = 0;
+	// Spans more than one lap of the wheel and several sleepers per bucket.
+	for (int i = 0; i < 64; ++i) {
+		sleepers.push_back([](Async::TimerService &s, int delay, std::atomic<int> &o) -> Async::Task<int> {
+			co_await s.sleepFor(std::chrono::milliseconds(delay));
+			co_return o++;
+		}(service, (i % 8) * 100, order));
+	}
+
+	std::vector<int> finished;
+	Async::join([&]() -> Async::Task<void> { finished = co_await Async::whenAll(std::move(sleepers)); }());
+
+	ASSERT_EQ(finished.size(), 64u);
+	for (int i = 0; i < 64; ++i) {
+		for (int j = 0; j < 64; ++j) {
+			if (i % 8 < j % 8) {
+				EXPECT_LT(finished[i], finished[j]);
+			}
+		}
+	}
+}
+
+TEST(TimerServiceTest, CancellationEndsTheSleepEarly)
+{
+	Async::TimerService service;
+	Async::CancellationSource source;
+	const auto start = std::chrono::steady_clock::now();
+
+	std::thread canceller([&]() {
+		std::this_thread::sleep_for(20ms);
+		source.cancel();
+	});
+	EXPECT_THROW(Async::join([&]() -> Async::Task<void> { co_await service.sleepFor(1h, source.token()); }()),
+		     Async::OperationCancelledError);
+	canceller.join();
+
+	EXPECT_LT(std::chrono::steady_clock::now() - start, 10s);
+	EXPECT_EQ(service.pendingCount(), 0u);
+}
+
+TEST(TimerServiceTest, AlreadyCancelledTokenDoesNotSuspend)
+{
+	Async::TimerService service;
+	Async::CancellationSource source;
+	source.cancel();
+
+	EXPECT_THROW(Async::join([&]() -> Async::Task<void> { co_await service.sleepFor(1h, source.token()); }()),
+		     Async::OperationCancelledError);
+}
+
+TEST(TimerServiceTest, DestroyingASleepingTaskUnschedulesIt)
+{
+	Async::TimerService service;
+	{
+		Async::Task<void> task = [](Async::TimerService &s) -> Async::Task<void> {
+			co_await s.sleepFor(1h);
+		}(service);
+		task.start();
+		EXPECT_EQ(service.pendingCount(), 1u);
+	}
+	EXPECT_EQ(service.pendingCount(), 0u);
+}
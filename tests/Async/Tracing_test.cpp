@@ -0,0 +1,101 @@
+/*
+ * KaitoTokyo Async Library Tests
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <KaitoTokyo/Async/Join.hpp>
+#include <KaitoTokyo/Async/Task.hpp>
+#include <KaitoTokyo/Async/ThreadPoolExecutor.hpp>
+#include <KaitoTokyo/Async/Tracing.hpp>
+
+using namespace KaitoTokyo;
+
+namespace {
+
+std::string writeTrace()
+{
+	std::ostringstream out;
+	Async::TraceRecorder::writeChromeTrace(out);
+	return out.str();
+}
+
+Async::Task<void> hopOnto(Async::ThreadPoolExecutor &executor)
+{
+	co_await Async::ResumeOn{executor};
+}
+
+} // anonymous namespace
+
+TEST(TracingTest, IsCompiledInForThisTest)
+{
+	EXPECT_TRUE(Async::TraceRecorder::isCompiledIn());
+}
+
+TEST(TracingTest, RecordsHopsAndNamedTasks)
+{
+	Async::ThreadPoolExecutor executor({.name = "trace", .threadCount = 1});
+	Async::TraceRecorder::setEnabled(true);
+	Async::join(hopOnto(executor).named("hopOntoTraced"));
+	Async::TraceRecorder::setEnabled(false);
+
+	const std::string trace = writeTrace();
+	EXPECT_TRUE(trace.starts_with("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+	EXPECT_NE(trace.find("{\"name\":\"ResumeOn\",\"cat\":\"hop\",\"ph\":\"X\""), std::string::npos);
+	EXPECT_NE(trace.find("\"args\":{\"fromTid\":"), std::string::npos);
+	EXPECT_NE(trace.find("{\"name\":\"hopOntoTraced\",\"cat\":\"task\""), std::string::npos);
+}
+
+TEST(TracingTest, NothingIsRecordedWhileDisabled)
+{
+	Async::ThreadPoolExecutor executor({.name = "untraced", .threadCount = 1});
+	Async::TraceRecorder::setEnabled(false);
+	Async::join(hopOnto(executor).named("hopOntoUntraced"));
+
+	EXPECT_EQ(writeTrace().find("hopOntoUntraced"), std::string::npos);
+}
+
+TEST(TracingTest, NamesAreEscaped)
+{
+	Async::TraceRecorder::recordSpan("quoted\"name\\", "test", 1000, 3000);
+
+	EXPECT_NE(writeTrace().find("\"name\":\"quoted\\\"name\\\\\",\"cat\":\"test\",\"ph\":\"X\",\"pid\":1,"),
+		  std::string::npos);
+}
+
+TEST(TracingTest, FullBufferDropsEventsUntilCleared)
+{
+	std::thread([]() {
+		for (std::size_t i = 0; i < Async::TraceDetail::kEventsPerThread + 5; ++i) {
+			Async::TraceRecorder::recordSpan("filler", "test", 0, 1);
+		}
+	}).join();
+	EXPECT_EQ(Async::TraceRecorder::droppedCount(), 5u);
+
+	Async::TraceRecorder::clear();
+	EXPECT_EQ(Async::TraceRecorder::droppedCount(), 0u);
+	EXPECT_EQ(writeTrace().find("filler"), std::string::npos);
+}
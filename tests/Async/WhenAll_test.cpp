@@ -0,0 +1,144 @@
+/*
+ * KaitoTokyo Async Library Tests
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <KaitoTokyo/Async/Join.hpp>
+#include <KaitoTokyo/Async/Task.hpp>
+#include <KaitoTokyo/Async/WhenAll.hpp>
+
+using namespace KaitoTokyo;
+
+namespace {
+
+struct ResumeOnNewThread {
+	bool await_ready() const noexcept { return false; }
+	void await_suspend(std::coroutine_handle<> h) const
+	{
+		std::thread([h]() { h.resume(); }).detach();
+	}
+	void await_resume() const noexcept {}
+};
+
+Async::Task<int> immediate(int value)
+{
+	co_return value;
+}
+
+Async::Task<int> delayed(int value, std::chrono::milliseconds delay, std::atomic<int> &running,
+			 std::atomic<int> &maxRunning)
+{
+	co_await ResumeOnNewThread{};
+	const int now = ++running;
+	int expected = maxRunning.load();
+	while (expected < now && !maxRunning.compare_exchange_weak(expected, now)) {
+	}
+	std::this_thread::sleep_for(delay);
+	--running;
+	co_return value;
+}
+
+Async::Task<void> throwing()
+{
+	co_await ResumeOnNewThread{};
+	throw std::runtime_error("WhenAllTestError");
+}
+
+} // namespace
+
+TEST(WhenAllTest, ReturnsResultsInArgumentOrder)
+{
+	std::tuple<int, std::string> result;
+	Async::join([&]() -> Async::Task<void> {
+		result = co_await Async::whenAll(immediate(1), []() -> Async::Task<std::string> { co_return "two"; }());
+	}());
+
+	EXPECT_EQ(std::get<0>(result), 1);
+	EXPECT_EQ(std::get<1>(result), "two");
+}
+
+TEST(WhenAllTest, RunsChildrenConcurrently)
+{
+	std::atomic<int> running = 0;
+	std::atomic<int> maxRunning = 0;
+	int sum = 0;
+
+	Async::join([&]() -> Async::Task<void> {
+		auto [a, b, c] =
+			co_await Async::whenAll(delayed(1, std::chrono::milliseconds{50}, running, maxRunning),
+						delayed(2, std::chrono::milliseconds{50}, running, maxRunning),
+						delayed(3, std::chrono::milliseconds{50}, running, maxRunning));
+		sum = a + b + c;
+	}());
+
+	EXPECT_EQ(sum, 6);
+	EXPECT_GT(maxRunning.load(), 1);
+}
+
+TEST(WhenAllTest, RethrowsAfterAllChildrenFinish)
+{
+	std::atomic<int> running = 0;
+	std::atomic<int> maxRunning = 0;
+
+	EXPECT_THROW(Async::join([&]() -> Async::Task<void> {
+			     co_await Async::whenAll(throwing(),
+						     delayed(1, std::chrono::milliseconds{20}, running, maxRunning));
+		     }()),
+		     std::runtime_error);
+	EXPECT_EQ(running.load(), 0);
+}
+
+TEST(WhenAllTest, RangeOverload)
+{
+	std::vector<int> results;
+	Async::join([&]() -> Async::Task<void> {
+		std::vector<Async::Task<int>> tasks;
+		for (int i = 0; i < 8; ++i) {
+			tasks.push_back(immediate(i));
+		}
+		results = co_await Async::whenAll(std::move(tasks));
+	}());
+
+	ASSERT_EQ(results.size(), 8u);
+	for (int i = 0; i < 8; ++i) {
+		EXPECT_EQ(results[i], i);
+	}
+}
+
+TEST(WhenAllTest, EmptyRange)
+{
+	bool done = false;
+	Async::join([&]() -> Async::Task<void> {
+		std::vector<int> results = co_await Async::whenAll(std::vector<Async::Task<int>>{});
+		done = results.empty();
+	}());
+
+	EXPECT_TRUE(done);
+}
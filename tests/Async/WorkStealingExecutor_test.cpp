@@ -0,0 +1,220 @@
+/*
+ * KaitoTokyo Async Library Tests
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <exception>
+#include <latch>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <KaitoTokyo/Async/Join.hpp>
+#include <KaitoTokyo/Async/Task.hpp>
+#include <KaitoTokyo/Async/WhenAll.hpp>
+#include <KaitoTokyo/Async/WorkStealingExecutor.hpp>
+
+using namespace KaitoTokyo;
+using namespace std::chrono_literals;
+
+namespace {
+
+// A coroutine that waits to be resumed through post() and frees itself when it returns.
+struct Posted {
+	struct promise_type {
+		Posted get_return_object() { return Posted{std::coroutine_handle<promise_type>::from_promise(*this)}; }
+		std::suspend_always initial_suspend() noexcept { return {}; }
+		std::suspend_never final_suspend() noexcept { return {}; }
+		void return_void() noexcept {}
+		void unhandled_exception() noexcept { std::terminate(); }
+	};
+
+	std::coroutine_handle<> handle;
+};
+
+Posted record(std::mutex &mutex, std::vector<int> &order, int value, std::latch &done)
+{
+	{
+		std::scoped_lock lock(mutex);
+		order.push_back(value);
+	}
+	done.count_down();
+	co_return;
+}
+
+Posted postTwo(Async::WorkStealingExecutor &executor, std::mutex &mutex, std::vector<int> &order, std::latch &done)
+{
+	executor.post(record(mutex, order, 1, done).handle);
+	executor.post(record(mutex, order, 2, done).handle);
+	co_return;
+}
+
+Posted countOnWorker(std::atomic<int> &ran, std::vector<std::size_t> &workers, std::latch &done)
+{
+	workers[static_cast<std::size_t>(ran++)] = Async::WorkStealingExecutor::currentThreadIndex();
+	done.count_down();
+	co_return;
+}
+
+Posted fanOutAndBlock(Async::WorkStealingExecutor &executor, std::atomic<int> &ran,
+		      std::vector<std::size_t> &workers, std::latch &done, std::size_t &blockedWorker)
+{
+	blockedWorker = Async::WorkStealingExecutor::currentThreadIndex();
+	for (int i = 0; i < 8; ++i) {
+		executor.post(countOnWorker(ran, workers, done).handle);
+	}
+	// This worker does not come back until the others have run everything it queued.
+	done.wait();
+	co_return;
+}
+
+Posted sleepThenPostAgain(Async::WorkStealingExecutor &executor, std::atomic<int> &ran, bool again)
+{
+	std::this_thread::sleep_for(1ms);
+	++ran;
+	if (again) {
+		executor.post(sleepThenPostAgain(executor, ran, false).handle);
+	}
+	co_return;
+}
+
+Posted destroyOwner(std::shared_ptr<Async::WorkStealingExecutor> owner, std::latch &destroyed)
+{
+	owner.reset();
+	destroyed.count_down();
+	co_return;
+}
+
+} // anonymous namespace
+
+TEST(WorkStealingExecutorTest, ResumeOnMovesTheCoroutineToAWorker)
+{
+	Async::WorkStealingExecutor executor({.name = "test", .threadCount = 2});
+	Async::WorkStealingExecutor *before = &executor;
+	Async::WorkStealingExecutor *after = nullptr;
+
+	Async::join([&]() -> Async::Task<void> {
+		before = Async::WorkStealingExecutor::current();
+		co_await Async::ResumeOn{executor};
+		after = Async::WorkStealingExecutor::current();
+	}());
+
+	EXPECT_EQ(before, nullptr);
+	EXPECT_EQ(after, &executor);
+	EXPECT_EQ(executor.getName(), "test");
+}
+
+TEST(WorkStealingExecutorTest, HandlePostedFromAWorkerRunsNext)
+{
+	Async::WorkStealingExecutor executor({.name = "lifo", .threadCount = 1});
+	std::mutex mutex;
+	std::vector<int> order;
+	std::latch done(2);
+
+	executor.post(postTwo(executor, mutex, order, done).handle);
+	done.wait();
+
+	// The second post takes the LIFO slot and pushes the first one back into the deque.
+	std::scoped_lock lock(mutex);
+	EXPECT_EQ(order, (std::vector<int>{2, 1}));
+	EXPECT_GE(executor.getStats().lifoRuns, 1u);
+}
+
+TEST(WorkStealingExecutorTest, IdleWorkersStealFromABlockedWorker)
+{
+	Async::WorkStealingExecutor executor({.name = "steal", .threadCount = 4});
+	std::atomic<int> ran = 0;
+	std::vector<std::size_t> workers(8);
+	std::latch done(8);
+	std::size_t blockedWorker = 0;
+
+	executor.post(fanOutAndBlock(executor, ran, workers, done, blockedWorker).handle);
+	done.wait();
+
+	EXPECT_EQ(ran.load(), 8);
+	for (const std::size_t worker : workers) {
+		EXPECT_NE(worker, blockedWorker);
+	}
+	EXPECT_GE(executor.getStats().stolen, 8u);
+}
+
+TEST(WorkStealingExecutorTest, ManyCoroutinesHopOnConcurrently)
+{
+	Async::WorkStealingExecutor executor({.name = "many", .threadCount = 4});
+	std::atomic<int> onWorker = 0;
+
+	auto hop = [](Async::WorkStealingExecutor &e, std::atomic<int> &count) -> Async::Task<void> {
+		co_await Async::ResumeOn{e};
+		if (Async::WorkStealingExecutor::current() == &e) {
+			++count;
+		}
+	};
+	std::vector<std::thread> threads;
+	for (int t = 0; t < 4; ++t) {
+		threads.emplace_back([&]() {
+			for (int i = 0; i < 250; ++i) {
+				Async::join(hop(executor, onWorker));
+			}
+		});
+	}
+	for (std::thread &thread : threads) {
+		thread.join();
+	}
+
+	EXPECT_EQ(onWorker.load(), 1000);
+	EXPECT_EQ(executor.getStats().submitted, 1000u);
+}
+
+TEST(WorkStealingExecutorTest, DestructorRunsQueuedWork)
+{
+	std::atomic<int> ran = 0;
+	{
+		Async::WorkStealingExecutor executor({.name = "drain", .threadCount = 2});
+		for (int i = 0; i < 16; ++i) {
+			executor.post(sleepThenPostAgain(executor, ran, true).handle);
+		}
+	}
+	// Handles posted by workers while draining run as well.
+	EXPECT_EQ(ran.load(), 32);
+}
+
+TEST(WorkStealingExecutorTest, ZeroThreadsIsRejected)
+{
+	EXPECT_THROW(Async::WorkStealingExecutor({.name = "empty", .threadCount = 0}), std::invalid_argument);
+}
+
+TEST(WorkStealingExecutorTest, CanBeDestroyedFromItsOwnWorker)
+{
+	auto executor = std::make_shared<Async::WorkStealingExecutor>(
+		Async::WorkStealingExecutorOptions{.name = "self", .threadCount = 2});
+	std::latch destroyed(1);
+
+	executor->post(destroyOwner(executor, destroyed).handle);
+	executor.reset();
+	destroyed.wait();
+}
@@ -0,0 +1,151 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - Controller Module Tests
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <stdexcept>
+#include <string>
+
+#include <nlohmann/json.hpp>
+
+#include <SegmentSchedule.hpp>
+
+using namespace KaitoTokyo::LiveStreamSegmenter;
+using namespace std::chrono_literals;
+
+namespace {
+
+using Clock = Controller::SegmentSchedule::Clock;
+
+// A UTC date and time, to keep the expectations readable.
+Clock::time_point utc(int year, unsigned month, unsigned day, std::chrono::milliseconds timeOfDay = 0ms)
+{
+	return std::chrono::sys_days{std::chrono::year{year} / month / day} + timeOfDay;
+}
+
+Controller::SegmentSchedule timesOfDay(std::initializer_list<const char *> times, int utcOffsetMinutes)
+{
+	nlohmann::json jTimes = nlohmann::json::array();
+	for (const char *time : times) {
+		jTimes.push_back(time);
+	}
+	return Controller::SegmentSchedule::fromConfig(
+		{{"segmentTimesOfDay", jTimes}, {"segmentUtcOffsetMinutes", utcOffsetMinutes}});
+}
+
+} // anonymous namespace
+
+TEST(SegmentScheduleTest, IntervalFromStartCountsFromTheSessionStart)
+{
+	const auto schedule = Controller::SegmentSchedule::everyIntervalFromStart(1h);
+	const Clock::time_point startedAt = utc(2025, 1, 1, 10h + 17min);
+
+	EXPECT_EQ(schedule.nextBoundary(startedAt, startedAt), startedAt + 1h);
+	// Strictly after: a boundary that is exactly now is already past.
+	EXPECT_EQ(schedule.nextBoundary(startedAt, startedAt + 1h), startedAt + 2h);
+	// Days later, still on the grid of the start rather than drifting.
+	EXPECT_EQ(schedule.nextBoundary(startedAt, startedAt + 72h + 30min), startedAt + 73h);
+	EXPECT_FALSE(schedule.isWallClock());
+}
+
+TEST(SegmentScheduleTest, IntervalOnWallClockWithANegativeUtcOffset)
+{
+	// Every 2 hours from 01:00 at UTC-05:00, i.e. at 06:00, 08:00, ... UTC.
+	const auto schedule = Controller::SegmentSchedule::everyIntervalOnWallClock(2h, 1h, -300min);
+	const Clock::time_point startedAt = utc(2025, 6, 1);
+
+	EXPECT_EQ(schedule.nextBoundary(startedAt, utc(2025, 6, 1, 5h)), utc(2025, 6, 1, 6h));
+	EXPECT_EQ(schedule.nextBoundary(startedAt, utc(2025, 6, 1, 6h)), utc(2025, 6, 1, 8h));
+	EXPECT_TRUE(schedule.isWallClock());
+}
+
+TEST(SegmentScheduleTest, IntervalOnWallClockRoundsDownBeforeTheOrigin)
+{
+	// Midnight at UTC-05:00 on 1970-01-01 is 05:00 UTC, so 01:00 UTC lies before the origin and the
+	// division has to round towards negative infinity to land on the 04:00 UTC boundary.
+	const auto schedule = Controller::SegmentSchedule::everyIntervalOnWallClock(3h, 0ms, -300min);
+
+	EXPECT_EQ(schedule.nextBoundary(Clock::time_point{}, utc(1970, 1, 1, 1h)), utc(1970, 1, 1, 2h));
+	EXPECT_EQ(schedule.nextBoundary(Clock::time_point{}, utc(1970, 1, 1, 2h)), utc(1970, 1, 1, 5h));
+}
+
+TEST(SegmentScheduleTest, TimesOfDayRollOverToTheNextDay)
+{
+	// 04:00 and 16:30 JST are 19:00 and 07:30 UTC.
+	const auto schedule = timesOfDay({"16:30", "04:00"}, 540);
+	const Clock::time_point startedAt = utc(2025, 3, 1);
+
+	EXPECT_EQ(schedule.nextBoundary(startedAt, utc(2025, 3, 1, 6h)), utc(2025, 3, 1, 7h + 30min));
+	EXPECT_EQ(schedule.nextBoundary(startedAt, utc(2025, 3, 1, 7h + 30min)), utc(2025, 3, 1, 19h));
+	// After the last time of the day, the first time of the next day.
+	EXPECT_EQ(schedule.nextBoundary(startedAt, utc(2025, 3, 1, 20h)), utc(2025, 3, 2, 7h + 30min));
+	// Across the end of a month and of a year.
+	EXPECT_EQ(schedule.nextBoundary(startedAt, utc(2025, 12, 31, 20h)), utc(2026, 1, 1, 7h + 30min));
+}
+
+TEST(SegmentScheduleTest, TimesOfDayWithANegativeUtcOffset)
+{
+	// 23:00 at UTC-08:00 is 07:00 UTC of the next day.
+	const auto schedule = timesOfDay({"23:00"}, -480);
+	const Clock::time_point startedAt = utc(2025, 3, 1);
+
+	EXPECT_EQ(schedule.nextBoundary(startedAt, utc(2025, 3, 1, 6h)), utc(2025, 3, 1, 7h));
+	EXPECT_EQ(schedule.nextBoundary(startedAt, utc(2025, 3, 1, 7h)), utc(2025, 3, 2, 7h));
+}
+
+TEST(SegmentScheduleTest, ParsesTimesOfDay)
+{
+	const Clock::time_point day = utc(2025, 3, 1);
+
+	EXPECT_EQ(timesOfDay({"04:05"}, 0).nextBoundary(day, day), day + 4h + 5min);
+	EXPECT_EQ(timesOfDay({"04:05:06"}, 0).nextBoundary(day, day), day + 4h + 5min + 6s);
+	EXPECT_EQ(timesOfDay({"00:00"}, 0).nextBoundary(day, day), day + 24h);
+	EXPECT_EQ(timesOfDay({"23:59:59"}, 0).nextBoundary(day, day), day + 23h + 59min + 59s);
+}
+
+TEST(SegmentScheduleTest, RejectsMalformedTimesOfDay)
+{
+	for (const char *text : {" 4:5", "4:05", "04:5", "+4:05", "-1:00", "04:-5", "04:05x", "04:05:", "04:05:6",
+				 "04-05", "24:00", "12:60", "12:00:60", ""}) {
+		EXPECT_THROW(timesOfDay({text}, 0), std::invalid_argument) << '"' << text << '"';
+	}
+}
+
+TEST(SegmentScheduleTest, RejectsInvalidConfig)
+{
+	EXPECT_THROW(Controller::SegmentSchedule::fromConfig(nlohmann::json::object()), std::invalid_argument);
+	EXPECT_THROW(Controller::SegmentSchedule::fromConfig({{"segmentIntervalMilliseconds", 0}}),
+		     std::invalid_argument);
+	EXPECT_THROW(Controller::SegmentSchedule::fromConfig({{"segmentIntervalMilliseconds", 1000},
+							      {"segmentAlignToWallClock", true},
+							      {"segmentUtcOffsetMinutes", 25 * 60}}),
+		     std::invalid_argument);
+	EXPECT_THROW(Controller::SegmentSchedule::fromConfig({{"segmentTimesOfDay", nlohmann::json::array()}}),
+		     std::invalid_argument);
+}
+
+TEST(SegmentScheduleTest, Describe)
+{
+	EXPECT_EQ(Controller::SegmentSchedule::everyIntervalFromStart(1h).describe(), "every 3600000ms from start");
+	EXPECT_EQ(Controller::SegmentSchedule::everyIntervalOnWallClock(1h, 0ms, 540min).describe(),
+		  "every 3600000ms on wall clock offset 0ms UTC+540min");
+	EXPECT_EQ(timesOfDay({"16:30", "04:00:05"}, -300).describe(), "at 04:00:05,16:30:00 UTC-300min");
+}
@@ -0,0 +1,114 @@
+/*
+ * KaitoTokyo CurlHelper Library Tests
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <KaitoTokyo/CurlHelper/CurlConnectionPool.hpp>
+#include <KaitoTokyo/CurlHelper/CurlHeaderCallback.hpp>
+
+using namespace KaitoTokyo;
+
+namespace {
+
+std::size_t callHeaderCallback(std::string header, std::vector<char> &buffer)
+{
+	return CurlHelper::CurlContentLengthReserveHeaderCallback(header.data(), 1, header.size(), &buffer);
+}
+
+} // anonymous namespace
+
+TEST(CurlConnectionPoolTest, RetainsResponseBufferAcrossCheckouts)
+{
+	auto pool = std::make_shared<CurlHelper::CurlConnectionPool>();
+
+	const char *data = nullptr;
+	{
+		CurlHelper::CurlConnectionPool::Lease lease = pool->checkout();
+		std::vector<char> &buffer = lease.getResponseBuffer();
+		buffer.assign(4096, 'x');
+		data = buffer.data();
+	}
+
+	CurlHelper::CurlConnectionPool::Lease lease = pool->checkout();
+	const std::vector<char> &buffer = lease.getResponseBuffer();
+	EXPECT_TRUE(buffer.empty());
+	EXPECT_GE(buffer.capacity(), 4096u);
+	EXPECT_EQ(buffer.data(), data);
+}
+
+TEST(CurlConnectionPoolTest, RetainsUrlBufferAcrossCheckouts)
+{
+	auto pool = std::make_shared<CurlHelper::CurlConnectionPool>();
+
+	{
+		CurlHelper::CurlConnectionPool::Lease lease = pool->checkout();
+		lease.getUrlBuffer().assign(1024, 'x');
+	}
+
+	CurlHelper::CurlConnectionPool::Lease lease = pool->checkout();
+	EXPECT_TRUE(lease.getUrlBuffer().empty());
+	EXPECT_GE(lease.getUrlBuffer().capacity(), 1024u);
+}
+
+TEST(CurlConnectionPoolTest, ReleasesOversizedResponseBuffer)
+{
+	auto pool = std::make_shared<CurlHelper::CurlConnectionPool>(8, 1024);
+
+	{
+		CurlHelper::CurlConnectionPool::Lease lease = pool->checkout();
+		lease.getResponseBuffer().assign(4096, 'x');
+	}
+
+	CurlHelper::CurlConnectionPool::Lease lease = pool->checkout();
+	EXPECT_EQ(lease.getResponseBuffer().capacity(), 0u);
+	EXPECT_EQ(pool->getStatistics().handlesCreated, 1u);
+}
+
+TEST(CurlConnectionPoolTest, HeaderCallbackReservesContentLength)
+{
+	std::vector<char> buffer{'a', 'b'};
+
+	EXPECT_EQ(callHeaderCallback("Content-Length: 1000\r\n", buffer), 22u);
+	EXPECT_GE(buffer.capacity(), 1002u);
+	EXPECT_EQ(buffer.size(), 2u);
+
+	std::vector<char> lowercase;
+	callHeaderCallback("content-length:500\r\n", lowercase);
+	EXPECT_GE(lowercase.capacity(), 500u);
+}
+
+TEST(CurlConnectionPoolTest, HeaderCallbackIgnoresOtherHeaders)
+{
+	std::vector<char> buffer;
+
+	EXPECT_EQ(callHeaderCallback("HTTP/2 200\r\n", buffer), 12u);
+	callHeaderCallback("Content-Type: application/json\r\n", buffer);
+	callHeaderCallback("Content-Length: bogus\r\n", buffer);
+	callHeaderCallback("X-Content-Length: 1000\r\n", buffer);
+
+	EXPECT_EQ(buffer.capacity(), 0u);
+}
@@ -0,0 +1,163 @@
+/*
+ * KaitoTokyo CurlHelper Library Tests
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <KaitoTokyo/Async/Task.hpp>
+#include <KaitoTokyo/CurlHelper/CurlConnectionPool.hpp>
+#include <KaitoTokyo/CurlHelper/CurlMultiExecutor.hpp>
+#include <KaitoTokyo/CurlHelper/CurlWriteCallback.hpp>
+
+using namespace KaitoTokyo;
+
+namespace {
+
+struct Response {
+	CURLcode result;
+	std::string body;
+	std::thread::id resumedThreadId;
+};
+
+std::filesystem::path writeTempFile(const std::string &name, const std::string &contents)
+{
+	const std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+	std::ofstream ofs(path, std::ios::binary);
+	ofs << contents;
+	return path;
+}
+
+std::string toFileUrl(const std::filesystem::path &path)
+{
+	return "file://" + path.generic_string();
+}
+
+Async::Task<Response> fetch(CurlHelper::CurlMultiExecutor *executor,
+			    std::shared_ptr<CurlHelper::CurlConnectionPool> pool, std::string url)
+{
+	const CurlHelper::CurlConnectionPool::Lease curl = pool->checkout();
+
+	std::vector<char> readBuffer;
+	curl_easy_setopt(curl.getRaw(), CURLOPT_URL, url.c_str());
+	curl_easy_setopt(curl.getRaw(), CURLOPT_WRITEFUNCTION, CurlHelper::CurlCharVectorWriteCallback);
+	curl_easy_setopt(curl.getRaw(), CURLOPT_WRITEDATA, &readBuffer);
+
+	const CURLcode result = co_await CurlHelper::CurlMultiExecutor::PerformAwaiter(executor, curl.getRaw());
+	co_return Response{result, std::string(readBuffer.begin(), readBuffer.end()), std::this_thread::get_id()};
+}
+
+Async::Task<void> fetchInto(CurlHelper::CurlMultiExecutor *executor,
+			    std::shared_ptr<CurlHelper::CurlConnectionPool> pool, std::string url,
+			    std::promise<Response> &promise)
+{
+	promise.set_value(co_await fetch(executor, std::move(pool), std::move(url)));
+}
+
+} // anonymous namespace
+
+TEST(CurlMultiExecutorTest, PerformsTransferOnPollThread)
+{
+	const std::filesystem::path path = writeTempFile("CurlMultiExecutorTest_Single.txt", "hello");
+	auto pool = std::make_shared<CurlHelper::CurlConnectionPool>();
+	std::promise<Response> promise;
+	std::future<Response> future = promise.get_future();
+	Async::Task<void> task;
+
+	// Destroyed first, so the poll thread is done with the task before it goes away.
+	CurlHelper::CurlMultiExecutor executor;
+	task = fetchInto(&executor, pool, toFileUrl(path), promise);
+	task.start();
+
+	const Response response = future.get();
+	EXPECT_EQ(response.result, CURLE_OK);
+	EXPECT_EQ(response.body, "hello");
+	EXPECT_NE(response.resumedThreadId, std::this_thread::get_id());
+
+	std::filesystem::remove(path);
+}
+
+TEST(CurlMultiExecutorTest, RunsManyTransfersConcurrently)
+{
+	constexpr int kTransferCount = 32;
+
+	const std::filesystem::path path = writeTempFile("CurlMultiExecutorTest_Many.txt", "payload");
+	auto pool = std::make_shared<CurlHelper::CurlConnectionPool>();
+	std::vector<std::promise<Response>> promises(kTransferCount);
+	std::vector<Async::Task<void>> tasks;
+
+	CurlHelper::CurlMultiExecutor executor;
+	for (std::promise<Response> &promise : promises) {
+		tasks.push_back(fetchInto(&executor, pool, toFileUrl(path), promise));
+		tasks.back().start();
+	}
+
+	for (std::promise<Response> &promise : promises) {
+		const Response response = promise.get_future().get();
+		EXPECT_EQ(response.result, CURLE_OK);
+		EXPECT_EQ(response.body, "payload");
+	}
+
+	std::filesystem::remove(path);
+}
+
+TEST(CurlMultiExecutorTest, ReportsTransferErrors)
+{
+	const std::filesystem::path missing =
+		std::filesystem::temp_directory_path() / "CurlMultiExecutorTest_Missing.txt";
+	auto pool = std::make_shared<CurlHelper::CurlConnectionPool>();
+	std::promise<Response> promise;
+	std::future<Response> future = promise.get_future();
+	Async::Task<void> task;
+
+	CurlHelper::CurlMultiExecutor executor;
+	task = fetchInto(&executor, pool, toFileUrl(missing), promise);
+	task.start();
+
+	EXPECT_EQ(future.get().result, CURLE_FILE_COULDNT_READ_FILE);
+}
+
+TEST(CurlMultiExecutorTest, NullExecutorPerformsInline)
+{
+	const std::filesystem::path path = writeTempFile("CurlMultiExecutorTest_Inline.txt", "inline");
+	auto pool = std::make_shared<CurlHelper::CurlConnectionPool>();
+
+	std::promise<Response> promise;
+	std::future<Response> future = promise.get_future();
+	Async::Task<void> task = fetchInto(nullptr, pool, toFileUrl(path), promise);
+	task.start();
+
+	ASSERT_EQ(future.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+	const Response response = future.get();
+	EXPECT_EQ(response.result, CURLE_OK);
+	EXPECT_EQ(response.body, "inline");
+	EXPECT_EQ(response.resumedThreadId, std::this_thread::get_id());
+
+	std::filesystem::remove(path);
+}
@@ -0,0 +1,169 @@
+/*
+ * KaitoTokyo CurlHelper Library Tests
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include <KaitoTokyo/CurlHelper/CurlConnectionPool.hpp>
+#include <KaitoTokyo/CurlHelper/CurlSlistHandle.hpp>
+#include <KaitoTokyo/CurlHelper/CurlTransferAwaiter.hpp>
+#include <KaitoTokyo/CurlHelper/CurlTransferTape.hpp>
+#include <KaitoTokyo/CurlHelper/CurlWriteCallback.hpp>
+
+using namespace KaitoTokyo;
+
+namespace {
+
+std::filesystem::path writeTempFile(const std::string &name, const std::string &contents)
+{
+	const std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+	std::ofstream ofs(path, std::ios::binary);
+	ofs << contents;
+	return path;
+}
+
+std::string toFileUrl(const std::filesystem::path &path)
+{
+	return "file://" + path.generic_string();
+}
+
+std::string fetch(const std::shared_ptr<CurlHelper::CurlConnectionPool> &pool, const std::string &url,
+		  curl_slist *headers = nullptr)
+{
+	const CurlHelper::CurlConnectionPool::Lease curl = pool->checkout();
+	std::vector<char> readBuffer;
+	const CurlHelper::CurlTransfer transfer{
+		.url = url.c_str(),
+		.headers = headers,
+		.writeFunction = CurlHelper::CurlCharVectorWriteCallback,
+		.writeData = &readBuffer,
+	};
+	const CurlHelper::CurlTransferResult result = CurlHelper::performCurlTransfer(curl.getRaw(), transfer);
+	if (result.code != CURLE_OK) {
+		throw std::runtime_error(curl_easy_strerror(result.code));
+	}
+	return std::string(readBuffer.begin(), readBuffer.end());
+}
+
+} // anonymous namespace
+
+TEST(CurlTransferTapeTest, ReplaysRecordedTransfer)
+{
+	const std::filesystem::path body = writeTempFile("CurlTransferTapeTest_Body.json", R"({"items": []})");
+	const std::filesystem::path tapePath = std::filesystem::temp_directory_path() / "CurlTransferTapeTest.jsonl";
+	const std::string url = toFileUrl(body);
+	auto pool = std::make_shared<CurlHelper::CurlConnectionPool>();
+
+	CurlHelper::CurlSlistHandle headers;
+	headers.append("Authorization: Bearer secret-token");
+	pool->setTransferTape(
+		std::make_shared<CurlHelper::CurlTransferTape>(CurlHelper::CurlTransferTape::Mode::Record, tapePath));
+	EXPECT_EQ(fetch(pool, url, headers.getRaw()), R"({"items": []})");
+	pool->setTransferTape(nullptr);
+
+	std::ifstream ifs(tapePath);
+	const std::string line((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+	EXPECT_EQ(line.find("secret-token"), std::string::npos);
+	const nlohmann::json record = nlohmann::json::parse(line);
+	EXPECT_EQ(record["method"], "GET");
+	EXPECT_EQ(record["url"], url);
+	EXPECT_EQ(record["requestHeaders"][0], "Authorization: REDACTED");
+	EXPECT_TRUE(record.contains("durationMicroseconds"));
+
+	std::filesystem::remove(body);
+	pool->setTransferTape(std::make_shared<CurlHelper::CurlTransferTape>(CurlHelper::CurlTransferTape::Mode::Replay,
+									     tapePath, 0.0));
+	EXPECT_EQ(fetch(pool, url), R"({"items": []})");
+	EXPECT_EQ(pool->getStatistics().transfers, 1u);
+
+	std::filesystem::remove(tapePath);
+}
+
+TEST(CurlTransferTapeTest, CyclesThroughRecordingsOfTheSameRequest)
+{
+	const std::filesystem::path tapePath = writeTempFile(
+		"CurlTransferTapeTest_Cycle.jsonl",
+		R"({"method":"GET","url":"https://example.com/a?key=REDACTED","responseCode":200,"responseBody":"1"})"
+		"\n"
+		R"({"method":"GET","url":"https://example.com/a?key=REDACTED","responseCode":503,"responseBody":"2"})"
+		"\n");
+	auto pool = std::make_shared<CurlHelper::CurlConnectionPool>();
+	pool->setTransferTape(std::make_shared<CurlHelper::CurlTransferTape>(CurlHelper::CurlTransferTape::Mode::Replay,
+									     tapePath, 0.0));
+
+	const CurlHelper::CurlConnectionPool::Lease curl = pool->checkout();
+	std::vector<char> readBuffer;
+	const CurlHelper::CurlTransfer transfer{
+		.url = "https://example.com/a?key=live-key",
+		.writeFunction = CurlHelper::CurlCharVectorWriteCallback,
+		.writeData = &readBuffer,
+	};
+
+	std::vector<long> responseCodes;
+	for (int i = 0; i < 3; ++i) {
+		responseCodes.push_back(CurlHelper::performCurlTransfer(curl.getRaw(), transfer).responseCode);
+	}
+	EXPECT_EQ(responseCodes, (std::vector<long>{200, 503, 200}));
+	EXPECT_EQ(std::string(readBuffer.begin(), readBuffer.end()), "121");
+
+	const CurlHelper::CurlTransfer unknown{.url = "https://example.com/b"};
+	EXPECT_THROW(CurlHelper::performCurlTransfer(curl.getRaw(), unknown), std::runtime_error);
+
+	std::filesystem::remove(tapePath);
+}
+
+TEST(CurlTransferTapeTest, RedactsSecrets)
+{
+	using CurlHelper::CurlTransferTape;
+
+	EXPECT_EQ(CurlTransferTape::redactUrl("https://h/upload?part=snippet&upload_id=abc&key=k#f"),
+		  "https://h/upload?part=snippet&upload_id=REDACTED&key=REDACTED#f");
+	EXPECT_EQ(CurlTransferTape::redactUrl("https://h/list"), "https://h/list");
+
+	EXPECT_EQ(CurlTransferTape::redactHeader("authorization: Bearer x"), "authorization: REDACTED");
+	EXPECT_EQ(CurlTransferTape::redactHeader("Location: https://h/u?upload_id=abc"),
+		  "Location: https://h/u?upload_id=REDACTED");
+	EXPECT_EQ(CurlTransferTape::redactHeader("etag: \"abc\""), "etag: \"abc\"");
+
+	EXPECT_EQ(CurlTransferTape::redactBody("client_id=id&client_secret=s&refresh_token=r&grant_type=refresh_token"),
+		  "client_id=id&client_secret=REDACTED&refresh_token=REDACTED&grant_type=refresh_token");
+
+	const std::string unchanged = R"({"items": [{"id": "a"}]})";
+	EXPECT_EQ(CurlTransferTape::redactBody(unchanged), unchanged);
+
+	const nlohmann::json redacted = nlohmann::json::parse(CurlTransferTape::redactBody(
+		R"({"access_token": "t", "expires_in": 3599,
+		    "items": [{"cdn": {"ingestionInfo": {"streamName": "key", "ingestionAddress": "rtmp://a"}}}]})"));
+	EXPECT_EQ(redacted["access_token"], "REDACTED");
+	EXPECT_EQ(redacted["expires_in"], 3599);
+	EXPECT_EQ(redacted["items"][0]["cdn"]["ingestionInfo"]["streamName"], "REDACTED");
+	EXPECT_EQ(redacted["items"][0]["cdn"]["ingestionInfo"]["ingestionAddress"], "rtmp://a");
+}
@@ -0,0 +1,226 @@
+/*
+ * KaitoTokyo FrameConversion Library Tests
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <KaitoTokyo/FrameConversion/FrameScaler.hpp>
+
+using namespace KaitoTokyo::FrameConversion;
+
+namespace {
+
+struct Frame {
+	std::vector<std::uint8_t> pixels;
+	std::uint32_t width;
+	std::uint32_t height;
+	std::size_t linesize;
+
+	FrameView view(PixelOrder order = PixelOrder::BGRA) const
+	{
+		return FrameView{pixels.data(), width, height, linesize, order};
+	}
+};
+
+Frame makeSolidFrame(std::uint32_t width, std::uint32_t height, std::uint8_t b, std::uint8_t g, std::uint8_t r)
+{
+	Frame frame{std::vector<std::uint8_t>(4 * static_cast<std::size_t>(width) * height), width, height, 4 * width};
+	for (std::size_t i = 0; i < frame.pixels.size(); i += 4) {
+		frame.pixels[i] = b;
+		frame.pixels[i + 1] = g;
+		frame.pixels[i + 2] = r;
+		frame.pixels[i + 3] = 255;
+	}
+	return frame;
+}
+
+Frame makeRandomFrame(std::uint32_t width, std::uint32_t height, std::size_t padding = 0)
+{
+	std::mt19937 random(42);
+	std::uniform_int_distribution<int> byte(0, 255);
+	Frame frame{std::vector<std::uint8_t>((4 * static_cast<std::size_t>(width) + padding) * height), width, height,
+		    4 * static_cast<std::size_t>(width) + padding};
+	for (std::uint8_t &value : frame.pixels) {
+		value = static_cast<std::uint8_t>(byte(random));
+	}
+	return frame;
+}
+
+std::vector<std::uint8_t> scaleToRgb(FrameScaler &scaler, const FrameView &src, std::uint32_t width,
+				     std::uint32_t height)
+{
+	std::vector<std::uint8_t> rgb(3 * static_cast<std::size_t>(width) * height);
+	scaler.scaleToRgb(src, rgb.data(), width, height, 3 * static_cast<std::size_t>(width));
+	return rgb;
+}
+
+std::vector<CpuFeatureLevel> supportedLevels()
+{
+	std::vector<CpuFeatureLevel> levels;
+	for (CpuFeatureLevel level :
+	     {CpuFeatureLevel::Scalar, CpuFeatureLevel::SSE41, CpuFeatureLevel::AVX2, CpuFeatureLevel::NEON}) {
+		if (FrameScaler(level).getCpuFeatureLevel() == level) {
+			levels.push_back(level);
+		}
+	}
+	return levels;
+}
+
+} // anonymous namespace
+
+TEST(FrameScalerTest, KeepsSolidColor)
+{
+	const Frame frame = makeSolidFrame(1920, 1080, 30, 60, 90);
+	FrameScaler scaler;
+	const std::vector<std::uint8_t> rgb = scaleToRgb(scaler, frame.view(), 1280, 720);
+	for (std::size_t i = 0; i < rgb.size(); i += 3) {
+		ASSERT_EQ(rgb[i], 90);
+		ASSERT_EQ(rgb[i + 1], 60);
+		ASSERT_EQ(rgb[i + 2], 30);
+	}
+}
+
+TEST(FrameScalerTest, HalvingAveragesBlocks)
+{
+	// A checkerboard of single pixels averages to mid gray.
+	Frame frame = makeSolidFrame(8, 8, 0, 0, 0);
+	for (std::uint32_t y = 0; y < 8; ++y) {
+		for (std::uint32_t x = (y % 2); x < 8; x += 2) {
+			for (int c = 0; c < 3; ++c) {
+				frame.pixels[y * frame.linesize + 4 * x + c] = 200;
+			}
+		}
+	}
+
+	FrameScaler scaler(CpuFeatureLevel::Scalar);
+	const std::vector<std::uint8_t> rgb = scaleToRgb(scaler, frame.view(), 4, 4);
+	for (std::uint8_t value : rgb) {
+		EXPECT_EQ(value, 100);
+	}
+}
+
+TEST(FrameScalerTest, AllLevelsAgree)
+{
+	const Frame frame = makeRandomFrame(1000, 563, 12);
+	FrameScaler reference(CpuFeatureLevel::Scalar);
+
+	for (CpuFeatureLevel level : supportedLevels()) {
+		FrameScaler scaler(level);
+		for (const auto &[width, height] :
+		     {std::pair{333u, 187u}, std::pair{500u, 281u}, std::pair{997u, 560u}}) {
+			EXPECT_EQ(scaleToRgb(scaler, frame.view(), width, height),
+				  scaleToRgb(reference, frame.view(), width, height))
+				<< cpuFeatureLevelName(level) << " " << width << "x" << height;
+
+			const std::uint32_t chromaWidth = (width + 1) / 2;
+			const std::uint32_t chromaHeight = (height + 1) / 2;
+			const std::size_t lumaSize = static_cast<std::size_t>(width) * height;
+			const std::size_t chromaSize = static_cast<std::size_t>(chromaWidth) * chromaHeight;
+			const auto toI420 = [&](FrameScaler &s) {
+				std::vector<std::uint8_t> planes(lumaSize + 2 * chromaSize);
+				std::uint8_t *u = planes.data() + lumaSize;
+				const I420View i420{planes.data(), width, u, chromaWidth, u + chromaSize, chromaWidth};
+				s.scaleToI420(frame.view(), i420, width, height);
+				return planes;
+			};
+			EXPECT_EQ(toI420(scaler), toI420(reference)) << cpuFeatureLevelName(level) << " I420";
+		}
+	}
+}
+
+TEST(FrameScalerTest, SwapsChannelsByPixelOrder)
+{
+	const Frame frame = makeSolidFrame(64, 36, 10, 20, 30);
+	FrameScaler scaler;
+
+	const std::vector<std::uint8_t> fromBgra = scaleToRgb(scaler, frame.view(PixelOrder::BGRA), 32, 18);
+	EXPECT_EQ(fromBgra[0], 30);
+	EXPECT_EQ(fromBgra[2], 10);
+
+	const std::vector<std::uint8_t> fromRgba = scaleToRgb(scaler, frame.view(PixelOrder::RGBA), 32, 18);
+	EXPECT_EQ(fromRgba[0], 10);
+	EXPECT_EQ(fromRgba[2], 30);
+}
+
+TEST(FrameScalerTest, ConvertsToLimitedRangeI420)
+{
+	FrameScaler scaler;
+	for (const auto &[value, expectedLuma] : {std::pair<std::uint8_t, int>{0, 16}, {255, 235}}) {
+		const Frame frame = makeSolidFrame(40, 20, value, value, value);
+		std::vector<std::uint8_t> y(20 * 10), u(10 * 5), v(10 * 5);
+		scaler.scaleToI420(frame.view(), I420View{y.data(), 20, u.data(), 10, v.data(), 10}, 20, 10);
+		for (std::uint8_t sample : y) {
+			ASSERT_EQ(sample, expectedLuma);
+		}
+		for (std::size_t i = 0; i < u.size(); ++i) {
+			ASSERT_EQ(u[i], 128);
+			ASSERT_EQ(v[i], 128);
+		}
+	}
+}
+
+TEST(FrameScalerTest, HonorsLinesizes)
+{
+	const Frame padded = makeRandomFrame(321, 181, 60);
+	Frame packed{std::vector<std::uint8_t>(4 * 321 * 181), 321, 181, 4 * 321};
+	for (std::uint32_t y = 0; y < 181; ++y) {
+		std::copy_n(padded.pixels.begin() + static_cast<std::ptrdiff_t>(y * padded.linesize), 4 * 321,
+			    packed.pixels.begin() + static_cast<std::ptrdiff_t>(y * packed.linesize));
+	}
+
+	FrameScaler scaler;
+	const std::vector<std::uint8_t> expected = scaleToRgb(scaler, packed.view(), 100, 57);
+
+	constexpr std::size_t kRgbLinesize = 3 * 100 + 16;
+	std::vector<std::uint8_t> rgb(kRgbLinesize * 57);
+	scaler.scaleToRgb(padded.view(), rgb.data(), 100, 57, kRgbLinesize);
+	for (std::size_t y = 0; y < 57; ++y) {
+		EXPECT_TRUE(std::equal(expected.begin() + static_cast<std::ptrdiff_t>(300 * y),
+				       expected.begin() + static_cast<std::ptrdiff_t>(300 * (y + 1)),
+				       rgb.begin() + static_cast<std::ptrdiff_t>(kRgbLinesize * y)));
+	}
+}
+
+TEST(FrameScalerTest, RejectsEmptyFrames)
+{
+	FrameScaler scaler;
+	std::vector<std::uint8_t> rgb(3);
+	EXPECT_THROW(scaler.scaleToRgb(FrameView{}, rgb.data(), 1, 1, 3), std::invalid_argument);
+
+	const Frame frame = makeSolidFrame(4, 4, 0, 0, 0);
+	EXPECT_THROW(scaler.scaleToRgb(frame.view(), rgb.data(), 0, 1, 3), std::invalid_argument);
+}
+
+TEST(FrameScalerTest, FitWithinKeepsAspectRatio)
+{
+	EXPECT_EQ(fitWithin(3840, 2160, 1280, 720), (std::pair<std::uint32_t, std::uint32_t>{1280, 720}));
+	EXPECT_EQ(fitWithin(1080, 1920, 1280, 720), (std::pair<std::uint32_t, std::uint32_t>{405, 720}));
+	EXPECT_EQ(fitWithin(2560, 1080, 1280, 720), (std::pair<std::uint32_t, std::uint32_t>{1280, 540}));
+	EXPECT_EQ(fitWithin(640, 360, 1280, 720), (std::pair<std::uint32_t, std::uint32_t>{640, 360}));
+}
@@ -0,0 +1,179 @@
+/*
+ * KaitoTokyo GoogleAuth Library Tests
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <KaitoTokyo/GoogleAuth/GoogleTokenRefresher.hpp>
+
+using namespace KaitoTokyo;
+
+namespace {
+
+GoogleAuth::GoogleAuthResponse makeResponse(const std::string &accessToken)
+{
+	GoogleAuth::GoogleAuthResponse response;
+	response.access_token = accessToken;
+	response.expires_in = 3600;
+	return response;
+}
+
+// Spins until the refresher has seen the given number of joins.
+void waitForJoins(const GoogleAuth::GoogleTokenRefresher &refresher, std::uint64_t joins)
+{
+	while (refresher.getStats().joins < joins) {
+		std::this_thread::yield();
+	}
+}
+
+} // namespace
+
+TEST(GoogleTokenRefresherTest, RunsRefreshWhenNothingIsInFlight)
+{
+	GoogleAuth::GoogleTokenRefresher refresher;
+
+	const GoogleAuth::GoogleAuthResponse response =
+		refresher.refresh("refresh-token", []() { return makeResponse("access-1"); });
+
+	EXPECT_EQ(response.access_token, "access-1");
+	EXPECT_EQ(refresher.getStats().refreshes, 1u);
+	EXPECT_EQ(refresher.getStats().joins, 0u);
+}
+
+TEST(GoogleTokenRefresherTest, SequentialCallsRefreshEachTime)
+{
+	GoogleAuth::GoogleTokenRefresher refresher;
+	int calls = 0;
+
+	(void)refresher.refresh("refresh-token", [&]() { return makeResponse(std::to_string(++calls)); });
+	const GoogleAuth::GoogleAuthResponse second =
+		refresher.refresh("refresh-token", [&]() { return makeResponse(std::to_string(++calls)); });
+
+	EXPECT_EQ(calls, 2);
+	EXPECT_EQ(second.access_token, "2");
+}
+
+TEST(GoogleTokenRefresherTest, ConcurrentCallersShareOneRefresh)
+{
+	constexpr int kCallers = 8;
+	GoogleAuth::GoogleTokenRefresher refresher;
+	std::atomic<int> calls = 0;
+	std::atomic<bool> started = false;
+
+	std::vector<std::string> accessTokens(kCallers);
+	std::vector<std::thread> threads;
+	threads.emplace_back([&]() {
+		accessTokens[0] = refresher
+					  .refresh("refresh-token",
+						   [&]() {
+							   ++calls;
+							   started = true;
+							   waitForJoins(refresher, kCallers - 1);
+							   return makeResponse("shared");
+						   })
+					  .access_token;
+	});
+	while (!started) {
+		std::this_thread::yield();
+	}
+	for (int i = 1; i < kCallers; ++i) {
+		threads.emplace_back([&, i]() {
+			accessTokens[i] = refresher
+						  .refresh("refresh-token",
+							   [&]() {
+								   ++calls;
+								   return makeResponse("own");
+							   })
+						  .access_token;
+		});
+	}
+	for (std::thread &thread : threads) {
+		thread.join();
+	}
+
+	EXPECT_EQ(calls, 1);
+	for (const std::string &accessToken : accessTokens) {
+		EXPECT_EQ(accessToken, "shared");
+	}
+	EXPECT_EQ(refresher.getStats().refreshes, 1u);
+	EXPECT_EQ(refresher.getStats().joins, static_cast<std::uint64_t>(kCallers - 1));
+}
+
+TEST(GoogleTokenRefresherTest, JoinersSeeTheRefreshFailure)
+{
+	GoogleAuth::GoogleTokenRefresher refresher;
+	std::atomic<bool> started = false;
+
+	std::thread leader([&]() {
+		EXPECT_THROW((void)refresher.refresh("refresh-token",
+						     [&]() -> GoogleAuth::GoogleAuthResponse {
+							     started = true;
+							     waitForJoins(refresher, 1);
+							     throw std::runtime_error("TokenEndpointError");
+						     }),
+			     std::runtime_error);
+	});
+	while (!started) {
+		std::this_thread::yield();
+	}
+	EXPECT_THROW((void)refresher.refresh("refresh-token", []() { return makeResponse("own"); }),
+		     std::runtime_error);
+	leader.join();
+
+	// The failed refresh is no longer in flight, so the next caller tries again.
+	EXPECT_EQ(refresher.refresh("refresh-token", []() { return makeResponse("retry"); }).access_token, "retry");
+}
+
+TEST(GoogleTokenRefresherTest, DifferentRefreshTokensDoNotShare)
+{
+	GoogleAuth::GoogleTokenRefresher refresher;
+	std::atomic<bool> started = false;
+	std::atomic<bool> release = false;
+
+	std::thread first([&]() {
+		(void)refresher.refresh("refresh-token-a", [&]() {
+			started = true;
+			while (!release) {
+				std::this_thread::yield();
+			}
+			return makeResponse("a");
+		});
+	});
+	while (!started) {
+		std::this_thread::yield();
+	}
+
+	const GoogleAuth::GoogleAuthResponse response =
+		refresher.refresh("refresh-token-b", []() { return makeResponse("b"); });
+	release = true;
+	first.join();
+
+	EXPECT_EQ(response.access_token, "b");
+	EXPECT_EQ(refresher.getStats().refreshes, 2u);
+	EXPECT_EQ(refresher.getStats().joins, 0u);
+}
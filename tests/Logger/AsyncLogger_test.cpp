@@ -0,0 +1,198 @@
+/*
+ * KaitoTokyo Async Library Tests
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <KaitoTokyo/Logger/AsyncLogger.hpp>
+
+using namespace KaitoTokyo;
+
+namespace {
+
+struct Line {
+	Logger::LogLevel level;
+	std::string name;
+	std::vector<std::pair<std::string, std::string>> context;
+};
+
+class RecordingLogger : public Logger::ILogger {
+public:
+	void log(Logger::LogLevel level, std::string_view name, std::source_location,
+		 std::span<const Logger::LogField> bound,
+		 std::span<const Logger::LogField> context) const noexcept override
+	{
+		std::scoped_lock lock(mutex_);
+		Line line{level, std::string(name), {}};
+		for (const Logger::LogField &field : bound) {
+			line.context.emplace_back(std::string(field.key), std::string(field.value));
+		}
+		for (const Logger::LogField &field : context) {
+			line.context.emplace_back(std::string(field.key), std::string(field.value));
+		}
+		lines_.push_back(std::move(line));
+	}
+
+	void logBatch(std::span<const Logger::LogRecord> records) const noexcept override
+	{
+		batches_.fetch_add(1);
+		if (blocked_) {
+			blocked_->wait(true);
+		}
+		ILogger::logBatch(records);
+	}
+
+	std::vector<Line> lines() const
+	{
+		std::scoped_lock lock(mutex_);
+		return lines_;
+	}
+
+	mutable std::atomic<int> batches_ = 0;
+	std::atomic<bool> *blocked_ = nullptr;
+
+private:
+	mutable std::mutex mutex_;
+	mutable std::vector<Line> lines_;
+};
+
+} // namespace
+
+TEST(AsyncLoggerTest, DeliversRecordsInOrderWithFields)
+{
+	auto sink = std::make_shared<RecordingLogger>();
+	{
+		Logger::AsyncLogger logger(sink);
+		logger.info("First", {{"key", "value"}});
+		logger.warn("Second");
+		logger.flush();
+
+		const std::vector<Line> lines = sink->lines();
+		ASSERT_EQ(lines.size(), 2u);
+		EXPECT_EQ(lines[0].level, Logger::LogLevel::Info);
+		EXPECT_EQ(lines[0].name, "First");
+		ASSERT_EQ(lines[0].context.size(), 1u);
+		EXPECT_EQ(lines[0].context[0].first, "key");
+		EXPECT_EQ(lines[0].context[0].second, "value");
+		EXPECT_EQ(lines[1].name, "Second");
+		EXPECT_EQ(logger.getStats().written, 2u);
+	}
+}
+
+TEST(AsyncLoggerTest, DestructorWritesQueuedRecords)
+{
+	auto sink = std::make_shared<RecordingLogger>();
+	{
+		Logger::AsyncLogger logger(sink);
+		for (int i = 0; i < 100; ++i) {
+			logger.debug("Line");
+		}
+	}
+	EXPECT_EQ(sink->lines().size(), 100u);
+}
+
+TEST(AsyncLoggerTest, DropsLowLevelRecordsWhenFullAndReportsThem)
+{
+	auto sink = std::make_shared<RecordingLogger>();
+	std::atomic<bool> blocked = true;
+	sink->blocked_ = &blocked;
+	{
+		Logger::AsyncLogger logger(sink, {.capacity = 4, .maxBatchSize = 1});
+		// The writer blocks in the sink on the first record, which keeps its slot; three more fill the ring.
+		logger.info("Held");
+		while (sink->batches_.load() == 0) {
+			std::this_thread::yield();
+		}
+		for (int i = 0; i < 3; ++i) {
+			logger.info("Queued");
+		}
+		logger.info("Dropped");
+		logger.debug("Dropped");
+		logger.error("Synchronous");
+
+		const Logger::AsyncLoggerStats stats = logger.getStats();
+		EXPECT_EQ(stats.dropped[static_cast<std::size_t>(Logger::LogLevel::Info)], 1u);
+		EXPECT_EQ(stats.dropped[static_cast<std::size_t>(Logger::LogLevel::Debug)], 1u);
+		EXPECT_EQ(stats.writtenSynchronously, 1u);
+
+		blocked = false;
+		blocked.notify_all();
+		logger.flush();
+	}
+
+	const std::vector<Line> lines = sink->lines();
+	ASSERT_EQ(lines.size(), 6u);
+	EXPECT_EQ(lines[0].name, "Synchronous");
+	EXPECT_EQ(lines[1].name, "Held");
+	EXPECT_EQ(lines.back().name, "LogRecordsDropped");
+	ASSERT_EQ(lines.back().context.size(), 1u);
+	EXPECT_EQ(lines.back().context[0].second, "2");
+}
+
+TEST(AsyncLoggerTest, TruncatesOversizedRecords)
+{
+	auto sink = std::make_shared<RecordingLogger>();
+	const std::string large(Logger::AsyncLogger::kSlotTextBytes * 2, 'x');
+	{
+		Logger::AsyncLogger logger(sink);
+		logger.info("Large", {{"payload", large}});
+		logger.flush();
+		EXPECT_EQ(logger.getStats().truncated, 1u);
+	}
+
+	const std::vector<Line> lines = sink->lines();
+	ASSERT_EQ(lines.size(), 1u);
+	ASSERT_EQ(lines[0].context.size(), 1u);
+	EXPECT_EQ(lines[0].name.size() + lines[0].context[0].first.size() + lines[0].context[0].second.size(),
+		  Logger::AsyncLogger::kSlotTextBytes);
+}
+
+TEST(AsyncLoggerTest, ConcurrentProducersLoseNothingWhileRingHasRoom)
+{
+	auto sink = std::make_shared<RecordingLogger>();
+	constexpr int kThreads = 4;
+	constexpr int kPerThread = 200;
+	{
+		Logger::AsyncLogger logger(sink, {.capacity = kThreads * kPerThread});
+		std::vector<std::thread> threads;
+		for (int t = 0; t < kThreads; ++t) {
+			threads.emplace_back([&logger]() {
+				for (int i = 0; i < kPerThread; ++i) {
+					logger.info("Line");
+				}
+			});
+		}
+		for (std::thread &thread : threads) {
+			thread.join();
+		}
+		logger.flush();
+		EXPECT_EQ(logger.getStats().written, static_cast<std::uint64_t>(kThreads * kPerThread));
+	}
+	EXPECT_EQ(sink->lines().size(), static_cast<std::size_t>(kThreads * kPerThread));
+}
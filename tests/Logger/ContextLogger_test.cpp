@@ -0,0 +1,132 @@
+/*
+ * KaitoTokyo Async Library Tests
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <KaitoTokyo/Logger/ContextLogger.hpp>
+#include <KaitoTokyo/Logger/MultiLogger.hpp>
+
+using namespace KaitoTokyo;
+
+namespace {
+
+class RecordingLogger : public Logger::ILogger {
+public:
+	void log(Logger::LogLevel, std::string_view name, std::source_location, std::span<const Logger::LogField> bound,
+		 std::span<const Logger::LogField> context) const noexcept override
+	{
+		lastName_ = name;
+		lastFields_.clear();
+		for (std::span<const Logger::LogField> fields : {bound, context}) {
+			for (const Logger::LogField &field : fields) {
+				lastFields_.emplace_back(std::string(field.key), std::string(field.value));
+			}
+		}
+	}
+
+	mutable std::string lastName_;
+	mutable std::vector<std::pair<std::string, std::string>> lastFields_;
+};
+
+class SpanCapturingLogger : public Logger::ILogger {
+public:
+	void log(Logger::LogLevel, std::string_view, std::source_location, std::span<const Logger::LogField> bound,
+		 std::span<const Logger::LogField>) const noexcept override
+	{
+		lastBound_ = bound;
+	}
+
+	mutable std::span<const Logger::LogField> lastBound_;
+};
+
+} // namespace
+
+TEST(ContextLoggerTest, PrependsBoundFields)
+{
+	auto sink = std::make_shared<RecordingLogger>();
+	const auto logger = Logger::ContextLogger::create(sink, {{"taskName", "Task"}, {"sessionId", "42"}});
+
+	logger->info("Line", {{"key", "value"}});
+
+	EXPECT_EQ(sink->lastName_, "Line");
+	const std::vector<std::pair<std::string, std::string>> expected{
+		{"taskName", "Task"}, {"sessionId", "42"}, {"key", "value"}};
+	EXPECT_EQ(sink->lastFields_, expected);
+}
+
+TEST(ContextLoggerTest, NestedLoggersFlattenIntoOne)
+{
+	auto sink = std::make_shared<RecordingLogger>();
+	std::shared_ptr<const Logger::ContextLogger> segmentLogger;
+	{
+		const auto taskLogger = Logger::ContextLogger::create(sink, {{"taskName", "Task"}});
+		segmentLogger = Logger::ContextLogger::create(taskLogger, {{"segmentId", "7"}});
+	}
+
+	// The task logger is gone; the segment logger holds copies of its fields.
+	segmentLogger->warn("Line");
+
+	const std::vector<std::pair<std::string, std::string>> expected{{"taskName", "Task"}, {"segmentId", "7"}};
+	EXPECT_EQ(sink->lastFields_, expected);
+}
+
+TEST(ContextLoggerTest, MergesFieldsBoundAcrossAnotherWrapper)
+{
+	auto sink = std::make_shared<RecordingLogger>();
+	const auto inner = Logger::ContextLogger::create(sink, {{"taskName", "Task"}});
+	auto multi = std::make_shared<Logger::MultiLogger>(std::vector<std::shared_ptr<const Logger::ILogger>>{inner});
+	const auto outer = Logger::ContextLogger::create(multi, {{"segmentId", "7"}});
+
+	outer->info("Line", {{"key", "value"}});
+
+	const std::vector<std::pair<std::string, std::string>> expected{
+		{"taskName", "Task"}, {"segmentId", "7"}, {"key", "value"}};
+	EXPECT_EQ(sink->lastFields_, expected);
+}
+
+TEST(ContextLoggerTest, ForwardsItsOwnStorageWithoutCopying)
+{
+	auto sink = std::make_shared<SpanCapturingLogger>();
+	const auto taskLogger = Logger::ContextLogger::create(sink, {{"taskName", "Task"}});
+	const auto logger = Logger::ContextLogger::create(taskLogger, {{"sessionId", "42"}, {"segmentId", "7"}});
+
+	logger->info("Line", {{"key", "value"}});
+
+	EXPECT_EQ(sink->lastBound_.data(), logger->getBoundFields().data());
+	EXPECT_EQ(sink->lastBound_.size(), 3u);
+}
+
+TEST(ContextLoggerTest, RejectsOversizedContext)
+{
+	auto sink = std::make_shared<RecordingLogger>();
+	const std::string large(Logger::ContextLogger::kBoundTextBytes, 'x');
+
+	EXPECT_THROW(Logger::ContextLogger::create(sink, {{"key", large}}), std::invalid_argument);
+	EXPECT_THROW(Logger::ContextLogger::create(nullptr, {}), std::invalid_argument);
+}
@@ -0,0 +1,126 @@
+/*
+ * KaitoTokyo Async Library Tests
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <KaitoTokyo/Logger/ContextLogger.hpp>
+#include <KaitoTokyo/Logger/ILogger.hpp>
+#include <KaitoTokyo/Logger/MultiLogger.hpp>
+
+using namespace KaitoTokyo;
+
+namespace {
+
+class RecordingLogger : public Logger::ILogger {
+public:
+	void log(Logger::LogLevel, std::string_view name, std::source_location, std::span<const Logger::LogField>,
+		 std::span<const Logger::LogField> context) const noexcept override
+	{
+		names_.emplace_back(name);
+		lastContext_.clear();
+		for (const Logger::LogField &field : context) {
+			lastContext_.push_back(std::string(field.key) + "=" + std::string(field.value));
+		}
+	}
+
+	mutable std::vector<std::string> names_;
+	mutable std::vector<std::string> lastContext_;
+};
+
+} // namespace
+
+TEST(ILoggerTest, MinLevelDiscardsLowerLevels)
+{
+	RecordingLogger logger;
+	logger.setMinLevel(Logger::LogLevel::Warn);
+
+	logger.debug("Debug");
+	logger.info("Info");
+	logger.warn("Warn");
+	logger.error("Error");
+
+	EXPECT_EQ(logger.names_, (std::vector<std::string>{"Warn", "Error"}));
+	EXPECT_FALSE(logger.isEnabled(Logger::LogLevel::Info));
+	EXPECT_TRUE(logger.isEnabled(Logger::LogLevel::Warn));
+}
+
+TEST(ILoggerTest, LazyFieldsAreBuiltOnlyWhenEnabled)
+{
+	RecordingLogger logger;
+	logger.setMinLevel(Logger::LogLevel::Info);
+	int evaluations = 0;
+	auto makeFields = [&] {
+		++evaluations;
+		return std::to_array<Logger::OwnedLogField>({{"count", std::to_string(42)}});
+	};
+
+	logger.debug("Skipped", makeFields);
+	EXPECT_EQ(evaluations, 0);
+
+	logger.info("Written", makeFields);
+	EXPECT_EQ(evaluations, 1);
+	EXPECT_EQ(logger.names_, std::vector<std::string>{"Written"});
+	EXPECT_EQ(logger.lastContext_, std::vector<std::string>{"count=42"});
+}
+
+TEST(ILoggerTest, LazyFieldsThatThrowStillWriteTheRecord)
+{
+	RecordingLogger logger;
+
+	logger.warn("Failed", []() -> std::array<Logger::OwnedLogField, 1> { throw std::runtime_error("boom"); });
+
+	EXPECT_EQ(logger.names_, std::vector<std::string>{"Failed"});
+	EXPECT_EQ(logger.lastContext_, std::vector<std::string>{"logFieldsError=EvaluationFailed"});
+}
+
+TEST(ILoggerTest, MultiLoggerFiltersPerSink)
+{
+	auto verbose = std::make_shared<RecordingLogger>();
+	auto quiet = std::make_shared<RecordingLogger>();
+	quiet->setMinLevel(Logger::LogLevel::Error);
+	Logger::MultiLogger logger({verbose, quiet});
+
+	logger.info("Info");
+	logger.error("Error");
+
+	EXPECT_EQ(logger.getMinLevel(), Logger::LogLevel::Debug);
+	EXPECT_EQ(verbose->names_, (std::vector<std::string>{"Info", "Error"}));
+	EXPECT_EQ(quiet->names_, std::vector<std::string>{"Error"});
+}
+
+TEST(ILoggerTest, WrappersTakeOverTheDownstreamMinLevel)
+{
+	auto sink = std::make_shared<RecordingLogger>();
+	sink->setMinLevel(Logger::LogLevel::Info);
+	const auto logger = Logger::ContextLogger::create(sink, {{"taskName", "Task"}});
+
+	EXPECT_EQ(logger->getMinLevel(), Logger::LogLevel::Info);
+	logger->debug("Debug");
+	EXPECT_TRUE(sink->names_.empty());
+}
@@ -0,0 +1,155 @@
+/*
+ * KaitoTokyo Async Library Tests
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <KaitoTokyo/Logger/JsonLinesFileLogger.hpp>
+
+using namespace KaitoTokyo;
+
+namespace {
+
+class JsonLinesFileLoggerTest : public ::testing::Test {
+protected:
+	void SetUp() override
+	{
+		const ::testing::TestInfo *info = ::testing::UnitTest::GetInstance()->current_test_info();
+		directory_ = std::filesystem::temp_directory_path() /
+			     (std::string("JsonLinesFileLoggerTest_") + info->name());
+		std::filesystem::remove_all(directory_);
+	}
+
+	void TearDown() override { std::filesystem::remove_all(directory_); }
+
+	std::vector<std::filesystem::path> files() const
+	{
+		std::vector<std::filesystem::path> result;
+		for (const auto &entry : std::filesystem::directory_iterator(directory_)) {
+			result.push_back(entry.path());
+		}
+		std::sort(result.begin(), result.end());
+		return result;
+	}
+
+	static std::vector<std::string> readLines(const std::filesystem::path &path)
+	{
+		std::ifstream in(path);
+		std::vector<std::string> lines;
+		for (std::string line; std::getline(in, line);) {
+			lines.push_back(line);
+		}
+		return lines;
+	}
+
+	std::filesystem::path directory_;
+};
+
+} // namespace
+
+TEST_F(JsonLinesFileLoggerTest, WritesOneEscapedJsonObjectPerRecord)
+{
+	{
+		Logger::JsonLinesFileLogger logger({.directory = directory_});
+		const Logger::LogField bound[] = {{"taskName", "Task"}};
+		const Logger::LogField context[] = {{"message", "say \"hi\"\n\\"}};
+		logger.log(Logger::LogLevel::Warn, "Name", std::source_location::current(), bound, context);
+	}
+
+	const std::vector<std::filesystem::path> written = files();
+	ASSERT_EQ(written.size(), 1u);
+	EXPECT_TRUE(written[0].filename().string().starts_with("session_"));
+	EXPECT_EQ(written[0].extension(), ".jsonl");
+
+	const std::vector<std::string> lines = readLines(written[0]);
+	ASSERT_EQ(lines.size(), 1u);
+	EXPECT_NE(lines[0].find("\"level\":\"warn\",\"name\":\"Name\",\"file\":\"JsonLinesFileLogger_test.cpp\""),
+		  std::string::npos);
+	EXPECT_NE(lines[0].find("\"fields\":{\"taskName\":\"Task\",\"message\":\"say \\\"hi\\\"\\n\\\\\"}}"),
+		  std::string::npos);
+}
+
+TEST_F(JsonLinesFileLoggerTest, FlushesWithoutWaitingForShutdown)
+{
+	Logger::JsonLinesFileLogger logger({.directory = directory_, .flushInterval = std::chrono::milliseconds{10}});
+	logger.info("Line");
+
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+	while (logger.getStats().bytesWritten == 0 && std::chrono::steady_clock::now() < deadline) {
+		std::this_thread::sleep_for(std::chrono::milliseconds{5});
+	}
+	EXPECT_EQ(readLines(logger.getCurrentPath()).size(), 1u);
+}
+
+TEST_F(JsonLinesFileLoggerTest, RotatesBySizeAndKeepsNewestFiles)
+{
+	{
+		Logger::JsonLinesFileLogger logger({.directory = directory_,
+						    .maxFileBytes = 1,
+						    .maxFiles = 3,
+						    .flushInterval = std::chrono::milliseconds{1}});
+		// One record per write, so that each write after the first starts a new file.
+		std::uint64_t bytesWritten = 0;
+		for (int i = 0; i < 6; ++i) {
+			logger.info("Line", {{"index", std::to_string(i)}});
+			const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+			while (logger.getStats().bytesWritten == bytesWritten &&
+			       std::chrono::steady_clock::now() < deadline) {
+				std::this_thread::sleep_for(std::chrono::milliseconds{1});
+			}
+			bytesWritten = logger.getStats().bytesWritten;
+		}
+		EXPECT_EQ(logger.getStats().rotations, 5u);
+	}
+
+	const std::vector<std::filesystem::path> written = files();
+	ASSERT_EQ(written.size(), 3u);
+	EXPECT_NE(readLines(written.back())[0].find("\"index\":\"5\""), std::string::npos);
+}
+
+TEST_F(JsonLinesFileLoggerTest, DropsRecordsBeyondTheBufferLimit)
+{
+	Logger::JsonLinesFileLogger logger({.directory = directory_,
+					    .bufferBytes = 1024 * 1024,
+					    .maxBufferedBytes = 1,
+					    .flushInterval = std::chrono::hours{1}});
+	logger.info("Kept");
+	logger.info("Dropped");
+
+	EXPECT_EQ(logger.getStats().records, 1u);
+	EXPECT_EQ(logger.getStats().dropped, 1u);
+}
+
+TEST_F(JsonLinesFileLoggerTest, RejectsMissingDirectory)
+{
+	EXPECT_THROW(Logger::JsonLinesFileLogger({}), std::invalid_argument);
+}
@@ -0,0 +1,135 @@
+/*
+ * KaitoTokyo Metrics Library Tests
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <KaitoTokyo/Metrics/MetricsRegistry.hpp>
+
+using namespace KaitoTokyo;
+
+TEST(MetricsRegistryTest, RendersCountersAndGauges)
+{
+	Metrics::MetricsRegistry registry;
+	registry.counter("requests_total", "Requests sent.", {{"method", "list"}}).inc(3);
+	registry.counter("requests_total", "Requests sent.", {{"method", "insert"}}).inc();
+	registry.gauge("quota_units", "Units used.").set(1.5);
+
+	EXPECT_EQ(registry.render(), "# HELP quota_units Units used.\n"
+				     "# TYPE quota_units gauge\n"
+				     "quota_units 1.5\n"
+				     "# HELP requests_total Requests sent.\n"
+				     "# TYPE requests_total counter\n"
+				     "requests_total{method=\"insert\"} 1\n"
+				     "requests_total{method=\"list\"} 3\n");
+}
+
+TEST(MetricsRegistryTest, ReturnsTheSameMetricForTheSameLabels)
+{
+	Metrics::MetricsRegistry registry;
+	Metrics::Counter &first = registry.counter("calls_total", "Calls.", {{"name", "a"}});
+	Metrics::Counter &second = registry.counter("calls_total", "Calls.", {{"name", "a"}});
+	Metrics::Counter &other = registry.counter("calls_total", "Calls.", {{"name", "b"}});
+
+	EXPECT_EQ(&first, &second);
+	EXPECT_NE(&first, &other);
+}
+
+TEST(MetricsRegistryTest, RendersCumulativeHistogramBuckets)
+{
+	Metrics::MetricsRegistry registry;
+	const double bounds[] = {0.1, 1.0};
+	Metrics::Histogram &histogram = registry.histogram("duration_seconds", "Durations.", bounds, {{"run", "cut"}});
+	histogram.observe(0.05);
+	histogram.observe(0.1);
+	histogram.observe(std::chrono::milliseconds(500));
+	histogram.observe(2.0);
+
+	EXPECT_EQ(registry.render(), "# HELP duration_seconds Durations.\n"
+				     "# TYPE duration_seconds histogram\n"
+				     "duration_seconds_bucket{run=\"cut\",le=\"0.1\"} 2\n"
+				     "duration_seconds_bucket{run=\"cut\",le=\"1\"} 3\n"
+				     "duration_seconds_bucket{run=\"cut\",le=\"+Inf\"} 4\n"
+				     "duration_seconds_sum{run=\"cut\"} 2.65\n"
+				     "duration_seconds_count{run=\"cut\"} 4\n");
+}
+
+TEST(MetricsRegistryTest, EscapesHelpAndLabelValues)
+{
+	Metrics::MetricsRegistry registry;
+	registry.counter("errors_total", "Line\\one\nline two", {{"message", "say \"hi\"\n"}}).inc();
+
+	EXPECT_EQ(registry.render(), "# HELP errors_total Line\\\\one\\nline two\n"
+				     "# TYPE errors_total counter\n"
+				     "errors_total{message=\"say \\\"hi\\\"\\n\"} 1\n");
+}
+
+TEST(MetricsRegistryTest, RejectsInvalidRegistrations)
+{
+	Metrics::MetricsRegistry registry;
+	const double bounds[] = {1.0, 2.0};
+	const double otherBounds[] = {1.0};
+	const double unsortedBounds[] = {2.0, 1.0};
+	registry.counter("events_total", "Events.");
+	registry.histogram("latency_seconds", "Latency.", bounds);
+
+	EXPECT_THROW(registry.counter("1events", "Events."), std::invalid_argument);
+	EXPECT_THROW(registry.counter("ok_total", "Ok.", {{"bad-label", "x"}}), std::invalid_argument);
+	EXPECT_THROW(registry.gauge("events_total", "Events."), std::invalid_argument);
+	EXPECT_THROW(registry.histogram("latency_seconds", "Latency.", otherBounds), std::invalid_argument);
+	EXPECT_THROW(registry.histogram("other_seconds", "Other.", unsortedBounds), std::invalid_argument);
+	EXPECT_THROW(registry.histogram("le_seconds", "Le.", bounds, {{"le", "1"}}), std::invalid_argument);
+}
+
+TEST(MetricsRegistryTest, CountsConcurrentUpdates)
+{
+	Metrics::MetricsRegistry registry;
+	Metrics::Counter &counter = registry.counter("hits_total", "Hits.");
+	Metrics::Gauge &gauge = registry.gauge("level", "Level.");
+	Metrics::Histogram &histogram = registry.histogram("value", "Values.", Metrics::kDefaultDurationBuckets);
+
+	std::vector<std::thread> threads;
+	for (int t = 0; t < 4; t++) {
+		threads.emplace_back([&]() {
+			for (int i = 0; i < 10000; i++) {
+				counter.inc();
+				gauge.add(1.0);
+				histogram.observe(0.5);
+			}
+		});
+	}
+	for (std::thread &thread : threads) {
+		thread.join();
+	}
+
+	EXPECT_EQ(counter.getValue(), 40000u);
+	EXPECT_EQ(gauge.getValue(), 40000.0);
+	const Metrics::HistogramSnapshot snapshot = histogram.snapshot();
+	EXPECT_EQ(snapshot.count, 40000u);
+	EXPECT_EQ(snapshot.sum, 20000.0);
+}
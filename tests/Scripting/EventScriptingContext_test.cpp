@@ -23,14 +23,27 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <optional>
 #include <random>
+#include <stdexcept>
+#include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+#include <sqlite3.h>
 
 #include <KaitoTokyo/Logger/PrintLogger.hpp>
 
 #include <EventScriptingContext.hpp>
+#include <ScriptingLocalStorage.hpp>
 
 using namespace KaitoTokyo;
 using namespace KaitoTokyo::LiveStreamSegmenter;
@@ -98,10 +111,12 @@ protected:
 		context->setupContext();
 	}
 
-	void useDatabase(const std::string &filename = "test.sqlite3")
+	void useDatabase(const std::string &filename = "test.sqlite3",
+			 const Scripting::ScriptingDatabaseOptions &options = {})
 	{
 		tempFile = std::make_unique<TemporaryFile>(filename);
-		db = std::make_unique<Scripting::ScriptingDatabase>(runtime, ctx, logger, tempFile->path, true);
+		db = std::make_unique<Scripting::ScriptingDatabase>(runtime, ctx, logger, tempFile->path, true,
+								    options);
 		db->setupContext();
 	}
 
@@ -110,7 +125,7 @@ protected:
 		if (!db) {
 			useDatabase("test_localstorage.sqlite3");
 		}
-		context->setupLocalStorage();
+		context->setupLocalStorage(*db);
 	}
 
 	Scripting::ScopedJSValue eval(const char *script)
@@ -156,6 +171,17 @@ TEST_F(EventScriptingContextTest, Dayjs)
 	ASSERT_EQ(value.asString(), "2025-01-01");
 }
 
+TEST_F(EventScriptingContextTest, BuiltinModulesLoadOnImport)
+{
+	auto value = eval(R"(
+		import { LiveBroadcastBuilder } from "builtin:youtube";
+		import { dayjs } from "builtin:dayjs";
+		export default typeof LiveBroadcastBuilder + ":" + typeof dayjs;
+	)");
+	ASSERT_TRUE(value.asString().has_value());
+	ASSERT_EQ(value.asString(), "function:function");
+}
+
 TEST_F(EventScriptingContextTest, DbToString)
 {
 	useDatabase();
@@ -230,6 +256,119 @@ TEST_F(EventScriptingContextTest, DbTransaction)
 	ASSERT_EQ(extractedValue.value(), "[{\"c\":2}]");
 }
 
+TEST_F(EventScriptingContextTest, DbExecuteMany)
+{
+	useDatabase();
+	auto value = eval(R"(
+		db.execute("CREATE TABLE segments (idx INTEGER, title TEXT);");
+		const rows = [];
+		for (let i = 0; i < 1000; i++) rows.push([i, "Segment " + i]);
+		const res = db.executeMany("INSERT INTO segments VALUES (?, ?);", rows);
+		const count = db.query("SELECT count(*) AS c, max(title) AS m FROM segments;")[0];
+		export default JSON.stringify([res.changes, count.c, count.m]);
+	)");
+
+	ASSERT_TRUE(value.asString().has_value());
+	ASSERT_EQ(value.asString(), R"([1000,1000,"Segment 999"])");
+}
+
+TEST_F(EventScriptingContextTest, DbExecuteManyRollsBackOnError)
+{
+	useDatabase();
+	auto value = eval(R"(
+		db.execute("CREATE TABLE uniq (v INTEGER UNIQUE);");
+		let message = "";
+		try {
+			db.executeMany("INSERT INTO uniq VALUES (?);", [[1], [2], [2]]);
+		} catch (e) {
+			message = String(e.message).includes("row 2") ? "row 2" : String(e.message);
+		}
+		const count = db.query("SELECT count(*) AS c FROM uniq;")[0].c;
+		export default JSON.stringify([message, count]);
+	)");
+
+	ASSERT_TRUE(value.asString().has_value());
+	ASSERT_EQ(value.asString(), R"(["row 2",0])");
+}
+
+TEST_F(EventScriptingContextTest, DbTransactionCommitsAndRollsBack)
+{
+	useDatabase();
+	auto value = eval(R"(
+		db.execute("CREATE TABLE log (v INTEGER);");
+		const returned = db.transaction(() => {
+			db.execute("INSERT INTO log VALUES (1);");
+			db.executeMany("INSERT INTO log VALUES (?);", [[2], [3]]);
+			return "committed";
+		});
+		try {
+			db.transaction(() => {
+				db.execute("INSERT INTO log VALUES (4);");
+				throw new Error("abort");
+			});
+		} catch (e) {}
+		const count = db.query("SELECT count(*) AS c FROM log;")[0].c;
+		export default JSON.stringify([returned, count]);
+	)");
+
+	ASSERT_TRUE(value.asString().has_value());
+	ASSERT_EQ(value.asString(), R"(["committed",3])");
+}
+
+TEST_F(EventScriptingContextTest, DbBlobRoundTrip)
+{
+	useDatabase();
+	auto value = eval(R"(
+		db.execute("CREATE TABLE blobs (b BLOB);");
+		db.execute("INSERT INTO blobs VALUES (?);", new Uint8Array([0, 1, 254, 255]).buffer);
+		const b = db.query("SELECT b FROM blobs;")[0].b;
+		export default JSON.stringify([b instanceof ArrayBuffer, Array.from(new Uint8Array(b))]);
+	)");
+
+	ASSERT_TRUE(value.asString().has_value());
+	ASSERT_EQ(value.asString(), R"([true,[0,1,254,255]])");
+}
+
+TEST_F(EventScriptingContextTest, DbIterate)
+{
+	useDatabase();
+	auto value = eval(R"(
+		db.execute("CREATE TABLE history (idx INTEGER, title TEXT);");
+		db.executeMany("INSERT INTO history VALUES (?, ?);", [[1, "a"], [2, "b"], [3, "c"]]);
+
+		const all = [];
+		for (const row of db.iterate("SELECT idx, title FROM history WHERE idx >= ? ORDER BY idx;", 2)) {
+			all.push(row.title);
+		}
+
+		// Leaving the loop early releases the statement, so the table can be dropped afterwards.
+		for (const row of db.iterate("SELECT idx FROM history;")) {
+			break;
+		}
+		db.execute("DROP TABLE history;");
+
+		export default JSON.stringify(all);
+	)");
+
+	ASSERT_TRUE(value.asString().has_value());
+	ASSERT_EQ(value.asString(), R"(["b","c"])");
+}
+
+TEST_F(EventScriptingContextTest, DbIterateNextAfterDone)
+{
+	useDatabase();
+	auto value = eval(R"(
+		const cursor = db.iterate("SELECT 1 AS one;");
+		const first = cursor.next();
+		const second = cursor.next();
+		const third = cursor.next();
+		export default JSON.stringify([first.value.one, first.done, second.done, third.done]);
+	)");
+
+	ASSERT_TRUE(value.asString().has_value());
+	ASSERT_EQ(value.asString(), R"([1,false,true,true])");
+}
+
 // -----------------------------------------------------------------------------
 // LocalStorage Tests
 // -----------------------------------------------------------------------------
@@ -331,6 +470,105 @@ TEST_F(EventScriptingContextTest, LocalStorage_TypeCoercion)
 	ASSERT_EQ(value.asString(), R"({"isString":true,"content":"456"})");
 }
 
+TEST_F(EventScriptingContextTest, LocalStorage_FlushedWhenFunctionReturns)
+{
+	useLocalStorage();
+	context->loadEventHandler(R"(
+		export function count() {
+			for (let i = 0; i < 100; i++) {
+				const counter = Number(localStorage.getItem("counter") ?? 0);
+				localStorage.setItem("counter", String(counter + 1));
+			}
+			localStorage.setItem("removed", "x");
+			localStorage.removeItem("removed");
+			return localStorage.getItem("counter");
+		}
+	)");
+
+	ASSERT_EQ(context->executeFunction("count", nlohmann::json::object()), "100");
+
+	// Read back through a separate connection, so nothing comes from the in-memory copy.
+	sqlite3 *raw = nullptr;
+	ASSERT_EQ(sqlite3_open_v2(tempFile->path.string().c_str(), &raw, SQLITE_OPEN_READONLY, nullptr), SQLITE_OK);
+	std::unique_ptr<sqlite3, decltype(&sqlite3_close_v2)> conn(raw, sqlite3_close_v2);
+
+	sqlite3_stmt *stmt = nullptr;
+	ASSERT_EQ(sqlite3_prepare_v2(conn.get(), "SELECT key, value FROM __sys_local_storage;", -1, &stmt, nullptr),
+		  SQLITE_OK);
+	std::vector<std::pair<std::string, std::string>> rows;
+	while (sqlite3_step(stmt) == SQLITE_ROW) {
+		rows.emplace_back(reinterpret_cast<const char *>(sqlite3_column_text(stmt, 0)),
+				  reinterpret_cast<const char *>(sqlite3_column_text(stmt, 1)));
+	}
+	sqlite3_finalize(stmt);
+
+	const std::vector<std::pair<std::string, std::string>> expected{{"counter", "100"}};
+	ASSERT_EQ(rows, expected);
+}
+
+TEST_F(EventScriptingContextTest, LocalStorage_RevalidatedAfterExternalWrite)
+{
+	useDatabase("test_localstorage_revalidate.sqlite3");
+	Scripting::ScriptingLocalStorage::writeDatabaseFile(
+		tempFile->path, {{"removed", "x"}, {"kept", "old"}, {"untouched", "script"}});
+	useLocalStorage();
+
+	context->loadEventHandler(R"(
+		localStorage.getItem("kept");
+		export function stash() {
+			localStorage.setItem("pending", "session");
+			return "stashed";
+		}
+		export function dump() {
+			const items = {};
+			for (let i = 0; i < localStorage.length; i++) {
+				const key = localStorage.key(i);
+				items[key] = localStorage.getItem(key);
+			}
+			return JSON.stringify(items);
+		}
+	)");
+
+	// Another connection holds the write lock, so the flush after stash() fails and "pending" stays in
+	// memory only.
+	sqlite3 *raw = nullptr;
+	ASSERT_EQ(sqlite3_open_v2(tempFile->path.string().c_str(), &raw, SQLITE_OPEN_READWRITE, nullptr), SQLITE_OK);
+	std::unique_ptr<sqlite3, decltype(&sqlite3_close_v2)> locker(raw, sqlite3_close_v2);
+	ASSERT_EQ(sqlite3_exec(locker.get(), "BEGIN IMMEDIATE;", nullptr, nullptr, nullptr), SQLITE_OK);
+	ASSERT_EQ(context->executeFunction("stash", nlohmann::json::object()), "stashed");
+	ASSERT_EQ(sqlite3_exec(locker.get(), "ROLLBACK;", nullptr, nullptr, nullptr), SQLITE_OK);
+	locker.reset();
+
+	// As the settings dialog saves: only the changed keys, on a connection of its own.
+	Scripting::ScriptingLocalStorage::writeDatabaseFile(
+		tempFile->path, {{"removed", std::nullopt}, {"kept", "dialog"}, {"pending", "dialog"}});
+	db->revalidateLocalStorage();
+
+	ASSERT_EQ(context->executeFunction("dump", nlohmann::json::object()),
+		  R"({"kept":"dialog","pending":"session","untouched":"script"})");
+
+	const std::map<std::string, std::string> expected{
+		{"kept", "dialog"}, {"pending", "session"}, {"untouched", "script"}};
+	ASSERT_EQ(Scripting::ScriptingLocalStorage::readDatabaseFile(tempFile->path), expected);
+}
+
+TEST_F(EventScriptingContextTest, LocalStorage_IllegalConstructor)
+{
+	useLocalStorage();
+	auto value = eval(R"(
+		let threw = false;
+		try {
+			new Storage();
+		} catch (e) {
+			threw = e instanceof TypeError;
+		}
+		export default JSON.stringify({ threw, isStorage: localStorage instanceof Storage });
+	)");
+
+	ASSERT_TRUE(value.asString().has_value());
+	ASSERT_EQ(value.asString(), R"({"threw":true,"isStorage":true})");
+}
+
 TEST(EventScriptingContextTest_NoFixture, LocalStorage_Persistence)
 {
 	std::shared_ptr<Logger::ILogger> logger = std::make_shared<Logger::PrintLogger>();
@@ -345,7 +583,7 @@ TEST(EventScriptingContextTest_NoFixture, LocalStorage_Persistence)
 
 		context_out->setupContext();
 		db_out->setupContext();
-		context_out->setupLocalStorage();
+		context_out->setupLocalStorage(*db_out);
 	};
 
 	// First session: Write
@@ -370,3 +608,226 @@ TEST(EventScriptingContextTest_NoFixture, LocalStorage_Persistence)
 		ASSERT_EQ(value.asString(), "persistentValue");
 	}
 }
+
+namespace {
+
+// Loads the script in a fresh runtime, as a new session would, and returns its default export.
+std::optional<std::string> loadDefault(const char *script, const std::filesystem::path &cachePath,
+				       std::shared_ptr<Logger::ILogger> logger)
+{
+	auto runtime = std::make_shared<Scripting::ScriptingRuntime>();
+	runtime->setLogger(logger);
+	std::shared_ptr<JSContext> ctx = runtime->createContextRaw();
+	Scripting::EventScriptingContext context(runtime, ctx, logger);
+	context.setupContext();
+	context.loadEventHandler(script, cachePath);
+	return context.getModuleProperty("default").asString();
+}
+
+} // anonymous namespace
+
+TEST(EventScriptingContextTest_NoFixture, BytecodeCache_ReusedForSameSource)
+{
+	std::shared_ptr<Logger::ILogger> logger = std::make_shared<Logger::PrintLogger>();
+	TemporaryFile cacheFile("event_handler_bytecode.bin");
+
+	const char *script = R"(
+		import { dayjs } from "builtin:dayjs";
+		export default dayjs("2025-01-01").format("YYYY-MM-DD");
+	)";
+
+	ASSERT_EQ(loadDefault(script, cacheFile.path, logger), "2025-01-01");
+	ASSERT_TRUE(std::filesystem::is_regular_file(cacheFile.path));
+	const auto cachedTime = std::filesystem::last_write_time(cacheFile.path);
+
+	// A hit leaves the cache untouched.
+	ASSERT_EQ(loadDefault(script, cacheFile.path, logger), "2025-01-01");
+	ASSERT_EQ(std::filesystem::last_write_time(cacheFile.path), cachedTime);
+
+	// Different source falls back to compiling and rewrites the cache.
+	ASSERT_EQ(loadDefault(R"(export default "changed";)", cacheFile.path, logger), "changed");
+	ASSERT_EQ(loadDefault(R"(export default "changed";)", cacheFile.path, logger), "changed");
+}
+
+TEST(EventScriptingContextTest_NoFixture, BytecodeCache_CorruptedFileFallsBackToSource)
+{
+	std::shared_ptr<Logger::ILogger> logger = std::make_shared<Logger::PrintLogger>();
+	TemporaryFile cacheFile("event_handler_bytecode.bin");
+
+	const char *script = R"(export default "cached";)";
+	ASSERT_EQ(loadDefault(script, cacheFile.path, logger), "cached");
+
+	// Flip the last byte of the bytecode.
+	{
+		std::fstream fs(cacheFile.path, std::ios::in | std::ios::out | std::ios::binary);
+		fs.seekg(-1, std::ios::end);
+		const char last = static_cast<char>(fs.get());
+		fs.seekp(-1, std::ios::end);
+		fs.put(static_cast<char>(last ^ 0x5a));
+	}
+	ASSERT_EQ(loadDefault(script, cacheFile.path, logger), "cached");
+
+	std::filesystem::resize_file(cacheFile.path, 4);
+	ASSERT_EQ(loadDefault(script, cacheFile.path, logger), "cached");
+}
+
+TEST_F(EventScriptingContextTest, ExecuteFunctionJson_RoundTrip)
+{
+	context->loadEventHandler(R"(
+		export function echo(event) {
+			return { ...event, received: true };
+		}
+	)");
+
+	const nlohmann::json event{
+		{"LiveBroadcast", {{"id", "abc"}, {"snippet", {{"title", "Tést"}, {"tags", {"a", "b"}}}}}},
+		{"count", 3},
+		{"ratio", 0.5},
+		{"nothing", nullptr},
+		{"__proto__", "own"},
+	};
+
+	nlohmann::json expected = event;
+	expected["received"] = true;
+	ASSERT_EQ(context->executeFunction("echo", event), expected);
+}
+
+TEST_F(EventScriptingContextTest, ExecuteFunctionJson_MatchesStringify)
+{
+	context->loadEventHandler(R"(
+		export function shapes() {
+			return {
+				date: new Date(Date.UTC(2025, 0, 1)),
+				integral: 2.0,
+				nan: NaN,
+				skipped: undefined,
+				fn() {},
+				list: [1, undefined, () => 0, "x"],
+			};
+		}
+	)");
+
+	const nlohmann::json result = context->executeFunction("shapes", nlohmann::json::object());
+	ASSERT_EQ(result, nlohmann::json::parse(context->executeFunction("shapes", "{}")));
+	ASSERT_EQ(result["date"], "2025-01-01T00:00:00.000Z");
+	ASSERT_TRUE(result["integral"].is_number_integer());
+	ASSERT_TRUE(result["nan"].is_null());
+	ASSERT_FALSE(result.contains("skipped"));
+	ASSERT_FALSE(result.contains("fn"));
+	ASSERT_EQ(result["list"], nlohmann::json::parse(R"([1, null, null, "x"])"));
+}
+
+TEST_F(EventScriptingContextTest, ExecuteFunctionJson_AwaitsPromise)
+{
+	context->loadEventHandler(R"(
+		export async function later(event) {
+			return { doubled: event.value * 2 };
+		}
+	)");
+
+	const nlohmann::json expected{{"doubled", 42}};
+	ASSERT_EQ(context->executeFunction("later", nlohmann::json{{"value", 21}}), expected);
+}
+
+TEST_F(EventScriptingContextTest, ExecuteFunctionJson_RejectsCycles)
+{
+	context->loadEventHandler(R"(
+		export function cyclic() {
+			const obj = {};
+			obj.self = obj;
+			return obj;
+		}
+	)");
+
+	ASSERT_THROW(context->executeFunction("cyclic", nlohmann::json::object()), std::runtime_error);
+}
+
+TEST_F(EventScriptingContextTest, DbOptions_AppliesPragmas)
+{
+	useDatabase("test_options.sqlite3",
+		    {.journalMode = "WAL", .synchronous = "NORMAL", .cacheSize = -2048, .mmapSize = 0});
+	auto value = eval(R"(
+		const mode = db.query("PRAGMA journal_mode;")[0].journal_mode;
+		const sync = db.query("PRAGMA synchronous;")[0].synchronous;
+		const cache = db.query("PRAGMA cache_size;")[0].cache_size;
+		export default JSON.stringify([mode, sync, cache]);
+	)");
+
+	ASSERT_TRUE(value.asString().has_value());
+	ASSERT_EQ(value.asString(), R"(["wal",1,-2048])");
+}
+
+TEST_F(EventScriptingContextTest, DbOptions_RejectsUnknownModes)
+{
+	Scripting::ScriptingDatabaseOptions badJournalMode;
+	badJournalMode.journalMode = "WAL; DROP TABLE x";
+	ASSERT_THROW(useDatabase("test_options_invalid.sqlite3", badJournalMode), std::invalid_argument);
+
+	Scripting::ScriptingDatabaseOptions badSynchronous;
+	badSynchronous.synchronous = "SOMETIMES";
+	ASSERT_THROW(useDatabase("test_options_invalid.sqlite3", badSynchronous), std::invalid_argument);
+}
+
+TEST_F(EventScriptingContextTest, ExecutionBudget_InterruptsRunawayLoop)
+{
+	Scripting::ScriptingLimits limits;
+	limits.executionBudget = std::chrono::milliseconds(50);
+	runtime->setLimits(limits);
+
+	context->loadEventHandler(R"(
+		export function spin() { for (;;) {} }
+		export function ok() { return 1; }
+	)");
+
+	ASSERT_THROW(context->executeFunction("spin", "{}"), std::runtime_error);
+	ASSERT_EQ(context->executeFunction("ok", "{}"), "1");
+	ASSERT_EQ(context->getEventHandlerProfiles().at("spin").budgetExceededCount, 1u);
+}
+
+TEST_F(EventScriptingContextTest, ExecutionBudget_InterruptsRunawayPromiseChain)
+{
+	Scripting::ScriptingLimits limits;
+	limits.executionBudget = std::chrono::milliseconds(50);
+	runtime->setLimits(limits);
+
+	context->loadEventHandler(R"(
+		export async function spin() { for (;;) await null; }
+		export async function ok() { return 2; }
+	)");
+
+	ASSERT_THROW(context->executeFunction("spin", "{}"), std::runtime_error);
+	ASSERT_EQ(context->executeFunction("ok", "{}"), "2");
+}
+
+TEST_F(EventScriptingContextTest, MemoryLimit_FailsTheCallInsteadOfGrowing)
+{
+	Scripting::ScriptingLimits limits;
+	limits.memoryLimit = 32 * 1024 * 1024;
+	runtime->setLimits(limits);
+
+	context->loadEventHandler(R"(
+		export function grow() { const a = []; for (;;) a.push("x".repeat(1024) + a.length); }
+		export function ok() { return 3; }
+	)");
+
+	ASSERT_THROW(context->executeFunction("grow", "{}"), std::runtime_error);
+	ASSERT_EQ(context->executeFunction("ok", "{}"), "3");
+}
+
+TEST_F(EventScriptingContextTest, EventHandlerProfiles_CountCallsPerFunction)
+{
+	context->loadEventHandler(R"(
+		export function a() { return 1; }
+		export async function b() { return 2; }
+	)");
+
+	context->executeFunction("a", "{}");
+	context->executeFunction("a", "{}");
+	context->executeFunction("b", "{}");
+
+	const auto &profiles = context->getEventHandlerProfiles();
+	ASSERT_EQ(profiles.at("a").callCount, 2u);
+	ASSERT_EQ(profiles.at("b").callCount, 1u);
+	ASSERT_EQ(profiles.at("a").budgetExceededCount, 0u);
+	ASSERT_GE(profiles.at("a").totalElapsed, profiles.at("a").maxElapsed);
+}
@@ -0,0 +1,141 @@
+/*
+ * Live Stream Segmenter - Scripting Module Tests
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include <KaitoTokyo/Async/Task.hpp>
+#include <KaitoTokyo/Logger/PrintLogger.hpp>
+
+#include <EventScriptingContext.hpp>
+#include <ScriptingExecutor.hpp>
+
+using namespace KaitoTokyo;
+using namespace KaitoTokyo::LiveStreamSegmenter;
+
+namespace {
+
+Async::Task<void> resumeInto(Scripting::ScriptingExecutor *executor, std::promise<std::thread::id> &promise)
+{
+	co_await Scripting::ScriptingExecutor::ScheduleAwaiter(executor);
+	promise.set_value(std::this_thread::get_id());
+}
+
+Async::Task<void> runInto(Scripting::ScriptingExecutor *executor, std::promise<int> &promise)
+{
+	promise.set_value(co_await Scripting::ScriptingExecutor::run(executor, []() { return 42; }));
+}
+
+} // anonymous namespace
+
+TEST(ScriptingExecutorTest, ScheduleResumesOnExecutorThread)
+{
+	Scripting::ScriptingExecutor executor;
+	std::promise<std::thread::id> promise;
+	std::future<std::thread::id> future = promise.get_future();
+
+	Async::Task<void> task = resumeInto(&executor, promise);
+	task.start();
+
+	const std::thread::id resumedThreadId = future.get();
+	EXPECT_NE(resumedThreadId, std::this_thread::get_id());
+	auto getThreadId = []() { return std::this_thread::get_id(); };
+	EXPECT_EQ(Scripting::ScriptingExecutor::runBlocking(&executor, getThreadId), resumedThreadId);
+}
+
+TEST(ScriptingExecutorTest, NullExecutorContinuesInline)
+{
+	std::promise<std::thread::id> promise;
+	std::future<std::thread::id> future = promise.get_future();
+
+	Async::Task<void> task = resumeInto(nullptr, promise);
+	task.start();
+
+	ASSERT_EQ(future.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+	EXPECT_EQ(future.get(), std::this_thread::get_id());
+	EXPECT_EQ(Scripting::ScriptingExecutor::runBlocking(nullptr, []() { return 7; }), 7);
+}
+
+TEST(ScriptingExecutorTest, RunYieldsResult)
+{
+	Scripting::ScriptingExecutor executor;
+	std::promise<int> promise;
+	std::future<int> future = promise.get_future();
+
+	Async::Task<void> task = runInto(&executor, promise);
+	task.start();
+
+	EXPECT_EQ(future.get(), 42);
+}
+
+TEST(ScriptingExecutorTest, RunBlockingRethrows)
+{
+	Scripting::ScriptingExecutor executor;
+
+	auto fail = []() -> int { throw std::runtime_error("RunBlockingRethrows"); };
+	EXPECT_THROW(Scripting::ScriptingExecutor::runBlocking(&executor, fail), std::runtime_error);
+}
+
+TEST(ScriptingExecutorTest, SerializesEventHandlersFromManyThreads)
+{
+	constexpr int kThreadCount = 8;
+
+	auto logger = std::make_shared<Logger::PrintLogger>();
+	auto runtime = std::make_shared<Scripting::ScriptingRuntime>();
+	runtime->setLogger(logger);
+	runtime->setExecutor(std::make_shared<Scripting::ScriptingExecutor>());
+
+	auto context = Scripting::ScriptingExecutor::runBlocking(runtime->getExecutor(), [&]() {
+		auto ctx = runtime->createContextRaw();
+		auto created = std::make_unique<Scripting::EventScriptingContext>(runtime, ctx, logger);
+		created->setupContext();
+		created->loadEventHandler(R"(
+			export async function twice(event) {
+				await null;
+				return event.value * 2;
+			}
+		)");
+		return created;
+	});
+
+	std::vector<std::future<nlohmann::json>> results;
+	for (int i = 0; i < kThreadCount; ++i) {
+		results.push_back(std::async(std::launch::async, [&context, i]() {
+			return context->executeFunction("twice", nlohmann::json{{"value", i}});
+		}));
+	}
+
+	for (int i = 0; i < kThreadCount; ++i) {
+		EXPECT_EQ(results[i].get(), i * 2);
+	}
+
+	Scripting::ScriptingExecutor::runBlocking(runtime->getExecutor(), [&]() { context.reset(); });
+}
@@ -0,0 +1,207 @@
+/*
+ * Live Stream Segmenter - Scripting Module Tests
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <string>
+
+#include <nlohmann/json.hpp>
+
+#include <KaitoTokyo/Async/Task.hpp>
+#include <KaitoTokyo/CurlHelper/CurlConnectionPool.hpp>
+#include <KaitoTokyo/CurlHelper/CurlMultiExecutor.hpp>
+#include <KaitoTokyo/Logger/PrintLogger.hpp>
+
+#include <EventScriptingContext.hpp>
+#include <ScriptingFetch.hpp>
+
+using namespace KaitoTokyo;
+using namespace KaitoTokyo::LiveStreamSegmenter;
+
+namespace {
+
+std::filesystem::path writeTempFile(const std::string &name, const std::string &contents)
+{
+	const std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+	std::ofstream ofs(path, std::ios::binary);
+	ofs << contents;
+	return path;
+}
+
+std::string toFileUrl(const std::filesystem::path &path)
+{
+	return "file://" + path.generic_string();
+}
+
+Async::Task<void> executeInto(Scripting::EventScriptingContext *context, std::string functionName,
+			      nlohmann::json eventObject, std::promise<nlohmann::json> &promise)
+{
+	try {
+		nlohmann::json result =
+			co_await context->executeFunctionTask(std::move(functionName), std::move(eventObject));
+		promise.set_value(std::move(result));
+	} catch (...) {
+		promise.set_exception(std::current_exception());
+	}
+}
+
+} // anonymous namespace
+
+class ScriptingFetchTest : public ::testing::Test {
+protected:
+	std::shared_ptr<Logger::ILogger> logger;
+	std::shared_ptr<Scripting::ScriptingRuntime> runtime;
+	std::shared_ptr<JSContext> ctx;
+	std::shared_ptr<CurlHelper::CurlConnectionPool> curlPool;
+	std::shared_ptr<CurlHelper::CurlMultiExecutor> curlExecutor;
+	std::unique_ptr<Scripting::EventScriptingContext> context;
+	std::unique_ptr<Scripting::ScriptingFetch> fetch;
+
+	void SetUp() override
+	{
+		logger = std::make_shared<Logger::PrintLogger>();
+		runtime = std::make_shared<Scripting::ScriptingRuntime>();
+		runtime->setLogger(logger);
+		ctx = runtime->createContextRaw();
+		curlPool = std::make_shared<CurlHelper::CurlConnectionPool>();
+		context = std::make_unique<Scripting::EventScriptingContext>(runtime, ctx, logger);
+		context->setupContext();
+	}
+
+	void TearDown() override
+	{
+		fetch.reset();
+		context.reset();
+	}
+
+	void useFetch(std::shared_ptr<CurlHelper::CurlMultiExecutor> executor)
+	{
+		curlExecutor = std::move(executor);
+		fetch = std::make_unique<Scripting::ScriptingFetch>(runtime, ctx, logger, context->getHostJobQueue(),
+								    curlPool, curlExecutor);
+		fetch->setupContext();
+	}
+};
+
+TEST_F(ScriptingFetchTest, ResolvesWithResponseOnExecutor)
+{
+	const std::filesystem::path path = writeTempFile("ScriptingFetchTest_Executor.txt", "hello");
+	useFetch(std::make_shared<CurlHelper::CurlMultiExecutor>());
+
+	context->loadEventHandler(R"(
+		export async function get(event) {
+			const response = await fetch(event.url);
+			return { ok: response.ok, body: response.body };
+		}
+	)");
+
+	const nlohmann::json result = context->executeFunction("get", nlohmann::json{{"url", toFileUrl(path)}});
+	EXPECT_EQ(result.at("ok"), true);
+	EXPECT_EQ(result.at("body"), "hello");
+
+	std::filesystem::remove(path);
+}
+
+TEST_F(ScriptingFetchTest, RunsConcurrentFetches)
+{
+	const std::filesystem::path first = writeTempFile("ScriptingFetchTest_First.txt", "first");
+	const std::filesystem::path second = writeTempFile("ScriptingFetchTest_Second.txt", "second");
+	useFetch(std::make_shared<CurlHelper::CurlMultiExecutor>());
+
+	context->loadEventHandler(R"(
+		export async function both(event) {
+			const responses = await Promise.all(event.urls.map((url) => fetch(url)));
+			return responses.map((response) => response.body);
+		}
+	)");
+
+	const nlohmann::json result = context->executeFunction(
+		"both", nlohmann::json{{"urls", {toFileUrl(first), toFileUrl(second)}}});
+	EXPECT_EQ(result, nlohmann::json({"first", "second"}));
+
+	std::filesystem::remove(first);
+	std::filesystem::remove(second);
+}
+
+TEST_F(ScriptingFetchTest, NullExecutorFetchesInline)
+{
+	const std::filesystem::path path = writeTempFile("ScriptingFetchTest_Inline.txt", "inline");
+	useFetch(nullptr);
+
+	context->loadEventHandler(R"(
+		export async function get(event) {
+			return (await fetch(event.url)).body;
+		}
+	)");
+
+	EXPECT_EQ(context->executeFunction("get", nlohmann::json{{"url", toFileUrl(path)}}), "inline");
+
+	std::filesystem::remove(path);
+}
+
+TEST_F(ScriptingFetchTest, RejectsOnTransferError)
+{
+	const std::filesystem::path missing = std::filesystem::temp_directory_path() / "ScriptingFetchTest_Missing.txt";
+	useFetch(std::make_shared<CurlHelper::CurlMultiExecutor>());
+
+	context->loadEventHandler(R"(
+		export async function get(event) {
+			try {
+				await fetch(event.url);
+				return "resolved";
+			} catch (e) {
+				return e instanceof TypeError ? "TypeError" : String(e);
+			}
+		}
+	)");
+
+	EXPECT_EQ(context->executeFunction("get", nlohmann::json{{"url", toFileUrl(missing)}}), "TypeError");
+}
+
+TEST_F(ScriptingFetchTest, TaskSuspendsWhileFetching)
+{
+	const std::filesystem::path path = writeTempFile("ScriptingFetchTest_Task.txt", "task");
+	useFetch(std::make_shared<CurlHelper::CurlMultiExecutor>());
+
+	context->loadEventHandler(R"(
+		export async function get(event) {
+			const response = await fetch(event.url);
+			return response.body + ":" + response.status;
+		}
+	)");
+
+	std::promise<nlohmann::json> promise;
+	std::future<nlohmann::json> future = promise.get_future();
+	Async::Task<void> task = executeInto(context.get(), "get", nlohmann::json{{"url", toFileUrl(path)}}, promise);
+	task.start();
+
+	EXPECT_EQ(future.get(), "task:0");
+	EXPECT_EQ(context->getEventHandlerProfiles().at("get").callCount, 1u);
+
+	std::filesystem::remove(path);
+}
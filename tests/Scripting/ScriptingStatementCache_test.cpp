@@ -0,0 +1,139 @@
+/*
+ * Live Stream Segmenter - Scripting Module Tests
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <utility>
+
+#include <sqlite3.h>
+
+#include <ScriptingStatementCache.hpp>
+
+using namespace KaitoTokyo::LiveStreamSegmenter;
+
+namespace {
+
+struct Database {
+	std::unique_ptr<sqlite3, decltype(&sqlite3_close_v2)> db{nullptr, sqlite3_close_v2};
+
+	Database()
+	{
+		sqlite3 *raw = nullptr;
+		sqlite3_open_v2(":memory:", &raw, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, nullptr);
+		db.reset(raw);
+		sqlite3_exec(raw, "CREATE TABLE items (id INTEGER PRIMARY KEY, name TEXT);", nullptr, nullptr, nullptr);
+	}
+};
+
+int stepInsert(Scripting::ScriptingStatementCache &cache, const char *name)
+{
+	Scripting::ScriptingStatementCache::Lease stmt = cache.acquire("INSERT INTO items (name) VALUES (?);");
+	sqlite3_bind_text(stmt.get(), 1, name, -1, SQLITE_TRANSIENT);
+	return sqlite3_step(stmt.get());
+}
+
+} // anonymous namespace
+
+TEST(ScriptingStatementCacheTest, ReusesStatementsForSameSql)
+{
+	Database database;
+	Scripting::ScriptingStatementCache cache(database.db.get());
+
+	ASSERT_EQ(stepInsert(cache, "a"), SQLITE_DONE);
+	ASSERT_EQ(stepInsert(cache, "b"), SQLITE_DONE);
+	ASSERT_EQ(stepInsert(cache, "c"), SQLITE_DONE);
+
+	EXPECT_EQ(cache.getStats().misses, 1u);
+	EXPECT_EQ(cache.getStats().hits, 2u);
+	EXPECT_EQ(cache.size(), 1u);
+
+	Scripting::ScriptingStatementCache::Lease count = cache.acquire("SELECT count(*) FROM items;");
+	ASSERT_EQ(sqlite3_step(count.get()), SQLITE_ROW);
+	EXPECT_EQ(sqlite3_column_int(count.get(), 0), 3);
+}
+
+TEST(ScriptingStatementCacheTest, ClearsBindingsOnRelease)
+{
+	Database database;
+	Scripting::ScriptingStatementCache cache(database.db.get());
+
+	ASSERT_EQ(stepInsert(cache, "bound"), SQLITE_DONE);
+	{
+		Scripting::ScriptingStatementCache::Lease stmt = cache.acquire("INSERT INTO items (name) VALUES (?);");
+		ASSERT_EQ(sqlite3_step(stmt.get()), SQLITE_DONE);
+	}
+
+	Scripting::ScriptingStatementCache::Lease stmt =
+		cache.acquire("SELECT count(*) FROM items WHERE name IS NULL;");
+	ASSERT_EQ(sqlite3_step(stmt.get()), SQLITE_ROW);
+	EXPECT_EQ(sqlite3_column_int(stmt.get(), 0), 1);
+}
+
+TEST(ScriptingStatementCacheTest, EvictsLeastRecentlyUsed)
+{
+	Database database;
+	Scripting::ScriptingStatementCache cache(database.db.get(), 2);
+
+	(void)cache.acquire("SELECT 1;");
+	(void)cache.acquire("SELECT 2;");
+	(void)cache.acquire("SELECT 1;");
+	(void)cache.acquire("SELECT 3;");
+
+	EXPECT_EQ(cache.size(), 2u);
+	EXPECT_EQ(cache.getStats().evictions, 1u);
+
+	(void)cache.acquire("SELECT 1;");
+	EXPECT_EQ(cache.getStats().hits, 2u);
+	(void)cache.acquire("SELECT 2;");
+	EXPECT_EQ(cache.getStats().misses, 4u);
+}
+
+TEST(ScriptingStatementCacheTest, LeasesSameSqlTwice)
+{
+	Database database;
+	Scripting::ScriptingStatementCache cache(database.db.get());
+
+	{
+		Scripting::ScriptingStatementCache::Lease outer = cache.acquire("SELECT 1;");
+		Scripting::ScriptingStatementCache::Lease inner = cache.acquire("SELECT 1;");
+		ASSERT_NE(outer.get(), inner.get());
+		ASSERT_EQ(sqlite3_step(outer.get()), SQLITE_ROW);
+		ASSERT_EQ(sqlite3_step(inner.get()), SQLITE_ROW);
+	}
+
+	EXPECT_EQ(cache.size(), 1u);
+}
+
+TEST(ScriptingStatementCacheTest, ReturnsEmptyLeaseOnPrepareError)
+{
+	Database database;
+	Scripting::ScriptingStatementCache cache(database.db.get());
+
+	Scripting::ScriptingStatementCache::Lease stmt = cache.acquire("SELEKT nothing;");
+	EXPECT_FALSE(stmt);
+	EXPECT_EQ(cache.size(), 0u);
+
+	Scripting::ScriptingStatementCache::Lease blank = cache.acquire("  -- only a comment");
+	EXPECT_FALSE(blank);
+}
@@ -0,0 +1,161 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * Live Stream Segmenter - Store Module Tests
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+
+#include <sqlite3.h>
+
+#include <KaitoTokyo/Async/ThreadPoolExecutor.hpp>
+#include <KaitoTokyo/Logger/PrintLogger.hpp>
+
+#include <ProfileStore.hpp>
+
+using namespace KaitoTokyo;
+using namespace KaitoTokyo::LiveStreamSegmenter;
+
+namespace {
+
+constexpr Store::ProfileStoreKey<int> kCounterKey{"counter"};
+constexpr Store::ProfileStoreKey<std::string> kNameKey{"name"};
+
+using unique_sqlite3_t = std::unique_ptr<sqlite3, decltype(&sqlite3_close_v2)>;
+
+unique_sqlite3_t openConnection(const std::filesystem::path &path)
+{
+	sqlite3 *raw = nullptr;
+	sqlite3_open_v2(path.string().c_str(), &raw, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, nullptr);
+	return unique_sqlite3_t(raw, sqlite3_close_v2);
+}
+
+// Reads the rows through a separate connection, so nothing comes from the store's in-memory copy.
+std::map<std::string, std::string> readRows(const std::filesystem::path &path)
+{
+	unique_sqlite3_t conn = openConnection(path);
+	sqlite3_stmt *stmt = nullptr;
+	std::map<std::string, std::string> rows;
+	if (sqlite3_prepare_v2(conn.get(), "SELECT key, value FROM profile_store;", -1, &stmt, nullptr) != SQLITE_OK) {
+		return rows;
+	}
+	while (sqlite3_step(stmt) == SQLITE_ROW) {
+		rows.emplace(reinterpret_cast<const char *>(sqlite3_column_text(stmt, 0)),
+			     reinterpret_cast<const char *>(sqlite3_column_text(stmt, 1)));
+	}
+	sqlite3_finalize(stmt);
+	return rows;
+}
+
+template<typename Predicate> bool waitFor(Predicate predicate)
+{
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+	while (std::chrono::steady_clock::now() < deadline) {
+		if (predicate()) {
+			return true;
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+	return predicate();
+}
+
+class ProfileStoreTest : public ::testing::Test {
+protected:
+	std::filesystem::path tempDir;
+	std::filesystem::path databasePath;
+	std::shared_ptr<const Logger::ILogger> logger = std::make_shared<Logger::PrintLogger>();
+	std::shared_ptr<Async::ThreadPoolExecutor> ioExecutor = std::make_shared<Async::ThreadPoolExecutor>(
+		Async::ThreadPoolExecutorOptions{.name = "io", .threadCount = 1});
+
+	void SetUp() override
+	{
+		std::random_device rd;
+		tempDir = std::filesystem::temp_directory_path() /
+			  ("live-stream-segmenter-profile-store-test-" + std::to_string(rd()));
+		std::filesystem::create_directories(tempDir);
+		databasePath = tempDir / "profile.sqlite3";
+	}
+
+	void TearDown() override
+	{
+		std::error_code ec;
+		std::filesystem::remove_all(tempDir, ec);
+	}
+
+	std::unique_ptr<Store::ProfileStore> makeStore(std::chrono::milliseconds flushDelay)
+	{
+		auto store = std::make_unique<Store::ProfileStore>(databasePath, ioExecutor, logger, flushDelay);
+		store->restore();
+		return store;
+	}
+};
+
+} // anonymous namespace
+
+TEST_F(ProfileStoreTest, DebouncesABurstOfSets)
+{
+	auto store = makeStore(std::chrono::milliseconds(200));
+
+	for (int i = 1; i <= 10; ++i) {
+		store->set(kCounterKey, i);
+	}
+	store->set(kNameKey, std::string("profile"));
+
+	// Nothing is written before the delay, and then the last value of each key is.
+	EXPECT_TRUE(readRows(databasePath).empty());
+	const std::map<std::string, std::string> expected{{"counter", "10"}, {"name", "\"profile\""}};
+	EXPECT_TRUE(waitFor([&] { return readRows(databasePath) == expected; }));
+	EXPECT_EQ(store->get(kCounterKey), 10);
+}
+
+TEST_F(ProfileStoreTest, RetriesAFailedFlush)
+{
+	auto store = makeStore(std::chrono::milliseconds(20));
+
+	// Another connection holds the write lock, so the delayed flush fails.
+	unique_sqlite3_t locker = openConnection(databasePath);
+	ASSERT_EQ(sqlite3_exec(locker.get(), "BEGIN IMMEDIATE;", nullptr, nullptr, nullptr), SQLITE_OK);
+	store->set(kCounterKey, 1);
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	ASSERT_EQ(sqlite3_exec(locker.get(), "ROLLBACK;", nullptr, nullptr, nullptr), SQLITE_OK);
+	locker.reset();
+
+	// No further set() is needed for the retry to write it.
+	const std::map<std::string, std::string> expected{{"counter", "1"}};
+	EXPECT_TRUE(waitFor([&] { return readRows(databasePath) == expected; }));
+}
+
+TEST_F(ProfileStoreTest, FlushesOnDestruction)
+{
+	auto store = makeStore(std::chrono::hours(1));
+	store->set(kCounterKey, 42);
+	store.reset();
+
+	const std::map<std::string, std::string> expected{{"counter", "42"}};
+	EXPECT_EQ(readRows(databasePath), expected);
+
+	auto restored = makeStore(std::chrono::hours(1));
+	EXPECT_EQ(restored->get(kCounterKey), 42);
+}
@@ -0,0 +1,140 @@
+/*
+ * KaitoTokyo YouTubeApi Library Tests
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include <KaitoTokyo/YouTubeApi/YouTubeFieldCodec.hpp>
+#include <KaitoTokyo/YouTubeApi/YouTubeListPageDecoder.hpp>
+#include <KaitoTokyo/YouTubeApi/YouTubeTypes.hpp>
+
+using namespace KaitoTokyo;
+
+namespace {
+
+const char *const kBroadcasts = R"({
+	"etag": "page",
+	"items": [
+		{
+			"kind": "youtube#liveBroadcast",
+			"id": "a",
+			"snippet": {
+				"title": "Part 1",
+				"thumbnails": {
+					"default": {"url": "u", "width": 120, "height": 90},
+					"high": {"url": "h"}
+				},
+				"unknown": {"nested": [1, {"title": "not this one"}]}
+			},
+			"status": {"lifeCycleStatus": "live", "madeForKids": false},
+			"contentDetails": {"monitorStream": {"enableMonitorStream": true, "broadcastStreamDelayMs": 0}},
+			"statistics": {"totalChatCount": 12},
+			"monetizationDetails": {"cuepointSchedule": {"enabled": true, "repeatIntervalSecs": 300}}
+		},
+		{"id": "b", "snippet": null, "tags": ["x", "y"]},
+		{"id": "c"}
+	]
+})";
+
+} // anonymous namespace
+
+TEST(YouTubeFieldCodecTest, DirectDecodingMatchesDomDecoding)
+{
+	std::vector<YouTubeApi::YouTubeLiveBroadcast> direct;
+	const YouTubeApi::YouTubeListPageInfo page = YouTubeApi::decodeYouTubeListPage(kBroadcasts, direct);
+
+	const nlohmann::json expected = nlohmann::json::parse(kBroadcasts)["items"];
+	EXPECT_EQ(page.etag, "page");
+	ASSERT_EQ(direct.size(), expected.size());
+	for (std::size_t i = 0; i < direct.size(); ++i) {
+		EXPECT_TRUE(youTubeValuesEqual(direct[i], expected[i].get<YouTubeApi::YouTubeLiveBroadcast>()));
+	}
+	ASSERT_TRUE(direct[0].snippet.has_value());
+	EXPECT_EQ(direct[0].snippet->title, "Part 1");
+	EXPECT_EQ(direct[0].snippet->thumbnails->at("default").height, 90u);
+	EXPECT_EQ(direct[0].statistics->totalChatCount, 12u);
+	EXPECT_TRUE(direct[1].snippet.has_value());
+	EXPECT_FALSE(direct[2].snippet.has_value());
+}
+
+TEST(YouTubeFieldCodecTest, DirectDecodingChecksRequiredFields)
+{
+	std::vector<YouTubeApi::YouTubeLiveStream> streams;
+	EXPECT_THROW(YouTubeApi::decodeYouTubeListPage(R"({"items": [{"kind": "youtube#liveStream"}]})", streams),
+		     std::runtime_error);
+
+	std::vector<YouTubeApi::YouTubeLiveBroadcast> broadcasts;
+	EXPECT_THROW(YouTubeApi::decodeYouTubeListPage(R"({"items": [{"snippet": {"thumbnails": {"a": {}}}}]})",
+						       broadcasts),
+		     std::runtime_error);
+}
+
+TEST(YouTubeFieldCodecTest, DirectDecodingRejectsWrongTypes)
+{
+	std::vector<YouTubeApi::YouTubeLiveBroadcast> broadcasts;
+	EXPECT_THROW(YouTubeApi::decodeYouTubeListPage(R"({"items": [{"id": 5}]})", broadcasts), std::runtime_error);
+	EXPECT_THROW(YouTubeApi::decodeYouTubeListPage(R"({"items": [{"snippet": "x"}]})", broadcasts),
+		     std::runtime_error);
+}
+
+TEST(YouTubeFieldCodecTest, OmitsDefaultSections)
+{
+	YouTubeApi::YouTubeLiveStream stream;
+	stream.id = "s";
+	stream.status.emplace();
+	stream.contentDetails.emplace();
+
+	nlohmann::json j = stream;
+	EXPECT_FALSE(j.contains("status"));
+	EXPECT_FALSE(j.contains("contentDetails"));
+	EXPECT_EQ(j["snippet"]["title"], "");
+
+	stream.status->streamStatus = "active";
+	j = stream;
+	EXPECT_EQ(j["status"]["streamStatus"], "active");
+	EXPECT_TRUE(j["status"]["healthStatus"]["configurationIssues"].is_array());
+}
+
+TEST(YouTubeFieldCodecTest, RoundTripsInsertingBroadcast)
+{
+	YouTubeApi::InsertingYouTubeLiveBroadcast inserting;
+	inserting.snippet.title = "Part 2";
+	inserting.snippet.scheduledStartTime = "2025-01-01T00:00:00Z";
+	inserting.contentDetails.enableDvr = true;
+
+	const nlohmann::json j = inserting;
+	EXPECT_EQ(j["status"]["privacyStatus"], "private");
+	EXPECT_FALSE(j["contentDetails"].contains("monitorStream"));
+
+	const auto decoded = j.get<YouTubeApi::InsertingYouTubeLiveBroadcast>();
+	EXPECT_TRUE(youTubeValuesEqual(decoded, inserting));
+
+	nlohmann::json missingTitle = j;
+	missingTitle["snippet"].erase("title");
+	EXPECT_THROW(missingTitle.get<YouTubeApi::InsertingYouTubeLiveBroadcast>(), std::runtime_error);
+}
@@ -0,0 +1,96 @@
+/*
+ * KaitoTokyo YouTubeApi Library Tests
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include <KaitoTokyo/YouTubeApi/YouTubeListCache.hpp>
+
+using namespace KaitoTokyo;
+
+TEST(YouTubeListCacheTest, StoresAndFindsEntries)
+{
+	YouTubeApi::YouTubeListCache<int> cache;
+	const std::string key = YouTubeApi::YouTubeListCache<int>::makeKey("https://example.com/list", "token");
+
+	EXPECT_FALSE(cache.find(key).has_value());
+
+	cache.store(key, "etag-1", {1, 2, 3});
+
+	const auto entry = cache.find(key);
+	ASSERT_TRUE(entry.has_value());
+	EXPECT_EQ(entry->etag, "etag-1");
+	EXPECT_EQ(*entry->items, (std::vector<int>{1, 2, 3}));
+}
+
+TEST(YouTubeListCacheTest, KeysDependOnUrlAndAccessToken)
+{
+	using Cache = YouTubeApi::YouTubeListCache<int>;
+
+	EXPECT_NE(Cache::makeKey("https://example.com/a", "token"), Cache::makeKey("https://example.com/b", "token"));
+	EXPECT_NE(Cache::makeKey("https://example.com/a", "token1"), Cache::makeKey("https://example.com/a", "token2"));
+	EXPECT_EQ(Cache::makeKey("https://example.com/a", "token"), Cache::makeKey("https://example.com/a", "token"));
+	EXPECT_EQ(Cache::makeKey("https://example.com/a", "secret-token").find("secret-token"), std::string::npos);
+}
+
+TEST(YouTubeListCacheTest, RevalidateRefreshesValidationTime)
+{
+	YouTubeApi::YouTubeListCache<int> cache;
+	cache.store("key", "etag", {1});
+	const auto before = cache.find("key")->validatedAt;
+
+	cache.revalidate("key");
+
+	EXPECT_GE(cache.find("key")->validatedAt, before);
+	EXPECT_EQ(cache.find("key")->etag, "etag");
+}
+
+TEST(YouTubeListCacheTest, EvictsLeastRecentlyValidatedAtCapacity)
+{
+	YouTubeApi::YouTubeListCache<int> cache(2);
+	cache.store("a", "etag-a", {1});
+	cache.store("b", "etag-b", {2});
+	cache.revalidate("a");
+
+	cache.store("c", "etag-c", {3});
+
+	EXPECT_TRUE(cache.find("a").has_value());
+	EXPECT_FALSE(cache.find("b").has_value());
+	EXPECT_TRUE(cache.find("c").has_value());
+}
+
+TEST(YouTubeListCacheTest, EraseAndClearDropEntries)
+{
+	YouTubeApi::YouTubeListCache<int> cache;
+	cache.store("a", "etag-a", {1});
+	cache.store("b", "etag-b", {2});
+
+	cache.erase("a");
+	EXPECT_FALSE(cache.find("a").has_value());
+	EXPECT_TRUE(cache.find("b").has_value());
+
+	cache.clear();
+	EXPECT_FALSE(cache.find("b").has_value());
+}
@@ -0,0 +1,137 @@
+/*
+ * KaitoTokyo YouTubeApi Library Tests
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include <KaitoTokyo/YouTubeApi/YouTubeListPageDecoder.hpp>
+
+using namespace KaitoTokyo;
+
+namespace {
+
+struct Item {
+	std::string id;
+	int count = 0;
+};
+
+void from_json(const nlohmann::json &j, Item &p)
+{
+	p.id = j.at("id").get<std::string>();
+	p.count = j.value("count", 0);
+}
+
+} // anonymous namespace
+
+TEST(YouTubeListPageDecoderTest, DecodesItemsAndPageInfo)
+{
+	const std::string body = R"({
+		"kind": "youtube#liveBroadcastListResponse",
+		"etag": "etag-1",
+		"nextPageToken": "page-2",
+		"pageInfo": {"totalResults": 2, "resultsPerPage": 1},
+		"items": [{"id": "a", "count": 1}, {"id": "b", "extra": {"nested": [1, 2, {"x": null}]}}]
+	})";
+
+	std::vector<Item> items;
+	const YouTubeApi::YouTubeListPageInfo page = YouTubeApi::decodeYouTubeListPage(body, items);
+
+	EXPECT_EQ(page.etag, "etag-1");
+	EXPECT_EQ(page.nextPageToken, "page-2");
+	EXPECT_FALSE(page.error.has_value());
+	ASSERT_EQ(items.size(), 2u);
+	EXPECT_EQ(items[0].id, "a");
+	EXPECT_EQ(items[0].count, 1);
+	EXPECT_EQ(items[1].id, "b");
+	EXPECT_EQ(items[1].count, 0);
+}
+
+TEST(YouTubeListPageDecoderTest, MatchesDomDecoding)
+{
+	const std::string body = R"({
+		"etag": "e",
+		"items": [
+			{"id": "a", "snippet": {"title": "T", "thumbnails": {"default": {"url": "u", "width": 120}}}},
+			{"id": "b", "status": {"lifeCycleStatus": "live", "madeForKids": false}, "ratio": 1.5},
+			{"id": "c", "tags": ["x", "y"], "empty": {}, "none": []}
+		]
+	})";
+
+	std::vector<nlohmann::json> items;
+	YouTubeApi::decodeYouTubeListPage(body, items);
+
+	const nlohmann::json expected = nlohmann::json::parse(body)["items"];
+	ASSERT_EQ(items.size(), expected.size());
+	for (std::size_t i = 0; i < items.size(); ++i) {
+		EXPECT_EQ(items[i], expected[i]);
+	}
+}
+
+TEST(YouTubeListPageDecoderTest, AppendsToExistingItems)
+{
+	std::vector<Item> items;
+	YouTubeApi::decodeYouTubeListPage(R"({"items": [{"id": "a"}]})", items);
+	const YouTubeApi::YouTubeListPageInfo page =
+		YouTubeApi::decodeYouTubeListPage(R"({"items": [{"id": "b"}]})", items);
+
+	EXPECT_TRUE(page.nextPageToken.empty());
+	ASSERT_EQ(items.size(), 2u);
+	EXPECT_EQ(items[0].id, "a");
+	EXPECT_EQ(items[1].id, "b");
+}
+
+TEST(YouTubeListPageDecoderTest, CapturesApiError)
+{
+	const std::string body = R"({"error": {"code": 403, "errors": [{"reason": "quotaExceeded"}]}})";
+
+	std::vector<Item> items;
+	const YouTubeApi::YouTubeListPageInfo page = YouTubeApi::decodeYouTubeListPage(body, items);
+
+	ASSERT_TRUE(page.error.has_value());
+	EXPECT_EQ((*page.error)["code"], 403);
+	EXPECT_EQ((*page.error)["errors"][0]["reason"], "quotaExceeded");
+	EXPECT_TRUE(items.empty());
+}
+
+TEST(YouTubeListPageDecoderTest, IgnoresNestedKeysNamedLikePageInfo)
+{
+	const std::string body = R"({"items": [{"id": "a", "etag": "item-etag", "nextPageToken": "no"}]})";
+
+	std::vector<Item> items;
+	const YouTubeApi::YouTubeListPageInfo page = YouTubeApi::decodeYouTubeListPage(body, items);
+
+	EXPECT_TRUE(page.etag.empty());
+	EXPECT_TRUE(page.nextPageToken.empty());
+	ASSERT_EQ(items.size(), 1u);
+}
+
+TEST(YouTubeListPageDecoderTest, ThrowsOnMalformedJson)
+{
+	std::vector<Item> items;
+	EXPECT_THROW(YouTubeApi::decodeYouTubeListPage(R"({"items": [{"id": "a"})", items), std::runtime_error);
+}
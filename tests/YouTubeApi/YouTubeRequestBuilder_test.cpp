@@ -0,0 +1,100 @@
+/*
+ * KaitoTokyo YouTubeApi Library Tests
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <curl/curl.h>
+
+#include <KaitoTokyo/CurlHelper/CurlUrlHandle.hpp>
+#include <KaitoTokyo/CurlHelper/CurlUrlSearchParams.hpp>
+#include <KaitoTokyo/YouTubeApi/YouTubeRequestBuilder.hpp>
+
+using namespace KaitoTokyo;
+
+TEST(YouTubeRequestBuilderTest, BuildsTheSameUrlAsLibcurl)
+{
+	const std::string value = "a b,c(d)/e?f&g=h~i.j_k-l\xE3\x81\x82%";
+
+	std::unique_ptr<CURL, decltype(&curl_easy_cleanup)> curl(curl_easy_init(), curl_easy_cleanup);
+	ASSERT_TRUE(curl);
+	CurlHelper::CurlUrlSearchParams params(curl.get());
+	params.append("part", "id,snippet");
+	params.append("fields", "etag,nextPageToken,items(" + value + ")");
+	params.append("id", "x,y");
+	CurlHelper::CurlUrlHandle urlHandle;
+	urlHandle.setUrl(std::string(YouTubeApi::YouTubeEndpoint::kLiveBroadcasts).c_str());
+	const std::string qs = params.toString();
+	urlHandle.appendQuery(qs.c_str());
+
+	std::string buffer = "stale";
+	YouTubeApi::YouTubeRequestUrl url(buffer);
+	url.reset(YouTubeApi::YouTubeEndpoint::kLiveBroadcasts);
+	url.append("part", "id,snippet");
+	url.append("fields", "etag,nextPageToken,items(").appendToValue(value).appendToValue(")");
+	url.append("id", "x").appendToValue(",").appendToValue("y");
+
+	EXPECT_STREQ(url.c_str(), urlHandle.c_str().get());
+}
+
+TEST(YouTubeRequestBuilderTest, TruncatesBackToTheFirstPage)
+{
+	std::string buffer;
+	YouTubeApi::YouTubeRequestUrl url(buffer);
+	url.reset("https://example.com/list");
+	const std::size_t firstPageUrlSize = url.size();
+
+	url.append("pageToken", "p1");
+	EXPECT_EQ(url.view(), "https://example.com/list?pageToken=p1");
+
+	url.truncate(firstPageUrlSize);
+	url.append("mine", "true");
+	EXPECT_EQ(url.view(), "https://example.com/list?mine=true");
+
+	YouTubeApi::YouTubeRequestUrl continued(buffer);
+	continued.append("pageToken", "p2");
+	EXPECT_EQ(buffer, "https://example.com/list?mine=true&pageToken=p2");
+}
+
+TEST(YouTubeRequestBuilderTest, RebuildsHeadersOnlyWhenTheTokenChanges)
+{
+	YouTubeApi::YouTubeAuthHeaderCache cache;
+
+	const std::shared_ptr<const YouTubeApi::YouTubeAuthHeaders> first = cache.get("token1");
+	EXPECT_EQ(cache.get("token1"), first);
+	EXPECT_STREQ(first->getAuthorization()->data, "Authorization: Bearer token1");
+	EXPECT_EQ(first->getAuthorization()->next, nullptr);
+	EXPECT_STREQ(first->getJson()->data, "Authorization: Bearer token1");
+	ASSERT_NE(first->getJson()->next, nullptr);
+	EXPECT_STREQ(first->getJson()->next->data, "Content-Type: application/json");
+
+	const std::shared_ptr<const YouTubeApi::YouTubeAuthHeaders> second = cache.get("token2");
+	EXPECT_NE(second, first);
+	EXPECT_STREQ(second->getAuthorization()->data, "Authorization: Bearer token2");
+	EXPECT_STREQ(first->getAuthorization()->data, "Authorization: Bearer token1");
+}
@@ -0,0 +1,180 @@
+/*
+ * KaitoTokyo YouTubeApi Library Tests
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#include <KaitoTokyo/Async/Task.hpp>
+#include <KaitoTokyo/YouTubeApi/YouTubeRequestScheduler.hpp>
+
+using namespace KaitoTokyo;
+using namespace KaitoTokyo::YouTubeApi;
+
+namespace {
+
+const std::function<bool()> kNeverAbort;
+
+void acquireInline(YouTubeRequestScheduler &scheduler, YouTubeApiMethod method,
+		   YouTubeRequestPriority priority = YouTubeRequestPriority::Normal,
+		   const std::function<bool()> &shouldAbort = kNeverAbort)
+{
+	YouTubeRequestScheduler::PermitAwaiter awaiter =
+		scheduler.acquire(method, priority, YouTubeRequestScheduler::Clock::time_point{}, shouldAbort, true);
+	ASSERT_TRUE(awaiter.await_ready());
+	awaiter.await_resume();
+}
+
+struct Recorder {
+	std::mutex mutex;
+	std::vector<YouTubeRequestPriority> order;
+};
+
+Async::Task<void> acquireAndRecord(YouTubeRequestScheduler &scheduler, YouTubeRequestPriority priority,
+				   Recorder &recorder, std::promise<void> &promise)
+{
+	co_await scheduler.acquire(YouTubeApiMethod::LiveStreamsList, priority,
+				   YouTubeRequestScheduler::Clock::time_point{}, kNeverAbort, false);
+	{
+		std::scoped_lock lock(recorder.mutex);
+		recorder.order.push_back(priority);
+	}
+	promise.set_value();
+}
+
+} // anonymous namespace
+
+TEST(YouTubeRequestSchedulerTest, ChargesQuotaPerMethod)
+{
+	YouTubeRequestScheduler scheduler;
+
+	acquireInline(scheduler, YouTubeApiMethod::LiveStreamsList);
+	acquireInline(scheduler, YouTubeApiMethod::LiveBroadcastsTransition);
+
+	const YouTubeQuotaStatistics statistics = scheduler.getStatistics();
+	EXPECT_EQ(statistics.unitsUsed, 51);
+	EXPECT_EQ(statistics.dailyQuotaUnits, 10000);
+	EXPECT_EQ(statistics.requests, 2u);
+	EXPECT_EQ(statistics.throttledRequests, 0u);
+}
+
+TEST(YouTubeRequestSchedulerTest, InlineWaitsAreRateLimited)
+{
+	YouTubeRequestScheduler scheduler({.requestsPerSecond = 20.0, .burst = 1.0});
+
+	const auto start = std::chrono::steady_clock::now();
+	acquireInline(scheduler, YouTubeApiMethod::LiveStreamsList);
+	acquireInline(scheduler, YouTubeApiMethod::LiveStreamsList);
+	acquireInline(scheduler, YouTubeApiMethod::LiveStreamsList);
+	const auto elapsed = std::chrono::steady_clock::now() - start;
+
+	EXPECT_GE(elapsed, std::chrono::milliseconds(90));
+	EXPECT_EQ(scheduler.getStatistics().throttledRequests, 2u);
+}
+
+TEST(YouTubeRequestSchedulerTest, GrantsHigherPriorityFirst)
+{
+	Recorder recorder;
+	std::promise<void> backgroundDone;
+	std::promise<void> cutoverDone;
+	Async::Task<void> background;
+	Async::Task<void> cutover;
+
+	// Destroyed first, so the dispatcher is done with the tasks before they go away.
+	YouTubeRequestScheduler scheduler({.requestsPerSecond = 10.0, .burst = 1.0});
+	acquireInline(scheduler, YouTubeApiMethod::LiveStreamsList);
+
+	background = acquireAndRecord(scheduler, YouTubeRequestPriority::Background, recorder, backgroundDone);
+	cutover = acquireAndRecord(scheduler, YouTubeRequestPriority::Cutover, recorder, cutoverDone);
+	background.start();
+	cutover.start();
+
+	backgroundDone.get_future().wait();
+	cutoverDone.get_future().wait();
+
+	ASSERT_EQ(recorder.order.size(), 2u);
+	EXPECT_EQ(recorder.order[0], YouTubeRequestPriority::Cutover);
+	EXPECT_EQ(recorder.order[1], YouTubeRequestPriority::Background);
+}
+
+TEST(YouTubeRequestSchedulerTest, KeepsCutoverReserveFromBackgroundRequests)
+{
+	YouTubeRequestScheduler scheduler({.dailyQuotaUnits = 100, .cutoverReserveUnits = 60});
+
+	EXPECT_THROW(acquireInline(scheduler, YouTubeApiMethod::LiveBroadcastsInsert,
+				   YouTubeRequestPriority::Background),
+		     std::runtime_error);
+	acquireInline(scheduler, YouTubeApiMethod::LiveBroadcastsInsert, YouTubeRequestPriority::Cutover);
+
+	EXPECT_EQ(scheduler.getStatistics().unitsUsed, 50);
+}
+
+TEST(YouTubeRequestSchedulerTest, AbortsWaitingRequests)
+{
+	YouTubeRequestScheduler scheduler({.requestsPerSecond = 0.001, .burst = 1.0});
+	acquireInline(scheduler, YouTubeApiMethod::LiveStreamsList);
+
+	const std::function<bool()> abort = []() { return true; };
+	EXPECT_THROW(acquireInline(scheduler, YouTubeApiMethod::LiveStreamsList, YouTubeRequestPriority::Normal, abort),
+		     std::runtime_error);
+}
+
+TEST(YouTubeRequestSchedulerTest, RetriesOnlyWhatIsSafeToRepeat)
+{
+	YouTubeRequestScheduler scheduler({.maxAttempts = 3});
+
+	EXPECT_TRUE(scheduler.shouldRetry(YouTubeApiMethod::LiveBroadcastsInsert, YouTubeRequestFailure::NotSent, 1));
+	EXPECT_TRUE(scheduler.shouldRetry(YouTubeApiMethod::LiveBroadcastsInsert, YouTubeRequestFailure::Throttled, 1));
+	EXPECT_FALSE(
+		scheduler.shouldRetry(YouTubeApiMethod::LiveBroadcastsInsert, YouTubeRequestFailure::ServerError, 1));
+	EXPECT_FALSE(scheduler.shouldRetry(YouTubeApiMethod::LiveBroadcastsTransition,
+					   YouTubeRequestFailure::Interrupted, 1));
+	EXPECT_TRUE(scheduler.shouldRetry(YouTubeApiMethod::LiveStreamsList, YouTubeRequestFailure::ServerError, 2));
+	EXPECT_FALSE(scheduler.shouldRetry(YouTubeApiMethod::LiveStreamsList, YouTubeRequestFailure::ServerError, 3));
+}
+
+TEST(YouTubeRequestSchedulerTest, BacksOffExponentiallyWithJitter)
+{
+	YouTubeRequestScheduler scheduler(
+		{.initialBackoff = std::chrono::milliseconds(100), .maxBackoff = std::chrono::milliseconds(1000)});
+
+	for (int i = 0; i < 16; ++i) {
+		const std::chrono::milliseconds first = scheduler.nextBackoff(1);
+		EXPECT_GE(first.count(), 50);
+		EXPECT_LE(first.count(), 100);
+
+		const std::chrono::milliseconds third = scheduler.nextBackoff(3);
+		EXPECT_GE(third.count(), 200);
+		EXPECT_LE(third.count(), 400);
+
+		const std::chrono::milliseconds capped = scheduler.nextBackoff(10);
+		EXPECT_GE(capped.count(), 500);
+		EXPECT_LE(capped.count(), 1000);
+	}
+	EXPECT_EQ(scheduler.getStatistics().retries, 48u);
+}
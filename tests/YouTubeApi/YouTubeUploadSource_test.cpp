@@ -0,0 +1,108 @@
+/*
+ * KaitoTokyo YouTubeApi Library Tests
+ * Copyright (C) 2025 Kaito Udagawa umireon@kaito.tokyo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <KaitoTokyo/YouTubeApi/YouTubeUploadSource.hpp>
+
+using namespace KaitoTokyo;
+
+namespace {
+
+std::filesystem::path writeTempFile(const std::string &name, const std::string &contents)
+{
+	const std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+	std::ofstream ofs(path, std::ios::binary);
+	ofs << contents;
+	return path;
+}
+
+std::string toString(std::span<const char> bytes)
+{
+	return std::string(bytes.begin(), bytes.end());
+}
+
+} // anonymous namespace
+
+TEST(YouTubeUploadSourceTest, MapsFileContents)
+{
+	const std::filesystem::path path = writeTempFile("YouTubeUploadSourceTest_Map.png", "\x89PNG-bytes");
+
+	{
+		const YouTubeApi::YouTubeUploadSource source =
+			YouTubeApi::YouTubeUploadSource::mapFile(path, "image/png");
+		EXPECT_EQ(toString(source.getBytes()), "\x89PNG-bytes");
+		EXPECT_EQ(source.getContentType(), "image/png");
+	}
+
+	std::filesystem::remove(path);
+}
+
+TEST(YouTubeUploadSourceTest, RejectsMissingAndEmptyFiles)
+{
+	const std::filesystem::path missing =
+		std::filesystem::temp_directory_path() / "YouTubeUploadSourceTest_Missing.png";
+	EXPECT_THROW(YouTubeApi::YouTubeUploadSource::mapFile(missing, "image/png"), std::runtime_error);
+
+	const std::filesystem::path empty = writeTempFile("YouTubeUploadSourceTest_Empty.png", "");
+	EXPECT_THROW(YouTubeApi::YouTubeUploadSource::mapFile(empty, "image/png"), std::runtime_error);
+	std::filesystem::remove(empty);
+}
+
+TEST(YouTubeUploadSourceTest, ServesBufferWithoutCopying)
+{
+	std::vector<char> buffer{'j', 'p', 'g'};
+	const char *data = buffer.data();
+
+	const YouTubeApi::YouTubeUploadSource source =
+		YouTubeApi::YouTubeUploadSource::fromBuffer(std::move(buffer), "image/jpeg");
+	EXPECT_EQ(source.getBytes().data(), data);
+	EXPECT_EQ(toString(source.getBytes()), "jpg");
+	EXPECT_EQ(source.getContentType(), "image/jpeg");
+}
+
+TEST(YouTubeUploadSourceTest, MovesKeepTheBytes)
+{
+	const std::filesystem::path path = writeTempFile("YouTubeUploadSourceTest_Move.jpg", "mapped");
+
+	{
+		YouTubeApi::YouTubeUploadSource mapped = YouTubeApi::YouTubeUploadSource::mapFile(path, "image/jpeg");
+		YouTubeApi::YouTubeUploadSource moved = std::move(mapped);
+		EXPECT_EQ(toString(moved.getBytes()), "mapped");
+		EXPECT_TRUE(mapped.getBytes().empty());
+
+		moved = YouTubeApi::YouTubeUploadSource::fromBuffer({'b', 'u', 'f'}, "image/png");
+		EXPECT_EQ(toString(moved.getBytes()), "buf");
+		EXPECT_EQ(moved.getContentType(), "image/png");
+	}
+
+	std::filesystem::remove(path);
+}
@@ -1,7 +1,11 @@
 #include <emscripten/bind.h>
+#include <emscripten/em_asm.h>
 
+#include <filesystem>
 #include <memory>
 #include <optional>
+#include <stdexcept>
+#include <string>
 
 #include <KaitoTokyo/Logger/ILogger.hpp>
 #include <KaitoTokyo/Logger/NullLogger.hpp>
@@ -13,20 +17,116 @@
 using namespace KaitoTokyo;
 using namespace KaitoTokyo::LiveStreamSegmenter;
 
+namespace {
+
+// Mounted by PersistentStorage.js when IndexedDB is available; otherwise everything stays in memory.
+const std::filesystem::path kPersistentStorageDirectory = "/persistent";
+
+std::filesystem::path getStorageDirectory()
+{
+	std::error_code ec;
+	return std::filesystem::is_directory(kPersistentStorageDirectory, ec) ? kPersistentStorageDirectory
+									       : std::filesystem::path();
+}
+
+void schedulePersistentStorageSync()
+{
+	EM_ASM({
+		if (Module["schedulePersistentStorageSync"]) {
+			Module["schedulePersistentStorageSync"]();
+		}
+	});
+}
+
+} // anonymous namespace
+
+// Keeps one runtime alive across evaluations, so the bundles are registered once, and keeps the
+// context for as long as the script stays the same, so repeated calls skip compilation entirely.
+// The database and the bytecode cache live in persistent storage when it is mounted.
+class EventScripting {
+public:
+	EventScripting()
+		: logger_(std::make_shared<Logger::NullLogger>()),
+		  runtime_(std::make_shared<Scripting::ScriptingRuntime>()),
+		  databasePath_(getStorageDirectory() / "database.sqlite3"),
+		  bytecodeCachePath_(getStorageDirectory() / "live-stream-segmenter_EventHandlerStore_bytecode.bin")
+	{
+		runtime_->setLogger(logger_);
+	}
+
+	EventScripting(const EventScripting &) = delete;
+	EventScripting &operator=(const EventScripting &) = delete;
+
+	// Rebuilds the context only when the script differs from the loaded one.
+	void load(const std::string &script)
+	{
+		if (context_ && script == loadedScript_) {
+			return;
+		}
+
+		// Release the previous context first so the database is never opened twice.
+		reset();
+
+		std::shared_ptr<JSContext> ctx = runtime_->createContextRaw();
+		auto context = std::make_unique<Scripting::EventScriptingContext>(runtime_, ctx, logger_);
+		auto database =
+			std::make_unique<Scripting::ScriptingDatabase>(runtime_, ctx, logger_, databasePath_, true);
+		context->setupContext();
+		database->setupContext();
+		context->setupLocalStorage(*database);
+		context->loadEventHandler(script.c_str(), bytecodeCachePath_);
+		schedulePersistentStorageSync();
+
+		ctx_ = std::move(ctx);
+		database_ = std::move(database);
+		context_ = std::move(context);
+		loadedScript_ = script;
+	}
+
+	std::string call(const std::string &functionName, const std::string &eventObject)
+	{
+		if (!context_) {
+			throw std::runtime_error("ScriptNotLoadedError(EventScripting::call)");
+		}
+		// Scripts may write to the database or localStorage even when the call fails.
+		struct SyncOnExit {
+			~SyncOnExit() { schedulePersistentStorageSync(); }
+		} syncOnExit;
+		return context_->executeFunction(functionName.c_str(), eventObject.c_str());
+	}
+
+	// Drops the context and its globals; the next load() starts from a fresh one.
+	void reset()
+	{
+		context_.reset();
+		database_.reset();
+		ctx_.reset();
+		loadedScript_.clear();
+	}
+
+private:
+	const std::shared_ptr<const Logger::ILogger> logger_;
+	const std::shared_ptr<Scripting::ScriptingRuntime> runtime_;
+	const std::filesystem::path databasePath_;
+	const std::filesystem::path bytecodeCachePath_;
+
+	std::string loadedScript_;
+	std::shared_ptr<JSContext> ctx_;
+	std::unique_ptr<Scripting::ScriptingDatabase> database_;
+	std::unique_ptr<Scripting::EventScriptingContext> context_;
+};
+
 std::string evaluateFunction(const std::string& script, const std::string& functionName, const std::string& eventObject) {
-	std::shared_ptr<const Logger::ILogger> logger = std::make_shared<Logger::NullLogger>();
-	auto runtime = std::make_shared<Scripting::ScriptingRuntime>();
-	runtime->setLogger(logger);
-	std::shared_ptr<JSContext> ctx = runtime->createContextRaw();
-	Scripting::EventScriptingContext context(runtime, ctx, logger);
-	Scripting::ScriptingDatabase database(runtime, ctx, logger, "database.sqlite3", true);
-	context.setupContext();
-	database.setupContext();
-	context.setupLocalStorage();
-	context.loadEventHandler(script.c_str());
-	return context.executeFunction(functionName.c_str(), eventObject.c_str());
+	EventScripting scripting;
+	scripting.load(script);
+	return scripting.call(functionName, eventObject);
 }
 
 EMSCRIPTEN_BINDINGS(event_scripting_module) {
+	emscripten::class_<EventScripting>("EventScripting")
+		.constructor<>()
+		.function("load", &EventScripting::load)
+		.function("call", &EventScripting::call)
+		.function("reset", &EventScripting::reset);
 	emscripten::function("evaluateFunction", &evaluateFunction);
 }
@@ -0,0 +1,68 @@
+// Included with --pre-js. Mounts IndexedDB-backed storage at /persistent before the module starts, so
+// the script database and the bytecode cache survive reloads like they do in the plugin. Writes stay in
+// memory and are flushed in batches; pass { persistentStorage: false } to the factory to opt out.
+
+const kPersistentStorageDirectory = "/persistent";
+const kPersistentStorageSyncDelayMilliseconds = 1000;
+
+let persistentStorageMounted = false;
+let persistentStorageSyncTimer = null;
+let persistentStorageSyncing = false;
+let persistentStorageDirty = false;
+
+function syncPersistentStorage() {
+  persistentStorageSyncTimer = null;
+  if (persistentStorageSyncing) {
+    // Picked up again once the running sync finishes.
+    persistentStorageDirty = true;
+    return;
+  }
+
+  persistentStorageSyncing = true;
+  persistentStorageDirty = false;
+  FS.syncfs(false, (err) => {
+    persistentStorageSyncing = false;
+    if (err) {
+      console.warn("EventScripting: failed to save persistent storage", err);
+    }
+    if (persistentStorageDirty) {
+      syncPersistentStorage();
+    }
+  });
+}
+
+// Called by the module after every call that may have written to storage.
+Module["schedulePersistentStorageSync"] = () => {
+  if (persistentStorageMounted && persistentStorageSyncTimer === null) {
+    persistentStorageSyncTimer = setTimeout(syncPersistentStorage, kPersistentStorageSyncDelayMilliseconds);
+  }
+};
+
+Module["preRun"] = [].concat(Module["preRun"] || [], () => {
+  if (Module["persistentStorage"] === false || typeof indexedDB === "undefined") {
+    return;
+  }
+
+  FS.mkdir(kPersistentStorageDirectory);
+  FS.mount(IDBFS, {}, kPersistentStorageDirectory);
+
+  addRunDependency("persistentStorage");
+  FS.syncfs(true, (err) => {
+    if (err) {
+      console.warn("EventScripting: failed to load persistent storage", err);
+    } else {
+      persistentStorageMounted = true;
+    }
+    removeRunDependency("persistentStorage");
+  });
+
+  // Flush pending writes when the page goes away; the timer may never fire otherwise.
+  if (typeof addEventListener === "function") {
+    addEventListener("pagehide", () => {
+      if (persistentStorageSyncTimer !== null) {
+        clearTimeout(persistentStorageSyncTimer);
+        syncPersistentStorage();
+      }
+    });
+  }
+});